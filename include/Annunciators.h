@@ -0,0 +1,40 @@
+#pragma once
+#include <stdint.h>
+#include "Instrument.h"
+
+// The annunciator strip, in the 320x180 of the panel below the turn
+// coordinator. A row of labelled lamps, each lit or dark.
+//
+// It is an instrument of its own: its own state, published to core 1 on its
+// own channel, its own dirty areas and its own band buffers. A lamp that
+// changes dirties just its rectangle, composed again through the strip's
+// 10-row bands, and nothing here ever makes the turn coordinator redraw, or
+// the other way round. Lamps have no flash tiles like the LEDs': lit and dark
+// for all eight would take about 185 KB.
+#define ANNUNCIATOR_WIDTH 320
+#define ANNUNCIATOR_HEIGHT 180
+
+#define ANNUNCIATOR_COUNT 8
+
+// Everything the strip needs to draw a frame. Like InstrumentState, core 0
+// owns the live copy and core 1 renders from a snapshot.
+struct AnnunciatorState
+{
+  bool lit[ANNUNCIATOR_COUNT] = {};
+};
+
+// One lamp: a tile with a label of up to four letters or digits, dark grey
+// when off and litColor (RGB565) when on.
+class AnnunciatorLayer : public Layer
+{
+public:
+  AnnunciatorLayer(const Rect &tile, const char *label, uint16_t litColor, const bool &on);
+  bool update() override;
+  void draw(Canvas &c) override;
+
+private:
+  const char *label;
+  uint16_t litColor; // Panel byte order
+  const bool &on;
+  bool shown = false;
+};
@@ -0,0 +1,54 @@
+#pragma once
+#include <stdint.h>
+#include "DirtyRegion.h"
+
+// Somewhere to stream finished bands of pixels, normally the panel via DMA.
+// A transfer runs in the background after startTransfer() returns, and the
+// pixels must stay untouched until wait() says it is done. Only one transfer
+// is ever in flight. test_band_scheduler swaps in a recording one to check
+// the ordering.
+class BandSink
+{
+public:
+  virtual ~BandSink() {}
+  virtual void startTransfer(const Rect &r, const uint16_t *pixels) = 0;
+  virtual void wait() = 0;
+
+  // A transfer was started and not yet waited for. Kept by the schedulers,
+  // so several can share one sink and take turns on the bus.
+  bool busy = false;
+};
+
+// Fills buf with the r.w x r.h pixels of area r, row by row.
+typedef void (*BandFill)(const Rect &r, uint16_t *buf, void *ctx);
+
+// Ping-pong band pusher. A rectangle is cut into bands that fit one buffer.
+// While the sink streams one buffer we fill the other, so composing the next
+// band overlaps the transfer of the previous one instead of waiting on it.
+// Schedulers for different parts of the panel can share a sink: each fills
+// its own buffers, and only waits when it has a band ready to send.
+class BandScheduler
+{
+public:
+  BandScheduler(BandSink &sink, uint16_t *bufA, uint16_t *bufB, uint32_t bufPixels);
+
+  void push(const Rect &r, BandFill fill, void *ctx = nullptr);
+
+  // Send r.w x r.h pixels that are already made, such as a tile in flash,
+  // without copying them. They must stay untouched until finish().
+  void pushPixels(const Rect &r, const uint16_t *src);
+
+  // Wait for the last band to land. The buffers are free again after this.
+  void finish();
+
+  uint32_t bandCount() const { return bands; }
+  uint32_t pixelCount() const { return pixels; }
+  void resetCounts() { bands = pixels = 0; }
+
+private:
+  BandSink &sink;
+  uint16_t *buf[2];
+  uint32_t bufPixels;
+  uint8_t next = 0; // Buffer to fill next. The other one may be in flight.
+  uint32_t bands = 0, pixels = 0;
+};
@@ -0,0 +1,54 @@
+#pragma once
+#include <stdint.h>
+#include "DirtyRegion.h"
+
+// A window of the screen backed by a plain pixel buffer, one band at a time.
+// The buffer holds area.w x area.h pixels, row by row, already in the byte
+// order the panel wants, so a finished band can go straight out by DMA.
+// A clipped canvas shares its parent's rows, so its stride can be wider.
+//
+// Draw calls take screen coordinates and clip to the window, so the same
+// drawing code works for a 320x20 band or for a whole frame.
+struct Canvas
+{
+  uint16_t *pixels;
+  Rect area;
+  int16_t stride; // Pixels from one row to the next
+
+  Canvas() : pixels(nullptr), area{0, 0, 0, 0}, stride(0) {}
+  Canvas(uint16_t *pixels, const Rect &area) : pixels(pixels), area(area), stride(area.w) {}
+
+  uint16_t *row(int16_t y) { return pixels + (y - area.y) * stride - area.x; } // Indexed by screen x
+
+  // The part of this canvas inside r, drawing into the same pixels.
+  Canvas clip(const Rect &r)
+  {
+    Canvas c;
+    c.area = rectIntersect(area, r);
+    if (c.area.empty()) return c;
+    c.pixels = row(c.area.y) + c.area.x;
+    c.stride = stride;
+    return c;
+  }
+};
+
+// The panel wants RGB565 high byte first, the other way round from the MCU.
+// Images come from tools/gen_assets.py already swapped, so they copy as is.
+// Blending has to swap to MCU order and back.
+inline uint16_t swap565(uint16_t c) { return (c >> 8) | (c << 8); }
+
+// Mix fg over bg, alpha from 0 (all bg) to 32 (all fg). Green is moved up
+// out of the way so all three channels scale in one 32-bit multiply.
+inline uint16_t blend565(uint16_t fg, uint16_t bg, uint8_t alpha)
+{
+  uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81F;
+  uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81F;
+  uint32_t r = (((f - b) * alpha >> 5) + b) & 0x07E0F81F;
+  return r | (r >> 16);
+}
+
+// Copy an image already in panel byte order, every pixel opaque.
+void drawImage(Canvas &c, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *img);
+
+// Fill r with one colour, given in panel byte order.
+void fillRect(Canvas &c, const Rect &r, uint16_t color);
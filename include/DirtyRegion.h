@@ -0,0 +1,55 @@
+#pragma once
+#include <stdint.h>
+
+// Screen rectangle in pixels. A rectangle with no width or height is empty.
+struct Rect
+{
+  int16_t x, y, w, h;
+
+  bool empty() const { return w <= 0 || h <= 0; }
+  int32_t area() const { return empty() ? 0 : (int32_t)w * h; }
+  int16_t right() const { return x + w; }   // One past the last column
+  int16_t bottom() const { return y + h; }  // One past the last row
+};
+
+Rect rectUnion(const Rect &a, const Rect &b);
+Rect rectIntersect(const Rect &a, const Rect &b);
+bool rectOverlaps(const Rect &a, const Rect &b);
+bool rectContains(const Rect &outer, const Rect &inner);
+
+// The parts of a outside b, as up to four rectangles (above, below, left,
+// right). Returns how many were written to out.
+uint8_t rectSubtract(const Rect &a, const Rect &b, Rect out[4]);
+
+// Maximum number of separate rectangles tracked per frame. When it fills up,
+// new rectangles are folded into whichever existing one grows the least.
+#define DIRTY_MAX_RECTS 16
+
+// Two rectangles are merged when their union wastes no more than this many
+// pixels. Each extra rectangle costs a setWindow on the SPI bus, so pushing
+// a few unchanged pixels is cheaper than opening another window.
+#define DIRTY_MERGE_SLACK 256
+
+// The set of screen areas that changed since the last frame was pushed.
+// Everything is clipped to the bounds given at construction.
+class DirtyRegion
+{
+public:
+  DirtyRegion(int16_t width, int16_t height);
+
+  void add(Rect r);
+  void addAll();  // Whole area, e.g. the very first frame
+  void clear() { count = 0; }
+
+  uint8_t size() const { return count; }
+  const Rect &operator[](uint8_t i) const { return rects[i]; }
+  bool empty() const { return count == 0; }
+  int32_t area() const;
+
+private:
+  void mergeOverlapping();
+
+  Rect bounds;
+  Rect rects[DIRTY_MAX_RECTS];
+  uint8_t count = 0;
+};
@@ -0,0 +1,51 @@
+#pragma once
+#include <stdint.h>
+
+// Where the scheduler gets the time, in microseconds. micros() on the
+// device. A host test passes a fake clock it can step by hand.
+typedef unsigned long (*FrameClock)();
+
+// Fixed-rate frame pacing on absolute deadlines.
+//
+// Deadlines are one period apart no matter how long each frame takes, so
+// the rate does not drift with load the way "work, then delay(10)" does.
+// Poll due() from the loop: it says yes once per deadline and no in between,
+// so the time left over goes to whatever else the loop does.
+//
+// A frame that starts a whole period or more late has missed its deadline.
+// Rather than running the frames it owes back to back, the scheduler skips
+// them and lines up with the next deadline still ahead. All maths is on
+// wrapping 32-bit differences, so micros() rolling over every 71 minutes
+// does no harm.
+class FrameScheduler
+{
+public:
+  FrameScheduler(uint32_t hz, FrameClock clock);
+
+  void setRate(uint32_t hz);
+  uint32_t period() const { return periodMicros; }
+
+  // True when the next frame is due. The first call is always due.
+  bool due();
+
+  // Call after idling. A deadline that went by while idle is moved up to
+  // now, so the next frame is due at once but does not count as late.
+  // A deadline still ahead stays put, so the rate is never exceeded.
+  void resync();
+
+  // How late the frame due() just started is, in microseconds.
+  uint32_t lateness() const { return late; }
+
+  uint32_t frameCount() const { return frames; }
+  uint32_t missedCount() const { return missed; } // Frames started a period or more late
+  uint32_t skippedCount() const { return skipped; } // Deadlines dropped to catch up
+  void resetCounts() { frames = missed = skipped = 0; }
+
+private:
+  FrameClock clock;
+  uint32_t periodMicros;
+  uint32_t deadline = 0;
+  bool started = false;
+  uint32_t late = 0;
+  uint32_t frames = 0, missed = 0, skipped = 0;
+};
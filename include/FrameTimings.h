@@ -0,0 +1,97 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "FrameScheduler.h"
+
+// Where a frame's time goes, stage by stage.
+//
+// Scoped timers around each render stage add up how long it took over the
+// whole frame, across every band it ran in. At the end of the frame each
+// stage that ran files its total in a histogram. Build with -D FRAME_TIMING
+// to turn it on. Without it TIME_STAGE compiles to nothing.
+enum Stage : uint8_t
+{
+  STAGE_COLLECT, // Working out the dirty areas
+  STAGE_DIAL,    // Decoding the background where nothing could be restored
+  STAGE_BALL,
+  STAGE_LEDS,
+  STAGE_PLANE,
+  STAGE_ANNUNCIATORS,
+  STAGE_PUSH,    // Waiting on the panel's DMA
+  STAGE_FRAME,   // The whole frame, all of the above included
+  STAGE_COUNT
+};
+
+// Fixed buckets, exact below 16 us and then four to each doubling, so a
+// percentile is never more than 25% high. The last bucket tops out at 16.7 s.
+#define HISTOGRAM_BUCKETS 96
+
+class Histogram
+{
+public:
+  void record(uint32_t micros);
+  void clear();
+
+  uint32_t count() const { return n; }
+  uint32_t min() const { return n ? lo : 0; }
+  uint32_t max() const { return hi; }
+
+  // Time below which p percent of the samples fall, as the top of the
+  // bucket it lands in. 0 if nothing was recorded.
+  uint32_t percentile(uint8_t p) const;
+
+  static uint8_t bucket(uint32_t micros);
+  static uint32_t bucketTop(uint8_t b);
+
+private:
+  uint32_t counts[HISTOGRAM_BUCKETS] = {};
+  uint32_t n = 0, lo = UINT32_MAX, hi = 0;
+};
+
+// Size of what FrameTimings::serialize() writes.
+#define FRAME_TIMINGS_BYTES (4 + STAGE_COUNT * 20)
+
+class FrameTimings
+{
+public:
+  explicit FrameTimings(FrameClock clock) : clock(clock) {}
+
+  void beginFrame();
+  void add(Stage stage, uint32_t micros);
+  void endFrame();
+
+  const Histogram &stage(Stage s) const { return stages[s]; }
+  void clear();
+
+  // Compact little-endian dump: 'F', 'T', version, stage count, then per
+  // stage in enum order: count, min, max, p50, p99, four bytes each.
+  // Needs FRAME_TIMINGS_BYTES.
+  size_t serialize(uint8_t *out) const;
+
+  FrameClock clock;
+
+private:
+  Histogram stages[STAGE_COUNT];
+  uint32_t total[STAGE_COUNT] = {};
+  uint32_t ran = 0; // Bit per stage that ran this frame
+};
+
+// Adds the time until the end of the enclosing block to a stage.
+class StageScope
+{
+public:
+  StageScope(FrameTimings &t, Stage stage) : timings(t), stage(stage), start(t.clock()) {}
+  ~StageScope() { timings.add(stage, timings.clock() - start); }
+
+private:
+  FrameTimings &timings;
+  Stage stage;
+  uint32_t start;
+};
+
+#if defined(FRAME_TIMING)
+extern FrameTimings frameTimings;
+#define TIME_STAGE(stage) StageScope stageScope(frameTimings, stage)
+#else
+#define TIME_STAGE(stage) do {} while (0)
+#endif
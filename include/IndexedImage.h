@@ -0,0 +1,22 @@
+#pragma once
+#include <stdint.h>
+#include "Canvas.h"
+
+// A palette-indexed RGB565 image made by tools/gen_assets.py.
+//
+// Every pixel is an index into the palette, 8 bits (up to 256 colours) or 4
+// bits (up to 16, two to a byte, high nibble first, rows padded to a whole
+// byte). The palette is already in panel byte order, so drawing is a table
+// lookup per pixel with no swapping, and any part of any row can be drawn
+// straight from its offset.
+struct IndexedImage
+{
+  const uint8_t *indices;
+  const uint16_t *palette;
+  uint16_t w, h;
+  uint8_t bits; // 8 or 4
+};
+
+// Expand the part of the image that falls inside the canvas, with its top
+// left corner at (x, y).
+void drawIndexed(Canvas &c, const IndexedImage &img, int16_t x, int16_t y);
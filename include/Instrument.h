@@ -0,0 +1,240 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "BandScheduler.h"
+#include "Canvas.h"
+#include "DirtyRegion.h"
+#include "FrameTimings.h"
+#include "IndexedImage.h"
+#include "PackedImage.h"
+#include "SaveUnder.h"
+#include "Sprite.h"
+
+// A gauge as an ordered stack of layers, bottom first, composed band by band
+// with only what changed sent to the panel.
+//
+// Each frame every layer works out how it looks and where it draws. A layer
+// that moved or changed dirties where it was and where it is now, and the
+// dirty areas are composed from the layers that touch them. Layers that move
+// keep a save-under buffer of what lies beneath, so moving off somewhere
+// costs a copy rather than composing the layers below again.
+//
+// Each dirty area is composed from only the layers that touch it, bottom up
+// and clipped to it: a lamp changing under the plane redraws the lamp and
+// the piece of the plane over it, and the ball moving never reaches the
+// lamps at all.
+//
+// A layer that can give its pixels ready made, over the bottom layer, skips
+// composing altogether when nothing else is on it: a change is sent to the
+// panel straight from its tile.
+//
+// Layers work in instrument coordinates, with (0, 0) at the top left of the
+// instrument's area on the panel.
+
+struct Point
+{
+  int16_t x, y;
+};
+
+// What composing has cost since the last Instrument::resetComposeStats(),
+// over every instrument. The native harness budgets both counts per frame,
+// each on its own, alongside what was sent.
+struct ComposeStats
+{
+  uint32_t drawn;  // Pixels covered by layers drawing, clipped to the band
+  uint32_t copied; // Pixels copied into or out of save-unders
+};
+
+class Layer
+{
+public:
+  virtual ~Layer() {}
+
+  // Settle how the layer looks this frame and set bounds to where it draws.
+  // Returns true if it looks different from last frame in a way moving
+  // does not cover, such as a new angle or being switched on or off.
+  virtual bool update() = 0;
+
+  // Draw into the canvas, clipped to it. Anything outside bounds is never
+  // asked for.
+  virtual void draw(Canvas &c) = 0;
+
+  // Everywhere the layer can ever draw, for its save-under buffer. Layers
+  // that never move leave it empty and get none.
+  virtual Rect sweep() const { return Rect{0, 0, 0, 0}; }
+
+  // All of bounds as this layer over the instrument's bottom layer looks
+  // this frame, in panel byte order, or null if it has to be composed.
+  virtual const uint16_t *tile() const { return nullptr; }
+
+  Rect bounds = {0, 0, 0, 0};
+  Stage stage = STAGE_COUNT; // Where its drawing time goes, STAGE_COUNT for nowhere
+
+private:
+  friend class Instrument;
+  Rect drawn = {0, 0, 0, 0}; // bounds as of the last frame
+  SaveUnder save;
+  bool saving = false;       // Has a save-under
+  bool changedUnder = false; // Something beneath changed inside drawn
+  bool direct = false;       // Goes out as its tile this frame
+};
+
+// A packed or indexed image that never changes, normally the background.
+class ImageLayer : public Layer
+{
+public:
+  ImageLayer(const PackedImage &img, int16_t x, int16_t y);
+  ImageLayer(const IndexedImage &img, int16_t x, int16_t y);
+  bool update() override { return false; }
+  void draw(Canvas &c) override;
+
+private:
+  const PackedImage *packed = nullptr;
+  const IndexedImage *indexed = nullptr;
+};
+
+// A rectangle of one colour, given in RGB565. A plain background.
+class FillLayer : public Layer
+{
+public:
+  FillLayer(const Rect &r, uint16_t color);
+  bool update() override { return false; }
+  void draw(Canvas &c) override;
+
+private:
+  uint16_t color; // Panel byte order
+};
+
+// A sprite fixed at its place in the layout, drawn through its mask.
+class SpriteLayer : public Layer
+{
+public:
+  explicit SpriteLayer(const Sprite &s);
+  bool update() override { return false; }
+  void draw(Canvas &c) override;
+
+protected:
+  const Sprite &sprite;
+};
+
+// A sprite at its place in the layout, shown while bit is set in bits. Lamps
+// and flags, a bank of them sharing one word of state. The bit is XORed with
+// the one last drawn, so only a lamp that changed dirties its rectangle, and
+// one that went out is composed again from what lies beneath. With tiles
+// baked over the bottom layer, a lamp nothing else covers is sent from them
+// instead.
+class ToggleLayer : public SpriteLayer
+{
+public:
+  ToggleLayer(const Sprite &s, const uint16_t &bits, uint16_t bit, const SpriteTiles *tiles = nullptr)
+      : SpriteLayer(s), bits(bits), bit(bit), tiles(tiles)
+  {
+  }
+  bool update() override;
+  void draw(Canvas &c) override;
+  const uint16_t *tile() const override;
+
+private:
+  const uint16_t &bits;
+  uint16_t bit;
+  const SpriteTiles *tiles;
+  uint16_t shown = 0; // bit, if it was lit last frame
+};
+
+// A sprite that slides about. position() says where its top left corner
+// goes this frame, and sweep covers everywhere it can go.
+class TranslatedLayer : public Layer
+{
+public:
+  TranslatedLayer(const Sprite &s, Point (*position)(), const Rect &sweep);
+  bool update() override;
+  void draw(Canvas &c) override;
+  Rect sweep() const override { return reach; }
+
+private:
+  const Sprite &sprite;
+  Point (*position)();
+  Rect reach;
+};
+
+// A sprite that turns about its pivot, which sits at (x, y). angle() gives
+// the angle this frame, clockwise in 1/16ths of a degree, from minAngle to
+// maxAngle. Nearest-neighbour; gauges that need better bring their own layer.
+class RotatedLayer : public Layer
+{
+public:
+  RotatedLayer(const Sprite &s, int16_t x, int16_t y, int32_t (*angle)(), int32_t minAngle, int32_t maxAngle);
+  bool update() override;
+  void draw(Canvas &c) override;
+  Rect sweep() const override;
+
+private:
+  const Sprite &sprite;
+  Point pivot;
+  int32_t (*angle)();
+  int32_t minAngle, maxAngle;
+  int32_t current = 0;
+  bool drawnOnce = false;
+};
+
+// Composing passes sets of layers around as one bit each in a uint32_t.
+#define INSTRUMENT_MAX_LAYERS 32
+static_assert(INSTRUMENT_MAX_LAYERS <= sizeof(uint32_t) * 8, "layer sets are uint32_t bitmasks");
+
+class Instrument
+{
+public:
+  // area is where the instrument sits on the panel. layers run bottom to top,
+  // at most INSTRUMENT_MAX_LAYERS of them, and must outlive the instrument.
+  Instrument(const Rect &area, Layer *const *layers, uint8_t count);
+
+  // The same for an array of layers, with its size checked at compile time.
+  template <size_t N>
+  Instrument(const Rect &area, Layer *const (&layers)[N]) : Instrument(area, layers, N)
+  {
+    static_assert(N <= INSTRUMENT_MAX_LAYERS, "too many layers for one instrument");
+  }
+
+  // Reserve save-under buffers for the layers that move, if saveUnders.
+  // Returns false if any did not fit. Those layers then compose from below.
+  bool begin(bool saveUnders);
+
+  // Update every layer and work out what needs sending. The first frame
+  // sends everything.
+  void collect();
+
+  // Send everything every frame, composed from every layer, as a reference
+  // to check the dirty areas against. Far too slow for use.
+  void setFullRedraw(bool on) { fullRedraw = on; }
+
+  // Send the layers going out as tiles, then compose the dirty areas and
+  // hand them to the scheduler, band by band.
+  void push(BandScheduler &bands);
+
+  // Compose whatever part of the instrument falls in the canvas, which is
+  // in panel coordinates.
+  void compose(Canvas &c);
+
+  const Rect &area() const { return where; }
+  const DirtyRegion &dirtyRegion() const { return dirty; }
+
+  static const ComposeStats &composeStats() { return composed; }
+  static void resetComposeStats() { composed = ComposeStats{0, 0}; }
+
+private:
+  void markDirty(uint8_t i, bool moved);
+  uint32_t touching(const Rect &r) const;
+  void composeBelow(Canvas &c, uint8_t top, uint32_t set);
+  void drawLayer(Layer &l, Canvas &c);
+  static void composeUnder(Canvas &c, void *ctx);
+  static void fillBand(const Rect &r, uint16_t *buf, void *ctx);
+
+  Rect where;
+  Layer *const *layers;
+  uint8_t count;
+  DirtyRegion dirty;
+  bool firstFrame = true;
+  bool fullRedraw = false;
+
+  static ComposeStats composed;
+};
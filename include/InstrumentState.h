@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+
+// The LEDs, one bit each in InstrumentState::leds. The same bits as
+// PROTO_LED_* in the serial protocol.
+enum Led : uint16_t
+{
+  LED_ST = 1 << 0,
+  LED_HD = 1 << 1,
+  LED_TRK_LO = 1 << 2,
+  LED_TRK_HI = 1 << 3,
+  LED_ALT = 1 << 4,
+  LED_UP = 1 << 5,
+  LED_DOWN = 1 << 6,
+  LED_RDY = 1 << 7,
+  LED_LOW_VOLT = 1 << 8,
+};
+
+// Everything the turn coordinator needs to draw a frame. Core 0 owns the live
+// copy and the set* functions update it. Core 1 renders from a snapshot.
+struct InstrumentState
+{
+  // Turn Coordinator Needle
+  double turnCoorNeedle = 50; // 0 to 100, 50 is centered.
+  // Ball
+  double inclinometerBall = 0; // -1 to 1 with 0 being centered.
+
+  // LEDs, a bit each, set while lit
+  uint16_t leds = 0;
+};
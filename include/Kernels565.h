@@ -0,0 +1,20 @@
+#pragma once
+#include <stdint.h>
+
+// Pixel loops for RGB565 runs.
+//
+// The Cortex-M0+ has no SIMD, but a word holds two pixels, so fills store
+// two at once (SWAR). Copies are left to memcpy, which tools/bench_kernels.cpp
+// finds faster than both a pixel loop and a word loop at every run length it
+// times, down to 8 pixels. Every kernel gives exactly the same pixels as
+// doing it one at a time, on the RP2040 and on a host build.
+//
+// Runs are any length and any 16-bit alignment. Pixels are in panel byte
+// order unless it says otherwise.
+
+// dst[i] = src[i]
+void copy565(uint16_t *dst, const uint16_t *src, int32_t n);
+
+// dst[i] = color. A run starting on an odd pixel has its first pixel done on
+// its own so the rest are word aligned.
+void fill565(uint16_t *dst, uint16_t color, int32_t n);
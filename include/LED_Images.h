@@ -1,215 +0,0 @@
-#pragma once
-#include <Arduino.h>
-
-// Generated by   : ImageConverter 565 Online
-// Generated from : APDot.png
-// Time generated : Wed, 17 Apr 24 20:12:39 +0200  (Server timezone: CET)
-// Image Size     : 14x14 pixels
-// Memory usage   : 392 bytes
-
-
-// AP Modes Dot
-const uint16_t APDot_width = 14;
-const uint16_t APDot_height = 14;
-
-const uint16_t STDotX = 107;
-const uint16_t STDotY = 81;
-const uint16_t HDDotX = 137;
-const uint16_t HDDotY = 81;
-const uint16_t TrkLoDotX = 169;
-const uint16_t TrkLoDotY = 81;
-const uint16_t TrkHiDotX = 198;
-const uint16_t TrkHiDotY = 81;
-
-
-const unsigned short APDot[196] PROGMEM={
-0x2944, 0x2923, 0x2943, 0x3143, 0x3142, 0xC522, 0xBCE4, 0xB4C4, 0xB4C4, 0x49C2, 0x3143, 0x3143, 0x2943, 0x2944, 0x3164, 0x2943,   // 0x0010 (16) pixels
-0x3142, 0x3982, 0xEEA7, 0xF70A, 0xF72B, 0xF72C, 0xF70C, 0xE68B, 0xD5C6, 0x3143, 0x3143, 0x3144, 0x3143, 0x3143, 0xCD82, 0xF749,   // 0x0020 (32) pixels
-0xF76A, 0xFF6B, 0xFF8B, 0xFF6B, 0xFF8C, 0xEECC, 0xEECC, 0xE68B, 0x3163, 0x3163, 0x3163, 0x41C2, 0xFF69, 0xF769, 0xFFCA, 0xFFCB,   // 0x0030 (48) pixels
-0xFFCC, 0xFFAB, 0xFF8C, 0xFF6C, 0xFF6C, 0xE6AB, 0xE628, 0x3163, 0x3163, 0xE683, 0xFF49, 0xFFA9, 0xFFCA, 0xFFEA, 0xFFEB, 0xFFCB,   // 0x0040 (64) pixels
-0xFFCC, 0xFF8D, 0xF76C, 0xEF0C, 0xF6CB, 0x7B02, 0x3982, 0xF706, 0xFFA9, 0xFFAA, 0xFFEA, 0xFFEA, 0xFFEB, 0xFFEB, 0xFFED, 0xFFCD,   // 0x0050 (80) pixels
-0xFFCC, 0xFF6C, 0xF6EC, 0xDE25, 0x5242, 0xF748, 0xFFC9, 0xFFCA, 0xFFEB, 0xFFEB, 0xFFEB, 0xFFEB, 0xFFCC, 0xFFEC, 0xFFCC, 0xFF6C,   // 0x0060 (96) pixels
-0xF6EC, 0xE667, 0x6AC2, 0xF728, 0xFFA8, 0xFFCA, 0xFFEB, 0xFFEC, 0xFFEB, 0xFFEC, 0xFFEC, 0xFFEB, 0xFFEC, 0xFF8C, 0xEF0C, 0xDE46,   // 0x0070 (112) pixels
-0x3163, 0xE685, 0xFF6A, 0xFFCA, 0xFFCB, 0xFFEC, 0xFFEC, 0xFFEC, 0xFFEC, 0xFFEB, 0xFFCD, 0xFF8D, 0xF72B, 0xDE03, 0x3163, 0xB462,   // 0x0080 (128) pixels
-0xF6EA, 0xFF8A, 0xFF8B, 0xFFCB, 0xFFCC, 0xFFCD, 0xFFED, 0xFFCC, 0xFF8D, 0xF74C, 0xF6EA, 0x5222, 0x3984, 0x3142, 0xE686, 0xEEEA,   // 0x0090 (144) pixels
-0xFF8B, 0xF74C, 0xF76C, 0xFF8C, 0xFF8C, 0xF76C, 0xF76C, 0xEEEB, 0x8342, 0x3163, 0x3184, 0x3163, 0x6AA2, 0xE687, 0xEEAB, 0xF74A,   // 0x00A0 (160) pixels
-0xFF6C, 0xF74B, 0xF74B, 0xEEEB, 0xEEAB, 0xE646, 0x3163, 0x3164, 0x3164, 0x3184, 0x3143, 0x3143, 0xC542, 0xE668, 0xE689, 0xEEAA,   // 0x00B0 (176) pixels
-0xEEAA, 0xD5E4, 0xAC63, 0x3163, 0x3184, 0x3184, 0x3144, 0x3164, 0x39A5, 0x3184, 0x3164, 0x3183, 0x8363, 0x8363, 0x6AC3, 0x3164,   // 0x00C0 (192) pixels
-0x3184, 0x3184, 0x3184, 0x3164
-};
-
-
-// Generated by   : ImageConverter 565 Online
-// Generated from : DownDot.png
-// Time generated : Wed, 17 Apr 24 20:12:47 +0200  (Server timezone: CET)
-// Image Size     : 20x20 pixels
-// Memory usage   : 800 bytes
-
-
-#if defined(__AVR__)
-    #include <avr/pgmspace.h>
-#elif defined(__PIC32MX__)
-    #define PROGMEM
-#elif defined(__arm__)
-    #define PROGMEM
-#endif
-
-
-const uint16_t DownDot_width = 20;
-const uint16_t DownDot_height = 20;
-const uint16_t DownDot_x = 261;
-const uint16_t DownDot_y = 105;
-
-const unsigned short DownDot[400] PROGMEM={
-0x2944, 0x3144, 0x3164, 0x3144, 0x3144, 0x3143, 0x3163, 0x3143, 0x3142, 0x3142, 0x2942, 0x2922, 0x2922, 0x2922, 0x2923, 0x2102,   // 0x0010 (16) pixels
-0x20E2, 0x20E2, 0x18C2, 0x18C2, 0x2944, 0x2944, 0x3144, 0x3143, 0x3164, 0x3162, 0x8B82, 0xE668, 0xDE68, 0xE689, 0xE688, 0xDE48,   // 0x0020 (32) pixels
-0xDE07, 0xD5A4, 0x3962, 0x2922, 0x2902, 0x2102, 0x2102, 0x18C2, 0x2944, 0x2943, 0x3143, 0x3163, 0x3162, 0xEEA7, 0xEEEA, 0xF70A,   // 0x0030 (48) pixels
-0xF70A, 0xF72B, 0xF72A, 0xEEEA, 0xEECA, 0xE689, 0xDE07, 0xB4C2, 0x2922, 0x2102, 0x2103, 0x18C1, 0x3143, 0x3143, 0x3163, 0x5A62,   // 0x0040 (64) pixels
-0xF6E9, 0xF76A, 0xFF6B, 0xF70B, 0xF72B, 0xF74B, 0xF72B, 0xF70A, 0xE6CA, 0xE6A9, 0xEEA9, 0xE669, 0xD5A3, 0x2922, 0x2902, 0x18C1,   // 0x0050 (80) pixels
-0x3164, 0x3163, 0xA422, 0xF70A, 0xFF8A, 0xFF6A, 0xFFAA, 0xFFCA, 0xFFCB, 0xFF8C, 0xFFAB, 0xFF6A, 0xFF6A, 0xF749, 0xEEA9, 0xE688,   // 0x0060 (96) pixels
-0xE688, 0xCD83, 0x2922, 0x2102, 0x3184, 0x3183, 0xEEC8, 0xFF6A, 0xFF8B, 0xFFAA, 0xFFCB, 0xFFAA, 0xFFCB, 0xFFAC, 0xFF8C, 0xFF8B,   // 0x0070 (112) pixels
-0xFF6B, 0xFF6A, 0xF749, 0xEEE9, 0xE688, 0xE627, 0x93C2, 0x2923, 0x3163, 0x9C02, 0xFF8A, 0xFF4A, 0xFFAA, 0xFFAB, 0xFFCB, 0xFFCB,   // 0x0080 (128) pixels
-0xFFEA, 0xFFEB, 0xFFCB, 0xFFCA, 0xFFAA, 0xFF89, 0xF729, 0xFF69, 0xE6A8, 0xEEA7, 0xDDE5, 0x2922, 0x3162, 0xEEE5, 0xFF8A, 0xFF8A,   // 0x0090 (144) pixels
-0xFFCB, 0xFFCB, 0xFFEB, 0xFFEA, 0xFFEB, 0xFFEB, 0xFFCA, 0xFFCB, 0xFFCA, 0xFFAA, 0xFF69, 0xF749, 0xEEE9, 0xEEA8, 0xE647, 0x3162,   // 0x00A0 (160) pixels
-0x39A2, 0xF728, 0xFF6B, 0xFFAB, 0xFFCC, 0xFFEB, 0xFFEB, 0xFFEA, 0xFFEB, 0xFFEB, 0xFFEA, 0xFFEB, 0xFFCA, 0xFFCA, 0xFFCA, 0xFF6A,   // 0x00B0 (176) pixels
-0xF748, 0xE688, 0xEEA7, 0x7B42, 0x5A62, 0xF749, 0xFF8B, 0xFFCA, 0xFFAB, 0xFFEB, 0xFFEB, 0xFFEC, 0xFFEB, 0xFFEC, 0xFFEB, 0xFFEB,   // 0x00C0 (192) pixels
-0xFFCB, 0xFFCA, 0xFFCA, 0xFFAA, 0xFF69, 0xE6A8, 0xE6A7, 0xB4C2, 0xA463, 0xF76A, 0xFF8A, 0xFFCA, 0xFFCB, 0xFFEB, 0xFFEC, 0xFFEB,   // 0x00D0 (208) pixels
-0xFFEB, 0xFFEB, 0xFFEB, 0xFFEA, 0xFFEA, 0xFFEA, 0xFFEA, 0xFFA9, 0xFF68, 0xEEE8, 0xE6A7, 0xCD82, 0x62A2, 0xF74A, 0xFF8B, 0xFFCA,   // 0x00E0 (224) pixels
-0xFFAB, 0xFFEB, 0xFFEC, 0xFFEB, 0xFFEB, 0xFFEB, 0xFFEA, 0xFFE9, 0xFFEB, 0xFFE9, 0xFFE9, 0xFFC9, 0xF748, 0xEEE7, 0xE6C7, 0xBD02,   // 0x00F0 (240) pixels
-0x41A2, 0xF709, 0xF74A, 0xFFAB, 0xFFAA, 0xFFCB, 0xFFEB, 0xFFEB, 0xFFEB, 0xFFEC, 0xFFEB, 0xFFEB, 0xFFEA, 0xFFEA, 0xFFE9, 0xFFCA,   // 0x0100 (256) pixels
-0xF769, 0xEF07, 0xEEC7, 0x7B42, 0x3163, 0xE643, 0xFF6B, 0xFF4B, 0xFFCC, 0xFFAB, 0xFFCB, 0xFFCB, 0xFFCB, 0xFFCB, 0xFFCA, 0xFFCA,   // 0x0110 (272) pixels
-0xFFEA, 0xFFE9, 0xFFA9, 0xFF8A, 0xF749, 0xF6E7, 0xE666, 0x3142, 0x3163, 0x5A62, 0xF74A, 0xF70B, 0xFF8A, 0xFF6B, 0xFFAB, 0xFFCB,   // 0x0120 (288) pixels
-0xFFCB, 0xFFCC, 0xFFEC, 0xFFCB, 0xFFCA, 0xFFAA, 0xFF6A, 0xF769, 0xF709, 0xF6E7, 0xDE23, 0x2922, 0x3184, 0x3163, 0xE664, 0xF72A,   // 0x0130 (304) pixels
-0xEEEB, 0xFF6B, 0xFF6B, 0xFF6B, 0xFFAB, 0xFFAC, 0xFFAB, 0xFFAB, 0xFF6A, 0xF74A, 0xF74A, 0xEEE9, 0xEEA8, 0xDE24, 0x3962, 0x2923,   // 0x0140 (320) pixels
-0x3164, 0x3984, 0x3163, 0xDE24, 0xEEEA, 0xEEEB, 0xF74B, 0xFF6B, 0xFF6B, 0xF76C, 0xF72B, 0xF72A, 0xF74A, 0xF72A, 0xE6C9, 0xEE88,   // 0x0150 (336) pixels
-0xE645, 0x39A2, 0x2922, 0x2923, 0x3164, 0x3184, 0x3164, 0x3162, 0xEE88, 0xEECA, 0xE68B, 0xEF0B, 0xF72B, 0xF74B, 0xF74A, 0xF72A,   // 0x0160 (352) pixels
-0xEECA, 0xE689, 0xEE88, 0xE6A7, 0x7B22, 0x2942, 0x2923, 0x2903, 0x3144, 0x3164, 0x3984, 0x39A5, 0x3143, 0xCD82, 0xE646, 0xE689,   // 0x0170 (368) pixels
-0xE68A, 0xEEAA, 0xE68A, 0xEEA9, 0xE668, 0xE627, 0xCD82, 0x41C2, 0x2922, 0x2943, 0x2923, 0x2103, 0x3144, 0x3164, 0x3184, 0x39A5,   // 0x0180 (384) pixels
-0x3984, 0x3142, 0x3142, 0xCDA2, 0xD605, 0xDE26, 0xDE26, 0xDDE5, 0xCD62, 0x41E2, 0x2942, 0x2943, 0x3144, 0x2923, 0x2903, 0x20E3,   // 0x0190 (400) pixels
-};
-
-
-const uint16_t UpDot_width = 20;
-const uint16_t UpDot_height = 20;
-const uint16_t UpDot_x = 236;
-const uint16_t UpDot_y = 58;
-const unsigned short* UpDot = DownDot;  // Same image as DownDot
-
-
-// Generated by   : ImageConverter 565 Online
-// Generated from : AltDot.png
-// Time generated : Wed, 17 Apr 24 20:12:57 +0200  (Server timezone: CET)
-// Image Size     : 20x20 pixels
-// Memory usage   : 800 bytes
-
-
-#if defined(__AVR__)
-    #include <avr/pgmspace.h>
-#elif defined(__PIC32MX__)
-    #define PROGMEM
-#elif defined(__arm__)
-    #define PROGMEM
-#endif
-
-const uint16_t AltDot_width = 20;
-const uint16_t AltDot_height = 20;
-const uint16_t AltDot_x = 65;
-const uint16_t AltDot_y = 58;
-
-
-const unsigned short AltDot[400] PROGMEM={
-0x10C3, 0x18C3, 0x18E3, 0x10C3, 0x10C3, 0x10E4, 0x10E4, 0x1904, 0x1146, 0x11C8, 0x11A8, 0x1187, 0x1104, 0x1104, 0x1904, 0x1904,   // 0x0010 (16) pixels
-0x1904, 0x2104, 0x2104, 0x2124, 0x10E3, 0x18E3, 0x10C3, 0x08A3, 0x1904, 0x1125, 0x35BA, 0x45DA, 0x4DFA, 0x563B, 0x561B, 0x561B,   // 0x0020 (32) pixels
-0x5DB9, 0x5597, 0x1CD6, 0x1946, 0x1924, 0x2124, 0x2124, 0x2124, 0x10E3, 0x10C3, 0x10C3, 0x1904, 0x1125, 0x4E3B, 0x4E7B, 0x4E9D,   // 0x0030 (48) pixels
-0x4E5C, 0x565C, 0x5E5B, 0x5E5C, 0x5E5C, 0x663B, 0x5DB9, 0x3D16, 0x1904, 0x2124, 0x2124, 0x2104, 0x10C3, 0x10C3, 0x1104, 0x1125,   // 0x0040 (64) pixels
-0x4E7B, 0x4EDD, 0x4EBD, 0x4EDD, 0x571D, 0x5F1D, 0x671D, 0x66FD, 0x665B, 0x6E1A, 0x6E7C, 0x6E1B, 0x4D38, 0x1966, 0x1904, 0x2124,   // 0x0050 (80) pixels
-0x10C3, 0x08C3, 0x1124, 0x461A, 0x467B, 0x4EFC, 0x575E, 0x575E, 0x575E, 0x5F3E, 0x673E, 0x671E, 0x6EDD, 0x6EBD, 0x6E3A, 0x6E5A,   // 0x0060 (96) pixels
-0x65FA, 0x2CF6, 0x1924, 0x2124, 0x08C3, 0x1104, 0x2CB4, 0x46DD, 0x4F1D, 0x4F5E, 0x575E, 0x5F9F, 0x5F9F, 0x67BF, 0x6F9F, 0x6F5E,   // 0x0070 (112) pixels
-0x76FD, 0x76DD, 0x76FD, 0x767B, 0x765B, 0x6598, 0x24F6, 0x1904, 0x1104, 0x1125, 0x46DC, 0x46FC, 0x4F7E, 0x575D, 0x579E, 0x5FBF,   // 0x0080 (128) pixels
-0x5FBF, 0x67BF, 0x6FBF, 0x77BF, 0x777E, 0x76FD, 0x76FD, 0x76DD, 0x763B, 0x6DFA, 0x4D37, 0x1904, 0x1125, 0x25FA, 0x469C, 0x475E,   // 0x0090 (144) pixels
-0x4F5E, 0x579E, 0x57BF, 0x67DF, 0x67DF, 0x6FDF, 0x77DF, 0x77BF, 0x779F, 0x7F7E, 0x86FE, 0x86FD, 0x869C, 0x7E5B, 0x6E1B, 0x1A0B,   // 0x00A0 (160) pixels
-0x1166, 0x367B, 0x46DB, 0x4F7E, 0x4F7E, 0x57DF, 0x67DF, 0x67DF, 0x67DF, 0x77DF, 0x77DF, 0x7FDF, 0x7FBF, 0x87DF, 0x877E, 0x871E,   // 0x00B0 (176) pixels
-0x8EFD, 0x7E5B, 0x763B, 0x1C56, 0x12AB, 0x3E7B, 0x471C, 0x4F7E, 0x577E, 0x5FDF, 0x67DF, 0x67DF, 0x6FFF, 0x77DF, 0x7FDF, 0x7FDF,   // 0x00C0 (192) pixels
-0x7FDF, 0x87BF, 0x7F9F, 0x8F1E, 0x873E, 0x867B, 0x769C, 0x24D7, 0x124B, 0x469B, 0x471D, 0x4F5E, 0x577E, 0x67DF, 0x67DF, 0x6FDF,   // 0x00D0 (208) pixels
-0x6FDF, 0x77FF, 0x7FDF, 0x87FF, 0x8FFF, 0x8FDF, 0x87BF, 0x8F5E, 0x873E, 0x7E7B, 0x767C, 0x3517, 0x11E9, 0x3E5B, 0x46DC, 0x4F5E,   // 0x00E0 (224) pixels
-0x575E, 0x67BF, 0x6FDF, 0x77DF, 0x77DF, 0x7FDF, 0x7FDF, 0x7FDF, 0x87DF, 0x87DF, 0x87BF, 0x977E, 0x875E, 0x7E9C, 0x769C, 0x2CF6,   // 0x00F0 (240) pixels
-0x1925, 0x2E1A, 0x569B, 0x575E, 0x5F3E, 0x67BF, 0x6FBF, 0x77BF, 0x77BF, 0x7FDF, 0x8FDF, 0x87DF, 0x87DF, 0x8FDF, 0x8F9F, 0x977E,   // 0x0100 (256) pixels
-0x8EFD, 0x76BB, 0x6E1A, 0x1B70, 0x1925, 0x1D57, 0x4E9B, 0x5F1D, 0x5F5E, 0x677F, 0x6F9E, 0x779F, 0x7FBF, 0x87BF, 0x8FDF, 0x87BF,   // 0x0110 (272) pixels
-0x87DF, 0x8FBE, 0x871D, 0x8F5E, 0x86BC, 0x767B, 0x65D9, 0x1966, 0x2145, 0x1125, 0x4E3A, 0x5E9C, 0x5F1D, 0x6F1D, 0x773E, 0x779F,   // 0x0120 (288) pixels
-0x7F9F, 0x87BF, 0x87BF, 0x87BF, 0x8F9F, 0x8F1E, 0x8EFE, 0x86DD, 0x7E9C, 0x6E1B, 0x3538, 0x1925, 0x2125, 0x1925, 0x1C75, 0x5E5B,   // 0x0130 (304) pixels
-0x5E7C, 0x66FD, 0x773E, 0x7EDD, 0x7EFE, 0x873E, 0x86FD, 0x871D, 0x86DD, 0x871E, 0x869C, 0x867B, 0x763B, 0x3CD6, 0x2166, 0x2124,   // 0x0140 (320) pixels
-0x2125, 0x2145, 0x1125, 0x4E1A, 0x669C, 0x665B, 0x6EBD, 0x771E, 0x7F1E, 0x7F1D, 0x7EDC, 0x7EDC, 0x86DD, 0x86BC, 0x7E5A, 0x7E5B,   // 0x0150 (336) pixels
-0x5558, 0x2350, 0x2966, 0x2144, 0x2124, 0x2144, 0x2145, 0x1925, 0x1CB6, 0x5E3B, 0x6E1A, 0x761A, 0x763B, 0x7E3B, 0x7E5B, 0x7E3B,   // 0x0160 (352) pixels
-0x85FA, 0x7E3B, 0x75D9, 0x5D37, 0x1A6B, 0x2145, 0x3186, 0x3165, 0x2124, 0x2144, 0x2945, 0x2965, 0x1925, 0x1D17, 0x4D99, 0x6E1B,   // 0x0170 (368) pixels
-0x6DDA, 0x75FA, 0x761B, 0x761B, 0x75BA, 0x6578, 0x3CB6, 0x1B50, 0x1904, 0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2965,   // 0x0180 (384) pixels
-0x3185, 0x2165, 0x1925, 0x1946, 0x1BB2, 0x3496, 0x3475, 0x2C54, 0x1A4B, 0x1925, 0x1924, 0x2145, 0x2945, 0x2965, 0x2965, 0x2944,   // 0x0190 (400) pixels
-};
-
-// Generated by   : ImageConverter 565 Online
-// Generated from : ReadyDot.png
-// Time generated : Wed, 17 Apr 24 20:13:17 +0200  (Server timezone: CET)
-// Image Size     : 20x20 pixels
-// Memory usage   : 800 bytes
-
-const uint16_t ReadyDot_width = 20;
-const uint16_t ReadyDot_height = 20;
-const uint16_t ReadyDot_x = 39;
-const uint16_t ReadyDot_y = 104;
-
-const unsigned short ReadyDot[400] PROGMEM={
-0x10C2, 0x1902, 0x1902, 0x1902, 0x1923, 0x1943, 0x1962, 0x1962, 0x1962, 0x1982, 0x1982, 0x1962, 0x2163, 0x2163, 0x2163, 0x2143,   // 0x0010 (16) pixels
-0x2944, 0x2944, 0x2964, 0x2964, 0x10C1, 0x1902, 0x1902, 0x1943, 0x1962, 0x1A42, 0x5EE5, 0x66E7, 0x6EE8, 0x7709, 0x76E9, 0x76A9,   // 0x0020 (32) pixels
-0x6E89, 0x23A2, 0x1962, 0x2163, 0x2143, 0x2164, 0x2944, 0x2944, 0x10E2, 0x1923, 0x1922, 0x1962, 0x46C2, 0x6707, 0x7749, 0x7F69,   // 0x0030 (48) pixels
-0x7F6A, 0x7F6A, 0x8F8B, 0x8F6B, 0x8F4C, 0x7EEB, 0x5646, 0x1962, 0x2163, 0x2144, 0x2943, 0x2964, 0x1923, 0x1942, 0x1162, 0x4F04,   // 0x0040 (64) pixels
-0x6F67, 0x6F68, 0x7769, 0x7F8A, 0x7F8B, 0x87AB, 0x878B, 0x8F6C, 0x8F2D, 0x8F4C, 0x976C, 0x6EA9, 0x1A02, 0x2163, 0x2984, 0x2964,   // 0x0050 (80) pixels
-0x1942, 0x1182, 0x4F04, 0x6767, 0x6F68, 0x77A8, 0x7FC9, 0x7FC9, 0x87CA, 0x8FCB, 0x8FAC, 0x97CD, 0x9FCC, 0x978D, 0x972C, 0x974C,   // 0x0060 (96) pixels
-0x7EAA, 0x2362, 0x2163, 0x2164, 0x1942, 0x46A2, 0x5F46, 0x6767, 0x7FC8, 0x7FC8, 0x87CA, 0x8FEB, 0x97EB, 0x8FEC, 0x97CC, 0x97CD,   // 0x0070 (112) pixels
-0x9F8D, 0x9FCC, 0x978D, 0x972D, 0x972C, 0x6E89, 0x1963, 0x2163, 0x1162, 0x6746, 0x6F67, 0x67A7, 0x7FE8, 0x87C9, 0x8FE9, 0x97EA,   // 0x0080 (128) pixels
-0x97EA, 0x9FEC, 0x9FEC, 0x9FEC, 0x97EC, 0x97AC, 0x8F8C, 0x976D, 0x974C, 0x872B, 0x22C2, 0x2163, 0x2362, 0x6766, 0x6F66, 0x6FC7,   // 0x0090 (144) pixels
-0x7FC9, 0x87E9, 0x9FEA, 0x9FEA, 0x9FEB, 0xA7EC, 0xA7EC, 0xA7ED, 0xA7ED, 0x9FCD, 0x9FAD, 0x978D, 0x96EC, 0x8F4C, 0x3E03, 0x1963,   // 0x00A0 (160) pixels
-0x35C2, 0x5F66, 0x6787, 0x7FC8, 0x7FC9, 0x7FE9, 0x97EA, 0x9FEA, 0xA7EB, 0xAFEC, 0xAFEC, 0xAFED, 0x9FEC, 0xAFED, 0x9FCD, 0xA7AD,   // 0x00B0 (176) pixels
-0x9F6E, 0x974D, 0x6EC8, 0x1962, 0x3EA2, 0x6766, 0x6FA7, 0x7FC8, 0x87E9, 0x7FE9, 0x97EA, 0xA7EB, 0xA7EA, 0xA7EC, 0xAFEC, 0xA7EC,   // 0x00C0 (192) pixels
-0xAFEC, 0xA7EC, 0xA7ED, 0x9FAD, 0x9F6D, 0x976D, 0x7F09, 0x19C2, 0x4F04, 0x6767, 0x6FA7, 0x7FC8, 0x87E9, 0x8FEA, 0x9FEA, 0xA7EA,   // 0x00D0 (208) pixels
-0x9FEA, 0xA7EB, 0xA7EB, 0xA7EC, 0xAFED, 0xAFEC, 0xAFED, 0x9FCD, 0x9FAD, 0x976C, 0x7F29, 0x2302, 0x3E82, 0x6767, 0x6FA7, 0x7FC8,   // 0x00E0 (224) pixels
-0x87E9, 0x8FEA, 0x9FEB, 0x9FEB, 0x9FEB, 0x9FEB, 0xAFED, 0xB7EC, 0xAFED, 0xAFED, 0xA7ED, 0xA7CE, 0x9FAD, 0x976C, 0x6F08, 0x19E2,   // 0x00F0 (240) pixels
-0x2502, 0x6767, 0x6F87, 0x7FC8, 0x87C9, 0x8FEA, 0x8FEB, 0x9FEB, 0x97EB, 0xA7EC, 0xAFEC, 0xA7EB, 0xAFED, 0x9FEC, 0x9FEC, 0x9FCD,   // 0x0100 (256) pixels
-0x97AC, 0x8F8B, 0x5EE6, 0x1962, 0x1A02, 0x6726, 0x7768, 0x7FC8, 0x87C9, 0x87C9, 0x8FEA, 0x8FEA, 0x97EB, 0x9FEC, 0xA7EC, 0xA7EC,   // 0x0110 (272) pixels
-0xAFEB, 0xA7ED, 0xA7CC, 0xA7CD, 0x978C, 0x874B, 0x35A2, 0x1963, 0x1962, 0x5704, 0x6F67, 0x6F88, 0x7FC9, 0x87C9, 0x97EA, 0x97EB,   // 0x0120 (288) pixels
-0x97EB, 0x97EB, 0xA7EC, 0xA7EC, 0xA7EC, 0x9FCD, 0x9FAD, 0x9FAC, 0x978C, 0x874B, 0x19A2, 0x2183, 0x2163, 0x1A42, 0x5706, 0x6F47,   // 0x0130 (304) pixels
-0x77A9, 0x7FAA, 0x87AA, 0x97CA, 0x9FCC, 0x9FCB, 0x9FCC, 0x97AC, 0x9FAC, 0xA7CC, 0x9F8D, 0x8F6C, 0x874A, 0x3E63, 0x2163, 0x2164,   // 0x0140 (320) pixels
-0x2143, 0x1942, 0x1AE2, 0x6727, 0x7F29, 0x7F29, 0x87AA, 0x8FAA, 0x87AB, 0x8FAB, 0x876B, 0x97AC, 0x978B, 0x8F2C, 0x8F2B, 0x7F4A,   // 0x0150 (336) pixels
-0x35A2, 0x1963, 0x2984, 0x2984, 0x2143, 0x2164, 0x1962, 0x3582, 0x6F08, 0x7708, 0x7EEA, 0x7F2A, 0x7F6A, 0x8F8B, 0x8F6B, 0x972C,   // 0x0160 (352) pixels
-0x8F0B, 0x86EB, 0x870A, 0x5665, 0x1962, 0x2163, 0x2984, 0x2964, 0x2123, 0x2143, 0x2984, 0x2163, 0x1AA2, 0x3E42, 0x66C7, 0x6EE9,   // 0x0170 (368) pixels
-0x7F09, 0x7F0A, 0x7EEA, 0x870A, 0x76E9, 0x5625, 0x3502, 0x1963, 0x2984, 0x3184, 0x2964, 0x2944, 0x2123, 0x2123, 0x2144, 0x29A4,   // 0x0180 (384) pixels
-0x2163, 0x1963, 0x1A43, 0x3E22, 0x5666, 0x5E67, 0x5666, 0x3E03, 0x2D03, 0x1963, 0x2163, 0x2984, 0x2984, 0x2984, 0x2964, 0x2944,   // 0x0190 (400) pixels
-};
-
-const uint16_t LowVoltFlag_width = 23;
-const uint16_t LowVoltFlag_height = 14;
-const uint16_t LowVoltFlag_x = 205;
-const uint16_t LowVoltFlag_y = 113;
-
-
-const unsigned short LowVoltFlag[322] PROGMEM={
-0x7880, 0x7840, 0x8040, 0x8020, 0x8880, 0x88A0, 0x88A0, 0x8880, 0x90A0, 0x90A0, 0x9080, 0x9060, 0x9060, 0x9060, 0x9080, 0x90A0,   // 0x0010 (16) pixels
-0x90A0, 0x9080, 0x8880, 0x8860, 0x8040, 0x7060, 0x7880, 0x7820, 0x8040, 0x8880, 0x8040, 0x8820, 0x9060, 0x98A0, 0x9080, 0x8840,   // 0x0020 (32) pixels
-0x9040, 0x9880, 0x9040, 0x9040, 0x9860, 0x9040, 0x9040, 0x9860, 0x9040, 0x8800, 0x8800, 0x8840, 0x8080, 0x80A0, 0x8020, 0x8860,   // 0x0030 (48) pixels
-0x8840, 0x8840, 0x8820, 0x9860, 0x9880, 0x9040, 0x9860, 0x9880, 0xA0A0, 0xA080, 0x9800, 0x9800, 0x9860, 0xA060, 0x9860, 0x9040,   // 0x0040 (64) pixels
-0x8800, 0x9040, 0x9060, 0x8800, 0x8060, 0x8060, 0x9080, 0x9040, 0x9040, 0x9860, 0xA060, 0x9860, 0x9840, 0x9820, 0x9880, 0x9020,   // 0x0050 (80) pixels
-0xA040, 0xA060, 0xA040, 0x9840, 0xA060, 0xA060, 0xA080, 0x9880, 0x9020, 0x9060, 0x8040, 0x7860, 0x8060, 0x8840, 0x8840, 0x9880,   // 0x0060 (96) pixels
-0x9860, 0xA040, 0xA040, 0x9820, 0xA060, 0xA060, 0x9840, 0x9820, 0xA040, 0x9840, 0xA060, 0xA860, 0xA860, 0xA080, 0x9860, 0x8800,   // 0x0070 (112) pixels
-0x8820, 0x7840, 0x8080, 0x8840, 0x9080, 0x9040, 0x9840, 0x9840, 0xA060, 0xA060, 0x9820, 0xA860, 0xA860, 0xA040, 0x9840, 0x9840,   // 0x0080 (128) pixels
-0x9840, 0xA040, 0xA880, 0xA860, 0xA060, 0x9880, 0x9060, 0x8840, 0x8820, 0x8860, 0x8800, 0x98A0, 0x9040, 0x9840, 0x9840, 0xA040,   // 0x0090 (144) pixels
-0xA040, 0xA040, 0xA860, 0xA880, 0xA040, 0xA040, 0x9840, 0xA020, 0x9820, 0xA060, 0xA060, 0xA060, 0x9880, 0x9060, 0x9060, 0x9040,   // 0x00A0 (160) pixels
-0x8820, 0x8820, 0x8860, 0x8840, 0x9860, 0x9840, 0x9820, 0xA040, 0xA060, 0xA060, 0xA060, 0x9820, 0xA860, 0xA860, 0xA860, 0x9820,   // 0x00B0 (176) pixels
-0xA040, 0xA040, 0xA040, 0xA060, 0x9060, 0x9880, 0x9860, 0x8820, 0x8840, 0x8820, 0x8820, 0x9860, 0xA060, 0xA060, 0xA060, 0xA060,   // 0x00C0 (192) pixels
-0xA060, 0x9840, 0xA020, 0xA040, 0xA860, 0xA880, 0xA060, 0xA040, 0xA040, 0xA040, 0xA060, 0x9880, 0x9880, 0x9040, 0x8820, 0x9040,   // 0x00D0 (208) pixels
-0x8820, 0x9060, 0x9860, 0xA080, 0xA880, 0xA060, 0xA040, 0xA860, 0xA860, 0xA860, 0xA840, 0xA040, 0x9860, 0xA860, 0xA860, 0xA060,   // 0x00E0 (224) pixels
-0x9840, 0x9040, 0x9880, 0x9860, 0x9840, 0x9060, 0x8840, 0x8820, 0x98A0, 0x9880, 0xA060, 0x9860, 0xA060, 0xA880, 0xA880, 0xA860,   // 0x00F0 (240) pixels
-0xA880, 0xA080, 0xA020, 0x9820, 0xA060, 0xA880, 0x9860, 0x9820, 0x9840, 0x9860, 0x9020, 0x9860, 0x9080, 0x9080, 0x9880, 0x9860,   // 0x0100 (256) pixels
-0x9840, 0x9860, 0xA080, 0x9860, 0x9860, 0xA080, 0xA060, 0xA880, 0x9840, 0x9800, 0xA860, 0xA020, 0xA060, 0xA080, 0xA880, 0xA040,   // 0x0110 (272) pixels
-0x9840, 0x9040, 0x9040, 0x8040, 0x9040, 0x9060, 0x9860, 0xA080, 0x9860, 0x9020, 0x9840, 0x9860, 0x9840, 0xA080, 0xA080, 0xA860,   // 0x0120 (288) pixels
-0x9840, 0xA060, 0xA060, 0x9820, 0xA060, 0x9860, 0x9020, 0x9820, 0x9860, 0x8840, 0x8040, 0x8840, 0xA060, 0xA040, 0xA080, 0xA060,   // 0x0130 (304) pixels
-0xA060, 0xA080, 0xA080, 0x9840, 0x9840, 0xA860, 0x9840, 0x9820, 0xA060, 0xA840, 0xA020, 0xA840, 0xA840, 0x9820, 0xA040, 0xA040,   // 0x0140 (320) pixels
-0x9040, 0x9020
-};
\ No newline at end of file
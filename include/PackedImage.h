@@ -0,0 +1,22 @@
+#pragma once
+#include <stdint.h>
+#include "Canvas.h"
+
+// A losslessly packed RGB565 image made by tools/gen_assets.py.
+//
+// Each row is split into segments of segmentWidth pixels that decode on
+// their own, and index[] holds where each one starts (row by row, plus one
+// end marker). Restoring part of the background only decodes the segments
+// under it, never the whole image. The token format is described in the
+// generator.
+struct PackedImage
+{
+  const uint8_t *data;
+  const uint32_t *index;
+  uint16_t w, h;
+  uint16_t segmentWidth;
+};
+
+// Decode the part of the image that falls inside the canvas, with its top
+// left corner at (x, y).
+void drawPacked(Canvas &c, const PackedImage &img, int16_t x, int16_t y);
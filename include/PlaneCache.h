@@ -0,0 +1,75 @@
+#pragma once
+#include <stdint.h>
+#include "Canvas.h"
+#include "TurnCoordinator.h"
+#include "Rotate.h"
+
+// Pre-rotated plane images, one per whole degree of bank.
+//
+// With smoothing off the needle only shows whole degrees from -30 to +30, so
+// rather than rotating the plane every frame we rotate it once per angle and
+// keep the result as runs of opaque pixels. Drawing is then a handful of row
+// copies. Fractional angles are rotated on the fly.
+//
+// By default the cache is generated on the host by tools/gen_plane_cache.cpp
+// into include/plane_cache.h and lives in flash. tools/gen_assets.py
+// regenerates it before a build when its sources change. Build with -D PLANE_CACHE_RAM
+// to build it at boot instead (about 190 KB of SRAM), which is handy while
+// trying out a new plane image.
+#define PLANE_MIN_ANGLE -30
+#define PLANE_MAX_ANGLE 30
+#define PLANE_ANGLES (PLANE_MAX_ANGLE - PLANE_MIN_ANGLE + 1)
+
+// A run of opaque pixels on one screen row, already in panel byte order.
+struct PlaneSpan
+{
+  int16_t x;
+  uint16_t len;
+  const uint16_t *pixels;
+};
+
+// One angle. Row r is screen row bounds.y + r, and its spans are
+// spans[rowSpans[r]] up to spans[rowSpans[r + 1]].
+struct PlaneRotation
+{
+  Rect bounds; // Same area as planeBounds() for this angle
+  const uint16_t *rowSpans;
+};
+
+struct PlaneCacheInfo
+{
+  uint32_t pixels, spans, rows;
+  uint32_t bytes;       // Total size of the cache
+  uint32_t buildMicros; // Time to build at boot, 0 when it came from flash
+};
+
+// Screen area touched by the plane at this angle, cached or not.
+// Angles here and below are in 1/16ths of a degree (ANGLE_STEPS).
+Rect planeBounds(int32_t angle);
+
+// Screen area the plane can touch anywhere from PLANE_MIN_ANGLE to
+// PLANE_MAX_ANGLE.
+Rect planeSweep();
+
+// Build the cache if it lives in RAM. Returns false if it did not fit.
+bool planeCacheBegin();
+const PlaneCacheInfo &planeCacheInfo();
+
+// Draw the plane at this angle, clipped to the canvas, nearest-neighbour.
+// Angles that are not in the cache fall back to rotating the image directly.
+void drawPlane(Canvas &c, int32_t angle);
+
+// Anti-aliased plane at any angle. The edges are blended into whatever is
+// already in the canvas, so draw it last. Costs more than drawPlane.
+void drawPlaneSmooth(Canvas &c, int32_t angle);
+
+// Shared with the generator: walks the rotated image for every whole degree
+// and reports each opaque run through the callbacks.
+struct PlaneCacheBuilder
+{
+  virtual ~PlaneCacheBuilder() {}
+  virtual void beginAngle(int16_t angle, const Rect &bounds) = 0;
+  virtual void beginRow() = 0;
+  virtual void span(int16_t x, uint16_t len, const uint16_t *pixels) = 0;
+};
+void planeCacheWalk(PlaneCacheBuilder &b);
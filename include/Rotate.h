@@ -0,0 +1,42 @@
+#pragma once
+#include <stdint.h>
+#include "Canvas.h"
+#include "Sprite.h"
+
+// Sprites rotate about their pivot (px, py), and only the pixels set in
+// their mask are drawn.
+
+// Coverage map for smooth rotation: one byte per pixel, 0 (clear) to 255
+// (solid), with a clear one pixel border all round so the sampler never has
+// to range check. Needs COVERAGE_SIZE(w, h) bytes.
+#define COVERAGE_SIZE(w, h) (((w) + 2) * ((h) + 2))
+void makeCoverage(const Sprite &img, uint8_t *coverage);
+
+// Angles are clockwise, in 1/16ths of a degree.
+#define ANGLE_STEPS 16
+
+// Sine and cosine scaled by 1 << ROT_SCALE, from a table of whole degrees
+// with linear steps in between. Pure integer maths, so the device and a host
+// build give identical pixels.
+#define ROT_SCALE 16
+int32_t isin(int32_t angle);
+int32_t icos(int32_t angle);
+
+// Screen area that can be touched when img is rotated by angle with its
+// pivot placed at (dx, dy). Not clipped to anything.
+Rect rotatedBounds(const Sprite &img, int32_t angle, int16_t dx, int16_t dy);
+
+// Nearest-neighbour rotation into the canvas, clipped to it.
+//
+// Each destination pixel maps back to a source pixel. Along a destination
+// row the source position just steps by (cos, -sin), so the inner loop is
+// two adds and a mask test. The part of each row that lands inside the
+// source is solved for up front, so nothing is spent on pixels outside the
+// rotated image.
+void drawRotated(Canvas &c, const Sprite &img, int32_t angle, int16_t dx, int16_t dy);
+
+// Anti-aliased rotation. Same walk, but coverage is sampled bilinearly from
+// the coverage map and edge pixels are blended into what is already in the
+// canvas. Solid interior pixels take the same fast path as drawRotated.
+void drawRotatedSmooth(Canvas &c, const Sprite &img, const uint8_t *coverage,
+                       int32_t angle, int16_t dx, int16_t dy);
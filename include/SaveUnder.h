@@ -0,0 +1,48 @@
+#pragma once
+#include <stdint.h>
+#include "Canvas.h"
+
+// Save-under buffer for a moving layer such as the plane or the ball.
+//
+// While the layers beneath are composed, the pixels the layer is about to
+// cover get copied aside. When the layer moves on, the area it leaves is
+// restored from that copy instead of being composed again from the dial up,
+// so erasing costs a copy of the overlay's size.
+//
+// The buffer is indexed by screen position over the whole area the layer can
+// ever reach, so a pixel always has the same slot. Restoring and saving the
+// same pixel within one frame therefore never trip over each other, however
+// the dirty areas are split into bands.
+//
+// The compositor has to keep two promises:
+//  - When the layer moves, its whole new area is composed that frame.
+//  - When anything beneath the layer changes inside the area it was drawn
+//    in last frame, it says so in beginFrame().
+class SaveUnder
+{
+public:
+  // Reserve a buffer covering sweep. Returns false if it did not fit, in
+  // which case fill() just composes everything.
+  bool begin(const Rect &sweep);
+
+  // Start a frame in which the layer is drawn at next.
+  void beginFrame(const Rect &next, bool changedUnder);
+
+  // Fill the canvas with what lies under the layer: restored from the buffer
+  // where it is still good, drawn by under(c, ctx) everywhere else. Then save
+  // the part the layer is about to cover. Returns how many pixels it copied
+  // either way.
+  uint32_t fill(Canvas &c, void (*under)(Canvas &c, void *ctx), void *ctx);
+
+  // Whether fill() would restore any of r from the buffer this frame.
+  bool restores(const Rect &r) const { return rectOverlaps(r, restore); }
+
+private:
+  uint16_t *buf = nullptr;
+  Rect sweep = {0, 0, 0, 0};
+  Rect saved = {0, 0, 0, 0};   // Where the buffer holds what is under the layer
+  Rect restore = {0, 0, 0, 0}; // What may be restored this frame
+
+  uint16_t *slot(int16_t x, int16_t y) { return buf + (y - sweep.y) * sweep.w + (x - sweep.x); }
+  uint32_t copy(Canvas &c, const Rect &r, bool toCanvas);
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+// Single-writer, lock-free snapshot of a small plain struct.
+//
+// The writer bumps the sequence to an odd number, stores the payload, then
+// bumps it to the next even number. A reader copies the payload between two
+// reads of the sequence and retries if they differ or the first one was odd,
+// so it never sees a half-written struct and the writer never waits.
+//
+// Only 32-bit atomic loads and stores are used, which the Cortex-M0+ does
+// natively. The payload is kept as atomic words so it is race free on a host
+// build as well, where the two sides are std::threads.
+template <typename T>
+class Seqlock
+{
+public:
+  Seqlock()
+  {
+    T empty{};
+    publish(empty);
+  }
+
+  // Writer side. Only one core or thread may call this.
+  void publish(const T &value)
+  {
+    uint32_t words[WORDS] = {};
+    memcpy(words, &value, sizeof(T));
+
+    uint32_t s = seq.load(std::memory_order_relaxed);
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (uint32_t i = 0; i < WORDS; i++) data[i].store(words[i], std::memory_order_relaxed);
+    seq.store(s + 2, std::memory_order_release);
+  }
+
+  // Reader side. Copies the latest complete value and returns its sequence
+  // number, which only changes when something new has been published.
+  uint32_t read(T &out) const
+  {
+    uint32_t words[WORDS];
+    for (;;)
+    {
+      uint32_t s1 = seq.load(std::memory_order_acquire);
+      if (s1 & 1) continue; // Writer is mid-update
+
+      for (uint32_t i = 0; i < WORDS; i++) words[i] = data[i].load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+
+      if (seq.load(std::memory_order_relaxed) == s1)
+      {
+        memcpy(&out, words, sizeof(T));
+        return s1;
+      }
+    }
+  }
+
+  // Cheap check for "anything new since I last read?"
+  uint32_t sequence() const { return seq.load(std::memory_order_acquire); }
+
+private:
+  static const uint32_t WORDS = (sizeof(T) + 3) / 4;
+
+  std::atomic<uint32_t> seq{0};
+  std::atomic<uint32_t> data[WORDS];
+};
@@ -0,0 +1,114 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Binary protocol for driving the instrument over Serial.
+//
+// A frame is
+//
+//   0xA5  len  payload[len]  crc
+//
+// len is 1 to PROTO_MAX_PAYLOAD. crc is CRC-16/CCITT-FALSE of len and the
+// payload, little endian. The payload is one or more records, each a channel
+// byte and its value, little endian:
+//
+//   PROTO_NEEDLE   int16   needle, percent in 1/256ths (50% is 12800)
+//   PROTO_BALL     int16   ball, -1 to 1 in 1/16384ths
+//   PROTO_LEDS     uint16  all nine LEDs, PROTO_LED_* bits
+//   PROTO_TIMINGS  -       ask for a FrameTimings dump (FRAME_TIMING builds)
+//   PROTO_ANNUNCIATORS  uint16  the annunciator strip, bit i lights lamp i
+//
+// Records in one frame, and frames that arrive before the last ones were
+// taken, are merged: the latest value for each channel wins. A frame is used
+// whole or not at all; one with a bad length, CRC or record is dropped and
+// the parser looks for the next sync byte inside it, so it finds its feet
+// again after noise or a torn frame without needing a timeout.
+#define PROTO_SYNC 0xA5
+#define PROTO_MAX_PAYLOAD 32
+#define PROTO_MAX_FRAME (PROTO_MAX_PAYLOAD + 4)
+
+enum ProtocolChannel : uint8_t
+{
+  PROTO_NEEDLE = 0x01,
+  PROTO_BALL = 0x02,
+  PROTO_LEDS = 0x03,
+  PROTO_TIMINGS = 0x04,
+  PROTO_ANNUNCIATORS = 0x05,
+};
+
+#define PROTO_NEEDLE_ONE 256  // Needle units per percent
+#define PROTO_BALL_ONE 16384  // Ball units per full deflection
+
+enum ProtocolLed : uint16_t
+{
+  PROTO_LED_ST = 1 << 0,
+  PROTO_LED_HD = 1 << 1,
+  PROTO_LED_TRK_LO = 1 << 2,
+  PROTO_LED_TRK_HI = 1 << 3,
+  PROTO_LED_ALT = 1 << 4,
+  PROTO_LED_UP = 1 << 5,
+  PROTO_LED_DOWN = 1 << 6,
+  PROTO_LED_RDY = 1 << 7,
+  PROTO_LED_LOW_VOLT = 1 << 8,
+};
+
+// What arrived, as the latest value of each channel. Only the channels whose
+// bits are in changed were sent.
+struct InstrumentUpdate
+{
+  uint8_t changed; // 1 << channel for each channel sent
+  int16_t needle;
+  int16_t ball;
+  uint16_t leds;
+  uint16_t annunciators;
+};
+
+#define PROTO_HAS(u, channel) (((u).changed >> (channel)) & 1)
+
+// Byte-at-a-time frame parser. Holds at most one frame, never allocates,
+// and does a bounded amount of work per byte.
+class ProtocolParser
+{
+public:
+  // Returns true when the byte completed a good frame.
+  bool feed(uint8_t b);
+
+  // Everything merged since the last take(). False if nothing arrived.
+  bool take(InstrumentUpdate &u);
+
+  uint32_t frameCount() const { return frames; }
+  uint32_t errorCount() const { return errors; }    // Frames dropped
+  uint32_t droppedCount() const { return dropped; } // Bytes skipped looking for a sync
+
+private:
+  enum State : uint8_t
+  {
+    SYNC,
+    LENGTH,
+    PAYLOAD,
+    CRC_LO,
+    CRC_HI
+  };
+
+  int8_t step(uint8_t b);
+  bool apply();
+
+  State state = SYNC;
+  uint8_t len = 0;
+  uint16_t crc = 0;
+  uint8_t raw[PROTO_MAX_FRAME];     // Bytes since the sync, for rescanning
+  uint8_t rawLen = 0;
+  uint8_t replay[PROTO_MAX_FRAME];  // Rejected bytes still to rescan
+  InstrumentUpdate pending = {};
+  uint32_t frames = 0, errors = 0, dropped = 0;
+};
+
+// CRC-16/CCITT-FALSE, continuing from crc. Start from 0xFFFF.
+uint16_t protocolCrc(uint16_t crc, const uint8_t *data, size_t n);
+
+// Wrap a payload of records in a frame. out needs PROTO_MAX_FRAME bytes.
+// Returns the frame length, or 0 if the payload is empty or too long.
+size_t protocolFrame(const uint8_t *payload, size_t len, uint8_t *out);
+
+// Encode the channels set in u as one frame.
+size_t protocolEncode(const InstrumentUpdate &u, uint8_t *out);
@@ -0,0 +1,34 @@
+#pragma once
+#include <stdint.h>
+
+// Decides frame by frame whether something optional and costly, like the
+// anti-aliased plane, still fits in the time it is allowed.
+//
+// It keeps a running estimate of what the costly way takes per frame, from
+// the frames drawn that way. Over the budget it falls back to the cheap
+// way. Coming back needs the estimate to decay to 3/4 of the budget and
+// retryFrames frames to have passed since falling back, so a cost hovering
+// around the budget switches once instead of every other frame.
+class SmoothGovernor
+{
+public:
+  explicit SmoothGovernor(uint16_t retryFrames);
+
+  // Start a frame that may spend up to budgetMicros the costly way, 0 for
+  // none at all. Returns whether to draw it that way.
+  bool beginFrame(uint32_t budgetMicros);
+
+  // What the frame just begun cost the costly way. 0 if it drew nothing.
+  void endFrame(uint32_t costMicros);
+
+  bool smooth() const { return on; }
+  uint32_t estimate() const { return cost; }
+  uint32_t switchCount() const { return switches; }
+
+private:
+  uint16_t retryFrames;
+  uint16_t held; // Frames since the last switch, up to retryFrames
+  uint32_t cost = 0;
+  uint32_t switches = 0;
+  bool on = true;
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include <stdint.h>
+
+// Values here are Q16.16 fixed point: 65536 is one unit of whatever the
+// channel measures (needle percent, ball travel).
+#define Q16_ONE 65536
+
+// Critically damped spring, for easing a displayed value towards its input.
+//
+// Inputs arrive whenever the sim sends them. The filter is stepped once per
+// rendered frame with the time since the last one, so the needle and ball
+// glide between updates at the frame rate however often the inputs come.
+// Critical damping gets there as fast as a spring can without overshoot.
+//
+// omega (rad/s) sets the speed: a step settles to within 2% in about
+// 5.8 / omega seconds. An omega of 0 passes the input straight through.
+//
+// Integer only, semi-implicit Euler in sub-steps of at most
+// SPRING_MAX_STEP_US, so it stays stable however long a frame took.
+#define SPRING_MAX_STEP_US 4000
+
+// Close enough to call it settled and snap to the target: within 1/1024 of
+// a unit, moving slower than 1/16 of a unit a second.
+#define SPRING_SETTLE (Q16_ONE / 1024)
+#define SPRING_SETTLE_SPEED (Q16_ONE / 16)
+
+class SpringFilter
+{
+public:
+  explicit SpringFilter(uint16_t omega);
+
+  // Jump straight to a value, at rest.
+  void reset(int32_t value);
+
+  void setTarget(int32_t value);
+  void step(uint32_t dtMicros);
+
+  int32_t value() const { return x; }
+  int32_t velocity() const { return v; }
+  bool settled() const { return still; }
+
+private:
+  int32_t omega; // Q16.16 rad/s
+  int32_t x = 0, v = 0, target = 0;
+  bool still = true;
+};
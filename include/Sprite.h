@@ -0,0 +1,51 @@
+#pragma once
+#include <stdint.h>
+#include "Canvas.h"
+
+// A run of opaque pixels within one row of a sprite, in sprite coordinates.
+struct SpriteSpan
+{
+  uint16_t x;
+  uint16_t len;
+};
+
+// An image from the asset pipeline (tools/gen_assets.py), as laid out in
+// assets/layout.txt. Pixels are already in panel byte order, so drawing one
+// is a plain copy.
+//
+// Sprites with transparent pixels also carry a mask (one bit per pixel, MSB
+// first, rows padded to a byte, as MASK_STRIDE) and the same information as
+// runs: row r's opaque runs are spans[rowSpans[r]] up to spans[rowSpans[r + 1]].
+// Fully opaque sprites have neither.
+struct Sprite
+{
+  const uint16_t *pixels;
+  const uint8_t *mask;
+  const SpriteSpan *spans;
+  const uint16_t *rowSpans;
+  int16_t w, h;
+  int16_t x, y;   // Where it sits on the instrument, 0 for sprites placed at runtime
+  int16_t px, py; // Pivot, for sprites that rotate
+};
+
+#define MASK_STRIDE(w) (((w) + 7) / 8)
+
+// A sprite that never moves, baked by the asset pipeline over the opaque
+// image beneath it (tiles= in assets/layout.txt): its rectangle as it looks
+// without the sprite and with it. Both are opaque and in panel byte order,
+// so either can be sent to the panel as it is.
+struct SpriteTiles
+{
+  const uint16_t *off;
+  const uint16_t *on;
+};
+
+constexpr Rect spriteRect(const Sprite &s, int16_t x, int16_t y) { return Rect{x, y, s.w, s.h}; }
+constexpr Rect spriteRect(const Sprite &s) { return Rect{s.x, s.y, s.w, s.h}; }
+
+// Draw the sprite with its top left corner at (x, y), clipped to the canvas.
+// Only opaque pixels are copied, one run at a time.
+void drawSprite(Canvas &c, const Sprite &s, int16_t x, int16_t y);
+
+// Draw the sprite at its place in the layout.
+inline void drawSprite(Canvas &c, const Sprite &s) { drawSprite(c, s, s.x, s.y); }
@@ -0,0 +1,10 @@
+#pragma once
+
+// Layout of the turn coordinator on the panel. It sits in the top 320x300 of
+// the 320x480 ST7796, with the dial image filling it.
+#define TURN_COORD_WIDTH 320
+#define TURN_COORD_HEIGHT 300
+
+// Where the plane's pivot sits on the dial
+#define PLANE_PIVOT_X 160
+#define PLANE_PIVOT_Y 150
@@ -1,62 +0,0 @@
-// Generated by   : ImageConverter 565 Online
-// Generated from : Ball.png
-// Time generated : Wed, 17 Apr 24 00:48:45 +0200  (Server timezone: CET)
-// Image Size     : 23x29 pixels
-// Memory usage   : 1334 bytes
-
-
-#if defined(__AVR__)
-    #include <avr/pgmspace.h>
-#elif defined(__PIC32MX__)
-    #define PROGMEM
-#elif defined(__arm__)
-    #define PROGMEM
-#endif
-
-const uint16_t ballWidth = 23;
-const uint16_t ballHeight = 29;
-
-const unsigned short ball_image[667] PROGMEM={
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD2, 0x8C30, 0x39E7, 0x2944, 0x3186, 0x8C30, 0x9CD2, 0xFFFF,   // 0x0010 (16) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39A6, 0x18E3,   // 0x0020 (32) pixels
-0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x39C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0030 (48) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x5289, 0x31A6, 0x3185, 0x2945, 0x3165, 0x3185, 0x39A6, 0x3185, 0x3165, 0x3165, 0x3185, 0x3185, 0x5289,   // 0x0040 (64) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5289, 0x41E7, 0x41E7, 0x39C7, 0x4A07, 0x4A07, 0x4A28,   // 0x0050 (80) pixels
-0x4A48, 0x4A48, 0x4207, 0x41E7, 0x39A6, 0x3186, 0x3186, 0x5269, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C50,   // 0x0060 (96) pixels
-0x4A28, 0x39C7, 0x41E7, 0x41E6, 0x4A48, 0x5248, 0x5269, 0x5A89, 0x5289, 0x5269, 0x4A28, 0x41E7, 0x39C6, 0x39A6, 0x4207, 0x8C50,   // 0x0070 (112) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD54, 0x4A48, 0x4207, 0x4A27, 0x4207, 0x4A08, 0x4A48, 0x5248, 0x5AA9, 0x62CA, 0x5ACA,   // 0x0080 (128) pixels
-0x5A89, 0x5269, 0x4A48, 0x4A08, 0x4207, 0x41E7, 0x4A48, 0xAD34, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A48, 0x41E7, 0x39C6, 0x41E7,   // 0x0090 (144) pixels
-0x41E7, 0x4A07, 0x4A28, 0x4A48, 0x5A89, 0x5AAA, 0x5AC9, 0x5AA9, 0x5289, 0x4A28, 0x4207, 0x4207, 0x39A6, 0x39E7, 0x4A28, 0xFFFF,   // 0x00A0 (160) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x4A28, 0x39A6, 0x39C6, 0x39C6, 0x41E7, 0x41C6, 0x4207, 0x4A27, 0x4A48, 0x5289, 0x5A89, 0x5289, 0x5269,   // 0x00B0 (176) pixels
-0x4A27, 0x41E7, 0x41E7, 0x41C6, 0x39A6, 0x4A28, 0xFFFF, 0xFFFF, 0xFFFF, 0x9C91, 0x39C6, 0x3185, 0x39A6, 0x39A6, 0x39C6, 0x39C6,   // 0x00C0 (192) pixels
-0x41E7, 0x4207, 0x4A27, 0x4A28, 0x5268, 0x5248, 0x4A28, 0x4A07, 0x41E6, 0x39C6, 0x39A6, 0x3185, 0x39C6, 0x8C50, 0xFFFF, 0xFFFF,   // 0x00D0 (208) pixels
-0x41E7, 0x3185, 0x3185, 0x3985, 0x39A6, 0x39A6, 0x39A6, 0x41C6, 0x41E7, 0x4207, 0x4A27, 0x4A27, 0x4A28, 0x4A27, 0x4207, 0x39C6,   // 0x00E0 (224) pixels
-0x39C6, 0x3986, 0x3185, 0x3186, 0x39C6, 0xFFFF, 0xA4D2, 0x39C6, 0x3165, 0x3185, 0x3185, 0x3985, 0x39A6, 0x39A6, 0x39C6, 0x41C6,   // 0x00F0 (240) pixels
-0x41E7, 0x41E7, 0x41E7, 0x4A07, 0x41E7, 0x39C6, 0x39C6, 0x39A6, 0x3185, 0x3185, 0x3165, 0x39C6, 0xAD13, 0x8C50, 0x39A6, 0x2965,   // 0x0100 (256) pixels
-0x3164, 0x3165, 0x3165, 0x3985, 0x39A6, 0x39A6, 0x39A6, 0x41C6, 0x41C6, 0x41C6, 0x41E6, 0x41C6, 0x39A6, 0x39A6, 0x39A6, 0x3185,   // 0x0110 (272) pixels
-0x3165, 0x2944, 0x3185, 0x8C50, 0x41E7, 0x3185, 0x2944, 0x3145, 0x3165, 0x3185, 0x3985, 0x3986, 0x39A5, 0x39A6, 0x39A5, 0x41C6,   // 0x0120 (288) pixels
-0x41C6, 0x39A6, 0x39C6, 0x39A5, 0x39A5, 0x3986, 0x3165, 0x3165, 0x2944, 0x3165, 0x4A07, 0x39A5, 0x3185, 0x2924, 0x2944, 0x3165,   // 0x0130 (304) pixels
-0x3185, 0x3165, 0x3985, 0x3185, 0x3985, 0x39A5, 0x39A6, 0x39A5, 0x39A5, 0x39A6, 0x3985, 0x3185, 0x3185, 0x3165, 0x2924, 0x2944,   // 0x0140 (320) pixels
-0x3185, 0x39A6, 0x39C6, 0x3185, 0x2924, 0x2104, 0x3165, 0x3164, 0x3165, 0x3165, 0x3165, 0x3185, 0x3985, 0x3985, 0x3985, 0x3185,   // 0x0150 (336) pixels
-0x3185, 0x3185, 0x3165, 0x3165, 0x3165, 0x2104, 0x2924, 0x3165, 0x39C6, 0x39A6, 0x3165, 0x2924, 0x2103, 0x3164, 0x3144, 0x3144,   // 0x0160 (352) pixels
-0x3164, 0x3164, 0x3165, 0x3165, 0x3185, 0x3185, 0x3185, 0x3165, 0x3165, 0x3165, 0x3165, 0x3144, 0x2103, 0x2924, 0x3165, 0x39C6,   // 0x0170 (368) pixels
-0x3185, 0x3165, 0x2123, 0x2103, 0x2124, 0x2944, 0x2944, 0x3144, 0x3144, 0x3165, 0x3164, 0x3144, 0x3165, 0x3165, 0x3144, 0x3144,   // 0x0180 (384) pixels
-0x3144, 0x2944, 0x2924, 0x2103, 0x2124, 0x3165, 0x39A5, 0x840F, 0x3165, 0x2104, 0x2103, 0x20E3, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x0190 (400) pixels
-0x2944, 0x3164, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x3144, 0x2944, 0x20E3, 0x20E3, 0x2104, 0x3165, 0x8C0F, 0x9471, 0x3165,   // 0x01A0 (416) pixels
-0x2103, 0x20E3, 0x18E3, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x3144, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924,   // 0x01B0 (432) pixels
-0x20E3, 0x20E3, 0x2103, 0x3164, 0x9C91, 0xFFFF, 0x3185, 0x2103, 0x18E3, 0x18E3, 0x18E3, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x01C0 (448) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x18E3, 0x18C3, 0x18E3, 0x2103, 0x3164, 0xFFFF, 0xFFFF, 0x7BCE, 0x2103, 0x18E2,   // 0x01D0 (464) pixels
-0x18C3, 0x18E3, 0x18E3, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x18C2, 0x18C3, 0x18C2, 0x18C2,   // 0x01E0 (480) pixels
-0x2103, 0x7BAE, 0xFFFF, 0xFFFF, 0xFFFF, 0x2944, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x2923, 0x2924, 0x2903, 0x2924, 0x2923,   // 0x01F0 (496) pixels
-0x2903, 0x2924, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x2924, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3165, 0x18C2, 0x18C2, 0x18A2,   // 0x0200 (512) pixels
-0x18C2, 0x18E3, 0x18C3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18C3, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x2944, 0xFFFF,   // 0x0210 (528) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x8C30, 0x18E3, 0x18A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C3,   // 0x0220 (544) pixels
-0x18C2, 0x10A2, 0x10A2, 0x18A2, 0x18C3, 0x8C30, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x736D, 0x18C2, 0x18A2, 0x10A2, 0x10A2,   // 0x0230 (560) pixels
-0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x6B6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0240 (576) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0x3185, 0x1082, 0x1081, 0x1081, 0x1081, 0x10A2, 0x18A2, 0x18A2, 0x18A2, 0x10A2, 0x1081, 0x1081, 0x1082,   // 0x0250 (592) pixels
-0x1081, 0x3165, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3165, 0x1082, 0x1081, 0x1081, 0x1082,   // 0x0260 (608) pixels
-0x1082, 0x1082, 0x10A2, 0x1082, 0x1081, 0x1081, 0x1082, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0270 (624) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AAA, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x6B2C, 0xFFFF, 0xFFFF, 0xFFFF,   // 0x0280 (640) pixels
-0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA4F2, 0x9CB2, 0x4A28, 0x5248,   // 0x0290 (656) pixels
-0x62CA, 0x9471, 0x9CD2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
-};
@@ -1,6009 +0,0 @@
-#include <Arduino.h>
-
-// Icon width and height
-const uint16_t dialWidth = 320;
-const uint16_t dialHeight = 300;
-
-const unsigned short  dial[96000] PROGMEM={
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1062, 0x1081, 0x1061, 0x0861, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1081,   // 0x0010 (16) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1062, 0x1062, 0x1081,   // 0x0020 (32) pixels
-0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081,   // 0x0030 (48) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x1082, 0x1061, 0x1062, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1061, 0x1061,   // 0x0040 (64) pixels
-0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0050 (80) pixels
-0x1081, 0x1081, 0x10A2, 0x18C2, 0x18E3, 0x18C2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0060 (96) pixels
-0x18A2, 0x18C3, 0x18E3, 0x2104, 0x20E3, 0x2104, 0x2104, 0x2104, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x18A2, 0x10A2,   // 0x0070 (112) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x18A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x10A2, 0x0861,   // 0x0080 (128) pixels
-0x0861, 0x0861, 0x0841, 0x0841, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x0090 (144) pixels
-0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000,   // 0x00A0 (160) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020,   // 0x00B0 (176) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0840, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061,   // 0x00C0 (192) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x00D0 (208) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x18A2, 0x18A2, 0x1082,   // 0x00E0 (224) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x00F0 (240) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0100 (256) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0110 (272) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x0120 (288) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2,   // 0x0130 (304) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082,   // 0x0140 (320) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1061, 0x1061, 0x1082, 0x1061, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1061,   // 0x0150 (336) pixels
-0x0882, 0x1082, 0x1082, 0x1081, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1082, 0x1082,   // 0x0160 (352) pixels
-0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061,   // 0x0170 (368) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1061, 0x1062, 0x1082, 0x1061, 0x1082, 0x1061, 0x1082, 0x1082, 0x1061, 0x1081, 0x1061, 0x1081,   // 0x0180 (384) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x0190 (400) pixels
-0x1081, 0x1081, 0x1081, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x01A0 (416) pixels
-0x18A2, 0x20E3, 0x20E3, 0x20E4, 0x2104, 0x1904, 0x2104, 0x2104, 0x2104, 0x18E3, 0x18E3, 0x20E4, 0x20E3, 0x18C3, 0x18C3, 0x18A3,   // 0x01B0 (432) pixels
-0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x18A2, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x0861, 0x0841,   // 0x01C0 (448) pixels
-0x0840, 0x0840, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,   // 0x01D0 (464) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841,   // 0x01E0 (480) pixels
-0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x01F0 (496) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x0840, 0x0841, 0x0841,   // 0x0200 (512) pixels
-0x0861, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081,   // 0x0210 (528) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x1082,   // 0x0220 (544) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0230 (560) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0240 (576) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0250 (592) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x0260 (608) pixels
-0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2,   // 0x0270 (624) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0280 (640) pixels
-0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082,   // 0x0290 (656) pixels
-0x0862, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1082,   // 0x02A0 (672) pixels
-0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061,   // 0x02B0 (688) pixels
-0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1062, 0x0861, 0x1061, 0x1082, 0x1062, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1061,   // 0x02C0 (704) pixels
-0x1081, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x02D0 (720) pixels
-0x1082, 0x1081, 0x1081, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x02E0 (736) pixels
-0x18A3, 0x2104, 0x2104, 0x20E4, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x20E3, 0x18C3, 0x18C3, 0x20E3, 0x18C3,   // 0x02F0 (752) pixels
-0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020,   // 0x0300 (768) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081,   // 0x0310 (784) pixels
-0x1082, 0x10C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x0320 (800) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x10A2,   // 0x0330 (816) pixels
-0x1082, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x0340 (832) pixels
-0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0350 (848) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x0360 (864) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0370 (880) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0380 (896) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0390 (912) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x10A2,   // 0x03A0 (928) pixels
-0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x03B0 (944) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x03C0 (960) pixels
-0x1082, 0x1081, 0x1082, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x1081, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1061,   // 0x03D0 (976) pixels
-0x0861, 0x1081, 0x1081, 0x1081, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1082,   // 0x03E0 (992) pixels
-0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061,   // 0x03F0 (1008) pixels
-0x1081, 0x1081, 0x1082, 0x1062, 0x1061, 0x1061, 0x0861, 0x1062, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1061,   // 0x0400 (1024) pixels
-0x1062, 0x1061, 0x1061, 0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0410 (1040) pixels
-0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0420 (1056) pixels
-0x18A2, 0x18C3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18A2, 0x20E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x0430 (1072) pixels
-0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0841, 0x0841, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000,   // 0x0440 (1088) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0861, 0x18C2, 0x18E3, 0x18E3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x0450 (1104) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x0460 (1120) pixels
-0x10A2, 0x10A3, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x0470 (1136) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18E3, 0x2103, 0x2104, 0x18E3, 0x1082, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x0480 (1152) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0861, 0x1081, 0x1081, 0x1082, 0x1082,   // 0x0490 (1168) pixels
-0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x04A0 (1184) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x04B0 (1200) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x04C0 (1216) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x04D0 (1232) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2,   // 0x04E0 (1248) pixels
-0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x04F0 (1264) pixels
-0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0500 (1280) pixels
-0x0861, 0x0861, 0x0861, 0x1081, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x1081, 0x1082,   // 0x0510 (1296) pixels
-0x1081, 0x1061, 0x1082, 0x1082, 0x0881, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1082,   // 0x0520 (1312) pixels
-0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061,   // 0x0530 (1328) pixels
-0x1082, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1082, 0x1061, 0x1082, 0x1082, 0x1081, 0x1062, 0x1081, 0x1061,   // 0x0540 (1344) pixels
-0x1061, 0x1061, 0x1081, 0x1082, 0x1061, 0x1081, 0x1081, 0x1061, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x0550 (1360) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0560 (1376) pixels
-0x1082, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A3, 0x18A2, 0x18A2, 0x18A2, 0x1082,   // 0x0570 (1392) pixels
-0x1082, 0x1061, 0x0841, 0x0840, 0x0840, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,   // 0x0580 (1408) pixels
-0x0000, 0x0000, 0x0020, 0x0861, 0x10A2, 0x2103, 0x2104, 0x18E3, 0x18C2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3,   // 0x0590 (1424) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x10C2, 0x10C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18A3,   // 0x05A0 (1440) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x10C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2,   // 0x05B0 (1456) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x18C2, 0x18E3, 0x2124, 0x2924, 0x20E3, 0x1081, 0x0020, 0x0000, 0x0000,   // 0x05C0 (1472) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0841, 0x0841, 0x0861, 0x1061, 0x1082,   // 0x05D0 (1488) pixels
-0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x05E0 (1504) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x18A2, 0x18C2, 0x10A2, 0x1082, 0x1082,   // 0x05F0 (1520) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0600 (1536) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0610 (1552) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x1082,   // 0x0620 (1568) pixels
-0x1082, 0x10A2, 0x1081, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x0630 (1584) pixels
-0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082,   // 0x0640 (1600) pixels
-0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x0861, 0x1081, 0x1082, 0x1082, 0x10A2, 0x1081, 0x0861,   // 0x0650 (1616) pixels
-0x0861, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x0660 (1632) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1081, 0x1082, 0x1061, 0x1081,   // 0x0670 (1648) pixels
-0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061,   // 0x0680 (1664) pixels
-0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x0690 (1680) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x06A0 (1696) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061,   // 0x06B0 (1712) pixels
-0x0841, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x1082, 0x10A2,   // 0x06C0 (1728) pixels
-0x18C2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x18C3, 0x10C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x06D0 (1744) pixels
-0x10C2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x18A2, 0x18C2, 0x18C2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x06E0 (1760) pixels
-0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x10C3, 0x18C3, 0x18C3, 0x18A2, 0x18C2, 0x18C2, 0x18A2,   // 0x06F0 (1776) pixels
-0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x18A3, 0x10A2, 0x18C3, 0x18C3, 0x10A2, 0x1082, 0x10A2, 0x18C2, 0x18E3,   // 0x0700 (1792) pixels
-0x18E3, 0x10A2, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0840, 0x0840, 0x0841,   // 0x0710 (1808) pixels
-0x0861, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0720 (1824) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x18A2,   // 0x0730 (1840) pixels
-0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0740 (1856) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0750 (1872) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x0760 (1888) pixels
-0x1082, 0x10A2, 0x1081, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x10A2,   // 0x0770 (1904) pixels
-0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0780 (1920) pixels
-0x0861, 0x1081, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061,   // 0x0790 (1936) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x07A0 (1952) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1082, 0x1081, 0x1081, 0x0861,   // 0x07B0 (1968) pixels
-0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0862, 0x0861, 0x0861, 0x1082, 0x1081, 0x1061, 0x1061, 0x0861,   // 0x07C0 (1984) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1061, 0x1082, 0x1082, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x07D0 (2000) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x07E0 (2016) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1061, 0x0841, 0x0841, 0x0841,   // 0x07F0 (2032) pixels
-0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x18C2, 0x18C3, 0x18C2, 0x1082, 0x0881,   // 0x0800 (2048) pixels
-0x0881, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x18A2, 0x18C3, 0x18C3, 0x18A2, 0x18C3, 0x18C3, 0x18C3,   // 0x0810 (2064) pixels
-0x18A2, 0x18A2, 0x18C3, 0x18C2, 0x10C2, 0x18C2, 0x18A2, 0x18A2, 0x10C3, 0x18C2, 0x10A2, 0x18C2, 0x18C2, 0x18A2, 0x18C3, 0x18C2,   // 0x0820 (2080) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x10C3, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x18C3, 0x18C2, 0x18A2,   // 0x0830 (2096) pixels
-0x18C3, 0x18C3, 0x10C2, 0x10A2, 0x18C3, 0x10A2, 0x18A2, 0x10C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x1082,   // 0x0840 (2112) pixels
-0x1082, 0x10A2, 0x18C3, 0x2103, 0x2103, 0x10A2, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0820, 0x0820,   // 0x0850 (2128) pixels
-0x0840, 0x0841, 0x0841, 0x0861, 0x0881, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0860 (2144) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2,   // 0x0870 (2160) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x18A2, 0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18C2, 0x1082, 0x1082,   // 0x0880 (2176) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0890 (2192) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082,   // 0x08A0 (2208) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C2, 0x10A2,   // 0x08B0 (2224) pixels
-0x18C3, 0x18A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x08C0 (2240) pixels
-0x0861, 0x0861, 0x0881, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1061, 0x0861,   // 0x08D0 (2256) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x08E0 (2272) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081,   // 0x08F0 (2288) pixels
-0x1061, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1062, 0x1082, 0x1061, 0x1061, 0x1061, 0x1081,   // 0x0900 (2304) pixels
-0x1061, 0x1061, 0x1081, 0x1061, 0x1082, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x0881, 0x1061,   // 0x0910 (2320) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x0920 (2336) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1061, 0x0861, 0x0841, 0x0840, 0x0820, 0x0020, 0x0020, 0x0020,   // 0x0930 (2352) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x18E3, 0x18C2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x0940 (2368) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18A2, 0x18A2, 0x18C3, 0x18C3, 0x18A2, 0x18C2, 0x10C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2,   // 0x0950 (2384) pixels
-0x18C2, 0x10C2, 0x10C2, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18A2, 0x18C2,   // 0x0960 (2400) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x10C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18A2, 0x18A2, 0x18C2, 0x18A2,   // 0x0970 (2416) pixels
-0x18C2, 0x18C3, 0x10A2, 0x18C2, 0x10A2, 0x18C2, 0x18C2, 0x10C2, 0x18A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x18C2, 0x18C2,   // 0x0980 (2432) pixels
-0x18C2, 0x10C2, 0x18C3, 0x18C3, 0x18A2, 0x10A2, 0x1082, 0x18C2, 0x18E3, 0x18C2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,   // 0x0990 (2448) pixels
-0x0020, 0x0020, 0x0840, 0x0840, 0x0841, 0x0841, 0x0861, 0x1061, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x09A0 (2464) pixels
-0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2,   // 0x09B0 (2480) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2,   // 0x09C0 (2496) pixels
-0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18C2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x09D0 (2512) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x09E0 (2528) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x18A3,   // 0x09F0 (2544) pixels
-0x18C2, 0x18C3, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0A00 (2560) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x0861, 0x0861,   // 0x0A10 (2576) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861,   // 0x0A20 (2592) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081,   // 0x0A30 (2608) pixels
-0x1061, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1081, 0x0861, 0x1061, 0x1061,   // 0x0A40 (2624) pixels
-0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1082, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082,   // 0x0A50 (2640) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x0A60 (2656) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1061, 0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000,   // 0x0A70 (2672) pixels
-0x0000, 0x0000, 0x0000, 0x0020, 0x18C3, 0x2103, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x18C2, 0x10A2, 0x18C2, 0x18C2,   // 0x0A80 (2688) pixels
-0x10A2, 0x10C2, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x10C2, 0x18C2, 0x18C3, 0x18A2, 0x10C2, 0x18C3,   // 0x0A90 (2704) pixels
-0x18C3, 0x18C2, 0x10C2, 0x18C3, 0x18C2, 0x10C3, 0x18C2, 0x18C3, 0x18A2, 0x18A2, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18A2,   // 0x0AA0 (2720) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18A2, 0x18C3, 0x18A2,   // 0x0AB0 (2736) pixels
-0x18A2, 0x18A2, 0x18C3, 0x18A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18A2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x0AC0 (2752) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x2124, 0x2104, 0x0020, 0x0000, 0x0000, 0x0000,   // 0x0AD0 (2768) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0841, 0x0841, 0x0861, 0x1061, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081,   // 0x0AE0 (2784) pixels
-0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x0AF0 (2800) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2,   // 0x0B00 (2816) pixels
-0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18A2, 0x1082, 0x1082,   // 0x0B10 (2832) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0B20 (2848) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2,   // 0x0B30 (2864) pixels
-0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x0B40 (2880) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1082, 0x1082, 0x0861, 0x0861,   // 0x0B50 (2896) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061,   // 0x0B60 (2912) pixels
-0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1061, 0x1082, 0x1081,   // 0x0B70 (2928) pixels
-0x1061, 0x0861, 0x0841, 0x0861, 0x1081, 0x1061, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1062, 0x0861, 0x0861, 0x0861,   // 0x0B80 (2944) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082,   // 0x0B90 (2960) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081,   // 0x0BA0 (2976) pixels
-0x1082, 0x1081, 0x1061, 0x0861, 0x0841, 0x0841, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,   // 0x0BB0 (2992) pixels
-0x0861, 0x10A2, 0x10C2, 0x10A2, 0x1082, 0x18C2, 0x18C2, 0x10A2, 0x18A2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x18C2,   // 0x0BC0 (3008) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18A2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3,   // 0x0BD0 (3024) pixels
-0x18C2, 0x10A2, 0x18C3, 0x18C3, 0x18C2, 0x10C2, 0x18C2, 0x10A2, 0x18C2, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0x0BE0 (3040) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x18A2, 0x18A2, 0x18C3, 0x18A2, 0x18A2, 0x18C2,   // 0x0BF0 (3056) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18A2, 0x18A2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0x0C00 (3072) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x18C2, 0x18E3, 0x10A2,   // 0x0C10 (3088) pixels
-0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x0841, 0x0841, 0x1081, 0x1081, 0x1082, 0x1082,   // 0x0C20 (3104) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082,   // 0x0C30 (3120) pixels
-0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x0C40 (3136) pixels
-0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x0C50 (3152) pixels
-0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0C60 (3168) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2,   // 0x0C70 (3184) pixels
-0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x10A2, 0x18A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x0C80 (3200) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1081, 0x1082, 0x0861, 0x0861,   // 0x0C90 (3216) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x0CA0 (3232) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x1082, 0x1061, 0x1081, 0x1082,   // 0x0CB0 (3248) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1061, 0x1061, 0x0881, 0x1081, 0x1061, 0x0861, 0x0861, 0x1061,   // 0x0CC0 (3264) pixels
-0x1061, 0x0861, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x0881, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x0CD0 (3280) pixels
-0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081,   // 0x0CE0 (3296) pixels
-0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18C2, 0x20E3, 0x18C3,   // 0x0CF0 (3312) pixels
-0x0881, 0x0881, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18A2, 0x18C2, 0x10C2, 0x10C2, 0x18A2, 0x18C2, 0x18A2, 0x18E3, 0x2103, 0x2103,   // 0x0D00 (3328) pixels
-0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x10C2, 0x10C2, 0x18C3, 0x18C2, 0x18A2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0x0D10 (3344) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x18C3, 0x18A2, 0x18A2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0x0D20 (3360) pixels
-0x18C2, 0x18A2, 0x18C2, 0x10C2, 0x10C2, 0x18C2, 0x18C3, 0x18A2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3,   // 0x0D30 (3376) pixels
-0x18C2, 0x18A2, 0x18C3, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0x0D40 (3392) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C2, 0x18C2, 0x10A2, 0x1081,   // 0x0D50 (3408) pixels
-0x10A2, 0x18E3, 0x18C3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0841, 0x0841, 0x0861, 0x1082,   // 0x0D60 (3424) pixels
-0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0D70 (3440) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2,   // 0x0D80 (3456) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082,   // 0x0D90 (3472) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0DA0 (3488) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x0DB0 (3504) pixels
-0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x0DC0 (3520) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1081, 0x0861, 0x0861,   // 0x0DD0 (3536) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x1081, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x0DE0 (3552) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1061, 0x1082, 0x1081,   // 0x0DF0 (3568) pixels
-0x1081, 0x1061, 0x1082, 0x1082, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x0881, 0x0861, 0x0861,   // 0x0E00 (3584) pixels
-0x1061, 0x1061, 0x0881, 0x1061, 0x1081, 0x0881, 0x1061, 0x1082, 0x1061, 0x1081, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x0E10 (3600) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082,   // 0x0E20 (3616) pixels
-0x0861, 0x0841, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x18E3, 0x2103, 0x18E3, 0x10C2, 0x10A2,   // 0x0E30 (3632) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x10C2, 0x18C2, 0x18A2, 0x18A2, 0x18E3, 0x2103, 0x2103,   // 0x0E40 (3648) pixels
-0x18E3, 0x18C2, 0x18A2, 0x18C3, 0x18C3, 0x10A2, 0x18C3, 0x18C2, 0x18A2, 0x18C3, 0x18A2, 0x18C2, 0x18A2, 0x18A2, 0x18C2, 0x18C3,   // 0x0E50 (3664) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x10A2,   // 0x0E60 (3680) pixels
-0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18A2, 0x10C2, 0x18C3, 0x18C2, 0x18C2,   // 0x0E70 (3696) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x18A2, 0x18C3, 0x18A2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0x0E80 (3712) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2,   // 0x0E90 (3728) pixels
-0x10A2, 0x1082, 0x10A2, 0x2104, 0x2124, 0x0861, 0x0000, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0820, 0x0841, 0x0841, 0x1061,   // 0x0EA0 (3744) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082,   // 0x0EB0 (3760) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2,   // 0x0EC0 (3776) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x0ED0 (3792) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0EE0 (3808) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x0EF0 (3824) pixels
-0x18A2, 0x18A2, 0x18A2, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x0F00 (3840) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x0861, 0x0861, 0x0861,   // 0x0F10 (3856) pixels
-0x0861, 0x0841, 0x0841, 0x0861, 0x1061, 0x1061, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861,   // 0x0F20 (3872) pixels
-0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1082, 0x1081, 0x1082,   // 0x0F30 (3888) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x0881, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x0881, 0x0861,   // 0x0F40 (3904) pixels
-0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x1081, 0x1081, 0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081,   // 0x0F50 (3920) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841,   // 0x0F60 (3936) pixels
-0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x18C3, 0x18C3, 0x10A2, 0x1082, 0x18C3, 0x18C3, 0x18C3, 0x10A2,   // 0x0F70 (3952) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0x0F80 (3968) pixels
-0x18C2, 0x18C2, 0x18C3, 0x10C2, 0x18C2, 0x18C3, 0x10C3, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x20E3, 0x2104, 0x18E3, 0x10A2,   // 0x0F90 (3984) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0FA0 (4000) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x0FB0 (4016) pixels
-0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x0FC0 (4032) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3,   // 0x0FD0 (4048) pixels
-0x18C2, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x2103, 0x2124, 0x10A2, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0841,   // 0x0FE0 (4064) pixels
-0x0840, 0x0841, 0x0861, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x0FF0 (4080) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x1000 (4096) pixels
-0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1010 (4112) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1020 (4128) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x1030 (4144) pixels
-0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1040 (4160) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1050 (4176) pixels
-0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1081, 0x1082, 0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861,   // 0x1060 (4192) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x1070 (4208) pixels
-0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061,   // 0x1080 (4224) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x1081, 0x1061, 0x1061, 0x1081, 0x1081, 0x0881, 0x1081, 0x1061, 0x1081, 0x1081,   // 0x1090 (4240) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1082, 0x1061, 0x0861, 0x0861, 0x0841, 0x0841, 0x0040, 0x0020,   // 0x10A0 (4256) pixels
-0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18C3, 0x10A2, 0x0881, 0x1082, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x10A2, 0x10C2,   // 0x10B0 (4272) pixels
-0x10C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x10C0 (4288) pixels
-0x18A2, 0x18C2, 0x18C2, 0x10C2, 0x10C2, 0x10C2, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x10A2, 0x18C3, 0x18E3, 0x2104, 0x18E3, 0x10A2,   // 0x10D0 (4304) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x0882, 0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x10E0 (4320) pixels
-0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1061, 0x0881, 0x1061, 0x0861, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x10F0 (4336) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x10C2, 0x18C3,   // 0x1100 (4352) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x1110 (4368) pixels
-0x18C3, 0x18A2, 0x18C2, 0x10C2, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x18C2, 0x2103, 0x0881, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020,   // 0x1120 (4384) pixels
-0x0020, 0x0840, 0x0840, 0x0861, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1130 (4400) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082,   // 0x1140 (4416) pixels
-0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1150 (4432) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1160 (4448) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x1170 (4464) pixels
-0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1180 (4480) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1190 (4496) pixels
-0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1082, 0x1081, 0x1061, 0x0841, 0x0841, 0x0861, 0x1081, 0x1061, 0x1081,   // 0x11A0 (4512) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1081, 0x1081,   // 0x11B0 (4528) pixels
-0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x11C0 (4544) pixels
-0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081,   // 0x11D0 (4560) pixels
-0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1061, 0x0841, 0x0840, 0x0020, 0x0020, 0x0020, 0x0000,   // 0x11E0 (4576) pixels
-0x0000, 0x0000, 0x0000, 0x10A2, 0x18C2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x18C3, 0x18C2, 0x18C3,   // 0x11F0 (4592) pixels
-0x10C3, 0x10C2, 0x10C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x10C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0x1200 (4608) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x18A2, 0x18C3, 0x10A2,   // 0x1210 (4624) pixels
-0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1220 (4640) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2,   // 0x1230 (4656) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18C2,   // 0x1240 (4672) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x10C3, 0x18C3, 0x18C2, 0x18C3, 0x10C2, 0x18C3, 0x18C3, 0x18C3,   // 0x1250 (4688) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x10C3, 0x18A2, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x18E3, 0x20E3, 0x0000, 0x0020, 0x0020,   // 0x1260 (4704) pixels
-0x0000, 0x0020, 0x0020, 0x0840, 0x0841, 0x0861, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1270 (4720) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081,   // 0x1280 (4736) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1290 (4752) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x12A0 (4768) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x12B0 (4784) pixels
-0x18A2, 0x18A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x12C0 (4800) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12D0 (4816) pixels
-0x0861, 0x1061, 0x1081, 0x1081, 0x1081, 0x1082, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1061, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x12E0 (4832) pixels
-0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x1081,   // 0x12F0 (4848) pixels
-0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x1300 (4864) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1081, 0x0881, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061,   // 0x1310 (4880) pixels
-0x1081, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,   // 0x1320 (4896) pixels
-0x0020, 0x18C3, 0x10C2, 0x1081, 0x10C2, 0x10A2, 0x18C3, 0x18C2, 0x18C3, 0x10C3, 0x18C3, 0x10C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3,   // 0x1330 (4912) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18A2, 0x18A2,   // 0x1340 (4928) pixels
-0x18A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x0882, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1350 (4944) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1360 (4960) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1370 (4976) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1061, 0x0882, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x1380 (4992) pixels
-0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x10C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C2,   // 0x1390 (5008) pixels
-0x18C2, 0x10C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x18E3, 0x2104, 0x0020,   // 0x13A0 (5024) pixels
-0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x13B0 (5040) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x13C0 (5056) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1081, 0x1082,   // 0x13D0 (5072) pixels
-0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x13E0 (5088) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x13F0 (5104) pixels
-0x18A3, 0x18A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1081, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1400 (5120) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1410 (5136) pixels
-0x0861, 0x0861, 0x1082, 0x1061, 0x1061, 0x1082, 0x1061, 0x1082, 0x1081, 0x1061, 0x1061, 0x1081, 0x1082, 0x1061, 0x1081, 0x1082,   // 0x1420 (5152) pixels
-0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1430 (5168) pixels
-0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1082,   // 0x1440 (5184) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x0861, 0x1081, 0x0881, 0x0881, 0x1081, 0x1081,   // 0x1450 (5200) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0820, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x1082,   // 0x1460 (5216) pixels
-0x10A2, 0x1081, 0x1082, 0x10A2, 0x18C2, 0x10C2, 0x18C2, 0x18E3, 0x18C3, 0x18C3, 0x10C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3,   // 0x1470 (5232) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x10C2, 0x18C2, 0x18C2, 0x10A2, 0x18A2, 0x18A2, 0x18A2, 0x10A2,   // 0x1480 (5248) pixels
-0x1081, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x18C3, 0x18A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1490 (5264) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x14A0 (5280) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x14B0 (5296) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x0861, 0x1061,   // 0x14C0 (5312) pixels
-0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x18C3, 0x18C3, 0x10C3, 0x18C3, 0x10C2, 0x18C3,   // 0x14D0 (5328) pixels
-0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x18E3,   // 0x14E0 (5344) pixels
-0x18C3, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x14F0 (5360) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1500 (5376) pixels
-0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1510 (5392) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1520 (5408) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x1530 (5424) pixels
-0x18A2, 0x18A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1540 (5440) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1550 (5456) pixels
-0x0861, 0x1081, 0x1061, 0x1061, 0x1061, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x1560 (5472) pixels
-0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1570 (5488) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x0881, 0x1081, 0x1061, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082,   // 0x1580 (5504) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1081, 0x0861, 0x0881, 0x1081, 0x1061,   // 0x1590 (5520) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x10C2, 0x10A2, 0x0861,   // 0x15A0 (5536) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x10C2, 0x18A2, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x15B0 (5552) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x0882, 0x10A2, 0x18A2, 0x18C3,   // 0x15C0 (5568) pixels
-0x18C2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15D0 (5584) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15E0 (5600) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15F0 (5616) pixels
-0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1600 (5632) pixels
-0x10A2, 0x10A2, 0x1082, 0x0881, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x1610 (5648) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x10C2, 0x10A2, 0x10A2, 0x10A2,   // 0x1620 (5664) pixels
-0x0881, 0x18C2, 0x2104, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0820, 0x0840, 0x0841, 0x0861, 0x1061, 0x1082, 0x1082,   // 0x1630 (5680) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1640 (5696) pixels
-0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082,   // 0x1650 (5712) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1660 (5728) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x1670 (5744) pixels
-0x18A2, 0x18A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1882, 0x1082, 0x10A2, 0x10A2, 0x1082,   // 0x1680 (5760) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1690 (5776) pixels
-0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x16A0 (5792) pixels
-0x1081, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16B0 (5808) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081,   // 0x16C0 (5824) pixels
-0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861, 0x1081, 0x1081, 0x1081, 0x0861,   // 0x16D0 (5840) pixels
-0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x18E3, 0x1082, 0x0882, 0x10A2,   // 0x16E0 (5856) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10C2, 0x10C2, 0x18C3, 0x18C3, 0x18C2, 0x10C3, 0x10C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0x16F0 (5872) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x10C3,   // 0x1700 (5888) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1710 (5904) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1720 (5920) pixels
-0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x1730 (5936) pixels
-0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1740 (5952) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0x1750 (5968) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C3, 0x10A2, 0x10C2, 0x10C2, 0x10A2,   // 0x1760 (5984) pixels
-0x10A2, 0x10A2, 0x10A2, 0x2104, 0x10A2, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0820, 0x0840, 0x0841, 0x0841, 0x1061, 0x1082,   // 0x1770 (6000) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1780 (6016) pixels
-0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082,   // 0x1790 (6032) pixels
-0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x17A0 (6048) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x17B0 (6064) pixels
-0x18A2, 0x18A2, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082,   // 0x17C0 (6080) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17D0 (6096) pixels
-0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1061, 0x1081, 0x1081, 0x1081,   // 0x17E0 (6112) pixels
-0x1081, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17F0 (6128) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061,   // 0x1800 (6144) pixels
-0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1810 (6160) pixels
-0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x10C2, 0x10A2,   // 0x1820 (6176) pixels
-0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x18C3, 0x18C3, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x1830 (6192) pixels
-0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x18A2, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A3, 0x10A2,   // 0x1840 (6208) pixels
-0x10A2, 0x18A3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0881,   // 0x1850 (6224) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1860 (6240) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081,   // 0x1870 (6256) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1880 (6272) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0882, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C2,   // 0x1890 (6288) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x10C2, 0x10A2, 0x18C2, 0x10A2, 0x18C2, 0x10C2, 0x18C3, 0x10C2, 0x18C3, 0x18C3,   // 0x18A0 (6304) pixels
-0x18C2, 0x10C3, 0x18C2, 0x18C3, 0x10A2, 0x18C3, 0x18E3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0841, 0x0841, 0x0861,   // 0x18B0 (6320) pixels
-0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x18C0 (6336) pixels
-0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081,   // 0x18D0 (6352) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x1082, 0x1081, 0x1082,   // 0x18E0 (6368) pixels
-0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18A2,   // 0x18F0 (6384) pixels
-0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x1900 (6400) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1910 (6416) pixels
-0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x1920 (6432) pixels
-0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1930 (6448) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1081, 0x1081, 0x0881, 0x1061, 0x0861, 0x0861, 0x0841,   // 0x1940 (6464) pixels
-0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0841,   // 0x1950 (6480) pixels
-0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10A2, 0x10A2, 0x18A2, 0x20E4, 0x18E3, 0x10A2, 0x10A2, 0x10A2,   // 0x1960 (6496) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C3, 0x10C3, 0x10A2, 0x18C3, 0x18C2, 0x10C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x10A2,   // 0x1970 (6512) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1081, 0x1082, 0x18A2, 0x18A2, 0x18C2, 0x18A2, 0x18C2, 0x10A2, 0x18C3, 0x10A2, 0x18C3, 0x10C3, 0x10A2,   // 0x1980 (6528) pixels
-0x18C2, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x0820,   // 0x1990 (6544) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x19A0 (6560) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x19B0 (6576) pixels
-0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082,   // 0x19C0 (6592) pixels
-0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0882, 0x0861, 0x1082, 0x1082, 0x10A2,   // 0x19D0 (6608) pixels
-0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x18C2, 0x18A2, 0x18C3, 0x10C2, 0x10C2, 0x10C2, 0x18C2, 0x10C2, 0x18C2,   // 0x19E0 (6624) pixels
-0x10A2, 0x18C3, 0x10C2, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x18E3, 0x10A2, 0x0000, 0x0020, 0x0020, 0x0020, 0x0820, 0x0840, 0x0841,   // 0x19F0 (6640) pixels
-0x0841, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x1A00 (6656) pixels
-0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1061,   // 0x1A10 (6672) pixels
-0x0861, 0x0841, 0x0841, 0x0840, 0x0820, 0x0840, 0x0820, 0x0840, 0x0840, 0x0841, 0x0840, 0x0841, 0x0861, 0x1081, 0x1082, 0x1082,   // 0x1A20 (6688) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18A2,   // 0x1A30 (6704) pixels
-0x18A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2,   // 0x1A40 (6720) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1A50 (6736) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1082, 0x1061, 0x1081, 0x1081, 0x0861, 0x0861, 0x0861,   // 0x1A60 (6752) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1A70 (6768) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1081, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1081, 0x0841,   // 0x1A80 (6784) pixels
-0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020,   // 0x1A90 (6800) pixels
-0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x1082, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2,   // 0x1AA0 (6816) pixels
-0x18C3, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x1AB0 (6832) pixels
-0x1081, 0x10A2, 0x18C3, 0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x10A2,   // 0x1AC0 (6848) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1061, 0x0840, 0x0020, 0x0020,   // 0x1AD0 (6864) pixels
-0x0020, 0x0820, 0x0840, 0x0841, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1081,   // 0x1AE0 (6880) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1061, 0x0861, 0x0861, 0x0840, 0x0840, 0x0020,   // 0x1AF0 (6896) pixels
-0x0020, 0x0040, 0x0861, 0x1081, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082,   // 0x1B00 (6912) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x1081,   // 0x1B10 (6928) pixels
-0x1081, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C2, 0x18A2, 0x10C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C2,   // 0x1B20 (6944) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x10A2, 0x10A2, 0x1082, 0x18C3, 0x2103, 0x0000, 0x0020, 0x0020, 0x0020, 0x0820,   // 0x1B30 (6960) pixels
-0x0840, 0x0841, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081,   // 0x1B40 (6976) pixels
-0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1062, 0x1061, 0x1061, 0x1081, 0x1082, 0x1061, 0x0861,   // 0x1B50 (6992) pixels
-0x0841, 0x0840, 0x0820, 0x0861, 0x10A2, 0x2924, 0x3185, 0x3165, 0x2124, 0x10A2, 0x0820, 0x0840, 0x0861, 0x1081, 0x1082, 0x1081,   // 0x1B60 (7008) pixels
-0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x1B70 (7024) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x1B80 (7040) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1B90 (7056) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1BA0 (7072) pixels
-0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1BB0 (7088) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x1BC0 (7104) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0040, 0x0020, 0x0020, 0x0020,   // 0x1BD0 (7120) pixels
-0x0000, 0x0000, 0x0000, 0x0861, 0x1082, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x18C3,   // 0x1BE0 (7136) pixels
-0x18C2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x10C2, 0x18C3, 0x10C2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x18C2,   // 0x1BF0 (7152) pixels
-0x18C2, 0x18A2, 0x18C3, 0x18C3, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x18A2, 0x18C2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x1082,   // 0x1C00 (7168) pixels
-0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0840, 0x0020, 0x0020, 0x0020, 0x0861, 0x1081, 0x10A2, 0x1082, 0x1081, 0x1082,   // 0x1C10 (7184) pixels
-0x1081, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x20E3, 0x2944, 0x2103, 0x2924, 0x5289, 0x5289, 0x4A28, 0x2103, 0x2103, 0x20E3,   // 0x1C20 (7200) pixels
-0x20E3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1081,   // 0x1C30 (7216) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x1081, 0x0841, 0x0020, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1C40 (7232) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x18E3, 0x18C3, 0x10A2, 0x10A2,   // 0x1C50 (7248) pixels
-0x10A2, 0x10A2, 0x1081, 0x1081, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x10C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3,   // 0x1C60 (7264) pixels
-0x10A2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x20E3, 0x2103, 0x0000, 0x0020, 0x0020,   // 0x1C70 (7280) pixels
-0x0020, 0x0820, 0x0841, 0x0841, 0x1061, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x1C80 (7296) pixels
-0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1061, 0x1082, 0x1081, 0x1062, 0x1061, 0x1062, 0x0861, 0x0861, 0x0841, 0x0841,   // 0x1C90 (7312) pixels
-0x0861, 0x18E3, 0x2925, 0x39C7, 0x5249, 0x630B, 0x630B, 0x5AAA, 0x5249, 0x4A28, 0x31A6, 0x2103, 0x0841, 0x0841, 0x0861, 0x0861,   // 0x1CA0 (7328) pixels
-0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x10A2,   // 0x1CB0 (7344) pixels
-0x10A2, 0x10A2, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x1CC0 (7360) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1CD0 (7376) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1CE0 (7392) pixels
-0x0861, 0x1062, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861,   // 0x1CF0 (7408) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081,   // 0x1D00 (7424) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000,   // 0x1D10 (7440) pixels
-0x0000, 0x0000, 0x0861, 0x1081, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10C3, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x18C3, 0x10C2,   // 0x1D20 (7456) pixels
-0x18C2, 0x10C2, 0x10C2, 0x10C3, 0x10A2, 0x10C2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x1D30 (7472) pixels
-0x18A2, 0x18C2, 0x18A2, 0x18A2, 0x18C2, 0x18A2, 0x18C2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x1081, 0x0861,   // 0x1D40 (7488) pixels
-0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0840, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x18A2, 0x18E3, 0x18E3,   // 0x1D50 (7504) pixels
-0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x20E3, 0x2103, 0x5268, 0x5248, 0x41E7, 0x20E3, 0x2103, 0x18E3,   // 0x1D60 (7520) pixels
-0x18C3, 0x18C2, 0x18E3, 0x39C6, 0x20E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0x1D70 (7536) pixels
-0x18E3, 0x18E3, 0x10A2, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820,   // 0x1D80 (7552) pixels
-0x0841, 0x0861, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x1082, 0x1082,   // 0x1D90 (7568) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C3, 0x18C2, 0x18C3, 0x10C2, 0x10C2, 0x10C3,   // 0x1DA0 (7584) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10C2, 0x18E3, 0x0020, 0x0000,   // 0x1DB0 (7600) pixels
-0x0020, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082,   // 0x1DC0 (7616) pixels
-0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1061, 0x1082, 0x1082, 0x1062, 0x1061, 0x0841, 0x0841, 0x0820, 0x10A2,   // 0x1DD0 (7632) pixels
-0x2924, 0x3185, 0x39A6, 0x4207, 0x5A8A, 0x734C, 0x736C, 0x6B2C, 0x5AAA, 0x528A, 0x5269, 0x41E7, 0x2104, 0x0861, 0x0820, 0x0841,   // 0x1DE0 (7648) pixels
-0x0861, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1DF0 (7664) pixels
-0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2,   // 0x1E00 (7680) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1E10 (7696) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1E20 (7712) pixels
-0x0861, 0x1061, 0x1061, 0x0861, 0x0020, 0x0861, 0x18C2, 0x18E3, 0x18C2, 0x10A2, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1E30 (7728) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082,   // 0x1E40 (7744) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x1E50 (7760) pixels
-0x0861, 0x1082, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C3, 0x18C2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x10C3, 0x10C2,   // 0x1E60 (7776) pixels
-0x18C2, 0x18C2, 0x18C2, 0x10C2, 0x18C2, 0x10A2, 0x1082, 0x10A2, 0x1061, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x10A2,   // 0x1E70 (7792) pixels
-0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x18C2, 0x18A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x1082, 0x0861, 0x0020, 0x0020,   // 0x1E80 (7808) pixels
-0x0840, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1061, 0x10A2, 0x18C2, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x1E90 (7824) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x2103, 0x41E7, 0x5A89, 0x4A07, 0x2103, 0x20E3, 0x18C3,   // 0x1EA0 (7840) pixels
-0x18E3, 0x18C3, 0x20E3, 0x4A48, 0x5269, 0x41E7, 0x18E3, 0x18C3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x1EB0 (7856) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0020,   // 0x1EC0 (7872) pixels
-0x0020, 0x0020, 0x0840, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x1ED0 (7888) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x0881, 0x1082, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x10A2,   // 0x1EE0 (7904) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x1082, 0x18C3, 0x10A2,   // 0x1EF0 (7920) pixels
-0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1082, 0x1081, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x1F00 (7936) pixels
-0x1061, 0x1081, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1062, 0x1062, 0x1061, 0x0861, 0x0840, 0x0841, 0x2964, 0x31A6,   // 0x1F10 (7952) pixels
-0x39E7, 0x39C7, 0x39C6, 0x4207, 0x528A, 0x738C, 0x7C0E, 0x7BCD, 0x632B, 0x632A, 0x734C, 0x630B, 0x4A28, 0x39C6, 0x2924, 0x0820,   // 0x1F20 (7968) pixels
-0x0841, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x1F30 (7984) pixels
-0x1082, 0x10A2, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082,   // 0x1F40 (8000) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1F50 (8016) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x1F60 (8032) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x2103, 0x3185, 0x39E7, 0x39C7, 0x3186, 0x2965, 0x2124, 0x1903, 0x18E3, 0x0861, 0x0861, 0x1061,   // 0x1F70 (8048) pixels
-0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x0881, 0x1061, 0x1081, 0x1081, 0x1081,   // 0x1F80 (8064) pixels
-0x1081, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0040, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861,   // 0x1F90 (8080) pixels
-0x10A2, 0x0882, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C3, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10C3, 0x18C2,   // 0x1FA0 (8096) pixels
-0x10A2, 0x10A2, 0x18C3, 0x10C2, 0x10A2, 0x10A2, 0x0881, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C3, 0x18C2,   // 0x1FB0 (8112) pixels
-0x18C3, 0x18C3, 0x18A2, 0x10A2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x1082, 0x1081, 0x0841, 0x0020, 0x0841, 0x1082, 0x1082,   // 0x1FC0 (8128) pixels
-0x1082, 0x1081, 0x1081, 0x18A2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2,   // 0x1FD0 (8144) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x2924, 0x39A6, 0x4207, 0x2103, 0x18C2, 0x18E3,   // 0x1FE0 (8160) pixels
-0x18E3, 0x18E3, 0x2103, 0x5AA9, 0x62EA, 0x5ACA, 0x2924, 0x2924, 0x2944, 0x20E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3,   // 0x1FF0 (8176) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x1082, 0x1081, 0x1082,   // 0x2000 (8192) pixels
-0x1082, 0x1082, 0x0820, 0x0020, 0x0840, 0x0861, 0x1081, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x2010 (8208) pixels
-0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1082, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x18C2,   // 0x2020 (8224) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C3, 0x10A2, 0x10A2, 0x10A2, 0x18C2,   // 0x2030 (8240) pixels
-0x10A2, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x0841, 0x0861, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081,   // 0x2040 (8256) pixels
-0x1061, 0x1081, 0x1081, 0x1061, 0x1082, 0x1082, 0x1082, 0x1061, 0x1062, 0x1081, 0x1061, 0x0841, 0x1081, 0x2124, 0x2945, 0x3185,   // 0x2050 (8272) pixels
-0x3186, 0x3186, 0x39C7, 0x4A48, 0x4A68, 0x5ACA, 0x632B, 0x6B4B, 0x5ACA, 0x5AEA, 0x734C, 0x736C, 0x5ACA, 0x4A08, 0x39C7, 0x1082,   // 0x2060 (8288) pixels
-0x0841, 0x1081, 0x1061, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x2070 (8304) pixels
-0x1082, 0x1082, 0x10A2, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082,   // 0x2080 (8320) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x2090 (8336) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x20A0 (8352) pixels
-0x0861, 0x18C3, 0x2945, 0x4207, 0x5289, 0x52A9, 0x4A48, 0x4A28, 0x4A28, 0x5269, 0x5289, 0x4228, 0x39E7, 0x3165, 0x2124, 0x0861,   // 0x20B0 (8368) pixels
-0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0881, 0x0881, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x20C0 (8384) pixels
-0x1081, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x1081,   // 0x20D0 (8400) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18A3, 0x10C2, 0x18C3, 0x10C2, 0x10C2, 0x10C2, 0x18C3, 0x10C2, 0x18C3, 0x18C3, 0x18C3,   // 0x20E0 (8416) pixels
-0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18C3,   // 0x20F0 (8432) pixels
-0x18A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1081, 0x0861, 0x0820, 0x0020, 0x0020, 0x1061, 0x1082, 0x1082, 0x1061, 0x18E3, 0x18E3,   // 0x2100 (8448) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3,   // 0x2110 (8464) pixels
-0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x18E3, 0x2103, 0x2103, 0x2103,   // 0x2120 (8480) pixels
-0x2103, 0x2103, 0x3164, 0x6AEA, 0x734B, 0x62EA, 0x3165, 0x3185, 0x4A47, 0x3185, 0x2103, 0x2103, 0x2924, 0x2104, 0x18E3, 0x18C3,   // 0x2130 (8496) pixels
-0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3,   // 0x2140 (8512) pixels
-0x18E3, 0x18C2, 0x1081, 0x1082, 0x1082, 0x0861, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2150 (8528) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x1082, 0x1082, 0x10A2, 0x18C2,   // 0x2160 (8544) pixels
-0x18C3, 0x18C3, 0x10C2, 0x18C3, 0x10C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x10A2,   // 0x2170 (8560) pixels
-0x1081, 0x18C3, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x0840, 0x0841, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081,   // 0x2180 (8576) pixels
-0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1061, 0x1082, 0x1082, 0x1061, 0x1061, 0x0861, 0x0841, 0x2103, 0x2103, 0x2104, 0x2945,   // 0x2190 (8592) pixels
-0x39C6, 0x4207, 0x41E7, 0x4207, 0x4A28, 0x4A48, 0x4227, 0x4A68, 0x4A48, 0x52A9, 0x5ACA, 0x62EA, 0x5AA9, 0x4A28, 0x5248, 0x3165,   // 0x21A0 (8608) pixels
-0x1082, 0x0841, 0x0861, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081,   // 0x21B0 (8624) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082,   // 0x21C0 (8640) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x21D0 (8656) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020,   // 0x21E0 (8672) pixels
-0x1082, 0x39A6, 0x4228, 0x5ACA, 0x4A48, 0x4A28, 0x4A28, 0x41E7, 0x4A48, 0x5289, 0x52A9, 0x4A68, 0x4207, 0x31A6, 0x2124, 0x2103,   // 0x21F0 (8688) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081,   // 0x2200 (8704) pixels
-0x1081, 0x1081, 0x0841, 0x0840, 0x0040, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0881, 0x0861, 0x10A2,   // 0x2210 (8720) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C3, 0x18C2, 0x18C3, 0x18C2, 0x18A2,   // 0x2220 (8736) pixels
-0x10A2, 0x10A2, 0x1082, 0x1082, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x2103, 0x20E3, 0x18C2,   // 0x2230 (8752) pixels
-0x10A2, 0x10A2, 0x1082, 0x1081, 0x0861, 0x0840, 0x0020, 0x0820, 0x1082, 0x1081, 0x1082, 0x1081, 0x18E3, 0x18C3, 0x18C3, 0x18C2,   // 0x2240 (8768) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3,   // 0x2250 (8784) pixels
-0x18E3, 0x2945, 0x3185, 0x3185, 0x3985, 0x3986, 0x39A6, 0x39A6, 0x39A5, 0x39A6, 0x39A6, 0x39A6, 0x3185, 0x39A6, 0x39A6, 0x39A6,   // 0x2260 (8800) pixels
-0x39A6, 0x39A6, 0x4A27, 0x734B, 0x736B, 0x6B2B, 0x2924, 0x39A6, 0x7B8C, 0x6B0B, 0x41C6, 0x2924, 0x2124, 0x2103, 0x18E3, 0x18E3,   // 0x2270 (8816) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x2280 (8832) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1081, 0x1082, 0x1082, 0x1082, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x0861, 0x1081, 0x1082,   // 0x2290 (8848) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x22A0 (8864) pixels
-0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x10C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C2,   // 0x22B0 (8880) pixels
-0x10A2, 0x0861, 0x18C3, 0x10A2, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0840, 0x0840, 0x1061, 0x1061, 0x1081, 0x1082, 0x1082,   // 0x22C0 (8896) pixels
-0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1061, 0x0861, 0x0841, 0x0841, 0x2124, 0x2103, 0x2104, 0x2924,   // 0x22D0 (8912) pixels
-0x3165, 0x3185, 0x3186, 0x3186, 0x39A6, 0x3185, 0x31A6, 0x39A6, 0x39E7, 0x4207, 0x4A48, 0x5269, 0x5ACA, 0x4A28, 0x5269, 0x31A6,   // 0x22E0 (8928) pixels
-0x2104, 0x0820, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x22F0 (8944) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x10A2,   // 0x2300 (8960) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841,   // 0x2310 (8976) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x10A2,   // 0x2320 (8992) pixels
-0x3165, 0x5269, 0x5289, 0x632B, 0x5289, 0x4A48, 0x5269, 0x4A48, 0x4A48, 0x4A69, 0x4A48, 0x39E7, 0x31A6, 0x2965, 0x18E3, 0x18E3,   // 0x2330 (9008) pixels
-0x2124, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081,   // 0x2340 (9024) pixels
-0x1081, 0x1081, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x0861, 0x0881, 0x1082, 0x10A2,   // 0x2350 (9040) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x10C2, 0x18C3, 0x10A2, 0x10A2, 0x10A2,   // 0x2360 (9056) pixels
-0x0881, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x18A2,   // 0x2370 (9072) pixels
-0x10A2, 0x1082, 0x0841, 0x0020, 0x0861, 0x1082, 0x1082, 0x1081, 0x10A2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0x2380 (9088) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3,   // 0x2390 (9104) pixels
-0x2103, 0x2924, 0x6289, 0x7B6B, 0x7BAD, 0x83AD, 0x83CD, 0x8BCD, 0x83CD, 0x83CD, 0x83AD, 0x83CD, 0x83CD, 0x83CD, 0x8BED, 0x8BCD,   // 0x23A0 (9120) pixels
-0x83CC, 0x83CD, 0x83AC, 0x83CD, 0x83AC, 0x730A, 0x2924, 0x39C6, 0x838C, 0x83CD, 0x730B, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3,   // 0x23B0 (9136) pixels
-0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2,   // 0x23C0 (9152) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x1082, 0x1081, 0x1082, 0x1082, 0x0841, 0x0020, 0x0820, 0x0861, 0x1081,   // 0x23D0 (9168) pixels
-0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x0861,   // 0x23E0 (9184) pixels
-0x1082, 0x1082, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x10C2,   // 0x23F0 (9200) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1082, 0x18E3, 0x10A2, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082,   // 0x2400 (9216) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1061, 0x0861, 0x0841, 0x0020, 0x18C3, 0x2104, 0x2103, 0x2103, 0x2103,   // 0x2410 (9232) pixels
-0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x18C2, 0x18C3, 0x2104, 0x2985, 0x2944, 0x31A6, 0x41C7, 0x5248, 0x5249, 0x4A28, 0x3185,   // 0x2420 (9248) pixels
-0x2924, 0x0841, 0x0020, 0x0861, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081,   // 0x2430 (9264) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x2440 (9280) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x2450 (9296) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0020, 0x1081, 0x2945,   // 0x2460 (9312) pixels
-0x4208, 0x5269, 0x5A89, 0x5AAA, 0x5289, 0x5269, 0x4A48, 0x4228, 0x3186, 0x2924, 0x2944, 0x2124, 0x2104, 0x18C3, 0x10A2, 0x10A2,   // 0x2470 (9328) pixels
-0x18C2, 0x10A2, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081,   // 0x2480 (9344) pixels
-0x1081, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x2490 (9360) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x18C2,   // 0x24A0 (9376) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0020,   // 0x24B0 (9392) pixels
-0x0020, 0x1082, 0x1082, 0x1082, 0x1061, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18C3,   // 0x24C0 (9408) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x20E3,   // 0x24D0 (9424) pixels
-0x2103, 0x2103, 0x2924, 0x6AEA, 0x83CD, 0x83ED, 0x8BED, 0x8BED, 0x8BED, 0x8BED, 0x8BED, 0x8BED, 0x93EE, 0x8BED, 0x93EE, 0x8BED,   // 0x24E0 (9440) pixels
-0x8BCD, 0x8BCD, 0x83ED, 0x83ED, 0x83CD, 0x6AEA, 0x2924, 0x41C6, 0x83AC, 0x83CC, 0x7B6B, 0x2924, 0x2103, 0x2104, 0x2104, 0x20E3,   // 0x24F0 (9456) pixels
-0x20E3, 0x2124, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3,   // 0x2500 (9472) pixels
-0x18E3, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x1061, 0x1082, 0x1082, 0x1081, 0x0020,   // 0x2510 (9488) pixels
-0x0020, 0x0840, 0x0841, 0x0861, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2,   // 0x2520 (9504) pixels
-0x10A2, 0x1061, 0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2,   // 0x2530 (9520) pixels
-0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x2103, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x1061, 0x1061,   // 0x2540 (9536) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0840, 0x0841, 0x18E3, 0x18C3, 0x20E3, 0x2103, 0x18E3,   // 0x2550 (9552) pixels
-0x18A2, 0x18A2, 0x18C3, 0x18E3, 0x18E3, 0x1082, 0x18A2, 0x18E3, 0x2945, 0x3165, 0x39A6, 0x39A6, 0x41E7, 0x4A49, 0x4208, 0x3165,   // 0x2560 (9568) pixels
-0x2924, 0x18C2, 0x0820, 0x0841, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2570 (9584) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x2580 (9600) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x2590 (9616) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0020, 0x10A2, 0x3165,   // 0x25A0 (9632) pixels
-0x4A28, 0x5A8A, 0x528A, 0x4A48, 0x39C6, 0x39E6, 0x39E7, 0x39C6, 0x2945, 0x2104, 0x18C2, 0x18C3, 0x18C3, 0x1061, 0x1082, 0x10A2,   // 0x25B0 (9648) pixels
-0x10A2, 0x18C2, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x25C0 (9664) pixels
-0x0861, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0841, 0x0841, 0x0861, 0x0861, 0x0882, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x25D0 (9680) pixels
-0x10A2, 0x10C2, 0x10A2, 0x18A3, 0x18A3, 0x18C2, 0x10A2, 0x18C2, 0x18C2, 0x10C2, 0x10A2, 0x10A2, 0x0882, 0x10A2, 0x10C2, 0x10A2,   // 0x25E0 (9696) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0020, 0x0020, 0x1082,   // 0x25F0 (9712) pixels
-0x1082, 0x1081, 0x10A2, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x18C3, 0x18E3,   // 0x2600 (9728) pixels
-0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103,   // 0x2610 (9744) pixels
-0x2103, 0x2104, 0x2103, 0x39A5, 0x62A9, 0x6AEA, 0x6B0A, 0x72EA, 0x730A, 0x732B, 0x732A, 0x732A, 0x732B, 0x730A, 0x732B, 0x730A,   // 0x2620 (9760) pixels
-0x730A, 0x730A, 0x730A, 0x6B0A, 0x62A9, 0x41E6, 0x2944, 0x5A89, 0x8BED, 0x8BED, 0x7B6C, 0x2944, 0x2103, 0x2103, 0x2103, 0x2124,   // 0x2630 (9776) pixels
-0x2104, 0x2944, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3,   // 0x2640 (9792) pixels
-0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x10A2, 0x1081, 0x1081,   // 0x2650 (9808) pixels
-0x1081, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2660 (9824) pixels
-0x10A2, 0x10A2, 0x10A2, 0x0861, 0x1082, 0x1082, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x2670 (9840) pixels
-0x18C2, 0x10C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x10A2, 0x18E3, 0x0841, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861,   // 0x2680 (9856) pixels
-0x1081, 0x1082, 0x1081, 0x1081, 0x1061, 0x1082, 0x1061, 0x1061, 0x0861, 0x0820, 0x0861, 0x18E3, 0x18C3, 0x2124, 0x2945, 0x2944,   // 0x2690 (9872) pixels
-0x18C3, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x1061, 0x18A2, 0x2104, 0x39C7, 0x39A6, 0x3185, 0x3165, 0x4207, 0x4A49, 0x5269, 0x39C6,   // 0x26A0 (9888) pixels
-0x2944, 0x18A2, 0x0820, 0x0841, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x26B0 (9904) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x26C0 (9920) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x26D0 (9936) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0020, 0x1081, 0x2104, 0x39C7,   // 0x26E0 (9952) pixels
-0x4228, 0x4207, 0x39C6, 0x3185, 0x3185, 0x31A6, 0x2965, 0x2944, 0x2124, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0x26F0 (9968) pixels
-0x18E3, 0x20E3, 0x10A2, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1061, 0x1061, 0x0881, 0x1081, 0x1061, 0x0861,   // 0x2700 (9984) pixels
-0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x0841, 0x0861, 0x0861, 0x0881, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2710 (10000) pixels
-0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2720 (10016) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x1061, 0x1082, 0x1081, 0x18C2,   // 0x2730 (10032) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3,   // 0x2740 (10048) pixels
-0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2104,   // 0x2750 (10064) pixels
-0x2104, 0x2124, 0x2103, 0x2124, 0x2904, 0x2924, 0x2123, 0x2123, 0x2924, 0x2924, 0x2924, 0x2923, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x2760 (10080) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2944, 0x39A6, 0x6B0A, 0x9C2F, 0x9C2E, 0x9C4F, 0x838C, 0x2944, 0x2924, 0x2103, 0x2103, 0x2103,   // 0x2770 (10096) pixels
-0x2103, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x18E3, 0x20E3, 0x2103, 0x2103,   // 0x2780 (10112) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3,   // 0x2790 (10128) pixels
-0x10A2, 0x1081, 0x1081, 0x0841, 0x0020, 0x0020, 0x0861, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2,   // 0x27A0 (10144) pixels
-0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x0881, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0x27B0 (10160) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x10A2, 0x1082, 0x10A2, 0x18C3, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841,   // 0x27C0 (10176) pixels
-0x0861, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1061, 0x0861, 0x0841, 0x0020, 0x1082, 0x18E3, 0x2103, 0x2924, 0x2944, 0x2924,   // 0x27D0 (10192) pixels
-0x2104, 0x18C3, 0x18A2, 0x18C3, 0x18C3, 0x1082, 0x1061, 0x1082, 0x20E3, 0x18E3, 0x18C2, 0x2103, 0x39C7, 0x5249, 0x4A28, 0x39E7,   // 0x27E0 (10208) pixels
-0x3165, 0x18A2, 0x0861, 0x0841, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x27F0 (10224) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x2800 (10240) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x2810 (10256) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0020, 0x18A2, 0x2924, 0x39E7,   // 0x2820 (10272) pixels
-0x39E7, 0x41E7, 0x4207, 0x39A6, 0x2944, 0x2104, 0x2104, 0x2124, 0x2124, 0x20E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x20E3,   // 0x2830 (10288) pixels
-0x18E3, 0x2103, 0x10A2, 0x0840, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x0861, 0x0841,   // 0x2840 (10304) pixels
-0x0020, 0x0020, 0x0000, 0x0020, 0x0861, 0x10A2, 0x1082, 0x0861, 0x0881, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2850 (10320) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2860 (10336) pixels
-0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x1082, 0x1082, 0x18A2, 0x18C3, 0x18C2,   // 0x2870 (10352) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x2880 (10368) pixels
-0x20E3, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103,   // 0x2890 (10384) pixels
-0x2124, 0x2123, 0x2123, 0x2124, 0x2924, 0x2924, 0x41E6, 0x4A27, 0x5248, 0x5268, 0x5248, 0x5268, 0x5268, 0x5268, 0x5267, 0x5268,   // 0x28A0 (10400) pixels
-0x5268, 0x5268, 0x5268, 0x5248, 0x5AA9, 0x7B8C, 0xA46F, 0x9C4F, 0x9C2E, 0xA46F, 0x83AC, 0x2944, 0x2124, 0x2103, 0x2104, 0x2103,   // 0x28B0 (10416) pixels
-0x2104, 0x2103, 0x2124, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x28C0 (10432) pixels
-0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0x28D0 (10448) pixels
-0x18C3, 0x18E3, 0x1082, 0x1082, 0x1082, 0x0020, 0x0020, 0x0861, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x28E0 (10464) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3,   // 0x28F0 (10480) pixels
-0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x18E3, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020,   // 0x2900 (10496) pixels
-0x0841, 0x0861, 0x1082, 0x1081, 0x1081, 0x1081, 0x1061, 0x0861, 0x0841, 0x0020, 0x10A2, 0x18E3, 0x2924, 0x2944, 0x2945, 0x2944,   // 0x2910 (10512) pixels
-0x2103, 0x18C2, 0x1082, 0x10A2, 0x18A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x1081, 0x20E3, 0x39C7, 0x4A49, 0x4207, 0x39C7,   // 0x2920 (10528) pixels
-0x3165, 0x18C3, 0x1081, 0x0841, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2930 (10544) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082,   // 0x2940 (10560) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x2950 (10576) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0020, 0x18C3, 0x2104, 0x2944,   // 0x2960 (10592) pixels
-0x2124, 0x31A6, 0x41E7, 0x39C7, 0x2965, 0x20E3, 0x1082, 0x18C2, 0x2104, 0x2944, 0x2965, 0x10A2, 0x1082, 0x20E3, 0x2945, 0x2944,   // 0x2970 (10608) pixels
-0x18C2, 0x10A2, 0x1082, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x1061, 0x0861, 0x0841, 0x0020,   // 0x2980 (10624) pixels
-0x0020, 0x0000, 0x0020, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2990 (10640) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x1082, 0x1081, 0x10C2, 0x10A2, 0x10C3, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x18C2,   // 0x29A0 (10656) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x0861, 0x0840, 0x0020, 0x1082, 0x1082, 0x1081, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0x29B0 (10672) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3,   // 0x29C0 (10688) pixels
-0x2103, 0x2103, 0x2104, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2103, 0x2103, 0x2104, 0x2104, 0x2124,   // 0x29D0 (10704) pixels
-0x2104, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x41C6, 0x83AC, 0xA48F, 0xACB0, 0xACD0, 0xB4D0, 0xACD0, 0xACD0, 0xB4D0, 0xB4F1,   // 0x29E0 (10720) pixels
-0xB4F0, 0xACD0, 0xACD0, 0xB4D0, 0xAC8F, 0xA46F, 0xA46F, 0xA44F, 0xA46F, 0xA46F, 0x8BCD, 0x2944, 0x2924, 0x2104, 0x2924, 0x2123,   // 0x29F0 (10736) pixels
-0x2124, 0x2924, 0x2104, 0x2924, 0x2103, 0x2124, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x2A00 (10752) pixels
-0x2103, 0x18E3, 0x2103, 0x2124, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C3,   // 0x2A10 (10768) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x1081, 0x1082, 0x0861, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x2A20 (10784) pixels
-0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3,   // 0x2A30 (10800) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x1082, 0x0000, 0x0020, 0x0020,   // 0x2A40 (10816) pixels
-0x0020, 0x0840, 0x0841, 0x1081, 0x1061, 0x1081, 0x1061, 0x0861, 0x0841, 0x0020, 0x18C3, 0x2104, 0x2965, 0x3165, 0x2945, 0x2124,   // 0x2A50 (10832) pixels
-0x20E3, 0x1082, 0x0820, 0x0820, 0x0820, 0x0841, 0x1061, 0x1081, 0x18E3, 0x18E3, 0x2924, 0x3185, 0x4207, 0x5269, 0x4A28, 0x41E7,   // 0x2A60 (10848) pixels
-0x3186, 0x20E3, 0x10A2, 0x0840, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x2A70 (10864) pixels
-0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2A80 (10880) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x2A90 (10896) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0861, 0x0861, 0x0841, 0x18C3, 0x18E3, 0x18E3,   // 0x2AA0 (10912) pixels
-0x2104, 0x31A6, 0x39A6, 0x39C7, 0x3186, 0x2124, 0x1061, 0x0841, 0x1082, 0x2104, 0x18C3, 0x0861, 0x1082, 0x2944, 0x3165, 0x2945,   // 0x2AB0 (10928) pixels
-0x18C3, 0x0861, 0x0881, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0881, 0x0881, 0x1081, 0x1081, 0x0841, 0x0020, 0x0020,   // 0x2AC0 (10944) pixels
-0x0000, 0x0020, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2AD0 (10960) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10C3, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2AE0 (10976) pixels
-0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x1082, 0x1082, 0x1082, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0x2AF0 (10992) pixels
-0x18E3, 0x18E3, 0x18E2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103,   // 0x2B00 (11008) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2123, 0x2123, 0x2924, 0x2124, 0x2923, 0x2924, 0x2924, 0x2123, 0x2124,   // 0x2B10 (11024) pixels
-0x2124, 0x2124, 0x2104, 0x2944, 0x2924, 0x2924, 0x2944, 0x3185, 0x93EE, 0xACAF, 0xB4F0, 0xB4F0, 0xB4D0, 0xB4F0, 0xB4D0, 0xB4F0,   // 0x2B20 (11040) pixels
-0xB4F0, 0xB4F1, 0xB4F0, 0xB4CF, 0xB4CF, 0xACAF, 0xB4D0, 0xACAF, 0xAC6F, 0xAC6F, 0x62C9, 0x2924, 0x2924, 0x2924, 0x2944, 0x2124,   // 0x2B30 (11056) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2103, 0x2124, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x2B40 (11072) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3,   // 0x2B50 (11088) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x1061, 0x1082, 0x1082, 0x0000, 0x0020, 0x0841, 0x1081, 0x1082, 0x1082,   // 0x2B60 (11104) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x18C3,   // 0x2B70 (11120) pixels
-0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x0881, 0x10A2, 0x0000, 0x0000,   // 0x2B80 (11136) pixels
-0x0020, 0x0020, 0x0820, 0x0841, 0x0861, 0x1061, 0x1061, 0x0841, 0x0840, 0x0020, 0x18C3, 0x2124, 0x3165, 0x2924, 0x20E3, 0x18C2,   // 0x2B90 (11152) pixels
-0x2924, 0x2945, 0x20E3, 0x18A2, 0x1082, 0x1082, 0x1061, 0x18A2, 0x3165, 0x3165, 0x41E7, 0x4A68, 0x5A8A, 0x5ACB, 0x5269, 0x4207,   // 0x2BA0 (11168) pixels
-0x31A6, 0x2103, 0x18C3, 0x0840, 0x1081, 0x1082, 0x1081, 0x1061, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2BB0 (11184) pixels
-0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082,   // 0x2BC0 (11200) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x2BD0 (11216) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0840, 0x0840, 0x0861, 0x0861, 0x0841, 0x18A2, 0x10A2, 0x18C2,   // 0x2BE0 (11232) pixels
-0x2103, 0x39A6, 0x3186, 0x2944, 0x3185, 0x2124, 0x18C2, 0x0841, 0x0841, 0x10A2, 0x1081, 0x1082, 0x2124, 0x3185, 0x31A6, 0x2965,   // 0x2BF0 (11248) pixels
-0x18E3, 0x1081, 0x0861, 0x0881, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0820, 0x0020, 0x0000,   // 0x2C00 (11264) pixels
-0x0020, 0x1081, 0x18C2, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2,   // 0x2C10 (11280) pixels
-0x10C2, 0x10A2, 0x10A2, 0x1082, 0x1081, 0x18A2, 0x10A2, 0x10A2, 0x10C2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x2C20 (11296) pixels
-0x10A2, 0x10A2, 0x10A2, 0x0020, 0x1082, 0x1082, 0x1081, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x2103, 0x18C2, 0x18C2, 0x18C3, 0x18E3,   // 0x2C30 (11312) pixels
-0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x2C40 (11328) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2124, 0x2124, 0x2924, 0x2923, 0x2944, 0x2924, 0x2924, 0x2124, 0x2124,   // 0x2C50 (11344) pixels
-0x2924, 0x2924, 0x2124, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x5227, 0x7B4B, 0x8BCC, 0x8BCC, 0x8BCC, 0x8BCC, 0x8BCC, 0x8BAC,   // 0x2C60 (11360) pixels
-0x8BAC, 0x8BAC, 0x83AC, 0x83AC, 0x83AC, 0x8BAC, 0x8BAC, 0x83AC, 0x838C, 0x6AEA, 0x3985, 0x3144, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x2C70 (11376) pixels
-0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2104, 0x2124, 0x2124, 0x2104, 0x2103, 0x2904, 0x2103, 0x2103, 0x2123, 0x2103,   // 0x2C80 (11392) pixels
-0x2124, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E2, 0x18E3,   // 0x2C90 (11408) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x1082, 0x1081, 0x1082, 0x0861, 0x0020, 0x0861, 0x1082, 0x1082,   // 0x2CA0 (11424) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C2,   // 0x2CB0 (11440) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1081, 0x0000,   // 0x2CC0 (11456) pixels
-0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x1061, 0x0861, 0x0841, 0x0840, 0x0020, 0x18A2, 0x2103, 0x2924, 0x20E3, 0x18C3, 0x20E3,   // 0x2CD0 (11472) pixels
-0x3185, 0x4207, 0x39C6, 0x2104, 0x18C3, 0x18C3, 0x18A2, 0x1082, 0x2103, 0x2944, 0x39C7, 0x4A28, 0x528A, 0x5A8A, 0x526A, 0x4207,   // 0x2CE0 (11488) pixels
-0x39A6, 0x2124, 0x10A2, 0x0841, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x2CF0 (11504) pixels
-0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2D00 (11520) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x2D10 (11536) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0840, 0x0840, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x2104,   // 0x2D20 (11552) pixels
-0x2124, 0x39A6, 0x31A6, 0x18A2, 0x2945, 0x31A6, 0x2944, 0x1081, 0x0841, 0x0841, 0x18E3, 0x39C6, 0x4A48, 0x4A28, 0x41E7, 0x3165,   // 0x2D30 (11568) pixels
-0x18C2, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020,   // 0x2D40 (11584) pixels
-0x10A2, 0x18C2, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C2, 0x18C2,   // 0x2D50 (11600) pixels
-0x10A2, 0x10A2, 0x1082, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x1082, 0x1082,   // 0x2D60 (11616) pixels
-0x0861, 0x0020, 0x10A2, 0x1082, 0x1082, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,   // 0x2D70 (11632) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2104, 0x2103, 0x20E3, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103,   // 0x2D80 (11648) pixels
-0x2103, 0x2104, 0x2124, 0x2104, 0x2924, 0x2124, 0x2124, 0x2123, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124,   // 0x2D90 (11664) pixels
-0x2924, 0x2124, 0x2944, 0x2124, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x2DA0 (11680) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x2DB0 (11696) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2923, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924, 0x2903, 0x2924,   // 0x2DC0 (11712) pixels
-0x2103, 0x2924, 0x2944, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3,   // 0x2DD0 (11728) pixels
-0x20E3, 0x18C3, 0x18E3, 0x18C2, 0x18C3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1081, 0x1081, 0x1061, 0x0020, 0x0840,   // 0x2DE0 (11744) pixels
-0x0861, 0x1081, 0x1081, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x1082, 0x10A2,   // 0x2DF0 (11760) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x18E3,   // 0x2E00 (11776) pixels
-0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0841, 0x0861, 0x0841, 0x0840, 0x0020, 0x0861, 0x2103, 0x20E3, 0x18C3, 0x18A2, 0x20E3,   // 0x2E10 (11792) pixels
-0x2945, 0x2924, 0x2104, 0x20E3, 0x20E3, 0x20E3, 0x18A2, 0x1081, 0x18C3, 0x2924, 0x31A6, 0x4207, 0x528A, 0x528A, 0x5269, 0x4208,   // 0x2E20 (11808) pixels
-0x3185, 0x18E3, 0x0841, 0x0841, 0x1061, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2E30 (11824) pixels
-0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082,   // 0x2E40 (11840) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x2E50 (11856) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0840, 0x0840, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x2124,   // 0x2E60 (11872) pixels
-0x2965, 0x39A6, 0x39A6, 0x2104, 0x2945, 0x2924, 0x10A2, 0x0841, 0x0841, 0x0841, 0x2104, 0x39E7, 0x5269, 0x4228, 0x39C7, 0x2945,   // 0x2E70 (11888) pixels
-0x18E3, 0x0861, 0x0841, 0x0820, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020, 0x1081,   // 0x2E80 (11904) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10C2, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x10A2,   // 0x2E90 (11920) pixels
-0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10C2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x0881, 0x0841, 0x0020,   // 0x2EA0 (11936) pixels
-0x0861, 0x1082, 0x1082, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x18E3,   // 0x2EB0 (11952) pixels
-0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2124,   // 0x2EC0 (11968) pixels
-0x2103, 0x2103, 0x2124, 0x2123, 0x2123, 0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2124,   // 0x2ED0 (11984) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x2EE0 (12000) pixels
-0x3164, 0x3144, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x3165, 0x2944, 0x2924, 0x2924, 0x3144, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x2EF0 (12016) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2904,   // 0x2F00 (12032) pixels
-0x2924, 0x2904, 0x2924, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3,   // 0x2F10 (12048) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x10A2, 0x1081, 0x1082, 0x0820,   // 0x2F20 (12064) pixels
-0x0020, 0x0841, 0x0861, 0x1081, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x0861, 0x1082,   // 0x2F30 (12080) pixels
-0x10A2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x10A2,   // 0x2F40 (12096) pixels
-0x18C2, 0x0000, 0x0020, 0x0020, 0x0020, 0x0820, 0x0841, 0x0841, 0x0841, 0x0020, 0x0841, 0x20E3, 0x2103, 0x2104, 0x2104, 0x2104,   // 0x2F50 (12112) pixels
-0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x2104, 0x2924, 0x20E3, 0x18C2, 0x2124, 0x3165, 0x39C6, 0x41E7, 0x4A49, 0x5269, 0x5269, 0x41E7,   // 0x2F60 (12128) pixels
-0x3185, 0x18A2, 0x0020, 0x0841, 0x1081, 0x1061, 0x1081, 0x1061, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2F70 (12144) pixels
-0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x2F80 (12160) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x2F90 (12176) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x18C2, 0x2124,   // 0x2FA0 (12192) pixels
-0x2945, 0x3186, 0x3186, 0x2104, 0x1082, 0x0861, 0x0841, 0x0861, 0x18A2, 0x10A2, 0x18E3, 0x31A6, 0x4207, 0x39E7, 0x39C7, 0x3186,   // 0x2FB0 (12208) pixels
-0x2104, 0x10A2, 0x1062, 0x0020, 0x0841, 0x0841, 0x0861, 0x1061, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x1082, 0x10A2,   // 0x2FC0 (12224) pixels
-0x1082, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x18C3, 0x18C3, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x2FD0 (12240) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x1081, 0x1082,   // 0x2FE0 (12256) pixels
-0x1081, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3,   // 0x2FF0 (12272) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2944, 0x2104, 0x2103, 0x2104, 0x2103, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924,   // 0x3000 (12288) pixels
-0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x3010 (12304) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x3165, 0x39A6, 0x3985, 0x39A5, 0x3185, 0x39A6, 0x39A6,   // 0x3020 (12320) pixels
-0x39A5, 0x39A6, 0x31A6, 0x31A6, 0x3185, 0x39A6, 0x31A6, 0x3185, 0x39A6, 0x3185, 0x39A6, 0x3985, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x3030 (12336) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2944, 0x2924,   // 0x3040 (12352) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3,   // 0x3050 (12368) pixels
-0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x1081,   // 0x3060 (12384) pixels
-0x1082, 0x0841, 0x0840, 0x0861, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3070 (12400) pixels
-0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0x3080 (12416) pixels
-0x1081, 0x18C2, 0x0020, 0x0020, 0x0000, 0x0020, 0x0820, 0x0840, 0x0841, 0x0820, 0x0020, 0x18C2, 0x2104, 0x2944, 0x2945, 0x2124,   // 0x3090 (12432) pixels
-0x1082, 0x18C3, 0x18C3, 0x18E3, 0x3165, 0x31A6, 0x3186, 0x3165, 0x39A6, 0x39C7, 0x39E7, 0x39C7, 0x4207, 0x4A49, 0x4A29, 0x3186,   // 0x30A0 (12448) pixels
-0x2104, 0x0840, 0x0820, 0x0841, 0x1082, 0x1061, 0x1081, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x30B0 (12464) pixels
-0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x10A2, 0x1082,   // 0x30C0 (12480) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x30D0 (12496) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0020, 0x18A2, 0x18E3, 0x2924,   // 0x30E0 (12512) pixels
-0x2944, 0x2965, 0x3165, 0x20E3, 0x1081, 0x0841, 0x1082, 0x2924, 0x2944, 0x18E3, 0x1081, 0x2124, 0x39A6, 0x41E7, 0x41E7, 0x39C6,   // 0x30F0 (12528) pixels
-0x2124, 0x10A2, 0x1082, 0x0020, 0x0841, 0x0841, 0x0861, 0x1061, 0x0841, 0x0820, 0x0020, 0x0000, 0x0000, 0x0020, 0x10A2, 0x1082,   // 0x3100 (12544) pixels
-0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x10A2,   // 0x3110 (12560) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x1082, 0x0020, 0x10A2, 0x1082, 0x18C3,   // 0x3120 (12576) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x2103,   // 0x3130 (12592) pixels
-0x2103, 0x2103, 0x2103, 0x2104, 0x2944, 0x2124, 0x2104, 0x2104, 0x2904, 0x2924, 0x2104, 0x2124, 0x2124, 0x2924, 0x2104, 0x2924,   // 0x3140 (12608) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944,   // 0x3150 (12624) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x3160 (12640) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x3170 (12656) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x3180 (12672) pixels
-0x2924, 0x2944, 0x2924, 0x2903, 0x2924, 0x2104, 0x2103, 0x2124, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x3190 (12688) pixels
-0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3,   // 0x31A0 (12704) pixels
-0x1082, 0x1082, 0x10A2, 0x0840, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x31B0 (12720) pixels
-0x1082, 0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0x31C0 (12736) pixels
-0x18A2, 0x1082, 0x18E3, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0020, 0x0861, 0x2124, 0x2945, 0x2965, 0x2124,   // 0x31D0 (12752) pixels
-0x18C2, 0x18E3, 0x2104, 0x2965, 0x39A6, 0x39C7, 0x4227, 0x4207, 0x4A28, 0x41E7, 0x39C6, 0x39C6, 0x39C7, 0x4207, 0x4208, 0x2104,   // 0x31E0 (12768) pixels
-0x18C2, 0x0020, 0x0841, 0x0861, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x31F0 (12784) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x3200 (12800) pixels
-0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3210 (12816) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0861, 0x0861, 0x0020, 0x18C2, 0x2103, 0x2124,   // 0x3220 (12832) pixels
-0x2124, 0x2124, 0x20E3, 0x18E3, 0x2124, 0x2124, 0x20E3, 0x2945, 0x2944, 0x2104, 0x10A2, 0x1082, 0x2104, 0x41E7, 0x39C7, 0x39C6,   // 0x3230 (12848) pixels
-0x2104, 0x18C3, 0x0861, 0x0020, 0x0841, 0x0861, 0x0861, 0x0841, 0x0820, 0x0020, 0x0000, 0x0000, 0x0020, 0x10A2, 0x1082, 0x10A2,   // 0x3240 (12864) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10C2,   // 0x3250 (12880) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1061, 0x0040, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x18C2,   // 0x3260 (12896) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x3270 (12912) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2924, 0x2103, 0x2123, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924,   // 0x3280 (12928) pixels
-0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x3290 (12944) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x32A0 (12960) pixels
-0x2944, 0x2944, 0x3145, 0x2945, 0x2924, 0x2944, 0x2944, 0x3165, 0x2944, 0x2945, 0x2945, 0x2945, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x32B0 (12976) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x32C0 (12992) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2924, 0x2124, 0x2103, 0x2103, 0x2103,   // 0x32D0 (13008) pixels
-0x2103, 0x2124, 0x2104, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x32E0 (13024) pixels
-0x18C3, 0x18E3, 0x1082, 0x1082, 0x0840, 0x0020, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x32F0 (13040) pixels
-0x1082, 0x10A2, 0x1061, 0x0861, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3,   // 0x3300 (13056) pixels
-0x18C3, 0x18C3, 0x18A2, 0x18E3, 0x0861, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x18C2, 0x2103, 0x2103, 0x18E3,   // 0x3310 (13072) pixels
-0x18E3, 0x2124, 0x2944, 0x2965, 0x31A6, 0x41E7, 0x39C6, 0x39A6, 0x4207, 0x41E7, 0x39C7, 0x39A6, 0x39A6, 0x2945, 0x2104, 0x20E3,   // 0x3320 (13088) pixels
-0x0840, 0x0841, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1061, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3330 (13104) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x3340 (13120) pixels
-0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3350 (13136) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0861, 0x0861, 0x0861, 0x0861, 0x18C3, 0x20E3,   // 0x3360 (13152) pixels
-0x2104, 0x20E3, 0x18E3, 0x2104, 0x2924, 0x2103, 0x2104, 0x2104, 0x2104, 0x2104, 0x2924, 0x3165, 0x39C7, 0x31A6, 0x39A6, 0x3185,   // 0x3370 (13168) pixels
-0x18E3, 0x18C3, 0x0020, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x18C3, 0x18C3, 0x1082, 0x10A2, 0x10C2,   // 0x3380 (13184) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2,   // 0x3390 (13200) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0040, 0x0020, 0x1082, 0x1082, 0x18E3, 0x18C2, 0x18C3, 0x18C3,   // 0x33A0 (13216) pixels
-0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2104,   // 0x33B0 (13232) pixels
-0x2103, 0x2103, 0x2104, 0x2124, 0x2124, 0x2924, 0x2124, 0x2944, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x33C0 (13248) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x3165, 0x3185, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x33D0 (13264) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944,   // 0x33E0 (13280) pixels
-0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x33F0 (13296) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x3144, 0x2924, 0x2924, 0x2944, 0x3145, 0x2924, 0x2924, 0x3145, 0x2944, 0x2924,   // 0x3400 (13312) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2104, 0x2103, 0x2103,   // 0x3410 (13328) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C2,   // 0x3420 (13344) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x1081, 0x1082, 0x0020, 0x0020, 0x0841, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3430 (13360) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x1081, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3,   // 0x3440 (13376) pixels
-0x18E3, 0x18C3, 0x18C3, 0x18A2, 0x10A2, 0x0881, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x10A2, 0x2104, 0x2103,   // 0x3450 (13392) pixels
-0x18E3, 0x2944, 0x2944, 0x2945, 0x2965, 0x39A6, 0x39E7, 0x41E7, 0x41E7, 0x39C6, 0x39C7, 0x31A6, 0x2944, 0x2945, 0x2924, 0x0841,   // 0x3460 (13408) pixels
-0x0841, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3470 (13424) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x3480 (13440) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3490 (13456) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x1061, 0x0861, 0x0020, 0x1061, 0x10A2,   // 0x34A0 (13472) pixels
-0x18C2, 0x18C3, 0x18E3, 0x2104, 0x2104, 0x18C3, 0x1082, 0x10A2, 0x2103, 0x2124, 0x2965, 0x2965, 0x2965, 0x2945, 0x2965, 0x2124,   // 0x34B0 (13488) pixels
-0x18E3, 0x10A2, 0x0020, 0x0861, 0x0841, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0841, 0x18E3, 0x18C3, 0x10A2, 0x10A2, 0x10C2,   // 0x34C0 (13504) pixels
-0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x18C2, 0x18C2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2,   // 0x34D0 (13520) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0840, 0x1081, 0x1082, 0x10A2, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0x34E0 (13536) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104,   // 0x34F0 (13552) pixels
-0x2104, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2944, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924,   // 0x3500 (13568) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2945, 0x2944,   // 0x3510 (13584) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2964, 0x3144,   // 0x3520 (13600) pixels
-0x3164, 0x2944, 0x3144, 0x3165, 0x3165, 0x3165, 0x3165, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944,   // 0x3530 (13616) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2964, 0x2944, 0x2924, 0x3165, 0x2924, 0x2924,   // 0x3540 (13632) pixels
-0x2924, 0x2944, 0x2944, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2103, 0x2104, 0x2103,   // 0x3550 (13648) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2,   // 0x3560 (13664) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x1061, 0x1082, 0x0841, 0x0020, 0x0841, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3570 (13680) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x0881, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3,   // 0x3580 (13696) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x18C2, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x18C2, 0x2104,   // 0x3590 (13712) pixels
-0x2124, 0x2945, 0x2944, 0x2944, 0x2124, 0x3185, 0x31A6, 0x39A6, 0x39A6, 0x31A6, 0x3165, 0x2945, 0x3165, 0x3186, 0x2103, 0x0840,   // 0x35A0 (13728) pixels
-0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x35B0 (13744) pixels
-0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x35C0 (13760) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x35D0 (13776) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0020, 0x0000, 0x0861,   // 0x35E0 (13792) pixels
-0x0861, 0x10A2, 0x18E3, 0x18C3, 0x10A2, 0x0841, 0x1082, 0x18C3, 0x2103, 0x2944, 0x3185, 0x2965, 0x2124, 0x2124, 0x2124, 0x18E3,   // 0x35F0 (13808) pixels
-0x0861, 0x0020, 0x0861, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x1082, 0x18C3, 0x18E3, 0x18E3, 0x10C2, 0x10A2, 0x10C2,   // 0x3600 (13824) pixels
-0x10C2, 0x18C2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x18C3,   // 0x3610 (13840) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x10A2, 0x1061, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3,   // 0x3620 (13856) pixels
-0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2904, 0x2124, 0x2103, 0x2124, 0x2124,   // 0x3630 (13872) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2923, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944,   // 0x3640 (13888) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3145, 0x2945, 0x2964, 0x2944, 0x2944,   // 0x3650 (13904) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x3144, 0x3164, 0x3165, 0x3165,   // 0x3660 (13920) pixels
-0x3165, 0x3165, 0x3165, 0x3165, 0x3165, 0x3165, 0x3165, 0x3165, 0x3144, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2965, 0x2945,   // 0x3670 (13936) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2924, 0x3185, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944,   // 0x3680 (13952) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x3690 (13968) pixels
-0x2924, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x20E3, 0x2924, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3,   // 0x36A0 (13984) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1081, 0x1082, 0x0820, 0x0840, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x36B0 (14000) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x18E3, 0x18C2, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C3,   // 0x36C0 (14016) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x18C2, 0x1082, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0841,   // 0x36D0 (14032) pixels
-0x18E3, 0x2124, 0x2104, 0x2103, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x20E3, 0x2103, 0x2103, 0x0861, 0x0820, 0x0841,   // 0x36E0 (14048) pixels
-0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x36F0 (14064) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x3700 (14080) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x1061, 0x0861, 0x0861, 0x1061,   // 0x3710 (14096) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x0861, 0x0020, 0x0020,   // 0x3720 (14112) pixels
-0x0841, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x18C3, 0x2103, 0x2124, 0x2965, 0x3185, 0x2945, 0x2924, 0x2104, 0x2104, 0x10A2,   // 0x3730 (14128) pixels
-0x0020, 0x0020, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10C2,   // 0x3740 (14144) pixels
-0x18C3, 0x18C3, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18E3,   // 0x3750 (14160) pixels
-0x10C2, 0x10A2, 0x10A2, 0x1081, 0x0841, 0x0861, 0x1082, 0x1081, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3,   // 0x3760 (14176) pixels
-0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2104, 0x2104, 0x2103, 0x2104, 0x2103, 0x2104, 0x2924, 0x2924, 0x2924,   // 0x3770 (14192) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x3780 (14208) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2964, 0x2944, 0x2944,   // 0x3790 (14224) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3985, 0x3144, 0x3144, 0x41C6, 0x5247, 0x3985, 0x3164, 0x3164, 0x41E6, 0x5AA9, 0x39A5,   // 0x37A0 (14240) pixels
-0x3164, 0x3185, 0x5227, 0x62C9, 0x62A9, 0x5A89, 0x4A07, 0x3165, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x37B0 (14256) pixels
-0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x37C0 (14272) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924,   // 0x37D0 (14288) pixels
-0x2924, 0x2104, 0x2124, 0x2104, 0x2103, 0x2104, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x18E3, 0x20E3, 0x18E3,   // 0x37E0 (14304) pixels
-0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x1081, 0x1082, 0x0820, 0x0820, 0x0861, 0x1081, 0x1082, 0x1082,   // 0x37F0 (14320) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x0881, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3,   // 0x3800 (14336) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x18A2, 0x18C2, 0x10A2, 0x18C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020,   // 0x3810 (14352) pixels
-0x0841, 0x10A2, 0x18C3, 0x18E3, 0x18C3, 0x2104, 0x2944, 0x2124, 0x20E3, 0x2103, 0x18C3, 0x1082, 0x0840, 0x0841, 0x0841, 0x0861,   // 0x3820 (14368) pixels
-0x1061, 0x1082, 0x1082, 0x1081, 0x1082, 0x1061, 0x1062, 0x1082, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x3830 (14384) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082,   // 0x3840 (14400) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3850 (14416) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020,   // 0x3860 (14432) pixels
-0x0000, 0x0020, 0x0841, 0x0861, 0x0861, 0x10A2, 0x2924, 0x2104, 0x2944, 0x3186, 0x3186, 0x2104, 0x18E3, 0x18C3, 0x10A2, 0x0020,   // 0x3870 (14448) pixels
-0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10C2, 0x18C3,   // 0x3880 (14464) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3,   // 0x3890 (14480) pixels
-0x10A2, 0x1082, 0x0861, 0x0841, 0x10A2, 0x1081, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x20E3,   // 0x38A0 (14496) pixels
-0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2124, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924,   // 0x38B0 (14512) pixels
-0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x38C0 (14528) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2964, 0x2964, 0x3144, 0x3144, 0x3144, 0x2944, 0x3144, 0x3164, 0x3165, 0x3185, 0x3144, 0x3144,   // 0x38D0 (14544) pixels
-0x3144, 0x2964, 0x2944, 0x3165, 0x5A88, 0xACAF, 0x3144, 0x2944, 0x730A, 0xBD52, 0x83AC, 0x39C6, 0x3185, 0x6AE9, 0xB4F0, 0x4A27,   // 0x38E0 (14560) pixels
-0x3164, 0x41C6, 0xA48F, 0xACAF, 0x8BCC, 0x9C4E, 0x8BED, 0x3185, 0x3165, 0x3165, 0x4A27, 0x93ED, 0xA48F, 0x838C, 0x4A07, 0x3164,   // 0x38F0 (14576) pixels
-0x2944, 0x3144, 0x3144, 0x3165, 0x3144, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x3900 (14592) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x3910 (14608) pixels
-0x2924, 0x2924, 0x2124, 0x2104, 0x2904, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x2945,   // 0x3920 (14624) pixels
-0x2945, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x1082, 0x1082, 0x0020, 0x0840, 0x0861, 0x1081,   // 0x3930 (14640) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0x3940 (14656) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x1082, 0x18C2, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020,   // 0x3950 (14672) pixels
-0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x1061, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x0840, 0x0840, 0x0861, 0x1082, 0x1081, 0x1061,   // 0x3960 (14688) pixels
-0x1082, 0x1082, 0x1062, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x3970 (14704) pixels
-0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082,   // 0x3980 (14720) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3990 (14736) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x39A0 (14752) pixels
-0x0861, 0x0020, 0x0000, 0x0020, 0x0841, 0x10A2, 0x18E3, 0x18E3, 0x20E3, 0x2104, 0x18E3, 0x1082, 0x0841, 0x0020, 0x0020, 0x0861,   // 0x39B0 (14768) pixels
-0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x18C2, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C3, 0x10C2,   // 0x39C0 (14784) pixels
-0x18C2, 0x10C2, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2,   // 0x39D0 (14800) pixels
-0x10A2, 0x0040, 0x10A2, 0x1082, 0x10A2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x20E3,   // 0x39E0 (14816) pixels
-0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2124, 0x2104, 0x2104, 0x2904, 0x2124, 0x2124, 0x2924, 0x2924, 0x2123, 0x2924, 0x2924,   // 0x39F0 (14832) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x3A00 (14848) pixels
-0x2944, 0x2944, 0x2945, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3985, 0x3164, 0x2944, 0x3164, 0x5268, 0x9C4F, 0x5A68, 0x3144,   // 0x3A10 (14864) pixels
-0x3144, 0x2964, 0x2944, 0x3144, 0x5A88, 0xBD11, 0x41E7, 0x3165, 0x6B0A, 0xB4D0, 0xCD92, 0x9C4F, 0x39A5, 0x62C9, 0xB4D0, 0x5227,   // 0x3A20 (14880) pixels
-0x3164, 0x41C6, 0xACAF, 0x62C9, 0x3144, 0x3144, 0x3144, 0x3164, 0x3985, 0x8BAD, 0xB511, 0x7B6B, 0x6AEA, 0x93ED, 0xBD31, 0x83AC,   // 0x3A30 (14896) pixels
-0x3164, 0x3164, 0x39A5, 0x7B4B, 0x6AEA, 0x62A9, 0x39A6, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x3A40 (14912) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x3A50 (14928) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2104, 0x2124, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x3A60 (14944) pixels
-0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x1081, 0x1082, 0x1081, 0x0020, 0x1061,   // 0x3A70 (14960) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18C3,   // 0x3A80 (14976) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x18C2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0020,   // 0x3A90 (14992) pixels
-0x0020, 0x0820, 0x0840, 0x0840, 0x0840, 0x0840, 0x0820, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x1061, 0x1081, 0x1081, 0x1081,   // 0x3AA0 (15008) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082,   // 0x3AB0 (15024) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082,   // 0x3AC0 (15040) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3AD0 (15056) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3AE0 (15072) pixels
-0x0861, 0x0861, 0x0020, 0x0000, 0x0020, 0x0841, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0020, 0x0020, 0x0020, 0x0861, 0x0861,   // 0x3AF0 (15088) pixels
-0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10C2, 0x18C3,   // 0x3B00 (15104) pixels
-0x10C2, 0x10C2, 0x18C2, 0x10A2, 0x10A2, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861,   // 0x3B10 (15120) pixels
-0x0041, 0x10A2, 0x1082, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103,   // 0x3B20 (15136) pixels
-0x20E3, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x3B30 (15152) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x3B40 (15168) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x5248, 0x8BCD, 0x39A5, 0x3145, 0x3164, 0x5227, 0xA46F, 0x7B4B, 0x3165,   // 0x3B50 (15184) pixels
-0x2944, 0x2964, 0x3165, 0x2965, 0x5A88, 0xBD31, 0x49E7, 0x3185, 0x730A, 0xBD31, 0x9C2E, 0xC572, 0x5247, 0x6AE9, 0xB4F1, 0x5227,   // 0x3B60 (15200) pixels
-0x3164, 0x41C6, 0xACB0, 0x6AC9, 0x3164, 0x3164, 0x3164, 0x3164, 0x62C9, 0xACD0, 0x7B6B, 0x3165, 0x2965, 0x39A5, 0x732B, 0xB4F0,   // 0x3B70 (15216) pixels
-0x3185, 0x3165, 0x4A07, 0xBD11, 0xB4F1, 0xACB0, 0x8BED, 0x49E7, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2964, 0x2944,   // 0x3B80 (15232) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924,   // 0x3B90 (15248) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2103, 0x2124, 0x2103, 0x2104, 0x2104, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x3BA0 (15264) pixels
-0x20E3, 0x2103, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x1081, 0x10A2, 0x0820,   // 0x3BB0 (15280) pixels
-0x1081, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10C2, 0x1061, 0x1082, 0x10A2, 0x18C2, 0x18C2,   // 0x3BC0 (15296) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18A2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x18C2, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x3BD0 (15312) pixels
-0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1082, 0x1081,   // 0x3BE0 (15328) pixels
-0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x3BF0 (15344) pixels
-0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1081,   // 0x3C00 (15360) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3C10 (15376) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3C20 (15392) pixels
-0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x0861, 0x0861, 0x1081, 0x0841,   // 0x3C30 (15408) pixels
-0x0020, 0x0000, 0x0000, 0x0000, 0x18C2, 0x1082, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10C3, 0x10C3, 0x10A2, 0x10C2, 0x10C2, 0x10C2,   // 0x3C40 (15424) pixels
-0x18C3, 0x18C3, 0x10A2, 0x1082, 0x1081, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0041,   // 0x3C50 (15440) pixels
-0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x3C60 (15456) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2924,   // 0x3C70 (15472) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144,   // 0x3C80 (15488) pixels
-0x3164, 0x41C6, 0x730A, 0xA46F, 0x940D, 0x62A8, 0x2944, 0x5A68, 0xB4B0, 0x5A88, 0x3165, 0x3145, 0x3144, 0x8BAC, 0x93ED, 0x3165,   // 0x3C90 (15504) pixels
-0x3164, 0x2944, 0x2944, 0x3144, 0x41E7, 0xC553, 0x41E6, 0x3164, 0x6ACA, 0xB4F1, 0x41E6, 0x7B4B, 0xBD31, 0x732A, 0xB4CF, 0x4A27,   // 0x3CA0 (15520) pixels
-0x3165, 0x41E6, 0xB510, 0xAC6F, 0x9C2E, 0x940E, 0x4A27, 0x2944, 0x9C2E, 0xB4D0, 0x3164, 0x3164, 0x2964, 0x3164, 0x39A5, 0xB4CF,   // 0x3CB0 (15536) pixels
-0x5A68, 0x3165, 0x6B0A, 0xBD32, 0x4A07, 0x3985, 0x9C2E, 0xB4D0, 0x39C6, 0x3164, 0x39A5, 0x732B, 0x5A88, 0x3165, 0x2944, 0x3144,   // 0x3CC0 (15552) pixels
-0x3144, 0x3144, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x3CD0 (15568) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2103, 0x2124, 0x2924, 0x2104, 0x2103, 0x2103,   // 0x3CE0 (15584) pixels
-0x2103, 0x2103, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x1081, 0x1082,   // 0x3CF0 (15600) pixels
-0x0020, 0x0841, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x1082, 0x10A2, 0x18C3,   // 0x3D00 (15616) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x1081, 0x1082, 0x0000, 0x0000, 0x0020,   // 0x3D10 (15632) pixels
-0x0020, 0x0840, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081,   // 0x3D20 (15648) pixels
-0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x10A2, 0x18C2, 0x18A2, 0x10A2,   // 0x3D30 (15664) pixels
-0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x3D40 (15680) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3D50 (15696) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3D60 (15712) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1062, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020,   // 0x3D70 (15728) pixels
-0x0020, 0x0000, 0x0000, 0x0841, 0x10A2, 0x1082, 0x10A2, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10C2, 0x18C3, 0x18C3, 0x10C2, 0x10A2,   // 0x3D80 (15744) pixels
-0x18C2, 0x18C3, 0x10A2, 0x0881, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x10A2,   // 0x3D90 (15760) pixels
-0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103,   // 0x3DA0 (15776) pixels
-0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124,   // 0x3DB0 (15792) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144,   // 0x3DC0 (15808) pixels
-0x41E6, 0x8BCC, 0xB4F0, 0x9C2E, 0x7B4A, 0x4A27, 0x2944, 0x41E6, 0x9C0E, 0x83CD, 0x3185, 0x3165, 0x4A07, 0x9C0E, 0xACAF, 0x3185,   // 0x3DD0 (15824) pixels
-0x3144, 0x2944, 0x2944, 0x3165, 0x3985, 0xC553, 0x5247, 0x3144, 0x6AC9, 0xB511, 0x39C6, 0x5227, 0xBD32, 0x93ED, 0xB4D0, 0x5227,   // 0x3DE0 (15840) pixels
-0x3165, 0x41E6, 0xBD10, 0x9C2E, 0x93ED, 0x8BCD, 0x41E6, 0x3164, 0x9C2E, 0xB4D0, 0x3164, 0x3164, 0x3165, 0x3165, 0x39A5, 0xACAF,   // 0x3DF0 (15856) pixels
-0x5AA9, 0x3165, 0x940E, 0xB4D0, 0x39A5, 0x3165, 0x6AE9, 0xB4CF, 0x49E7, 0x3164, 0x6AE9, 0xC593, 0x9C6F, 0x3165, 0x3144, 0x2944,   // 0x3E00 (15872) pixels
-0x3144, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x3145, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924,   // 0x3E10 (15888) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2903, 0x2124, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x3E20 (15904) pixels
-0x2104, 0x2103, 0x2103, 0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x1081,   // 0x3E30 (15920) pixels
-0x1082, 0x0020, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1061, 0x10A2, 0x10A2,   // 0x3E40 (15936) pixels
-0x18A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x0881, 0x0000, 0x0000,   // 0x3E50 (15952) pixels
-0x0020, 0x0020, 0x0820, 0x0861, 0x1061, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x3E60 (15968) pixels
-0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x18A2, 0x18C2, 0x10A2, 0x10A2,   // 0x3E70 (15984) pixels
-0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2,   // 0x3E80 (16000) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3E90 (16016) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3EA0 (16032) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x0861, 0x1061, 0x0841, 0x0020, 0x0020,   // 0x3EB0 (16048) pixels
-0x0000, 0x0000, 0x10A2, 0x18C2, 0x10C2, 0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x10C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0x3EC0 (16064) pixels
-0x10A2, 0x10A2, 0x0882, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x18C2,   // 0x3ED0 (16080) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104,   // 0x3EE0 (16096) pixels
-0x2124, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2944, 0x2924,   // 0x3EF0 (16112) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x41E6, 0x6AEA, 0xA44F, 0x49E7, 0x3165,   // 0x3F00 (16128) pixels
-0x9C0E, 0xACAF, 0x39C6, 0x2964, 0x3165, 0x3165, 0x3164, 0x3144, 0x7B2A, 0xB511, 0xAC90, 0xB4F0, 0xBCF0, 0xB4F0, 0xB4F0, 0x5A48,   // 0x3F10 (16144) pixels
-0x3144, 0x2944, 0x2944, 0x2965, 0x2944, 0xBD31, 0x5A68, 0x3144, 0x62A9, 0xB4F0, 0x41C6, 0x3164, 0x5A68, 0xBD31, 0xC552, 0x5247,   // 0x3F20 (16160) pixels
-0x3165, 0x41E6, 0xB4F0, 0x5268, 0x3165, 0x2944, 0x2944, 0x2944, 0x732A, 0xACD0, 0x39A5, 0x3164, 0x3165, 0x3165, 0x41E6, 0xBD51,   // 0x3F30 (16176) pixels
-0x3185, 0x3165, 0xACB0, 0xB511, 0x8BED, 0x6AEA, 0xACAF, 0xA44F, 0x3165, 0x41C6, 0x940D, 0xC593, 0x9C8F, 0x3165, 0x39A6, 0x3144,   // 0x3F40 (16192) pixels
-0x5248, 0x7B4B, 0x49E7, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944,   // 0x3F50 (16208) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2103, 0x2103, 0x2103,   // 0x3F60 (16224) pixels
-0x2104, 0x2104, 0x2103, 0x20E3, 0x2104, 0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18E3, 0x18C2, 0x18C3, 0x18C2,   // 0x3F70 (16240) pixels
-0x1081, 0x1081, 0x0841, 0x0861, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1081, 0x1082,   // 0x3F80 (16256) pixels
-0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18A2, 0x18C2, 0x18A2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x1082, 0x0861, 0x0000,   // 0x3F90 (16272) pixels
-0x0000, 0x0020, 0x0020, 0x0840, 0x0861, 0x0861, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x3FA0 (16288) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x10A2, 0x18C2, 0x10A2, 0x10A2,   // 0x3FB0 (16304) pixels
-0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1081, 0x10A2, 0x18C2, 0x18C2,   // 0x3FC0 (16320) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3FD0 (16336) pixels
-0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x3FE0 (16352) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000,   // 0x3FF0 (16368) pixels
-0x0000, 0x0020, 0x10C2, 0x1082, 0x18A2, 0x18A2, 0x10C2, 0x18C3, 0x18C3, 0x10C2, 0x10C2, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x18C2,   // 0x4000 (16384) pixels
-0x10A2, 0x1082, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x18C3, 0x18C3,   // 0x4010 (16400) pixels
-0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1903, 0x1903, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2924,   // 0x4020 (16416) pixels
-0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2124, 0x2944, 0x2924,   // 0x4030 (16432) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x3144, 0x3165, 0x5227, 0x730A, 0xA4AF, 0xB510, 0x8BCD, 0x41C6, 0x3985,   // 0x4040 (16448) pixels
-0xBD32, 0x7B6B, 0x3165, 0x39A6, 0x3165, 0x2945, 0x2944, 0x2944, 0x5AA8, 0xC531, 0x9C2E, 0x838C, 0x5247, 0x5248, 0xC551, 0x7B6B,   // 0x4050 (16464) pixels
-0x3164, 0x3144, 0x3144, 0x2944, 0x2944, 0xACB0, 0x62A9, 0x3144, 0x5A68, 0xACB0, 0x41C6, 0x3165, 0x3985, 0xA48F, 0xC573, 0x4A27,   // 0x4060 (16480) pixels
-0x3144, 0x41E6, 0xBD10, 0x5268, 0x3164, 0x3144, 0x3165, 0x2965, 0x5247, 0xB4F0, 0x732A, 0x39A5, 0x3164, 0x49E6, 0x732A, 0xA44E,   // 0x4070 (16496) pixels
-0x3165, 0x3165, 0xBD32, 0xAC8F, 0xA48F, 0xACD0, 0xA46F, 0x41C6, 0x3164, 0x62A9, 0xBD31, 0xACCF, 0xA48F, 0x3165, 0x3165, 0x41C6,   // 0x4080 (16512) pixels
-0xAC8F, 0xC552, 0x8BCD, 0x3144, 0x3165, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x4090 (16528) pixels
-0x2944, 0x2944, 0x2924, 0x3165, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2103,   // 0x40A0 (16544) pixels
-0x2104, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2,   // 0x40B0 (16560) pixels
-0x18C3, 0x1082, 0x10A2, 0x0841, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1081,   // 0x40C0 (16576) pixels
-0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18A2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x0840,   // 0x40D0 (16592) pixels
-0x0000, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082,   // 0x40E0 (16608) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x18A2, 0x10A2,   // 0x40F0 (16624) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2,   // 0x4100 (16640) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4110 (16656) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4120 (16672) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0841, 0x0820, 0x0020, 0x0000, 0x0000,   // 0x4130 (16688) pixels
-0x0841, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C3, 0x10C3, 0x18C3, 0x18C2, 0x10C3, 0x10C2, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2,   // 0x4140 (16704) pixels
-0x0881, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x10A2, 0x1082, 0x18E3, 0x18C3, 0x18E3,   // 0x4150 (16720) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2104, 0x2103, 0x2104, 0x2104, 0x2104, 0x2103, 0x2103, 0x2924, 0x2904, 0x2924,   // 0x4160 (16736) pixels
-0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x3165,   // 0x4170 (16752) pixels
-0x3165, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x4A07, 0xA44F, 0xA46F, 0x940E, 0xB4D0, 0x732A, 0x3144, 0x3144, 0x3985,   // 0x4180 (16768) pixels
-0xBD52, 0x7B2B, 0x3164, 0x2965, 0x2965, 0x2944, 0x2964, 0x3165, 0x4A27, 0xBD31, 0x5247, 0x3164, 0x3985, 0x3985, 0xBD31, 0x7B6B,   // 0x4190 (16784) pixels
-0x3164, 0x3144, 0x2944, 0x41E7, 0x41C6, 0x8BCD, 0x5247, 0x2944, 0x41C6, 0x6AEA, 0x39A6, 0x3164, 0x3165, 0x4A27, 0x6289, 0x3985,   // 0x41A0 (16800) pixels
-0x3144, 0x3985, 0x62A8, 0x41C6, 0x3165, 0x3164, 0x3164, 0x2944, 0x3144, 0x5268, 0xB4CF, 0xA46F, 0x9C0E, 0xB4CF, 0xB4F0, 0x5227,   // 0x41B0 (16816) pixels
-0x3165, 0x5A68, 0xBD32, 0x5A68, 0x39A5, 0x83AC, 0x9C2E, 0x3165, 0x3165, 0xA48F, 0xB511, 0x940D, 0xC572, 0x3185, 0x41E6, 0xAC8F,   // 0x41C0 (16832) pixels
-0xAC8F, 0xBD11, 0x6AEA, 0x3144, 0x2965, 0x2944, 0x2944, 0x3165, 0x3165, 0x2964, 0x3144, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x41D0 (16848) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2104, 0x2103,   // 0x41E0 (16864) pixels
-0x2103, 0x2104, 0x2104, 0x3165, 0x5A69, 0x20E3, 0x20E3, 0x3165, 0x39A6, 0x2103, 0x31A5, 0x5AA9, 0x5269, 0x39C6, 0x2103, 0x18C2,   // 0x41F0 (16880) pixels
-0x18C2, 0x18C2, 0x18A2, 0x1081, 0x1061, 0x0020, 0x0881, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4200 (16896) pixels
-0x1082, 0x0861, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x10A2, 0x1082, 0x10A2,   // 0x4210 (16912) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081,   // 0x4220 (16928) pixels
-0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x10A2, 0x10A2,   // 0x4230 (16944) pixels
-0x1082, 0x10A2, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x10A2, 0x1082,   // 0x4240 (16960) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4250 (16976) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4260 (16992) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1081, 0x0841, 0x0820, 0x0020, 0x0000, 0x0000, 0x0020,   // 0x4270 (17008) pixels
-0x10A2, 0x0861, 0x10A2, 0x10A2, 0x10C2, 0x18C3, 0x10A2, 0x10A2, 0x18C3, 0x10C3, 0x10C2, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x1082,   // 0x4280 (17024) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0020, 0x10A2, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x4290 (17040) pixels
-0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924,   // 0x42A0 (17056) pixels
-0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x4207,   // 0x42B0 (17072) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x3985, 0x6AEA, 0x5A68, 0x3165, 0x62A9, 0x3144, 0x3985, 0xBD11, 0x9C0E, 0x3144, 0x3164, 0x3165,   // 0x42C0 (17088) pixels
-0xA46F, 0x9C4F, 0x3185, 0x3165, 0x3165, 0x3165, 0x39A5, 0x3144, 0x3165, 0xB4B0, 0x5AA8, 0x3164, 0x3164, 0x2944, 0x7B4A, 0x838B,   // 0x42D0 (17104) pixels
-0x3164, 0x3144, 0x2944, 0x3165, 0x2944, 0x3165, 0x3985, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3144, 0x3165, 0x3144,   // 0x42E0 (17120) pixels
-0x3164, 0x3144, 0x2944, 0x2944, 0x3165, 0x3165, 0x3165, 0x2944, 0x3164, 0x3144, 0x3164, 0x5227, 0x6AE9, 0x4A07, 0x3165, 0x2944,   // 0x42F0 (17136) pixels
-0x2944, 0x62C9, 0xAC8F, 0x3185, 0x2944, 0x5247, 0xA48F, 0x3165, 0x41C6, 0xB510, 0x7B6B, 0x732A, 0xBD31, 0x4A07, 0xBD11, 0xA46F,   // 0x4300 (17152) pixels
-0x83AC, 0xBD52, 0x41C6, 0x3144, 0x3165, 0x3165, 0x5A89, 0xB4D0, 0x9C4E, 0x3165, 0x3144, 0x2944, 0x3144, 0x2944, 0x3144, 0x2944,   // 0x4310 (17168) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x4320 (17184) pixels
-0x2924, 0x2924, 0x2124, 0x41A6, 0x734B, 0x2103, 0x2103, 0x39A6, 0x5228, 0x2924, 0x4207, 0x5268, 0x2103, 0x5A89, 0x5248, 0x18C2,   // 0x4330 (17200) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x1081, 0x10A2, 0x0840, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4340 (17216) pixels
-0x1082, 0x10A2, 0x0881, 0x10A2, 0x10C2, 0x18A2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x10A2, 0x10A2,   // 0x4350 (17232) pixels
-0x18A2, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0861, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4360 (17248) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4370 (17264) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x4380 (17280) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4390 (17296) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1062, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x43A0 (17312) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x0881, 0x0861, 0x1061, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x10C2,   // 0x43B0 (17328) pixels
-0x0882, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x10C2, 0x18C3, 0x10C2, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x18C2,   // 0x43C0 (17344) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x10C2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x10C3, 0x10A2, 0x1904, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x43D0 (17360) pixels
-0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924,   // 0x43E0 (17376) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x3185,   // 0x43F0 (17392) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x41A6, 0x8BCC, 0x93ED, 0x3165, 0x2944, 0x2944, 0x3165, 0x9C0E, 0xB4B0, 0x3185, 0x2944, 0x2944,   // 0x4400 (17408) pixels
-0x7B8B, 0xBD71, 0x62C9, 0x3165, 0x3165, 0x5A68, 0x838C, 0x41A5, 0x2944, 0x8BED, 0x5A88, 0x2944, 0x3144, 0x3145, 0x3165, 0x2944,   // 0x4410 (17424) pixels
-0x2964, 0x3165, 0x3144, 0x2964, 0x2964, 0x2964, 0x2964, 0x3164, 0x2964, 0x2944, 0x2944, 0x2944, 0x3164, 0x2964, 0x3164, 0x3165,   // 0x4420 (17440) pixels
-0x3144, 0x2944, 0x3165, 0x3165, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3144, 0x2944, 0x3164, 0x3164, 0x2944,   // 0x4430 (17456) pixels
-0x2944, 0x5248, 0x6AC9, 0x3164, 0x3144, 0x5247, 0xA48F, 0x3164, 0x5A68, 0xBD11, 0x5A68, 0x732A, 0xBD52, 0x83AC, 0xACB0, 0x62E9,   // 0x4440 (17472) pixels
-0xA46F, 0xACB0, 0x3165, 0x3144, 0x3165, 0x5AA9, 0xACD0, 0xBD11, 0xBD10, 0x3165, 0x3164, 0x3144, 0x2944, 0x3144, 0x3164, 0x2944,   // 0x4450 (17488) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x4460 (17504) pixels
-0x2924, 0x2924, 0x2924, 0x39C6, 0x7B4B, 0x2103, 0x2103, 0x41C6, 0x5228, 0x2924, 0x4A27, 0x5A89, 0x20E3, 0x5248, 0x5268, 0x18C2,   // 0x4470 (17520) pixels
-0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x1081, 0x10A2, 0x0861, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4480 (17536) pixels
-0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x10A2,   // 0x4490 (17552) pixels
-0x1082, 0x18A2, 0x0000, 0x0000, 0x0020, 0x0840, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x44A0 (17568) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x44B0 (17584) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x44C0 (17600) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x44D0 (17616) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x0861, 0x1061, 0x0861, 0x0881, 0x1061, 0x1061,   // 0x44E0 (17632) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x1081, 0x0861, 0x0861, 0x1061, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x18C3, 0x0881,   // 0x44F0 (17648) pixels
-0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C2, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2,   // 0x4500 (17664) pixels
-0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x0861, 0x10C3, 0x10C3, 0x18E3, 0x18E4, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x4510 (17680) pixels
-0x2104, 0x2103, 0x2104, 0x2104, 0x2104, 0x2103, 0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2924,   // 0x4520 (17696) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165,   // 0x4530 (17712) pixels
-0x4A07, 0x62A9, 0x5248, 0x39A5, 0x3144, 0x4A07, 0xBD51, 0x41E6, 0x2965, 0x2944, 0x3164, 0x5A68, 0xB4F0, 0x5A68, 0x2944, 0x2944,   // 0x4540 (17728) pixels
-0x3165, 0x62E9, 0xB510, 0xB511, 0xB511, 0xAC8F, 0x8BEC, 0x3164, 0x3144, 0x3164, 0x3144, 0x3145, 0x2944, 0x2944, 0x2944, 0x3164,   // 0x4550 (17744) pixels
-0x2944, 0x3165, 0x2944, 0x3165, 0x2965, 0x2944, 0x3164, 0x2944, 0x3144, 0x3165, 0x3164, 0x3144, 0x3165, 0x3164, 0x2964, 0x3165,   // 0x4560 (17760) pixels
-0x2964, 0x3144, 0x3144, 0x3164, 0x3144, 0x2944, 0x2944, 0x2964, 0x3164, 0x3165, 0x3165, 0x3165, 0x3164, 0x2944, 0x2944, 0x2944,   // 0x4570 (17776) pixels
-0x3165, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x4A07, 0x3985, 0x72EA, 0x838C, 0x39A5, 0x734B, 0xBD31, 0xACB0, 0x41E6, 0x41C6,   // 0x4580 (17792) pixels
-0xBD52, 0x7B6B, 0x3165, 0x3165, 0x5AA9, 0xBD73, 0x940E, 0x8BCC, 0xA48F, 0x3185, 0x3164, 0x5A68, 0xA46F, 0x732B, 0x39A5, 0x3985,   // 0x4590 (17808) pixels
-0x4A07, 0x39A6, 0x3165, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x3144, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x45A0 (17824) pixels
-0x2944, 0x2944, 0x2924, 0x41C6, 0x7B4B, 0x2103, 0x2103, 0x41E7, 0x5228, 0x2924, 0x5248, 0x62CA, 0x5A89, 0x62EA, 0x3185, 0x18E3,   // 0x45B0 (17840) pixels
-0x18E2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x1081, 0x10A2, 0x0020, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081,   // 0x45C0 (17856) pixels
-0x1082, 0x1082, 0x10A2, 0x0881, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18A2, 0x10A2,   // 0x45D0 (17872) pixels
-0x10C2, 0x1081, 0x10A2, 0x0000, 0x0000, 0x0020, 0x0841, 0x0841, 0x0861, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x45E0 (17888) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x10A2, 0x18A2, 0x10A2, 0x10A2,   // 0x45F0 (17904) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4600 (17920) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861,   // 0x4610 (17936) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061,   // 0x4620 (17952) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x0861, 0x0881, 0x0861, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x18C3, 0x18C3, 0x10A2,   // 0x4630 (17968) pixels
-0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x4640 (17984) pixels
-0x18A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C3, 0x10C3, 0x18E4, 0x1904, 0x18E4, 0x1904, 0x1903, 0x18E3, 0x1903,   // 0x4650 (18000) pixels
-0x1904, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2104, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2124,   // 0x4660 (18016) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x3165, 0x6B0A,   // 0x4670 (18032) pixels
-0xACB0, 0xB4D0, 0xC572, 0x7B4B, 0x3165, 0x3165, 0xB4F0, 0x72EA, 0x3165, 0x2944, 0x3145, 0x41A6, 0x9C0E, 0x8BCD, 0x2964, 0x2944,   // 0x4680 (18048) pixels
-0x3165, 0x3164, 0x5A88, 0x7B4B, 0x732B, 0x41E6, 0x3165, 0x3164, 0x3144, 0x3165, 0x3144, 0x2944, 0x3144, 0x2945, 0x2944, 0x2964,   // 0x4690 (18064) pixels
-0x2944, 0x3165, 0x2944, 0x3165, 0x3165, 0x3165, 0x2944, 0x2964, 0x2944, 0x3165, 0x3165, 0x3164, 0x3165, 0x3165, 0x3165, 0x3165,   // 0x46A0 (18080) pixels
-0x3165, 0x3165, 0x3165, 0x3144, 0x3164, 0x3164, 0x2944, 0x2944, 0x3164, 0x2964, 0x3165, 0x3165, 0x3145, 0x3144, 0x3164, 0x2964,   // 0x46B0 (18096) pixels
-0x3144, 0x3165, 0x2944, 0x3144, 0x2944, 0x3145, 0x3144, 0x2944, 0x39A5, 0x3985, 0x3164, 0x6AEA, 0xACAF, 0x6B0A, 0x3165, 0x5A68,   // 0x46C0 (18112) pixels
-0xBD31, 0x5A68, 0x3165, 0x5A88, 0xACB0, 0x9C2E, 0x4A07, 0x8BCD, 0xA48F, 0x3165, 0x3144, 0x39A5, 0x9C4F, 0xBD31, 0x7B8C, 0x4A07,   // 0x46D0 (18128) pixels
-0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x3165, 0x41E7, 0x2944, 0x2924, 0x2924, 0x2944,   // 0x46E0 (18144) pixels
-0x2924, 0x2924, 0x2924, 0x41C6, 0x836B, 0x2924, 0x2124, 0x4A27, 0x5228, 0x2924, 0x5248, 0x62C9, 0x4A27, 0x2924, 0x20E3, 0x18E3,   // 0x46F0 (18160) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1081, 0x10A2, 0x0020, 0x0841, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4700 (18176) pixels
-0x1082, 0x1081, 0x1082, 0x10A2, 0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18A2,   // 0x4710 (18192) pixels
-0x18C2, 0x10A2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0820, 0x0840, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4720 (18208) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x10A2, 0x10A2,   // 0x4730 (18224) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x4740 (18240) pixels
-0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061,   // 0x4750 (18256) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x1081, 0x0861, 0x1061,   // 0x4760 (18272) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0881, 0x0841, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x1082, 0x18C3, 0x18E3, 0x10C2,   // 0x4770 (18288) pixels
-0x10A2, 0x10C2, 0x10C2, 0x18C2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x18C2,   // 0x4780 (18304) pixels
-0x18C3, 0x2103, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0841, 0x1904, 0x10A2, 0x1081, 0x10A2, 0x1081, 0x10A2, 0x1104, 0x1904, 0x1904,   // 0x4790 (18320) pixels
-0x1904, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x47A0 (18336) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x49E7, 0xA44F, 0xACAF,   // 0x47B0 (18352) pixels
-0x5248, 0x5227, 0x8BCD, 0xBD31, 0x5248, 0x3165, 0x730A, 0xACD0, 0x5247, 0x3144, 0x2944, 0x3144, 0x5248, 0xB4F1, 0x3985, 0x3164,   // 0x47C0 (18368) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944, 0x2964, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165,   // 0x47D0 (18384) pixels
-0x3144, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x41C6, 0x3985, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x47E0 (18400) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x3165, 0x3165,   // 0x47F0 (18416) pixels
-0x3144, 0x3144, 0x3144, 0x3165, 0x3165, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x41C6, 0x3164, 0x3985, 0x83AC,   // 0x4800 (18432) pixels
-0x9C2E, 0x4A06, 0x5A68, 0xB511, 0xBD10, 0xB4F0, 0x8BED, 0xA48F, 0xA46F, 0x3145, 0x3145, 0x2944, 0x3164, 0x732A, 0xC552, 0xC572,   // 0x4810 (18448) pixels
-0x9C2E, 0x39A5, 0x3144, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x4820 (18464) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x8BEC, 0x5268, 0x39A6, 0x734B, 0x39A6, 0x2124, 0x5248, 0x5AA9, 0x2103, 0x2103, 0x20E3, 0x18C2,   // 0x4830 (18480) pixels
-0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082,   // 0x4840 (18496) pixels
-0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1061, 0x1082, 0x18A2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x18C2,   // 0x4850 (18512) pixels
-0x18C2, 0x10C2, 0x18C2, 0x10A2, 0x18A2, 0x0000, 0x0020, 0x0020, 0x0840, 0x0841, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x4860 (18528) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4870 (18544) pixels
-0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x4880 (18560) pixels
-0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4890 (18576) pixels
-0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0881,   // 0x48A0 (18592) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x1082, 0x10A2, 0x18C3, 0x18E3, 0x10C2,   // 0x48B0 (18608) pixels
-0x10A2, 0x10C2, 0x18C3, 0x10C2, 0x10C2, 0x18C2, 0x18A2, 0x18C2, 0x10A2, 0x1082, 0x0881, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x48C0 (18624) pixels
-0x18A2, 0x18C3, 0x18A2, 0x0881, 0x1904, 0x1082, 0x18E3, 0x4A48, 0x4A48, 0x4A48, 0x5268, 0x4A48, 0x4A48, 0x4A27, 0x10A2, 0x10A2,   // 0x48D0 (18640) pixels
-0x1924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2124, 0x2124, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x48E0 (18656) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2964, 0x7B4B, 0xACAF,   // 0x48F0 (18672) pixels
-0x3985, 0x3165, 0x5248, 0xBD10, 0x5A68, 0x3165, 0x39A5, 0xB511, 0x940E, 0x3144, 0x3164, 0x3144, 0x3165, 0x732B, 0x3185, 0x3164,   // 0x4900 (18688) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x3165, 0x2944, 0x2965, 0x2965, 0x41C6, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x4910 (18704) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2123, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0x4920 (18720) pixels
-0x20E3, 0x20E3, 0x2103, 0x2103, 0x2123, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x4930 (18736) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x3144, 0x3165, 0x3144, 0x49E6,   // 0x4940 (18752) pixels
-0x41C6, 0x3164, 0xA46F, 0x8BCD, 0x3985, 0x41C6, 0x838C, 0xBD11, 0x9C4F, 0x3144, 0x3165, 0x2944, 0x4A07, 0xAC8F, 0x83AC, 0x41C6,   // 0x4950 (18768) pixels
-0x7B4A, 0x6AC9, 0x3985, 0x3164, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0x4960 (18784) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x4A07, 0x730A, 0x7B6B, 0x5268, 0x2924, 0x2104, 0x41E6, 0x4207, 0x2103, 0x2103, 0x20E3, 0x18C3,   // 0x4970 (18800) pixels
-0x18A2, 0x18C2, 0x5AA9, 0x5ACA, 0x5ACA, 0x5ACA, 0x5AEA, 0x5ACA, 0x5AA9, 0x2103, 0x10A2, 0x1081, 0x0820, 0x0861, 0x1082, 0x1082,   // 0x4980 (18816) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1061, 0x1082, 0x10A2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2,   // 0x4990 (18832) pixels
-0x18C2, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x1082, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x0881, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x49A0 (18848) pixels
-0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x49B0 (18864) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x49C0 (18880) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x49D0 (18896) pixels
-0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061,   // 0x49E0 (18912) pixels
-0x1061, 0x0861, 0x0841, 0x0040, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x49F0 (18928) pixels
-0x10A2, 0x10C2, 0x18C3, 0x18C3, 0x18C2, 0x10C2, 0x10C2, 0x18C2, 0x10A2, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4A00 (18944) pixels
-0x10A2, 0x18A2, 0x1082, 0x1904, 0x10A2, 0x2124, 0x5268, 0x52A9, 0x5AA9, 0x5AAA, 0x5ACA, 0x5ACA, 0x5ACA, 0x5AA9, 0x5289, 0x39C6,   // 0x4A10 (18960) pixels
-0x18A2, 0x2124, 0x2124, 0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x4A20 (18976) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x4A07, 0xBD30,   // 0x4A30 (18992) pixels
-0x62A9, 0x39A6, 0x9C4F, 0xACAF, 0x41E6, 0x2965, 0x2944, 0x9C2E, 0xB4D0, 0x3985, 0x3144, 0x3144, 0x2944, 0x2944, 0x3144, 0x3164,   // 0x4A40 (19008) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x3145, 0x2944, 0x2944, 0x3165, 0x39A6, 0x2124, 0x2124, 0x2123, 0x2123,   // 0x4A50 (19024) pixels
-0x2124, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0x4A60 (19040) pixels
-0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2903, 0x2924,   // 0x4A70 (19056) pixels
-0x2924, 0x2924, 0x2944, 0x3185, 0x2924, 0x2924, 0x2944, 0x2944, 0x2964, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944,   // 0x4A80 (19072) pixels
-0x2944, 0x3164, 0x6AC9, 0x41E6, 0x3165, 0x3165, 0x3985, 0xACD0, 0x940E, 0x3145, 0x3145, 0x3144, 0x7B6B, 0xBD52, 0x5227, 0x3164,   // 0x4A90 (19088) pixels
-0x3165, 0x3985, 0x3164, 0x62C9, 0x5A88, 0x3165, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924,   // 0x4AA0 (19104) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2923, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18A2,   // 0x4AB0 (19120) pixels
-0x4207, 0x62CA, 0x630B, 0x6B2B, 0x630A, 0x630B, 0x62EA, 0x5ACA, 0x5ACA, 0x5ACA, 0x39E7, 0x10A2, 0x1061, 0x0841, 0x1081, 0x1082,   // 0x4AC0 (19136) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x0861, 0x1082, 0x18A2, 0x18A2, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x10A2,   // 0x4AD0 (19152) pixels
-0x10A2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x0000, 0x0000, 0x0020, 0x0840, 0x0841, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x4AE0 (19168) pixels
-0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4AF0 (19184) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081,   // 0x4B00 (19200) pixels
-0x1061, 0x1061, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4B10 (19216) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x0881, 0x1081, 0x0861,   // 0x4B20 (19232) pixels
-0x0861, 0x0841, 0x0841, 0x0861, 0x0840, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x1082, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x10C2,   // 0x4B30 (19248) pixels
-0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x1082, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4B40 (19264) pixels
-0x10A2, 0x1081, 0x1104, 0x1082, 0x39C6, 0x5AAA, 0x5AA9, 0x5AEA, 0x62EA, 0x62EA, 0x6B0A, 0x6B2B, 0x734B, 0x734B, 0x62EA, 0x6AEA,   // 0x4B50 (19280) pixels
-0x5248, 0x10A2, 0x1904, 0x2124, 0x2104, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x4B60 (19296) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x3165, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x3144, 0x8BAC,   // 0x4B70 (19312) pixels
-0xB510, 0x9C4E, 0x940D, 0x41E6, 0x3165, 0x2944, 0x2964, 0x39C6, 0x93ED, 0x5248, 0x3164, 0x3985, 0x2944, 0x3144, 0x3165, 0x3144,   // 0x4B80 (19328) pixels
-0x2944, 0x2965, 0x3144, 0x2965, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2124, 0x2123, 0x2124, 0x2103, 0x18E3, 0x18E3,   // 0x4B90 (19344) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x18E3,   // 0x4BA0 (19360) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x2104, 0x20E3, 0x20E3, 0x20E3, 0x2103,   // 0x4BB0 (19376) pixels
-0x20E3, 0x20E3, 0x20E3, 0x3144, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x3165, 0x2965, 0x2944, 0x3144,   // 0x4BC0 (19392) pixels
-0x3144, 0x2944, 0x3165, 0x3145, 0x3165, 0x3144, 0x3185, 0xACD0, 0x83AC, 0x3144, 0x3164, 0x41C6, 0xB4F1, 0x9C2E, 0x3145, 0x3164,   // 0x4BD0 (19408) pixels
-0x3144, 0x3165, 0x6289, 0xC553, 0x7B2B, 0x2944, 0x2944, 0x3144, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x4BE0 (19424) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2104, 0x2103, 0x18E3, 0x18A2, 0x62CA,   // 0x4BF0 (19440) pixels
-0x6B0B, 0x734B, 0x6B4B, 0x6B4C, 0x734C, 0x736C, 0x6B2B, 0x6B2B, 0x630B, 0x62EA, 0x5AAA, 0x39A6, 0x10A2, 0x0841, 0x0841, 0x1061,   // 0x4C00 (19456) pixels
-0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x0861, 0x1082, 0x18A2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2,   // 0x4C10 (19472) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x18C2, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x1061, 0x1081, 0x1081, 0x1082,   // 0x4C20 (19488) pixels
-0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x4C30 (19504) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081,   // 0x4C40 (19520) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x4C50 (19536) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841,   // 0x4C60 (19552) pixels
-0x0841, 0x0841, 0x0841, 0x0861, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0881, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4C70 (19568) pixels
-0x10C2, 0x10A2, 0x10C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4C80 (19584) pixels
-0x1081, 0x10A2, 0x10A2, 0x39A6, 0x5ACA, 0x5AA9, 0x5ACA, 0x630B, 0x6B2B, 0x6B2B, 0x734B, 0x736B, 0x7B8C, 0x7B6C, 0x734B, 0x734C,   // 0x4C90 (19600) pixels
-0x6AEA, 0x3185, 0x18C2, 0x2124, 0x2124, 0x2124, 0x2944, 0x2924, 0x2124, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x4CA0 (19616) pixels
-0x2924, 0x2944, 0x2944, 0x2965, 0x2945, 0x2944, 0x3165, 0x39A6, 0x3185, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x5A68,   // 0x4CB0 (19632) pixels
-0xBD31, 0xA46F, 0x39A6, 0x3165, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x3165, 0x3165, 0x39C6, 0x2944, 0x3164, 0x2944, 0x2944,   // 0x4CC0 (19648) pixels
-0x2944, 0x3165, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x20E3, 0x18C3, 0x18E3, 0x20E3, 0x2103, 0x20E3,   // 0x4CD0 (19664) pixels
-0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x20E3,   // 0x4CE0 (19680) pixels
-0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0x4CF0 (19696) pixels
-0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x3165,   // 0x4D00 (19712) pixels
-0x2944, 0x3144, 0x3165, 0x3144, 0x3144, 0x3164, 0x3165, 0x940E, 0x7B4B, 0x3144, 0x3164, 0x72EA, 0xB511, 0x5A89, 0x3165, 0x3165,   // 0x4D10 (19728) pixels
-0x3164, 0x41C6, 0xA44F, 0x9C0E, 0x41C6, 0x3145, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x4D20 (19744) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2123, 0x2103, 0x2103, 0x18A2, 0x41E6, 0x6B2B,   // 0x4D30 (19760) pixels
-0x6B2B, 0x734C, 0x734C, 0x734B, 0x738C, 0x736B, 0x734B, 0x6B0A, 0x6B2B, 0x5AEA, 0x5AAA, 0x5ACA, 0x3165, 0x10A2, 0x0840, 0x0861,   // 0x4D40 (19776) pixels
-0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x10A2, 0x0881, 0x10A2, 0x10C2, 0x10A2, 0x18C2, 0x18C2, 0x18C2,   // 0x4D50 (19792) pixels
-0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x1082, 0x18C2, 0x0020, 0x0020, 0x0041, 0x0841, 0x0841, 0x1081, 0x1082, 0x1082,   // 0x4D60 (19808) pixels
-0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x4D70 (19824) pixels
-0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081,   // 0x4D80 (19840) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4D90 (19856) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861,   // 0x4DA0 (19872) pixels
-0x0841, 0x0841, 0x0020, 0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x1081, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2,   // 0x4DB0 (19888) pixels
-0x10C2, 0x10C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4DC0 (19904) pixels
-0x10A2, 0x1104, 0x3185, 0x5ACA, 0x5AAA, 0x5ACA, 0x5ACA, 0x6B2B, 0x734B, 0x736C, 0x7B8C, 0x7BAC, 0x83AC, 0x7BAC, 0x7BAC, 0x83AD,   // 0x4DD0 (19920) pixels
-0x7B6C, 0x732B, 0x3185, 0x1904, 0x2124, 0x2124, 0x2944, 0x2945, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945,   // 0x4DE0 (19936) pixels
-0x2944, 0x2944, 0x2944, 0x2945, 0x39A6, 0x7B2B, 0xAC8F, 0xACD0, 0xACB0, 0x8BCD, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x4DF0 (19952) pixels
-0x9C2E, 0xACB0, 0x39A5, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x4E00 (19968) pixels
-0x2924, 0x2924, 0x2124, 0x2923, 0x2924, 0x2103, 0x18E3, 0x18C3, 0x18E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0x4E10 (19984) pixels
-0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103,   // 0x4E20 (20000) pixels
-0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0x4E30 (20016) pixels
-0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x4E40 (20032) pixels
-0x2924, 0x3164, 0x2944, 0x3165, 0x3144, 0x3144, 0x3144, 0x3165, 0x3144, 0x2944, 0x4A07, 0xA46F, 0x6AEA, 0x3165, 0x3165, 0x3165,   // 0x4E50 (20048) pixels
-0x3165, 0x9C2E, 0xB510, 0x41C6, 0x3165, 0x3185, 0x6AEA, 0x734B, 0x5A88, 0x39A5, 0x3165, 0x3165, 0x3165, 0x2944, 0x2944, 0x2944,   // 0x4E60 (20064) pixels
-0x2924, 0x2944, 0x2924, 0x4207, 0x3165, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x18E3, 0x4A27, 0x6B2B, 0x734B,   // 0x4E70 (20080) pixels
-0x736C, 0x7B8C, 0x7B8D, 0x7B8C, 0x7BAD, 0x7BAD, 0x738C, 0x736D, 0x6B4B, 0x62EA, 0x5ACA, 0x5AA9, 0x5AAA, 0x18C2, 0x10A2, 0x0020,   // 0x4E80 (20096) pixels
-0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x18C2, 0x18C2, 0x18A2, 0x18C2,   // 0x4E90 (20112) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x18A2, 0x10A2, 0x0841, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1061, 0x1061,   // 0x4EA0 (20128) pixels
-0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A3, 0x10A2, 0x10A2,   // 0x4EB0 (20144) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x4EC0 (20160) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4ED0 (20176) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x4EE0 (20192) pixels
-0x0841, 0x0841, 0x0861, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0881, 0x0881, 0x1082, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10C2,   // 0x4EF0 (20208) pixels
-0x10C2, 0x10C2, 0x18C2, 0x18C3, 0x18A2, 0x10A2, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4F00 (20224) pixels
-0x1104, 0x10A2, 0x62EA, 0x5AEA, 0x62EA, 0x62EA, 0x5ACA, 0x736C, 0x736C, 0x7B8C, 0x83CD, 0x7BAD, 0x83CD, 0x83CD, 0x83ED, 0x83CD,   // 0x4F10 (20240) pixels
-0x83AC, 0x7B8C, 0x6B0A, 0x18C2, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x4F20 (20256) pixels
-0x2945, 0x2944, 0x2964, 0x3165, 0x8BCC, 0xBD11, 0x940D, 0x730A, 0xB4F0, 0xC572, 0x62A9, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x4F30 (20272) pixels
-0x62A9, 0xB4D0, 0x5A88, 0x2965, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2924, 0x2924, 0x2924,   // 0x4F40 (20288) pixels
-0x2924, 0x2924, 0x2124, 0x2103, 0x18C3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103,   // 0x4F50 (20304) pixels
-0x20E3, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x4F60 (20320) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x4F70 (20336) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x18E3, 0x20E3, 0x2103, 0x2924, 0x2924,   // 0x4F80 (20352) pixels
-0x2924, 0x2924, 0x2944, 0x3145, 0x2944, 0x2944, 0x3164, 0x3145, 0x2944, 0x2944, 0x5227, 0x9C2F, 0x39A6, 0x3144, 0x3165, 0x3144,   // 0x4F90 (20368) pixels
-0x41C6, 0xBD51, 0x942E, 0x3165, 0x3165, 0x7B8B, 0xB4F1, 0xB511, 0xB511, 0x940E, 0x41C6, 0x3185, 0x3165, 0x2944, 0x2924, 0x2924,   // 0x4FA0 (20384) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x4207, 0x3185, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2103, 0x18A2, 0x734B, 0x734A, 0x7B6C,   // 0x4FB0 (20400) pixels
-0x7B8C, 0x83CD, 0x7BAD, 0x7BAD, 0x7B8C, 0x7BAD, 0x7BAD, 0x7B8C, 0x734B, 0x5ACA, 0x5ACA, 0x5ACA, 0x5AA9, 0x4A68, 0x1082, 0x10A2,   // 0x4FC0 (20416) pixels
-0x0841, 0x1061, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x0861, 0x1082, 0x10A2, 0x18C2, 0x18A2, 0x18C3,   // 0x4FD0 (20432) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x18A2, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x1061,   // 0x4FE0 (20448) pixels
-0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x4FF0 (20464) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x5000 (20480) pixels
-0x1062, 0x1061, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1062, 0x1062, 0x0861, 0x0861, 0x0861,   // 0x5010 (20496) pixels
-0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x5020 (20512) pixels
-0x0841, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0020, 0x1082, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10C3, 0x10C2,   // 0x5030 (20528) pixels
-0x10C3, 0x10C3, 0x18C3, 0x10C2, 0x10A2, 0x0882, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10E3,   // 0x5040 (20544) pixels
-0x1125, 0x2103, 0x5ACA, 0x630B, 0x6B2B, 0x6B4B, 0x734B, 0x7B8C, 0x7BAC, 0x7BAD, 0x83CD, 0x83ED, 0x8BED, 0x8BEE, 0x940E, 0x8C0D,   // 0x5050 (20560) pixels
-0x8BED, 0x8BED, 0x83AC, 0x18C2, 0x1904, 0x2124, 0x2144, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2965, 0x2945,   // 0x5060 (20576) pixels
-0x2945, 0x2944, 0x2944, 0x838B, 0x940D, 0x4A07, 0x3144, 0x3164, 0x3165, 0x836B, 0xB4AF, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x5070 (20592) pixels
-0x2944, 0x41E7, 0x3185, 0x2944, 0x2944, 0x2944, 0x2924, 0x39A6, 0x5248, 0x41E6, 0x3185, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103,   // 0x5080 (20608) pixels
-0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x20E3,   // 0x5090 (20624) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x50A0 (20640) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x50B0 (20656) pixels
-0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18C3,   // 0x50C0 (20672) pixels
-0x2103, 0x2924, 0x2924, 0x2924, 0x2944, 0x3165, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x39A6, 0x2944, 0x3164,   // 0x50D0 (20688) pixels
-0x9C0E, 0xAC8F, 0x4A07, 0x3985, 0x732B, 0xB4F1, 0x62C9, 0x3985, 0x4A07, 0x7B6B, 0xB511, 0x730A, 0x3165, 0x3145, 0x2944, 0x2944,   // 0x50E0 (20704) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2124, 0x18E3, 0x18A2, 0x7B8C, 0x7BAD, 0x83CD,   // 0x50F0 (20720) pixels
-0x8BEE, 0x83CD, 0x83CD, 0x83EE, 0x83CE, 0x83CE, 0x83CD, 0x7B8D, 0x7B8C, 0x736C, 0x6B2B, 0x62EB, 0x5AEA, 0x5289, 0x18C2, 0x1082,   // 0x5100 (20736) pixels
-0x1081, 0x0841, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C2,   // 0x5110 (20752) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x1081, 0x10A2, 0x0000, 0x0020, 0x0020, 0x0840, 0x0840, 0x0861,   // 0x5120 (20768) pixels
-0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x5130 (20784) pixels
-0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082,   // 0x5140 (20800) pixels
-0x1082, 0x1061, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x5150 (20816) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x5160 (20832) pixels
-0x0861, 0x0040, 0x0020, 0x0020, 0x0000, 0x0000, 0x1082, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x10C2, 0x10C3, 0x18C3,   // 0x5170 (20848) pixels
-0x10C3, 0x10C2, 0x10A2, 0x10A2, 0x1082, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x10C3, 0x10C3,   // 0x5180 (20864) pixels
-0x10A2, 0x39E7, 0x62EA, 0x630A, 0x6B2B, 0x736C, 0x736C, 0x7BAD, 0x83CD, 0x83EE, 0x8BEE, 0x8C0E, 0x940E, 0x942E, 0x940E, 0x944E,   // 0x5190 (20880) pixels
-0x940E, 0x940E, 0x8BED, 0x39A5, 0x18E3, 0x2124, 0x2144, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2964, 0x2964,   // 0x51A0 (20896) pixels
-0x3144, 0x3144, 0x3985, 0xB4CF, 0x5227, 0x3164, 0x2964, 0x2944, 0x3164, 0x3165, 0xACAF, 0x41C6, 0x2944, 0x2944, 0x3144, 0x2945,   // 0x51B0 (20912) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x3144, 0x2944, 0x2924, 0x3165, 0x39C6, 0x2124, 0x2924, 0x2924, 0x2124, 0x18C3, 0x20E3, 0x2103,   // 0x51C0 (20928) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x51D0 (20944) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2904, 0x2103, 0x2123, 0x2103, 0x2924, 0x2103, 0x2123, 0x2103, 0x2103, 0x2103, 0x2104,   // 0x51E0 (20960) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x2124, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2103,   // 0x51F0 (20976) pixels
-0x2103, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0x5200 (20992) pixels
-0x2103, 0x18E3, 0x18E3, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x3164, 0x3164, 0x2944, 0x3164, 0x2944, 0x2944, 0x5A88,   // 0x5210 (21008) pixels
-0xACAF, 0x4A06, 0x3144, 0x62C9, 0xB4D0, 0x62A9, 0x3144, 0x3144, 0x3164, 0x3165, 0x7B6C, 0xACD0, 0x39A5, 0x3145, 0x2944, 0x2944,   // 0x5220 (21024) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2124, 0x2924, 0x18C3, 0x2923, 0x83AD, 0x7BAC, 0x8BED,   // 0x5230 (21040) pixels
-0x93EE, 0x8C0E, 0x8BED, 0x8C0D, 0x8BEE, 0x83CD, 0x8BED, 0x83CE, 0x7B8C, 0x736C, 0x736C, 0x6B2B, 0x62EA, 0x5AA9, 0x2124, 0x10A2,   // 0x5240 (21056) pixels
-0x1082, 0x10A2, 0x0861, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x0861, 0x1082, 0x10A2, 0x18C2,   // 0x5250 (21072) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x0861, 0x0000, 0x0020, 0x0020, 0x0820, 0x0861,   // 0x5260 (21088) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x5270 (21104) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x5280 (21120) pixels
-0x1061, 0x1061, 0x1061, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861,   // 0x5290 (21136) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861,   // 0x52A0 (21152) pixels
-0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0040, 0x0882, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C3, 0x18C3, 0x18C3,   // 0x52B0 (21168) pixels
-0x10C2, 0x10C2, 0x10A2, 0x1082, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x1081, 0x10C3, 0x1924,   // 0x52C0 (21184) pixels
-0x1082, 0x39C6, 0x62EA, 0x630B, 0x6B4B, 0x736C, 0x7B8C, 0x83CD, 0x83CD, 0x83ED, 0x8BEE, 0x8C0E, 0x942E, 0x942F, 0x942F, 0x9C4E,   // 0x52D0 (21200) pixels
-0x9C4E, 0x940D, 0x8BED, 0x41E6, 0x18C3, 0x2124, 0x2144, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x3165, 0x3165,   // 0x52E0 (21216) pixels
-0x3164, 0x3144, 0x39A6, 0xBD11, 0x41C6, 0x3164, 0x2944, 0x2944, 0x3164, 0x3165, 0xACB0, 0x5207, 0x2944, 0x3144, 0x2944, 0x2944,   // 0x52F0 (21232) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x20E3, 0x18C2, 0x2103, 0x20E3, 0x20E3,   // 0x5300 (21248) pixels
-0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2123, 0x2103,   // 0x5310 (21264) pixels
-0x2103, 0x2123, 0x2103, 0x2103, 0x2103, 0x2103, 0x2903, 0x2924, 0x2924, 0x2924, 0x2923, 0x2923, 0x2124, 0x2123, 0x2924, 0x2103,   // 0x5320 (21280) pixels
-0x2103, 0x2924, 0x2123, 0x2903, 0x2123, 0x2103, 0x2123, 0x2924, 0x2123, 0x2123, 0x2123, 0x2923, 0x2103, 0x2124, 0x2103, 0x2103,   // 0x5330 (21296) pixels
-0x2103, 0x2104, 0x2103, 0x2124, 0x3185, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3,   // 0x5340 (21312) pixels
-0x20E3, 0x20E3, 0x2103, 0x18E3, 0x2103, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x3164, 0x3164, 0x3165, 0x2964, 0x2944, 0x41E6,   // 0x5350 (21328) pixels
-0x6AE9, 0x3164, 0x3165, 0x7B6B, 0xBD52, 0x39A5, 0x3144, 0x3144, 0x3144, 0x3164, 0x6AC9, 0xBD31, 0x41E6, 0x3144, 0x3164, 0x2944,   // 0x5360 (21344) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2124, 0x2124, 0x18C2, 0x41E6, 0x83AC, 0x83AC, 0x8BED,   // 0x5370 (21360) pixels
-0x8C0E, 0x940F, 0x8C0E, 0x942F, 0x8C0E, 0x83ED, 0x83ED, 0x83AD, 0x7BAC, 0x7B8C, 0x736B, 0x6B2A, 0x62EA, 0x5AA9, 0x3185, 0x10A2,   // 0x5380 (21376) pixels
-0x18C2, 0x1082, 0x0861, 0x0861, 0x0881, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x0882, 0x1081, 0x10A2, 0x1061, 0x1082, 0x10A2,   // 0x5390 (21392) pixels
-0x18A2, 0x18A2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0020, 0x0000, 0x0020, 0x0020, 0x0841,   // 0x53A0 (21408) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x53B0 (21424) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082,   // 0x53C0 (21440) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1062, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1062, 0x0861, 0x1061, 0x1061,   // 0x53D0 (21456) pixels
-0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841,   // 0x53E0 (21472) pixels
-0x0020, 0x0020, 0x0000, 0x0000, 0x0040, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18A2, 0x18C3, 0x18E3, 0x18C3,   // 0x53F0 (21488) pixels
-0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x10A2, 0x1904, 0x1904,   // 0x5400 (21504) pixels
-0x10A2, 0x39A6, 0x630B, 0x6B4B, 0x734B, 0x7B8C, 0x7BAC, 0x83CD, 0x83ED, 0x8C0E, 0x942E, 0x940E, 0x9C4F, 0x9C4F, 0x9C6F, 0x9C6F,   // 0x5410 (21520) pixels
-0x9C6F, 0x940E, 0x940E, 0x4A27, 0x18C2, 0x2124, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x5A88, 0x93EE,   // 0x5420 (21536) pixels
-0x5227, 0x3165, 0x3165, 0xA44F, 0x838C, 0x3985, 0x3144, 0x2944, 0x3164, 0x41C6, 0xBD10, 0x3985, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x5430 (21552) pixels
-0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2103, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0x5440 (21568) pixels
-0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2923, 0x2103,   // 0x5450 (21584) pixels
-0x2124, 0x2924, 0x2123, 0x2124, 0x2924, 0x2123, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924,   // 0x5460 (21600) pixels
-0x2123, 0x2124, 0x2923, 0x2123, 0x2903, 0x2123, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2103, 0x2924, 0x2123, 0x2123, 0x2103,   // 0x5470 (21616) pixels
-0x2123, 0x2124, 0x2104, 0x2924, 0x39A6, 0x2944, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0x5480 (21632) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2964,   // 0x5490 (21648) pixels
-0x3164, 0x3165, 0x3164, 0x7B4B, 0xBD52, 0x41A6, 0x3144, 0x3164, 0x3144, 0x3164, 0x6AEA, 0xBD52, 0x41E6, 0x3165, 0x3164, 0x4A07,   // 0x54A0 (21664) pixels
-0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2124, 0x2944, 0x18A2, 0x6AEA, 0x83AD, 0x83AC, 0x8BED,   // 0x54B0 (21680) pixels
-0x942E, 0x942E, 0x9C2E, 0x9C4F, 0x940E, 0x942F, 0x8BEE, 0x83EE, 0x83CD, 0x83CD, 0x7B8D, 0x6B4B, 0x630A, 0x5AA9, 0x31A6, 0x1082,   // 0x54C0 (21696) pixels
-0x18C2, 0x18E3, 0x1082, 0x0840, 0x0861, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x10A2,   // 0x54D0 (21712) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x10C2, 0x10A2, 0x1082, 0x10C2, 0x0000, 0x0020, 0x0020, 0x0840,   // 0x54E0 (21728) pixels
-0x0861, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x54F0 (21744) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x5500 (21760) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1062, 0x1061, 0x1061, 0x0861, 0x1061,   // 0x5510 (21776) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020,   // 0x5520 (21792) pixels
-0x0020, 0x0000, 0x0000, 0x0000, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C3, 0x18C3, 0x18C3,   // 0x5530 (21808) pixels
-0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x0861, 0x18E3, 0x1904, 0x1904,   // 0x5540 (21824) pixels
-0x10A2, 0x31A5, 0x630A, 0x6B4B, 0x738C, 0x7BAD, 0x7B8C, 0x83CD, 0x8BEE, 0x8C0E, 0x942E, 0x942F, 0x9C6F, 0x9C4E, 0x9C6F, 0x9C6F,   // 0x5550 (21840) pixels
-0x9C4E, 0x942E, 0x940E, 0x4A27, 0x20E3, 0x2145, 0x2944, 0x2945, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x5A88, 0xBD32,   // 0x5560 (21856) pixels
-0xA46F, 0x3185, 0x3164, 0x6AE9, 0xBD32, 0x7B8C, 0x39A6, 0x39A5, 0x4A07, 0x9C4F, 0x8BCD, 0x2944, 0x3145, 0x2944, 0x2944, 0x2944,   // 0x5570 (21872) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2123, 0x2124, 0x18E3, 0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103,   // 0x5580 (21888) pixels
-0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2924, 0x2924, 0x2124,   // 0x5590 (21904) pixels
-0x2123, 0x2103, 0x2123, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924,   // 0x55A0 (21920) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2923, 0x2924, 0x2124, 0x2924, 0x2924,   // 0x55B0 (21936) pixels
-0x2124, 0x2124, 0x2104, 0x2103, 0x3165, 0x3165, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103,   // 0x55C0 (21952) pixels
-0x20E3, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x55D0 (21968) pixels
-0x3144, 0x39A6, 0x3144, 0x62A9, 0xB4AF, 0x838C, 0x3165, 0x3165, 0x3164, 0x39A5, 0xA42F, 0xB4D0, 0x39A5, 0x3185, 0x5A48, 0xA46F,   // 0x55E0 (21984) pixels
-0x62C9, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x18C2, 0x41E6, 0x83AC, 0x83AC, 0x8BED,   // 0x55F0 (22000) pixels
-0x9C2E, 0x9C4F, 0xA46F, 0x9C4F, 0x9C4F, 0x944F, 0x8C0E, 0x8C0E, 0x83ED, 0x7BCD, 0x7B8B, 0x736B, 0x6B0A, 0x5AA9, 0x3165, 0x1082,   // 0x5600 (22016) pixels
-0x18C2, 0x18C2, 0x1082, 0x10A2, 0x0840, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x5610 (22032) pixels
-0x10A2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x0040, 0x0000, 0x0020, 0x0840,   // 0x5620 (22048) pixels
-0x0841, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082,   // 0x5630 (22064) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x5640 (22080) pixels
-0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1082, 0x1062, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x5650 (22096) pixels
-0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020,   // 0x5660 (22112) pixels
-0x0020, 0x0000, 0x0000, 0x0040, 0x0881, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x18C2, 0x18C3, 0x10A2, 0x18C2, 0x10A2,   // 0x5670 (22128) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0020, 0x18E3, 0x1903, 0x1924,   // 0x5680 (22144) pixels
-0x1925, 0x2924, 0x630B, 0x6B4B, 0x6B2B, 0x7B8C, 0x7B8C, 0x83CD, 0x8BEE, 0x8C0E, 0x9C4F, 0x9C4F, 0x9C6F, 0x9C6F, 0xA48F, 0x9C4E,   // 0x5690 (22160) pixels
-0x9C4F, 0x940E, 0x940D, 0x0841, 0x1924, 0x2145, 0x2144, 0x2945, 0x2945, 0x2945, 0x2944, 0x2964, 0x3164, 0x3144, 0x2965, 0x6AEA,   // 0x56A0 (22176) pixels
-0xACAF, 0x7B8C, 0x39A5, 0x3185, 0x7B6B, 0xB4D0, 0xAC90, 0xA46F, 0xACD0, 0x838C, 0x3185, 0x2944, 0x2944, 0x3145, 0x2945, 0x3165,   // 0x56B0 (22192) pixels
-0x2944, 0x2944, 0x2924, 0x2123, 0x2103, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x2103,   // 0x56C0 (22208) pixels
-0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2924, 0x2124, 0x2103, 0x2103, 0x2124, 0x2123, 0x2124, 0x2123, 0x2924, 0x2924, 0x2923,   // 0x56D0 (22224) pixels
-0x2923, 0x2924, 0x2924, 0x2944, 0x2123, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x56E0 (22240) pixels
-0x2923, 0x2923, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x56F0 (22256) pixels
-0x2924, 0x2924, 0x2924, 0x2123, 0x2924, 0x2944, 0x2924, 0x2123, 0x2103, 0x2903, 0x2103, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x5700 (22272) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2123, 0x2924, 0x2924, 0x2944, 0x2944,   // 0x5710 (22288) pixels
-0x2944, 0x39A6, 0x3165, 0x3144, 0x4A07, 0xACAF, 0x7B6B, 0x732B, 0x838C, 0xAC8F, 0xB4B0, 0x6289, 0x3164, 0x7B2B, 0xBD11, 0xC532,   // 0x5720 (22304) pixels
-0x8BAC, 0x3164, 0x3185, 0x2944, 0x2944, 0x2945, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x18E3, 0x18C2, 0x93EE, 0x8BED, 0x940E,   // 0x5730 (22320) pixels
-0x9C4E, 0x9C6F, 0x9C6E, 0x9C4F, 0x9C4F, 0x942F, 0x942E, 0x8C0E, 0x8BEE, 0x7BAD, 0x7B8C, 0x736C, 0x6B2A, 0x5289, 0x18C2, 0x10A2,   // 0x5740 (22336) pixels
-0x18C3, 0x18C2, 0x18C3, 0x1081, 0x1082, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x0861,   // 0x5750 (22352) pixels
-0x1082, 0x18A2, 0x10A2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x0000, 0x0020, 0x0020,   // 0x5760 (22368) pixels
-0x0841, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082,   // 0x5770 (22384) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x5780 (22400) pixels
-0x1061, 0x1082, 0x1061, 0x1061, 0x1082, 0x1081, 0x1062, 0x1082, 0x1082, 0x1081, 0x1061, 0x1061, 0x1062, 0x1061, 0x0861, 0x1061,   // 0x5790 (22416) pixels
-0x1061, 0x0861, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000,   // 0x57A0 (22432) pixels
-0x0000, 0x0000, 0x0000, 0x0861, 0x0881, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C3, 0x10C2, 0x10A2, 0x18C2, 0x10A2,   // 0x57B0 (22448) pixels
-0x1082, 0x18C3, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0841, 0x0020, 0x18E3, 0x18E3, 0x18E3, 0x1904,   // 0x57C0 (22464) pixels
-0x1925, 0x18A2, 0x630B, 0x6B2B, 0x734B, 0x7B8C, 0x7B8C, 0x83CD, 0x8BEE, 0x942E, 0x942E, 0x9C6F, 0xA46F, 0xA48F, 0x9C4F, 0x9C6E,   // 0x57D0 (22480) pixels
-0x9C4E, 0x940E, 0x8BED, 0x18C2, 0x2124, 0x2145, 0x2945, 0x2944, 0x2965, 0x2945, 0x3165, 0x3185, 0x3165, 0x3165, 0x3165, 0x3185,   // 0x57E0 (22496) pixels
-0x7B4B, 0xACD0, 0x7B4B, 0x3185, 0x39A5, 0x5248, 0x7B6B, 0x7B4C, 0x6289, 0x39A5, 0x2944, 0x2965, 0x3145, 0x2944, 0x3145, 0x2924,   // 0x57F0 (22512) pixels
-0x2124, 0x2924, 0x2103, 0x18E3, 0x18E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x5800 (22528) pixels
-0x2103, 0x2103, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2923, 0x2123, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924,   // 0x5810 (22544) pixels
-0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924,   // 0x5820 (22560) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x3164, 0x3144, 0x2924,   // 0x5830 (22576) pixels
-0x2924, 0x2923, 0x2924, 0x2924, 0x2923, 0x2924, 0x2924, 0x2924, 0x2923, 0x2924, 0x2924, 0x2904, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x5840 (22592) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2923, 0x2924, 0x2944,   // 0x5850 (22608) pixels
-0x3145, 0x39C6, 0x3165, 0x3144, 0x3144, 0x62A9, 0xB511, 0xBD52, 0xBD52, 0xAC8F, 0x5A68, 0x3985, 0x41C6, 0xACB0, 0xA46F, 0xC552,   // 0x5860 (22624) pixels
-0x8BAC, 0x3165, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x20E3, 0x18C2, 0x8BED, 0x8BEE, 0x940E,   // 0x5870 (22640) pixels
-0x9C4F, 0x9C2E, 0xA46F, 0x9C4F, 0x9C6F, 0x9C4F, 0x8C0E, 0x8C0D, 0x8BEE, 0x83CD, 0x7BAD, 0x7B8C, 0x6B0A, 0x5289, 0x10A2, 0x10A2,   // 0x5880 (22656) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x1081, 0x1081, 0x0840, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x5890 (22672) pixels
-0x1081, 0x1082, 0x18A2, 0x18A2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x1081, 0x0841, 0x0000, 0x0020,   // 0x58A0 (22688) pixels
-0x0820, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082,   // 0x58B0 (22704) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x58C0 (22720) pixels
-0x1061, 0x1062, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1082, 0x1061, 0x1062, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x58D0 (22736) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000,   // 0x58E0 (22752) pixels
-0x0000, 0x0020, 0x0841, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C3, 0x10A2, 0x10C3, 0x10A2, 0x18C2, 0x10A2, 0x0881,   // 0x58F0 (22768) pixels
-0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x18E3, 0x18E3, 0x18E3, 0x1904, 0x1904,   // 0x5900 (22784) pixels
-0x2145, 0x18A2, 0x5AC9, 0x6B0A, 0x734C, 0x7B8C, 0x7B8B, 0x83CD, 0x8BED, 0x940E, 0x9C2E, 0x9C2E, 0x9C4E, 0x9C4F, 0x940E, 0x940E,   // 0x5910 (22800) pixels
-0x940D, 0x8BED, 0x6AE9, 0x18E3, 0x2945, 0x2945, 0x2965, 0x2945, 0x2944, 0x2944, 0x7B4B, 0xC572, 0xB531, 0xA48F, 0x8BED, 0x732A,   // 0x5920 (22816) pixels
-0x5288, 0x9C0E, 0xC573, 0x5A89, 0x3165, 0x3165, 0x3144, 0x2944, 0x2944, 0x3144, 0x3165, 0x2944, 0x3145, 0x2944, 0x2944, 0x39C6,   // 0x5930 (22832) pixels
-0x2924, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x5940 (22848) pixels
-0x2103, 0x2123, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x5950 (22864) pixels
-0x2924, 0x2944, 0x3164, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0x5960 (22880) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x5970 (22896) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2923, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x5980 (22912) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x2923,   // 0x5990 (22928) pixels
-0x2944, 0x3144, 0x2944, 0x2944, 0x2945, 0x3164, 0x3165, 0x3164, 0x3164, 0x3144, 0x3164, 0x39A5, 0xA44F, 0x9C2E, 0x4A27, 0xB510,   // 0x59A0 (22944) pixels
-0x6AEA, 0x3165, 0x3165, 0x6ACA, 0x4A07, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x18E3, 0x4A27, 0x83AC, 0x940E,   // 0x59B0 (22960) pixels
-0x9C4F, 0x9C6F, 0xA46F, 0x9C4E, 0x9C4F, 0x9C2E, 0x9C4F, 0x8BED, 0x8BEE, 0x83CE, 0x7BCD, 0x6B2B, 0x6AEA, 0x4A27, 0x18C2, 0x18E3,   // 0x59C0 (22976) pixels
-0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x1081, 0x10A2, 0x0861, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082,   // 0x59D0 (22992) pixels
-0x1081, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C2, 0x18A2, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x10C2, 0x10A2, 0x10A2, 0x1081, 0x0020,   // 0x59E0 (23008) pixels
-0x0020, 0x0840, 0x0841, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x59F0 (23024) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x5A00 (23040) pixels
-0x1061, 0x1061, 0x1081, 0x1061, 0x1062, 0x1061, 0x1082, 0x1081, 0x1061, 0x1061, 0x0861, 0x1082, 0x1061, 0x1061, 0x0861, 0x1061,   // 0x5A10 (23056) pixels
-0x0881, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0040, 0x0020, 0x0020, 0x0000,   // 0x5A20 (23072) pixels
-0x0000, 0x0861, 0x1082, 0x0881, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x1082, 0x10A2,   // 0x5A30 (23088) pixels
-0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x18A2, 0x1082, 0x0841, 0x10A2, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1903, 0x2104,   // 0x5A40 (23104) pixels
-0x2125, 0x1925, 0x1081, 0x62EA, 0x6B2B, 0x736C, 0x7B8C, 0x83CD, 0x8BED, 0x8C0E, 0x942E, 0x942E, 0x942E, 0x9C2F, 0x940D, 0x940E,   // 0x5A50 (23120) pixels
-0x8BED, 0x732A, 0x18A2, 0x2124, 0x2945, 0x2965, 0x2944, 0x2945, 0x3165, 0x2944, 0x4A07, 0x93EE, 0x9C4F, 0x7B6B, 0x83CC, 0xACCF,   // 0x5A60 (23136) pixels
-0xB4F0, 0xB511, 0xBD52, 0xB510, 0x3985, 0x3165, 0x2944, 0x3144, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x3144,   // 0x5A70 (23152) pixels
-0x18E2, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103,   // 0x5A80 (23168) pixels
-0x2124, 0x2124, 0x2124, 0x2924, 0x2923, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0x5A90 (23184) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x5AA0 (23200) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x83AC, 0x6B0A, 0x2944, 0x2924, 0x2924,   // 0x5AB0 (23216) pixels
-0x2944, 0x3164, 0x6AC9, 0x83AC, 0x83AC, 0x734B, 0x3185, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2123, 0x2124, 0x2103, 0x2124,   // 0x5AC0 (23232) pixels
-0x2124, 0x2124, 0x2104, 0x2124, 0x2103, 0x2103, 0x2103, 0x5A89, 0x39A5, 0x2103, 0x20E3, 0x5247, 0x2903, 0x20E3, 0x39A5, 0x2923,   // 0x5AD0 (23248) pixels
-0x2103, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x2964, 0x3144, 0x3144, 0x3165, 0x41C6, 0x93ED, 0xB4AF, 0x41A6, 0x39A5, 0xB4F0,   // 0x5AE0 (23264) pixels
-0x6B0A, 0x39A5, 0x7B2B, 0xBD11, 0x5A88, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x18C2, 0x732B, 0x93ED,   // 0x5AF0 (23280) pixels
-0x942E, 0x940E, 0x9C2E, 0x9C4F, 0x9C4E, 0x9C4F, 0x9C2F, 0x940E, 0x8BED, 0x83CD, 0x7BAC, 0x6B2B, 0x5A89, 0x18A2, 0x18E3, 0x18E3,   // 0x5B00 (23296) pixels
-0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x1081, 0x1081, 0x0861, 0x1082, 0x0881, 0x1061, 0x1082, 0x1081, 0x1081, 0x1082,   // 0x5B10 (23312) pixels
-0x1082, 0x0861, 0x1082, 0x10A2, 0x10C2, 0x18C3, 0x10C2, 0x18C3, 0x18E3, 0x18C3, 0x10A2, 0x18C2, 0x18A2, 0x10A2, 0x18C2, 0x0000,   // 0x5B20 (23328) pixels
-0x0000, 0x0020, 0x0820, 0x0841, 0x1061, 0x1061, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x5B30 (23344) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x5B40 (23360) pixels
-0x1061, 0x1061, 0x1081, 0x1082, 0x1081, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081,   // 0x5B50 (23376) pixels
-0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000,   // 0x5B60 (23392) pixels
-0x0840, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18C2, 0x1082, 0x1081, 0x18A2,   // 0x5B70 (23408) pixels
-0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0881, 0x10A2, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x2104,   // 0x5B80 (23424) pixels
-0x2125, 0x2145, 0x1125, 0x3185, 0x6B0B, 0x736B, 0x7B6C, 0x83AC, 0x83CD, 0x8BCD, 0x8BED, 0x8BED, 0x93EE, 0x942E, 0x8BED, 0x8BED,   // 0x5B90 (23440) pixels
-0x83CC, 0x18C2, 0x2966, 0x2144, 0x2945, 0x2944, 0x2944, 0x2964, 0x3145, 0x3145, 0x3164, 0x5248, 0xBD32, 0x7B4B, 0x41E6, 0x49E6,   // 0x5BA0 (23456) pixels
-0x62A9, 0x8BED, 0xAC8F, 0xAC8F, 0x49E7, 0x3145, 0x2944, 0x2944, 0x2944, 0x3165, 0x3164, 0x2924, 0x2924, 0x2124, 0x2103, 0x18E2,   // 0x5BB0 (23472) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2123, 0x2123, 0x2123, 0x2103, 0x2124, 0x2924, 0x2123,   // 0x5BC0 (23488) pixels
-0x2124, 0x2123, 0x2124, 0x2924, 0x2124, 0x2923, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x5BD0 (23504) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x3144, 0x2924,   // 0x5BE0 (23520) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0xACD0, 0x83AC, 0x2944, 0x2944, 0x2924,   // 0x5BF0 (23536) pixels
-0x3164, 0x6B0A, 0x942F, 0x62C9, 0x5248, 0x7B8B, 0x838C, 0x3165, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2123, 0x2123,   // 0x5C00 (23552) pixels
-0x2924, 0x2103, 0x2924, 0x2124, 0x2924, 0x2103, 0x2924, 0x7B4B, 0x49E6, 0x2103, 0x2103, 0x732B, 0x3164, 0x2103, 0x732B, 0x41E6,   // 0x5C10 (23568) pixels
-0x20E3, 0x2103, 0x2924, 0x2924, 0x2944, 0x2965, 0x3165, 0x2944, 0x3165, 0x3144, 0x730A, 0xBD31, 0x6289, 0x3165, 0x5227, 0xB4F0,   // 0x5C20 (23584) pixels
-0x6AEA, 0x6ACA, 0xB4F1, 0x8BCD, 0x3164, 0x3164, 0x3144, 0x3145, 0x2944, 0x2944, 0x2924, 0x2964, 0x3165, 0x18C2, 0x18C2, 0x8BCD,   // 0x5C30 (23600) pixels
-0x940E, 0x942E, 0x940E, 0x940E, 0x9C4F, 0x9C6F, 0x9C2F, 0x8C0E, 0x8BED, 0x7BAD, 0x736C, 0x5AA9, 0x3185, 0x18C2, 0x20E3, 0x20E3,   // 0x5C40 (23616) pixels
-0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x0840, 0x0861, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082,   // 0x5C50 (23632) pixels
-0x1081, 0x1082, 0x0861, 0x10A2, 0x10A2, 0x18C2, 0x10C3, 0x18C3, 0x20E3, 0x18E3, 0x10A2, 0x10A2, 0x18A3, 0x10A2, 0x1082, 0x1081,   // 0x5C60 (23648) pixels
-0x0000, 0x0020, 0x0020, 0x0840, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x5C70 (23664) pixels
-0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x5C80 (23680) pixels
-0x1061, 0x1082, 0x0861, 0x1081, 0x1061, 0x0881, 0x1061, 0x1061, 0x1081, 0x1061, 0x1082, 0x1061, 0x1061, 0x1082, 0x1082, 0x1081,   // 0x5C90 (23696) pixels
-0x1081, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0000, 0x0000, 0x0041,   // 0x5CA0 (23712) pixels
-0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x18C2, 0x10A2, 0x0881, 0x18A2, 0x10A2,   // 0x5CB0 (23728) pixels
-0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0841, 0x1082, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x1903, 0x1904,   // 0x5CC0 (23744) pixels
-0x2124, 0x2144, 0x2145, 0x18C2, 0x18C2, 0x6B0A, 0x734B, 0x7B8C, 0x7B8C, 0x83AC, 0x83CC, 0x83AC, 0x8BED, 0x8C0D, 0x83AC, 0x734B,   // 0x5CD0 (23760) pixels
-0x0861, 0x2145, 0x3186, 0x3165, 0x2944, 0x2924, 0x3164, 0x2964, 0x2944, 0x2944, 0x2965, 0x3144, 0x62A9, 0xBD32, 0x9C2E, 0x39A5,   // 0x5CE0 (23776) pixels
-0x3165, 0x2944, 0x2944, 0x3985, 0x2944, 0x3165, 0x2944, 0x2944, 0x3165, 0x2944, 0x2924, 0x2924, 0x2924, 0x18E3, 0x2923, 0x20E3,   // 0x5CF0 (23792) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2123, 0x2923, 0x2923, 0x2924, 0x2924, 0x2923, 0x2923,   // 0x5D00 (23808) pixels
-0x3985, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x5D10 (23824) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2965, 0x2924, 0x2924, 0x2944, 0x2944,   // 0x5D20 (23840) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0xB4F0, 0x7B8B, 0x2944, 0x2944, 0x2944,   // 0x5D30 (23856) pixels
-0x5AA9, 0xACAF, 0x41E6, 0x2944, 0x2944, 0x3144, 0x9C2E, 0x5247, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2124, 0x2923, 0x2124,   // 0x5D40 (23872) pixels
-0x2124, 0x2123, 0x2924, 0x2924, 0x2103, 0x2923, 0x2924, 0x838C, 0x5227, 0x2103, 0x2944, 0x7B6B, 0x3985, 0x2103, 0x730A, 0x4A06,   // 0x5D50 (23888) pixels
-0x20E3, 0x20E3, 0x2103, 0x2924, 0x2924, 0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x39C6, 0x5248, 0x3144, 0x3164, 0x730A, 0xAC8F,   // 0x5D60 (23904) pixels
-0x7B4B, 0xC593, 0x9C2E, 0x3185, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x20E3, 0x18C2,   // 0x5D70 (23920) pixels
-0x7B6C, 0x8BCD, 0x942E, 0x93EE, 0x940D, 0x942E, 0x940E, 0x8BED, 0x83CD, 0x7B6C, 0x62EA, 0x18A2, 0x18A2, 0x2104, 0x2103, 0x20E3,   // 0x5D80 (23936) pixels
-0x2103, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x1081, 0x10A2, 0x0841, 0x0861, 0x0881, 0x1081, 0x1081, 0x1082, 0x1082,   // 0x5D90 (23952) pixels
-0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10C2, 0x18C3, 0x20E3, 0x18E3, 0x10C2, 0x18C2, 0x18A2, 0x18C2, 0x10A2, 0x10A2,   // 0x5DA0 (23968) pixels
-0x0861, 0x0000, 0x0000, 0x0020, 0x0840, 0x0861, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x5DB0 (23984) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x5DC0 (24000) pixels
-0x1061, 0x1081, 0x0861, 0x1081, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061, 0x1081, 0x0861,   // 0x5DD0 (24016) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861,   // 0x5DE0 (24032) pixels
-0x0861, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x5DF0 (24048) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x0861, 0x10A2, 0x1082, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2124, 0x1904, 0x2104,   // 0x5E00 (24064) pixels
-0x2124, 0x2144, 0x2945, 0x2965, 0x1925, 0x18C2, 0x5AA9, 0x7B6B, 0x7B8C, 0x83AC, 0x83AC, 0x83AC, 0x8BCD, 0x83AC, 0x41C6, 0x10A2,   // 0x5E10 (24080) pixels
-0x1904, 0x2945, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2945, 0x2945, 0x3165, 0x3165, 0x93EE, 0xC572, 0x5A89,   // 0x5E20 (24096) pixels
-0x3185, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2924, 0x2924, 0x2103, 0x18E3, 0x20E3, 0x2103, 0x20E3,   // 0x5E30 (24112) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2903, 0x2924, 0x2123, 0x2123, 0x2123, 0x2924, 0x2923, 0x2923, 0x2924, 0x2924, 0x3165,   // 0x5E40 (24128) pixels
-0x39A5, 0x2924, 0x2923, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x3144, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x5E50 (24144) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x5E60 (24160) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0xACD0, 0x7B8B, 0x3144, 0x2944, 0x2944,   // 0x5E70 (24176) pixels
-0x6B2A, 0xA4AF, 0x2944, 0x3144, 0x3144, 0x2944, 0x83AC, 0x5A88, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x5E80 (24192) pixels
-0x2124, 0x2124, 0x2924, 0x2924, 0x2923, 0x2923, 0x2944, 0x838C, 0x7B4B, 0x6AC9, 0x6B0A, 0x8BED, 0x39A5, 0x2103, 0x734B, 0x41E6,   // 0x5E90 (24208) pixels
-0x20E3, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x3165, 0x3144, 0x3164, 0x3164, 0x7B6B, 0xACCF,   // 0x5EA0 (24224) pixels
-0xACAF, 0x9C2E, 0x4A27, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x3144, 0x2944, 0x2944, 0x18E3,   // 0x5EB0 (24240) pixels
-0x18C2, 0x5247, 0x83CC, 0x8BED, 0x8BED, 0x8BED, 0x83CC, 0x838C, 0x734B, 0x4A07, 0x18A2, 0x18C2, 0x20E3, 0x2104, 0x2103, 0x20E3,   // 0x5EC0 (24256) pixels
-0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1081, 0x0861, 0x0861, 0x0861, 0x0881, 0x0881, 0x1081, 0x1081,   // 0x5ED0 (24272) pixels
-0x1061, 0x1081, 0x1082, 0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x10C3, 0x10A2, 0x18C2, 0x10C2, 0x10A2, 0x1082,   // 0x5EE0 (24288) pixels
-0x1082, 0x0000, 0x0000, 0x0020, 0x0840, 0x0841, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x5EF0 (24304) pixels
-0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x5F00 (24320) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1062, 0x0861, 0x0861,   // 0x5F10 (24336) pixels
-0x0881, 0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0841, 0x0861,   // 0x5F20 (24352) pixels
-0x1082, 0x10A2, 0x18C2, 0x10C2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x1081, 0x10A2, 0x10A2, 0x10A2,   // 0x5F30 (24368) pixels
-0x18A2, 0x10A2, 0x18A2, 0x10A2, 0x0861, 0x0841, 0x1082, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x2104, 0x2104,   // 0x5F40 (24384) pixels
-0x2124, 0x2124, 0x2124, 0x2965, 0x3185, 0x2165, 0x1925, 0x18A2, 0x1061, 0x18A2, 0x3985, 0x41E6, 0x18C2, 0x18A2, 0x1924, 0x2145,   // 0x5F50 (24400) pixels
-0x2945, 0x2965, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x3985, 0x6AEA, 0xB4F0,   // 0x5F60 (24416) pixels
-0x62A9, 0x2944, 0x2944, 0x3185, 0x39A6, 0x3185, 0x2944, 0x2944, 0x2924, 0x2944, 0x18E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2903,   // 0x5F70 (24432) pixels
-0x2103, 0x2903, 0x2103, 0x2124, 0x2123, 0x2124, 0x2923, 0x2123, 0x2124, 0x2924, 0x2123, 0x2924, 0x2924, 0x2924, 0x2923, 0x3985,   // 0x5F80 (24448) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3164, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944,   // 0x5F90 (24464) pixels
-0x2944, 0x3164, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x5FA0 (24480) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0xACB0, 0x732B, 0x3164, 0x3144, 0x3144,   // 0x5FB0 (24496) pixels
-0x62C9, 0xACD0, 0x41E6, 0x3164, 0x3164, 0x3164, 0xACD0, 0x4A07, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x5FC0 (24512) pixels
-0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2944, 0x8BCD, 0x5A48, 0x2944, 0x39A5, 0x940E, 0x3985, 0x2903, 0x62C9, 0x41C6,   // 0x5FD0 (24528) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x2944, 0x2924, 0x2944, 0x2944, 0x2965, 0x3165, 0x2944, 0x3164, 0x8BCC, 0xBD31,   // 0x5FE0 (24544) pixels
-0x9C4F, 0x3985, 0x3185, 0x3165, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x3165,   // 0x5FF0 (24560) pixels
-0x2924, 0x2103, 0x18C3, 0x18C2, 0x2924, 0x2924, 0x2103, 0x18C2, 0x18C2, 0x18C2, 0x2104, 0x2944, 0x2924, 0x2104, 0x2103, 0x2103,   // 0x6000 (24576) pixels
-0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x18C3, 0x1082, 0x0020, 0x0841, 0x0861, 0x1081, 0x1081, 0x1081,   // 0x6010 (24592) pixels
-0x1081, 0x1061, 0x1081, 0x1081, 0x0861, 0x1082, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x10C2, 0x10C2, 0x10C2, 0x10A2,   // 0x6020 (24608) pixels
-0x1081, 0x1081, 0x0020, 0x0000, 0x0020, 0x0840, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x6030 (24624) pixels
-0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x6040 (24640) pixels
-0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x1081, 0x0861, 0x1061, 0x1062, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1081,   // 0x6050 (24656) pixels
-0x0881, 0x1081, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0000, 0x0000, 0x0020, 0x0861, 0x0881,   // 0x6060 (24672) pixels
-0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x1082, 0x10A2, 0x10A3, 0x10A2, 0x10A2,   // 0x6070 (24688) pixels
-0x18A2, 0x10A2, 0x10A2, 0x1082, 0x0041, 0x10A2, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x2104, 0x2103, 0x2104,   // 0x6080 (24704) pixels
-0x2124, 0x2124, 0x2124, 0x2144, 0x2965, 0x2965, 0x3185, 0x31A6, 0x31A6, 0x2986, 0x2965, 0x2965, 0x3186, 0x31A6, 0x2965, 0x2965,   // 0x6090 (24720) pixels
-0x2945, 0x2965, 0x2945, 0x2944, 0x2945, 0x2945, 0x3185, 0x2965, 0x2945, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x4A07,   // 0x60A0 (24736) pixels
-0x3185, 0x2965, 0x3185, 0x2944, 0x2944, 0x2944, 0x2924, 0x2123, 0x20E3, 0x18E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2964, 0x2103,   // 0x60B0 (24752) pixels
-0x2123, 0x2923, 0x2924, 0x2923, 0x2923, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x60C0 (24768) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2964, 0x2944, 0x3164, 0x2944,   // 0x60D0 (24784) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2965, 0x2944, 0x3144,   // 0x60E0 (24800) pixels
-0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x3144, 0x2944, 0x9C2F, 0x7B6C, 0x41C6, 0x41A5, 0x39A5,   // 0x60F0 (24816) pixels
-0x3185, 0x732B, 0x9C4F, 0x5A89, 0x4A06, 0x7B4B, 0x9C2F, 0x3164, 0x3164, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944,   // 0x6100 (24832) pixels
-0x2944, 0x2924, 0x2924, 0x2923, 0x2924, 0x2924, 0x2944, 0x8BAD, 0x5A68, 0x2944, 0x39A5, 0x9C4E, 0x39A5, 0x2923, 0x7B8C, 0x5247,   // 0x6110 (24848) pixels
-0x2923, 0x2123, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3165, 0x4A07, 0x7B6B,   // 0x6120 (24864) pixels
-0x3165, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x3145, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x3144,   // 0x6130 (24880) pixels
-0x3164, 0x3185, 0x3185, 0x3185, 0x2924, 0x2124, 0x2124, 0x2944, 0x2965, 0x2944, 0x2944, 0x2924, 0x2103, 0x2104, 0x2104, 0x2103,   // 0x6140 (24896) pixels
-0x20E3, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x1061, 0x10A2, 0x0020, 0x0861, 0x0881, 0x1082, 0x1082,   // 0x6150 (24912) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x18C2, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18A2, 0x10C2, 0x18C2, 0x18C2, 0x10A2,   // 0x6160 (24928) pixels
-0x10A2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0820, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x6170 (24944) pixels
-0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x6180 (24960) pixels
-0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081,   // 0x6190 (24976) pixels
-0x1081, 0x1061, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x0861, 0x1082,   // 0x61A0 (24992) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x61B0 (25008) pixels
-0x10A2, 0x18A2, 0x10A2, 0x0881, 0x10A2, 0x1081, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x2104, 0x2104,   // 0x61C0 (25024) pixels
-0x2124, 0x2124, 0x2924, 0x2124, 0x2924, 0x2945, 0x2965, 0x3185, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186, 0x3165, 0x2965, 0x2965,   // 0x61D0 (25040) pixels
-0x2945, 0x2965, 0x2945, 0x2944, 0x2944, 0x2944, 0x3185, 0x2965, 0x2945, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944,   // 0x61E0 (25056) pixels
-0x2944, 0x3165, 0x2944, 0x2964, 0x2924, 0x2944, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2923, 0x2944, 0x2944,   // 0x61F0 (25072) pixels
-0x2923, 0x2923, 0x2924, 0x2923, 0x2924, 0x2924, 0x2923, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924,   // 0x6200 (25088) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2964, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3164, 0x3144, 0x3144,   // 0x6210 (25104) pixels
-0x3164, 0x3164, 0x3144, 0x2944, 0x3144, 0x3144, 0x2944, 0x3164, 0x3144, 0x2944, 0x2944, 0x3185, 0x3144, 0x2944, 0x2945, 0x3144,   // 0x6220 (25120) pixels
-0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x3144, 0x2944, 0x3144, 0x3144, 0x9C0E, 0xACB0, 0xA46F, 0xA44F, 0x7B6B,   // 0x6230 (25136) pixels
-0x3164, 0x39A5, 0x8BED, 0xA46F, 0xA46F, 0x940E, 0x41C6, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x6240 (25152) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x7B6B, 0x5247, 0x3144, 0x39A5, 0x8BCC, 0x3985, 0x2923, 0x732B, 0x5247,   // 0x6250 (25168) pixels
-0x2923, 0x2923, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2924, 0x2944, 0x3144, 0x3165, 0x3165, 0x3165, 0x3165,   // 0x6260 (25184) pixels
-0x3145, 0x3165, 0x2944, 0x2964, 0x2944, 0x2944, 0x3145, 0x3145, 0x2944, 0x3986, 0x2944, 0x2964, 0x2944, 0x2944, 0x2924, 0x2924,   // 0x6270 (25200) pixels
-0x3144, 0x2945, 0x3144, 0x3165, 0x3185, 0x3185, 0x3185, 0x3164, 0x2944, 0x2924, 0x2924, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103,   // 0x6280 (25216) pixels
-0x2103, 0x20E3, 0x2103, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x1081, 0x1061, 0x0861, 0x0861, 0x1081, 0x1082,   // 0x6290 (25232) pixels
-0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x0861, 0x18A2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x10C2,   // 0x62A0 (25248) pixels
-0x10A2, 0x1081, 0x10A2, 0x0000, 0x0020, 0x0020, 0x0841, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x62B0 (25264) pixels
-0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x62C0 (25280) pixels
-0x1081, 0x1061, 0x1082, 0x0881, 0x0861, 0x0861, 0x0881, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x62D0 (25296) pixels
-0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0861, 0x1082, 0x10A2,   // 0x62E0 (25312) pixels
-0x10A2, 0x18C2, 0x10C2, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2,   // 0x62F0 (25328) pixels
-0x10A2, 0x10A2, 0x0861, 0x0861, 0x1082, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2124, 0x2124,   // 0x6300 (25344) pixels
-0x2924, 0x2124, 0x2124, 0x2125, 0x2944, 0x2945, 0x2944, 0x2945, 0x2945, 0x2945, 0x2965, 0x2945, 0x2944, 0x2945, 0x2945, 0x2945,   // 0x6310 (25360) pixels
-0x2945, 0x2965, 0x2945, 0x2944, 0x2944, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x6320 (25376) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2103, 0x18C2, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2923, 0x2923, 0x2923, 0x2923,   // 0x6330 (25392) pixels
-0x2923, 0x2943, 0x2923, 0x2923, 0x2923, 0x2923, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924,   // 0x6340 (25408) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3144, 0x2944, 0x2944, 0x3144, 0x3144, 0x3164, 0x3144, 0x3164, 0x3144, 0x3164,   // 0x6350 (25424) pixels
-0x3144, 0x3144, 0x3144, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x2944, 0x2964, 0x2944, 0x2944, 0x3165, 0x2944, 0x3144,   // 0x6360 (25440) pixels
-0x3165, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3165, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144, 0x3164, 0x3164,   // 0x6370 (25456) pixels
-0x3184, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x6380 (25472) pixels
-0x3165, 0x3165, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2923, 0x2944, 0x3164, 0x3143, 0x2943, 0x3143, 0x2923, 0x2923, 0x2923,   // 0x6390 (25488) pixels
-0x2923, 0x2923, 0x2923, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2924, 0x2944, 0x3165, 0x2944, 0x2944,   // 0x63A0 (25504) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x63B0 (25520) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2124, 0x2124, 0x2124, 0x2904, 0x2104, 0x2103, 0x2104, 0x2103,   // 0x63C0 (25536) pixels
-0x2103, 0x2103, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x1082, 0x1082, 0x0820, 0x0861, 0x1082, 0x1082,   // 0x63D0 (25552) pixels
-0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x18C2, 0x10A2, 0x10A2, 0x10C2, 0x18A2, 0x18C2, 0x18C3, 0x10C2, 0x18A2, 0x10C2, 0x10A2,   // 0x63E0 (25568) pixels
-0x18C2, 0x10A2, 0x10A2, 0x0020, 0x0020, 0x0020, 0x0820, 0x0841, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x63F0 (25584) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082,   // 0x6400 (25600) pixels
-0x1061, 0x1061, 0x0861, 0x1061, 0x0881, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x6410 (25616) pixels
-0x0861, 0x0861, 0x0881, 0x0861, 0x0881, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0841, 0x0861, 0x10A2, 0x10A2,   // 0x6420 (25632) pixels
-0x10A2, 0x18C2, 0x10A2, 0x18C3, 0x18C2, 0x10C2, 0x18C2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x6430 (25648) pixels
-0x10A2, 0x1082, 0x0040, 0x1082, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124,   // 0x6440 (25664) pixels
-0x2124, 0x2124, 0x2124, 0x2944, 0x2944, 0x2144, 0x2924, 0x2144, 0x2945, 0x2944, 0x2944, 0x2945, 0x2945, 0x2945, 0x2944, 0x2944,   // 0x6450 (25680) pixels
-0x2965, 0x2944, 0x2945, 0x2965, 0x2944, 0x2944, 0x2945, 0x2945, 0x2945, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x6460 (25696) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2124, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2923, 0x2923, 0x2923, 0x2923, 0x3143,   // 0x6470 (25712) pixels
-0x3143, 0x3143, 0x3143, 0x2943, 0x2943, 0x2943, 0x2923, 0x3144, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x6480 (25728) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3985, 0x3184, 0x3164, 0x3144, 0x3164, 0x3144, 0x3164, 0x3985, 0x3164, 0x3164, 0x3164, 0x3164,   // 0x6490 (25744) pixels
-0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144, 0x3164, 0x3164, 0x3144, 0x3144, 0x2944, 0x3164, 0x3164, 0x2944, 0x3144,   // 0x64A0 (25760) pixels
-0x3165, 0x3144, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3984, 0x3164, 0x3984,   // 0x64B0 (25776) pixels
-0x39A4, 0x3984, 0x3164, 0x3184, 0x3164, 0x3164, 0x3164, 0x3164, 0x2944, 0x3144, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x64C0 (25792) pixels
-0x3164, 0x2924, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3143, 0x3164, 0x3164, 0x3164, 0x3163, 0x3143, 0x3143, 0x3143,   // 0x64D0 (25808) pixels
-0x2943, 0x2923, 0x2923, 0x2923, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x18E2, 0x2923, 0x2924, 0x2944, 0x3165, 0x2944,   // 0x64E0 (25824) pixels
-0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x64F0 (25840) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2104, 0x2103, 0x2103, 0x2103,   // 0x6500 (25856) pixels
-0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x1081, 0x1082, 0x0840, 0x1061, 0x1082,   // 0x6510 (25872) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x10C2, 0x10C2, 0x18C2,   // 0x6520 (25888) pixels
-0x18C2, 0x18A2, 0x10A2, 0x1082, 0x0000, 0x0020, 0x0020, 0x0840, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x6530 (25904) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x6540 (25920) pixels
-0x1082, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0881, 0x1081, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x0861,   // 0x6550 (25936) pixels
-0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x1082, 0x10A2, 0x10A2,   // 0x6560 (25952) pixels
-0x18A2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18A2, 0x10A2, 0x10A2, 0x1082, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x6570 (25968) pixels
-0x10A2, 0x1081, 0x10A2, 0x1082, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124,   // 0x6580 (25984) pixels
-0x2124, 0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2144, 0x2944, 0x2965, 0x2944, 0x2945, 0x2945, 0x2965,   // 0x6590 (26000) pixels
-0x2944, 0x2944, 0x2944, 0x2965, 0x2945, 0x2944, 0x2945, 0x2965, 0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x65A0 (26016) pixels
-0x2944, 0x2924, 0x2924, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2903, 0x2944, 0x2923, 0x2943, 0x3143, 0x1061,   // 0x65B0 (26032) pixels
-0x3185, 0x39E6, 0x39C6, 0x39C6, 0x2965, 0x0841, 0x3143, 0x2943, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x65C0 (26048) pixels
-0x2944, 0x2965, 0x3165, 0x41C6, 0x3985, 0x3144, 0x3184, 0x41C5, 0x3164, 0x4A07, 0x41E6, 0x41C5, 0x3163, 0x1061, 0x3185, 0x39E6,   // 0x65D0 (26064) pixels
-0x39C6, 0x39C6, 0x2965, 0x1081, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144, 0x2944, 0x3164, 0x2964, 0x2944, 0x2944, 0x3164,   // 0x65E0 (26080) pixels
-0x3985, 0x3144, 0x2944, 0x3165, 0x3164, 0x3144, 0x3165, 0x41C6, 0x3164, 0x3164, 0x3164, 0x3163, 0x10A2, 0x2103, 0x39C6, 0x39C6,   // 0x65F0 (26096) pixels
-0x39C6, 0x39C6, 0x0841, 0x3143, 0x3164, 0x3164, 0x3164, 0x3164, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x3985, 0x39A5,   // 0x6600 (26112) pixels
-0x2944, 0x3185, 0x3185, 0x2944, 0x2944, 0x2944, 0x3164, 0x3164, 0x3164, 0x3163, 0x1061, 0x2103, 0x39E6, 0x39C6, 0x39C6, 0x39C6,   // 0x6610 (26128) pixels
-0x0841, 0x3143, 0x2923, 0x2923, 0x2923, 0x2123, 0x2103, 0x2103, 0x20E2, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2924, 0x2944, 0x3165,   // 0x6620 (26144) pixels
-0x2965, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x6630 (26160) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2103,   // 0x6640 (26176) pixels
-0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x1081, 0x1081, 0x0861, 0x1081,   // 0x6650 (26192) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10C2, 0x18C3,   // 0x6660 (26208) pixels
-0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x0000, 0x0020, 0x0020, 0x0840, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081,   // 0x6670 (26224) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x6680 (26240) pixels
-0x1061, 0x1082, 0x0861, 0x0861, 0x1081, 0x1082, 0x0881, 0x0882, 0x1082, 0x1082, 0x1082, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x6690 (26256) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0861, 0x10A2, 0x10C2, 0x10C2,   // 0x66A0 (26272) pixels
-0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2,   // 0x66B0 (26288) pixels
-0x1082, 0x0841, 0x1082, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2104, 0x2104, 0x2104, 0x2103, 0x2124, 0x2924,   // 0x66C0 (26304) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944,   // 0x66D0 (26320) pixels
-0x3185, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944,   // 0x66E0 (26336) pixels
-0x2924, 0x2924, 0x2924, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2123, 0x2923, 0x3164, 0x2943, 0x3142, 0x1061, 0x5AAA,   // 0x66F0 (26352) pixels
-0x630A, 0x630B, 0x62EA, 0x62EA, 0x5AEA, 0x5ACA, 0x1081, 0x3143, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3144,   // 0x6700 (26368) pixels
-0x2944, 0x2944, 0x3185, 0x41E6, 0x3164, 0x3144, 0x3144, 0x3164, 0x3164, 0x5248, 0x5268, 0x41C5, 0x2964, 0x5AAA, 0x630A, 0x630B,   // 0x6710 (26384) pixels
-0x62EA, 0x62EA, 0x5AEA, 0x4A68, 0x1081, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x2965, 0x3164, 0x3165,   // 0x6720 (26400) pixels
-0x3185, 0x3144, 0x3144, 0x3144, 0x3164, 0x3144, 0x3144, 0x3164, 0x3184, 0x3164, 0x3163, 0x1061, 0x4A48, 0x630B, 0x630B, 0x630B,   // 0x6730 (26416) pixels
-0x62EA, 0x62EA, 0x5ACA, 0x2944, 0x3143, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x39C6,   // 0x6740 (26432) pixels
-0x3144, 0x39A6, 0x2944, 0x3144, 0x2944, 0x2944, 0x3144, 0x3163, 0x3163, 0x1061, 0x5AAA, 0x630B, 0x630B, 0x630B, 0x62EA, 0x62EA,   // 0x6750 (26448) pixels
-0x5ACA, 0x1081, 0x2923, 0x2923, 0x2923, 0x2123, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x2924, 0x2924, 0x2944,   // 0x6760 (26464) pixels
-0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x6770 (26480) pixels
-0x2944, 0x2944, 0x2945, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2104,   // 0x6780 (26496) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x1081, 0x1081, 0x0820, 0x0861,   // 0x6790 (26512) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x10C3,   // 0x67A0 (26528) pixels
-0x18C3, 0x18C2, 0x18C2, 0x1082, 0x0861, 0x0000, 0x0020, 0x0820, 0x0820, 0x0861, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x67B0 (26544) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x67C0 (26560) pixels
-0x1061, 0x1082, 0x1061, 0x0861, 0x1081, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1082, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x67D0 (26576) pixels
-0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0040, 0x0020, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10C2,   // 0x67E0 (26592) pixels
-0x18C2, 0x18C2, 0x10A2, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x1082, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x1082,   // 0x67F0 (26608) pixels
-0x0841, 0x10A2, 0x18E3, 0x18C3, 0x3185, 0x41E6, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x4A07, 0x3185, 0x2104, 0x2124, 0x3165, 0x5A89,   // 0x6800 (26624) pixels
-0x62EA, 0x6ACA, 0x6B0A, 0x6AEA, 0x5A89, 0x2944, 0x2945, 0x2144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3185, 0x2944,   // 0x6810 (26640) pixels
-0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x2944, 0x2945, 0x3165,   // 0x6820 (26656) pixels
-0x2944, 0x2124, 0x18C3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2903, 0x2923, 0x2944, 0x3143, 0x3143, 0x4A27, 0x6B0A, 0x6B2B,   // 0x6830 (26672) pixels
-0x6B2B, 0x734C, 0x6B2B, 0x632B, 0x630B, 0x62EA, 0x62EA, 0x1061, 0x3163, 0x2944, 0x3164, 0x2964, 0x2944, 0x2944, 0x2945, 0x3164,   // 0x6840 (26688) pixels
-0x2944, 0x3164, 0x2944, 0x3144, 0x3144, 0x3144, 0x3164, 0x3164, 0x3164, 0x4A06, 0x1081, 0x4A27, 0x6B0A, 0x6B2B, 0x6B2B, 0x734C,   // 0x6850 (26704) pixels
-0x6B2B, 0x630B, 0x630B, 0x5ACA, 0x62EA, 0x1061, 0x3164, 0x3164, 0x3164, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x39C6,   // 0x6860 (26720) pixels
-0x3165, 0x3164, 0x3164, 0x3144, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3163, 0x18E3, 0x6B0A, 0x6B2B, 0x6B4B, 0x6B4B, 0x734C,   // 0x6870 (26736) pixels
-0x632B, 0x630B, 0x62EA, 0x5ACA, 0x2124, 0x10A2, 0x2944, 0x3164, 0x3164, 0x2964, 0x2944, 0x2944, 0x3164, 0x3144, 0x2944, 0x3164,   // 0x6880 (26752) pixels
-0x2944, 0x3165, 0x2944, 0x2944, 0x3144, 0x3164, 0x3164, 0x3163, 0x18E3, 0x6B0A, 0x6B2B, 0x6B4B, 0x734C, 0x734C, 0x632B, 0x630B,   // 0x6890 (26768) pixels
-0x62EA, 0x62EA, 0x2124, 0x2943, 0x2923, 0x2923, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x2103, 0x2924,   // 0x68A0 (26784) pixels
-0x2924, 0x2944, 0x2944, 0x3165, 0x2944, 0x3165, 0x2965, 0x2944, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x68B0 (26800) pixels
-0x2944, 0x2965, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124,   // 0x68C0 (26816) pixels
-0x2103, 0x2104, 0x2103, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x1081, 0x10A2, 0x0840,   // 0x68D0 (26832) pixels
-0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x1082, 0x10A2, 0x10C3, 0x18C3, 0x10C2, 0x18C3, 0x18C3,   // 0x68E0 (26848) pixels
-0x18C2, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x0000, 0x0020, 0x0020, 0x0820, 0x0841, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x68F0 (26864) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x6900 (26880) pixels
-0x1062, 0x1061, 0x0881, 0x0881, 0x0861, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x6910 (26896) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x0882, 0x10A2, 0x10A2, 0x10A2, 0x10C2,   // 0x6920 (26912) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x10A2, 0x1082, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x1082, 0x0861,   // 0x6930 (26928) pixels
-0x1082, 0x1082, 0x18E3, 0x2103, 0x5A89, 0x6B0B, 0x3985, 0x20E3, 0x20E3, 0x2103, 0x7B6C, 0x4A48, 0x2104, 0x2124, 0x41C6, 0x5247,   // 0x6940 (26944) pixels
-0x5268, 0x940E, 0x7B8C, 0x5A68, 0x5248, 0x2944, 0x2945, 0x2944, 0x2965, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945,   // 0x6950 (26960) pixels
-0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0x6960 (26976) pixels
-0x2103, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2923, 0x2944, 0x2944, 0x3163, 0x41E6, 0x734B, 0x736C, 0x7B8C,   // 0x6970 (26992) pixels
-0x7B8C, 0x7B8C, 0x736C, 0x736C, 0x6B2B, 0x62EA, 0x5ACA, 0x5ACA, 0x18C2, 0x3164, 0x3144, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944,   // 0x6980 (27008) pixels
-0x2944, 0x2964, 0x2964, 0x3164, 0x2944, 0x3164, 0x3164, 0x3164, 0x3164, 0x3983, 0x62EA, 0x734B, 0x736B, 0x7B8C, 0x7B8C, 0x7B8C,   // 0x6990 (27024) pixels
-0x736C, 0x734C, 0x6B2B, 0x5ACA, 0x5ACA, 0x5ACA, 0x1081, 0x3164, 0x2964, 0x2944, 0x3164, 0x3164, 0x3165, 0x3164, 0x3165, 0x39C6,   // 0x69A0 (27040) pixels
-0x2944, 0x3165, 0x3164, 0x3144, 0x3164, 0x3185, 0x3164, 0x3164, 0x3984, 0x0841, 0x732B, 0x736C, 0x736C, 0x7B8C, 0x7B8C, 0x7B8C,   // 0x69B0 (27056) pixels
-0x736C, 0x6B4B, 0x62EA, 0x5ACA, 0x5ACA, 0x4207, 0x3143, 0x2944, 0x3164, 0x2964, 0x2944, 0x39A6, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x69C0 (27072) pixels
-0x3185, 0x3185, 0x2964, 0x2944, 0x3164, 0x3164, 0x3163, 0x41E6, 0x732B, 0x736C, 0x7B8C, 0x7B8C, 0x7B8C, 0x7B8C, 0x736C, 0x6B4B,   // 0x69D0 (27088) pixels
-0x62EA, 0x5ACA, 0x5ACA, 0x18C2, 0x2943, 0x2923, 0x2923, 0x2123, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103,   // 0x69E0 (27104) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2945, 0x2944, 0x2944,   // 0x69F0 (27120) pixels
-0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924,   // 0x6A00 (27136) pixels
-0x2103, 0x2103, 0x2104, 0x2103, 0x2104, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x1082, 0x1082,   // 0x6A10 (27152) pixels
-0x0861, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0881, 0x10A2, 0x18C2, 0x10C2, 0x18C3, 0x18C3, 0x18C3,   // 0x6A20 (27168) pixels
-0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x1081, 0x10A2, 0x0000, 0x0020, 0x0020, 0x0840, 0x0861, 0x1061, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x6A30 (27184) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x6A40 (27200) pixels
-0x1062, 0x1082, 0x0882, 0x0881, 0x1061, 0x1061, 0x1082, 0x1081, 0x1061, 0x1082, 0x1081, 0x1061, 0x1061, 0x0861, 0x1081, 0x0861,   // 0x6A50 (27216) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0000, 0x0000, 0x0881, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2,   // 0x6A60 (27232) pixels
-0x18C2, 0x18C2, 0x18C2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0881, 0x0841,   // 0x6A70 (27248) pixels
-0x1081, 0x18E3, 0x18C2, 0x2924, 0x4A48, 0x5288, 0x4207, 0x2103, 0x2103, 0x2124, 0x7B6B, 0x5248, 0x2103, 0x2124, 0x2924, 0x2944,   // 0x6A80 (27264) pixels
-0x2944, 0x838C, 0x6B2A, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944,   // 0x6A90 (27280) pixels
-0x2945, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2924, 0x2924, 0x2103,   // 0x6AA0 (27296) pixels
-0x18C3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2123, 0x2924, 0x2944, 0x3143, 0x0861, 0x732B, 0x736B, 0x7B8C, 0x7BAC,   // 0x6AB0 (27312) pixels
-0x7B8C, 0x7B8C, 0x7B8C, 0x738C, 0x734B, 0x62EB, 0x5ACA, 0x5AA9, 0x4A68, 0x3164, 0x3164, 0x3164, 0x3144, 0x3164, 0x2944, 0x2944,   // 0x6AC0 (27328) pixels
-0x2944, 0x2964, 0x2944, 0x3164, 0x3144, 0x3164, 0x3164, 0x3184, 0x3184, 0x0861, 0x734B, 0x736B, 0x7BAC, 0x7BAC, 0x7B8C, 0x7B8C,   // 0x6AD0 (27344) pixels
-0x7B8C, 0x736C, 0x734B, 0x62EA, 0x5ACA, 0x5AA9, 0x2944, 0x3164, 0x2964, 0x3144, 0x3144, 0x3164, 0x3164, 0x2964, 0x3185, 0x3184,   // 0x6AE0 (27360) pixels
-0x3164, 0x3164, 0x3144, 0x3164, 0x3164, 0x3184, 0x3164, 0x3164, 0x3983, 0x4A27, 0x734B, 0x7B8C, 0x83AC, 0x7BAC, 0x7B8C, 0x7BAD,   // 0x6AF0 (27376) pixels
-0x738C, 0x736C, 0x62EB, 0x5ACA, 0x5AA9, 0x5ACA, 0x1082, 0x3144, 0x3164, 0x2964, 0x2944, 0x2944, 0x2964, 0x3164, 0x2944, 0x3184,   // 0x6B00 (27392) pixels
-0x2944, 0x2944, 0x3164, 0x3164, 0x3164, 0x3164, 0x3163, 0x732B, 0x734B, 0x7B8C, 0x7BAC, 0x7BAC, 0x7B8C, 0x7BAD, 0x738C, 0x736C,   // 0x6B10 (27408) pixels
-0x62EB, 0x5ACA, 0x5AA9, 0x4A68, 0x1082, 0x2923, 0x2923, 0x2923, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3,   // 0x6B20 (27424) pixels
-0x2103, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3144, 0x2944, 0x2944, 0x2945, 0x2965, 0x2944, 0x2944, 0x2924,   // 0x6B30 (27440) pixels
-0x2944, 0x2945, 0x2944, 0x2945, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x6B40 (27456) pixels
-0x2104, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x20E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x1082, 0x10A2,   // 0x6B50 (27472) pixels
-0x0820, 0x0861, 0x1081, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x0861, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3,   // 0x6B60 (27488) pixels
-0x18C2, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x0000, 0x0000, 0x0020, 0x0820, 0x0841, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081,   // 0x6B70 (27504) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081,   // 0x6B80 (27520) pixels
-0x0861, 0x1061, 0x0881, 0x1061, 0x1082, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x6B90 (27536) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C2,   // 0x6BA0 (27552) pixels
-0x18A2, 0x10C2, 0x10C2, 0x18C2, 0x10A2, 0x1082, 0x18C2, 0x18E3, 0x1903, 0x18C2, 0x10A2, 0x10C2, 0x10A2, 0x1081, 0x0841, 0x1082,   // 0x6BB0 (27568) pixels
-0x18E3, 0x18C2, 0x18E3, 0x41E6, 0x39C6, 0x3165, 0x6AEA, 0x2123, 0x2103, 0x2123, 0x7B8C, 0x5248, 0x2103, 0x2124, 0x2924, 0x2924,   // 0x6BC0 (27584) pixels
-0x2924, 0x83AD, 0x6B2A, 0x2124, 0x2944, 0x2944, 0x2124, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x6BD0 (27600) pixels
-0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2945, 0x2924, 0x2124, 0x2124, 0x20E3,   // 0x6BE0 (27616) pixels
-0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2123, 0x2924, 0x2944, 0x2923, 0x3164, 0x41E6, 0x83AC, 0x83AD, 0x8BED, 0x83ED,   // 0x6BF0 (27632) pixels
-0x8BEE, 0x8BEE, 0x83ED, 0x83CD, 0x7B8C, 0x736C, 0x6B2B, 0x5AEA, 0x52A9, 0x18C2, 0x3144, 0x3164, 0x3144, 0x3144, 0x2945, 0x2965,   // 0x6C00 (27648) pixels
-0x3145, 0x2964, 0x3144, 0x3164, 0x3144, 0x3164, 0x3184, 0x3184, 0x3184, 0x41E6, 0x83AC, 0x83AD, 0x83ED, 0x83ED, 0x8BEE, 0x8BEE,   // 0x6C10 (27664) pixels
-0x83ED, 0x7BAD, 0x7B8C, 0x736C, 0x6B2B, 0x5AEA, 0x5289, 0x18C2, 0x3164, 0x3164, 0x3164, 0x3144, 0x3164, 0x3164, 0x3165, 0x3144,   // 0x6C20 (27680) pixels
-0x3165, 0x3144, 0x3144, 0x3144, 0x3164, 0x3144, 0x3164, 0x3164, 0x0841, 0x734A, 0x7B8C, 0x8BED, 0x8BCD, 0x83ED, 0x83ED, 0x83ED,   // 0x6C30 (27696) pixels
-0x83CD, 0x7B8C, 0x736C, 0x6B4B, 0x62EA, 0x5ACA, 0x39C6, 0x3144, 0x3164, 0x3165, 0x2944, 0x3164, 0x3144, 0x3164, 0x3164, 0x3144,   // 0x6C40 (27712) pixels
-0x2964, 0x2944, 0x2944, 0x3164, 0x3164, 0x3164, 0x0841, 0x83AC, 0x7B8C, 0x8BED, 0x83ED, 0x83ED, 0x8BEE, 0x83ED, 0x83CD, 0x7B8C,   // 0x6C50 (27728) pixels
-0x736C, 0x6B2B, 0x62EA, 0x52A9, 0x39C6, 0x2923, 0x2923, 0x2923, 0x2123, 0x2124, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3,   // 0x6C60 (27744) pixels
-0x20E3, 0x2103, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x2924,   // 0x6C70 (27760) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3145, 0x2945, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0x6C80 (27776) pixels
-0x2124, 0x2924, 0x2124, 0x2124, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x18C2, 0x18E3, 0x18C2, 0x18C3, 0x1082,   // 0x6C90 (27792) pixels
-0x10A2, 0x0841, 0x1061, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18C2,   // 0x6CA0 (27808) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18A2, 0x10A2, 0x1082, 0x0861, 0x0000, 0x0000, 0x0020, 0x0840, 0x0861, 0x1061, 0x1081, 0x1082, 0x1082,   // 0x6CB0 (27824) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x6CC0 (27840) pixels
-0x0861, 0x1061, 0x0861, 0x1062, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x6CD0 (27856) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10C2, 0x18C2, 0x10A2, 0x10C2, 0x10A2,   // 0x6CE0 (27872) pixels
-0x10A2, 0x18C2, 0x10A2, 0x10C2, 0x10A2, 0x0881, 0x18C2, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x0881, 0x0040, 0x1082,   // 0x6CF0 (27888) pixels
-0x18C2, 0x18C2, 0x20E3, 0x5A89, 0x3185, 0x2124, 0x732B, 0x2944, 0x2103, 0x2924, 0x83AC, 0x5268, 0x2124, 0x2924, 0x2924, 0x2924,   // 0x6D00 (27904) pixels
-0x2924, 0x83AC, 0x6B0A, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x6D10 (27920) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2103, 0x18C2, 0x20E3,   // 0x6D20 (27936) pixels
-0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2923, 0x2924, 0x2944, 0x2943, 0x3163, 0x62A9, 0x83AC, 0x83CD, 0x8BED, 0x8C0E,   // 0x6D30 (27952) pixels
-0x8BEE, 0x8BED, 0x83EE, 0x83CD, 0x7BAC, 0x738C, 0x6B4B, 0x62EA, 0x5AA9, 0x18E3, 0x3143, 0x3164, 0x3164, 0x2944, 0x2944, 0x3144,   // 0x6D40 (27968) pixels
-0x2944, 0x2964, 0x2964, 0x3144, 0x3144, 0x3164, 0x3164, 0x3184, 0x3163, 0x62A9, 0x83AC, 0x83CD, 0x8BEE, 0x8C0E, 0x8BEE, 0x8BED,   // 0x6D50 (27984) pixels
-0x83EE, 0x83CD, 0x7BAC, 0x736C, 0x6B4B, 0x62EA, 0x5289, 0x18E3, 0x3164, 0x3164, 0x3164, 0x2964, 0x3164, 0x3164, 0x3185, 0x3144,   // 0x6D60 (28000) pixels
-0x3164, 0x3164, 0x3144, 0x3144, 0x3164, 0x3164, 0x3164, 0x3164, 0x1081, 0x7B6B, 0x83AC, 0x8BED, 0x8C0E, 0x8C0E, 0x8C0E, 0x8BEE,   // 0x6D70 (28016) pixels
-0x83CD, 0x83CD, 0x738C, 0x734B, 0x630A, 0x5ACA, 0x41E6, 0x3164, 0x3164, 0x2944, 0x3164, 0x2964, 0x3164, 0x3164, 0x3144, 0x2944,   // 0x6D80 (28032) pixels
-0x2944, 0x2964, 0x2964, 0x3164, 0x3164, 0x3163, 0x1081, 0x83AC, 0x83AC, 0x8BED, 0x8C0E, 0x8C0E, 0x8BED, 0x8BEE, 0x83CD, 0x83CD,   // 0x6D90 (28048) pixels
-0x738C, 0x6B4B, 0x630A, 0x5AA9, 0x41E6, 0x2944, 0x2923, 0x2924, 0x2923, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3,   // 0x6DA0 (28064) pixels
-0x20E3, 0x18C2, 0x2103, 0x2924, 0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x6DB0 (28080) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x3145, 0x3165, 0x3165, 0x3185, 0x3185, 0x3165, 0x2944, 0x2944, 0x2944, 0x3165, 0x3164, 0x2944,   // 0x6DC0 (28096) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103, 0x2924, 0x2103, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18C2, 0x18C3,   // 0x6DD0 (28112) pixels
-0x10A2, 0x0840, 0x0861, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x1061, 0x10A2, 0x18C3, 0x18C3, 0x20E3, 0x18E3,   // 0x6DE0 (28128) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x1082, 0x0000, 0x0000, 0x0020, 0x0820, 0x0841, 0x0861, 0x1081, 0x1082, 0x1082,   // 0x6DF0 (28144) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x6E00 (28160) pixels
-0x1061, 0x0861, 0x1081, 0x1061, 0x1061, 0x0881, 0x0861, 0x1081, 0x1061, 0x1082, 0x1061, 0x1081, 0x1061, 0x1081, 0x1061, 0x0861,   // 0x6E10 (28176) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0000, 0x0000, 0x0841, 0x0861, 0x10A2, 0x18E3, 0x18C3, 0x10A2, 0x10C2, 0x10A2,   // 0x6E20 (28192) pixels
-0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x0881, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x0861, 0x10A2, 0x10C2,   // 0x6E30 (28208) pixels
-0x18C3, 0x18E3, 0x3185, 0x6B2B, 0x5AA9, 0x62CA, 0x732B, 0x5248, 0x2944, 0x2924, 0x83AC, 0x5A89, 0x2103, 0x2124, 0x2124, 0x2124,   // 0x6E40 (28224) pixels
-0x2124, 0x838C, 0x732B, 0x2124, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x6E50 (28240) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x3165, 0x2944, 0x3165, 0x2944, 0x2924, 0x2124, 0x2103, 0x18E3, 0x20E3, 0x20E3,   // 0x6E60 (28256) pixels
-0x20E3, 0x2103, 0x2103, 0x2103, 0x2124, 0x2103, 0x2924, 0x3164, 0x2923, 0x2944, 0x3143, 0x7B8B, 0x83AC, 0x8BED, 0x942E, 0x942E,   // 0x6E70 (28272) pixels
-0x944F, 0x942E, 0x8C0E, 0x8BED, 0x83CD, 0x7BAD, 0x734B, 0x630B, 0x5AA9, 0x2924, 0x2944, 0x3144, 0x3164, 0x3185, 0x3164, 0x3164,   // 0x6E80 (28288) pixels
-0x3144, 0x2944, 0x3164, 0x3165, 0x3164, 0x3164, 0x3164, 0x3984, 0x3164, 0x7B8B, 0x83AC, 0x8BED, 0x9C2E, 0x942E, 0x944F, 0x942E,   // 0x6E90 (28304) pixels
-0x8C0E, 0x83ED, 0x83CD, 0x7BAD, 0x734B, 0x630B, 0x5288, 0x2924, 0x3164, 0x3164, 0x3165, 0x3164, 0x2965, 0x3165, 0x3164, 0x3164,   // 0x6EA0 (28320) pixels
-0x3165, 0x2944, 0x3164, 0x3165, 0x3164, 0x3164, 0x3164, 0x3164, 0x4A06, 0x83CD, 0x83AC, 0x942E, 0x9C2E, 0x942F, 0x942F, 0x8C0E,   // 0x6EB0 (28336) pixels
-0x8BED, 0x83CD, 0x7BAD, 0x736C, 0x6B2B, 0x62EA, 0x4207, 0x3164, 0x3164, 0x3164, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x3164,   // 0x6EC0 (28352) pixels
-0x2944, 0x3144, 0x2944, 0x3164, 0x3164, 0x3163, 0x4A06, 0x83AC, 0x83AC, 0x942E, 0x942E, 0x942F, 0x942E, 0x8C0E, 0x8BED, 0x83CD,   // 0x6ED0 (28368) pixels
-0x7BAD, 0x734B, 0x6B2B, 0x5AA9, 0x4207, 0x2944, 0x2923, 0x2923, 0x2123, 0x2103, 0x2944, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0x6EE0 (28384) pixels
-0x20E3, 0x20E3, 0x18E3, 0x2103, 0x2124, 0x2924, 0x2964, 0x2944, 0x2944, 0x2965, 0x2945, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944,   // 0x6EF0 (28400) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x730A, 0x9C0D, 0xAC8F, 0xB512, 0x9C0F, 0x8BCD, 0x41E6, 0x3165, 0xA44F, 0x8BCC, 0x8BCC, 0xA46F,   // 0x6F00 (28416) pixels
-0x4A07, 0x2944, 0x5A68, 0x93EE, 0x2924, 0x2924, 0x41C6, 0x8BEE, 0x4A07, 0x20E3, 0x20E3, 0x2924, 0x62CA, 0x4A27, 0x18C2, 0x18C2,   // 0x6F10 (28432) pixels
-0x1081, 0x1061, 0x0840, 0x1081, 0x1081, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x10A2, 0x1082, 0x1062, 0x18A2, 0x18C3, 0x18C3, 0x20E3,   // 0x6F20 (28448) pixels
-0x20E3, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x18C2, 0x1082, 0x0881, 0x0000, 0x0020, 0x0820, 0x0840, 0x0861, 0x1061, 0x1082, 0x1082,   // 0x6F30 (28464) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082,   // 0x6F40 (28480) pixels
-0x0881, 0x0861, 0x1081, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061, 0x0861, 0x1061, 0x1061, 0x0881,   // 0x6F50 (28496) pixels
-0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0000, 0x0000, 0x0000, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C3,   // 0x6F60 (28512) pixels
-0x10C2, 0x18C2, 0x10C2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10C2, 0x10C2, 0x1081, 0x18C2,   // 0x6F70 (28528) pixels
-0x18C2, 0x18E3, 0x5A89, 0x5289, 0x2104, 0x2103, 0x4207, 0x6B0B, 0x3144, 0x2924, 0x8BCD, 0x5AA9, 0x3165, 0x3164, 0x2944, 0x2944,   // 0x6F80 (28544) pixels
-0x2124, 0x83AC, 0x6B2A, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x6F90 (28560) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x4A07, 0x3185, 0x2944, 0x2924, 0x2924, 0x2124, 0x20E3, 0x20E3, 0x20E3, 0x2103,   // 0x6FA0 (28576) pixels
-0x2103, 0x2103, 0x2103, 0x2123, 0x2123, 0x2123, 0x2924, 0x2924, 0x2944, 0x2944, 0x3164, 0x730A, 0x8BCD, 0x8C0D, 0x9C2E, 0x9C4F,   // 0x6FB0 (28592) pixels
-0x9C4F, 0x9C4F, 0x940E, 0x8C0E, 0x83ED, 0x83CD, 0x7B8C, 0x6B2B, 0x5AA9, 0x18E3, 0x3164, 0x3164, 0x3165, 0x2964, 0x2964, 0x2944,   // 0x6FC0 (28608) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x3164, 0x3164, 0x3164, 0x3184, 0x3984, 0x730A, 0x8BCD, 0x8C0D, 0x9C2E, 0x9C4F, 0x9C4F, 0x9C4F,   // 0x6FD0 (28624) pixels
-0x940E, 0x8C0E, 0x83ED, 0x83AD, 0x7B8C, 0x6B2B, 0x5268, 0x18E3, 0x3164, 0x3164, 0x3164, 0x3144, 0x3144, 0x3164, 0x2944, 0x3165,   // 0x6FE0 (28640) pixels
-0x3164, 0x3164, 0x3165, 0x3164, 0x3164, 0x3164, 0x3164, 0x3184, 0x2103, 0x83CC, 0x8BCD, 0x9C2E, 0x9C4F, 0x9C6F, 0x9C4E, 0x942E,   // 0x6FF0 (28656) pixels
-0x8C0E, 0x8C0E, 0x83CD, 0x7BAD, 0x734B, 0x62EA, 0x39E6, 0x3164, 0x3164, 0x3144, 0x3164, 0x3144, 0x3164, 0x2964, 0x2964, 0x3144,   // 0x7000 (28672) pixels
-0x2944, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x2103, 0x8BCD, 0x8BCD, 0x9C2E, 0x9C4F, 0x9C6F, 0x9C4F, 0x942E, 0x8C0E, 0x8C0E,   // 0x7010 (28688) pixels
-0x83CD, 0x7B8C, 0x734B, 0x5AA9, 0x39E6, 0x2943, 0x2944, 0x2924, 0x2924, 0x2123, 0x2123, 0x2124, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0x7020 (28704) pixels
-0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x2104, 0x2924, 0x2924, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x3144,   // 0x7030 (28720) pixels
-0x2924, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x732A, 0x9C2F, 0x3185, 0x2944, 0x2944, 0x3164, 0xAC8F, 0x5A88, 0x3164, 0x5A88,   // 0x7040 (28736) pixels
-0x83AC, 0x3985, 0x5A88, 0x8BCD, 0x2924, 0x2944, 0x62C9, 0x83AC, 0x6B0B, 0x2103, 0x2124, 0x5268, 0x62CA, 0x4A27, 0x18C2, 0x18C2,   // 0x7050 (28752) pixels
-0x18C2, 0x1082, 0x0840, 0x0861, 0x1061, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1061, 0x1082, 0x18A3, 0x18C3, 0x18C3,   // 0x7060 (28768) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18A2, 0x10A2, 0x1082, 0x0000, 0x0000, 0x0020, 0x0820, 0x0841, 0x1061, 0x1082, 0x1082,   // 0x7070 (28784) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081,   // 0x7080 (28800) pixels
-0x0881, 0x0861, 0x1061, 0x0861, 0x1081, 0x0861, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061, 0x0861, 0x0881,   // 0x7090 (28816) pixels
-0x0861, 0x0861, 0x0840, 0x0040, 0x0020, 0x0000, 0x0000, 0x0861, 0x0881, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x70A0 (28832) pixels
-0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x18C3,   // 0x70B0 (28848) pixels
-0x18C2, 0x2103, 0x5AC9, 0x4A27, 0x2103, 0x2103, 0x3185, 0x8BED, 0x41E6, 0x2924, 0x83CC, 0x7B6B, 0x6B0A, 0x732A, 0x4A27, 0x3185,   // 0x70C0 (28864) pixels
-0x2924, 0x838C, 0x6B0A, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x3165, 0x3165,   // 0x70D0 (28880) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2103, 0x18C2, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0x70E0 (28896) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2924, 0x2923, 0x2944, 0x2944, 0x3164, 0x5248, 0x940D, 0x940E, 0x9C4E, 0x9C6F,   // 0x70F0 (28912) pixels
-0x9C4F, 0x9C4F, 0x9C2F, 0x940E, 0x8BEE, 0x83CD, 0x7B8C, 0x6B2B, 0x5AA9, 0x18A2, 0x3164, 0x3164, 0x3144, 0x2944, 0x2964, 0x2964,   // 0x7100 (28928) pixels
-0x3164, 0x2944, 0x2944, 0x2944, 0x3164, 0x3164, 0x3185, 0x3184, 0x3184, 0x5248, 0x8BED, 0x940E, 0x9C2E, 0x9C6F, 0x9C4F, 0x9C4F,   // 0x7110 (28944) pixels
-0x9C2F, 0x8C0E, 0x8BEE, 0x83AD, 0x7B8C, 0x6B2B, 0x5268, 0x18A2, 0x3144, 0x3164, 0x3164, 0x3164, 0x2944, 0x3144, 0x3165, 0x3164,   // 0x7120 (28960) pixels
-0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x0020, 0x838C, 0x940E, 0x9C4E, 0x9C4F, 0x9C6F, 0x9C6F, 0x942E,   // 0x7130 (28976) pixels
-0x940E, 0x8C0E, 0x83CD, 0x7BAC, 0x736C, 0x62EA, 0x39A6, 0x3164, 0x3165, 0x3164, 0x3164, 0x3144, 0x2944, 0x3144, 0x2944, 0x2944,   // 0x7140 (28992) pixels
-0x3164, 0x2944, 0x3144, 0x3144, 0x3164, 0x3164, 0x0020, 0x940D, 0x940E, 0x9C4E, 0x9C6F, 0x9C6F, 0x9C4F, 0x942E, 0x940E, 0x8C0E,   // 0x7150 (29008) pixels
-0x83CD, 0x7B8C, 0x736C, 0x5AA9, 0x39A6, 0x2943, 0x2944, 0x2923, 0x2924, 0x2124, 0x2124, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0x7160 (29024) pixels
-0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x2103, 0x2924, 0x2944, 0x2944, 0x3144, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7170 (29040) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x732A, 0x9C2F, 0x3164, 0x2944, 0x3144, 0x3165, 0xAC8F, 0x5A88, 0x3165, 0x62A9,   // 0x7180 (29056) pixels
-0x7B6B, 0x3185, 0x62A9, 0x8BCD, 0x2924, 0x2944, 0x62C9, 0x62C9, 0x83AD, 0x2924, 0x3165, 0x6B0B, 0x62CA, 0x4A27, 0x18C2, 0x18C3,   // 0x7190 (29072) pixels
-0x18C3, 0x1082, 0x1082, 0x0861, 0x1061, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x18A3,   // 0x71A0 (29088) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x0861, 0x0841, 0x0000, 0x0020, 0x0820, 0x0841, 0x1061, 0x1082, 0x1081,   // 0x71B0 (29104) pixels
-0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x71C0 (29120) pixels
-0x1061, 0x1061, 0x0881, 0x1061, 0x1061, 0x0881, 0x1081, 0x0861, 0x1082, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061, 0x0861, 0x0861,   // 0x71D0 (29136) pixels
-0x0861, 0x0841, 0x0840, 0x0020, 0x0020, 0x0000, 0x0020, 0x0881, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x71E0 (29152) pixels
-0x10A2, 0x10C2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x0881, 0x0881, 0x1081, 0x18E3, 0x18E2,   // 0x71F0 (29168) pixels
-0x18C2, 0x18E3, 0x2924, 0x2103, 0x20E3, 0x2103, 0x2103, 0x3165, 0x3164, 0x2924, 0x39A5, 0x41C6, 0x41E6, 0x41E6, 0x3985, 0x2944,   // 0x7200 (29184) pixels
-0x2924, 0x39A5, 0x3185, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2945, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7210 (29200) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3185, 0x2944, 0x2944, 0x2924, 0x2124, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103,   // 0x7220 (29216) pixels
-0x2103, 0x2103, 0x2103, 0x2104, 0x2923, 0x2924, 0x2924, 0x2924, 0x2924, 0x2923, 0x3144, 0x0861, 0x732A, 0x940D, 0x942E, 0x9C4E,   // 0x7230 (29232) pixels
-0x9C4E, 0x9C6F, 0x9C2F, 0x942E, 0x8BEE, 0x83CD, 0x7B8C, 0x62EA, 0x5268, 0x3184, 0x3164, 0x3164, 0x3164, 0x3144, 0x3164, 0x3164,   // 0x7240 (29248) pixels
-0x3164, 0x3164, 0x3164, 0x2944, 0x3165, 0x3164, 0x3164, 0x3164, 0x3184, 0x0861, 0x83AC, 0x940D, 0x9C2E, 0x9C4E, 0x9C4E, 0x9C6F,   // 0x7250 (29264) pixels
-0x9C2F, 0x940E, 0x8BEE, 0x83CD, 0x7B8C, 0x62EA, 0x2944, 0x3185, 0x3144, 0x3164, 0x3164, 0x3164, 0x3144, 0x3165, 0x3144, 0x3165,   // 0x7260 (29280) pixels
-0x3165, 0x3165, 0x3164, 0x3164, 0x3164, 0x3144, 0x3164, 0x3164, 0x39A5, 0x39A5, 0x8BED, 0x942E, 0x9C4E, 0xA46F, 0x9C6F, 0x9C4E,   // 0x7270 (29296) pixels
-0x942E, 0x8C0E, 0x83CD, 0x7BAD, 0x6B0A, 0x62CA, 0x10A2, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144, 0x3164, 0x2964, 0x2944,   // 0x7280 (29312) pixels
-0x2944, 0x2964, 0x2944, 0x39C6, 0x31A5, 0x3164, 0x3164, 0x732A, 0x8BED, 0x942E, 0x9C4E, 0xA46F, 0x9C6F, 0x9C4E, 0x942E, 0x8C0E,   // 0x7290 (29328) pixels
-0x83CD, 0x7B8C, 0x6B0A, 0x5268, 0x10A2, 0x2944, 0x2944, 0x2924, 0x2924, 0x2923, 0x2923, 0x2924, 0x2903, 0x2104, 0x2103, 0x2103,   // 0x72A0 (29344) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x2124, 0x2924, 0x2924, 0x3144, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944,   // 0x72B0 (29360) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x6AE9, 0x9C4F, 0x3165, 0x3144, 0x2944, 0x3985, 0xA48F, 0x838C, 0x83AC, 0xA44F,   // 0x72C0 (29376) pixels
-0x41E6, 0x2944, 0x62A9, 0x93EE, 0x2924, 0x3144, 0x62C9, 0x4A27, 0x7B6C, 0x4207, 0x5268, 0x62EA, 0x4A27, 0x62CA, 0x18C2, 0x18E3,   // 0x72D0 (29392) pixels
-0x18C3, 0x10A2, 0x1081, 0x0840, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1061, 0x1082, 0x18A2, 0x18A2,   // 0x72E0 (29408) pixels
-0x18A2, 0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18A2, 0x10A2, 0x1082, 0x0020, 0x0000, 0x0020, 0x0820, 0x0841, 0x1061, 0x1082,   // 0x72F0 (29424) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x7300 (29440) pixels
-0x0861, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1081, 0x0861, 0x0861, 0x0861,   // 0x7310 (29456) pixels
-0x0861, 0x0841, 0x0040, 0x0020, 0x0020, 0x0020, 0x0861, 0x0882, 0x10A2, 0x10A2, 0x10A2, 0x10C3, 0x10C2, 0x10A2, 0x10A2, 0x10C2,   // 0x7320 (29472) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x10A2, 0x10A2, 0x18E3, 0x18C2,   // 0x7330 (29488) pixels
-0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2944, 0x2924, 0x2924,   // 0x7340 (29504) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945,   // 0x7350 (29520) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2124, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0x7360 (29536) pixels
-0x2103, 0x2104, 0x2103, 0x2123, 0x2924, 0x2924, 0x2924, 0x2924, 0x2923, 0x2943, 0x2943, 0x3184, 0x2924, 0x8BED, 0x940D, 0x9C4E,   // 0x7370 (29552) pixels
-0x9C4E, 0xA46F, 0x9C4F, 0x942E, 0x8BEE, 0x83ED, 0x7B8C, 0x62CA, 0x2944, 0x3184, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,   // 0x7380 (29568) pixels
-0x3144, 0x2944, 0x3164, 0x2964, 0x3164, 0x3164, 0x3165, 0x3164, 0x3164, 0x39A4, 0x730A, 0x8BED, 0x942E, 0x9C4E, 0x9C4E, 0xA46F,   // 0x7390 (29584) pixels
-0x9C4F, 0x940E, 0x8BEE, 0x83CD, 0x7B8C, 0x62CA, 0x10A2, 0x3184, 0x3164, 0x3164, 0x41C6, 0x41C6, 0x3164, 0x3165, 0x2944, 0x3164,   // 0x73A0 (29600) pixels
-0x3144, 0x3165, 0x3164, 0x3164, 0x3164, 0x3144, 0x3164, 0x3164, 0x3984, 0x1082, 0x8BED, 0x940D, 0x9C4E, 0x9C6F, 0x9C4F, 0x9C4F,   // 0x73B0 (29616) pixels
-0x942E, 0x8C0D, 0x83ED, 0x83AD, 0x6B0A, 0x5268, 0x3164, 0x3144, 0x3164, 0x3164, 0x3164, 0x3144, 0x2944, 0x3144, 0x3165, 0x3164,   // 0x73C0 (29632) pixels
-0x2944, 0x2944, 0x2964, 0x3185, 0x2944, 0x3164, 0x3184, 0x2924, 0x8BED, 0x940D, 0x9C4E, 0x9C6F, 0xA46F, 0x9C4F, 0x942E, 0x8C0D,   // 0x73D0 (29648) pixels
-0x83ED, 0x7B8C, 0x6B0A, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2923, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2103, 0x2103,   // 0x73E0 (29664) pixels
-0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E2, 0x18E3, 0x18E3, 0x2924, 0x2924, 0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x73F0 (29680) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x6AEA, 0x9C4F, 0x3164, 0x3144, 0x2944, 0x3985, 0xA46F, 0x93EE, 0xAC8F, 0x9C0E,   // 0x7400 (29696) pixels
-0x3985, 0x2944, 0x62A9, 0x93ED, 0x2924, 0x3165, 0x838C, 0x4A07, 0x5268, 0x62A9, 0x5AA9, 0x4A47, 0x4227, 0x62CA, 0x18C2, 0x18E3,   // 0x7410 (29712) pixels
-0x18C3, 0x18C2, 0x1081, 0x0861, 0x0840, 0x0861, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x10A2, 0x18A2,   // 0x7420 (29728) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x1081, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x1061,   // 0x7430 (29744) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x7440 (29760) pixels
-0x0861, 0x0881, 0x1061, 0x1082, 0x1062, 0x1061, 0x1061, 0x1082, 0x1061, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x7450 (29776) pixels
-0x0861, 0x0040, 0x0020, 0x0020, 0x0020, 0x0000, 0x0881, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x18C3, 0x10C3, 0x10C2, 0x10A2, 0x10A2,   // 0x7460 (29792) pixels
-0x10C2, 0x10A2, 0x0882, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x0881, 0x10A2, 0x1081, 0x18E3, 0x18E3, 0x18E3,   // 0x7470 (29808) pixels
-0x18E3, 0x2103, 0x2103, 0x20E3, 0x2104, 0x2123, 0x2123, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944,   // 0x7480 (29824) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944,   // 0x7490 (29840) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0x74A0 (29856) pixels
-0x2103, 0x2123, 0x2103, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x3164, 0x3184, 0x62A9, 0x940E, 0x942E,   // 0x74B0 (29872) pixels
-0x942E, 0x9C2E, 0x9C2E, 0x940E, 0x8BCD, 0x7B8C, 0x6B0A, 0x20E3, 0x3184, 0x3164, 0x3164, 0x3164, 0x3144, 0x3164, 0x3144, 0x3144,   // 0x74C0 (29888) pixels
-0x3164, 0x2944, 0x2964, 0x3164, 0x3185, 0x3164, 0x2964, 0x3164, 0x3165, 0x3184, 0x1082, 0x62A9, 0x940E, 0x942E, 0x942E, 0x9C2E,   // 0x74D0 (29904) pixels
-0x9C2E, 0x940E, 0x8BCD, 0x7B6C, 0x6B0A, 0x20E3, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x2964, 0x3165, 0x3165,   // 0x74E0 (29920) pixels
-0x2944, 0x3164, 0x3144, 0x3165, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x39A5, 0x20E3, 0x940E, 0x9C2E, 0x940E, 0x942E, 0x9C2E,   // 0x74F0 (29936) pixels
-0x940E, 0x8BEE, 0x7B8C, 0x734B, 0x41C6, 0x10A2, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144, 0x3165, 0x3145, 0x2944, 0x3164, 0x2964,   // 0x7500 (29952) pixels
-0x3164, 0x2944, 0x2944, 0x2944, 0x2964, 0x3144, 0x3164, 0x3184, 0x20E3, 0x940E, 0x942E, 0x940E, 0x9C2E, 0x9C2E, 0x940E, 0x8BEE,   // 0x7510 (29968) pixels
-0x7B8C, 0x6B0A, 0x41C6, 0x3164, 0x2944, 0x2923, 0x2944, 0x2924, 0x39C6, 0x41E6, 0x2903, 0x2924, 0x2123, 0x2924, 0x2103, 0x2103,   // 0x7520 (29984) pixels
-0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7530 (30000) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x6B0A, 0x9C2E, 0x3164, 0x2944, 0x2944, 0x3165, 0xACD0, 0x5248, 0x39C6, 0x7B8C,   // 0x7540 (30016) pixels
-0x5248, 0x2944, 0x62C9, 0x8BED, 0x2924, 0x3985, 0x83CD, 0x41E6, 0x3165, 0x732B, 0x734B, 0x2944, 0x4207, 0x5AA9, 0x18E3, 0x18E3,   // 0x7550 (30032) pixels
-0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x0820, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1082, 0x18A2,   // 0x7560 (30048) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x1082, 0x0000, 0x0000, 0x0020, 0x0840, 0x0841, 0x0861,   // 0x7570 (30064) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x7580 (30080) pixels
-0x0881, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x7590 (30096) pixels
-0x0861, 0x0040, 0x0020, 0x0020, 0x0000, 0x0040, 0x0881, 0x10A2, 0x10A2, 0x10C2, 0x10C3, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x10A2,   // 0x75A0 (30112) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10C2, 0x10C2, 0x0861, 0x10A2, 0x1081, 0x18E3, 0x18E3, 0x18E3,   // 0x75B0 (30128) pixels
-0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2924, 0x2123, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2124,   // 0x75C0 (30144) pixels
-0x2964, 0x39A6, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x75D0 (30160) pixels
-0x2945, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2924, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0x75E0 (30176) pixels
-0x2103, 0x2103, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x18A2, 0x4A06, 0x8BED,   // 0x75F0 (30192) pixels
-0x940E, 0x942E, 0x940E, 0x940E, 0x83CD, 0x7B6B, 0x39A5, 0x3184, 0x3164, 0x3144, 0x3164, 0x3144, 0x3164, 0x2944, 0x2944, 0x2944,   // 0x7600 (30208) pixels
-0x3144, 0x3144, 0x3144, 0x2964, 0x3165, 0x3185, 0x3164, 0x3164, 0x3164, 0x3164, 0x3984, 0x18A2, 0x6B0A, 0x8BED, 0x940E, 0x942E,   // 0x7610 (30224) pixels
-0x940E, 0x8C0E, 0x83CD, 0x732B, 0x39A5, 0x3185, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144, 0x3144, 0x3165, 0x3185, 0x3165, 0x3144,   // 0x7620 (30240) pixels
-0x3144, 0x3144, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3184, 0x3164, 0x3164, 0x3985, 0x4A06, 0x83AC, 0x940E, 0x940E, 0x940E,   // 0x7630 (30256) pixels
-0x940E, 0x8BED, 0x7B6B, 0x5A89, 0x10A2, 0x3185, 0x3165, 0x3164, 0x3164, 0x3164, 0x3144, 0x2964, 0x2944, 0x2944, 0x2944, 0x3165,   // 0x7640 (30272) pixels
-0x3165, 0x2944, 0x3164, 0x2944, 0x3144, 0x3164, 0x3144, 0x3184, 0x3985, 0x4A06, 0x8BED, 0x940E, 0x942E, 0x940E, 0x940E, 0x8BED,   // 0x7650 (30288) pixels
-0x7B6B, 0x39A5, 0x10A2, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x3165, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2124, 0x2103,   // 0x7660 (30304) pixels
-0x2103, 0x20E3, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x2924, 0x2924, 0x2944, 0x2944, 0x3144, 0x3164, 0x2944, 0x2944,   // 0x7670 (30320) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x6B0A, 0x93ED, 0x2964, 0x2944, 0x2944, 0x3185, 0xB4F0, 0x5247, 0x3185, 0x6AEA,   // 0x7680 (30336) pixels
-0x734B, 0x3165, 0x62C9, 0x8BED, 0x2924, 0x39A5, 0x8BED, 0x39A5, 0x2924, 0x7B6C, 0x5AA9, 0x2103, 0x4207, 0x6AEA, 0x18E2, 0x20E3,   // 0x7690 (30352) pixels
-0x18C2, 0x18C3, 0x18C2, 0x1081, 0x1081, 0x0840, 0x1061, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1081, 0x0861, 0x1082, 0x10A2,   // 0x76A0 (30368) pixels
-0x18C2, 0x10C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x1081, 0x0020, 0x0000, 0x0020, 0x0820, 0x0840, 0x0861,   // 0x76B0 (30384) pixels
-0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x76C0 (30400) pixels
-0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x76D0 (30416) pixels
-0x0861, 0x0040, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x18A2, 0x10C2, 0x18C3, 0x10C3, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10C2,   // 0x76E0 (30432) pixels
-0x10A2, 0x08A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x18C2, 0x10A2, 0x0861, 0x1081, 0x18E3, 0x18E3, 0x18E2, 0x18E3,   // 0x76F0 (30448) pixels
-0x18E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2103, 0x2123, 0x2124, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2124,   // 0x7700 (30464) pixels
-0x2124, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x2924,   // 0x7710 (30480) pixels
-0x2944, 0x2965, 0x3145, 0x2944, 0x2944, 0x2924, 0x2103, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2104, 0x2103,   // 0x7720 (30496) pixels
-0x2103, 0x2103, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x3165, 0x3185, 0x2944, 0x3164, 0x2944, 0x3164, 0x3164, 0x18C2,   // 0x7730 (30512) pixels
-0x2923, 0x4A27, 0x4A27, 0x4A07, 0x18C2, 0x18A2, 0x3164, 0x3144, 0x3164, 0x3144, 0x2944, 0x3164, 0x2964, 0x2944, 0x2944, 0x2944,   // 0x7740 (30528) pixels
-0x2944, 0x3144, 0x3144, 0x3164, 0x2944, 0x2944, 0x3164, 0x2964, 0x3164, 0x3164, 0x3164, 0x3164, 0x3184, 0x18C2, 0x2923, 0x4A27,   // 0x7750 (30544) pixels
-0x4A27, 0x39A5, 0x18C2, 0x18C2, 0x3164, 0x3184, 0x3164, 0x3144, 0x3164, 0x3144, 0x3144, 0x3164, 0x3164, 0x3164, 0x3144, 0x3165,   // 0x7760 (30560) pixels
-0x3164, 0x3164, 0x3164, 0x3164, 0x3165, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x39A5, 0x18E3, 0x18C2, 0x41C6, 0x4A27,   // 0x7770 (30576) pixels
-0x4A07, 0x2103, 0x18A2, 0x3164, 0x3164, 0x39A5, 0x3185, 0x3164, 0x3185, 0x3164, 0x3164, 0x2944, 0x3165, 0x3164, 0x3165, 0x3164,   // 0x7780 (30592) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x3164, 0x3164, 0x3164, 0x2964, 0x3164, 0x3185, 0x18C2, 0x18C2, 0x4A27, 0x4A27, 0x4A07, 0x2103,   // 0x7790 (30608) pixels
-0x18A2, 0x3144, 0x2944, 0x3144, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2123,   // 0x77A0 (30624) pixels
-0x2124, 0x2924, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18C3, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x77B0 (30640) pixels
-0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x5A68, 0x6AEA, 0x2944, 0x2944, 0x2944, 0x3165, 0x838C, 0x49E6, 0x2924, 0x4A07,   // 0x77C0 (30656) pixels
-0x7B6B, 0x3165, 0x5248, 0x6AC9, 0x2924, 0x3165, 0x62C9, 0x3164, 0x2924, 0x5248, 0x3165, 0x2103, 0x39A5, 0x4A27, 0x20E3, 0x20E3,   // 0x77D0 (30672) pixels
-0x18E3, 0x18C3, 0x18C2, 0x1081, 0x1081, 0x0820, 0x1061, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1081, 0x1082, 0x0861, 0x1082,   // 0x77E0 (30688) pixels
-0x10A2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x10A2, 0x1082, 0x0000, 0x0020, 0x0820, 0x0840, 0x0861,   // 0x77F0 (30704) pixels
-0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081,   // 0x7800 (30720) pixels
-0x0881, 0x0861, 0x0861, 0x1061, 0x1082, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861,   // 0x7810 (30736) pixels
-0x0861, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10C2, 0x18C2, 0x10C3, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10A2,   // 0x7820 (30752) pixels
-0x10A2, 0x10C2, 0x10C3, 0x10C3, 0x10A2, 0x18C2, 0x18E3, 0x18C2, 0x10C2, 0x10A2, 0x10A2, 0x18E3, 0x18C2, 0x18E2, 0x18E3, 0x18E3,   // 0x7830 (30768) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2123, 0x2123, 0x2124, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944,   // 0x7840 (30784) pixels
-0x2944, 0x2944, 0x3185, 0x2144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7850 (30800) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2124, 0x18C2, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104,   // 0x7860 (30816) pixels
-0x2124, 0x2123, 0x2124, 0x2123, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x3164,   // 0x7870 (30832) pixels
-0x3164, 0x3165, 0x3164, 0x3164, 0x3144, 0x3144, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144, 0x3164, 0x2944, 0x3164, 0x2944, 0x2944,   // 0x7880 (30848) pixels
-0x5248, 0x41E6, 0x3144, 0x2944, 0x2944, 0x3164, 0x3164, 0x3164, 0x3164, 0x2944, 0x2964, 0x3164, 0x3164, 0x3144, 0x3185, 0x3184,   // 0x7890 (30864) pixels
-0x3184, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x2964, 0x2944, 0x3165, 0x3165, 0x3144, 0x2944, 0x2964, 0x3164, 0x3165,   // 0x78A0 (30880) pixels
-0x3164, 0x3164, 0x3144, 0x2964, 0x3164, 0x3165, 0x3164, 0x3165, 0x3144, 0x3164, 0x3164, 0x3164, 0x3184, 0x3185, 0x3185, 0x3164,   // 0x78B0 (30896) pixels
-0x3184, 0x3164, 0x3164, 0x3185, 0x3164, 0x3144, 0x3985, 0x3164, 0x3165, 0x3144, 0x3164, 0x3164, 0x2944, 0x2944, 0x2965, 0x2944,   // 0x78C0 (30912) pixels
-0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x3164, 0x3164, 0x3164, 0x3144, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144, 0x2944,   // 0x78D0 (30928) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3144, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2124, 0x2103,   // 0x78E0 (30944) pixels
-0x2104, 0x2104, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18C2, 0x2924, 0x2924, 0x2944, 0x2945, 0x3144, 0x2944,   // 0x78F0 (30960) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2924, 0x2944, 0x2924,   // 0x7900 (30976) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2103, 0x2123, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3,   // 0x7910 (30992) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082,   // 0x7920 (31008) pixels
-0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18A2, 0x10C2, 0x1082, 0x0000, 0x0020, 0x0820, 0x0840, 0x0861,   // 0x7930 (31024) pixels
-0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x7940 (31040) pixels
-0x0861, 0x0861, 0x1061, 0x1081, 0x1082, 0x1061, 0x1082, 0x1061, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861,   // 0x7950 (31056) pixels
-0x0861, 0x0020, 0x0020, 0x0000, 0x0020, 0x0861, 0x10A2, 0x10C2, 0x18C3, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10A2,   // 0x7960 (31072) pixels
-0x08A2, 0x18C3, 0x18E3, 0x10C2, 0x10C2, 0x10C2, 0x18C2, 0x18C2, 0x10C2, 0x0861, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1903,   // 0x7970 (31088) pixels
-0x2103, 0x2103, 0x2123, 0x2123, 0x2123, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2144, 0x2124,   // 0x7980 (31104) pixels
-0x39C6, 0x41C6, 0x2944, 0x2124, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x7990 (31120) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2103, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x79A0 (31136) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3144, 0x3164, 0x2964,   // 0x79B0 (31152) pixels
-0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x2944, 0x3144, 0x3164, 0x3144, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x3164, 0x2944,   // 0x79C0 (31168) pixels
-0x3164, 0x3185, 0x3144, 0x3164, 0x2944, 0x2944, 0x3164, 0x2964, 0x3144, 0x3164, 0x2944, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144,   // 0x79D0 (31184) pixels
-0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3165, 0x3164, 0x3165, 0x3144, 0x3164, 0x3165, 0x3165, 0x2944, 0x3144,   // 0x79E0 (31200) pixels
-0x3164, 0x3164, 0x3165, 0x3144, 0x3144, 0x3165, 0x3165, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3165, 0x3164, 0x3164,   // 0x79F0 (31216) pixels
-0x3164, 0x3184, 0x3164, 0x3164, 0x39A5, 0x41E6, 0x3185, 0x2944, 0x2964, 0x3164, 0x3164, 0x2944, 0x2944, 0x3144, 0x2944, 0x3164,   // 0x7A00 (31232) pixels
-0x3164, 0x3145, 0x3164, 0x2944, 0x3165, 0x3165, 0x3185, 0x3164, 0x3144, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7A10 (31248) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103,   // 0x7A20 (31264) pixels
-0x2123, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2924, 0x2924, 0x3164, 0x2944, 0x2944,   // 0x7A30 (31280) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7A40 (31296) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x7A50 (31312) pixels
-0x20E3, 0x18E2, 0x18C2, 0x18E3, 0x18A2, 0x10A2, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x7A60 (31328) pixels
-0x1082, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x18A2, 0x18A2, 0x1081, 0x0020, 0x0020, 0x0020, 0x0840, 0x0841,   // 0x7A70 (31344) pixels
-0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x7A80 (31360) pixels
-0x0861, 0x0881, 0x1061, 0x1081, 0x1082, 0x1062, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x7A90 (31376) pixels
-0x0841, 0x0020, 0x0020, 0x0000, 0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x10C3, 0x10C3, 0x10C3, 0x10A2, 0x10A2, 0x10A2,   // 0x7AA0 (31392) pixels
-0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x0881, 0x10C2, 0x10A2, 0x18E3, 0x18E2, 0x18E3, 0x18E3, 0x2103,   // 0x7AB0 (31408) pixels
-0x2103, 0x2103, 0x2123, 0x2124, 0x2123, 0x2924, 0x2124, 0x2124, 0x2924, 0x2944, 0x2124, 0x2944, 0x2924, 0x2944, 0x2944, 0x2124,   // 0x7AC0 (31424) pixels
-0x2944, 0x2944, 0x2144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7AD0 (31440) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2124, 0x18E3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2104, 0x2103, 0x2104, 0x2124,   // 0x7AE0 (31456) pixels
-0x2104, 0x2123, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x3144, 0x2964, 0x2944, 0x3144, 0x3164,   // 0x7AF0 (31472) pixels
-0x3144, 0x3144, 0x2944, 0x3144, 0x2944, 0x3144, 0x3164, 0x2944, 0x3144, 0x3164, 0x2944, 0x3164, 0x3164, 0x3164, 0x2944, 0x2944,   // 0x7B00 (31488) pixels
-0x3165, 0x3165, 0x3144, 0x3144, 0x3164, 0x2944, 0x2944, 0x3164, 0x3164, 0x2944, 0x2944, 0x2944, 0x3164, 0x3144, 0x3144, 0x3164,   // 0x7B10 (31504) pixels
-0x3164, 0x3164, 0x3164, 0x3164, 0x3165, 0x3144, 0x2965, 0x2944, 0x3165, 0x3165, 0x3144, 0x3164, 0x2964, 0x2944, 0x3165, 0x3165,   // 0x7B20 (31520) pixels
-0x3164, 0x3144, 0x3144, 0x3164, 0x3144, 0x3164, 0x3165, 0x3164, 0x2944, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3165,   // 0x7B30 (31536) pixels
-0x3164, 0x3164, 0x3164, 0x3164, 0x4A28, 0x5268, 0x39A5, 0x3185, 0x3164, 0x3164, 0x2944, 0x3164, 0x3164, 0x3144, 0x3165, 0x3165,   // 0x7B40 (31552) pixels
-0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x3164, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x7B50 (31568) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2923, 0x2924, 0x2124, 0x2124, 0x2924,   // 0x7B60 (31584) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944,   // 0x7B70 (31600) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x7B80 (31616) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2903, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x7B90 (31632) pixels
-0x2103, 0x18E2, 0x18E3, 0x18C2, 0x18C2, 0x10A1, 0x0840, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x0861,   // 0x7BA0 (31648) pixels
-0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x0020, 0x0020, 0x0820, 0x0841,   // 0x7BB0 (31664) pixels
-0x1062, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x7BC0 (31680) pixels
-0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841,   // 0x7BD0 (31696) pixels
-0x0840, 0x0020, 0x0020, 0x0000, 0x0861, 0x1082, 0x10A2, 0x10C2, 0x18A2, 0x10C2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x0882,   // 0x7BE0 (31712) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x0881, 0x10A2, 0x1903, 0x18E2, 0x18E2, 0x1903, 0x1903, 0x2103,   // 0x7BF0 (31728) pixels
-0x2103, 0x2103, 0x2123, 0x2123, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7C00 (31744) pixels
-0x2944, 0x2124, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2945,   // 0x7C10 (31760) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2124, 0x2123, 0x2124,   // 0x7C20 (31776) pixels
-0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x3165, 0x3185, 0x3165,   // 0x7C30 (31792) pixels
-0x3164, 0x2944, 0x3164, 0x3165, 0x3185, 0x3185, 0x3185, 0x3165, 0x3164, 0x2944, 0x3164, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7C40 (31808) pixels
-0x3144, 0x3144, 0x3144, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3165, 0x3164, 0x3164, 0x3165, 0x3164, 0x3165,   // 0x7C50 (31824) pixels
-0x3164, 0x3164, 0x3185, 0x3985, 0x3985, 0x3185, 0x3164, 0x3164, 0x3164, 0x3144, 0x2964, 0x3165, 0x3164, 0x2944, 0x2964, 0x3165,   // 0x7C60 (31840) pixels
-0x3164, 0x3165, 0x3145, 0x3165, 0x2944, 0x3164, 0x3164, 0x3144, 0x3164, 0x3144, 0x3164, 0x3144, 0x3164, 0x3144, 0x3144, 0x3164,   // 0x7C70 (31856) pixels
-0x3164, 0x3165, 0x3165, 0x3985, 0x5248, 0x4A27, 0x39A5, 0x39A5, 0x3985, 0x3165, 0x3185, 0x3985, 0x3185, 0x3185, 0x3164, 0x3165,   // 0x7C80 (31872) pixels
-0x3164, 0x3164, 0x3165, 0x3165, 0x3165, 0x3164, 0x3164, 0x2944, 0x2944, 0x2964, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7C90 (31888) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2123, 0x2124,   // 0x7CA0 (31904) pixels
-0x2124, 0x2104, 0x2124, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x7CB0 (31920) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2924, 0x2944, 0x3185, 0x2944, 0x2944,   // 0x7CC0 (31936) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2923, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x7CD0 (31952) pixels
-0x20E3, 0x20E2, 0x20E3, 0x18E2, 0x18C2, 0x1081, 0x18C2, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082,   // 0x7CE0 (31968) pixels
-0x1081, 0x10A2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x10C2, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x0000, 0x0020, 0x0020, 0x0841,   // 0x7CF0 (31984) pixels
-0x1061, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x7D00 (32000) pixels
-0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840,   // 0x7D10 (32016) pixels
-0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x1082, 0x10A2, 0x10C2, 0x10C2, 0x18C3, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x10A2,   // 0x7D20 (32032) pixels
-0x10C2, 0x10A2, 0x10C2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x0881, 0x10A2, 0x10A1, 0x18E2, 0x18E2, 0x18E2, 0x1903, 0x2103, 0x1903,   // 0x7D30 (32048) pixels
-0x2123, 0x2123, 0x2123, 0x2123, 0x2123, 0x2924, 0x2944, 0x2124, 0x2944, 0x2124, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944,   // 0x7D40 (32064) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945,   // 0x7D50 (32080) pixels
-0x2944, 0x2924, 0x2924, 0x2103, 0x2103, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124,   // 0x7D60 (32096) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x3144, 0x3165, 0x62A9, 0xACD0, 0xACB0, 0x9C2F,   // 0x7D70 (32112) pixels
-0x62C9, 0x2944, 0x6AEA, 0xA46F, 0xACAF, 0xBD52, 0xACB0, 0xA44F, 0xA44F, 0x2944, 0x2964, 0x3164, 0x2964, 0x2964, 0x2944, 0x2944,   // 0x7D80 (32128) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x3165, 0x3165, 0x2964, 0x3185, 0xBD52, 0x6AEA, 0x3165, 0x3164, 0x39A5, 0xBD52,   // 0x7D90 (32144) pixels
-0x5A88, 0x62C9, 0xB531, 0xA48F, 0xA44F, 0xB511, 0x8BCD, 0x5227, 0x3164, 0x3164, 0x3165, 0x2964, 0x2944, 0x3144, 0x3144, 0x3164,   // 0x7DA0 (32160) pixels
-0x3164, 0x2944, 0x3165, 0x3165, 0x3165, 0x3165, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144, 0x3144, 0x3144, 0x3144, 0x3164, 0x3144,   // 0x7DB0 (32176) pixels
-0x3164, 0x3144, 0x9C2E, 0xB4F1, 0xB511, 0xCDB4, 0xC552, 0xBD11, 0xB4F0, 0x6AC9, 0xB4D0, 0xB510, 0xACAF, 0xBD11, 0x8BCC, 0x4A07,   // 0x7DC0 (32192) pixels
-0x838B, 0xC592, 0x3165, 0x3985, 0x7B4B, 0xACB0, 0x5228, 0x3164, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7DD0 (32208) pixels
-0x2965, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x7DE0 (32224) pixels
-0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18C3, 0x18C3, 0x2103, 0x2924, 0x2924, 0x2944,   // 0x7DF0 (32240) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x7E00 (32256) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2923, 0x2923, 0x2923, 0x2923, 0x2923, 0x2923, 0x2123, 0x2103,   // 0x7E10 (32272) pixels
-0x2103, 0x2103, 0x20E3, 0x20E2, 0x20E2, 0x20E3, 0x18A2, 0x1081, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x7E20 (32288) pixels
-0x0861, 0x10A2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x1082, 0x0000, 0x0020, 0x0840,   // 0x7E30 (32304) pixels
-0x0861, 0x1081, 0x1081, 0x1061, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x7E40 (32320) pixels
-0x1061, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0040,   // 0x7E50 (32336) pixels
-0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10C2, 0x18C2, 0x18C2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x10C2,   // 0x7E60 (32352) pixels
-0x10C2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x08A1, 0x0060, 0x10A1, 0x18E2, 0x18E2, 0x1903, 0x1903, 0x1903, 0x1923, 0x2123,   // 0x7E70 (32368) pixels
-0x2123, 0x2124, 0x2144, 0x2144, 0x2144, 0x2144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x7E80 (32384) pixels
-0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x7E90 (32400) pixels
-0x2944, 0x2924, 0x2103, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2103, 0x2924,   // 0x7EA0 (32416) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2964, 0x3144, 0x3144, 0x5A88, 0xACB0, 0x6AC9, 0x3985, 0x3164,   // 0x7EB0 (32432) pixels
-0x3185, 0x2964, 0x2964, 0x3165, 0x41E6, 0x940D, 0x62CA, 0x3165, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7EC0 (32448) pixels
-0x3144, 0x2944, 0x3144, 0x2945, 0x2944, 0x2945, 0x2965, 0x2944, 0x2964, 0x3185, 0xBD52, 0x6B2A, 0x3164, 0x3165, 0x39A6, 0xBD32,   // 0x7ED0 (32464) pixels
-0x5AA9, 0x5A88, 0xB4F0, 0x39A5, 0x3164, 0x39A5, 0x9C2E, 0xC552, 0x39A5, 0x3164, 0x2944, 0x3145, 0x3164, 0x2944, 0x3165, 0x3144,   // 0x7EE0 (32480) pixels
-0x3164, 0x3164, 0x3164, 0x3164, 0x2944, 0x3164, 0x3164, 0x3164, 0x3164, 0x3165, 0x3165, 0x3144, 0x3144, 0x3164, 0x3164, 0x3164,   // 0x7EF0 (32496) pixels
-0x3164, 0x3144, 0x3985, 0x39A5, 0x4A07, 0xC532, 0x62A9, 0x3985, 0x3985, 0x5247, 0xACD0, 0x730A, 0x3164, 0x4A07, 0xC572, 0x940D,   // 0x7F00 (32512) pixels
-0x7B8B, 0xC572, 0x3985, 0x940E, 0xB4D0, 0x4A07, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944,   // 0x7F10 (32528) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124,   // 0x7F20 (32544) pixels
-0x2924, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x2104, 0x2924, 0x2944,   // 0x7F30 (32560) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7F40 (32576) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2923, 0x2923, 0x2923, 0x2923, 0x2923,   // 0x7F50 (32592) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x20E2, 0x20E2, 0x10A1, 0x18A2, 0x0860, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081,   // 0x7F60 (32608) pixels
-0x10A2, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x10C2, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x0020, 0x0020, 0x0840,   // 0x7F70 (32624) pixels
-0x0841, 0x1061, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x7F80 (32640) pixels
-0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020,   // 0x7F90 (32656) pixels
-0x0020, 0x0020, 0x0000, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2,   // 0x7FA0 (32672) pixels
-0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x0881, 0x0881, 0x10A1, 0x1903, 0x1903, 0x1903, 0x1903, 0x1903, 0x1923, 0x1923,   // 0x7FB0 (32688) pixels
-0x2123, 0x2144, 0x2144, 0x2123, 0x2144, 0x2144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7FC0 (32704) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x7FD0 (32720) pixels
-0x2924, 0x2124, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2124, 0x2104, 0x2924, 0x2924,   // 0x7FE0 (32736) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x5227, 0xA44F, 0x83AC, 0x4A07, 0x3185,   // 0x7FF0 (32752) pixels
-0x2964, 0x3164, 0x3144, 0x3164, 0x41C6, 0x9C2E, 0x730A, 0x3965, 0x3165, 0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8000 (32768) pixels
-0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3985, 0xB531, 0x7B4B, 0x4207, 0x41E6, 0x5247, 0xBD52,   // 0x8010 (32784) pixels
-0x62A9, 0x5A88, 0xB511, 0x3985, 0x3164, 0x3164, 0x5227, 0xB4D0, 0x6AEA, 0x3164, 0x3165, 0x3165, 0x3144, 0x39A6, 0x3985, 0x2944,   // 0x8020 (32800) pixels
-0x2944, 0x3165, 0x3164, 0x2944, 0x2964, 0x3164, 0x2964, 0x2964, 0x2944, 0x2944, 0x3144, 0x3144, 0x3164, 0x3165, 0x3144, 0x3144,   // 0x8030 (32816) pixels
-0x3164, 0x3164, 0x3164, 0x3165, 0x41E6, 0xBD52, 0x62A8, 0x3165, 0x3164, 0x62A9, 0xC553, 0x732A, 0x3985, 0x4A07, 0xBD52, 0x8C0E,   // 0x8040 (32832) pixels
-0x7B6B, 0xBD32, 0x62C9, 0xACD0, 0x5A68, 0x2944, 0x2964, 0x3144, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x8050 (32848) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x3165, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924,   // 0x8060 (32864) pixels
-0x2924, 0x2123, 0x2904, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x2924, 0x2924,   // 0x8070 (32880) pixels
-0x3124, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8080 (32896) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2923, 0x2923, 0x2923, 0x2923, 0x2923,   // 0x8090 (32912) pixels
-0x2103, 0x2102, 0x2102, 0x2102, 0x2103, 0x20E2, 0x18C2, 0x18A2, 0x0860, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081,   // 0x80A0 (32928) pixels
-0x1082, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x0000, 0x0000, 0x0020,   // 0x80B0 (32944) pixels
-0x0840, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x80C0 (32960) pixels
-0x0861, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061, 0x1082, 0x1062, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020,   // 0x80D0 (32976) pixels
-0x0000, 0x0000, 0x0040, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x10C2,   // 0x80E0 (32992) pixels
-0x10C2, 0x10C2, 0x10C2, 0x18C2, 0x10C2, 0x10C2, 0x0080, 0x10C2, 0x1902, 0x1903, 0x1902, 0x1923, 0x1923, 0x1923, 0x2143, 0x2143,   // 0x80F0 (33008) pixels
-0x2163, 0x2163, 0x2143, 0x2143, 0x2143, 0x2143, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8100 (33024) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8110 (33040) pixels
-0x2923, 0x18C2, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2124, 0x2124, 0x2924,   // 0x8120 (33056) pixels
-0x2124, 0x2924, 0x2124, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x4206, 0x8BCC, 0xACAF, 0xA46F,   // 0x8130 (33072) pixels
-0x4A27, 0x2964, 0x3164, 0x3164, 0x41E6, 0x9C4E, 0x730A, 0x2944, 0x2944, 0x2944, 0x2965, 0x2964, 0x2964, 0x2965, 0x2944, 0x2944,   // 0x8140 (33088) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3185, 0xCD93, 0xB4D0, 0xA46F, 0x9C4E, 0x942E, 0xC593,   // 0x8150 (33104) pixels
-0x5AA9, 0x5A88, 0xBD32, 0x3985, 0x3165, 0x3164, 0x3985, 0xACB0, 0x6B0A, 0x3165, 0x3165, 0x3165, 0x3164, 0x3144, 0x3144, 0x3144,   // 0x8160 (33120) pixels
-0x2944, 0x3165, 0x3165, 0x2944, 0x2944, 0x3144, 0x2944, 0x3165, 0x3164, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944,   // 0x8170 (33136) pixels
-0x3164, 0x3164, 0x3165, 0x3165, 0x4A07, 0xC572, 0x5A88, 0x3164, 0x3144, 0x730A, 0xCD93, 0xA46F, 0x9C0E, 0xB4AF, 0x6AEA, 0x39A5,   // 0x8180 (33152) pixels
-0x7B8C, 0xBD52, 0xBD31, 0x9C2E, 0x41E6, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8190 (33168) pixels
-0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x81A0 (33184) pixels
-0x2924, 0x2924, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x18C2, 0x18E3, 0x20E3, 0x2103, 0x2904,   // 0x81B0 (33200) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2964, 0x3144, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x81C0 (33216) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2943, 0x2943, 0x2943, 0x2943, 0x2943, 0x2943, 0x2943,   // 0x81D0 (33232) pixels
-0x2923, 0x2922, 0x2923, 0x2102, 0x2103, 0x2103, 0x2103, 0x18A1, 0x1081, 0x1081, 0x1081, 0x1081, 0x10A1, 0x1081, 0x1081, 0x1081,   // 0x81E0 (33248) pixels
-0x1081, 0x1081, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x10C2, 0x10A2, 0x1082, 0x0840, 0x0000, 0x0020,   // 0x81F0 (33264) pixels
-0x0840, 0x0841, 0x0861, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x8200 (33280) pixels
-0x0881, 0x1061, 0x1081, 0x1062, 0x1061, 0x0861, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020,   // 0x8210 (33296) pixels
-0x0000, 0x0000, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x10C2, 0x10C3, 0x18C2, 0x10C2, 0x10A2, 0x10A2, 0x10C2, 0x10C2,   // 0x8220 (33312) pixels
-0x10C2, 0x10C2, 0x10C2, 0x18E3, 0x10C2, 0x10C2, 0x0881, 0x10C2, 0x1902, 0x1902, 0x1902, 0x1923, 0x1943, 0x1962, 0x1962, 0x1962,   // 0x8230 (33328) pixels
-0x1982, 0x1982, 0x1962, 0x2163, 0x2163, 0x2163, 0x2143, 0x2944, 0x2944, 0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944,   // 0x8240 (33344) pixels
-0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x8250 (33360) pixels
-0x2924, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2104, 0x2103, 0x2104, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924,   // 0x8260 (33376) pixels
-0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x41A6, 0x5227, 0x9C4E,   // 0x8270 (33392) pixels
-0x940D, 0x4A07, 0x3144, 0x3164, 0x4206, 0x9C4E, 0x6AEA, 0x3144, 0x2944, 0x3165, 0x2944, 0x2965, 0x2944, 0x2944, 0x2965, 0x2944,   // 0x8280 (33408) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x3185, 0xB4F0, 0x730A, 0x4A27, 0x4A27, 0x5247, 0xBD52,   // 0x8290 (33424) pixels
-0x5AA9, 0x5A68, 0xB532, 0x39A5, 0x3165, 0x3165, 0x4A07, 0xB4D0, 0x6AE9, 0x3144, 0x3164, 0x3165, 0x3144, 0x3165, 0x3165, 0x2944,   // 0x82A0 (33440) pixels
-0x3164, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x3144, 0x3144, 0x2964, 0x3164, 0x3144, 0x2944, 0x3164, 0x3164, 0x3165, 0x3165,   // 0x82B0 (33456) pixels
-0x2964, 0x3165, 0x3164, 0x3164, 0x49E7, 0xC573, 0x5A88, 0x3164, 0x3144, 0x730A, 0xC593, 0x7B4B, 0x7B2A, 0xBD10, 0x7B8C, 0x39A6,   // 0x82C0 (33472) pixels
-0x838C, 0xBD32, 0x7B2B, 0xBD52, 0x838C, 0x3164, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x3144, 0x2924, 0x2944, 0x2945,   // 0x82D0 (33488) pixels
-0x2944, 0x3144, 0x2944, 0x2944, 0x2924, 0x3165, 0x3185, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x82E0 (33504) pixels
-0x2924, 0x2924, 0x2924, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x18C3, 0x3165,   // 0x82F0 (33520) pixels
-0x3185, 0x3185, 0x3165, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3144, 0x2944,   // 0x8300 (33536) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x3144, 0x3144, 0x3143, 0x3163, 0x3143, 0x3142, 0x3142, 0x2942,   // 0x8310 (33552) pixels
-0x2922, 0x2922, 0x2922, 0x2923, 0x2102, 0x20E2, 0x20E2, 0x18C2, 0x18C2, 0x1060, 0x1081, 0x1081, 0x10A2, 0x1081, 0x1081, 0x1081,   // 0x8320 (33568) pixels
-0x1081, 0x1081, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x10C2, 0x10C2, 0x10A2, 0x1081, 0x0000, 0x0020,   // 0x8330 (33584) pixels
-0x0820, 0x0840, 0x0861, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x8340 (33600) pixels
-0x0861, 0x0881, 0x1061, 0x1082, 0x1062, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020,   // 0x8350 (33616) pixels
-0x0000, 0x0020, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x10C2, 0x10A2, 0x10A1, 0x10C2, 0x10C2,   // 0x8360 (33632) pixels
-0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10E2, 0x10C1, 0x1902, 0x1902, 0x1943, 0x1962, 0x10A2, 0x18A2, 0x39C6, 0x4A28,   // 0x8370 (33648) pixels
-0x4A28, 0x4A28, 0x4227, 0x4227, 0x1082, 0x10A2, 0x2163, 0x2143, 0x2164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944,   // 0x8380 (33664) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2124,   // 0x8390 (33680) pixels
-0x20E3, 0x20E3, 0x20E2, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2103, 0x2103, 0x2124, 0x2124, 0x2124,   // 0x83A0 (33696) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x3144, 0x3165, 0x3164, 0x3164, 0x3164, 0x62A9,   // 0x83B0 (33712) pixels
-0xA46F, 0x5247, 0x3144, 0x2964, 0x41E6, 0x942E, 0x730B, 0x2944, 0x2964, 0x2964, 0x3165, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944,   // 0x83C0 (33728) pixels
-0x3164, 0x3165, 0x3144, 0x2944, 0x2944, 0x2964, 0x2944, 0x3164, 0x2944, 0x39A5, 0xBD32, 0x6AC9, 0x3144, 0x3165, 0x41C6, 0xBD32,   // 0x83D0 (33744) pixels
-0x62A9, 0x5227, 0xB4F0, 0x39A6, 0x3164, 0x39A5, 0x9C4E, 0xB4F0, 0x3164, 0x3164, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2964,   // 0x83E0 (33760) pixels
-0x2944, 0x2964, 0x2944, 0x2965, 0x2944, 0x3144, 0x2964, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2964, 0x3164, 0x3165, 0x3144,   // 0x83F0 (33776) pixels
-0x3165, 0x3165, 0x3164, 0x3164, 0x4A06, 0xBD52, 0x5A88, 0x3164, 0x2944, 0x6AEA, 0xC593, 0x4A27, 0x3165, 0x7B4B, 0xB4D0, 0x41C6,   // 0x8400 (33792) pixels
-0x8BED, 0xBD53, 0x3165, 0x72EA, 0xBD52, 0x62C9, 0x3185, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944,   // 0x8410 (33808) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x3165, 0x3165, 0x2944, 0x2924, 0x2924, 0x2924, 0x3165, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x8420 (33824) pixels
-0x2124, 0x2124, 0x2924, 0x2103, 0x2124, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x2103,   // 0x8430 (33840) pixels
-0x2924, 0x2924, 0x3165, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x8440 (33856) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x3143, 0x3164, 0x3162, 0x18A2, 0x2924, 0x4A27, 0x4A28, 0x4A28,   // 0x8450 (33872) pixels
-0x4A27, 0x4A28, 0x31A6, 0x1082, 0x2922, 0x2902, 0x2102, 0x2102, 0x18C2, 0x1080, 0x10A1, 0x1081, 0x10A1, 0x1081, 0x1081, 0x1081,   // 0x8460 (33888) pixels
-0x1081, 0x1082, 0x0881, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x0020, 0x0020,   // 0x8470 (33904) pixels
-0x0020, 0x0820, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x8480 (33920) pixels
-0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020,   // 0x8490 (33936) pixels
-0x0000, 0x0841, 0x0861, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x18C2, 0x18C2, 0x10C2, 0x10C2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10C2,   // 0x84A0 (33952) pixels
-0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x08A1, 0x10E2, 0x10E2, 0x1923, 0x1922, 0x1962, 0x18A2, 0x39A6, 0x62CA, 0x62EB, 0x630A,   // 0x84B0 (33968) pixels
-0x630B, 0x62EA, 0x62EA, 0x62CA, 0x5ACA, 0x39A6, 0x10A2, 0x2163, 0x2144, 0x2943, 0x2964, 0x2964, 0x2964, 0x2964, 0x2964, 0x2944,   // 0x84C0 (33984) pixels
-0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x3185, 0x2944, 0x2944, 0x2964, 0x2924, 0x2124,   // 0x84D0 (34000) pixels
-0x18C2, 0x20E3, 0x18E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124, 0x2103, 0x2124, 0x2924, 0x2924,   // 0x84E0 (34016) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x5A48, 0x732A, 0x732A, 0x732B, 0xACB0,   // 0x84F0 (34032) pixels
-0x838B, 0x39A5, 0x2944, 0x3164, 0x41E6, 0x942E, 0x6AEA, 0x2944, 0x3164, 0x2965, 0x2944, 0x3165, 0x2944, 0x3144, 0x3144, 0x3164,   // 0x8500 (34048) pixels
-0x3144, 0x3165, 0x3145, 0x2945, 0x3145, 0x2944, 0x2944, 0x2944, 0x3145, 0x3985, 0xBD11, 0x62C9, 0x3164, 0x2964, 0x41C6, 0xBD32,   // 0x8510 (34064) pixels
-0x5A88, 0x5227, 0xACD0, 0x732A, 0x6AE9, 0x940E, 0xB4F0, 0x7B4A, 0x3144, 0x3144, 0x2944, 0x2944, 0x3144, 0x2964, 0x3144, 0x2944,   // 0x8520 (34080) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x3165, 0x2965, 0x2944, 0x2944, 0x3144, 0x2944, 0x2965, 0x3165, 0x3164, 0x3164,   // 0x8530 (34096) pixels
-0x3164, 0x3164, 0x3165, 0x3164, 0x49E6, 0xC552, 0x5A88, 0x3185, 0x2944, 0x6AEA, 0xBD52, 0x4A07, 0x3164, 0x5A68, 0xBD31, 0x62A9,   // 0x8540 (34112) pixels
-0x940E, 0xB511, 0x3164, 0x39C6, 0x8BCD, 0xA48F, 0x4A07, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8550 (34128) pixels
-0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x3185, 0x3164, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x8560 (34144) pixels
-0x2944, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E2, 0x20E3, 0x18E3,   // 0x8570 (34160) pixels
-0x2924, 0x2924, 0x3164, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8580 (34176) pixels
-0x2964, 0x3144, 0x2944, 0x2944, 0x3164, 0x2944, 0x2943, 0x3143, 0x3163, 0x3162, 0x18A2, 0x5AA9, 0x630B, 0x62EA, 0x630B, 0x630B,   // 0x8590 (34192) pixels
-0x62EA, 0x62EA, 0x5AEA, 0x5AA9, 0x18A2, 0x2922, 0x2102, 0x2103, 0x18C1, 0x18A1, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x85A0 (34208) pixels
-0x1081, 0x1082, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x10C2, 0x10C2, 0x10C2, 0x1082, 0x0861, 0x0020,   // 0x85B0 (34224) pixels
-0x0020, 0x0840, 0x0841, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x85C0 (34240) pixels
-0x1082, 0x1061, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020,   // 0x85D0 (34256) pixels
-0x0000, 0x0861, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x18C2, 0x10C2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10C2,   // 0x85E0 (34272) pixels
-0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x08A1, 0x08A0, 0x10E1, 0x1923, 0x1942, 0x1162, 0x10A2, 0x62EA, 0x6B2B, 0x6B4B, 0x6B2B, 0x6B2B,   // 0x85F0 (34288) pixels
-0x6B2B, 0x6B2B, 0x630A, 0x630B, 0x62EB, 0x62EA, 0x41E7, 0x10A2, 0x2163, 0x2984, 0x2964, 0x2964, 0x2944, 0x2964, 0x2944, 0x2964,   // 0x8600 (34304) pixels
-0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2124, 0x2103,   // 0x8610 (34320) pixels
-0x2103, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2944,   // 0x8620 (34336) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x62C9, 0x7B4B, 0x7B4B, 0x5248,   // 0x8630 (34352) pixels
-0x3144, 0x3144, 0x3144, 0x2964, 0x3985, 0x5A89, 0x5248, 0x2944, 0x3164, 0x2944, 0x3144, 0x3165, 0x2944, 0x2944, 0x3165, 0x2964,   // 0x8640 (34368) pixels
-0x3144, 0x3144, 0x3144, 0x2964, 0x2964, 0x2944, 0x3145, 0x2944, 0x3144, 0x3165, 0x6AEA, 0x41C6, 0x3165, 0x3144, 0x3985, 0x7B6B,   // 0x8650 (34384) pixels
-0x39A6, 0x39A5, 0x6ACA, 0x83AC, 0x7BAC, 0x5A88, 0x3185, 0x3164, 0x3164, 0x2944, 0x3144, 0x3144, 0x2944, 0x3144, 0x2944, 0x3144,   // 0x8660 (34400) pixels
-0x3144, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2964, 0x3164, 0x3144, 0x2964, 0x2964, 0x2964, 0x2964,   // 0x8670 (34416) pixels
-0x3144, 0x3164, 0x3165, 0x3144, 0x39A5, 0x838B, 0x41E6, 0x3164, 0x2944, 0x5A88, 0x7B6B, 0x3985, 0x3164, 0x3144, 0x8BED, 0x6B0A,   // 0x8680 (34432) pixels
-0x83AC, 0x838C, 0x3144, 0x3165, 0x3185, 0x8BED, 0x7B8B, 0x2944, 0x2944, 0x2944, 0x2944, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8690 (34448) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3145, 0x2944, 0x3144, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0x86A0 (34464) pixels
-0x2124, 0x31A5, 0x3185, 0x2944, 0x2124, 0x2124, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x2103, 0x18E3, 0x20E3, 0x18E3, 0x20E3,   // 0x86B0 (34480) pixels
-0x2103, 0x2924, 0x2944, 0x3165, 0x2944, 0x2964, 0x2944, 0x2964, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944,   // 0x86C0 (34496) pixels
-0x2944, 0x3144, 0x3144, 0x3164, 0x3164, 0x3143, 0x3143, 0x3163, 0x18A2, 0x2944, 0x62EA, 0x630A, 0x6B2B, 0x6B4B, 0x6B2B, 0x6B2B,   // 0x86D0 (34512) pixels
-0x630A, 0x6B2B, 0x62EB, 0x5ACA, 0x5AEA, 0x18C2, 0x10A2, 0x2902, 0x18C1, 0x18C2, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081,   // 0x86E0 (34528) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10C2, 0x18C3, 0x1082, 0x1082, 0x0020,   // 0x86F0 (34544) pixels
-0x0020, 0x0840, 0x0840, 0x0861, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x8700 (34560) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0020,   // 0x8710 (34576) pixels
-0x0020, 0x0861, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x1082, 0x10C2, 0x10C2, 0x10C2,   // 0x8720 (34592) pixels
-0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x08A1, 0x10E2, 0x1102, 0x1942, 0x1182, 0x18A2, 0x6B2B, 0x6B4B, 0x736C, 0x734B, 0x736C, 0x736C,   // 0x8730 (34608) pixels
-0x736B, 0x736C, 0x6B4B, 0x6B2B, 0x630A, 0x62EB, 0x5ACA, 0x3165, 0x10A2, 0x2163, 0x2164, 0x2964, 0x3164, 0x2944, 0x2964, 0x2944,   // 0x8740 (34624) pixels
-0x2964, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x2124, 0x18C2,   // 0x8750 (34640) pixels
-0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2123, 0x2103, 0x2104, 0x2124, 0x2123, 0x2124, 0x2924, 0x2924,   // 0x8760 (34656) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x8770 (34672) pixels
-0x3144, 0x2944, 0x3164, 0x2964, 0x3164, 0x2944, 0x3144, 0x2944, 0x2944, 0x2965, 0x3165, 0x2964, 0x3165, 0x2944, 0x2944, 0x3144,   // 0x8780 (34688) pixels
-0x2944, 0x3144, 0x3144, 0x3144, 0x3164, 0x3145, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2965, 0x3144, 0x2945,   // 0x8790 (34704) pixels
-0x3144, 0x2944, 0x2964, 0x3165, 0x3164, 0x3164, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x2964, 0x2944, 0x3144, 0x3144, 0x3164,   // 0x87A0 (34720) pixels
-0x2944, 0x3145, 0x3144, 0x3144, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x2944, 0x3164, 0x3164,   // 0x87B0 (34736) pixels
-0x3165, 0x3185, 0x3185, 0x3165, 0x2944, 0x2944, 0x3164, 0x2964, 0x3144, 0x2944, 0x2944, 0x2944, 0x3165, 0x3165, 0x2944, 0x2944,   // 0x87C0 (34752) pixels
-0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x87D0 (34768) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2924, 0x2944, 0x2944, 0x3144, 0x2944, 0x2924, 0x2944,   // 0x87E0 (34784) pixels
-0x2944, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3,   // 0x87F0 (34800) pixels
-0x18E3, 0x2924, 0x2944, 0x3144, 0x2944, 0x2964, 0x3144, 0x2944, 0x2964, 0x2944, 0x2964, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144,   // 0x8800 (34816) pixels
-0x3164, 0x3144, 0x3144, 0x3164, 0x3164, 0x3164, 0x3163, 0x18A2, 0x41E6, 0x6B2B, 0x6B2B, 0x734C, 0x734C, 0x734B, 0x738C, 0x736B,   // 0x8810 (34832) pixels
-0x734B, 0x6B0A, 0x6B2B, 0x5AEA, 0x5AAA, 0x5ACA, 0x10A2, 0x10A2, 0x2102, 0x20C1, 0x1080, 0x1081, 0x1081, 0x10A1, 0x1081, 0x1081,   // 0x8820 (34848) pixels
-0x1081, 0x1081, 0x1082, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x10A2, 0x0020,   // 0x8830 (34864) pixels
-0x0020, 0x0820, 0x0840, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x8840 (34880) pixels
-0x1062, 0x1061, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0040, 0x0020, 0x0000,   // 0x8850 (34896) pixels
-0x0040, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2,   // 0x8860 (34912) pixels
-0x10C2, 0x10C2, 0x10C2, 0x08A1, 0x00A0, 0x10E2, 0x1922, 0x1942, 0x18C2, 0x5AA9, 0x734A, 0x736C, 0x736B, 0x7B8D, 0x7B8C, 0x7B8C,   // 0x8870 (34928) pixels
-0x738C, 0x736C, 0x734C, 0x6B2B, 0x630B, 0x5ACA, 0x5ACA, 0x5ACA, 0x2103, 0x10A2, 0x2163, 0x2964, 0x2984, 0x2964, 0x2964, 0x2944,   // 0x8880 (34944) pixels
-0x2964, 0x2964, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x18E3, 0x20E3,   // 0x8890 (34960) pixels
-0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2124, 0x2124, 0x2924, 0x2124, 0x2124, 0x2924,   // 0x88A0 (34976) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944,   // 0x88B0 (34992) pixels
-0x2944, 0x2945, 0x2944, 0x3164, 0x3164, 0x3144, 0x2944, 0x2944, 0x2964, 0x2964, 0x3165, 0x2964, 0x2944, 0x2944, 0x2964, 0x2944,   // 0x88C0 (35008) pixels
-0x2944, 0x2944, 0x2964, 0x3144, 0x2944, 0x3165, 0x2944, 0x2944, 0x3145, 0x2964, 0x2944, 0x2944, 0x3164, 0x3165, 0x2965, 0x3144,   // 0x88D0 (35024) pixels
-0x2944, 0x2965, 0x3165, 0x2944, 0x3164, 0x3165, 0x3144, 0x2944, 0x2964, 0x2944, 0x2944, 0x3144, 0x2944, 0x3164, 0x3144, 0x2944,   // 0x88E0 (35040) pixels
-0x2944, 0x2945, 0x3145, 0x2944, 0x2944, 0x2965, 0x2944, 0x3165, 0x3165, 0x2944, 0x2945, 0x3145, 0x2944, 0x2964, 0x3164, 0x2944,   // 0x88F0 (35056) pixels
-0x3165, 0x31A6, 0x3165, 0x2965, 0x3144, 0x3165, 0x2964, 0x2944, 0x3164, 0x3165, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944,   // 0x8900 (35072) pixels
-0x3145, 0x3144, 0x3144, 0x2944, 0x2944, 0x2965, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944,   // 0x8910 (35088) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x8920 (35104) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2904, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3,   // 0x8930 (35120) pixels
-0x20E3, 0x2103, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964,   // 0x8940 (35136) pixels
-0x2944, 0x3144, 0x3164, 0x3164, 0x3164, 0x3184, 0x3183, 0x18A2, 0x6AEA, 0x736B, 0x736C, 0x7B8C, 0x7B8C, 0x7B8C, 0x7BAD, 0x738C,   // 0x8950 (35152) pixels
-0x736C, 0x6B2B, 0x6B2B, 0x62EA, 0x5AEA, 0x5ACA, 0x5AA9, 0x1082, 0x2923, 0x18C1, 0x18A1, 0x1081, 0x1081, 0x10A1, 0x10A2, 0x1081,   // 0x8960 (35168) pixels
-0x1081, 0x1082, 0x1082, 0x1081, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x2104, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x0841,   // 0x8970 (35184) pixels
-0x0020, 0x0020, 0x0840, 0x0841, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x8980 (35200) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0040, 0x0020, 0x0020, 0x0000,   // 0x8990 (35216) pixels
-0x0861, 0x1081, 0x10A2, 0x10A2, 0x18C3, 0x18C2, 0x10C2, 0x10C2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x10C2,   // 0x89A0 (35232) pixels
-0x10C2, 0x10C2, 0x10C2, 0x08A1, 0x10C1, 0x10E2, 0x1942, 0x1162, 0x5227, 0x7B6C, 0x7B6B, 0x7B8D, 0x83CD, 0x7BAD, 0x7B8C, 0x7B8C,   // 0x89B0 (35248) pixels
-0x7BAD, 0x7B8C, 0x738C, 0x738C, 0x6B0B, 0x62EA, 0x5AAA, 0x5AA9, 0x52A9, 0x10A2, 0x2163, 0x2964, 0x2964, 0x2964, 0x2964, 0x2964,   // 0x89C0 (35264) pixels
-0x2964, 0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x18C3, 0x18E3,   // 0x89D0 (35280) pixels
-0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924,   // 0x89E0 (35296) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944,   // 0x89F0 (35312) pixels
-0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x3165, 0x3144, 0x2965, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144,   // 0x8A00 (35328) pixels
-0x2944, 0x2944, 0x2944, 0x2964, 0x3164, 0x2944, 0x2965, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x8A10 (35344) pixels
-0x3165, 0x3144, 0x3144, 0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944,   // 0x8A20 (35360) pixels
-0x2944, 0x3165, 0x3145, 0x2944, 0x3164, 0x2944, 0x3144, 0x2944, 0x3144, 0x3165, 0x3144, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944,   // 0x8A30 (35376) pixels
-0x2944, 0x2944, 0x3185, 0x2944, 0x2944, 0x3165, 0x2944, 0x2964, 0x3144, 0x3165, 0x3165, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944,   // 0x8A40 (35392) pixels
-0x2945, 0x3144, 0x2944, 0x3144, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2924, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x8A50 (35408) pixels
-0x2103, 0x2103, 0x2103, 0x2123, 0x2103, 0x2103, 0x2924, 0x2104, 0x2103, 0x2123, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x8A60 (35424) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2924, 0x2924, 0x2103, 0x2103, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0x8A70 (35440) pixels
-0x20E3, 0x18E3, 0x2924, 0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x8A80 (35456) pixels
-0x3164, 0x3164, 0x3164, 0x3164, 0x3163, 0x3163, 0x18A2, 0x734B, 0x734A, 0x7B6C, 0x7B8C, 0x83CD, 0x7BAD, 0x7BAD, 0x7B8C, 0x7BAD,   // 0x8A90 (35472) pixels
-0x7BAD, 0x7B8C, 0x734B, 0x5ACA, 0x5ACA, 0x5ACA, 0x5ACA, 0x4A68, 0x1082, 0x2102, 0x20C2, 0x1080, 0x1081, 0x10A2, 0x1081, 0x1081,   // 0x8AA0 (35488) pixels
-0x1081, 0x1081, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x2103, 0x18E3, 0x10C2, 0x18C2, 0x10A2,   // 0x8AB0 (35504) pixels
-0x0000, 0x0020, 0x0840, 0x0841, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x8AC0 (35520) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000,   // 0x8AD0 (35536) pixels
-0x0861, 0x1082, 0x10A2, 0x10A2, 0x18C2, 0x10C2, 0x10C2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2,   // 0x8AE0 (35552) pixels
-0x10C2, 0x10C2, 0x10C2, 0x08A1, 0x10E2, 0x10E1, 0x1942, 0x18C2, 0x6B0A, 0x7B6C, 0x7B8C, 0x83CD, 0x83CD, 0x83ED, 0x83ED, 0x83CD,   // 0x8AF0 (35568) pixels
-0x83CD, 0x83CD, 0x7B8C, 0x7B6C, 0x734B, 0x630B, 0x630B, 0x5AAA, 0x5ACA, 0x39C6, 0x1082, 0x2964, 0x2964, 0x2964, 0x2964, 0x2964,   // 0x8B00 (35584) pixels
-0x2964, 0x2965, 0x3185, 0x2964, 0x2965, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x2103, 0x2103, 0x18E3,   // 0x8B10 (35600) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2944, 0x2924,   // 0x8B20 (35616) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x3144, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944,   // 0x8B30 (35632) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x2965, 0x2944, 0x3144, 0x2944, 0x2944, 0x3145, 0x2964, 0x2964, 0x2944, 0x2944, 0x2945, 0x2965,   // 0x8B40 (35648) pixels
-0x2944, 0x31A5, 0x3164, 0x3144, 0x2944, 0x2944, 0x2945, 0x2965, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2965, 0x2944, 0x3144,   // 0x8B50 (35664) pixels
-0x2944, 0x39A5, 0x3165, 0x3144, 0x2965, 0x2944, 0x3185, 0x3165, 0x2945, 0x2965, 0x3165, 0x2944, 0x3145, 0x2944, 0x2944, 0x3144,   // 0x8B60 (35680) pixels
-0x3165, 0x3144, 0x2944, 0x2944, 0x2945, 0x2944, 0x3144, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3986,   // 0x8B70 (35696) pixels
-0x3186, 0x2924, 0x3185, 0x2944, 0x2944, 0x2965, 0x3144, 0x2944, 0x3144, 0x2944, 0x3144, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944,   // 0x8B80 (35712) pixels
-0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2964, 0x2944, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3,   // 0x8B90 (35728) pixels
-0x18E3, 0x18E3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3,   // 0x8BA0 (35744) pixels
-0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x2103, 0x2924, 0x2124, 0x2903, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3,   // 0x8BB0 (35760) pixels
-0x20E3, 0x18C2, 0x2923, 0x2924, 0x2944, 0x3144, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2964, 0x3144, 0x3164,   // 0x8BC0 (35776) pixels
-0x2944, 0x3144, 0x3164, 0x3164, 0x3164, 0x3162, 0x18A2, 0x7B8B, 0x7B8C, 0x83AD, 0x83CD, 0x83CD, 0x83CD, 0x83CC, 0x83CD, 0x83CD,   // 0x8BD0 (35792) pixels
-0x7BCD, 0x7BAD, 0x736C, 0x6B2B, 0x6B2B, 0x5ACA, 0x5AC9, 0x5289, 0x10A2, 0x2923, 0x18C2, 0x1080, 0x1081, 0x10A1, 0x10A1, 0x1081,   // 0x8BE0 (35808) pixels
-0x1081, 0x1081, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x10A2,   // 0x8BF0 (35824) pixels
-0x0000, 0x0020, 0x0840, 0x0841, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x8C00 (35840) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0040, 0x0020, 0x0020, 0x0000, 0x0020,   // 0x8C10 (35856) pixels
-0x0881, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x18C2, 0x10A2, 0x10C2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10C2,   // 0x8C20 (35872) pixels
-0x10C2, 0x10C2, 0x10C2, 0x0880, 0x10E2, 0x1902, 0x1142, 0x18A2, 0x7B6B, 0x83AD, 0x83AC, 0x8BEE, 0x83ED, 0x8C0E, 0x8BED, 0x83ED,   // 0x8C30 (35888) pixels
-0x83ED, 0x83ED, 0x83CE, 0x7BAD, 0x7B8C, 0x736C, 0x6B0B, 0x5ACA, 0x5ACA, 0x4A28, 0x10A2, 0x2163, 0x2964, 0x2964, 0x2964, 0x2964,   // 0x8C40 (35904) pixels
-0x2964, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x2924, 0x18E3, 0x18E3, 0x18E3,   // 0x8C50 (35920) pixels
-0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2123, 0x2123, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924,   // 0x8C60 (35936) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8C70 (35952) pixels
-0x2944, 0x2944, 0x3165, 0x3165, 0x2945, 0x3144, 0x2944, 0x3144, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965,   // 0x8C80 (35968) pixels
-0x2944, 0x2944, 0x41E7, 0x2944, 0x2944, 0x2944, 0x3164, 0x3165, 0x2964, 0x2944, 0x2944, 0x2945, 0x2944, 0x2965, 0x2945, 0x2944,   // 0x8C90 (35984) pixels
-0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2945, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944,   // 0x8CA0 (36000) pixels
-0x3164, 0x3144, 0x2944, 0x2944, 0x2964, 0x2964, 0x2944, 0x2945, 0x2964, 0x3144, 0x2944, 0x3144, 0x2944, 0x3144, 0x2944, 0x41E7,   // 0x8CB0 (36016) pixels
-0x3185, 0x2944, 0x3165, 0x3185, 0x2964, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8CC0 (36032) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x18C2, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x8CD0 (36048) pixels
-0x18E3, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x18C3,   // 0x8CE0 (36064) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18C2, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0x8CF0 (36080) pixels
-0x20E3, 0x18C2, 0x20E3, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x2964, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944,   // 0x8D00 (36096) pixels
-0x2944, 0x3164, 0x3164, 0x3164, 0x3164, 0x18E3, 0x18C2, 0x83AC, 0x83AD, 0x83CD, 0x8BED, 0x8BED, 0x8BEE, 0x83EE, 0x83ED, 0x83ED,   // 0x8D10 (36112) pixels
-0x7BCD, 0x7BAD, 0x738C, 0x736C, 0x6B4B, 0x632B, 0x62EA, 0x52A9, 0x2124, 0x18A2, 0x18C1, 0x18C2, 0x1081, 0x10A1, 0x10A1, 0x1081,   // 0x8D20 (36128) pixels
-0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x10A2, 0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x18C2, 0x18A2,   // 0x8D30 (36144) pixels
-0x0020, 0x0020, 0x0840, 0x0841, 0x1061, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x8D40 (36160) pixels
-0x1061, 0x1061, 0x0881, 0x0861, 0x0861, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0841,   // 0x8D50 (36176) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2,   // 0x8D60 (36192) pixels
-0x10C2, 0x10E2, 0x10C2, 0x0080, 0x10E1, 0x1923, 0x1162, 0x18A2, 0x7B6B, 0x83AC, 0x83CC, 0x940E, 0x940E, 0x940E, 0x8C0E, 0x8C0E,   // 0x8D70 (36208) pixels
-0x8BEE, 0x83ED, 0x83EE, 0x7BCD, 0x7B8C, 0x736C, 0x6B2B, 0x630A, 0x5AEA, 0x4A48, 0x1082, 0x2163, 0x2964, 0x2964, 0x2964, 0x2944,   // 0x8D80 (36224) pixels
-0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x2103, 0x18C2, 0x20E3, 0x18E3,   // 0x8D90 (36240) pixels
-0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2924, 0x2124, 0x2924, 0x2924, 0x2923, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x8DA0 (36256) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8DB0 (36272) pixels
-0x2944, 0x2944, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x3165, 0x2945, 0x2944, 0x2944, 0x2944, 0x3165, 0x3144,   // 0x8DC0 (36288) pixels
-0x2944, 0x3165, 0x39A6, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3165, 0x3144, 0x3144, 0x3165, 0x2945, 0x2944, 0x2944, 0x2944,   // 0x8DD0 (36304) pixels
-0x2944, 0x3165, 0x3165, 0x3164, 0x2944, 0x3144, 0x2944, 0x2965, 0x2944, 0x2944, 0x3165, 0x2944, 0x3144, 0x2945, 0x3144, 0x2944,   // 0x8DE0 (36320) pixels
-0x3144, 0x2944, 0x3145, 0x3165, 0x2944, 0x3145, 0x2965, 0x2944, 0x2944, 0x3165, 0x3165, 0x2944, 0x2944, 0x3144, 0x3144, 0x3164,   // 0x8DF0 (36336) pixels
-0x2944, 0x2944, 0x3185, 0x3185, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8E00 (36352) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2124, 0x18C2, 0x18E3, 0x18E2, 0x18E3, 0x18C2, 0x18E3,   // 0x8E10 (36368) pixels
-0x18E3, 0x18E3, 0x18C2, 0x18E3, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x18E3,   // 0x8E20 (36384) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18A2, 0x2103, 0x2124, 0x2924, 0x2124, 0x2924, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0x8E30 (36400) pixels
-0x18E3, 0x18C2, 0x18C3, 0x2103, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8E40 (36416) pixels
-0x2944, 0x3164, 0x3164, 0x3164, 0x3164, 0x18C2, 0x2944, 0x83CD, 0x83AC, 0x8BED, 0x940E, 0x8C0D, 0x942E, 0x8BEE, 0x8BED, 0x8BEE,   // 0x8E50 (36432) pixels
-0x83ED, 0x83CD, 0x7BAD, 0x7B8D, 0x734B, 0x6B0B, 0x62CA, 0x52A9, 0x2964, 0x10A2, 0x18C1, 0x18C2, 0x1080, 0x10A1, 0x10A1, 0x1081,   // 0x8E60 (36448) pixels
-0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x18A2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18E3,   // 0x8E70 (36464) pixels
-0x0841, 0x0020, 0x0840, 0x0841, 0x1061, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x8E80 (36480) pixels
-0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861,   // 0x8E90 (36496) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18A2, 0x10A2, 0x1082, 0x10C2, 0x10A2, 0x10A2, 0x10C2, 0x10C2,   // 0x8EA0 (36512) pixels
-0x10C2, 0x18C2, 0x10C2, 0x10C2, 0x10E2, 0x1922, 0x1162, 0x20E3, 0x83CD, 0x83CC, 0x8BED, 0x942E, 0x9C2E, 0x942E, 0x942F, 0x944F,   // 0x8EB0 (36528) pixels
-0x8C0E, 0x8BEE, 0x83CD, 0x7BAD, 0x83CD, 0x7BAD, 0x734B, 0x630B, 0x5ACA, 0x4A28, 0x18C2, 0x2164, 0x2984, 0x2964, 0x2964, 0x2944,   // 0x8EC0 (36544) pixels
-0x2944, 0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2965, 0x2964, 0x2944, 0x2944, 0x2924, 0x2123, 0x10C2, 0x18E3, 0x18E3, 0x18E3,   // 0x8ED0 (36560) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2124, 0x2123, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944,   // 0x8EE0 (36576) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2124, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x3164, 0x39A6, 0x3986,   // 0x8EF0 (36592) pixels
-0x3165, 0x2945, 0x2964, 0x3165, 0x3144, 0x2944, 0x3164, 0x2944, 0x3145, 0x3144, 0x3145, 0x2945, 0x2945, 0x2944, 0x3145, 0x2944,   // 0x8F00 (36608) pixels
-0x3164, 0x49E7, 0x3985, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x3164, 0x3145, 0x3145, 0x2944, 0x2964, 0x2944, 0x2944, 0x2945,   // 0x8F10 (36624) pixels
-0x3165, 0x2944, 0x3165, 0x3164, 0x3165, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944,   // 0x8F20 (36640) pixels
-0x2944, 0x2944, 0x3164, 0x3144, 0x3144, 0x2964, 0x3165, 0x2944, 0x2965, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x8F30 (36656) pixels
-0x2944, 0x3144, 0x2944, 0x2944, 0x2945, 0x2944, 0x3144, 0x2945, 0x3144, 0x2924, 0x2944, 0x2944, 0x3144, 0x3144, 0x2964, 0x2944,   // 0x8F40 (36672) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2104, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x8F50 (36688) pixels
-0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18C2, 0x18E3,   // 0x8F60 (36704) pixels
-0x18C2, 0x18C3, 0x18E3, 0x18C2, 0x18C3, 0x2104, 0x2124, 0x2924, 0x2924, 0x2924, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0x8F70 (36720) pixels
-0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x2924, 0x2924, 0x2964, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944,   // 0x8F80 (36736) pixels
-0x3164, 0x3164, 0x3144, 0x3164, 0x3164, 0x18A2, 0x62C9, 0x83AC, 0x83AC, 0x8BEE, 0x9C4F, 0x942E, 0x944F, 0x9C4F, 0x940E, 0x8C0E,   // 0x8F90 (36752) pixels
-0x83EE, 0x83ED, 0x83CD, 0x7BAC, 0x736C, 0x6B2B, 0x62EA, 0x52A9, 0x31A5, 0x1082, 0x2102, 0x18C1, 0x1060, 0x10A1, 0x10A1, 0x1081,   // 0x8FA0 (36768) pixels
-0x1081, 0x1082, 0x1081, 0x1081, 0x10A2, 0x1081, 0x10A2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3,   // 0x8FB0 (36784) pixels
-0x1082, 0x0000, 0x0820, 0x0861, 0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x8FC0 (36800) pixels
-0x1062, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861,   // 0x8FD0 (36816) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x18C2,   // 0x8FE0 (36832) pixels
-0x18C2, 0x18E2, 0x10C2, 0x10C2, 0x1923, 0x1922, 0x1162, 0x18C2, 0x83CC, 0x83CC, 0x8BED, 0x942E, 0x9C6F, 0x9C2F, 0x9C6F, 0x942E,   // 0x8FF0 (36848) pixels
-0x944F, 0x8C0E, 0x8BEE, 0x83ED, 0x7BAD, 0x7BCD, 0x736C, 0x6B0A, 0x62EA, 0x4A28, 0x18A2, 0x2163, 0x2964, 0x2964, 0x3185, 0x2964,   // 0x9000 (36864) pixels
-0x2964, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2924, 0x2103, 0x18E3, 0x18E2, 0x18E3, 0x20E3,   // 0x9010 (36880) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x9020 (36896) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3185, 0x3165, 0x2924, 0x2944, 0x2944,   // 0x9030 (36912) pixels
-0x2944, 0x2944, 0x3164, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x39A5, 0x3144, 0x3144, 0x2944, 0x2944, 0x3145, 0x3144, 0x2944,   // 0x9040 (36928) pixels
-0x3144, 0x39A5, 0x3144, 0x2944, 0x2965, 0x3165, 0x2944, 0x2965, 0x2965, 0x2965, 0x3165, 0x2965, 0x2944, 0x3164, 0x2945, 0x3145,   // 0x9050 (36944) pixels
-0x3165, 0x3144, 0x2944, 0x3165, 0x2944, 0x2965, 0x2965, 0x3164, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944,   // 0x9060 (36960) pixels
-0x2945, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x3164, 0x2944, 0x3164, 0x2944, 0x2964, 0x2944, 0x2944, 0x3144, 0x3165, 0x3165,   // 0x9070 (36976) pixels
-0x2944, 0x2944, 0x2964, 0x2944, 0x2945, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9080 (36992) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2104, 0x18C2, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3,   // 0x9090 (37008) pixels
-0x18C2, 0x18E3, 0x18C2, 0x18E3, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2,   // 0x90A0 (37024) pixels
-0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x18C2, 0x2104, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3,   // 0x90B0 (37040) pixels
-0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x2124, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2964,   // 0x90C0 (37056) pixels
-0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x18C2, 0x41E6, 0x83AC, 0x83AC, 0x8BED, 0x9C2E, 0x9C4F, 0xA46F, 0x9C4F, 0x9C4F, 0x944F,   // 0x90D0 (37072) pixels
-0x8C0E, 0x8C0E, 0x83ED, 0x7BCD, 0x7B8B, 0x736B, 0x62EA, 0x5AA9, 0x3165, 0x1082, 0x2923, 0x18A1, 0x18A2, 0x10A1, 0x10A2, 0x1081,   // 0x90E0 (37088) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x10A2, 0x18A2, 0x18C3, 0x18E3, 0x18E4, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2,   // 0x90F0 (37104) pixels
-0x1082, 0x0000, 0x0020, 0x0841, 0x0861, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x9100 (37120) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0020, 0x0861,   // 0x9110 (37136) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x10C2, 0x10C2,   // 0x9120 (37152) pixels
-0x10C2, 0x10C2, 0x08A1, 0x10C2, 0x1903, 0x1923, 0x1142, 0x18C2, 0x83AC, 0x8BED, 0x93EE, 0x942E, 0x9C2E, 0x9C6E, 0x9C6F, 0x9C4F,   // 0x9130 (37168) pixels
-0x946F, 0x942E, 0x940E, 0x8C0E, 0x83CD, 0x7BAD, 0x736C, 0x6B2B, 0x5AC9, 0x4207, 0x1082, 0x2163, 0x2964, 0x2964, 0x2964, 0x3185,   // 0x9140 (37184) pixels
-0x3185, 0x2944, 0x3144, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x9150 (37200) pixels
-0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x9160 (37216) pixels
-0x2924, 0x2944, 0x2924, 0x2965, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9170 (37232) pixels
-0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x3165, 0x3165, 0x2944, 0x2944, 0x3144,   // 0x9180 (37248) pixels
-0x2944, 0x2944, 0x2945, 0x2944, 0x3164, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x2965, 0x2944,   // 0x9190 (37264) pixels
-0x2944, 0x3164, 0x3164, 0x2945, 0x3165, 0x2944, 0x2964, 0x3165, 0x2944, 0x3145, 0x2945, 0x3145, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x91A0 (37280) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3165, 0x2944, 0x3165, 0x3144, 0x3144, 0x2944, 0x2944, 0x2945,   // 0x91B0 (37296) pixels
-0x2944, 0x2944, 0x2944, 0x3164, 0x3144, 0x3144, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x91C0 (37312) pixels
-0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2903, 0x18C2, 0x20E3, 0x18C2, 0x18E3, 0x18E3, 0x18E3,   // 0x91D0 (37328) pixels
-0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x18E3, 0x18C2, 0x18E3,   // 0x91E0 (37344) pixels
-0x18C2, 0x18E3, 0x18C2, 0x18E2, 0x18A2, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3,   // 0x91F0 (37360) pixels
-0x18E3, 0x20E3, 0x18E3, 0x18C2, 0x2103, 0x2924, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944,   // 0x9200 (37376) pixels
-0x3164, 0x3144, 0x3164, 0x3164, 0x3184, 0x18E3, 0x2923, 0x8BED, 0x93ED, 0x940E, 0x9C4F, 0x9C6F, 0xA46F, 0x9C6F, 0x944F, 0x946F,   // 0x9210 (37392) pixels
-0x93EE, 0x8BEE, 0x8BED, 0x7BAD, 0x7BAD, 0x736B, 0x62EA, 0x5AA9, 0x2124, 0x10A2, 0x2102, 0x20E2, 0x18C2, 0x10A1, 0x1081, 0x1081,   // 0x9220 (37408) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C2,   // 0x9230 (37424) pixels
-0x1082, 0x0020, 0x0020, 0x0840, 0x0841, 0x0861, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x9240 (37440) pixels
-0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0840, 0x0020, 0x0000, 0x0000, 0x0041, 0x0861,   // 0x9250 (37456) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10C2,   // 0x9260 (37472) pixels
-0x10C2, 0x10A2, 0x08A1, 0x10A1, 0x1903, 0x1923, 0x1942, 0x18C2, 0x7B6B, 0x8BED, 0x8BED, 0x9C2E, 0x9C2E, 0x9C6F, 0xA48F, 0x9C4E,   // 0x9270 (37488) pixels
-0x9C4F, 0x9C4F, 0x940E, 0x8BEE, 0x83CD, 0x7BAC, 0x7B6C, 0x6B0A, 0x5AC9, 0x2965, 0x10A2, 0x2964, 0x2964, 0x2964, 0x2944, 0x2944,   // 0x9280 (37504) pixels
-0x2964, 0x2944, 0x2944, 0x3185, 0x2964, 0x2965, 0x2944, 0x2944, 0x2944, 0x2124, 0x2103, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x18E3,   // 0x9290 (37520) pixels
-0x2103, 0x2103, 0x2104, 0x2103, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x3165, 0x2924, 0x2124, 0x2944,   // 0x92A0 (37536) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x92B0 (37552) pixels
-0x2944, 0x2944, 0x2945, 0x2944, 0x3144, 0x2944, 0x2964, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x3145, 0x2944, 0x2944, 0x2944,   // 0x92C0 (37568) pixels
-0x41E7, 0x2944, 0x2944, 0x3164, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x3145, 0x3165, 0x3165, 0x3165, 0x2944,   // 0x92D0 (37584) pixels
-0x2944, 0x3144, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x92E0 (37600) pixels
-0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x3165, 0x3144, 0x2944, 0x2944,   // 0x92F0 (37616) pixels
-0x3165, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x3165, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x9300 (37632) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x18C2, 0x18E3, 0x18E3, 0x18C2, 0x18E3, 0x18C3,   // 0x9310 (37648) pixels
-0x18E3, 0x18C3, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x18E3,   // 0x9320 (37664) pixels
-0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2123, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x9330 (37680) pixels
-0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E2, 0x2103, 0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3144,   // 0x9340 (37696) pixels
-0x3144, 0x3164, 0x3164, 0x3164, 0x3164, 0x3163, 0x18C2, 0x8BED, 0x8BEE, 0x940E, 0x9C4F, 0x9C2E, 0xA46F, 0x9C4F, 0x9C6F, 0x9C4F,   // 0x9350 (37712) pixels
-0x8C0E, 0x8C0D, 0x8BEE, 0x83CD, 0x7BAD, 0x7B8C, 0x630A, 0x5289, 0x10A2, 0x2922, 0x2102, 0x2102, 0x18C2, 0x1081, 0x1081, 0x1081,   // 0x9360 (37728) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x10A2,   // 0x9370 (37744) pixels
-0x1081, 0x0841, 0x0020, 0x0820, 0x0840, 0x0841, 0x1061, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081,   // 0x9380 (37760) pixels
-0x1061, 0x1082, 0x1061, 0x1082, 0x1082, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0000, 0x0841, 0x0861,   // 0x9390 (37776) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x18C2, 0x10C2,   // 0x93A0 (37792) pixels
-0x10A2, 0x08A1, 0x10A1, 0x10C2, 0x1903, 0x1923, 0x1943, 0x1962, 0x3164, 0x838C, 0x8BED, 0x9C4E, 0x940E, 0x9C4F, 0xA48F, 0x9C6F,   // 0x93B0 (37808) pixels
-0x9C4F, 0x940E, 0x940E, 0x8BED, 0x8BEE, 0x7BAC, 0x736C, 0x630A, 0x5ACA, 0x10A2, 0x2183, 0x2964, 0x2964, 0x2964, 0x2944, 0x3164,   // 0x93C0 (37824) pixels
-0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x3185, 0x2965, 0x2944, 0x2924, 0x2124, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x2103,   // 0x93D0 (37840) pixels
-0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2924, 0x2124, 0x2924, 0x2124, 0x2944, 0x2924, 0x3144, 0x3164, 0x2924, 0x2944,   // 0x93E0 (37856) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x93F0 (37872) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3164, 0x3144, 0x3165, 0x2964, 0x2965, 0x2944, 0x2944,   // 0x9400 (37888) pixels
-0x3165, 0x2944, 0x2944, 0x2965, 0x3164, 0x2944, 0x2944, 0x2944, 0x3164, 0x3144, 0x3164, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9410 (37904) pixels
-0x2944, 0x3165, 0x3165, 0x2964, 0x3164, 0x2944, 0x2944, 0x3144, 0x2965, 0x2944, 0x3144, 0x2944, 0x2964, 0x2944, 0x2944, 0x3165,   // 0x9420 (37920) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3145, 0x2944, 0x3144, 0x2945, 0x2944, 0x2944,   // 0x9430 (37936) pixels
-0x3165, 0x3165, 0x2964, 0x3165, 0x3165, 0x3165, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944,   // 0x9440 (37952) pixels
-0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2904, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3,   // 0x9450 (37968) pixels
-0x18C2, 0x18C2, 0x18E3, 0x18C2, 0x18E3, 0x18C2, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18C2, 0x18C2,   // 0x9460 (37984) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18A2, 0x2124, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2103, 0x2103, 0x2103,   // 0x9470 (38000) pixels
-0x20E3, 0x20E3, 0x18C2, 0x2103, 0x20C2, 0x20E3, 0x2924, 0x2944, 0x3144, 0x2964, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9480 (38016) pixels
-0x3164, 0x2944, 0x3164, 0x3164, 0x3164, 0x3163, 0x18C2, 0x7B4B, 0x83CD, 0x93ED, 0x942E, 0x9C4F, 0x9C4E, 0x9C4E, 0x9C4F, 0x9C4F,   // 0x9490 (38032) pixels
-0x940E, 0x8C0E, 0x8BED, 0x83CD, 0x7B8C, 0x734B, 0x62CA, 0x4A68, 0x18A2, 0x2923, 0x2102, 0x2103, 0x18A1, 0x1081, 0x1081, 0x1081,   // 0x94A0 (38048) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x18C3, 0x18C3, 0x18C3, 0x18C2,   // 0x94B0 (38064) pixels
-0x1082, 0x0861, 0x0020, 0x0020, 0x0840, 0x0841, 0x0861, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082,   // 0x94C0 (38080) pixels
-0x1061, 0x1082, 0x1081, 0x18A2, 0x18C3, 0x1081, 0x0881, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0000, 0x0000, 0x0861, 0x0882,   // 0x94D0 (38096) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C2, 0x10A2,   // 0x94E0 (38112) pixels
-0x10A1, 0x0881, 0x10C2, 0x10E2, 0x1902, 0x1923, 0x1943, 0x2163, 0x18C2, 0x41E6, 0x8BED, 0x93EE, 0x9C4F, 0x9C6F, 0x9C6E, 0x9C8F,   // 0x94F0 (38128) pixels
-0x9C4E, 0x9C4F, 0x940E, 0x8C0D, 0x83CD, 0x83AD, 0x734C, 0x5ACA, 0x4A27, 0x18A2, 0x2164, 0x2984, 0x2964, 0x2944, 0x2944, 0x2944,   // 0x9500 (38144) pixels
-0x2944, 0x2964, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x18C2, 0x18E2, 0x18E3, 0x18E3, 0x20E3, 0x2103,   // 0x9510 (38160) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2104, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x31A5, 0x2124,   // 0x9520 (38176) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x9530 (38192) pixels
-0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3144, 0x2944, 0x3165, 0x2944, 0x3144, 0x2944, 0x2945, 0x2965, 0x2944,   // 0x9540 (38208) pixels
-0x3144, 0x3144, 0x3165, 0x3144, 0x3144, 0x3144, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x3165, 0x3165, 0x3164, 0x2944, 0x2944,   // 0x9550 (38224) pixels
-0x3164, 0x3985, 0x3165, 0x3165, 0x2965, 0x2945, 0x2944, 0x3164, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965,   // 0x9560 (38240) pixels
-0x2944, 0x3164, 0x2944, 0x2944, 0x2964, 0x3144, 0x2944, 0x2944, 0x3164, 0x3164, 0x2944, 0x3165, 0x3164, 0x3145, 0x2944, 0x2944,   // 0x9570 (38256) pixels
-0x2944, 0x3144, 0x3145, 0x3164, 0x3164, 0x2944, 0x2944, 0x3164, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944,   // 0x9580 (38272) pixels
-0x2965, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x18C2, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3,   // 0x9590 (38288) pixels
-0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x95A0 (38304) pixels
-0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18A2, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2104, 0x2103, 0x2103,   // 0x95B0 (38320) pixels
-0x20E3, 0x20E3, 0x18C2, 0x20E3, 0x18C2, 0x18E3, 0x2924, 0x2944, 0x3144, 0x3164, 0x3144, 0x2944, 0x3144, 0x2944, 0x3144, 0x3164,   // 0x95C0 (38336) pixels
-0x2944, 0x3144, 0x3144, 0x3164, 0x3164, 0x3184, 0x3163, 0x18C2, 0x7B6B, 0x8BED, 0x940E, 0x9C4F, 0xA46F, 0x9C4E, 0xA48F, 0x9C4E,   // 0x95D0 (38352) pixels
-0x940E, 0x8C0D, 0x8BEE, 0x83CD, 0x7BAD, 0x6B0A, 0x5AA9, 0x10A2, 0x2923, 0x2102, 0x2102, 0x2103, 0x18A1, 0x1060, 0x1081, 0x1081,   // 0x95E0 (38368) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x18C3, 0x18C3, 0x18C2, 0x18C2,   // 0x95F0 (38384) pixels
-0x1082, 0x1081, 0x0020, 0x0020, 0x0841, 0x0841, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081,   // 0x9600 (38400) pixels
-0x1061, 0x1082, 0x1061, 0x18C3, 0x20E3, 0x1082, 0x1081, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2,   // 0x9610 (38416) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2,   // 0x9620 (38432) pixels
-0x10A1, 0x0881, 0x10C2, 0x18E3, 0x1902, 0x1902, 0x1923, 0x2143, 0x1942, 0x18C2, 0x7B8B, 0x940E, 0x93ED, 0x9C4F, 0x9C0E, 0x9C4F,   // 0x9630 (38448) pixels
-0x9C6F, 0x9C4F, 0x940E, 0x8BED, 0x838C, 0x7B6C, 0x62EA, 0x3185, 0x18C2, 0x2984, 0x2984, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944,   // 0x9640 (38464) pixels
-0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2103, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103,   // 0x9650 (38480) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2904, 0x2924, 0x3165, 0x2945, 0x2924, 0x2924, 0x2924, 0x2944, 0x3165, 0x2924, 0x2924, 0x2924,   // 0x9660 (38496) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x3985, 0x3165,   // 0x9670 (38512) pixels
-0x2944, 0x3144, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944,   // 0x9680 (38528) pixels
-0x3164, 0x41E6, 0x4207, 0x3185, 0x2944, 0x2944, 0x2944, 0x2964, 0x2964, 0x2944, 0x2944, 0x3165, 0x2944, 0x3165, 0x2944, 0x2944,   // 0x9690 (38544) pixels
-0x2964, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2964, 0x2964, 0x2944, 0x2944, 0x2965, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x96A0 (38560) pixels
-0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944,   // 0x96B0 (38576) pixels
-0x2944, 0x2944, 0x3145, 0x3165, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x96C0 (38592) pixels
-0x2944, 0x2945, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2104, 0x18C2, 0x20E3, 0x18C2, 0x18E2, 0x18C3, 0x18E3,   // 0x96D0 (38608) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3,   // 0x96E0 (38624) pixels
-0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18A2, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2103,   // 0x96F0 (38640) pixels
-0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18E3, 0x2124, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944,   // 0x9700 (38656) pixels
-0x2944, 0x2964, 0x3164, 0x3164, 0x3164, 0x3164, 0x3984, 0x3163, 0x18C2, 0x8BCD, 0x940E, 0x942E, 0x940E, 0x940E, 0x9C4F, 0x9C6F,   // 0x9710 (38672) pixels
-0x9C2F, 0x8C0E, 0x8BED, 0x7BAD, 0x736C, 0x5AA9, 0x18C2, 0x2922, 0x2923, 0x2102, 0x20E3, 0x20E2, 0x10A1, 0x1081, 0x1061, 0x1081,   // 0x9720 (38688) pixels
-0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x0861, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3,   // 0x9730 (38704) pixels
-0x10A2, 0x1082, 0x0020, 0x0020, 0x0840, 0x0841, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081,   // 0x9740 (38720) pixels
-0x1082, 0x1082, 0x0861, 0x18C3, 0x20E3, 0x10A2, 0x1081, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x1082,   // 0x9750 (38736) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2,   // 0x9760 (38752) pixels
-0x1081, 0x10A1, 0x10A2, 0x1903, 0x18E2, 0x1902, 0x1923, 0x2143, 0x2164, 0x1962, 0x20E3, 0x83CD, 0x8BED, 0x940D, 0x940E, 0x9C2E,   // 0x9770 (38768) pixels
-0x9C2E, 0x93EE, 0x8BED, 0x8BED, 0x7B6C, 0x734B, 0x5268, 0x10A2, 0x2163, 0x2984, 0x2964, 0x2964, 0x2964, 0x2944, 0x2964, 0x2965,   // 0x9780 (38784) pixels
-0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x2103,   // 0x9790 (38800) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2923, 0x2944, 0x3185, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x97A0 (38816) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x3164, 0x4A07,   // 0x97B0 (38832) pixels
-0x2924, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x3145, 0x3144, 0x2944, 0x3144, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x97C0 (38848) pixels
-0x3144, 0x3144, 0x3144, 0x3124, 0x3185, 0x3164, 0x3164, 0x2944, 0x2964, 0x2944, 0x2964, 0x2944, 0x3185, 0x3165, 0x3165, 0x3164,   // 0x97D0 (38864) pixels
-0x3164, 0x3165, 0x2945, 0x3144, 0x2964, 0x3165, 0x2944, 0x2944, 0x2944, 0x2964, 0x3145, 0x2944, 0x2944, 0x2944, 0x2964, 0x2964,   // 0x97E0 (38880) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2945, 0x2944,   // 0x97F0 (38896) pixels
-0x2944, 0x2944, 0x2944, 0x3165, 0x3165, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9800 (38912) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2103, 0x18C2, 0x20E3, 0x18C2, 0x18E3, 0x18C3, 0x18C3,   // 0x9810 (38928) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18C2, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18C2,   // 0x9820 (38944) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18A2, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2923, 0x2903, 0x2103,   // 0x9830 (38960) pixels
-0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x20E3, 0x2103, 0x2944, 0x2924, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944,   // 0x9840 (38976) pixels
-0x2944, 0x2944, 0x3164, 0x3164, 0x3164, 0x3164, 0x3184, 0x3164, 0x18C2, 0x39A5, 0x8BED, 0x940E, 0x93EE, 0x940E, 0x940E, 0x9C2E,   // 0x9850 (38992) pixels
-0x942E, 0x8BED, 0x83AC, 0x7B4B, 0x6B0B, 0x3164, 0x18A2, 0x2923, 0x2903, 0x2102, 0x20E3, 0x20E3, 0x18A1, 0x18A2, 0x0860, 0x1081,   // 0x9860 (39008) pixels
-0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x0861, 0x1082, 0x18A2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18C3, 0x18C3,   // 0x9870 (39024) pixels
-0x10A2, 0x1082, 0x0020, 0x0020, 0x0840, 0x0840, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082,   // 0x9880 (39040) pixels
-0x1082, 0x1081, 0x0861, 0x18C2, 0x18E3, 0x18C3, 0x10A2, 0x0881, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082,   // 0x9890 (39056) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x98A0 (39072) pixels
-0x0881, 0x10A2, 0x10A2, 0x18E3, 0x18E2, 0x1902, 0x1903, 0x2123, 0x2143, 0x2984, 0x2163, 0x18C2, 0x2903, 0x7B8B, 0x83CC, 0x8BED,   // 0x98B0 (39088) pixels
-0x8BED, 0x8BCD, 0x83AC, 0x7B6C, 0x62C9, 0x2103, 0x18C2, 0x2984, 0x3184, 0x2964, 0x2944, 0x2944, 0x2965, 0x2944, 0x2964, 0x2965,   // 0x98C0 (39104) pixels
-0x2944, 0x2944, 0x2944, 0x3165, 0x2944, 0x2964, 0x2944, 0x2944, 0x2924, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0x98D0 (39120) pixels
-0x2103, 0x2104, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x39C6, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x98E0 (39136) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x98F0 (39152) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3144, 0x3164, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x3144,   // 0x9900 (39168) pixels
-0x2944, 0x3165, 0x3165, 0x2964, 0x3164, 0x3164, 0x3164, 0x2944, 0x2945, 0x2944, 0x3165, 0x2944, 0x2964, 0x2965, 0x3144, 0x3144,   // 0x9910 (39184) pixels
-0x2944, 0x3165, 0x3165, 0x3165, 0x3164, 0x3164, 0x2964, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9920 (39200) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3145, 0x2944, 0x2944, 0x2944,   // 0x9930 (39216) pixels
-0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x3145, 0x3165, 0x2944, 0x3164, 0x3144,   // 0x9940 (39232) pixels
-0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x18C2, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x9950 (39248) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E3,   // 0x9960 (39264) pixels
-0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2104, 0x2103,   // 0x9970 (39280) pixels
-0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944,   // 0x9980 (39296) pixels
-0x2944, 0x2944, 0x2964, 0x2944, 0x3164, 0x3144, 0x3164, 0x3984, 0x39A5, 0x3143, 0x18C2, 0x5247, 0x83CC, 0x8BED, 0x8BED, 0x8BED,   // 0x9990 (39312) pixels
-0x83CC, 0x838C, 0x734B, 0x4A07, 0x18A2, 0x2922, 0x2943, 0x2923, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18C2, 0x18A2, 0x0840, 0x1061,   // 0x99A0 (39328) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x18A2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0x99B0 (39344) pixels
-0x10A2, 0x1082, 0x0020, 0x0020, 0x0020, 0x0820, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x99C0 (39360) pixels
-0x1061, 0x1082, 0x0861, 0x10A2, 0x18C3, 0x20E3, 0x18C2, 0x1081, 0x0861, 0x0040, 0x0020, 0x0000, 0x0000, 0x0020, 0x0861, 0x1082,   // 0x99D0 (39376) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2,   // 0x99E0 (39392) pixels
-0x0881, 0x10C2, 0x10A1, 0x18E3, 0x18E3, 0x18E2, 0x1903, 0x2123, 0x2123, 0x2144, 0x29A4, 0x2163, 0x18E3, 0x18C2, 0x18C2, 0x62C9,   // 0x99F0 (39408) pixels
-0x62A9, 0x62A9, 0x4A27, 0x18C2, 0x18C2, 0x18C2, 0x2984, 0x2984, 0x2984, 0x2964, 0x2944, 0x2965, 0x2964, 0x2944, 0x2964, 0x2944,   // 0x9A00 (39424) pixels
-0x2944, 0x2944, 0x2965, 0x2944, 0x2964, 0x3164, 0x2944, 0x2924, 0x2924, 0x18C3, 0x18E3, 0x18E3, 0x18E2, 0x18E3, 0x2103, 0x2103,   // 0x9A10 (39440) pixels
-0x2103, 0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924, 0x3185, 0x3165, 0x2124, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x9A20 (39456) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165,   // 0x9A30 (39472) pixels
-0x2944, 0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2945, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2944,   // 0x9A40 (39488) pixels
-0x3144, 0x3165, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x3165, 0x2965, 0x2944, 0x3144, 0x3165,   // 0x9A50 (39504) pixels
-0x3165, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0x9A60 (39520) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2964,   // 0x9A70 (39536) pixels
-0x2944, 0x2944, 0x2944, 0x2964, 0x3164, 0x2944, 0x2944, 0x2944, 0x2945, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3164,   // 0x9A80 (39552) pixels
-0x3144, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x18C2, 0x18E3, 0x18C2, 0x18E3, 0x18E3, 0x18C3,   // 0x9A90 (39568) pixels
-0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3,   // 0x9AA0 (39584) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2104, 0x2103, 0x2103,   // 0x9AB0 (39600) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x2124, 0x2924, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2945, 0x3144, 0x2944,   // 0x9AC0 (39616) pixels
-0x39A6, 0x41C6, 0x2944, 0x3164, 0x3164, 0x3144, 0x3164, 0x3184, 0x39A5, 0x3984, 0x3142, 0x18C3, 0x18C2, 0x3185, 0x62A9, 0x62A9,   // 0x9AD0 (39632) pixels
-0x62A9, 0x3185, 0x18A2, 0x18C2, 0x2943, 0x3144, 0x2923, 0x2903, 0x20E3, 0x20E3, 0x20E3, 0x18E2, 0x18E2, 0x10A2, 0x0840, 0x0861,   // 0x9AE0 (39648) pixels
-0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x10A2, 0x18C3, 0x18A2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3,   // 0x9AF0 (39664) pixels
-0x18C2, 0x1082, 0x0841, 0x0000, 0x0020, 0x0820, 0x0841, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x9B00 (39680) pixels
-0x1061, 0x1081, 0x1081, 0x18C3, 0x18E3, 0x20E3, 0x18C3, 0x1081, 0x0861, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x1082, 0x1082,   // 0x9B10 (39696) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18A2, 0x10C2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x1081,   // 0x9B20 (39712) pixels
-0x0861, 0x10A2, 0x10A2, 0x18E2, 0x18E3, 0x1903, 0x1903, 0x1903, 0x2123, 0x2123, 0x2964, 0x2984, 0x31A5, 0x31C5, 0x29A4, 0x2164,   // 0x9B30 (39728) pixels
-0x2164, 0x2163, 0x2184, 0x29A4, 0x29A4, 0x31A4, 0x3184, 0x2964, 0x2964, 0x2964, 0x2964, 0x2965, 0x2944, 0x2964, 0x2944, 0x2944,   // 0x9B40 (39744) pixels
-0x3144, 0x2964, 0x2944, 0x2944, 0x2964, 0x3164, 0x2944, 0x2924, 0x2124, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x20E3, 0x2103, 0x2103,   // 0x9B50 (39760) pixels
-0x2103, 0x2104, 0x2924, 0x2124, 0x2124, 0x2944, 0x2944, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924,   // 0x9B60 (39776) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9B70 (39792) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944,   // 0x9B80 (39808) pixels
-0x2944, 0x2944, 0x3144, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3165, 0x2944, 0x3144, 0x3165, 0x2944, 0x3165, 0x39A5,   // 0x9B90 (39824) pixels
-0x41E7, 0x3144, 0x2944, 0x41C7, 0x5268, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9BA0 (39840) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944,   // 0x9BB0 (39856) pixels
-0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2945, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x9BC0 (39872) pixels
-0x3144, 0x3164, 0x3165, 0x2944, 0x2944, 0x2944, 0x3165, 0x3985, 0x2924, 0x2103, 0x18C2, 0x20E3, 0x18C3, 0x18E3, 0x18C3, 0x18C3,   // 0x9BD0 (39888) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18E3,   // 0x9BE0 (39904) pixels
-0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18A2, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2123, 0x2103, 0x2104, 0x2103,   // 0x9BF0 (39920) pixels
-0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x18E3, 0x2924, 0x2924, 0x2964, 0x3144, 0x2944, 0x3144, 0x2944, 0x2944, 0x3985,   // 0x9C00 (39936) pixels
-0x3985, 0x2944, 0x2944, 0x2944, 0x3164, 0x3144, 0x2944, 0x3144, 0x3164, 0x3184, 0x3985, 0x3984, 0x39A5, 0x3184, 0x3143, 0x3143,   // 0x9C10 (39952) pixels
-0x3163, 0x3164, 0x3184, 0x3164, 0x3164, 0x2943, 0x2923, 0x2923, 0x2103, 0x20E3, 0x18C2, 0x18C2, 0x18E2, 0x1081, 0x1061, 0x0840,   // 0x9C20 (39968) pixels
-0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10C2, 0x18C2, 0x18C3,   // 0x9C30 (39984) pixels
-0x18C2, 0x10A2, 0x1082, 0x0000, 0x0020, 0x0020, 0x0841, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x9C40 (40000) pixels
-0x1061, 0x1082, 0x1082, 0x18C3, 0x20E3, 0x20E3, 0x18C3, 0x0861, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0861, 0x1082, 0x10A2,   // 0x9C50 (40016) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1081,   // 0x9C60 (40032) pixels
-0x0060, 0x10A1, 0x18C2, 0x18E2, 0x18E2, 0x18E3, 0x1903, 0x2103, 0x2123, 0x2123, 0x2144, 0x2144, 0x2964, 0x2984, 0x31A5, 0x39C5,   // 0x9C70 (40048) pixels
-0x39C6, 0x31C5, 0x31C5, 0x31A5, 0x3184, 0x2984, 0x2964, 0x2944, 0x2964, 0x2944, 0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x3164,   // 0x9C80 (40064) pixels
-0x2944, 0x3185, 0x2924, 0x2944, 0x2944, 0x3164, 0x2944, 0x2924, 0x2103, 0x20E3, 0x18E3, 0x18E2, 0x18E3, 0x20E3, 0x20E3, 0x2104,   // 0x9C90 (40080) pixels
-0x2103, 0x2103, 0x2103, 0x2124, 0x2924, 0x2124, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x9CA0 (40096) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9CB0 (40112) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2965, 0x2965, 0x2945, 0x3165, 0x3165, 0x3144, 0x3144,   // 0x9CC0 (40128) pixels
-0x2944, 0x2944, 0x2944, 0x3165, 0x2965, 0x2944, 0x3164, 0x2964, 0x3165, 0x3145, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944,   // 0x9CD0 (40144) pixels
-0x2944, 0x2944, 0x3144, 0x41E7, 0x41C6, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9CE0 (40160) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944,   // 0x9CF0 (40176) pixels
-0x2944, 0x3144, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2945,   // 0x9D00 (40192) pixels
-0x2944, 0x3144, 0x2944, 0x3145, 0x2944, 0x2944, 0x3164, 0x3165, 0x2924, 0x2103, 0x18A2, 0x20E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x9D10 (40208) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18C3, 0x18E3,   // 0x9D20 (40224) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18A2, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2123, 0x2103, 0x2103, 0x2103,   // 0x9D30 (40240) pixels
-0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9D40 (40256) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3164, 0x3984, 0x39A5, 0x41C6, 0x41C6, 0x39C5,   // 0x9D50 (40272) pixels
-0x39C5, 0x39A5, 0x3184, 0x3144, 0x2943, 0x2923, 0x2923, 0x2103, 0x20E3, 0x20E3, 0x18E2, 0x18E2, 0x18E3, 0x1081, 0x1081, 0x0840,   // 0x9D60 (40288) pixels
-0x0861, 0x1082, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3,   // 0x9D70 (40304) pixels
-0x18C2, 0x10A2, 0x1082, 0x0000, 0x0000, 0x0020, 0x0841, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081,   // 0x9D80 (40320) pixels
-0x1081, 0x1082, 0x18C3, 0x18C3, 0x18C3, 0x20E3, 0x18C3, 0x1081, 0x0861, 0x0020, 0x0000, 0x0000, 0x0040, 0x0881, 0x10A2, 0x10A2,   // 0x9D90 (40336) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0881,   // 0x9DA0 (40352) pixels
-0x0040, 0x1081, 0x18E3, 0x18E3, 0x18E3, 0x18E2, 0x1903, 0x1903, 0x2103, 0x2123, 0x2123, 0x2124, 0x2143, 0x2143, 0x2964, 0x2964,   // 0x9DB0 (40368) pixels
-0x2964, 0x2964, 0x2964, 0x2964, 0x2944, 0x2964, 0x2944, 0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x3164, 0x2944,   // 0x9DC0 (40384) pixels
-0x2944, 0x3144, 0x2944, 0x2944, 0x2965, 0x2944, 0x2924, 0x2924, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2104, 0x2124,   // 0x9DD0 (40400) pixels
-0x2103, 0x2104, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x9DE0 (40416) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9DF0 (40432) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2945, 0x3165, 0x2965, 0x2944, 0x2944, 0x2944,   // 0x9E00 (40448) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2945, 0x3144, 0x2944, 0x3165, 0x3165,   // 0x9E10 (40464) pixels
-0x2944, 0x3144, 0x2924, 0x2924, 0x2924, 0x3144, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x9E20 (40480) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944,   // 0x9E30 (40496) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9E40 (40512) pixels
-0x2944, 0x2944, 0x2944, 0x3145, 0x2924, 0x2945, 0x2944, 0x2944, 0x2944, 0x2124, 0x18C2, 0x20E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x9E50 (40528) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3,   // 0x9E60 (40544) pixels
-0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18C2, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2104, 0x2104,   // 0x9E70 (40560) pixels
-0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E2, 0x20E3, 0x20E3, 0x2103, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164,   // 0x9E80 (40576) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3164, 0x3164, 0x3164, 0x2944, 0x2944, 0x3164, 0x3144, 0x3144, 0x3164,   // 0x9E90 (40592) pixels
-0x3144, 0x2944, 0x2944, 0x2924, 0x2923, 0x2903, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E2, 0x18C2, 0x1081, 0x10A2, 0x0840,   // 0x9EA0 (40608) pixels
-0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x9EB0 (40624) pixels
-0x18C2, 0x10A2, 0x1082, 0x0020, 0x0000, 0x0020, 0x0840, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x9EC0 (40640) pixels
-0x1082, 0x10A2, 0x18C3, 0x18A2, 0x18C3, 0x20E3, 0x18C3, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0861, 0x1082, 0x10A2, 0x10A2,   // 0x9ED0 (40656) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x0861,   // 0x9EE0 (40672) pixels
-0x0881, 0x1081, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x1903, 0x2103, 0x2103, 0x2123, 0x2123, 0x2124, 0x2144, 0x2944, 0x2944, 0x2944,   // 0x9EF0 (40688) pixels
-0x2964, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9F00 (40704) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2924, 0x2103, 0x18C2, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103,   // 0x9F10 (40720) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944,   // 0x9F20 (40736) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9F30 (40752) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2924, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x9F40 (40768) pixels
-0x39A6, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9F50 (40784) pixels
-0x2964, 0x3144, 0x2924, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9F60 (40800) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944,   // 0x9F70 (40816) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x9F80 (40832) pixels
-0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x18C2, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18C3,   // 0x9F90 (40848) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x9FA0 (40864) pixels
-0x18E3, 0x18C2, 0x18E3, 0x18E3, 0x18C2, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2103,   // 0x9FB0 (40880) pixels
-0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E2, 0x18E3, 0x20E3, 0x2924, 0x2924, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944,   // 0x9FC0 (40896) pixels
-0x2944, 0x2944, 0x3144, 0x3144, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2943,   // 0x9FD0 (40912) pixels
-0x2944, 0x3144, 0x2924, 0x2924, 0x2923, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x10A2, 0x1082, 0x0820,   // 0x9FE0 (40928) pixels
-0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x9FF0 (40944) pixels
-0x18C2, 0x10A2, 0x1082, 0x0861, 0x0000, 0x0020, 0x0820, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0xA000 (40960) pixels
-0x1082, 0x10A2, 0x18C3, 0x18A3, 0x18C3, 0x20E4, 0x18C3, 0x0861, 0x0840, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2,   // 0xA010 (40976) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861,   // 0xA020 (40992) pixels
-0x1081, 0x10A2, 0x18C2, 0x18E2, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2123, 0x2123, 0x2123, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA030 (41008) pixels
-0x2964, 0x2944, 0x2944, 0x2964, 0x2944, 0x2964, 0x3165, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA040 (41024) pixels
-0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x2103, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103,   // 0xA050 (41040) pixels
-0x2103, 0x2103, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xA060 (41056) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA070 (41072) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x3145, 0x2944, 0x2944, 0x2965, 0x2944, 0x2945, 0x2944, 0x2945, 0x2944, 0x2944,   // 0xA080 (41088) pixels
-0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x2964, 0x2944,   // 0xA090 (41104) pixels
-0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xA0A0 (41120) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA0B0 (41136) pixels
-0x2945, 0x3165, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA0C0 (41152) pixels
-0x2944, 0x2945, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2103, 0x18C2, 0x20E3, 0x18C2, 0x18C3, 0x18C2, 0x18E3,   // 0xA0D0 (41168) pixels
-0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3,   // 0xA0E0 (41184) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x2944, 0x3165, 0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2104, 0x2103,   // 0xA0F0 (41200) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x2103, 0x2944, 0x3144, 0x3144, 0x3164, 0x2944, 0x2944, 0x2944,   // 0xA100 (41216) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2964, 0x2944, 0x2944, 0x3164, 0x2944, 0x3164, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA110 (41232) pixels
-0x2944, 0x2944, 0x2924, 0x2923, 0x2923, 0x2123, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18C2, 0x18E2, 0x18C2, 0x18A2, 0x1082, 0x0820,   // 0xA120 (41248) pixels
-0x0841, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0xA130 (41264) pixels
-0x18C2, 0x10A2, 0x1082, 0x1081, 0x0000, 0x0020, 0x0820, 0x1061, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081,   // 0xA140 (41280) pixels
-0x18A3, 0x18C3, 0x18C3, 0x18A3, 0x18C3, 0x20E3, 0x18E3, 0x1082, 0x0841, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2,   // 0xA150 (41296) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0040,   // 0xA160 (41312) pixels
-0x10A2, 0x10C2, 0x18E2, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x1903, 0x2123, 0x2124, 0x2124, 0x2123, 0x2123, 0x2944, 0x2944, 0x2944,   // 0xA170 (41328) pixels
-0x2944, 0x2964, 0x2944, 0x2964, 0x2964, 0x2944, 0x39C6, 0x39A5, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA180 (41344) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103,   // 0xA190 (41360) pixels
-0x2103, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924,   // 0xA1A0 (41376) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA1B0 (41392) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA1C0 (41408) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2964, 0x2924,   // 0xA1D0 (41424) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xA1E0 (41440) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xA1F0 (41456) pixels
-0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945,   // 0xA200 (41472) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2104, 0x18C2, 0x20E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2,   // 0xA210 (41488) pixels
-0x18C3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0xA220 (41504) pixels
-0x18C2, 0x18C3, 0x18E3, 0x18C3, 0x18C2, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103,   // 0xA230 (41520) pixels
-0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x2103, 0x2924, 0x2924, 0x3144, 0x3165, 0x2944, 0x2944, 0x2944,   // 0xA240 (41536) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xA250 (41552) pixels
-0x2924, 0x2924, 0x2924, 0x2923, 0x2123, 0x2123, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x1081, 0x0840,   // 0xA260 (41568) pixels
-0x0840, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0xA270 (41584) pixels
-0x18C2, 0x18C2, 0x1082, 0x1082, 0x0000, 0x0020, 0x0020, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0xA280 (41600) pixels
-0x18C3, 0x18E4, 0x18C3, 0x18A3, 0x18C3, 0x18C3, 0x18C3, 0x1082, 0x0841, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2,   // 0xA290 (41616) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x0861,   // 0xA2A0 (41632) pixels
-0x10A2, 0x18E2, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2123, 0x2123, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA2B0 (41648) pixels
-0x2944, 0x2944, 0x2944, 0x41E6, 0x2944, 0x2964, 0x3185, 0x3185, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124,   // 0xA2C0 (41664) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x18C2, 0x20E2, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xA2D0 (41680) pixels
-0x2104, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA2E0 (41696) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA2F0 (41712) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA300 (41728) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA310 (41744) pixels
-0x2944, 0x3165, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA320 (41760) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA330 (41776) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA340 (41792) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2104, 0x18C2, 0x18E3, 0x18C3, 0x18E3, 0x18C2, 0x18C3,   // 0xA350 (41808) pixels
-0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x18C2,   // 0xA360 (41824) pixels
-0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2124,   // 0xA370 (41840) pixels
-0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E2, 0x18E3, 0x2924, 0x2944, 0x2944, 0x2924, 0x3985, 0x2944, 0x2944,   // 0xA380 (41856) pixels
-0x3144, 0x2944, 0x3144, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xA390 (41872) pixels
-0x2924, 0x2924, 0x2924, 0x2923, 0x2923, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x1081, 0x0861,   // 0xA3A0 (41888) pixels
-0x0840, 0x1081, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1081, 0x1082, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0xA3B0 (41904) pixels
-0x18C2, 0x10A2, 0x10A2, 0x1082, 0x0000, 0x0020, 0x0020, 0x0861, 0x1061, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0xA3C0 (41920) pixels
-0x18A3, 0x18C3, 0x18C3, 0x18A3, 0x18C3, 0x1082, 0x10A2, 0x1082, 0x0841, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2,   // 0xA3D0 (41936) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10A2, 0x0881,   // 0xA3E0 (41952) pixels
-0x1082, 0x18E2, 0x3185, 0x5AA9, 0x5248, 0x5A69, 0x5268, 0x3164, 0x2103, 0x5247, 0x9C2E, 0x83AC, 0x83AC, 0x8C0D, 0x62E9, 0x2944,   // 0xA3F0 (41968) pixels
-0x4A07, 0xA46F, 0x5A89, 0x2964, 0x31A5, 0x838C, 0x8BCC, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA400 (41984) pixels
-0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x2924, 0x2124, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xA410 (42000) pixels
-0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA420 (42016) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA430 (42032) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA440 (42048) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA450 (42064) pixels
-0x3165, 0x39C6, 0x41E6, 0x3185, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144,   // 0xA460 (42080) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA470 (42096) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA480 (42112) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2104, 0x18C2, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18E3,   // 0xA490 (42128) pixels
-0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C3,   // 0xA4A0 (42144) pixels
-0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18A2, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2904, 0x2104,   // 0xA4B0 (42160) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA4C0 (42176) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x3144, 0x2944, 0x2944, 0x2944,   // 0xA4D0 (42192) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2123, 0x2123, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x1081, 0x1082,   // 0xA4E0 (42208) pixels
-0x0820, 0x1081, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x0861, 0x10A2, 0x18A2, 0x18A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0xA4F0 (42224) pixels
-0x18C2, 0x18C2, 0x10A2, 0x1082, 0x0000, 0x0000, 0x0820, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081,   // 0xA500 (42240) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x0861, 0x0841, 0x0020, 0x0000, 0x0020, 0x0881, 0x10A2, 0x10A2, 0x10A2,   // 0xA510 (42256) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0xA520 (42272) pixels
-0x1081, 0x18C2, 0x3185, 0x5248, 0x18E3, 0x2103, 0x62A9, 0x5A89, 0x2103, 0x5227, 0x83AC, 0x2924, 0x2944, 0x4A06, 0x83CD, 0x62C9,   // 0xA530 (42288) pixels
-0x2944, 0x4A07, 0x942E, 0x4A07, 0x62CA, 0xB4F1, 0x41E6, 0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA540 (42304) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2103, 0x18E3, 0x2124, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xA550 (42320) pixels
-0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA560 (42336) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA570 (42352) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA580 (42368) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA590 (42384) pixels
-0x2944, 0x3165, 0x3185, 0x39A5, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144,   // 0xA5A0 (42400) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA5B0 (42416) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA5C0 (42432) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3164, 0x3165, 0x3164, 0x3144, 0x2924, 0x18C2, 0x20E3, 0x18C3, 0x18C3, 0x18C2, 0x18E3,   // 0xA5D0 (42448) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3,   // 0xA5E0 (42464) pixels
-0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2904, 0x2124,   // 0xA5F0 (42480) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C3, 0x18E2, 0x2924, 0x2924, 0x2944, 0x2944, 0x2964, 0x3185, 0x3144,   // 0xA600 (42496) pixels
-0x3165, 0x3144, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x6B0A, 0x7B8C, 0x734B, 0x5268,   // 0xA610 (42512) pixels
-0x2944, 0x2924, 0x49E6, 0x4A07, 0x2924, 0x2103, 0x4207, 0x3165, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x1082,   // 0xA620 (42528) pixels
-0x0020, 0x1081, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x1082, 0x1082, 0x18A2, 0x18A2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0xA630 (42544) pixels
-0x18C2, 0x18C2, 0x18A2, 0x1082, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081,   // 0xA640 (42560) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x10A2, 0x0841, 0x0841, 0x0020, 0x0000, 0x0020, 0x1081, 0x10A2, 0x10A2, 0x10A2,   // 0xA650 (42576) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0xA660 (42592) pixels
-0x1081, 0x18C2, 0x39A5, 0x5A68, 0x18E3, 0x2103, 0x62A9, 0x5AA9, 0x2103, 0x5247, 0x83CD, 0x2123, 0x2124, 0x2944, 0x62C9, 0x8BCD,   // 0xA670 (42608) pixels
-0x2944, 0x3164, 0x9C4F, 0x730A, 0x8BED, 0x940E, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA680 (42624) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2124, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xA690 (42640) pixels
-0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA6A0 (42656) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA6B0 (42672) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA6C0 (42688) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA6D0 (42704) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA6E0 (42720) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA6F0 (42736) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA700 (42752) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3185, 0x3185, 0x3165, 0x3165, 0x2944, 0x2104, 0x18C2, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0xA710 (42768) pixels
-0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18C3, 0x18E3,   // 0xA720 (42784) pixels
-0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2104,   // 0xA730 (42800) pixels
-0x2124, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x20E3, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x3144, 0x2924,   // 0xA740 (42816) pixels
-0x39A6, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2945, 0x2944, 0x2924, 0xACB0, 0x7B4B, 0x732B, 0x940E,   // 0xA750 (42832) pixels
-0x5A88, 0x2944, 0x62A9, 0x93ED, 0x3185, 0x2123, 0x62EA, 0x41E6, 0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1081,   // 0xA760 (42848) pixels
-0x0820, 0x1081, 0x10A2, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3,   // 0xA770 (42864) pixels
-0x18C2, 0x18C2, 0x18A2, 0x1082, 0x0020, 0x0000, 0x0020, 0x0841, 0x0861, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081,   // 0xA780 (42880) pixels
-0x18A2, 0x18A2, 0x10A2, 0x18A2, 0x18E3, 0x18E3, 0x18C3, 0x0861, 0x0841, 0x0020, 0x0000, 0x0020, 0x0882, 0x10A2, 0x10A2, 0x10A2,   // 0xA790 (42896) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0xA7A0 (42912) pixels
-0x1081, 0x18C2, 0x39A5, 0x62A9, 0x4A07, 0x5AA9, 0x62CA, 0x3185, 0x2103, 0x5247, 0x83AD, 0x2124, 0x2124, 0x2924, 0x62C9, 0x93ED,   // 0xA7B0 (42928) pixels
-0x2944, 0x2944, 0x6AEA, 0xA48F, 0x9C2E, 0x49E6, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA7C0 (42944) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x18C3, 0x18C2, 0x18E2, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xA7D0 (42960) pixels
-0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA7E0 (42976) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3985, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA7F0 (42992) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA800 (43008) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xA810 (43024) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA820 (43040) pixels
-0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xA830 (43056) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA840 (43072) pixels
-0x2944, 0x2944, 0x2944, 0x3145, 0x3165, 0x3185, 0x3185, 0x3165, 0x2944, 0x2104, 0x18C2, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0xA850 (43088) pixels
-0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18C2, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3,   // 0xA860 (43104) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18A2, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xA870 (43120) pixels
-0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E2, 0x18E3, 0x20E3, 0x2103, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xA880 (43136) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0xA44F, 0x41E7, 0x2924, 0x39A5,   // 0xA890 (43152) pixels
-0x9C4F, 0x2944, 0x6AEA, 0x62C9, 0x83AC, 0x2944, 0x6B0A, 0x41E6, 0x20E3, 0x20E3, 0x18E3, 0x18E2, 0x18C2, 0x18C2, 0x18C2, 0x1081,   // 0xA8A0 (43168) pixels
-0x0820, 0x1081, 0x10A2, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0xA8B0 (43184) pixels
-0x18C3, 0x18C2, 0x18A2, 0x1082, 0x0020, 0x0000, 0x0020, 0x0841, 0x0861, 0x0881, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082,   // 0xA8C0 (43200) pixels
-0x18A2, 0x1082, 0x10A2, 0x18C2, 0x18E3, 0x2103, 0x18E3, 0x0861, 0x0040, 0x0020, 0x0000, 0x0020, 0x0882, 0x10A2, 0x10A2, 0x10A2,   // 0xA8D0 (43216) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0xA8E0 (43232) pixels
-0x1082, 0x18C2, 0x39A5, 0x62C9, 0x5268, 0x6B2B, 0x4A27, 0x2924, 0x2123, 0x5247, 0x83AC, 0x2924, 0x2924, 0x2924, 0x62C9, 0x8BED,   // 0xA8F0 (43248) pixels
-0x2944, 0x2944, 0x39A5, 0x9C4F, 0x732B, 0x3165, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA900 (43264) pixels
-0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2124, 0x18C2, 0x18C3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xA910 (43280) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA920 (43296) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x3985, 0x41A6, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA930 (43312) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA940 (43328) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xA950 (43344) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA960 (43360) pixels
-0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xA970 (43376) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xA980 (43392) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x3165, 0x2944, 0x2944, 0x2104, 0x18C2, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3,   // 0xA990 (43408) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18C2,   // 0xA9A0 (43424) pixels
-0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xA9B0 (43440) pixels
-0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18C2, 0x18E3, 0x2103, 0x2924, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944,   // 0xA9C0 (43456) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0xA44F, 0x41E7, 0x2924, 0x3185,   // 0xA9D0 (43472) pixels
-0x940E, 0x2944, 0x730A, 0x4A07, 0x83AC, 0x41C6, 0x6AEA, 0x41E6, 0x20E3, 0x20E3, 0x18C2, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x1081,   // 0xA9E0 (43488) pixels
-0x0840, 0x1061, 0x1082, 0x0861, 0x1081, 0x1082, 0x1082, 0x0881, 0x1082, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0xA9F0 (43504) pixels
-0x18C2, 0x18C2, 0x18A2, 0x1082, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082,   // 0xAA00 (43520) pixels
-0x1082, 0x0861, 0x1082, 0x18C2, 0x20E3, 0x18E3, 0x18C3, 0x0861, 0x0020, 0x0020, 0x0000, 0x0020, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xAA10 (43536) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2,   // 0xAA20 (43552) pixels
-0x1081, 0x18C2, 0x39A6, 0x5268, 0x18E3, 0x2944, 0x7B6B, 0x41C6, 0x2123, 0x5248, 0x8BCD, 0x2924, 0x2924, 0x39C6, 0x9C2E, 0x5A88,   // 0xAA30 (43568) pixels
-0x2944, 0x2944, 0x2944, 0x940E, 0x6B0A, 0x2944, 0x2944, 0x3185, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAA40 (43584) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x2124, 0x18C3, 0x18C2, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xAA50 (43600) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xAA60 (43616) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2945, 0x3165, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAA70 (43632) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAA80 (43648) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xAA90 (43664) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAAA0 (43680) pixels
-0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xAAB0 (43696) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAAC0 (43712) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2104, 0x18C2, 0x20E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3,   // 0xAAD0 (43728) pixels
-0x18E3, 0x18C3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18C3,   // 0xAAE0 (43744) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2124, 0x2124, 0x2124, 0x2103, 0x2924,   // 0xAAF0 (43760) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18C3, 0x20E3, 0x18E3, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAB00 (43776) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2924, 0x2944, 0x2924, 0xA42E, 0x41E7, 0x2944, 0x3185,   // 0xAB10 (43792) pixels
-0x93EE, 0x2924, 0x6ACA, 0x3165, 0x41C6, 0x83AC, 0x62C9, 0x41C6, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1081,   // 0xAB20 (43808) pixels
-0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x0861, 0x1082, 0x0861, 0x10A2, 0x10C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2,   // 0xAB30 (43824) pixels
-0x18C2, 0x18C2, 0x18A2, 0x1082, 0x0820, 0x0020, 0x0020, 0x0841, 0x0861, 0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0xAB40 (43840) pixels
-0x18A2, 0x1082, 0x10A2, 0x18C3, 0x20E3, 0x18C3, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0000, 0x0020, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xAB50 (43856) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2,   // 0xAB60 (43872) pixels
-0x10A2, 0x18C2, 0x31A5, 0x5268, 0x18E3, 0x2103, 0x6B0A, 0x4A07, 0x2103, 0x5247, 0x8BED, 0x2944, 0x39A5, 0x838C, 0xA44F, 0x39A5,   // 0xAB70 (43888) pixels
-0x2944, 0x2944, 0x2944, 0x940E, 0x6AEA, 0x2944, 0x2944, 0x2944, 0x2944, 0x3985, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAB80 (43904) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2123, 0x18C3, 0x18C2, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104,   // 0xAB90 (43920) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xABA0 (43936) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xABB0 (43952) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xABC0 (43968) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xABD0 (43984) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xABE0 (44000) pixels
-0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xABF0 (44016) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAC00 (44032) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2104, 0x18C2, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0xAC10 (44048) pixels
-0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C2, 0x18E3, 0x18E3,   // 0xAC20 (44064) pixels
-0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2124, 0x2124, 0x2924, 0x2924,   // 0xAC30 (44080) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x20E3, 0x18E2, 0x20E3, 0x20E3, 0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944,   // 0xAC40 (44096) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0xA44F, 0x41E6, 0x3165, 0x62A9,   // 0xAC50 (44112) pixels
-0x7B2B, 0x2923, 0x6AEA, 0x3165, 0x2944, 0x732B, 0x6B0A, 0x41C6, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x1081,   // 0xAC60 (44128) pixels
-0x0861, 0x1081, 0x1081, 0x1081, 0x0881, 0x1081, 0x0881, 0x1081, 0x1081, 0x0861, 0x1082, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2,   // 0xAC70 (44144) pixels
-0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x0840, 0x0020, 0x0820, 0x0841, 0x0861, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082,   // 0xAC80 (44160) pixels
-0x18C3, 0x18C3, 0x10A2, 0x18C3, 0x20E3, 0x18C2, 0x1082, 0x0841, 0x0020, 0x0020, 0x0000, 0x0041, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xAC90 (44176) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082,   // 0xACA0 (44192) pixels
-0x18A2, 0x18C2, 0x3165, 0x4207, 0x18E3, 0x2103, 0x5A88, 0x5A68, 0x2924, 0x4206, 0x838C, 0x8BEE, 0x8BED, 0x5A68, 0x3185, 0x2944,   // 0xACB0 (44208) pixels
-0x2124, 0x2924, 0x2944, 0x7B8C, 0x5A88, 0x2944, 0x3165, 0x2944, 0x2944, 0x3144, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xACC0 (44224) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2103, 0x18C3, 0x18E2, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124,   // 0xACD0 (44240) pixels
-0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xACE0 (44256) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xACF0 (44272) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAD00 (44288) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xAD10 (44304) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3165, 0x3165, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAD20 (44320) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xAD30 (44336) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAD40 (44352) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2124, 0x18C2, 0x20E3, 0x18C3, 0x18E3, 0x18C3, 0x18E3,   // 0xAD50 (44368) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18E3,   // 0xAD60 (44384) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x3185, 0x2124, 0x2103, 0x2124,   // 0xAD70 (44400) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E2, 0x20E3, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAD80 (44416) pixels
-0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x9C2E, 0xA44F, 0x9C0E, 0x730A,   // 0xAD90 (44432) pixels
-0x3165, 0x2923, 0x6AC9, 0x2944, 0x2924, 0x2944, 0x6AEA, 0x39A5, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x1081,   // 0xADA0 (44448) pixels
-0x1081, 0x1061, 0x1081, 0x1081, 0x0881, 0x0881, 0x0861, 0x1081, 0x1081, 0x0861, 0x1082, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0xADB0 (44464) pixels
-0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x0840, 0x0020, 0x0020, 0x0840, 0x0841, 0x1061, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082,   // 0xADC0 (44480) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x20E3, 0x10A2, 0x1082, 0x0841, 0x0020, 0x0020, 0x0000, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xADD0 (44496) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x1082,   // 0xADE0 (44512) pixels
-0x10A2, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x2124, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2924, 0x2944,   // 0xADF0 (44528) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x31A5, 0x3185,   // 0xAE00 (44544) pixels
-0x3165, 0x2944, 0x2944, 0x2924, 0x2924, 0x2103, 0x18C2, 0x18E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124,   // 0xAE10 (44560) pixels
-0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xAE20 (44576) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAE30 (44592) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xAE40 (44608) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xAE50 (44624) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3185, 0x3165, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAE60 (44640) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xAE70 (44656) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAE80 (44672) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2103, 0x18C2, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3,   // 0xAE90 (44688) pixels
-0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0xAEA0 (44704) pixels
-0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C2, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2944, 0x2124, 0x2104, 0x2103,   // 0xAEB0 (44720) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18E3, 0x20E3, 0x2103, 0x2924, 0x2924, 0x2924, 0x2944, 0x3144,   // 0xAEC0 (44736) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xAED0 (44752) pixels
-0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2104, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18A2, 0x18C2, 0x1081,   // 0xAEE0 (44768) pixels
-0x1081, 0x1061, 0x1081, 0x1082, 0x0861, 0x0881, 0x0861, 0x0861, 0x1082, 0x0861, 0x1082, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0xAEF0 (44784) pixels
-0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0840, 0x0841, 0x1061, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082,   // 0xAF00 (44800) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x10A2, 0x1081, 0x0840, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0xAF10 (44816) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x1081,   // 0xAF20 (44832) pixels
-0x18C2, 0x18E3, 0x18C3, 0x18C3, 0x18E2, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2904, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xAF30 (44848) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x2965, 0x3144, 0x2144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0xAF40 (44864) pixels
-0x2965, 0x3144, 0x2944, 0x2924, 0x2124, 0x2103, 0x18E3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124,   // 0xAF50 (44880) pixels
-0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xAF60 (44896) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAF70 (44912) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xAF80 (44928) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAF90 (44944) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x41C6, 0x3185, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xAFA0 (44960) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xAFB0 (44976) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xAFC0 (44992) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x18E3, 0x2103, 0x18E3, 0x20E3, 0x18E3, 0x18E3,   // 0xAFD0 (45008) pixels
-0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3,   // 0xAFE0 (45024) pixels
-0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x18C3, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2104, 0x2104,   // 0xAFF0 (45040) pixels
-0x2104, 0x2103, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x2103, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xB000 (45056) pixels
-0x2944, 0x3144, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB010 (45072) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x1081,   // 0xB020 (45088) pixels
-0x1082, 0x1081, 0x1081, 0x1081, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x0861, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2,   // 0xB030 (45104) pixels
-0x18C3, 0x18C2, 0x18A2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0820, 0x0841, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0xB040 (45120) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x10A2, 0x1081, 0x0840, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0xB050 (45136) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x0861, 0x1081,   // 0xB060 (45152) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924,   // 0xB070 (45168) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0xB080 (45184) pixels
-0x2944, 0x2944, 0x2924, 0x2124, 0x2924, 0x2103, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124,   // 0xB090 (45200) pixels
-0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xB0A0 (45216) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xB0B0 (45232) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB0C0 (45248) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB0D0 (45264) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x39A5, 0x49E6, 0x3165, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB0E0 (45280) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB0F0 (45296) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB100 (45312) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x18E3, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x20E3,   // 0xB110 (45328) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0xB120 (45344) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2104, 0x2124, 0x2103,   // 0xB130 (45360) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x18C2, 0x18C2, 0x2103, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144,   // 0xB140 (45376) pixels
-0x2944, 0x3144, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB150 (45392) pixels
-0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x18E3, 0x18E2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x1081,   // 0xB160 (45408) pixels
-0x1082, 0x1081, 0x1081, 0x0881, 0x0881, 0x0861, 0x0861, 0x1081, 0x1061, 0x0861, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2,   // 0xB170 (45424) pixels
-0x18C2, 0x18C3, 0x18A2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0840, 0x0841, 0x1061, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081,   // 0xB180 (45440) pixels
-0x18C2, 0x18C2, 0x10A2, 0x18A2, 0x18E3, 0x10A2, 0x1082, 0x0840, 0x0020, 0x0000, 0x0000, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xB190 (45456) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0881, 0x0861, 0x1081,   // 0xB1A0 (45472) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2103, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124,   // 0xB1B0 (45488) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB1C0 (45504) pixels
-0x2944, 0x2944, 0x2944, 0x2124, 0x2924, 0x2103, 0x18E3, 0x18C2, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2123,   // 0xB1D0 (45520) pixels
-0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB1E0 (45536) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924,   // 0xB1F0 (45552) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB200 (45568) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB210 (45584) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x3185, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB220 (45600) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB230 (45616) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB240 (45632) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x18E3, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2,   // 0xB250 (45648) pixels
-0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x18A2,   // 0xB260 (45664) pixels
-0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18C2, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2904, 0x2123, 0x2104,   // 0xB270 (45680) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E2, 0x18E3, 0x18C2, 0x2103, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944,   // 0xB280 (45696) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2945, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB290 (45712) pixels
-0x2924, 0x2124, 0x2124, 0x2123, 0x2123, 0x2103, 0x2103, 0x2103, 0x2103, 0x18E3, 0x18E2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1081,   // 0xB2A0 (45728) pixels
-0x10A2, 0x1081, 0x1081, 0x1081, 0x0881, 0x0861, 0x0861, 0x0881, 0x1061, 0x0861, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0xB2B0 (45744) pixels
-0x18C2, 0x18C3, 0x18A3, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0820, 0x0841, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081,   // 0xB2C0 (45760) pixels
-0x18A2, 0x18C3, 0x1082, 0x10A2, 0x18C3, 0x18C3, 0x10A2, 0x0841, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xB2D0 (45776) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0840, 0x1081,   // 0xB2E0 (45792) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2924, 0x2104, 0x2103, 0x2103, 0x2124, 0x2124, 0x2124, 0x2924,   // 0xB2F0 (45808) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944,   // 0xB300 (45824) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xB310 (45840) pixels
-0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB320 (45856) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xB330 (45872) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB340 (45888) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3144, 0x3164, 0x3144, 0x3144, 0x3144,   // 0xB350 (45904) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x3144, 0x3144, 0x3165, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB360 (45920) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944,   // 0xB370 (45936) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB380 (45952) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x3165,   // 0xB390 (45968) pixels
-0x3185, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xB3A0 (45984) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2123,   // 0xB3B0 (46000) pixels
-0x2924, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E2, 0x18C3, 0x20E3, 0x2103, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB3C0 (46016) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924,   // 0xB3D0 (46032) pixels
-0x2924, 0x2123, 0x2923, 0x2124, 0x2123, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x1081,   // 0xB3E0 (46048) pixels
-0x10A2, 0x1081, 0x1081, 0x1082, 0x1081, 0x0881, 0x0861, 0x0881, 0x1081, 0x0861, 0x1082, 0x10C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3,   // 0xB3F0 (46064) pixels
-0x18C3, 0x18C3, 0x18A2, 0x10A2, 0x0881, 0x0000, 0x0020, 0x0840, 0x0841, 0x1061, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081,   // 0xB400 (46080) pixels
-0x10A2, 0x10A2, 0x1061, 0x1082, 0x18C2, 0x18C2, 0x10A2, 0x0841, 0x0020, 0x0020, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xB410 (46096) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x1061,   // 0xB420 (46112) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB430 (46128) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB440 (46144) pixels
-0x2944, 0x2944, 0x2944, 0x3185, 0x2924, 0x18E3, 0x18E2, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124,   // 0xB450 (46160) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB460 (46176) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB470 (46192) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB480 (46208) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x3144, 0x3144, 0x3144,   // 0xB490 (46224) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB4A0 (46240) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB4B0 (46256) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB4C0 (46272) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xB4D0 (46288) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB4E0 (46304) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124,   // 0xB4F0 (46320) pixels
-0x2924, 0x2924, 0x2104, 0x2104, 0x2103, 0x20E3, 0x18E3, 0x18C3, 0x18E3, 0x2104, 0x2103, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xB500 (46336) pixels
-0x3144, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x3185, 0x2944, 0x2924, 0x2924,   // 0xB510 (46352) pixels
-0x2924, 0x2924, 0x2924, 0x2123, 0x2124, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1061,   // 0xB520 (46368) pixels
-0x1082, 0x0861, 0x1061, 0x0881, 0x0881, 0x1061, 0x0881, 0x0861, 0x1081, 0x0881, 0x1082, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0xB530 (46384) pixels
-0x18C2, 0x18C3, 0x18C2, 0x10A2, 0x1061, 0x0000, 0x0020, 0x0820, 0x0841, 0x1061, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082,   // 0xB540 (46400) pixels
-0x18A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x18C2, 0x10A2, 0x0841, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xB550 (46416) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0861, 0x1081,   // 0xB560 (46432) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB570 (46448) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x3164, 0x3144, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944,   // 0xB580 (46464) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2124,   // 0xB590 (46480) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB5A0 (46496) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB5B0 (46512) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB5C0 (46528) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3164,   // 0xB5D0 (46544) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3164, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB5E0 (46560) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB5F0 (46576) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB600 (46592) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB610 (46608) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB620 (46624) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124,   // 0xB630 (46640) pixels
-0x2924, 0x2124, 0x2103, 0x2124, 0x2103, 0x2103, 0x18E3, 0x18C2, 0x18C2, 0x2104, 0x2103, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB640 (46656) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924,   // 0xB650 (46672) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2123, 0x2103, 0x2104, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x1081,   // 0xB660 (46688) pixels
-0x10A2, 0x0841, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0881, 0x1081, 0x0881, 0x1082, 0x10C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0xB670 (46704) pixels
-0x18C3, 0x18C3, 0x10C2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0820, 0x0841, 0x1061, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081,   // 0xB680 (46720) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x0841, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xB690 (46736) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0861, 0x1081,   // 0xB6A0 (46752) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944,   // 0xB6B0 (46768) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x3165, 0x3164, 0x3165, 0x3185, 0x3165, 0x3144, 0x3144, 0x3144, 0x3165, 0x3144, 0x3164,   // 0xB6C0 (46784) pixels
-0x3164, 0x2964, 0x2964, 0x2944, 0x2944, 0x18E3, 0x20E3, 0x18E2, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2124, 0x2924, 0x2924, 0x2924,   // 0xB6D0 (46800) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB6E0 (46816) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB6F0 (46832) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB700 (46848) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144,   // 0xB710 (46864) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3165, 0x3185, 0x3165, 0x3144, 0x2944, 0x2944, 0x2944,   // 0xB720 (46880) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB730 (46896) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB740 (46912) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB750 (46928) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3164, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xB760 (46944) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924,   // 0xB770 (46960) pixels
-0x2124, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E2, 0x18E3, 0x18C2, 0x2103, 0x2924, 0x2944, 0x3164, 0x2944, 0x3144,   // 0xB780 (46976) pixels
-0x3165, 0x3144, 0x3144, 0x2944, 0x3144, 0x3165, 0x3144, 0x3144, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xB790 (46992) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2123, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1081,   // 0xB7A0 (47008) pixels
-0x1082, 0x0840, 0x0841, 0x0861, 0x0881, 0x0861, 0x0861, 0x0881, 0x1082, 0x0881, 0x1082, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0xB7B0 (47024) pixels
-0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081,   // 0xB7C0 (47040) pixels
-0x18C3, 0x18C3, 0x18A3, 0x18A2, 0x18C3, 0x18A2, 0x1082, 0x0841, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xB7D0 (47056) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1061, 0x1081,   // 0xB7E0 (47072) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2944, 0x3985, 0x39A5, 0x39A6, 0x41A6,   // 0xB7F0 (47088) pixels
-0x39A6, 0x39A6, 0x41C6, 0x41C6, 0x41C6, 0x41C6, 0x41C6, 0x41C6, 0x41E6, 0x41E6, 0x41E6, 0x41E6, 0x41E6, 0x41E6, 0x49E7, 0x4A07,   // 0xB800 (47104) pixels
-0x4A07, 0x4A07, 0x4A07, 0x49E7, 0x41C6, 0x3144, 0x20E3, 0x18E2, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xB810 (47120) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB820 (47136) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB830 (47152) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB840 (47168) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144,   // 0xB850 (47184) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x39A5, 0x3985, 0x3165, 0x3144, 0x2944, 0x2944, 0x2944,   // 0xB860 (47200) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB870 (47216) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144,   // 0xB880 (47232) pixels
-0x3144, 0x3144, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB890 (47248) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x3165, 0x3165, 0x3165, 0x3144, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB8A0 (47264) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2104, 0x2124,   // 0xB8B0 (47280) pixels
-0x2923, 0x2924, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x39A6, 0x41C6, 0x41C6, 0x41C6, 0x41C6, 0x41E6,   // 0xB8C0 (47296) pixels
-0x41C6, 0x41C6, 0x41E6, 0x41C6, 0x41C6, 0x41C6, 0x41E6, 0x41C6, 0x41C6, 0x41C6, 0x41C6, 0x41C6, 0x41C6, 0x49E7, 0x41C6, 0x39A5,   // 0xB8D0 (47312) pixels
-0x39A6, 0x39A5, 0x3985, 0x3164, 0x2924, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x1082,   // 0xB8E0 (47328) pixels
-0x1082, 0x0020, 0x0841, 0x0861, 0x0881, 0x0881, 0x0881, 0x0881, 0x1081, 0x1082, 0x1082, 0x10C2, 0x10C2, 0x18C2, 0x18C2, 0x18C2,   // 0xB8F0 (47344) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18A2, 0x0882, 0x0020, 0x0020, 0x0020, 0x0820, 0x0861, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0xB900 (47360) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18A3, 0x18C3, 0x10A2, 0x1082, 0x0840, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xB910 (47376) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x1082, 0x0841, 0x1081, 0x1081,   // 0xB920 (47392) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2103, 0x2124, 0x3144, 0x940E, 0xB511, 0xB511, 0xBD32,   // 0xB930 (47408) pixels
-0xBD52, 0xC553, 0xC553, 0xC553, 0xC594, 0xCD94, 0xC573, 0xCD94, 0xCD94, 0xCD93, 0xC594, 0xC593, 0xCD94, 0xC593, 0xC593, 0xCD94,   // 0xB940 (47424) pixels
-0xCD94, 0xCD94, 0xCD94, 0xC553, 0xB4F1, 0x3185, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB950 (47440) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xB960 (47456) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB970 (47472) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB980 (47488) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144,   // 0xB990 (47504) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3165, 0x3165, 0x3164, 0x3144, 0x2944, 0x2944, 0x2944,   // 0xB9A0 (47520) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB9B0 (47536) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144,   // 0xB9C0 (47552) pixels
-0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xB9D0 (47568) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x3164, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xB9E0 (47584) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924,   // 0xB9F0 (47600) pixels
-0x2103, 0x2924, 0x2903, 0x2104, 0x2103, 0x2103, 0x20E3, 0x18C3, 0x18C2, 0x20C2, 0x7B6C, 0xC552, 0xC572, 0xC573, 0xC573, 0xC573,   // 0xBA00 (47616) pixels
-0xCD94, 0xCD94, 0xC593, 0xCD94, 0xCD93, 0xC592, 0xC593, 0xCD93, 0xC593, 0xCD94, 0xC574, 0xC573, 0xBD32, 0xBD32, 0xBD31, 0xBD52,   // 0xBA10 (47632) pixels
-0xBD12, 0xBD12, 0xB4D0, 0x8BCE, 0x2944, 0x2124, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x2103, 0x1082,   // 0xBA20 (47648) pixels
-0x1082, 0x0020, 0x0841, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0881, 0x1082, 0x1082, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0xBA30 (47664) pixels
-0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x1082, 0x0020, 0x0020, 0x0020, 0x0820, 0x0861, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0xBA40 (47680) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x18C3, 0x18A2, 0x1082, 0x0840, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xBA50 (47696) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x0841, 0x1081, 0x1082,   // 0xBA60 (47712) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18E2, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2104, 0x2124, 0x2924, 0x3164, 0x93EE, 0xACD1, 0xB4F2, 0xB4F2,   // 0xBA70 (47728) pixels
-0xBD12, 0xBD12, 0xBD11, 0xBD32, 0xBD32, 0xC532, 0xC573, 0xBD32, 0xC553, 0xC553, 0xC553, 0xC574, 0xBD32, 0xC553, 0xBD52, 0xBD32,   // 0xBA80 (47744) pixels
-0xC554, 0xBD53, 0xBD52, 0xBD12, 0xB4F1, 0x3165, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2924, 0x3144, 0x2944, 0x3144, 0x3144, 0x2944,   // 0xBA90 (47760) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBAA0 (47776) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBAB0 (47792) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBAC0 (47808) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144,   // 0xBAD0 (47824) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBAE0 (47840) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBAF0 (47856) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144,   // 0xBB00 (47872) pixels
-0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBB10 (47888) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xBB20 (47904) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xBB30 (47920) pixels
-0x2904, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x7B6C, 0xBD12, 0xC553, 0xBD32, 0xC532, 0xBD32,   // 0xBB40 (47936) pixels
-0xBD32, 0xC553, 0xC533, 0xBD32, 0xC533, 0xC552, 0xC552, 0xBD31, 0xBD32, 0xBD12, 0xC533, 0xB4F1, 0xB4F1, 0xB511, 0xBD11, 0xB4F0,   // 0xBB50 (47952) pixels
-0xB4F2, 0xACAF, 0xACB0, 0x8BAD, 0x2944, 0x2103, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x1082,   // 0xBB60 (47968) pixels
-0x1081, 0x0820, 0x0841, 0x0861, 0x1061, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3,   // 0xBB70 (47984) pixels
-0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x0881, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0xBB80 (48000) pixels
-0x10C3, 0x18C3, 0x18C3, 0x18A2, 0x18C3, 0x10A2, 0x1081, 0x0840, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xBB90 (48016) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x1082, 0x0840, 0x1081, 0x1082,   // 0xBBA0 (48032) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2103, 0x2924, 0x2944, 0x940E, 0xB4F1, 0xB4F0, 0xB512,   // 0xBBB0 (48048) pixels
-0xB512, 0xB511, 0xBD32, 0xBD31, 0xBD51, 0xBD52, 0xC552, 0xC553, 0xC572, 0xC572, 0xC552, 0xC573, 0xC572, 0xC552, 0xCD93, 0xCD93,   // 0xBBC0 (48064) pixels
-0xC572, 0xCD93, 0xC593, 0xBD72, 0xB511, 0x41E6, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBBD0 (48080) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBBE0 (48096) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBBF0 (48112) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBC00 (48128) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144,   // 0xBC10 (48144) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBC20 (48160) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBC30 (48176) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144,   // 0xBC40 (48192) pixels
-0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBC50 (48208) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xBC60 (48224) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2123,   // 0xBC70 (48240) pixels
-0x2904, 0x2104, 0x2103, 0x2104, 0x2104, 0x2103, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x7B6B, 0xC551, 0xC593, 0xC572, 0xCD93, 0xC552,   // 0xBC80 (48256) pixels
-0xC573, 0xBD52, 0xBD32, 0xBD52, 0xC552, 0xBD52, 0xBD52, 0xC573, 0xBD32, 0xBD31, 0xBD52, 0xBD32, 0xBD11, 0xB511, 0xB4F0, 0xB4F2,   // 0xBC90 (48272) pixels
-0xB4D0, 0xB4F1, 0xACAF, 0x8BCD, 0x2924, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x10A2,   // 0xBCA0 (48288) pixels
-0x1082, 0x0820, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1082, 0x1082, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0xBCB0 (48304) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x1081, 0x0840, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0xBCC0 (48320) pixels
-0x10A3, 0x18C3, 0x18C3, 0x18A3, 0x18C3, 0x10A2, 0x0861, 0x0840, 0x0020, 0x0000, 0x0040, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xBCD0 (48336) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1082, 0x1081,   // 0xBCE0 (48352) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18E2, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2124, 0x2103, 0x2924, 0x2944, 0x940E, 0xB4F1, 0xB4D0, 0xB4F1,   // 0xBCF0 (48368) pixels
-0xB4F1, 0xB510, 0xB511, 0xC532, 0xBD52, 0xC573, 0xC553, 0xBD51, 0xBD51, 0xBD52, 0xBD52, 0xBD51, 0xBD31, 0xC553, 0xC573, 0xC593,   // 0xBD00 (48384) pixels
-0xC573, 0xC573, 0xC592, 0xC552, 0xB510, 0x41E6, 0x2103, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xBD10 (48400) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBD20 (48416) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBD30 (48432) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBD40 (48448) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0xBD50 (48464) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBD60 (48480) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBD70 (48496) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144,   // 0xBD80 (48512) pixels
-0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBD90 (48528) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xBDA0 (48544) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2104,   // 0xBDB0 (48560) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x8BED, 0xC572, 0xC573, 0xC571, 0xC572, 0xBD52,   // 0xBDC0 (48576) pixels
-0xC572, 0xC572, 0xC573, 0xC552, 0xBD51, 0xC572, 0xC572, 0xBD31, 0xBD51, 0xBD32, 0xBD32, 0xBD32, 0xBD32, 0xBD11, 0xBD11, 0xB4F0,   // 0xBDD0 (48592) pixels
-0xB512, 0xB4F1, 0xACCF, 0x83AD, 0x2924, 0x2124, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E2, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x1081,   // 0xBDE0 (48608) pixels
-0x1082, 0x0820, 0x0841, 0x0861, 0x0861, 0x0881, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0xBDF0 (48624) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18A2, 0x1081, 0x0820, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082,   // 0xBE00 (48640) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18A3, 0x18C3, 0x10A2, 0x0861, 0x0840, 0x0020, 0x0020, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xBE10 (48656) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x1082, 0x0861, 0x1081, 0x1082,   // 0xBE20 (48672) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2124, 0x2123, 0x2124, 0x2944, 0x940E, 0xACD0, 0xB4F1, 0xB4D0,   // 0xBE30 (48688) pixels
-0xBD11, 0xB511, 0xBD32, 0xBD32, 0xC572, 0xBD52, 0xC552, 0xC573, 0xC573, 0xC553, 0xC552, 0xBD52, 0xC553, 0xC553, 0xC573, 0xC572,   // 0xBE40 (48704) pixels
-0xC573, 0xCD93, 0xC572, 0xC572, 0xBD31, 0x5227, 0x2103, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2124, 0x2924, 0x2924, 0x2924,   // 0xBE50 (48720) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBE60 (48736) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBE70 (48752) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBE80 (48768) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0xBE90 (48784) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBEA0 (48800) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBEB0 (48816) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144,   // 0xBEC0 (48832) pixels
-0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBED0 (48848) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xBEE0 (48864) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924,   // 0xBEF0 (48880) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x93EE, 0xC552, 0xCD94, 0xC573, 0xCD93, 0xBD52,   // 0xBF00 (48896) pixels
-0xBD52, 0xBD52, 0xBD52, 0xC532, 0xC573, 0xC552, 0xC552, 0xBD31, 0xBD32, 0xBD52, 0xBD31, 0xBD12, 0xBD32, 0xB4F1, 0xB4F1, 0xB4F0,   // 0xBF10 (48912) pixels
-0xB4F2, 0xB4F1, 0xB4D0, 0x83AD, 0x2924, 0x2104, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x1081,   // 0xBF20 (48928) pixels
-0x1082, 0x0020, 0x0841, 0x0861, 0x0861, 0x0881, 0x1081, 0x1061, 0x1061, 0x1082, 0x10A2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0xBF30 (48944) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x1081, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082,   // 0xBF40 (48960) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x0861, 0x0840, 0x0020, 0x0000, 0x0020, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xBF50 (48976) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x1081, 0x1081, 0x1081,   // 0xBF60 (48992) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2124, 0x2124, 0x2124, 0x2944, 0x940E, 0xB4F1, 0xB4F1, 0xB4D0,   // 0xBF70 (49008) pixels
-0xBD12, 0xBD12, 0xBD13, 0xBD12, 0xBD32, 0xC552, 0xBD32, 0xC553, 0xC553, 0xC553, 0xBD52, 0xBD53, 0xC574, 0xC553, 0xC553, 0xC573,   // 0xBF80 (49024) pixels
-0xC573, 0xC574, 0xC572, 0xCD74, 0xBD31, 0x62C9, 0x2103, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2124, 0x2924,   // 0xBF90 (49040) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x3165,   // 0xBFA0 (49056) pixels
-0x3165, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBFB0 (49072) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBFC0 (49088) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144,   // 0xBFD0 (49104) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xBFE0 (49120) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xBFF0 (49136) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144,   // 0xC000 (49152) pixels
-0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC010 (49168) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC020 (49184) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124,   // 0xC030 (49200) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E2, 0x20E3, 0x9C0F, 0xC573, 0xBD52, 0xC573, 0xBD52, 0xBD52,   // 0xC040 (49216) pixels
-0xC553, 0xC553, 0xC553, 0xBD33, 0xC573, 0xC553, 0xC533, 0xBD32, 0xBD52, 0xC553, 0xB531, 0xB511, 0xB511, 0xBD11, 0xB4F1, 0xB4D1,   // 0xC050 (49232) pixels
-0xB4D0, 0xB4D1, 0xACD1, 0x838C, 0x2924, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1081,   // 0xC060 (49248) pixels
-0x1082, 0x0820, 0x0841, 0x0861, 0x1061, 0x0861, 0x0882, 0x1061, 0x1081, 0x1081, 0x1082, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2,   // 0xC070 (49264) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x0881, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082,   // 0xC080 (49280) pixels
-0x18C3, 0x20C3, 0x18C3, 0x18A3, 0x10A2, 0x1082, 0x0861, 0x0840, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xC090 (49296) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1081,   // 0xC0A0 (49312) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2124, 0x2924, 0x2924, 0x8BED, 0xAC90, 0xACB0, 0xACB0,   // 0xC0B0 (49328) pixels
-0xACB0, 0xB4D1, 0xB4D0, 0xB4D1, 0xBD12, 0xB511, 0xBD12, 0xB511, 0xB511, 0xB511, 0xB511, 0xBD12, 0xB511, 0xBD12, 0xBD11, 0xBD12,   // 0xC0C0 (49344) pixels
-0xBD12, 0xB4F1, 0xBD12, 0xB4F1, 0xACAF, 0x5A88, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124,   // 0xC0D0 (49360) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x3165,   // 0xC0E0 (49376) pixels
-0x3985, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC0F0 (49392) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC100 (49408) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144,   // 0xC110 (49424) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC120 (49440) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC130 (49456) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3164,   // 0xC140 (49472) pixels
-0x3164, 0x3144, 0x3144, 0x3144, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC150 (49488) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC160 (49504) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2104,   // 0xC170 (49520) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x93EE, 0xB4D1, 0xB4D1, 0xB4F1, 0xB4F1, 0xB4F1,   // 0xC180 (49536) pixels
-0xB512, 0xBD12, 0xB4F1, 0xBD12, 0xBD12, 0xBD12, 0xBCF1, 0xBD12, 0xB511, 0xB4F1, 0xB4F1, 0xB4D1, 0xB4D0, 0xB4B0, 0xACB0, 0xACB1,   // 0xC190 (49552) pixels
-0xAC90, 0xA490, 0xA46F, 0x7B4B, 0x2924, 0x2904, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x1061,   // 0xC1A0 (49568) pixels
-0x1082, 0x0840, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0xC1B0 (49584) pixels
-0x18C2, 0x18C3, 0x18C2, 0x10C2, 0x0881, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0xC1C0 (49600) pixels
-0x18C3, 0x20E3, 0x20E4, 0x18A3, 0x1082, 0x1081, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xC1D0 (49616) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1081,   // 0xC1E0 (49632) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xC1F0 (49648) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x3144, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3145, 0x2944, 0x2944,   // 0xC200 (49664) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xC210 (49680) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xC220 (49696) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC230 (49712) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC240 (49728) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144,   // 0xC250 (49744) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC260 (49760) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC270 (49776) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x3165, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC280 (49792) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC290 (49808) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xC2A0 (49824) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2104, 0x2924, 0x2103,   // 0xC2B0 (49840) pixels
-0x2924, 0x2944, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18C3, 0x20E3, 0x18E3, 0x18E3, 0x2104, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC2C0 (49856) pixels
-0x3164, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC2D0 (49872) pixels
-0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x1061,   // 0xC2E0 (49888) pixels
-0x1082, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1082, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0xC2F0 (49904) pixels
-0x18C2, 0x18C3, 0x18C3, 0x10C2, 0x0861, 0x0000, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082,   // 0xC300 (49920) pixels
-0x18C3, 0x20E3, 0x2104, 0x18C3, 0x1081, 0x0881, 0x0861, 0x0840, 0x0020, 0x0000, 0x0020, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xC310 (49936) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1081,   // 0xC320 (49952) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC330 (49968) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2965, 0x2944, 0x2964, 0x2945, 0x3164,   // 0xC340 (49984) pixels
-0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xC350 (50000) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xC360 (50016) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC370 (50032) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC380 (50048) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC390 (50064) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC3A0 (50080) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC3B0 (50096) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC3C0 (50112) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC3D0 (50128) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC3E0 (50144) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2104, 0x2103, 0x2104,   // 0xC3F0 (50160) pixels
-0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18E3, 0x2124, 0x2924, 0x2944, 0x2944, 0x3145, 0x3185,   // 0xC400 (50176) pixels
-0x3165, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xC410 (50192) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2103, 0x2103, 0x20E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x1081,   // 0xC420 (50208) pixels
-0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x0881, 0x0881, 0x1081, 0x1081, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0xC430 (50224) pixels
-0x18C2, 0x18C3, 0x18C2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0xC440 (50240) pixels
-0x18A2, 0x18C3, 0x18E3, 0x18C3, 0x1081, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xC450 (50256) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1081,   // 0xC460 (50272) pixels
-0x18C2, 0x18C2, 0x18C3, 0x20E3, 0x2104, 0x20E3, 0x2924, 0x31A5, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124, 0x2924, 0x2924, 0x2944,   // 0xC470 (50288) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2945, 0x2944, 0x2944, 0x2945,   // 0xC480 (50304) pixels
-0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2103, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xC490 (50320) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xC4A0 (50336) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC4B0 (50352) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xC4C0 (50368) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC4D0 (50384) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xC4E0 (50400) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC4F0 (50416) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC500 (50432) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC510 (50448) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC520 (50464) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2103, 0x2904, 0x2104,   // 0xC530 (50480) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x20C2, 0x18E3, 0x18C2, 0x18E3, 0x2104, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xC540 (50496) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924,   // 0xC550 (50512) pixels
-0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2104, 0x2103, 0x20E3, 0x2944, 0x2104, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1081,   // 0xC560 (50528) pixels
-0x1082, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x1081, 0x1082, 0x1061, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0xC570 (50544) pixels
-0x18C2, 0x18C3, 0x18C2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081,   // 0xC580 (50560) pixels
-0x18A2, 0x18C3, 0x18C3, 0x10A2, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xC590 (50576) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x1904, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1082,   // 0xC5A0 (50592) pixels
-0x10C2, 0x18C3, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x2944, 0x3185, 0x20E3, 0x2103, 0x2104, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xC5B0 (50608) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x3165, 0x3986,   // 0xC5C0 (50624) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2103, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xC5D0 (50640) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xC5E0 (50656) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC5F0 (50672) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xC600 (50688) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC610 (50704) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC620 (50720) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC630 (50736) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC640 (50752) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC650 (50768) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC660 (50784) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104,   // 0xC670 (50800) pixels
-0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18C3, 0x18C2, 0x18C3, 0x20E3, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xC680 (50816) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC690 (50832) pixels
-0x2924, 0x2924, 0x2103, 0x2124, 0x2124, 0x2103, 0x2104, 0x2103, 0x2965, 0x2124, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x1081,   // 0xC6A0 (50848) pixels
-0x1082, 0x1061, 0x1061, 0x0861, 0x0861, 0x1081, 0x0861, 0x0861, 0x1081, 0x0861, 0x10A2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3,   // 0xC6B0 (50864) pixels
-0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0xC6C0 (50880) pixels
-0x18A2, 0x20E3, 0x18C3, 0x10A2, 0x0881, 0x0861, 0x0861, 0x0840, 0x0020, 0x0000, 0x0000, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xC6D0 (50896) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x2104, 0x10C2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1082,   // 0xC6E0 (50912) pixels
-0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x2103, 0x20E3, 0x20E3, 0x2124, 0x2104, 0x2104, 0x2124, 0x2123, 0x2124, 0x2924, 0x2924,   // 0xC6F0 (50928) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0xC700 (50944) pixels
-0x3144, 0x2944, 0x2945, 0x2944, 0x2944, 0x2103, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xC710 (50960) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xC720 (50976) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC730 (50992) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC740 (51008) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC750 (51024) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC760 (51040) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xC770 (51056) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC780 (51072) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC790 (51088) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC7A0 (51104) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2904, 0x2103,   // 0xC7B0 (51120) pixels
-0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x18E3, 0x18E2, 0x18C3, 0x18C2, 0x2103, 0x2124, 0x3165, 0x3164, 0x2944, 0x2944, 0x2924,   // 0xC7C0 (51136) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC7D0 (51152) pixels
-0x2124, 0x2124, 0x2124, 0x2103, 0x2104, 0x2103, 0x2124, 0x2104, 0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x1081,   // 0xC7E0 (51168) pixels
-0x1081, 0x1081, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x0881, 0x1082, 0x0861, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0xC7F0 (51184) pixels
-0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0820, 0x0841, 0x0861, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0xC800 (51200) pixels
-0x10A2, 0x18C3, 0x10A2, 0x1081, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0000, 0x0000, 0x0841, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0xC810 (51216) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18E3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1082,   // 0xC820 (51232) pixels
-0x10A2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x2104, 0x2104, 0x2103, 0x2124, 0x2103, 0x2124, 0x2924, 0x2124, 0x2924,   // 0xC830 (51248) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0xC840 (51264) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2124, 0x18E3, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xC850 (51280) pixels
-0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xC860 (51296) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC870 (51312) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC880 (51328) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC890 (51344) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xC8A0 (51360) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC8B0 (51376) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC8C0 (51392) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xC8D0 (51408) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC8E0 (51424) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2103, 0x2104, 0x2103,   // 0xC8F0 (51440) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18E3, 0x2103, 0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924,   // 0xC900 (51456) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xC910 (51472) pixels
-0x2124, 0x2924, 0x2124, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x1081,   // 0xC920 (51488) pixels
-0x0861, 0x1081, 0x1061, 0x0881, 0x1081, 0x0861, 0x0861, 0x1081, 0x1081, 0x0861, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0xC930 (51504) pixels
-0x18C3, 0x18C2, 0x10C2, 0x10A2, 0x0841, 0x0000, 0x0020, 0x0840, 0x0841, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0xC940 (51520) pixels
-0x1082, 0x18A2, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xC950 (51536) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x1082,   // 0xC960 (51552) pixels
-0x1082, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2103, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924,   // 0xC970 (51568) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xC980 (51584) pixels
-0x39A6, 0x39A6, 0x2944, 0x2944, 0x2944, 0x2944, 0x18E3, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xC990 (51600) pixels
-0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xC9A0 (51616) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC9B0 (51632) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC9C0 (51648) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xC9D0 (51664) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xC9E0 (51680) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xC9F0 (51696) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xCA00 (51712) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xCA10 (51728) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xCA20 (51744) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2103, 0x2104,   // 0xCA30 (51760) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x2103, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944,   // 0xCA40 (51776) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124,   // 0xCA50 (51792) pixels
-0x2124, 0x2924, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1081,   // 0xCA60 (51808) pixels
-0x0861, 0x1081, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x1081, 0x1061, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0xCA70 (51824) pixels
-0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x0840, 0x0020, 0x0020, 0x0840, 0x0841, 0x0861, 0x1081, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082,   // 0xCA80 (51840) pixels
-0x1061, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xCA90 (51856) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082,   // 0xCAA0 (51872) pixels
-0x1081, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x2103, 0x20E3, 0x2104, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104, 0x2924, 0x2924, 0x2924,   // 0xCAB0 (51888) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xCAC0 (51904) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x18E3, 0x18E3, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xCAD0 (51920) pixels
-0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xCAE0 (51936) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCAF0 (51952) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCB00 (51968) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xCB10 (51984) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xCB20 (52000) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCB30 (52016) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCB40 (52032) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xCB50 (52048) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xCB60 (52064) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2103, 0x2103, 0x2104,   // 0xCB70 (52080) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x2103, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924,   // 0xCB80 (52096) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xCB90 (52112) pixels
-0x2924, 0x2124, 0x2124, 0x2103, 0x2104, 0x2124, 0x2124, 0x20E3, 0x20E3, 0x20E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x1082,   // 0xCBA0 (52128) pixels
-0x0820, 0x1061, 0x1061, 0x0861, 0x1081, 0x0861, 0x1061, 0x1061, 0x1081, 0x1061, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0xCBB0 (52144) pixels
-0x18C3, 0x18C2, 0x18A2, 0x1082, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x0861, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0xCBC0 (52160) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0000, 0x0000, 0x0040, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xCBD0 (52176) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x1082, 0x10A2,   // 0xCBE0 (52192) pixels
-0x1061, 0x18C2, 0x18C2, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2924, 0x2924, 0x2924,   // 0xCBF0 (52208) pixels
-0x2924, 0x2924, 0x2904, 0x3144, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xCC00 (52224) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xCC10 (52240) pixels
-0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924,   // 0xCC20 (52256) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCC30 (52272) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCC40 (52288) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3165, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xCC50 (52304) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xCC60 (52320) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCC70 (52336) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCC80 (52352) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924,   // 0xCC90 (52368) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xCCA0 (52384) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2124, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2904, 0x2104, 0x2103,   // 0xCCB0 (52400) pixels
-0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x2103, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCCC0 (52416) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x3186, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xCCD0 (52432) pixels
-0x2924, 0x2924, 0x2904, 0x2103, 0x2924, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x1082,   // 0xCCE0 (52448) pixels
-0x0020, 0x1081, 0x0881, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1081, 0x1081, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2,   // 0xCCF0 (52464) pixels
-0x18C2, 0x18A2, 0x10A2, 0x1082, 0x0020, 0x0000, 0x0020, 0x0840, 0x0861, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082,   // 0xCD00 (52480) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0020, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xCD10 (52496) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10C2, 0x10A2, 0x18A2, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2,   // 0xCD20 (52512) pixels
-0x1061, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2944, 0x2924, 0x2103, 0x2124, 0x2924, 0x2924,   // 0xCD30 (52528) pixels
-0x2924, 0x2924, 0x2924, 0x39A6, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCD40 (52544) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x3165, 0x2924, 0x2944, 0x18C2, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xCD50 (52560) pixels
-0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xCD60 (52576) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCD70 (52592) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCD80 (52608) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCD90 (52624) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xCDA0 (52640) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCDB0 (52656) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCDC0 (52672) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xCDD0 (52688) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xCDE0 (52704) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2904, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103,   // 0xCDF0 (52720) pixels
-0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E2, 0x18C2, 0x18C2, 0x18C2, 0x2104, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0xCE00 (52736) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x3985, 0x3165, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124,   // 0xCE10 (52752) pixels
-0x2124, 0x2104, 0x2124, 0x2904, 0x2904, 0x2104, 0x20E3, 0x20E3, 0x20E3, 0x18C3, 0x18C3, 0x18C3, 0x2103, 0x18A2, 0x10A2, 0x1082,   // 0xCE20 (52768) pixels
-0x0020, 0x0861, 0x0881, 0x0881, 0x1061, 0x0881, 0x0861, 0x1061, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0xCE30 (52784) pixels
-0x18C3, 0x18C3, 0x10A2, 0x1082, 0x0020, 0x0000, 0x0020, 0x0841, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082,   // 0xCE40 (52800) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0000, 0x0000, 0x0020, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0xCE50 (52816) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x10A2,   // 0xCE60 (52832) pixels
-0x0861, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x20E3, 0x2104, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2924, 0x2103, 0x2924, 0x2924,   // 0xCE70 (52848) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944,   // 0xCE80 (52864) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x18C2, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103,   // 0xCE90 (52880) pixels
-0x2104, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0xCEA0 (52896) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2945, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944,   // 0xCEB0 (52912) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3165, 0x2944, 0x2944, 0x2924, 0x2944, 0x3145, 0x3185,   // 0xCEC0 (52928) pixels
-0x3165, 0x3145, 0x2924, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924,   // 0xCED0 (52944) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x3144, 0x3185, 0x3185, 0x2944, 0x2924,   // 0xCEE0 (52960) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944,   // 0xCEF0 (52976) pixels
-0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xCF00 (52992) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xCF10 (53008) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924,   // 0xCF20 (53024) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2124, 0x2904, 0x2104, 0x2103, 0x2104, 0x2103, 0x2103,   // 0xCF30 (53040) pixels
-0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944,   // 0xCF40 (53056) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2124, 0x3185, 0x2944, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2124, 0x2124,   // 0xCF50 (53072) pixels
-0x2924, 0x2103, 0x2103, 0x2904, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x10A2, 0x1082,   // 0xCF60 (53088) pixels
-0x0020, 0x1081, 0x0881, 0x0881, 0x0861, 0x0861, 0x1061, 0x0882, 0x1061, 0x1082, 0x10A2, 0x18A2, 0x18C3, 0x18C3, 0x18C2, 0x18C2,   // 0xCF70 (53104) pixels
-0x18C3, 0x18C2, 0x10A2, 0x0882, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082,   // 0xCF80 (53120) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0020, 0x1081, 0x10A2, 0x10A2, 0x10A2,   // 0xCF90 (53136) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2,   // 0xCFA0 (53152) pixels
-0x1061, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E2, 0x2104, 0x2924, 0x20E3, 0x2104, 0x2124, 0x2103, 0x2124, 0x2124, 0x2124, 0x2124,   // 0xCFB0 (53168) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x4207, 0x3185, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xCFC0 (53184) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103,   // 0xCFD0 (53200) pixels
-0x2104, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924,   // 0xCFE0 (53216) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x2944, 0x3165, 0x2945, 0x2944, 0x3185, 0x2944, 0x2964, 0x2944,   // 0xCFF0 (53232) pixels
-0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2924, 0x2944, 0x2924, 0x3144, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x39A5, 0x3144,   // 0xD000 (53248) pixels
-0x2945, 0x2924, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD010 (53264) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x3165, 0x2924, 0x2924, 0x2944, 0x3144, 0x3144, 0x2924, 0x2924, 0x2924,   // 0xD020 (53280) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xD030 (53296) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xD040 (53312) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924,   // 0xD050 (53328) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xD060 (53344) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2924, 0x2103, 0x2104, 0x2103,   // 0xD070 (53360) pixels
-0x2103, 0x20E3, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xD080 (53376) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x3165, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2124,   // 0xD090 (53392) pixels
-0x2924, 0x2904, 0x2103, 0x2104, 0x2904, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x1082, 0x1082,   // 0xD0A0 (53408) pixels
-0x0020, 0x1081, 0x0881, 0x0881, 0x0881, 0x0861, 0x0861, 0x1061, 0x1061, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0xD0B0 (53424) pixels
-0x18C2, 0x18C2, 0x18A2, 0x0881, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0xD0C0 (53440) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0000, 0x0000, 0x0020, 0x0881, 0x10A2, 0x10A2, 0x10A2,   // 0xD0D0 (53456) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x1081,   // 0xD0E0 (53472) pixels
-0x1081, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124,   // 0xD0F0 (53488) pixels
-0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0xD100 (53504) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0xD110 (53520) pixels
-0x2124, 0x2904, 0x2123, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xD120 (53536) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x3145, 0x2944,   // 0xD130 (53552) pixels
-0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xD140 (53568) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD150 (53584) pixels
-0x2944, 0x2924, 0x2924, 0x2964, 0x2124, 0x2124, 0x2924, 0x2924, 0x2945, 0x2924, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD160 (53600) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD170 (53616) pixels
-0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD180 (53632) pixels
-0x2944, 0x2945, 0x2944, 0x2945, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xD190 (53648) pixels
-0x41E7, 0x31A5, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xD1A0 (53664) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2104, 0x2104, 0x2103, 0x2104, 0x2103,   // 0xD1B0 (53680) pixels
-0x2103, 0x20E3, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x20E3, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xD1C0 (53696) pixels
-0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x3144, 0x2924, 0x2944, 0x2124, 0x2924, 0x2124, 0x2924,   // 0xD1D0 (53712) pixels
-0x2124, 0x2124, 0x2104, 0x2103, 0x2103, 0x2103, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1061, 0x1081,   // 0xD1E0 (53728) pixels
-0x0020, 0x1081, 0x0881, 0x0881, 0x0881, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x18C2, 0x10C2, 0x18C2,   // 0xD1F0 (53744) pixels
-0x18C2, 0x18C2, 0x18A2, 0x1081, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0xD200 (53760) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2,   // 0xD210 (53776) pixels
-0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x0861,   // 0xD220 (53792) pixels
-0x1081, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2924, 0x2923, 0x2904,   // 0xD230 (53808) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924,   // 0xD240 (53824) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x20E3, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103,   // 0xD250 (53840) pixels
-0x2103, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xD260 (53856) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x3144, 0x2944, 0x3145, 0x2945, 0x3145, 0x2944,   // 0xD270 (53872) pixels
-0x2944, 0x3164, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944,   // 0xD280 (53888) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD290 (53904) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x3144, 0x2944, 0x2924, 0x2944, 0x2965, 0x2944,   // 0xD2A0 (53920) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924,   // 0xD2B0 (53936) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD2C0 (53952) pixels
-0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xD2D0 (53968) pixels
-0x41E7, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924,   // 0xD2E0 (53984) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924, 0x2103, 0x2124, 0x2103, 0x2104, 0x2104,   // 0xD2F0 (54000) pixels
-0x2104, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x2103, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xD300 (54016) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2124, 0x2944, 0x2124, 0x2124, 0x2124, 0x2124,   // 0xD310 (54032) pixels
-0x2104, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x1061, 0x0861,   // 0xD320 (54048) pixels
-0x0020, 0x1081, 0x0881, 0x0861, 0x0881, 0x0861, 0x0861, 0x1082, 0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x18C2, 0x10C2, 0x18C3,   // 0xD330 (54064) pixels
-0x18C3, 0x18C2, 0x18C2, 0x1081, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081,   // 0xD340 (54080) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2,   // 0xD350 (54096) pixels
-0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x0840,   // 0xD360 (54112) pixels
-0x1082, 0x18A2, 0x18C2, 0x18A2, 0x18E3, 0x18C3, 0x20E3, 0x18E3, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124, 0x2924,   // 0xD370 (54128) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x3165, 0x2924, 0x2944, 0x2924, 0x2944,   // 0xD380 (54144) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2103, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103,   // 0xD390 (54160) pixels
-0x2103, 0x2103, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xD3A0 (54176) pixels
-0x2944, 0x2924, 0x2924, 0x2945, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2965, 0x2944, 0x2945, 0x2944,   // 0xD3B0 (54192) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944,   // 0xD3C0 (54208) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD3D0 (54224) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD3E0 (54240) pixels
-0x39A6, 0x3185, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x3145, 0x2944, 0x2944, 0x2944, 0x3165, 0x3145, 0x2944, 0x2924, 0x2924,   // 0xD3F0 (54256) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD400 (54272) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x3165, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD410 (54288) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xD420 (54304) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2104, 0x2103, 0x2104, 0x2103, 0x2103,   // 0xD430 (54320) pixels
-0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x2104, 0x2104, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xD440 (54336) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x3165, 0x2944, 0x2124, 0x2124,   // 0xD450 (54352) pixels
-0x2104, 0x2103, 0x2124, 0x2103, 0x2104, 0x2924, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x1061, 0x0020,   // 0xD460 (54368) pixels
-0x0820, 0x1081, 0x0861, 0x0881, 0x1081, 0x1061, 0x0881, 0x1081, 0x1061, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0xD470 (54384) pixels
-0x18C2, 0x18C3, 0x10A2, 0x0881, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0xD480 (54400) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0820, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2,   // 0xD490 (54416) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10C3, 0x10C2, 0x10A3, 0x18C2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x0861,   // 0xD4A0 (54432) pixels
-0x1082, 0x1081, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2924, 0x2124, 0x2124,   // 0xD4B0 (54448) pixels
-0x2124, 0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xD4C0 (54464) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2104, 0x18E3, 0x18E3, 0x20E3, 0x18C2, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0xD4D0 (54480) pixels
-0x2103, 0x2104, 0x2123, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD4E0 (54496) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2945, 0x3145, 0x3164, 0x3164, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2945,   // 0xD4F0 (54512) pixels
-0x3165, 0x3165, 0x2965, 0x2945, 0x2965, 0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x3144,   // 0xD500 (54528) pixels
-0x2944, 0x3144, 0x2944, 0x3144, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x3144, 0x2945, 0x2924, 0x2944,   // 0xD510 (54544) pixels
-0x2944, 0x3144, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0xD520 (54560) pixels
-0x2944, 0x3165, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x3165, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD530 (54576) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD540 (54592) pixels
-0x2944, 0x2944, 0x2964, 0x2944, 0x3144, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x3185, 0x3986, 0x2945, 0x2924, 0x2944, 0x2944,   // 0xD550 (54608) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD560 (54624) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2904, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xD570 (54640) pixels
-0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x2104, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD580 (54656) pixels
-0x3165, 0x41E6, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x3165, 0x2924, 0x2924, 0x2124, 0x2924,   // 0xD590 (54672) pixels
-0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1081, 0x1081, 0x0020,   // 0xD5A0 (54688) pixels
-0x0841, 0x0881, 0x0881, 0x0861, 0x0881, 0x0881, 0x1081, 0x1081, 0x1081, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2,   // 0xD5B0 (54704) pixels
-0x18A2, 0x18C2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x1061, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0xD5C0 (54720) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0000, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2,   // 0xD5D0 (54736) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18A2, 0x18C3, 0x10A2, 0x18A2, 0x10A2, 0x18C2, 0x18A2, 0x18C2, 0x10A2, 0x10A2, 0x0861,   // 0xD5E0 (54752) pixels
-0x0861, 0x1061, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2104,   // 0xD5F0 (54768) pixels
-0x2124, 0x2104, 0x3144, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x3164, 0x2924, 0x2944, 0x4207, 0x2944, 0x2924, 0x2924,   // 0xD600 (54784) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x20E3, 0x18C3, 0x18E3, 0x20C2, 0x20E3, 0x20E3, 0x20E3, 0x2103,   // 0xD610 (54800) pixels
-0x2103, 0x2103, 0x2124, 0x2103, 0x2123, 0x2124, 0x2923, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xD620 (54816) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x2924, 0x2944, 0x2964, 0x2945, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD630 (54832) pixels
-0x2965, 0x2944, 0x3165, 0x2965, 0x2944, 0x2944, 0x2964, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x3145, 0x2944, 0x3144,   // 0xD640 (54848) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x3144, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xD650 (54864) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD660 (54880) pixels
-0x2944, 0x3144, 0x3165, 0x2944, 0x2944, 0x2944, 0x2945, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2924, 0x2944, 0x2944,   // 0xD670 (54896) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2965, 0x2944, 0x3165, 0x2944, 0x2944, 0x2945,   // 0xD680 (54912) pixels
-0x2945, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944,   // 0xD690 (54928) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xD6A0 (54944) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xD6B0 (54960) pixels
-0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x2103, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x5228,   // 0xD6C0 (54976) pixels
-0x39A6, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xD6D0 (54992) pixels
-0x2124, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x1061, 0x1082, 0x0020,   // 0xD6E0 (55008) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3,   // 0xD6F0 (55024) pixels
-0x18C2, 0x18A2, 0x1082, 0x0861, 0x0000, 0x0020, 0x0020, 0x0841, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0xD700 (55040) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0040, 0x0020, 0x0000, 0x0000, 0x0861, 0x1082, 0x10A2, 0x10A2,   // 0xD710 (55056) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x1081,   // 0xD720 (55072) pixels
-0x0820, 0x1061, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2104, 0x2103, 0x2124, 0x2103, 0x2924,   // 0xD730 (55088) pixels
-0x2924, 0x2124, 0x2924, 0x2904, 0x2124, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x3165, 0x2924, 0x2944, 0x2944,   // 0xD740 (55104) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2103, 0x18C3, 0x18E2, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0xD750 (55120) pixels
-0x2103, 0x2104, 0x2104, 0x2103, 0x2924, 0x2923, 0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xD760 (55136) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD770 (55152) pixels
-0x2944, 0x3165, 0x3165, 0x3185, 0x2944, 0x2944, 0x2944, 0x3145, 0x3144, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD780 (55168) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD790 (55184) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3144, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944,   // 0xD7A0 (55200) pixels
-0x2944, 0x3144, 0x2944, 0x2944, 0x3165, 0x3164, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD7B0 (55216) pixels
-0x2944, 0x2964, 0x2944, 0x2964, 0x2944, 0x2944, 0x3145, 0x2944, 0x2924, 0x2944, 0x3165, 0x2944, 0x2944, 0x3144, 0x2944, 0x3144,   // 0xD7C0 (55232) pixels
-0x3164, 0x3145, 0x3165, 0x3145, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x3145,   // 0xD7D0 (55248) pixels
-0x3144, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xD7E0 (55264) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xD7F0 (55280) pixels
-0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x2124, 0x2924, 0x2924, 0x2944, 0x3144, 0x2944, 0x2924, 0x2924, 0x3145,   // 0xD800 (55296) pixels
-0x2965, 0x2944, 0x2924, 0x2945, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2904, 0x2124, 0x2124, 0x2924,   // 0xD810 (55312) pixels
-0x2124, 0x2904, 0x2104, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1081, 0x1082, 0x0020,   // 0xD820 (55328) pixels
-0x0861, 0x0861, 0x0861, 0x1081, 0x1082, 0x0861, 0x0881, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0xD830 (55344) pixels
-0x10A2, 0x10A2, 0x1082, 0x0841, 0x0000, 0x0000, 0x0820, 0x0861, 0x0861, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0xD840 (55360) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0820, 0x0020, 0x0000, 0x0000, 0x0841, 0x0881, 0x1082, 0x10A2,   // 0xD850 (55376) pixels
-0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x18C2, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x10A2, 0x1081,   // 0xD860 (55392) pixels
-0x0020, 0x1081, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x2124, 0x2924, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104,   // 0xD870 (55408) pixels
-0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xD880 (55424) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2103, 0x18C2, 0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0xD890 (55440) pixels
-0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2124, 0x2923, 0x2124, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD8A0 (55456) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0xD8B0 (55472) pixels
-0x2944, 0x2965, 0x3165, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x3145, 0x2944, 0x2944, 0x2924, 0x3144, 0x2944,   // 0xD8C0 (55488) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x3144, 0x2944, 0x2944,   // 0xD8D0 (55504) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3145, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD8E0 (55520) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x3165, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944,   // 0xD8F0 (55536) pixels
-0x2964, 0x2964, 0x2944, 0x2944, 0x3164, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x3165, 0x3164, 0x2964,   // 0xD900 (55552) pixels
-0x3144, 0x3185, 0x3165, 0x3165, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x3144, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x3144,   // 0xD910 (55568) pixels
-0x3144, 0x2924, 0x2924, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0xD920 (55584) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2103, 0x2923, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3,   // 0xD930 (55600) pixels
-0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924,   // 0xD940 (55616) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x3986, 0x39A6, 0x2944, 0x2124, 0x2124,   // 0xD950 (55632) pixels
-0x2104, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18E3, 0x18A2, 0x18C2, 0x1081, 0x1081, 0x0020,   // 0xD960 (55648) pixels
-0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x0861, 0x0881, 0x0881, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0xD970 (55664) pixels
-0x18A2, 0x18A2, 0x1081, 0x0020, 0x0000, 0x0020, 0x0820, 0x0861, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0xD980 (55680) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x1082,   // 0xD990 (55696) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x18A2, 0x1082,   // 0xD9A0 (55712) pixels
-0x0841, 0x1081, 0x1081, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x20E3, 0x2104, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xD9B0 (55728) pixels
-0x2103, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD9C0 (55744) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x18C3, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0xD9D0 (55760) pixels
-0x2103, 0x2103, 0x2103, 0x2924, 0x2924, 0x2944, 0x2923, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD9E0 (55776) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xD9F0 (55792) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xDA00 (55808) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3164, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xDA10 (55824) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2965, 0x2964,   // 0xDA20 (55840) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0xDA30 (55856) pixels
-0x2944, 0x2964, 0x2944, 0x3144, 0x2964, 0x2964, 0x2944, 0x3144, 0x2964, 0x2944, 0x2944, 0x3165, 0x2945, 0x3164, 0x3165, 0x3164,   // 0xDA40 (55872) pixels
-0x3164, 0x3144, 0x3165, 0x3165, 0x2944, 0x2944, 0x3144, 0x3145, 0x3145, 0x3144, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x3144,   // 0xDA50 (55888) pixels
-0x3164, 0x41E7, 0x3165, 0x3144, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xDA60 (55904) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2123, 0x2124, 0x2104, 0x2104, 0x2103, 0x2104, 0x2103, 0x2104, 0x20E3,   // 0xDA70 (55920) pixels
-0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C3, 0x20E3, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944,   // 0xDA80 (55936) pixels
-0x2944, 0x2944, 0x2924, 0x3165, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924,   // 0xDA90 (55952) pixels
-0x2104, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x2103, 0x18C2, 0x18A2, 0x18C2, 0x1081, 0x0840, 0x0040,   // 0xDAA0 (55968) pixels
-0x0861, 0x0861, 0x0861, 0x1081, 0x1082, 0x0861, 0x0881, 0x0861, 0x10A2, 0x10A2, 0x18A2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2,   // 0xDAB0 (55984) pixels
-0x18A2, 0x10A2, 0x1082, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0xDAC0 (56000) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0820, 0x0020, 0x0000, 0x0000, 0x0841, 0x1082, 0x1082,   // 0xDAD0 (56016) pixels
-0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18A2, 0x18C2, 0x18A2, 0x18C2, 0x18A2, 0x18A2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18A2, 0x1081,   // 0xDAE0 (56032) pixels
-0x0841, 0x1082, 0x1061, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2924, 0x2944, 0x2944, 0x2924, 0x2104,   // 0xDAF0 (56048) pixels
-0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xDB00 (56064) pixels
-0x2924, 0x2944, 0x2924, 0x2124, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x18E3, 0x18C2, 0x18C3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0xDB10 (56080) pixels
-0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xDB20 (56096) pixels
-0x2944, 0x2924, 0x2924, 0x3165, 0x4A27, 0x4A27, 0x5248, 0x5247, 0x5247, 0x41E6, 0x3165, 0x4A27, 0x3164, 0x2944, 0x2944, 0x3165,   // 0xDB30 (56112) pixels
-0x4A07, 0x3165, 0x3144, 0x3165, 0x49E7, 0x5248, 0x5247, 0x41C6, 0x3165, 0x3164, 0x3164, 0x4A27, 0x41C6, 0x2944, 0x2944, 0x2944,   // 0xDB40 (56128) pixels
-0x4206, 0x39A5, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3144, 0x41C6, 0x5248, 0x4A07, 0x3165, 0x2944, 0x3164, 0x3144,   // 0xDB50 (56144) pixels
-0x39A5, 0x5248, 0x5247, 0x41E6, 0x3144, 0x3144, 0x3144, 0x3144, 0x3144, 0x39A6, 0x5A88, 0x5A88, 0x39C6, 0x3165, 0x3165, 0x3144,   // 0xDB60 (56160) pixels
-0x2944, 0x5A88, 0x5A88, 0x5A88, 0x4A07, 0x3165, 0x2944, 0x2944, 0x41E6, 0x5A89, 0x62A9, 0x5AA9, 0x4A07, 0x3165, 0x3164, 0x3164,   // 0xDB70 (56176) pixels
-0x41A6, 0x5A68, 0x3165, 0x3164, 0x4A07, 0x5247, 0x3165, 0x3144, 0x2965, 0x39A6, 0x5248, 0x2944, 0x3165, 0x2965, 0x3164, 0x4A07,   // 0xDB80 (56192) pixels
-0x5A68, 0x39C6, 0x3165, 0x4A27, 0x62C9, 0x5AC9, 0x62C9, 0x62C9, 0x62A9, 0x4A07, 0x3165, 0x3164, 0x41E7, 0x5AA9, 0x5AA9, 0x5248,   // 0xDB90 (56208) pixels
-0x3164, 0x2944, 0x2944, 0x3144, 0x4A07, 0x5A88, 0x5A89, 0x4A27, 0x3165, 0x3144, 0x2945, 0x2945, 0x2124, 0x2924, 0x2924, 0x2924,   // 0xDBA0 (56224) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xDBB0 (56240) pixels
-0x20E3, 0x18E3, 0x18C2, 0x18E3, 0x18C2, 0x18E3, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xDBC0 (56256) pixels
-0x2924, 0x2124, 0x2944, 0x2965, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2123, 0x2924, 0x2124, 0x2124,   // 0xDBD0 (56272) pixels
-0x2123, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18C3, 0x2103, 0x18C2, 0x18C2, 0x18C2, 0x1082, 0x1082, 0x0020, 0x0840,   // 0xDBE0 (56288) pixels
-0x0861, 0x0881, 0x0861, 0x1082, 0x0881, 0x0861, 0x1082, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0xDBF0 (56304) pixels
-0x18A2, 0x10A2, 0x0881, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0xDC00 (56320) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0000, 0x0000, 0x0041, 0x1081, 0x1082,   // 0xDC10 (56336) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x18C3, 0x18C2, 0x18A2, 0x18C3, 0x18C2, 0x18A2, 0x1082,   // 0xDC20 (56352) pixels
-0x0861, 0x1082, 0x1081, 0x18C2, 0x18C3, 0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x2124, 0x2124, 0x2104,   // 0xDC30 (56368) pixels
-0x2104, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xDC40 (56384) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x20E3, 0x18C2, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x2103,   // 0xDC50 (56400) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xDC60 (56416) pixels
-0x2924, 0x2944, 0x2944, 0x41E6, 0x8C0E, 0x8C0E, 0xA48F, 0x9C4F, 0x942E, 0x7B4B, 0x39C6, 0x9C4F, 0x41E6, 0x2944, 0x2944, 0x41E6,   // 0xDC70 (56432) pixels
-0x9C6F, 0x41C6, 0x3144, 0x3164, 0x93ED, 0xA48F, 0x9C6F, 0x83AC, 0x730A, 0x3165, 0x3185, 0xA4AF, 0x83CC, 0x2964, 0x2944, 0x3164,   // 0xDC80 (56448) pixels
-0x93ED, 0x5AA8, 0x2944, 0x3185, 0x2965, 0x2944, 0x3165, 0x39A5, 0x62A9, 0x8BEE, 0x940E, 0x93ED, 0x5227, 0x2944, 0x3164, 0x41E6,   // 0xDC90 (56464) pixels
-0x8BED, 0x8BED, 0x8BED, 0x8BED, 0x62A9, 0x3165, 0x3165, 0x3144, 0x6AC9, 0x8BCD, 0x940E, 0x9C4E, 0x93ED, 0x41C6, 0x3185, 0x3144,   // 0xDCA0 (56480) pixels
-0x3144, 0xACAF, 0xA46F, 0x940D, 0x9C0E, 0x6AEA, 0x2944, 0x2944, 0x7B8C, 0xACF0, 0x942D, 0xA48F, 0x9C2F, 0x5247, 0x3165, 0x3165,   // 0xDCB0 (56496) pixels
-0x6AC9, 0xAC8F, 0x3165, 0x3144, 0x838C, 0xA48F, 0x5227, 0x3144, 0x2944, 0x5A89, 0x9C2E, 0x3185, 0x3164, 0x3165, 0x3165, 0x7B4B,   // 0xDCC0 (56512) pixels
-0xA46F, 0x6AE9, 0x3165, 0x6AE9, 0x9C6E, 0x9C6F, 0xACF0, 0x9C4E, 0x9C4F, 0x6AEA, 0x3164, 0x4A27, 0x9C0E, 0x944E, 0x9C2E, 0xA46F,   // 0xDCD0 (56528) pixels
-0x6AC9, 0x3164, 0x3144, 0x3985, 0x838C, 0x9C4F, 0x942E, 0x93EE, 0x730A, 0x3165, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xDCE0 (56544) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2124, 0x2123, 0x2123, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3,   // 0xDCF0 (56560) pixels
-0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x2124, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xDD00 (56576) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124,   // 0xDD10 (56592) pixels
-0x2104, 0x2124, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18C2, 0x18E3, 0x18C3, 0x18A2, 0x18C2, 0x1061, 0x1082, 0x0020, 0x0840,   // 0xDD20 (56608) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0882, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0xDD30 (56624) pixels
-0x10A2, 0x1082, 0x0841, 0x0000, 0x0020, 0x0020, 0x0841, 0x1081, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081,   // 0xDD40 (56640) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082,   // 0xDD50 (56656) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18A2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x1082,   // 0xDD60 (56672) pixels
-0x1061, 0x0861, 0x1082, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104,   // 0xDD70 (56688) pixels
-0x2124, 0x2924, 0x2924, 0x2124, 0x2904, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xDD80 (56704) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x3185, 0x39A6, 0x2924, 0x2944, 0x2944, 0x2124, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3,   // 0xDD90 (56720) pixels
-0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xDDA0 (56736) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x39A5, 0x41C6, 0xACD0, 0x7B4B, 0x39C5, 0x3985, 0x41E6, 0xC572, 0x5A68, 0x3144, 0x2944, 0x4A27,   // 0xDDB0 (56752) pixels
-0xBD52, 0x4A07, 0x3165, 0x3164, 0xACB0, 0x93ED, 0x41C6, 0x6289, 0xBD12, 0x5A88, 0x3165, 0xB510, 0xACD0, 0x6B0A, 0x3165, 0x3185,   // 0xDDC0 (56768) pixels
-0xACD0, 0x7B4B, 0x3144, 0x2944, 0x2965, 0x3165, 0x3185, 0xAC90, 0xA490, 0x4A07, 0x39C6, 0x41C6, 0x3985, 0x3165, 0x5A88, 0xACD0,   // 0xDDD0 (56784) pixels
-0x6ACA, 0x39A5, 0x39A5, 0x836B, 0xBD31, 0x5A68, 0x3165, 0x6AC9, 0xACAF, 0x6288, 0x39A5, 0x39A5, 0x732B, 0xACCF, 0x5268, 0x3144,   // 0xDDE0 (56800) pixels
-0x3165, 0xB510, 0x730A, 0x39A5, 0x93EE, 0xBD32, 0x2944, 0x2944, 0x942E, 0xAC8F, 0x3985, 0x3985, 0x5227, 0xC572, 0x93ED, 0x3164,   // 0xDDF0 (56816) pixels
-0x7B4B, 0xCD93, 0x3164, 0x3144, 0x940E, 0xC572, 0xBD10, 0x39A5, 0x41E7, 0x62C9, 0xB4F0, 0x39A6, 0x3165, 0x3165, 0x5A68, 0xACD0,   // 0xDE00 (56832) pixels
-0x940E, 0xACAF, 0x3985, 0x3164, 0x3185, 0x5268, 0xA48F, 0x5227, 0x3985, 0x3165, 0x62C9, 0xBD11, 0x6289, 0x39A5, 0x3985, 0x49E6,   // 0xDE10 (56848) pixels
-0xB4F1, 0x5A68, 0x2944, 0x3985, 0x8BED, 0x6AEA, 0x3985, 0x49E7, 0xBCF1, 0x7B4B, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xDE20 (56864) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2904, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0xDE30 (56880) pixels
-0x20E3, 0x20E3, 0x18C2, 0x18C3, 0x18C3, 0x20E3, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xDE40 (56896) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2104, 0x2924, 0x2924, 0x2924, 0x2104, 0x2924,   // 0xDE50 (56912) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x1061, 0x0861, 0x0020, 0x0841,   // 0xDE60 (56928) pixels
-0x0861, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C3, 0x18C2, 0x18A2, 0x10A2,   // 0xDE70 (56944) pixels
-0x10A2, 0x1082, 0x0000, 0x0000, 0x0020, 0x0820, 0x0861, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081,   // 0xDE80 (56960) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082,   // 0xDE90 (56976) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2,   // 0xDEA0 (56992) pixels
-0x1081, 0x0840, 0x1082, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2103,   // 0xDEB0 (57008) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2124, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xDEC0 (57024) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x3185, 0x3185, 0x2924, 0x2924, 0x2924, 0x2104, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3,   // 0xDED0 (57040) pixels
-0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944,   // 0xDEE0 (57056) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x3164, 0x3185, 0xB4D0, 0x730A, 0x3165, 0x3144, 0x41E6, 0xBD32, 0x5A68, 0x2944, 0x2944, 0x4A07,   // 0xDEF0 (57072) pixels
-0xBD52, 0x49E7, 0x3164, 0x3164, 0xB4D0, 0x93CD, 0x3164, 0x4A07, 0xB511, 0x5A88, 0x3164, 0xACCF, 0x9C2E, 0xB4F0, 0x41C6, 0x3985,   // 0xDF00 (57088) pixels
-0xACD0, 0x7B4B, 0x3144, 0x2965, 0x2965, 0x2944, 0x5268, 0xACF0, 0x62C9, 0x2964, 0x3165, 0x2944, 0x2944, 0x3165, 0x8BCD, 0xB4D0,   // 0xDF10 (57104) pixels
-0x3185, 0x2945, 0x2944, 0x41C6, 0x9C0E, 0x8BED, 0x39A6, 0x9C4F, 0x7B6C, 0x3165, 0x2945, 0x3144, 0x41C6, 0xBD31, 0x838C, 0x3165,   // 0xDF20 (57120) pixels
-0x3165, 0xBD52, 0x732B, 0x3185, 0x7B4B, 0xB4CF, 0x3144, 0x3144, 0x9C4E, 0xA48F, 0x3165, 0x2964, 0x3165, 0x9C2F, 0xA48F, 0x3165,   // 0xDF30 (57136) pixels
-0x734B, 0xC572, 0x3164, 0x2944, 0x942E, 0xACD0, 0xAC8F, 0x732B, 0x3185, 0x6AC9, 0xBD11, 0x39A5, 0x3185, 0x2965, 0x7B6B, 0xACB0,   // 0xDF40 (57152) pixels
-0x730A, 0xBD51, 0x4A07, 0x3144, 0x3144, 0x5227, 0xA48F, 0x4A07, 0x3144, 0x2944, 0x93ED, 0xB4AF, 0x3985, 0x3145, 0x3144, 0x3165,   // 0xDF50 (57168) pixels
-0x8BED, 0x83CC, 0x3164, 0x3185, 0x8BED, 0x6AC9, 0x2944, 0x39A5, 0xB511, 0x730A, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xDF60 (57184) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924, 0x2104, 0x2124, 0x2123, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0xDF70 (57200) pixels
-0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x2103, 0x2924, 0x2124, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xDF80 (57216) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924, 0x2103, 0x2124,   // 0xDF90 (57232) pixels
-0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1081, 0x0840, 0x0820, 0x0861,   // 0xDFA0 (57248) pixels
-0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0881, 0x1082, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x18C2, 0x18C3, 0x18C2, 0x10A2,   // 0xDFB0 (57264) pixels
-0x10A2, 0x0882, 0x0000, 0x0000, 0x0020, 0x0020, 0x0861, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0xDFC0 (57280) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0820, 0x0020, 0x0000, 0x0000, 0x0841, 0x1082,   // 0xDFD0 (57296) pixels
-0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x18A2, 0x10A2,   // 0xDFE0 (57312) pixels
-0x1082, 0x0841, 0x1082, 0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2124, 0x2124,   // 0xDFF0 (57328) pixels
-0x2944, 0x2924, 0x2924, 0x2123, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xE000 (57344) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2944, 0x2944, 0x2944, 0x3185, 0x2103, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3,   // 0xE010 (57360) pixels
-0x2103, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2103, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xE020 (57376) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x3164, 0x3185, 0xB4F0, 0x7B6B, 0x3144, 0x3165, 0x41C6, 0xBD52, 0x5248, 0x2944, 0x2944, 0x4A27,   // 0xE030 (57392) pixels
-0xBD32, 0x4A07, 0x3164, 0x3165, 0xACAF, 0xB4F0, 0x83AC, 0xB4F0, 0x9C6F, 0x3185, 0x3164, 0xB4F0, 0x6AEA, 0x942E, 0x8C0D, 0x4A27,   // 0xE040 (57408) pixels
-0xB4F0, 0x732B, 0x3144, 0x3165, 0x2944, 0x2944, 0x7B6B, 0x940E, 0x3185, 0x2944, 0x2944, 0x3144, 0x2944, 0x3164, 0xACB0, 0x93ED,   // 0xE050 (57424) pixels
-0x2965, 0x3165, 0x2944, 0x3144, 0x730A, 0xACB0, 0x39A6, 0xBD31, 0x5A89, 0x3165, 0x3165, 0x3165, 0x3165, 0xAC8F, 0x9C2E, 0x3164,   // 0xE060 (57440) pixels
-0x3165, 0xC573, 0xAC8F, 0x8BCD, 0xB511, 0x7B4B, 0x3144, 0x3164, 0x9C4F, 0xACB0, 0x3165, 0x3165, 0x3165, 0x730B, 0xB4F0, 0x39A6,   // 0xE070 (57456) pixels
-0x7B8C, 0xC593, 0x3165, 0x2944, 0x9C4F, 0xA48F, 0x5248, 0xC573, 0x836C, 0x6ACA, 0xBD10, 0x39A5, 0x2944, 0x3165, 0xB4F0, 0x93ED,   // 0xE080 (57472) pixels
-0x5A68, 0xACAF, 0x72EA, 0x3144, 0x3165, 0x5247, 0xACD0, 0x4A07, 0x3144, 0x3164, 0xA46F, 0x93ED, 0x3165, 0x3164, 0x3145, 0x3165,   // 0xE090 (57488) pixels
-0x732B, 0xAC8F, 0x3165, 0x3985, 0x93ED, 0x9C2E, 0x83AC, 0x9C4E, 0x8BCD, 0x3985, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xE0A0 (57504) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2123, 0x2924, 0x2903, 0x2124, 0x2124, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0xE0B0 (57520) pixels
-0x18E3, 0x20E3, 0x18C3, 0x18E2, 0x20E3, 0x2103, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xE0C0 (57536) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2123, 0x2924, 0x2124, 0x2103, 0x2103,   // 0xE0D0 (57552) pixels
-0x2104, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x1081, 0x0020, 0x0841, 0x0861,   // 0xE0E0 (57568) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10C2, 0x18A2, 0x10A2, 0x10C2, 0x10A2, 0x10C3, 0x18A3,   // 0xE0F0 (57584) pixels
-0x1082, 0x0862, 0x0000, 0x0000, 0x0020, 0x0020, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0xE100 (57600) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0000, 0x0000, 0x0841, 0x1082,   // 0xE110 (57616) pixels
-0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C3, 0x10C3, 0x10C2, 0x10A2, 0x18C2, 0x10A2,   // 0xE120 (57632) pixels
-0x1082, 0x0861, 0x10A2, 0x1082, 0x18A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2104, 0x2124, 0x2124,   // 0xE130 (57648) pixels
-0x3164, 0x2104, 0x2103, 0x2124, 0x2924, 0x2924, 0x2924, 0x2945, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xE140 (57664) pixels
-0x2944, 0x2924, 0x3144, 0x4A07, 0x39A6, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x5248, 0x2103, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0xE150 (57680) pixels
-0x2103, 0x20E3, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2123, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924,   // 0xE160 (57696) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2964, 0x3185, 0xACD0, 0x7B6B, 0x3144, 0x3164, 0x39A6, 0xBD31, 0x5A68, 0x2964, 0x2944, 0x4A27,   // 0xE170 (57712) pixels
-0xBD32, 0x4A07, 0x3164, 0x3165, 0xACAF, 0xBD31, 0x9C2E, 0xBD52, 0x7B4B, 0x3144, 0x3165, 0xB511, 0x6B0A, 0x4A27, 0xACF0, 0x7B4B,   // 0xE180 (57728) pixels
-0xB4D0, 0x7B4B, 0x3144, 0x2944, 0x2944, 0x2944, 0x734B, 0xA46F, 0x41E6, 0x3165, 0x2944, 0x3144, 0x3145, 0x3145, 0xA46F, 0xA42F,   // 0xE190 (57744) pixels
-0x3165, 0x2945, 0x2944, 0x3185, 0x8BED, 0xAC8F, 0x39A6, 0xB511, 0x62A9, 0x3165, 0x3165, 0x3144, 0x3985, 0xB4D0, 0x9C2E, 0x3164,   // 0xE1A0 (57760) pixels
-0x3165, 0xC593, 0xB4D0, 0x93EE, 0xB511, 0x62A9, 0x3144, 0x3144, 0x9C4F, 0xACAF, 0x3165, 0x3165, 0x3165, 0x83AC, 0xB4D0, 0x39A5,   // 0xE1B0 (57776) pixels
-0x7B6B, 0xC593, 0x3165, 0x2944, 0x9C4E, 0xA48F, 0x3185, 0x9C2E, 0xACD0, 0x72EA, 0xBD11, 0x39A5, 0x2944, 0x41E6, 0xC573, 0xACAF,   // 0xE1C0 (57792) pixels
-0x940D, 0xA44E, 0xA44F, 0x3165, 0x3165, 0x5247, 0xACAF, 0x49E7, 0x3164, 0x2944, 0xA44F, 0xA44F, 0x3165, 0x3144, 0x3165, 0x3165,   // 0xE1D0 (57808) pixels
-0x732A, 0xA48F, 0x3165, 0x41E6, 0x93ED, 0xA46F, 0x9C2E, 0xBD32, 0x6ACA, 0x3165, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xE1E0 (57824) pixels
-0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2103, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0xE1F0 (57840) pixels
-0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x5A68, 0x3165, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xE200 (57856) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x3986, 0x39A6, 0x2945, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103,   // 0xE210 (57872) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x18A2, 0x1082, 0x0840, 0x0861, 0x0861,   // 0xE220 (57888) pixels
-0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x10A2, 0x10C2, 0x10C2, 0x18A2, 0x10A2, 0x10A2, 0x18C3, 0x18A2, 0x10A2,   // 0xE230 (57904) pixels
-0x1082, 0x0861, 0x0000, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x0881, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082,   // 0xE240 (57920) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0841, 0x1061,   // 0xE250 (57936) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x18C3, 0x18E3, 0x10A2, 0x10A2, 0x18C2, 0x18A2,   // 0xE260 (57952) pixels
-0x10A2, 0x0861, 0x0861, 0x1081, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2123,   // 0xE270 (57968) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xE280 (57984) pixels
-0x2944, 0x2944, 0x2944, 0x39E6, 0x41E7, 0x2924, 0x2944, 0x4A27, 0x6B0A, 0xA48F, 0xACD0, 0x942F, 0x20E3, 0x20E3, 0x20E3, 0x2924,   // 0xE290 (58000) pixels
-0x20E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xE2A0 (58016) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x3164, 0xACD0, 0x838B, 0x3144, 0x2944, 0x3164, 0xA46F, 0x8BCD, 0x3144, 0x3144, 0x62A9,   // 0xE2B0 (58032) pixels
-0xA46F, 0x41C6, 0x3164, 0x3144, 0xAC8F, 0x940E, 0x3145, 0x8BCD, 0xB511, 0x39A6, 0x3165, 0xBD31, 0x732A, 0x3144, 0x6AEA, 0xB4D1,   // 0xE2C0 (58048) pixels
-0xB511, 0x7B6B, 0x3165, 0x3165, 0x2944, 0x3164, 0x41C6, 0xBD31, 0x940E, 0x3165, 0x2944, 0x2944, 0x3144, 0x3164, 0x6AEA, 0xBD32,   // 0xE2D0 (58064) pixels
-0x5A68, 0x3165, 0x3165, 0x5A68, 0xACAF, 0x62C9, 0x3185, 0x734B, 0xA46F, 0x4A27, 0x3165, 0x3165, 0x62A9, 0xACEF, 0x5A68, 0x3985,   // 0xE2E0 (58080) pixels
-0x3164, 0xBD31, 0x732A, 0x3165, 0x9C4F, 0xB4F0, 0x3165, 0x3165, 0x9C4F, 0xACB0, 0x3185, 0x3185, 0x4A07, 0xBD32, 0x8BAC, 0x3165,   // 0xE2F0 (58096) pixels
-0x7B4B, 0xBD52, 0x3165, 0x3144, 0x9C2E, 0xACAF, 0x3164, 0x39A5, 0x838B, 0xB4D0, 0xB4CF, 0x41A5, 0x3164, 0x8BED, 0xA46F, 0x5268,   // 0xE300 (58112) pixels
-0x5247, 0x6B0A, 0xBD52, 0x41C6, 0x3164, 0x4A27, 0xA4AF, 0x4A07, 0x3165, 0x3144, 0x6AEA, 0xB511, 0x5227, 0x3144, 0x3144, 0x39C6,   // 0xE310 (58128) pixels
-0xBD11, 0x62C9, 0x3144, 0x3185, 0x8BED, 0x6AEA, 0x2924, 0x5A89, 0xACB0, 0x49E7, 0x2944, 0x2924, 0x3165, 0x2924, 0x2924, 0x2924,   // 0xE320 (58144) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3,   // 0xE330 (58160) pixels
-0x18E3, 0x18E3, 0x18E3, 0x20E3, 0xB4F0, 0xB4F0, 0x8BED, 0x4A07, 0x3185, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xE340 (58176) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2104,   // 0xE350 (58192) pixels
-0x2104, 0x2103, 0x2104, 0x20E3, 0x20E3, 0x20E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1082, 0x1082, 0x0841, 0x0861, 0x0861,   // 0xE360 (58208) pixels
-0x1081, 0x0861, 0x0861, 0x1061, 0x0861, 0x0881, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0xE370 (58224) pixels
-0x1062, 0x0861, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081,   // 0xE380 (58240) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0841, 0x0861,   // 0xE390 (58256) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x10C3, 0x18E3, 0x10A2, 0x18C2, 0x10C2, 0x10A2,   // 0xE3A0 (58272) pixels
-0x1082, 0x0861, 0x0020, 0x1082, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103,   // 0xE3B0 (58288) pixels
-0x2103, 0x2904, 0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xE3C0 (58304) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x39A6, 0x732B, 0xA46F, 0xC551, 0xC572, 0xC572, 0xB4D0, 0xA48F, 0x2103, 0x20E3, 0x2103, 0x2103,   // 0xE3D0 (58320) pixels
-0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xE3E0 (58336) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x9C4F, 0x730A, 0x3144, 0x3144, 0x2944, 0x5A68, 0x940E, 0xA46F, 0x8BED, 0xA42F,   // 0xE3F0 (58352) pixels
-0x4A07, 0x3144, 0x2944, 0x39A5, 0x940E, 0x83AC, 0x3144, 0x3185, 0x940E, 0x5AA9, 0x2944, 0xA48F, 0x62C9, 0x3165, 0x3144, 0x62A9,   // 0xE400 (58368) pixels
-0xACB0, 0x6B0A, 0x2944, 0x2944, 0x2965, 0x2944, 0x3164, 0x4A27, 0x8BCC, 0xACAF, 0x93ED, 0xACAF, 0x6AC9, 0x2944, 0x2944, 0x5247,   // 0xE410 (58384) pixels
-0xA48F, 0x940D, 0x93ED, 0xA46F, 0x6B0A, 0x3144, 0x3165, 0x3185, 0x83AC, 0xACD0, 0x8BED, 0x9C4F, 0xA46F, 0x4206, 0x3144, 0x2944,   // 0xE420 (58400) pixels
-0x3144, 0xAC8F, 0x6AEA, 0x3144, 0x62A9, 0x9C4F, 0x3985, 0x2944, 0x8BCD, 0xB4F0, 0x942E, 0xA48F, 0xA46F, 0x62A9, 0x3144, 0x3164,   // 0xE430 (58416) pixels
-0x6AC9, 0xACB0, 0x3164, 0x2944, 0x83AC, 0x940E, 0x2944, 0x3164, 0x3164, 0xA44E, 0x9C0E, 0x3985, 0x3985, 0x940E, 0x5AA9, 0x2944,   // 0xE440 (58432) pixels
-0x2944, 0x3165, 0xA44F, 0x62C9, 0x2944, 0x4A07, 0x9C2E, 0x49E6, 0x3144, 0x3144, 0x3144, 0x5248, 0xA46F, 0x940E, 0x940D, 0xA46F,   // 0xE450 (58448) pixels
-0x5A89, 0x3165, 0x2944, 0x3165, 0x7B8C, 0x62A9, 0x2944, 0x2944, 0x9C2F, 0x734B, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0xE460 (58464) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2104, 0x2124, 0x2104, 0x2104, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3,   // 0xE470 (58480) pixels
-0x18C2, 0x18E3, 0x20E3, 0x8BCD, 0xC552, 0xC572, 0xC552, 0xC572, 0xACB0, 0x730B, 0x4A07, 0x3165, 0x3144, 0x2944, 0x2944, 0x2944,   // 0xE480 (58496) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x39C6, 0x2124, 0x2924, 0x2924, 0x2124, 0x2123, 0x2124, 0x2124, 0x2104, 0x2104,   // 0xE490 (58512) pixels
-0x2104, 0x2103, 0x2104, 0x2103, 0x2103, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x1061, 0x1082, 0x0861, 0x0861, 0x0861,   // 0xE4A0 (58528) pixels
-0x0881, 0x1081, 0x1061, 0x0861, 0x0881, 0x0861, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2,   // 0xE4B0 (58544) pixels
-0x0861, 0x0020, 0x0020, 0x0820, 0x0840, 0x0841, 0x0861, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082,   // 0xE4C0 (58560) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0820, 0x0841,   // 0xE4D0 (58576) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10C2, 0x10A2, 0x10C2, 0x18C3, 0x10A2, 0x18E3, 0x18C3, 0x18A2,   // 0xE4E0 (58592) pixels
-0x10A2, 0x1061, 0x0840, 0x1082, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xE4F0 (58608) pixels
-0x2903, 0x2924, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xE500 (58624) pixels
-0x2944, 0x2944, 0x3985, 0x5AA9, 0x8BED, 0xBD53, 0xC593, 0xCD73, 0xC573, 0xC552, 0xB511, 0xB4F1, 0x6B0A, 0x20E3, 0x20E3, 0x18E3,   // 0xE510 (58640) pixels
-0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2123, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2944, 0x2924,   // 0xE520 (58656) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x5AA9, 0x4A27, 0x2944, 0x2944, 0x2944, 0x2924, 0x41C6, 0x6AEA, 0x6AEA, 0x41C6,   // 0xE530 (58672) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x5A88, 0x5268, 0x3144, 0x3165, 0x5AA9, 0x4A27, 0x2944, 0x62A9, 0x41C6, 0x3144, 0x3164, 0x3165,   // 0xE540 (58688) pixels
-0x6AEA, 0x4A27, 0x3185, 0x2945, 0x2944, 0x2944, 0x3164, 0x2944, 0x3985, 0x6AC9, 0x730A, 0x6AC9, 0x39A5, 0x2944, 0x2944, 0x2944,   // 0xE550 (58704) pixels
-0x4A27, 0x730A, 0x6AEA, 0x41C6, 0x2944, 0x3165, 0x3165, 0x3165, 0x3165, 0x5A88, 0x6B0A, 0x6B0A, 0x41E6, 0x3144, 0x3164, 0x3164,   // 0xE560 (58720) pixels
-0x3144, 0x62C9, 0x4A07, 0x3144, 0x39C6, 0x5A88, 0x41C6, 0x2944, 0x5227, 0x732A, 0x732B, 0x5A89, 0x49E7, 0x3144, 0x3164, 0x3164,   // 0xE570 (58736) pixels
-0x41C6, 0x62C9, 0x3144, 0x3144, 0x4A07, 0x5AA9, 0x2944, 0x3144, 0x3164, 0x5227, 0x5A88, 0x3144, 0x3164, 0x5A88, 0x39A6, 0x2944,   // 0xE580 (58752) pixels
-0x2965, 0x3165, 0x62A9, 0x5248, 0x2944, 0x39A5, 0x5AA9, 0x3985, 0x3144, 0x2944, 0x3144, 0x2944, 0x49E6, 0x6AC9, 0x6AEA, 0x4A27,   // 0xE590 (58768) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x5247, 0x41E6, 0x2944, 0x2924, 0x5A89, 0x5A88, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xE5A0 (58784) pixels
-0x2924, 0x2124, 0x2124, 0x2924, 0x2124, 0x2103, 0x2124, 0x2124, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3,   // 0xE5B0 (58800) pixels
-0x18C2, 0x20E3, 0x2103, 0xA44F, 0xC551, 0xC553, 0xBD51, 0xBD31, 0xC572, 0xBD31, 0xACD0, 0x730B, 0x49E7, 0x3165, 0x2944, 0x2944,   // 0xE5C0 (58816) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x39A6, 0x2123, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924, 0x2103, 0x2103, 0x2103,   // 0xE5D0 (58832) pixels
-0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18A2, 0x18C3, 0x1081, 0x0841, 0x0861, 0x0861, 0x0861,   // 0xE5E0 (58848) pixels
-0x0881, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x10A2, 0x10C2, 0x10C2, 0x10C2, 0x10A2,   // 0xE5F0 (58864) pixels
-0x0861, 0x0000, 0x0020, 0x0840, 0x0841, 0x0861, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081,   // 0xE600 (58880) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0820, 0x0020, 0x0000, 0x0020, 0x0841,   // 0xE610 (58896) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10C2, 0x10A2, 0x2103, 0x18E3, 0x10A2,   // 0xE620 (58912) pixels
-0x10A2, 0x1082, 0x0861, 0x1082, 0x0861, 0x18A2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2903,   // 0xE630 (58928) pixels
-0x2103, 0x2103, 0x2103, 0x2923, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x3164, 0x3165,   // 0xE640 (58944) pixels
-0x5A89, 0x8BCD, 0xB511, 0xC594, 0xBD52, 0xC553, 0xC573, 0xC553, 0xC573, 0xC552, 0xC593, 0xBD52, 0x942E, 0x3165, 0x20E3, 0x18E3,   // 0xE650 (58960) pixels
-0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2124, 0x2124, 0x2124, 0x2923, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xE660 (58976) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xE670 (58992) pixels
-0x2944, 0x2964, 0x2944, 0x2944, 0x3164, 0x2964, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2964, 0x2944,   // 0xE680 (59008) pixels
-0x2944, 0x3165, 0x3144, 0x3144, 0x3144, 0x3145, 0x2944, 0x3145, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944, 0x2945,   // 0xE690 (59024) pixels
-0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x3144, 0x2945, 0x2945, 0x2944, 0x2944, 0x3144, 0x3145, 0x2944, 0x3165, 0x2964,   // 0xE6A0 (59040) pixels
-0x3145, 0x2944, 0x2944, 0x2964, 0x2945, 0x3144, 0x2964, 0x2944, 0x3164, 0x3164, 0x2944, 0x3165, 0x3165, 0x2944, 0x3164, 0x2944,   // 0xE6B0 (59056) pixels
-0x2944, 0x2964, 0x2944, 0x3144, 0x2944, 0x3165, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3185, 0x2944,   // 0xE6C0 (59072) pixels
-0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3165, 0x2945, 0x2944, 0x2924, 0x2944,   // 0xE6D0 (59088) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xE6E0 (59104) pixels
-0x2124, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18C3, 0x18C2,   // 0xE6F0 (59120) pixels
-0x20E3, 0x20E3, 0x8BCC, 0xB4D0, 0xBD31, 0xC553, 0xBD32, 0xC552, 0xC573, 0xC553, 0xBD51, 0xC593, 0xC573, 0x9C4F, 0x5A68, 0x39A5,   // 0xE700 (59136) pixels
-0x3164, 0x3164, 0x2944, 0x3144, 0x2944, 0x2924, 0x3185, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xE710 (59152) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18A2, 0x1061, 0x1081, 0x0020, 0x0861, 0x0861, 0x1061,   // 0xE720 (59168) pixels
-0x0881, 0x0881, 0x0861, 0x0861, 0x0881, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2,   // 0xE730 (59184) pixels
-0x0861, 0x0000, 0x0020, 0x0840, 0x0841, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0xE740 (59200) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0040, 0x0020, 0x0000, 0x0000, 0x0840,   // 0xE750 (59216) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x20E4, 0x18E3, 0x18C2,   // 0xE760 (59232) pixels
-0x10A2, 0x10A2, 0x1082, 0x1061, 0x1061, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103,   // 0xE770 (59248) pixels
-0x2103, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x3164, 0x3165, 0x4A27, 0x7B4B,   // 0xE780 (59264) pixels
-0xB511, 0xC593, 0xC573, 0xC573, 0xBD31, 0xBD31, 0xC573, 0xC552, 0xC552, 0xBD52, 0xB531, 0xA48F, 0x62A9, 0x3185, 0x18E3, 0x18E3,   // 0xE790 (59280) pixels
-0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2944,   // 0xE7A0 (59296) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944,   // 0xE7B0 (59312) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xE7C0 (59328) pixels
-0x2944, 0x2944, 0x3144, 0x3144, 0x3165, 0x3144, 0x2944, 0x2944, 0x2964, 0x3144, 0x3144, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944,   // 0xE7D0 (59344) pixels
-0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2945, 0x3185, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x3165, 0x3165,   // 0xE7E0 (59360) pixels
-0x2944, 0x3165, 0x3165, 0x3144, 0x3165, 0x3165, 0x2945, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x3144, 0x2945, 0x2944, 0x2944,   // 0xE7F0 (59376) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x3144, 0x2964, 0x2964, 0x3164, 0x3144, 0x3144, 0x2924, 0x2944, 0x2944, 0x3185, 0x3185,   // 0xE800 (59392) pixels
-0x3185, 0x2945, 0x3165, 0x2944, 0x2964, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x3144, 0x3985, 0x3185, 0x3185, 0x2944, 0x2945,   // 0xE810 (59408) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0xE820 (59424) pixels
-0x2124, 0x2924, 0x2124, 0x2123, 0x2124, 0x2124, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3,   // 0xE830 (59440) pixels
-0x18C2, 0x18C2, 0x5A68, 0x940D, 0xBD11, 0xBD11, 0xC552, 0xBD31, 0xC572, 0xC572, 0xBD32, 0xBD31, 0xC573, 0xC573, 0xB511, 0x9C4F,   // 0xE840 (59456) pixels
-0x5A68, 0x39A5, 0x3144, 0x2944, 0x2944, 0x2924, 0x3144, 0x2944, 0x2124, 0x2124, 0x2924, 0x2124, 0x2103, 0x2104, 0x2123, 0x2103,   // 0xE850 (59472) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18C3, 0x18C2, 0x18C3, 0x18A2, 0x18A2, 0x1081, 0x1082, 0x0840, 0x0881, 0x0861, 0x1061,   // 0xE860 (59488) pixels
-0x1061, 0x0861, 0x0861, 0x0881, 0x1082, 0x1082, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0xE870 (59504) pixels
-0x0841, 0x0000, 0x0020, 0x0840, 0x0841, 0x0861, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0xE880 (59520) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020,   // 0xE890 (59536) pixels
-0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x18E3, 0x18C3, 0x18A2,   // 0xE8A0 (59552) pixels
-0x10A2, 0x18A2, 0x10A2, 0x0020, 0x1061, 0x10A2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xE8B0 (59568) pixels
-0x2103, 0x2103, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x41E6, 0x6AE9, 0xA48F, 0xC593, 0xC593,   // 0xE8C0 (59584) pixels
-0xC573, 0xC573, 0xC573, 0xC574, 0xC572, 0xC551, 0xBD31, 0xBD32, 0xB511, 0x8BED, 0x5268, 0x39A6, 0x3185, 0x39A6, 0x18E3, 0x18C3,   // 0xE8D0 (59600) pixels
-0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2904, 0x2924,   // 0xE8E0 (59616) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xE8F0 (59632) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xE900 (59648) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xE910 (59664) pixels
-0x3145, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944,   // 0xE920 (59680) pixels
-0x3165, 0x2964, 0x3144, 0x3144, 0x3165, 0x3144, 0x3144, 0x2944, 0x3145, 0x3144, 0x3144, 0x3145, 0x3165, 0x2944, 0x2944, 0x2944,   // 0xE930 (59696) pixels
-0x3144, 0x3144, 0x3165, 0x3165, 0x3165, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x3144, 0x3144, 0x2944,   // 0xE940 (59712) pixels
-0x2944, 0x3165, 0x2944, 0x2965, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x3144, 0x2944,   // 0xE950 (59728) pixels
-0x2944, 0x3165, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xE960 (59744) pixels
-0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C2,   // 0xE970 (59760) pixels
-0x18C2, 0x18E3, 0x2924, 0x3144, 0x5227, 0x7B6B, 0xACB0, 0xBD52, 0xBD53, 0xC553, 0xBD51, 0xBD31, 0xC572, 0xC573, 0xC552, 0xC553,   // 0xE980 (59776) pixels
-0xC573, 0xB511, 0x7B6C, 0x49E6, 0x3185, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2103, 0x2103,   // 0xE990 (59792) pixels
-0x2924, 0x2103, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x1081, 0x1081, 0x0841, 0x0881, 0x1081, 0x0861,   // 0xE9A0 (59808) pixels
-0x0861, 0x0861, 0x0861, 0x0881, 0x0882, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x1082,   // 0xE9B0 (59824) pixels
-0x0020, 0x0000, 0x0020, 0x0840, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082,   // 0xE9C0 (59840) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020,   // 0xE9D0 (59856) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x10A2, 0x10C2, 0x18C2,   // 0xE9E0 (59872) pixels
-0x18C2, 0x18C2, 0x18C2, 0x0841, 0x1081, 0x1061, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0xE9F0 (59888) pixels
-0x2104, 0x2104, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2944, 0x3165, 0x62A9, 0x8BED, 0xBD52, 0xC572, 0xBD52, 0xC573, 0xBD52,   // 0xEA00 (59904) pixels
-0xC553, 0xBD52, 0xBD32, 0xBD32, 0xBD31, 0xB4D0, 0xA46F, 0x6AEA, 0x41C6, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x20E3, 0x18C2,   // 0xEA10 (59920) pixels
-0x18C2, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2123, 0x2124, 0x2124, 0x2124, 0x2124, 0x2904,   // 0xEA20 (59936) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xEA30 (59952) pixels
-0x2944, 0x2944, 0x2944, 0x3165, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xEA40 (59968) pixels
-0x2944, 0x2944, 0x2944, 0x3145, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944,   // 0xEA50 (59984) pixels
-0x3144, 0x2965, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0xEA60 (60000) pixels
-0x2945, 0x2944, 0x3144, 0x3165, 0x2944, 0x3144, 0x3165, 0x2944, 0x2944, 0x3145, 0x3164, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944,   // 0xEA70 (60016) pixels
-0x3144, 0x3144, 0x2944, 0x2944, 0x2945, 0x2944, 0x3145, 0x2945, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144,   // 0xEA80 (60032) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2964, 0x3185, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xEA90 (60048) pixels
-0x2944, 0x3165, 0x2944, 0x2944, 0x2124, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xEAA0 (60064) pixels
-0x2924, 0x2103, 0x2103, 0x2124, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C2,   // 0xEAB0 (60080) pixels
-0x18C3, 0x2103, 0x2944, 0x3165, 0x2924, 0x2944, 0x3165, 0x5A89, 0x8BCD, 0xB511, 0xBD32, 0xC532, 0xC552, 0xBD52, 0xBD52, 0xBD52,   // 0xEAC0 (60096) pixels
-0xBD52, 0xBD32, 0xC553, 0xC573, 0xB4F1, 0x6AE9, 0x41C6, 0x2944, 0x2944, 0x2924, 0x2924, 0x2903, 0x2924, 0x2123, 0x2103, 0x2944,   // 0xEAD0 (60112) pixels
-0x2944, 0x2103, 0x2103, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1081, 0x1082, 0x0020, 0x0841, 0x1061, 0x1061, 0x1062,   // 0xEAE0 (60128) pixels
-0x0881, 0x0861, 0x0861, 0x0881, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x1082,   // 0xEAF0 (60144) pixels
-0x0000, 0x0020, 0x0040, 0x0841, 0x0841, 0x0861, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082,   // 0xEB00 (60160) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0xEB10 (60176) pixels
-0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2,   // 0xEB20 (60192) pixels
-0x18A2, 0x10A2, 0x18C2, 0x0861, 0x1082, 0x1081, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0xEB30 (60208) pixels
-0x2104, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x3985, 0x5A88, 0x93EE, 0xBD52, 0xC572, 0xBD31, 0xC552, 0xBD52, 0xBD52, 0xC573,   // 0xEB40 (60224) pixels
-0xC573, 0xC553, 0xBD32, 0xBD12, 0xA46F, 0x6AC9, 0x41C6, 0x3144, 0x2944, 0x3144, 0x2924, 0x2924, 0x2924, 0x2944, 0x2124, 0x18C2,   // 0xEB50 (60240) pixels
-0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924,   // 0xEB60 (60256) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xEB70 (60272) pixels
-0x2924, 0x2944, 0x2924, 0x3165, 0x3165, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xEB80 (60288) pixels
-0x2944, 0x2944, 0x2944, 0x39A6, 0x3164, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xEB90 (60304) pixels
-0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165,   // 0xEBA0 (60320) pixels
-0x3165, 0x2944, 0x3144, 0x3185, 0x3165, 0x3165, 0x3144, 0x3144, 0x2944, 0x2944, 0x3144, 0x3144, 0x3165, 0x2944, 0x2944, 0x2944,   // 0xEBB0 (60336) pixels
-0x3144, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xEBC0 (60352) pixels
-0x2944, 0x2944, 0x3165, 0x3165, 0x2944, 0x2944, 0x2944, 0x3165, 0x3165, 0x2944, 0x2944, 0x2924, 0x3144, 0x2924, 0x2944, 0x2924,   // 0xEBD0 (60368) pixels
-0x2924, 0x39A6, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2124,   // 0xEBE0 (60384) pixels
-0x2124, 0x2124, 0x2924, 0x2124, 0x2124, 0x2104, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18E3, 0x18C2,   // 0xEBF0 (60400) pixels
-0x18E3, 0x2124, 0x3144, 0x2944, 0x3144, 0x3144, 0x3145, 0x2945, 0x3165, 0x62CA, 0x93EE, 0xB4F1, 0xBD32, 0xBD32, 0xBD52, 0xBD53,   // 0xEC00 (60416) pixels
-0xBD31, 0xC552, 0xBD53, 0xC553, 0xBD31, 0xB510, 0xA46F, 0x6AC9, 0x41E6, 0x2924, 0x2924, 0x2123, 0x2123, 0x2124, 0x2103, 0x2924,   // 0xEC10 (60432) pixels
-0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1061, 0x1082, 0x0020, 0x0861, 0x0882, 0x1061, 0x0882,   // 0xEC20 (60448) pixels
-0x0861, 0x0861, 0x0881, 0x1082, 0x0881, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x0861,   // 0xEC30 (60464) pixels
-0x0000, 0x0020, 0x0840, 0x0841, 0x0861, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082,   // 0xEC40 (60480) pixels
-0x1062, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0040, 0x0020, 0x0020, 0x0020, 0x0000,   // 0xEC50 (60496) pixels
-0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10C3, 0x10A2, 0x10A2, 0x10A2, 0x18A2,   // 0xEC60 (60512) pixels
-0x18A2, 0x18C2, 0x18C2, 0x1081, 0x0020, 0x1081, 0x18A2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xEC70 (60528) pixels
-0x2103, 0x2103, 0x3165, 0x2924, 0x3185, 0x6289, 0xA46F, 0xBD11, 0xB510, 0xBD31, 0xBD12, 0xBD31, 0xBD31, 0xBD10, 0xC552, 0xBD11,   // 0xEC80 (60544) pixels
-0xBD30, 0xB4D0, 0x838C, 0x41E6, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2124, 0x2103,   // 0xEC90 (60560) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2104, 0x2124, 0x2124,   // 0xECA0 (60576) pixels
-0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xECB0 (60592) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xECC0 (60608) pixels
-0x2944, 0x2944, 0x2924, 0x39A5, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2945, 0x2944, 0x2924, 0x2944,   // 0xECD0 (60624) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2945, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3145, 0x3145,   // 0xECE0 (60640) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x3165, 0x3144, 0x3144, 0x2944,   // 0xECF0 (60656) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924,   // 0xED00 (60672) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2945, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xED10 (60688) pixels
-0x2944, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xED20 (60704) pixels
-0x2124, 0x2924, 0x2124, 0x2104, 0x2903, 0x2904, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3,   // 0xED30 (60720) pixels
-0x2103, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x39A6, 0x62A9, 0x9C4F, 0xB511, 0xBD11,   // 0xED40 (60736) pixels
-0xC552, 0xBD31, 0xC573, 0xBD52, 0xC552, 0xB4F0, 0xB512, 0xB532, 0xB4F1, 0x8BCD, 0x3985, 0x2924, 0x2924, 0x2104, 0x2103, 0x2103,   // 0xED50 (60752) pixels
-0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18A2, 0x18A2, 0x1081, 0x1082, 0x0020, 0x0841, 0x0861, 0x0881, 0x0861, 0x0861,   // 0xED60 (60768) pixels
-0x1082, 0x0881, 0x0861, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861,   // 0xED70 (60784) pixels
-0x0000, 0x0020, 0x0840, 0x0861, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082,   // 0xED80 (60800) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0040, 0x0020, 0x0000, 0x0000,   // 0xED90 (60816) pixels
-0x0841, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10C2, 0x10C3, 0x10C2, 0x10A2, 0x18C2,   // 0xEDA0 (60832) pixels
-0x10A2, 0x18A2, 0x18C3, 0x1082, 0x0020, 0x1082, 0x0861, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2103, 0x20E3, 0x2103,   // 0xEDB0 (60848) pixels
-0x2103, 0x2104, 0x2924, 0x2103, 0x5A89, 0xACB0, 0xB511, 0xB512, 0xB511, 0xBD12, 0xB510, 0xB4F0, 0xBCF0, 0xB512, 0xBD11, 0xB4F0,   // 0xEDC0 (60864) pixels
-0x838C, 0x5A68, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2104,   // 0xEDD0 (60880) pixels
-0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104, 0x2124, 0x2924,   // 0xEDE0 (60896) pixels
-0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924,   // 0xEDF0 (60912) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924,   // 0xEE00 (60928) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xEE10 (60944) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2944,   // 0xEE20 (60960) pixels
-0x2944, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2964, 0x3165, 0x3185, 0x3144,   // 0xEE30 (60976) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xEE40 (60992) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xEE50 (61008) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2904,   // 0xEE60 (61024) pixels
-0x2924, 0x2104, 0x2124, 0x2103, 0x2924, 0x2924, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C3,   // 0xEE70 (61040) pixels
-0x2124, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x41C6, 0x8BAC, 0xACAF,   // 0xEE80 (61056) pixels
-0xB510, 0xBD31, 0xBD53, 0xBD31, 0xB512, 0xB4F0, 0xB510, 0xB511, 0xACF1, 0xB4F1, 0x5A68, 0x2924, 0x2124, 0x2103, 0x2103, 0x2103,   // 0xEE90 (61072) pixels
-0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x1061, 0x1081, 0x0020, 0x0841, 0x0861, 0x1082, 0x0861, 0x0861,   // 0xEEA0 (61088) pixels
-0x0861, 0x0861, 0x0861, 0x0881, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861,   // 0xEEB0 (61104) pixels
-0x0020, 0x0020, 0x0841, 0x0861, 0x1081, 0x1081, 0x1082, 0x1082, 0x1061, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082,   // 0xEEC0 (61120) pixels
-0x1061, 0x1061, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0040, 0x0020, 0x0020, 0x0000,   // 0xEED0 (61136) pixels
-0x0020, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x18C3, 0x18C3, 0x10C2,   // 0xEEE0 (61152) pixels
-0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x0841, 0x0020, 0x1081, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2103,   // 0xEEF0 (61168) pixels
-0x2103, 0x2103, 0x2104, 0x2124, 0x39A6, 0x93EE, 0xB4D1, 0xB4F0, 0xB531, 0xB4F0, 0xBD12, 0xB4F1, 0xB4F0, 0x9C2E, 0x5A88, 0x41A6,   // 0xEF00 (61184) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0xEF10 (61200) pixels
-0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104, 0x2924, 0x2103,   // 0xEF20 (61216) pixels
-0x2924, 0x2124, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2945, 0x2924, 0x2944,   // 0xEF30 (61232) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xEF40 (61248) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x3164, 0x3144, 0x3164, 0x3144, 0x2944, 0x2945, 0x2944,   // 0xEF50 (61264) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3145, 0x39A6, 0x41E6, 0x3165, 0x2945, 0x2944, 0x2944, 0x2944, 0x3144,   // 0xEF60 (61280) pixels
-0x3165, 0x41C6, 0x39A6, 0x2944, 0x3144, 0x2944, 0x39A5, 0x41C6, 0x3144, 0x3165, 0x3165, 0x2944, 0x39A5, 0x41E6, 0x39C6, 0x3144,   // 0xEF70 (61296) pixels
-0x2944, 0x2944, 0x3164, 0x3985, 0x39C6, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xEF80 (61312) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2124, 0x2944, 0x2944, 0x2944,   // 0xEF90 (61328) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xEFA0 (61344) pixels
-0x2924, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x20E3, 0x18C2, 0x18C3, 0x18C2, 0x2103,   // 0xEFB0 (61360) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144,   // 0xEFC0 (61376) pixels
-0x5227, 0x7B4B, 0xACB0, 0xB511, 0xBD32, 0xB511, 0xBD32, 0xB4F1, 0xACD0, 0x9C2F, 0x3165, 0x2924, 0x2944, 0x2103, 0x2103, 0x2103,   // 0xEFD0 (61392) pixels
-0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1081, 0x10A2, 0x0841, 0x0861, 0x1061, 0x1082, 0x0881, 0x0861,   // 0xEFE0 (61408) pixels
-0x1061, 0x0861, 0x0861, 0x0882, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0000,   // 0xEFF0 (61424) pixels
-0x0020, 0x0020, 0x0841, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082,   // 0xF000 (61440) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x0020, 0x0000,   // 0xF010 (61456) pixels
-0x0000, 0x0841, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x18C3, 0x10A2, 0x18A2, 0x10A2, 0x18C3, 0x18A2, 0x10A2,   // 0xF020 (61472) pixels
-0x10A2, 0x10C2, 0x18C3, 0x10A2, 0x0861, 0x0020, 0x1082, 0x1081, 0x18C2, 0x18C3, 0x18E3, 0x18C2, 0x20E3, 0x20E3, 0x2103, 0x20E3,   // 0xF030 (61488) pixels
-0x2103, 0x2103, 0x2103, 0x2924, 0x2944, 0x62A9, 0xACD1, 0xB512, 0xB4F1, 0xACB0, 0xACD0, 0x940E, 0x732A, 0x39A5, 0x2944, 0x2944,   // 0xF040 (61504) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xF050 (61520) pixels
-0x2124, 0x18C3, 0x18C2, 0x18C3, 0x20C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2104, 0x2904,   // 0xF060 (61536) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xF070 (61552) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944,   // 0xF080 (61568) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x4A07, 0x5A88, 0x62A9, 0x5248, 0x39C6, 0x2944, 0x2944,   // 0xF090 (61584) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2964, 0x3165, 0x3985, 0x8BCC, 0xA46F, 0x6289, 0x2944, 0x2945, 0x2944, 0x3145, 0x3164,   // 0xF0A0 (61600) pixels
-0x62A9, 0xA46F, 0x8BAD, 0x3185, 0x2964, 0x2964, 0x732B, 0xA46F, 0x39A5, 0x3164, 0x3144, 0x3144, 0x7B6C, 0x942E, 0x62CA, 0x3185,   // 0xF0B0 (61616) pixels
-0x2944, 0x2944, 0x3144, 0x6AEA, 0x940E, 0x3185, 0x2944, 0x3144, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944,   // 0xF0C0 (61632) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xF0D0 (61648) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2104,   // 0xF0E0 (61664) pixels
-0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x2103,   // 0xF0F0 (61680) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xF100 (61696) pixels
-0x2944, 0x3165, 0x5A68, 0x940E, 0xAC8F, 0xB4D0, 0xB4D0, 0xB4D1, 0xB4D0, 0x83AD, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xF110 (61712) pixels
-0x2103, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x1081, 0x1081, 0x0861, 0x0861, 0x1081, 0x1082, 0x1061, 0x0861,   // 0xF120 (61728) pixels
-0x1061, 0x1061, 0x0882, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C3, 0x10C3, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0000,   // 0xF130 (61744) pixels
-0x0020, 0x0020, 0x0841, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081,   // 0xF140 (61760) pixels
-0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0820, 0x0040, 0x0020, 0x0000,   // 0xF150 (61776) pixels
-0x0000, 0x0841, 0x0861, 0x1082, 0x10A2, 0x18A2, 0x18A2, 0x18C2, 0x18E3, 0x18C3, 0x10A2, 0x10A2, 0x18A2, 0x18C3, 0x18C2, 0x10C2,   // 0xF160 (61792) pixels
-0x10C3, 0x10C3, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x10A2, 0x1081, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x20E3, 0x20E3, 0x20E3,   // 0xF170 (61808) pixels
-0x2103, 0x2103, 0x2104, 0x2924, 0x2924, 0x39A5, 0xA46F, 0xA490, 0x942E, 0x732B, 0x49E6, 0x2944, 0x2924, 0x3144, 0x2944, 0x2944,   // 0xF180 (61824) pixels
-0x2944, 0x2944, 0x3165, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x3164,   // 0xF190 (61840) pixels
-0x2924, 0x18A2, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2103, 0x2124, 0x2104,   // 0xF1A0 (61856) pixels
-0x2104, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x3164, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924,   // 0xF1B0 (61872) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xF1C0 (61888) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x6AEA, 0xB4F1, 0xACD0, 0xB511, 0xBD52, 0xB511, 0x4A07, 0x2944,   // 0xF1D0 (61904) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x39A5, 0xB4F0, 0xC573, 0xA46F, 0x3185, 0x2965, 0x3165, 0x3145, 0x41E6,   // 0xF1E0 (61920) pixels
-0xA46F, 0xC553, 0xB4D0, 0x3985, 0x3144, 0x2944, 0x8BCD, 0xCD93, 0x39A6, 0x3164, 0x3164, 0x3144, 0x9C2E, 0xBD51, 0xB511, 0x41E6,   // 0xF1F0 (61936) pixels
-0x3144, 0x3144, 0x3144, 0x838C, 0xB4D0, 0x3985, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xF200 (61952) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x2924, 0x2944, 0x3144, 0x2924, 0x2944, 0x2924,   // 0xF210 (61968) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124,   // 0xF220 (61984) pixels
-0x2124, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x20E3, 0x2924,   // 0xF230 (62000) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924,   // 0xF240 (62016) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x3185, 0x62C9, 0x8BED, 0xACB0, 0xAC90, 0x4A27, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3,   // 0xF250 (62032) pixels
-0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x20E3, 0x18C2, 0x0861, 0x10A2, 0x0841, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061,   // 0xF260 (62048) pixels
-0x1062, 0x0861, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18E3, 0x10C2, 0x10A2, 0x10A2, 0x0861, 0x0861, 0x0000,   // 0xF270 (62064) pixels
-0x0020, 0x0020, 0x0841, 0x0861, 0x1061, 0x1061, 0x1061, 0x1082, 0x1081, 0x1081, 0x1062, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081,   // 0xF280 (62080) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0020,   // 0xF290 (62096) pixels
-0x0000, 0x0840, 0x0841, 0x1082, 0x10A2, 0x18A2, 0x18A2, 0x18A2, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x10A2, 0x18C3,   // 0xF2A0 (62112) pixels
-0x18C2, 0x10C3, 0x18C3, 0x18C3, 0x10A2, 0x1082, 0x0841, 0x1082, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x20E3, 0x18E3, 0x2103,   // 0xF2B0 (62128) pixels
-0x20E3, 0x2103, 0x2103, 0x2904, 0x2924, 0x2924, 0x62C9, 0x41C6, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xF2C0 (62144) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xF2D0 (62160) pixels
-0x3164, 0x2103, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104,   // 0xF2E0 (62176) pixels
-0x2104, 0x2104, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924,   // 0xF2F0 (62192) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3165, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944,   // 0xF300 (62208) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x5247, 0x5248, 0x2944, 0x2944, 0x62C9, 0xB4D0, 0x9C2E, 0x3164,   // 0xF310 (62224) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x3165, 0x39A6, 0xB4F0, 0x9C4F, 0xBD52, 0x7B6B, 0x3165, 0x3164, 0x3144, 0x7B6B,   // 0xF320 (62240) pixels
-0xBD31, 0xACB0, 0xB4F1, 0x39A6, 0x3165, 0x3144, 0x83AC, 0xCD93, 0x39A5, 0x3164, 0x3144, 0x3165, 0x9C0E, 0xB4F1, 0xACD0, 0x9C0E,   // 0xF330 (62256) pixels
-0x3164, 0x3165, 0x3144, 0x836C, 0xB4D1, 0x3985, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xF340 (62272) pixels
-0x2944, 0x3165, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xF350 (62288) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2104, 0x2104, 0x2104,   // 0xF360 (62304) pixels
-0x2104, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x2103, 0x2944,   // 0xF370 (62320) pixels
-0x2924, 0x2944, 0x2944, 0x2945, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x3145, 0x3145, 0x2924, 0x2924,   // 0xF380 (62336) pixels
-0x2924, 0x3185, 0x2944, 0x3165, 0x39A6, 0x2924, 0x2944, 0x39A5, 0x4A07, 0x2924, 0x2924, 0x2124, 0x2103, 0x2103, 0x2103, 0x20E3,   // 0xF390 (62352) pixels
-0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x1081, 0x0861, 0x0861, 0x0861, 0x0881, 0x1061, 0x1061, 0x1061, 0x1081,   // 0xF3A0 (62368) pixels
-0x1081, 0x0881, 0x0882, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x10C3, 0x10A2, 0x0861, 0x0000, 0x0020,   // 0xF3B0 (62384) pixels
-0x0820, 0x0820, 0x0861, 0x0861, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1061, 0x1081, 0x1061,   // 0xF3C0 (62400) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0840, 0x0020,   // 0xF3D0 (62416) pixels
-0x0020, 0x0020, 0x0841, 0x1082, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x10C2,   // 0xF3E0 (62432) pixels
-0x10C2, 0x10A2, 0x18C3, 0x10C2, 0x10A2, 0x10A2, 0x0841, 0x1082, 0x10A2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x20E3, 0x20E3, 0x2104,   // 0xF3F0 (62448) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124,   // 0xF400 (62464) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xF410 (62480) pixels
-0x2965, 0x2124, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xF420 (62496) pixels
-0x2104, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944,   // 0xF430 (62512) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x3165, 0x3185, 0x2124, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xF440 (62528) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x3985, 0x93ED, 0xA46F, 0x41C6,   // 0xF450 (62544) pixels
-0x2964, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x3145, 0x39C6, 0xB510, 0x8BCD, 0xBD31, 0x9C2F, 0x3144, 0x3144, 0x3164, 0xA46F,   // 0xF460 (62560) pixels
-0xAC8F, 0x9C2E, 0xB511, 0x39A6, 0x3144, 0x3144, 0x838C, 0xC593, 0x39A5, 0x3165, 0x3164, 0x3164, 0x9C0E, 0xAC6F, 0x838C, 0xB4F1,   // 0xF470 (62576) pixels
-0x4A07, 0x3164, 0x3144, 0x836C, 0xACB0, 0x3985, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xF480 (62592) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xF490 (62608) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924, 0x2124, 0x2104, 0x2124, 0x2124, 0x2104,   // 0xF4A0 (62624) pixels
-0x2103, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x2104, 0x2944, 0x2944,   // 0xF4B0 (62640) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x3145, 0x2944, 0x2944, 0x2924,   // 0xF4C0 (62656) pixels
-0x2924, 0x3165, 0x2924, 0x3185, 0x3185, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2104, 0x2104, 0x2104, 0x2103, 0x20E3, 0x20E3,   // 0xF4D0 (62672) pixels
-0x20E3, 0x18C3, 0x18C3, 0x18C2, 0x20E3, 0x18C2, 0x1082, 0x1082, 0x0020, 0x0861, 0x0861, 0x0861, 0x1081, 0x0861, 0x1061, 0x1061,   // 0xF4E0 (62688) pixels
-0x1082, 0x0881, 0x1082, 0x1082, 0x10A2, 0x10C3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x18E3, 0x18E3, 0x10A2, 0x0841, 0x0000, 0x0020,   // 0xF4F0 (62704) pixels
-0x0820, 0x0841, 0x0841, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081,   // 0xF500 (62720) pixels
-0x1061, 0x1061, 0x1061, 0x0881, 0x0881, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0820,   // 0xF510 (62736) pixels
-0x0020, 0x0000, 0x0841, 0x1082, 0x10A2, 0x18A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3,   // 0xF520 (62752) pixels
-0x18C3, 0x10C3, 0x10C3, 0x10C2, 0x18C2, 0x18A2, 0x0861, 0x1081, 0x0861, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3,   // 0xF530 (62768) pixels
-0x2103, 0x2103, 0x2103, 0x2944, 0x2103, 0x2924, 0x2104, 0x2103, 0x2104, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124,   // 0xF540 (62784) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2964, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xF550 (62800) pixels
-0x2944, 0x3144, 0x2924, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xF560 (62816) pixels
-0x2104, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xF570 (62832) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0xF580 (62848) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x41E6, 0xA44F, 0x9C2E, 0x3164,   // 0xF590 (62864) pixels
-0x3144, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x3145, 0x41C6, 0xCD93, 0x7B6B, 0xA46F, 0xB531, 0x3985, 0x3164, 0x4A07, 0xC551,   // 0xF5A0 (62880) pixels
-0x7B4B, 0x9C2E, 0xB511, 0x39A5, 0x3164, 0x3144, 0x8BCD, 0xC593, 0x39A5, 0x3144, 0x3144, 0x3144, 0x9C0E, 0x9C2F, 0x4A07, 0xB4F1,   // 0xF5B0 (62896) pixels
-0x8BED, 0x39A5, 0x3144, 0x836C, 0xACB0, 0x3985, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944,   // 0xF5C0 (62912) pixels
-0x2944, 0x2945, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xF5D0 (62928) pixels
-0x2924, 0x2924, 0x2944, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2103,   // 0xF5E0 (62944) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x20E3, 0x2944, 0x2944, 0x2924,   // 0xF5F0 (62960) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2945, 0x2944, 0x2924, 0x2944, 0x2944, 0x2124,   // 0xF600 (62976) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2945, 0x2124, 0x2104, 0x2124, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3,   // 0xF610 (62992) pixels
-0x20E3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x1081, 0x1082, 0x0841, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1081,   // 0xF620 (63008) pixels
-0x1082, 0x0882, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18C3, 0x1903, 0x18C3, 0x18C2, 0x18C3, 0x10C2, 0x0881, 0x0020, 0x0020, 0x0820,   // 0xF630 (63024) pixels
-0x0841, 0x0841, 0x0861, 0x1061, 0x1062, 0x1082, 0x1081, 0x1082, 0x1082, 0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0xF640 (63040) pixels
-0x1061, 0x1061, 0x1061, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0840,   // 0xF650 (63056) pixels
-0x0020, 0x0000, 0x0820, 0x1081, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x18C3,   // 0xF660 (63072) pixels
-0x18E3, 0x10C2, 0x18C2, 0x10C2, 0x18C2, 0x18C2, 0x1082, 0x0020, 0x1081, 0x18C2, 0x18A2, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x20E3,   // 0xF670 (63088) pixels
-0x20E3, 0x20E3, 0x2103, 0x2944, 0x2924, 0x2103, 0x2124, 0x2124, 0x2103, 0x2124, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924,   // 0xF680 (63104) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xF690 (63120) pixels
-0x2944, 0x3165, 0x3165, 0x2104, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104,   // 0xF6A0 (63136) pixels
-0x2124, 0x2104, 0x2104, 0x2103, 0x2924, 0x2924, 0x2924, 0x2123, 0x2123, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xF6B0 (63152) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x3144, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x3144, 0x2944,   // 0xF6C0 (63168) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3164, 0x730A, 0xBD31, 0x7B6B, 0x3144,   // 0xF6D0 (63184) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x39A6, 0xC552, 0x730A, 0x83AD, 0xC573, 0x4A07, 0x3144, 0x6AEA, 0xB4F0,   // 0xF6E0 (63200) pixels
-0x62A9, 0x9C2E, 0xB511, 0x39A5, 0x3164, 0x3144, 0x8BAC, 0xC573, 0x39A5, 0x3164, 0x2944, 0x3144, 0x940E, 0x9C2F, 0x3165, 0x93ED,   // 0xF6F0 (63216) pixels
-0xB4F0, 0x62C9, 0x3165, 0x836C, 0xAC8F, 0x3985, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xF700 (63232) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2945, 0x2944, 0x2124, 0x2944, 0x2944,   // 0xF710 (63248) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2104, 0x2124, 0x2124, 0x2104, 0x2103, 0x2103,   // 0xF720 (63264) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x2103, 0x2944, 0x2924, 0x2944,   // 0xF730 (63280) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xF740 (63296) pixels
-0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x18E3, 0x20E3,   // 0xF750 (63312) pixels
-0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x18C3, 0x1082, 0x1082, 0x0841, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x1081,   // 0xF760 (63328) pixels
-0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x10C2, 0x10A2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0841,   // 0xF770 (63344) pixels
-0x0841, 0x0841, 0x0861, 0x1061, 0x1062, 0x1082, 0x1082, 0x1082, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081,   // 0xF780 (63360) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0841, 0x0841,   // 0xF790 (63376) pixels
-0x0020, 0x0020, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x18C3,   // 0xF7A0 (63392) pixels
-0x18C3, 0x10A2, 0x10C2, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x0841, 0x1081, 0x1061, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3,   // 0xF7B0 (63408) pixels
-0x20E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2903, 0x2104, 0x2103, 0x2103, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924,   // 0xF7C0 (63424) pixels
-0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xF7D0 (63440) pixels
-0x2944, 0x2944, 0x2945, 0x2944, 0x2103, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E2, 0x20E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103,   // 0xF7E0 (63456) pixels
-0x2103, 0x2104, 0x2103, 0x2924, 0x2124, 0x2924, 0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xF7F0 (63472) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2964, 0x2924, 0x2124,   // 0xF800 (63488) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x41E6, 0xACD0, 0xB4F1, 0x3985, 0x2944,   // 0xF810 (63504) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x41C6, 0xC573, 0x6AC9, 0x5247, 0xACD0, 0x8BAC, 0x41C6, 0xA44F, 0x93EE,   // 0xF820 (63520) pixels
-0x41A5, 0x7B4B, 0xBD32, 0x41C6, 0x3144, 0x3144, 0x838C, 0xC572, 0x3985, 0x2944, 0x2944, 0x3144, 0x940E, 0xA46F, 0x3164, 0x39A5,   // 0xF830 (63536) pixels
-0xACD0, 0xBD32, 0x39C6, 0x838B, 0xACAF, 0x3185, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xF840 (63552) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2124, 0x2944, 0x2924,   // 0xF850 (63568) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2103, 0x2103,   // 0xF860 (63584) pixels
-0x2104, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C2, 0x2103, 0x2924, 0x2924, 0x2124, 0x2944,   // 0xF870 (63600) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2124, 0x39A6, 0x2924,   // 0xF880 (63616) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2124, 0x2104, 0x2104, 0x2123, 0x2103, 0x2104, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0xF890 (63632) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18A2, 0x18A2, 0x10A2, 0x1082, 0x0020, 0x0841, 0x1061, 0x0861, 0x1081, 0x0861, 0x0881, 0x1081, 0x1082,   // 0xF8A0 (63648) pixels
-0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C2, 0x18E3, 0x18C2, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x0000, 0x0020, 0x0841,   // 0xF8B0 (63664) pixels
-0x0861, 0x0861, 0x1061, 0x1061, 0x1081, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1061, 0x1082, 0x1081,   // 0xF8C0 (63680) pixels
-0x1061, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0841, 0x0840,   // 0xF8D0 (63696) pixels
-0x0820, 0x0020, 0x0000, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10C3,   // 0xF8E0 (63712) pixels
-0x10C2, 0x10C2, 0x18C3, 0x18C2, 0x10C2, 0x10C2, 0x10A2, 0x0861, 0x1082, 0x1081, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3,   // 0xF8F0 (63728) pixels
-0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2104, 0x2124, 0x2123, 0x2124, 0x2124, 0x2924, 0x2924, 0x2944, 0x2944,   // 0xF900 (63744) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0xF910 (63760) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103,   // 0xF920 (63776) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x2124, 0x2124, 0x2124, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2904, 0x2124, 0x2924,   // 0xF930 (63792) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2945, 0x2944, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xF940 (63808) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x39A5, 0x83AC, 0xB4D0, 0x6AEA, 0x2944, 0x2944,   // 0xF950 (63824) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x4A07, 0xBD73, 0x6AC9, 0x3985, 0x940E, 0xA46F, 0x62A9, 0xB4D0, 0x6AEA,   // 0xF960 (63840) pixels
-0x3144, 0x7B2A, 0xBD31, 0x41C6, 0x3144, 0x3144, 0x838C, 0xC573, 0x3985, 0x2944, 0x2944, 0x3144, 0x940E, 0xA46F, 0x3164, 0x3164,   // 0xF970 (63856) pixels
-0x8BCD, 0xBD32, 0x730A, 0x838B, 0xACD0, 0x3185, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924,   // 0xF980 (63872) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2124, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2124,   // 0xF990 (63888) pixels
-0x2104, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2904, 0x2124, 0x2104, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103,   // 0xF9A0 (63904) pixels
-0x2104, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E2, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x2103, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924,   // 0xF9B0 (63920) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924,   // 0xF9C0 (63936) pixels
-0x2924, 0x2924, 0x2124, 0x2944, 0x3164, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x20E3, 0x2924, 0x20E3, 0x20E3,   // 0xF9D0 (63952) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1081, 0x1082, 0x0020, 0x0861, 0x0881, 0x0881, 0x0861, 0x0881, 0x0881, 0x0861, 0x1082,   // 0xF9E0 (63968) pixels
-0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0020, 0x0020, 0x0841,   // 0xF9F0 (63984) pixels
-0x0861, 0x0861, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0xFA00 (64000) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0820,   // 0xFA10 (64016) pixels
-0x0840, 0x0020, 0x0000, 0x0040, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10A2,   // 0xFA20 (64032) pixels
-0x10C2, 0x10C3, 0x18A2, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x1081, 0x0020, 0x1082, 0x1081, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3,   // 0xFA30 (64048) pixels
-0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2904, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xFA40 (64064) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2124, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0xFA50 (64080) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2103, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0xFA60 (64096) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2124, 0x2124, 0x2924, 0x2123, 0x2103, 0x2124, 0x2924, 0x2124, 0x2924,   // 0xFA70 (64112) pixels
-0x2924, 0x2924, 0x2944, 0x2945, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xFA80 (64128) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x39A6, 0x9C4F, 0xACAF, 0x5A88, 0x2944, 0x2944, 0x2924,   // 0xFA90 (64144) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x3164, 0x5A88, 0xBD53, 0x62A9, 0x3144, 0x62A9, 0xB511, 0x942E, 0xBD11, 0x3985,   // 0xFAA0 (64160) pixels
-0x2944, 0x732A, 0xC572, 0x39A5, 0x2964, 0x2944, 0x8BAD, 0xC573, 0x3985, 0x2924, 0x2944, 0x3144, 0x940E, 0x9C4F, 0x3164, 0x3144,   // 0xFAB0 (64176) pixels
-0x39A5, 0x9C0E, 0xACD0, 0x9C4F, 0xA46F, 0x3165, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xFAC0 (64192) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2124, 0x2924, 0x2124, 0x2924,   // 0xFAD0 (64208) pixels
-0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2104, 0x2124, 0x2924, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xFAE0 (64224) pixels
-0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x20E3, 0x18C2, 0x18E3, 0x2124, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944,   // 0xFAF0 (64240) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x2924,   // 0xFB00 (64256) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2104, 0x2124, 0x2124, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104, 0x2924, 0x2944, 0x18C2, 0x18C2,   // 0xFB10 (64272) pixels
-0x18C3, 0x18A2, 0x18A2, 0x18A2, 0x18C3, 0x1082, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0881, 0x0881, 0x0881, 0x0882, 0x1082,   // 0xFB20 (64288) pixels
-0x1081, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0020, 0x0841,   // 0xFB30 (64304) pixels
-0x1061, 0x1061, 0x1082, 0x1061, 0x1082, 0x1082, 0x1082, 0x1061, 0x1062, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082,   // 0xFB40 (64320) pixels
-0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x1081, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x0841, 0x0841,   // 0xFB50 (64336) pixels
-0x0040, 0x0020, 0x0000, 0x0000, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0xFB60 (64352) pixels
-0x10C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x0861, 0x0841, 0x1082, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E2,   // 0xFB70 (64368) pixels
-0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924,   // 0xFB80 (64384) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xFB90 (64400) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x3165, 0x2103, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0xFBA0 (64416) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2924, 0x2103, 0x2124, 0x2103, 0x2924, 0x2124, 0x2924, 0x2124,   // 0xFBB0 (64432) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xFBC0 (64448) pixels
-0x2924, 0x2924, 0x2944, 0x39A6, 0x2924, 0x2924, 0x2924, 0x2924, 0x41E6, 0xACB0, 0x9C4F, 0x62A9, 0x3165, 0x3144, 0x2944, 0x2944,   // 0xFBD0 (64464) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x3164, 0x6289, 0xA48F, 0x5248, 0x3144, 0x3985, 0xBD31, 0xBD52, 0x8BCD, 0x2944,   // 0xFBE0 (64480) pixels
-0x2944, 0x6AC9, 0xC572, 0x5207, 0x2944, 0x2944, 0x838D, 0xC573, 0x3985, 0x2924, 0x2924, 0x3144, 0x940E, 0x9C4F, 0x3144, 0x2924,   // 0xFBF0 (64496) pixels
-0x2944, 0x39A5, 0xACAF, 0xBD32, 0xA48F, 0x3165, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924,   // 0xFC00 (64512) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924,   // 0xFC10 (64528) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103,   // 0xFC20 (64544) pixels
-0x2103, 0x20E3, 0x2103, 0x18C3, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x2104, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944,   // 0xFC30 (64560) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2124, 0x2924, 0x2944, 0x2924,   // 0xFC40 (64576) pixels
-0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2103, 0x2104, 0x2924, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3,   // 0xFC50 (64592) pixels
-0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x1061, 0x1082, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0881, 0x1061, 0x1081, 0x0861,   // 0xFC60 (64608) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x0000, 0x0020, 0x0820, 0x0841,   // 0xFC70 (64624) pixels
-0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1082, 0x1082, 0x1061, 0x1081, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081,   // 0xFC80 (64640) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0841, 0x0841,   // 0xFC90 (64656) pixels
-0x0020, 0x0020, 0x0000, 0x0000, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2,   // 0xFCA0 (64672) pixels
-0x10A2, 0x10A2, 0x10C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x1082, 0x18A2, 0x18C2, 0x18C3, 0x18C3, 0x18E3,   // 0xFCB0 (64688) pixels
-0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104, 0x2124, 0x2924, 0x2924,   // 0xFCC0 (64704) pixels
-0x2924, 0x2944, 0x2944, 0x3165, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924,   // 0xFCD0 (64720) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2964, 0x2124, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x2103, 0x20E3, 0x18E3, 0x20E3, 0x2103,   // 0xFCE0 (64736) pixels
-0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2124, 0x2104, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124,   // 0xFCF0 (64752) pixels
-0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xFD00 (64768) pixels
-0x2924, 0x2924, 0x2924, 0x3985, 0x2944, 0x2924, 0x2944, 0x3985, 0x7B6C, 0xBD31, 0xA46F, 0x8BED, 0x8BCD, 0x8BCD, 0x7B6C, 0x5248,   // 0xFD10 (64784) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x3165, 0x7B4B, 0xA46F, 0x5247, 0x2944, 0x2944, 0xA48F, 0xB511, 0x6ACA, 0x2924,   // 0xFD20 (64800) pixels
-0x3144, 0x62A9, 0xBD31, 0x5A48, 0x2924, 0x2924, 0x838C, 0xC573, 0x3185, 0x2944, 0x2944, 0x2944, 0x93EE, 0x9C2F, 0x2944, 0x2924,   // 0xFD30 (64816) pixels
-0x2944, 0x2944, 0x8BCC, 0xB511, 0xA46F, 0x3165, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924,   // 0xFD40 (64832) pixels
-0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2104, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2103,   // 0xFD50 (64848) pixels
-0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0xFD60 (64864) pixels
-0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x2103, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2124,   // 0xFD70 (64880) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x3165, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xFD80 (64896) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C3,   // 0xFD90 (64912) pixels
-0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x1081, 0x0841, 0x0861, 0x0861, 0x0861, 0x0881, 0x0881, 0x0881, 0x1061, 0x0861, 0x0861, 0x1081,   // 0xFDA0 (64928) pixels
-0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0862, 0x0000, 0x0000, 0x0020, 0x0820, 0x0841,   // 0xFDB0 (64944) pixels
-0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1082, 0x1062, 0x1082, 0x1081, 0x1082, 0x1062, 0x1081, 0x1061, 0x1081, 0x1082, 0x1082,   // 0xFDC0 (64960) pixels
-0x0861, 0x0861, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841,   // 0xFDD0 (64976) pixels
-0x0820, 0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2,   // 0xFDE0 (64992) pixels
-0x10A2, 0x18C3, 0x18C2, 0x10C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x1082, 0x1061, 0x18C3, 0x18C2, 0x18C2, 0x18C3,   // 0xFDF0 (65008) pixels
-0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2123, 0x2924, 0x2924, 0x2924,   // 0xFE00 (65024) pixels
-0x2924, 0x2924, 0x8BCE, 0xACB0, 0xB4B0, 0x4A07, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xFE10 (65040) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2945, 0x2104, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3,   // 0xFE20 (65056) pixels
-0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2903, 0x2104, 0x2924, 0x2924, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924,   // 0xFE30 (65072) pixels
-0x2123, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2104,   // 0xFE40 (65088) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x41C6, 0x734B, 0x8BCD, 0x8BCD, 0x8BCD, 0x8BCD, 0x8BED, 0x838C, 0x5248,   // 0xFE50 (65104) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x62C9, 0x732B, 0x39C6, 0x2944, 0x2944, 0x5227, 0x6AEA, 0x3985, 0x2944,   // 0xFE60 (65120) pixels
-0x2944, 0x5227, 0x83AC, 0x41E6, 0x2944, 0x2944, 0x6AC9, 0x8BAC, 0x3164, 0x2924, 0x2124, 0x2124, 0x730A, 0x732A, 0x2924, 0x2924,   // 0xFE70 (65136) pixels
-0x2124, 0x2924, 0x41E6, 0x732B, 0x7B2B, 0x2944, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xFE80 (65152) pixels
-0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2923, 0x2124, 0x2124, 0x2924, 0x2924, 0x2124, 0x2124, 0x2944, 0x2924,   // 0xFE90 (65168) pixels
-0x2124, 0x2924, 0x2904, 0x2924, 0x2103, 0x2124, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0xFEA0 (65184) pixels
-0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x2103, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0xFEB0 (65200) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0xFEC0 (65216) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2103, 0x2924, 0x2103, 0x2104, 0x2104, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2,   // 0xFED0 (65232) pixels
-0x18C3, 0x18C2, 0x18A2, 0x1082, 0x1082, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861, 0x1061, 0x0881, 0x1082,   // 0xFEE0 (65248) pixels
-0x10A2, 0x18C2, 0x10C2, 0x10A2, 0x10C2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0020, 0x0820, 0x0861,   // 0xFEF0 (65264) pixels
-0x1061, 0x1061, 0x1082, 0x1061, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1062, 0x1082, 0x1081, 0x1061, 0x1082, 0x1081, 0x1061,   // 0xFF00 (65280) pixels
-0x0861, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841,   // 0xFF10 (65296) pixels
-0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0xFF20 (65312) pixels
-0x10C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x10C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x0840, 0x1082, 0x1081, 0x18C2, 0x18C2, 0x18C3,   // 0xFF30 (65328) pixels
-0x18C2, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2104, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924,   // 0xFF40 (65344) pixels
-0x2124, 0x2924, 0xA46F, 0xBD53, 0xCD94, 0x5248, 0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0xFF50 (65360) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2945, 0x3165, 0x20E3, 0x18C2, 0x18C3, 0x18C2, 0x20E3, 0x18C2, 0x18E3, 0x20E3,   // 0xFF60 (65376) pixels
-0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2124, 0x2103, 0x2104, 0x2104, 0x2103, 0x2124, 0x2924,   // 0xFF70 (65392) pixels
-0x2123, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2904, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924,   // 0xFF80 (65408) pixels
-0x2924, 0x2124, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xFF90 (65424) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0xFFA0 (65440) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0xFFB0 (65456) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2924, 0x2923,   // 0xFFC0 (65472) pixels
-0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2904, 0x2924, 0x2124, 0x2123, 0x2124, 0x2124, 0x2124, 0x2124,   // 0xFFD0 (65488) pixels
-0x2124, 0x2103, 0x2124, 0x2124, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3,   // 0xFFE0 (65504) pixels
-0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x2104, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944,   // 0xFFF0 (65520) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x3164, 0x3164, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3165, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x10000 (65536) pixels
-0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2103, 0x2924, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2,   // 0x10010 (65552) pixels
-0x18C2, 0x18A2, 0x18C2, 0x1081, 0x1081, 0x0861, 0x1081, 0x0861, 0x0861, 0x1081, 0x1061, 0x0881, 0x0881, 0x1081, 0x0861, 0x10A2,   // 0x10020 (65568) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10C3, 0x18A2, 0x10C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0820, 0x0840, 0x0861,   // 0x10030 (65584) pixels
-0x1081, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082,   // 0x10040 (65600) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x10050 (65616) pixels
-0x0861, 0x0840, 0x0040, 0x0000, 0x0000, 0x0840, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082,   // 0x10060 (65632) pixels
-0x18A2, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x1082, 0x10A2, 0x1081, 0x18C2, 0x18E3, 0x18C2,   // 0x10070 (65648) pixels
-0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124, 0x2124, 0x2944, 0x2124,   // 0x10080 (65664) pixels
-0x2924, 0x2944, 0x9C4F, 0xB4F0, 0xC573, 0x5248, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x10090 (65680) pixels
-0x2924, 0x2924, 0x2104, 0x2924, 0x2944, 0x2944, 0x2944, 0x2965, 0x2924, 0x2104, 0x18C3, 0x18C2, 0x20E3, 0x20E3, 0x18E3, 0x20E3,   // 0x100A0 (65696) pixels
-0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2945, 0x39A6, 0x2924, 0x2904,   // 0x100B0 (65712) pixels
-0x2903, 0x2104, 0x2103, 0x2124, 0x2124, 0x2104, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924,   // 0x100C0 (65728) pixels
-0x2123, 0x2124, 0x2124, 0x2924, 0x2924, 0x2124, 0x2123, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x100D0 (65744) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2965, 0x2924, 0x2924, 0x2924, 0x2944, 0x3185, 0x39C7, 0x4A07, 0x4A07, 0x2944, 0x2924,   // 0x100E0 (65760) pixels
-0x2924, 0x2124, 0x3985, 0x3144, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2123, 0x2124, 0x2924, 0x2924, 0x2924,   // 0x100F0 (65776) pixels
-0x2124, 0x2924, 0x2924, 0x2903, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924,   // 0x10100 (65792) pixels
-0x2924, 0x2124, 0x2124, 0x2104, 0x2104, 0x2123, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2124, 0x2103, 0x2124,   // 0x10110 (65808) pixels
-0x2124, 0x2103, 0x2904, 0x2124, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3,   // 0x10120 (65824) pixels
-0x20E3, 0x18C2, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x2103, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x10130 (65840) pixels
-0x2944, 0x2944, 0x2944, 0x49E6, 0x940E, 0xA44E, 0xB4D0, 0xACCF, 0xACD0, 0xA4AF, 0xA46F, 0xA4AF, 0x9C6F, 0x7B8C, 0x5247, 0x3185,   // 0x10140 (65856) pixels
-0x2924, 0x2924, 0x2123, 0x2123, 0x2924, 0x2103, 0x20E3, 0x2103, 0x2103, 0x18E3, 0x20E3, 0x20E3, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0x10150 (65872) pixels
-0x18A2, 0x18C3, 0x1081, 0x1082, 0x0820, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x10A2,   // 0x10160 (65888) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x0840, 0x0861,   // 0x10170 (65904) pixels
-0x1081, 0x1061, 0x0881, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1061, 0x1081, 0x1082,   // 0x10180 (65920) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x10190 (65936) pixels
-0x0861, 0x0840, 0x0040, 0x0020, 0x0020, 0x0020, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2,   // 0x101A0 (65952) pixels
-0x10A2, 0x18C2, 0x10C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x10A2, 0x0841, 0x1082, 0x1081, 0x18C2, 0x18C2,   // 0x101B0 (65968) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2123, 0x2104, 0x2924, 0x2124, 0x2124,   // 0x101C0 (65984) pixels
-0x2924, 0x2924, 0xA44F, 0xBD12, 0xC552, 0x5227, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x101D0 (66000) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18E3,   // 0x101E0 (66016) pixels
-0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x3165, 0x2944, 0x2103, 0x2104,   // 0x101F0 (66032) pixels
-0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2104, 0x2104, 0x2103, 0x2104, 0x2104, 0x2924, 0x2924, 0x2903, 0x2124, 0x2924, 0x2924,   // 0x10200 (66048) pixels
-0x2924, 0x2924, 0x2924, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2124, 0x2103, 0x2103, 0x2104, 0x2124, 0x2923, 0x3186, 0x2924,   // 0x10210 (66064) pixels
-0x2924, 0x2924, 0x2903, 0x2924, 0x3185, 0x2944, 0x2924, 0x2924, 0x49E7, 0x4A07, 0x3165, 0x2924, 0x2924, 0x2103, 0x2924, 0x2124,   // 0x10220 (66080) pixels
-0x2924, 0x2104, 0x3185, 0x4A07, 0x2944, 0x2124, 0x2123, 0x2123, 0x2123, 0x2124, 0x2124, 0x2924, 0x2124, 0x2104, 0x2924, 0x2124,   // 0x10230 (66096) pixels
-0x2104, 0x2124, 0x2124, 0x2103, 0x2124, 0x2123, 0x2103, 0x2104, 0x2103, 0x2103, 0x2124, 0x2103, 0x2104, 0x2104, 0x2924, 0x2103,   // 0x10240 (66112) pixels
-0x2103, 0x2103, 0x2903, 0x2104, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103,   // 0x10250 (66128) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3,   // 0x10260 (66144) pixels
-0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x2104, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x10270 (66160) pixels
-0x2924, 0x2944, 0x2944, 0x6AEA, 0xC553, 0xC552, 0xB4F1, 0xAC8F, 0xA46F, 0xA44F, 0xA46F, 0xACAF, 0xB4D0, 0xB4F0, 0xBD11, 0xA4AF,   // 0x10280 (66176) pixels
-0x4A27, 0x2924, 0x2924, 0x2104, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2,   // 0x10290 (66192) pixels
-0x18C2, 0x0861, 0x1082, 0x0020, 0x0861, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x0881, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x102A0 (66208) pixels
-0x10A2, 0x18C3, 0x10A2, 0x10A2, 0x18A2, 0x18C3, 0x18A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861,   // 0x102B0 (66224) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1061, 0x1081, 0x1082,   // 0x102C0 (66240) pixels
-0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x102D0 (66256) pixels
-0x0861, 0x0840, 0x0840, 0x0020, 0x0020, 0x0020, 0x0841, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x102E0 (66272) pixels
-0x10A2, 0x18C2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18C2, 0x1082, 0x18C2, 0x1082, 0x18E3, 0x18C2,   // 0x102F0 (66288) pixels
-0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2924, 0x2944, 0x2104, 0x2124,   // 0x10300 (66304) pixels
-0x2124, 0x2924, 0xA44F, 0xBD12, 0xC553, 0x5227, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124,   // 0x10310 (66320) pixels
-0x2944, 0x2944, 0x2124, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2945, 0x2965, 0x2924, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3,   // 0x10320 (66336) pixels
-0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103,   // 0x10330 (66352) pixels
-0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2104, 0x2104, 0x2103, 0x2924, 0x2104, 0x2104, 0x2104, 0x2904, 0x2924,   // 0x10340 (66368) pixels
-0x2904, 0x2104, 0x2103, 0x2904, 0x2104, 0x2103, 0x2124, 0x2945, 0x2103, 0x2104, 0x2104, 0x2103, 0x2124, 0x2103, 0x2904, 0x2103,   // 0x10350 (66384) pixels
-0x2924, 0x2124, 0x2904, 0x2103, 0x2924, 0x2103, 0x2103, 0x2923, 0x2944, 0x3985, 0x2944, 0x2924, 0x2924, 0x2124, 0x2123, 0x2124,   // 0x10360 (66400) pixels
-0x2924, 0x2103, 0x3144, 0x39A6, 0x2103, 0x2124, 0x2924, 0x2123, 0x2124, 0x2124, 0x2124, 0x2103, 0x2103, 0x2124, 0x2103, 0x2924,   // 0x10370 (66416) pixels
-0x2103, 0x2104, 0x2103, 0x2103, 0x2123, 0x2104, 0x2903, 0x2924, 0x2904, 0x2124, 0x2103, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,   // 0x10380 (66432) pixels
-0x2124, 0x2904, 0x2104, 0x2103, 0x2103, 0x2103, 0x2124, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103,   // 0x10390 (66448) pixels
-0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C3,   // 0x103A0 (66464) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x2103, 0x2124, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x103B0 (66480) pixels
-0x2924, 0x2944, 0x2924, 0x6AEA, 0xBD51, 0xBD52, 0x940E, 0x49E7, 0x3165, 0x3985, 0x49E6, 0x62C9, 0x7B6B, 0xA44F, 0xB4F0, 0xBD31,   // 0x103C0 (66496) pixels
-0x8BED, 0x39A6, 0x2124, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x103D0 (66512) pixels
-0x18C2, 0x1081, 0x10A2, 0x0841, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x103E0 (66528) pixels
-0x10A2, 0x18C3, 0x10A2, 0x18A2, 0x18C2, 0x18C3, 0x18A3, 0x10A2, 0x1082, 0x0841, 0x0020, 0x0840, 0x0841, 0x0841, 0x0861, 0x0861,   // 0x103F0 (66544) pixels
-0x1061, 0x1061, 0x0861, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1082, 0x1082, 0x1082,   // 0x10400 (66560) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x10410 (66576) pixels
-0x0861, 0x0841, 0x0841, 0x0841, 0x0840, 0x0020, 0x0841, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x10420 (66592) pixels
-0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x1082, 0x1082, 0x0861, 0x18C3,   // 0x10430 (66608) pixels
-0x18C3, 0x18C2, 0x2104, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2104, 0x2103, 0x2124, 0x2924, 0x2124, 0x2924,   // 0x10440 (66624) pixels
-0x2924, 0x2944, 0x9C2F, 0xB4F1, 0xC552, 0x5227, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924,   // 0x10450 (66640) pixels
-0x3185, 0x2944, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x3165, 0x2124, 0x18C3, 0x18C2, 0x18C2, 0x18C3,   // 0x10460 (66656) pixels
-0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x10470 (66672) pixels
-0x2104, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2904, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103,   // 0x10480 (66688) pixels
-0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104, 0x2124, 0x2104, 0x2103,   // 0x10490 (66704) pixels
-0x2103, 0x2124, 0x2124, 0x2103, 0x2104, 0x2104, 0x2924, 0x2924, 0x2104, 0x2103, 0x2104, 0x2124, 0x2124, 0x2924, 0x2924, 0x2123,   // 0x104A0 (66720) pixels
-0x2124, 0x2124, 0x2104, 0x2103, 0x2104, 0x2924, 0x2103, 0x2124, 0x2104, 0x2103, 0x2124, 0x2104, 0x2103, 0x2924, 0x2924, 0x2104,   // 0x104B0 (66736) pixels
-0x2103, 0x2124, 0x2104, 0x2124, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103,   // 0x104C0 (66752) pixels
-0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x104D0 (66768) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C2,   // 0x104E0 (66784) pixels
-0x18C3, 0x18C2, 0x18C2, 0x2103, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2945, 0x2945,   // 0x104F0 (66800) pixels
-0x2944, 0x2944, 0x2944, 0x6AC9, 0xBD73, 0xBD32, 0x7B6C, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x39A5, 0xAC8F, 0xB4F1,   // 0x10500 (66816) pixels
-0xACF0, 0x7B4B, 0x2124, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x10510 (66832) pixels
-0x1082, 0x1082, 0x0841, 0x0861, 0x0861, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x10A2, 0x10A2, 0x10A2,   // 0x10520 (66848) pixels
-0x10A2, 0x18A3, 0x10C3, 0x10C3, 0x18A3, 0x10A2, 0x18C2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061,   // 0x10530 (66864) pixels
-0x1061, 0x1061, 0x0861, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x10540 (66880) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x10550 (66896) pixels
-0x0861, 0x0861, 0x0840, 0x0841, 0x0841, 0x0020, 0x0020, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2,   // 0x10560 (66912) pixels
-0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x10A2, 0x18C2, 0x1081, 0x18C2,   // 0x10570 (66928) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2924, 0x2104, 0x2124, 0x2924,   // 0x10580 (66944) pixels
-0x2944, 0x3186, 0x9C2F, 0xB4F1, 0xBD32, 0x5228, 0x2945, 0x2944, 0x2924, 0x2924, 0x2944, 0x2964, 0x2924, 0x2924, 0x2944, 0x2124,   // 0x10590 (66960) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x3144, 0x3165, 0x2124, 0x18C2, 0x18C3, 0x18C2,   // 0x105A0 (66976) pixels
-0x18C3, 0x18E3, 0x18C2, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x105B0 (66992) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103,   // 0x105C0 (67008) pixels
-0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2124, 0x2104, 0x2103, 0x2104,   // 0x105D0 (67024) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2124, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2103, 0x2104, 0x2103,   // 0x105E0 (67040) pixels
-0x2104, 0x2103, 0x2103, 0x2124, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2124, 0x2924, 0x2103,   // 0x105F0 (67056) pixels
-0x2104, 0x2904, 0x2103, 0x2103, 0x2123, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103,   // 0x10600 (67072) pixels
-0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x10610 (67088) pixels
-0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2,   // 0x10620 (67104) pixels
-0x18C2, 0x18C2, 0x18C3, 0x2124, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2924, 0x39A6, 0x2924, 0x2944, 0x2944, 0x2924, 0x3145,   // 0x10630 (67120) pixels
-0x2944, 0x2944, 0x2944, 0x6ACA, 0xBD31, 0xC552, 0x7B6C, 0x3144, 0x3144, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x838C, 0xB4F0,   // 0x10640 (67136) pixels
-0xACAF, 0x940E, 0x2924, 0x2104, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3,   // 0x10650 (67152) pixels
-0x1061, 0x10A2, 0x0840, 0x0881, 0x1061, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A3,   // 0x10660 (67168) pixels
-0x10A2, 0x10A3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0841, 0x0861, 0x1081, 0x1061, 0x1061,   // 0x10670 (67184) pixels
-0x1061, 0x1081, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1082, 0x1062,   // 0x10680 (67200) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x10690 (67216) pixels
-0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0020, 0x0020, 0x0841, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x106A0 (67232) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x0861, 0x1082, 0x1081,   // 0x106B0 (67248) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2124, 0x2924,   // 0x106C0 (67264) pixels
-0x2944, 0x2924, 0x9C2F, 0xB4F0, 0xC552, 0x5228, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2124,   // 0x106D0 (67280) pixels
-0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x3165, 0x2124, 0x18E3, 0x18C2,   // 0x106E0 (67296) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2104, 0x20E3, 0x2103,   // 0x106F0 (67312) pixels
-0x2103, 0x2103, 0x2904, 0x2924, 0x2104, 0x2103, 0x2103, 0x2103, 0x2944, 0x2904, 0x2103, 0x2104, 0x2103, 0x20E3, 0x2103, 0x2103,   // 0x10700 (67328) pixels
-0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x2104, 0x2103, 0x2103,   // 0x10710 (67344) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2104, 0x2104, 0x2103, 0x2124, 0x2104, 0x2103, 0x2124, 0x2103, 0x2103, 0x2104,   // 0x10720 (67360) pixels
-0x2924, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2903,   // 0x10730 (67376) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x10740 (67392) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3,   // 0x10750 (67408) pixels
-0x2104, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x10760 (67424) pixels
-0x18C2, 0x2103, 0x2104, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2965, 0x2944, 0x3185, 0x2924, 0x2944, 0x2944,   // 0x10770 (67440) pixels
-0x2945, 0x2924, 0x2924, 0x730A, 0xBD51, 0xBD53, 0x7B4B, 0x3144, 0x3144, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x730A, 0xB4F0,   // 0x10780 (67456) pixels
-0xAC8F, 0x93ED, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18A2,   // 0x10790 (67472) pixels
-0x1082, 0x0020, 0x0861, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x107A0 (67488) pixels
-0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x1061, 0x0000, 0x0020, 0x0840, 0x0841, 0x0861, 0x1061, 0x1081, 0x1061,   // 0x107B0 (67504) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061,   // 0x107C0 (67520) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861,   // 0x107D0 (67536) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0840, 0x0020, 0x0000, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2,   // 0x107E0 (67552) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x10A2, 0x10A2, 0x0861,   // 0x107F0 (67568) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2903,   // 0x10800 (67584) pixels
-0x3185, 0x2924, 0x9C2F, 0xB512, 0xBD31, 0x5227, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924,   // 0x10810 (67600) pixels
-0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x3165, 0x2945, 0x2924, 0x18A2,   // 0x10820 (67616) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x20E3, 0x18E3, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103,   // 0x10830 (67632) pixels
-0x2103, 0x2103, 0x2103, 0x2124, 0x2103, 0x2103, 0x2103, 0x2124, 0x2924, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0x10840 (67648) pixels
-0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0x10850 (67664) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x10860 (67680) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103,   // 0x10870 (67696) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x10880 (67712) pixels
-0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x2103,   // 0x10890 (67728) pixels
-0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x108A0 (67744) pixels
-0x18E3, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2124, 0x4A07, 0x5228, 0x3165, 0x2944, 0x2924,   // 0x108B0 (67760) pixels
-0x2924, 0x2944, 0x2944, 0x72EA, 0xC553, 0xBD53, 0x7B4B, 0x3144, 0x3144, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x8BED, 0xB4D0,   // 0x108C0 (67776) pixels
-0xA48F, 0x7B6B, 0x2104, 0x2104, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x1061,   // 0x108D0 (67792) pixels
-0x1082, 0x0840, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x108E0 (67808) pixels
-0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18C3, 0x10A2, 0x1082, 0x0861, 0x0020, 0x0020, 0x0840, 0x0841, 0x0861, 0x1061, 0x1061, 0x1061,   // 0x108F0 (67824) pixels
-0x1081, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081,   // 0x10900 (67840) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861,   // 0x10910 (67856) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0841, 0x0861, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082,   // 0x10920 (67872) pixels
-0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x1081, 0x1082,   // 0x10930 (67888) pixels
-0x18A2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2924,   // 0x10940 (67904) pixels
-0x3164, 0x2944, 0x940E, 0xB4F1, 0xBD32, 0x5228, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x10950 (67920) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x3185, 0x2124,   // 0x10960 (67936) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3,   // 0x10970 (67952) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3,   // 0x10980 (67968) pixels
-0x20E3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x20E3,   // 0x10990 (67984) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3,   // 0x109A0 (68000) pixels
-0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0x109B0 (68016) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0x109C0 (68032) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103,   // 0x109D0 (68048) pixels
-0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x2104,   // 0x109E0 (68064) pixels
-0x2124, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x109F0 (68080) pixels
-0x2944, 0x2944, 0x2924, 0x6ACA, 0xB511, 0xB511, 0x7B4B, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x39A6, 0x7B6C, 0xB4F1, 0xA46F,   // 0x10A00 (68096) pixels
-0x7B6C, 0x39A6, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18C3, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x18A2, 0x1082, 0x1081,   // 0x10A10 (68112) pixels
-0x0020, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10C2,   // 0x10A20 (68128) pixels
-0x18C3, 0x10A3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0861, 0x1061, 0x1081, 0x1081,   // 0x10A30 (68144) pixels
-0x1061, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081,   // 0x10A40 (68160) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861,   // 0x10A50 (68176) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0820, 0x0020, 0x0000, 0x0841, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x10A60 (68192) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x18A2,   // 0x10A70 (68208) pixels
-0x1061, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2124, 0x2944,   // 0x10A80 (68224) pixels
-0x2944, 0x2924, 0x940E, 0xB4F1, 0xBD32, 0x5228, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924,   // 0x10A90 (68240) pixels
-0x2924, 0x2124, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2945, 0x3185,   // 0x10AA0 (68256) pixels
-0x2124, 0x18E3, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x10AB0 (68272) pixels
-0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3,   // 0x10AC0 (68288) pixels
-0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x2104, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x20E3,   // 0x10AD0 (68304) pixels
-0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0x10AE0 (68320) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3,   // 0x10AF0 (68336) pixels
-0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3,   // 0x10B00 (68352) pixels
-0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3,   // 0x10B10 (68368) pixels
-0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x2103, 0x2944,   // 0x10B20 (68384) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x10B30 (68400) pixels
-0x2924, 0x2944, 0x2944, 0x6AEA, 0xBD52, 0xB4F1, 0x9C6F, 0x940E, 0x940E, 0x8BED, 0x8BED, 0xACB0, 0xB4F1, 0xACD0, 0x9C2F, 0x7B4B,   // 0x10B40 (68416) pixels
-0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x18C3, 0x1082, 0x10A2,   // 0x10B50 (68432) pixels
-0x0840, 0x0861, 0x1082, 0x1082, 0x1081, 0x1081, 0x0881, 0x0881, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2,   // 0x10B60 (68448) pixels
-0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0020, 0x0020, 0x0820, 0x0841, 0x0841, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x10B70 (68464) pixels
-0x1081, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1061,   // 0x10B80 (68480) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x10B90 (68496) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0820, 0x0020, 0x0020, 0x0861, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x10BA0 (68512) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x1061,   // 0x10BB0 (68528) pixels
-0x1082, 0x0861, 0x18C2, 0x18A2, 0x18C3, 0x18C2, 0x18C2, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x10BC0 (68544) pixels
-0x2924, 0x2924, 0x93EE, 0xB4F1, 0xBD32, 0x5227, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924,   // 0x10BD0 (68560) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2965,   // 0x10BE0 (68576) pixels
-0x3165, 0x2924, 0x18C3, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18E3,   // 0x10BF0 (68592) pixels
-0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x18E2, 0x20E3, 0x18E3, 0x18E3,   // 0x10C00 (68608) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x18C3,   // 0x10C10 (68624) pixels
-0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3,   // 0x10C20 (68640) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x18E2, 0x18C3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E2, 0x18E3, 0x18E3, 0x18E3,   // 0x10C30 (68656) pixels
-0x20E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x18E3, 0x18E3, 0x18C2, 0x18E2,   // 0x10C40 (68672) pixels
-0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18C2, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x18C2,   // 0x10C50 (68688) pixels
-0x18E2, 0x18C3, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x2103, 0x2124, 0x2944,   // 0x10C60 (68704) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x10C70 (68720) pixels
-0x2944, 0x2944, 0x2924, 0x6AEA, 0xB511, 0xB511, 0xBD52, 0xBD53, 0xBD52, 0xBD32, 0xBD52, 0xB4F1, 0xACD0, 0x942E, 0x4A27, 0x3144,   // 0x10C80 (68736) pixels
-0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x1081, 0x1082, 0x1061,   // 0x10C90 (68752) pixels
-0x0861, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x0881, 0x0881, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x10CA0 (68768) pixels
-0x10A2, 0x10A2, 0x10C3, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0840, 0x0841, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x0861,   // 0x10CB0 (68784) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1061,   // 0x10CC0 (68800) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x10CD0 (68816) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0020, 0x0000, 0x0841, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x10CE0 (68832) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18C3, 0x18C2, 0x10A2,   // 0x10CF0 (68848) pixels
-0x18A2, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2124,   // 0x10D00 (68864) pixels
-0x2924, 0x2924, 0x93EE, 0xB4F1, 0xBD11, 0x5207, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124,   // 0x10D10 (68880) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924,   // 0x10D20 (68896) pixels
-0x2944, 0x3185, 0x2924, 0x18C3, 0x18A2, 0x18C2, 0x18E3, 0x18C3, 0x2924, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x10D30 (68912) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3,   // 0x10D40 (68928) pixels
-0x18C3, 0x18C3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x20E3, 0x18C3, 0x18C3, 0x18C3,   // 0x10D50 (68944) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18E3, 0x18C2, 0x18E3,   // 0x10D60 (68960) pixels
-0x18C3, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18E3,   // 0x10D70 (68976) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0x10D80 (68992) pixels
-0x18C2, 0x18C3, 0x20E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3,   // 0x10D90 (69008) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18C2, 0x2103, 0x2944, 0x2944, 0x2944,   // 0x10DA0 (69024) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x10DB0 (69040) pixels
-0x2924, 0x2944, 0x2944, 0x6AC9, 0xB510, 0xB512, 0x838C, 0x4A07, 0x4A07, 0x5227, 0x6289, 0x9C2E, 0xA48F, 0xB4B0, 0x9C2F, 0x5A88,   // 0x10DC0 (69056) pixels
-0x2924, 0x2103, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x1082, 0x1081, 0x1081, 0x0861,   // 0x10DD0 (69072) pixels
-0x0861, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2,   // 0x10DE0 (69088) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0882, 0x0841, 0x0020, 0x0020, 0x0841, 0x0861, 0x1061, 0x1082, 0x1082, 0x1061, 0x1061, 0x1081,   // 0x10DF0 (69104) pixels
-0x0861, 0x1061, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x10E00 (69120) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x10E10 (69136) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0020, 0x0020, 0x0841, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x10E20 (69152) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x10A2,   // 0x10E30 (69168) pixels
-0x10A2, 0x18C2, 0x0861, 0x18C2, 0x18A2, 0x18C2, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x2104, 0x2944, 0x2103, 0x2103, 0x2103,   // 0x10E40 (69184) pixels
-0x2103, 0x2924, 0x93EE, 0xACB0, 0xBD11, 0x5227, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x10E50 (69200) pixels
-0x2924, 0x2904, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x10E60 (69216) pixels
-0x2944, 0x3165, 0x3185, 0x2924, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2,   // 0x10E70 (69232) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x20E3,   // 0x10E80 (69248) pixels
-0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x20E3, 0x18C3, 0x18C3, 0x18C2,   // 0x10E90 (69264) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2,   // 0x10EA0 (69280) pixels
-0x18C2, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x10EB0 (69296) pixels
-0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18C3,   // 0x10EC0 (69312) pixels
-0x18C2, 0x18C3, 0x20E3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0x10ED0 (69328) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x18E3, 0x2124, 0x2965, 0x2944, 0x2924,   // 0x10EE0 (69344) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x10EF0 (69360) pixels
-0x2924, 0x2924, 0x2924, 0x6AEA, 0xB510, 0xB511, 0x732B, 0x2944, 0x2924, 0x2924, 0x2944, 0x39A5, 0x62A9, 0xAC8F, 0xACB0, 0x940E,   // 0x10F00 (69376) pixels
-0x3165, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x1082, 0x1081, 0x0840, 0x0861,   // 0x10F10 (69392) pixels
-0x0881, 0x1081, 0x1082, 0x1082, 0x1082, 0x0881, 0x1082, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10C2, 0x10A2, 0x10A2,   // 0x10F20 (69408) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0020, 0x0861, 0x0861, 0x1061, 0x1061, 0x1082, 0x1061, 0x1061, 0x1081,   // 0x10F30 (69424) pixels
-0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x10F40 (69440) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x10F50 (69456) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0040, 0x0020, 0x0000, 0x0841, 0x10A2, 0x10A2, 0x1082, 0x10A2,   // 0x10F60 (69472) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0x10F70 (69488) pixels
-0x18C2, 0x1082, 0x1082, 0x1061, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x2103, 0x2124, 0x2103, 0x2103,   // 0x10F80 (69504) pixels
-0x2924, 0x2924, 0x93EE, 0xACB0, 0xB4F1, 0x4A27, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x10F90 (69520) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2923, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124,   // 0x10FA0 (69536) pixels
-0x2124, 0x2944, 0x2944, 0x3165, 0x2924, 0x18C3, 0x18A2, 0x18A2, 0x18C2, 0x18C2, 0x10A2, 0x18A2, 0x18A2, 0x18C2, 0x18C2, 0x18C2,   // 0x10FB0 (69552) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2,   // 0x10FC0 (69568) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0x10FD0 (69584) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3,   // 0x10FE0 (69600) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18C2, 0x18C2, 0x18E3, 0x18C3, 0x18C2,   // 0x10FF0 (69616) pixels
-0x18C3, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2,   // 0x11000 (69632) pixels
-0x18C2, 0x18A2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x11010 (69648) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x2103, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x11020 (69664) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2124, 0x2924, 0x2944, 0x2944, 0x2124, 0x2924, 0x2944,   // 0x11030 (69680) pixels
-0x2924, 0x2944, 0x2924, 0x730A, 0xACF0, 0xB4F1, 0x6B0A, 0x2924, 0x2924, 0x2945, 0x2944, 0x2124, 0x2924, 0x7B4B, 0x9C2E, 0x9C2F,   // 0x11040 (69696) pixels
-0x62A9, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x1081, 0x1082, 0x0020, 0x0861, 0x1082,   // 0x11050 (69712) pixels
-0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x0881, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A3,   // 0x11060 (69728) pixels
-0x10C2, 0x10A2, 0x10A2, 0x1082, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1061, 0x1061, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x11070 (69744) pixels
-0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x0881, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1082,   // 0x11080 (69760) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x11090 (69776) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0000, 0x0000, 0x0861, 0x1082, 0x1082, 0x10A2,   // 0x110A0 (69792) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C3,   // 0x110B0 (69808) pixels
-0x18E2, 0x18A2, 0x1081, 0x1082, 0x1081, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0x110C0 (69824) pixels
-0x2103, 0x2924, 0x83CD, 0xA46F, 0xB4F1, 0x62A9, 0x39C6, 0x39C6, 0x41C6, 0x39C6, 0x41C6, 0x41C6, 0x41C6, 0x41C6, 0x41C6, 0x2944,   // 0x110D0 (69840) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2923, 0x2924, 0x2924, 0x2904, 0x2924, 0x2924,   // 0x110E0 (69856) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x31A6, 0x2965, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x110F0 (69872) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2124, 0x2924, 0x2124,   // 0x11100 (69888) pixels
-0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x11110 (69904) pixels
-0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124,   // 0x11120 (69920) pixels
-0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x11130 (69936) pixels
-0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2124,   // 0x11140 (69952) pixels
-0x2124, 0x2924, 0x2124, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2124,   // 0x11150 (69968) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x11160 (69984) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x11170 (70000) pixels
-0x2924, 0x2924, 0x2924, 0x6AEA, 0xB510, 0xB4F1, 0x6B0A, 0x2924, 0x2924, 0x2124, 0x2124, 0x2103, 0x2124, 0x41E6, 0x9C2E, 0x9C2E,   // 0x11180 (70016) pixels
-0x838C, 0x3165, 0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18A2, 0x18C2, 0x1061, 0x1081, 0x0841, 0x0841, 0x0881, 0x1082,   // 0x11190 (70032) pixels
-0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2,   // 0x111A0 (70048) pixels
-0x18C2, 0x18C2, 0x10A2, 0x1082, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x1082, 0x1061, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x111B0 (70064) pixels
-0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x0861, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1082, 0x1081, 0x1062,   // 0x111C0 (70080) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x111D0 (70096) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0840, 0x0020, 0x0000, 0x0000, 0x0040, 0x0861, 0x1082, 0x10A2,   // 0x111E0 (70112) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x10C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18E3,   // 0x111F0 (70128) pixels
-0x18C3, 0x18C2, 0x10A2, 0x18E3, 0x1082, 0x18C2, 0x18A2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3,   // 0x11200 (70144) pixels
-0x2103, 0x2924, 0x83AD, 0xA48F, 0xACD0, 0x9C2F, 0x83CD, 0x8BED, 0x93EE, 0x93ED, 0x940E, 0x940E, 0x940E, 0x940E, 0x93EE, 0x41C6,   // 0x11210 (70160) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944,   // 0x11220 (70176) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x3165, 0x3185, 0x3185, 0x3185, 0x3186, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185, 0x3185,   // 0x11230 (70192) pixels
-0x3185, 0x3185, 0x3185, 0x39A6, 0x3186, 0x3985, 0x39A6, 0x3185, 0x3986, 0x3985, 0x3185, 0x31A6, 0x31A5, 0x31A5, 0x3185, 0x3985,   // 0x11240 (70208) pixels
-0x39A5, 0x39A6, 0x3186, 0x39A6, 0x3985, 0x3985, 0x39A6, 0x39A6, 0x39A5, 0x39A6, 0x39A6, 0x39A6, 0x39A5, 0x39A6, 0x39C6, 0x41E7,   // 0x11250 (70224) pixels
-0x39A5, 0x31A5, 0x31A5, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x31A5, 0x39A6, 0x39A6, 0x39A6, 0x39A5, 0x39A5, 0x39C6, 0x39A5, 0x39A6,   // 0x11260 (70240) pixels
-0x31A6, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x39A5, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x39A6,   // 0x11270 (70256) pixels
-0x39A6, 0x39A6, 0x39A6, 0x31A6, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x3185, 0x39A6, 0x31A5, 0x39A6, 0x39A6, 0x39A6, 0x39A6,   // 0x11280 (70272) pixels
-0x3185, 0x3185, 0x39A6, 0x39A5, 0x39A6, 0x31A6, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x39A6, 0x3985, 0x3185, 0x31A6, 0x3185, 0x3186,   // 0x11290 (70288) pixels
-0x31A5, 0x39A6, 0x3186, 0x3185, 0x3185, 0x3185, 0x31A6, 0x39A5, 0x3985, 0x3165, 0x3165, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x112A0 (70304) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2124, 0x2924, 0x2944,   // 0x112B0 (70320) pixels
-0x2944, 0x2924, 0x2944, 0x730A, 0xB511, 0xB4F1, 0x6AEA, 0x2924, 0x2924, 0x2123, 0x2124, 0x2103, 0x2104, 0x3144, 0x93EE, 0x940E,   // 0x112C0 (70336) pixels
-0x8BCD, 0x4A07, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x1082, 0x10A2, 0x0861, 0x0861, 0x1082, 0x1082,   // 0x112D0 (70352) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10C2, 0x10A2, 0x18A2, 0x18A2, 0x18C3,   // 0x112E0 (70368) pixels
-0x18C2, 0x18A2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0820, 0x0841, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081,   // 0x112F0 (70384) pixels
-0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1061,   // 0x11300 (70400) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x11310 (70416) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x10A2,   // 0x11320 (70432) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10A3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x11330 (70448) pixels
-0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x1081, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x2103,   // 0x11340 (70464) pixels
-0x2103, 0x2103, 0x7B6C, 0x940E, 0x940E, 0x9C4F, 0x9C4F, 0xA46F, 0xA46F, 0xA48F, 0xA46F, 0xA48F, 0xACAF, 0xA490, 0xACB0, 0x41E6,   // 0x11350 (70480) pixels
-0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x11360 (70496) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x3165, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944,   // 0x11370 (70512) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x11380 (70528) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3185, 0x2944,   // 0x11390 (70544) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x41E7, 0x3185, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x113A0 (70560) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x113B0 (70576) pixels
-0x2944, 0x2924, 0x2924, 0x2945, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x113C0 (70592) pixels
-0x2944, 0x2924, 0x2124, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x3186,   // 0x113D0 (70608) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2124, 0x2945, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924,   // 0x113E0 (70624) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x113F0 (70640) pixels
-0x2924, 0x2944, 0x2924, 0x730A, 0xB4F1, 0xB4F1, 0x62C9, 0x2924, 0x2924, 0x2124, 0x2904, 0x2904, 0x2103, 0x2103, 0x7B4B, 0x940F,   // 0x11400 (70656) pixels
-0x93EE, 0x6AEA, 0x20E3, 0x20E3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18A2, 0x1061, 0x10A2, 0x0861, 0x1081, 0x1081, 0x1082, 0x1082,   // 0x11410 (70672) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x18C2,   // 0x11420 (70688) pixels
-0x18C3, 0x18C2, 0x1061, 0x0000, 0x0020, 0x0820, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082,   // 0x11430 (70704) pixels
-0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x0881, 0x1081, 0x1081, 0x1061, 0x1082, 0x1061, 0x1081, 0x1082,   // 0x11440 (70720) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x11450 (70736) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0041, 0x0881, 0x1082,   // 0x11460 (70752) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18E3,   // 0x11470 (70768) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x1082, 0x18A2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3,   // 0x11480 (70784) pixels
-0x2103, 0x2103, 0x5227, 0x5A89, 0x62A9, 0x62C9, 0x6AEA, 0x6AEA, 0x6AEA, 0x6AEA, 0x6AEA, 0x6B0A, 0x6B0A, 0x6B0A, 0x6B0A, 0x3985,   // 0x11490 (70800) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x114A0 (70816) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x114B0 (70832) pixels
-0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x114C0 (70848) pixels
-0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3145, 0x3165, 0x2944, 0x39A5, 0x3144,   // 0x114D0 (70864) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2945, 0x2944, 0x2924, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944,   // 0x114E0 (70880) pixels
-0x2944, 0x2944, 0x3145, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x114F0 (70896) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2945,   // 0x11500 (70912) pixels
-0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3185,   // 0x11510 (70928) pixels
-0x2924, 0x2944, 0x2945, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2945, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x11520 (70944) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x11530 (70960) pixels
-0x2924, 0x2924, 0x2924, 0x730A, 0xACCF, 0xACB0, 0x62A9, 0x2924, 0x2924, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x62A9, 0x8BEE,   // 0x11540 (70976) pixels
-0x8BCD, 0x7B6C, 0x2103, 0x20E3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x1082, 0x0861, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x11550 (70992) pixels
-0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x18A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x11560 (71008) pixels
-0x18C3, 0x1082, 0x0861, 0x0020, 0x0020, 0x0820, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081,   // 0x11570 (71024) pixels
-0x1081, 0x1081, 0x1082, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x0881, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081,   // 0x11580 (71040) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x11590 (71056) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0840, 0x0040, 0x0020, 0x0000, 0x0841, 0x0861, 0x0882,   // 0x115A0 (71072) pixels
-0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18C3,   // 0x115B0 (71088) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x10A2, 0x10A2, 0x1081, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3,   // 0x115C0 (71104) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2904, 0x2904, 0x2903, 0x2904, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924,   // 0x115D0 (71120) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x3165, 0x2945, 0x2924, 0x2124, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x115E0 (71136) pixels
-0x2124, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x115F0 (71152) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2945, 0x2945, 0x2945, 0x2944, 0x2944,   // 0x11600 (71168) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x3164, 0x3144,   // 0x11610 (71184) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2945, 0x2944, 0x3144, 0x2924, 0x3165, 0x2944, 0x3144, 0x2944,   // 0x11620 (71200) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2945, 0x2944, 0x2944, 0x2944,   // 0x11630 (71216) pixels
-0x2944, 0x2944, 0x2944, 0x2945, 0x2965, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x3144, 0x2944,   // 0x11640 (71232) pixels
-0x3165, 0x3164, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x11650 (71248) pixels
-0x2944, 0x2944, 0x2944, 0x2945, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2945,   // 0x11660 (71264) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x3165, 0x3145, 0x2944, 0x2924, 0x2924, 0x2924,   // 0x11670 (71280) pixels
-0x2924, 0x2924, 0x2924, 0x62A9, 0xAC8F, 0xA48F, 0x62A9, 0x2904, 0x2924, 0x2124, 0x2103, 0x2103, 0x2103, 0x2104, 0x3985, 0x6AEA,   // 0x11680 (71296) pixels
-0x838D, 0x7B6C, 0x3164, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1081, 0x1082, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x11690 (71312) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x18A2, 0x18A2, 0x18C2, 0x18A2, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2,   // 0x116A0 (71328) pixels
-0x18A2, 0x0861, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x0881, 0x1081, 0x1082, 0x1061, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x116B0 (71344) pixels
-0x1082, 0x1061, 0x1081, 0x1082, 0x1081, 0x1061, 0x0861, 0x1081, 0x1081, 0x0881, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x116C0 (71360) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x116D0 (71376) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0820, 0x0020, 0x0000, 0x0000, 0x0861, 0x0881,   // 0x116E0 (71392) pixels
-0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2,   // 0x116F0 (71408) pixels
-0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x1082, 0x1082, 0x1061, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3,   // 0x11700 (71424) pixels
-0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2124, 0x2904, 0x2103, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124,   // 0x11710 (71440) pixels
-0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2944, 0x2944, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x3144, 0x2924,   // 0x11720 (71456) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0x11730 (71472) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2964, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924,   // 0x11740 (71488) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2944, 0x2945, 0x2944, 0x2944,   // 0x11750 (71504) pixels
-0x2924, 0x2944, 0x2964, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x11760 (71520) pixels
-0x2944, 0x2945, 0x2944, 0x2964, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x11770 (71536) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2924, 0x2924, 0x2924,   // 0x11780 (71552) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924,   // 0x11790 (71568) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2124, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x117A0 (71584) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x3165, 0x2944, 0x2964, 0x2124, 0x2124, 0x2924,   // 0x117B0 (71600) pixels
-0x2124, 0x2924, 0x2924, 0x3164, 0x41C6, 0x41A6, 0x3145, 0x2103, 0x2124, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2924,   // 0x117C0 (71616) pixels
-0x3165, 0x3165, 0x20E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x1061, 0x1081, 0x0840, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x117D0 (71632) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x18A2, 0x10A2, 0x18C2, 0x10A2, 0x18C3, 0x18A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10C2,   // 0x117E0 (71648) pixels
-0x10A2, 0x0841, 0x0000, 0x0020, 0x0820, 0x0841, 0x0861, 0x0881, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1082, 0x1081, 0x1081,   // 0x117F0 (71664) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1082, 0x1081,   // 0x11800 (71680) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x11810 (71696) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0820, 0x0020, 0x0000, 0x0020, 0x0861,   // 0x11820 (71712) pixels
-0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2,   // 0x11830 (71728) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x1081, 0x1081, 0x18A2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x20E3,   // 0x11840 (71744) pixels
-0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2924, 0x3165, 0x41E7, 0x3165, 0x2104, 0x2124, 0x2924,   // 0x11850 (71760) pixels
-0x2924, 0x2924, 0x2904, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x11860 (71776) pixels
-0x2124, 0x2944, 0x2924, 0x2944, 0x2944, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944,   // 0x11870 (71792) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x11880 (71808) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2924, 0x2944, 0x2944,   // 0x11890 (71824) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x118A0 (71840) pixels
-0x3165, 0x2944, 0x2944, 0x3144, 0x3164, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x118B0 (71856) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x39A6, 0x39A5, 0x2944, 0x2944, 0x2944, 0x3165, 0x3985,   // 0x118C0 (71872) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x118D0 (71888) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x41E7, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x118E0 (71904) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x3185, 0x3185, 0x2924, 0x2124, 0x2124, 0x2124,   // 0x118F0 (71920) pixels
-0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3,   // 0x11900 (71936) pixels
-0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x10A2, 0x1081, 0x10A2, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x11910 (71952) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x18A2, 0x10A2, 0x18C3, 0x18A2, 0x18A2, 0x18A2, 0x10A2, 0x10C2, 0x18A2, 0x10A2, 0x10A2, 0x18A2,   // 0x11920 (71968) pixels
-0x1081, 0x0000, 0x0000, 0x0020, 0x0840, 0x0841, 0x0861, 0x0881, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x11930 (71984) pixels
-0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1061, 0x1081, 0x1061,   // 0x11940 (72000) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x11950 (72016) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0000, 0x0000, 0x0020,   // 0x11960 (72032) pixels
-0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2,   // 0x11970 (72048) pixels
-0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C2, 0x10A2, 0x18E3, 0x1082, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3,   // 0x11980 (72064) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2924, 0x2103, 0x2103, 0x2924, 0x2904, 0x2944, 0x3185, 0x2944, 0x2124, 0x2124,   // 0x11990 (72080) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924,   // 0x119A0 (72096) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x3165, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x119B0 (72112) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x119C0 (72128) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944,   // 0x119D0 (72144) pixels
-0x3165, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2945, 0x2944, 0x2945, 0x2945,   // 0x119E0 (72160) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x3165, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x119F0 (72176) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x11A00 (72192) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x11A10 (72208) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2945, 0x3185, 0x2924,   // 0x11A20 (72224) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x41E7, 0x3185, 0x2944, 0x2924, 0x2124, 0x2924,   // 0x11A30 (72240) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2944, 0x2924, 0x2104, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3,   // 0x11A40 (72256) pixels
-0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x1082, 0x1082, 0x10A2, 0x0861, 0x0881, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x11A50 (72272) pixels
-0x1081, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18A2, 0x18C2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861,   // 0x11A60 (72288) pixels
-0x0841, 0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0881, 0x0881, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x11A70 (72304) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081, 0x1061, 0x1081,   // 0x11A80 (72320) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x11A90 (72336) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020,   // 0x11AA0 (72352) pixels
-0x0041, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x11AB0 (72368) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C2, 0x1081, 0x10A2, 0x1061, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2,   // 0x11AC0 (72384) pixels
-0x18E3, 0x18E3, 0x2103, 0x20E3, 0x20E3, 0x2924, 0x3185, 0x2103, 0x2103, 0x2103, 0x2903, 0x2103, 0x2924, 0x2124, 0x2924, 0x2123,   // 0x11AD0 (72400) pixels
-0x2123, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x3144, 0x3144,   // 0x11AE0 (72416) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x11AF0 (72432) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x11B00 (72448) pixels
-0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924,   // 0x11B10 (72464) pixels
-0x3986, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2965,   // 0x11B20 (72480) pixels
-0x2964, 0x2945, 0x3145, 0x3144, 0x2944, 0x2964, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2924,   // 0x11B30 (72496) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944,   // 0x11B40 (72512) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944,   // 0x11B50 (72528) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x39C6, 0x2945,   // 0x11B60 (72544) pixels
-0x2945, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2945, 0x2944, 0x2124, 0x2944, 0x2945, 0x3144, 0x3164, 0x2924, 0x2124, 0x2124,   // 0x11B70 (72560) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2104, 0x2124, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3,   // 0x11B80 (72576) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x1081, 0x1082, 0x0841, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x11B90 (72592) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0841,   // 0x11BA0 (72608) pixels
-0x0000, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x0881, 0x1061, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081,   // 0x11BB0 (72624) pixels
-0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1061,   // 0x11BC0 (72640) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x11BD0 (72656) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000,   // 0x11BE0 (72672) pixels
-0x0020, 0x0861, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x18C2, 0x18C3,   // 0x11BF0 (72688) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x0861, 0x1081, 0x1061, 0x18C2, 0x18A2, 0x18C3, 0x18C3, 0x18C2,   // 0x11C00 (72704) pixels
-0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2903, 0x2103, 0x2924, 0x2124, 0x2103, 0x2124,   // 0x11C10 (72720) pixels
-0x2124, 0x2104, 0x2123, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x3144, 0x41E7, 0x5247, 0x3985,   // 0x11C20 (72736) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x3124, 0x2924, 0x2944, 0x2924,   // 0x11C30 (72752) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x11C40 (72768) pixels
-0x2945, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x11C50 (72784) pixels
-0x2944, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2945,   // 0x11C60 (72800) pixels
-0x2945, 0x3145, 0x2964, 0x2944, 0x2944, 0x3144, 0x2944, 0x2945, 0x2945, 0x2944, 0x2944, 0x2945, 0x3145, 0x2944, 0x2944, 0x2944,   // 0x11C70 (72816) pixels
-0x3164, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x11C80 (72832) pixels
-0x2924, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944,   // 0x11C90 (72848) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x3145, 0x2944, 0x2944, 0x3165,   // 0x11CA0 (72864) pixels
-0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2104,   // 0x11CB0 (72880) pixels
-0x2944, 0x2924, 0x2924, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C2,   // 0x11CC0 (72896) pixels
-0x18C2, 0x18C2, 0x20E3, 0x20E3, 0x1061, 0x1082, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x11CD0 (72912) pixels
-0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x0861, 0x0000,   // 0x11CE0 (72928) pixels
-0x0000, 0x0020, 0x0020, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081,   // 0x11CF0 (72944) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1061,   // 0x11D00 (72960) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x11D10 (72976) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000,   // 0x11D20 (72992) pixels
-0x0000, 0x0841, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x20E4, 0x18E3, 0x18C2, 0x18C2, 0x18C3,   // 0x11D30 (73008) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x10A2, 0x18A2, 0x1082, 0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x11D40 (73024) pixels
-0x18E3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2123, 0x2124, 0x2123,   // 0x11D50 (73040) pixels
-0x2124, 0x2124, 0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2945, 0x3164, 0x4A27, 0x39C6,   // 0x11D60 (73056) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x11D70 (73072) pixels
-0x2924, 0x2944, 0x2944, 0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x11D80 (73088) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2945, 0x3164, 0x2944, 0x2944, 0x2924, 0x3165,   // 0x11D90 (73104) pixels
-0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944,   // 0x11DA0 (73120) pixels
-0x2944, 0x2945, 0x2945, 0x2944, 0x2944, 0x3145, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x11DB0 (73136) pixels
-0x3165, 0x3164, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x11DC0 (73152) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x11DD0 (73168) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x39A6, 0x3165, 0x2944, 0x2944,   // 0x11DE0 (73184) pixels
-0x2124, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2104,   // 0x11DF0 (73200) pixels
-0x2124, 0x2924, 0x2924, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18C3, 0x18C3,   // 0x11E00 (73216) pixels
-0x18C2, 0x18C2, 0x18C3, 0x1082, 0x1081, 0x10A2, 0x0841, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x11E10 (73232) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x18A2, 0x18C2, 0x10A2, 0x10A2, 0x0861, 0x0041, 0x0000,   // 0x11E20 (73248) pixels
-0x0000, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081,   // 0x11E30 (73264) pixels
-0x1061, 0x1081, 0x1082, 0x1081, 0x1061, 0x1082, 0x1061, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1061, 0x1082, 0x1081, 0x1081,   // 0x11E40 (73280) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x11E50 (73296) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020,   // 0x11E60 (73312) pixels
-0x0000, 0x0000, 0x0841, 0x1082, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x2104, 0x2965, 0x2124, 0x10A2, 0x18C2, 0x18C2,   // 0x11E70 (73328) pixels
-0x18C3, 0x18E3, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18C3, 0x1082, 0x18A2, 0x1081, 0x1081, 0x18A2, 0x18C2, 0x18C2,   // 0x11E80 (73344) pixels
-0x18C2, 0x18C2, 0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2904, 0x2103, 0x2104,   // 0x11E90 (73360) pixels
-0x2904, 0x2924, 0x2104, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x11EA0 (73376) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2124, 0x2924, 0x2944, 0x2924, 0x2944, 0x2124, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x11EB0 (73392) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x11EC0 (73408) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x3144, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2945,   // 0x11ED0 (73424) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944,   // 0x11EE0 (73440) pixels
-0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x3165, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x11EF0 (73456) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x3145, 0x39A6, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x11F00 (73472) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0x11F10 (73488) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924,   // 0x11F20 (73504) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124,   // 0x11F30 (73520) pixels
-0x2124, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3,   // 0x11F40 (73536) pixels
-0x18C2, 0x18C2, 0x10A2, 0x1082, 0x10A2, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x11F50 (73552) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0881, 0x0020, 0x0000, 0x0000,   // 0x11F60 (73568) pixels
-0x0020, 0x0840, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081,   // 0x11F70 (73584) pixels
-0x1081, 0x1061, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1061, 0x1082, 0x1081, 0x1082, 0x1061, 0x1061,   // 0x11F80 (73600) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861,   // 0x11F90 (73616) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020,   // 0x11FA0 (73632) pixels
-0x0020, 0x0000, 0x0020, 0x0861, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x10C3, 0x18E3, 0x2104, 0x2124, 0x18E3, 0x10A2, 0x10A2, 0x18C3,   // 0x11FB0 (73648) pixels
-0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18C2, 0x10A2, 0x18C2, 0x1082, 0x10A2, 0x18C2, 0x18C3,   // 0x11FC0 (73664) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x11FD0 (73680) pixels
-0x2104, 0x2124, 0x2103, 0x2103, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x11FE0 (73696) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x11FF0 (73712) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924,   // 0x12000 (73728) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x12010 (73744) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x12020 (73760) pixels
-0x3144, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2945, 0x2944, 0x2945, 0x2945, 0x2944, 0x2964, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x12030 (73776) pixels
-0x2944, 0x2944, 0x2944, 0x3144, 0x2924, 0x2944, 0x2944, 0x3144, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x12040 (73792) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x12050 (73808) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x12060 (73824) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124,   // 0x12070 (73840) pixels
-0x2103, 0x2103, 0x2924, 0x2924, 0x20E3, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E2, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0x12080 (73856) pixels
-0x18A2, 0x18A2, 0x1082, 0x1082, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x12090 (73872) pixels
-0x10A3, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0840, 0x0000, 0x0000, 0x0020,   // 0x120A0 (73888) pixels
-0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x0861, 0x0881, 0x1081, 0x1061, 0x1061, 0x1081, 0x1082, 0x1082, 0x1081,   // 0x120B0 (73904) pixels
-0x1061, 0x1082, 0x1082, 0x1081, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1061, 0x1081, 0x0881, 0x0881, 0x1081, 0x0881,   // 0x120C0 (73920) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061,   // 0x120D0 (73936) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020,   // 0x120E0 (73952) pixels
-0x0020, 0x0000, 0x0000, 0x0841, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x2104, 0x18E4, 0x18C3, 0x10A2, 0x10A2, 0x1082, 0x18C3,   // 0x120F0 (73968) pixels
-0x10C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x10A2, 0x18C3, 0x1081, 0x18C3, 0x18C2,   // 0x12100 (73984) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104,   // 0x12110 (74000) pixels
-0x2103, 0x2103, 0x2924, 0x2104, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x12120 (74016) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x12130 (74032) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944,   // 0x12140 (74048) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x12150 (74064) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2945, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x12160 (74080) pixels
-0x3165, 0x3144, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2945, 0x3144, 0x2944, 0x2965, 0x2944, 0x2964, 0x2945,   // 0x12170 (74096) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x12180 (74112) pixels
-0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x12190 (74128) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x121A0 (74144) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2923, 0x2124, 0x2103, 0x2103, 0x2104, 0x2104,   // 0x121B0 (74160) pixels
-0x2103, 0x2104, 0x3165, 0x39A6, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18A2,   // 0x121C0 (74176) pixels
-0x18C2, 0x1081, 0x1082, 0x0861, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x121D0 (74192) pixels
-0x10A2, 0x10A3, 0x10A2, 0x18C2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x0000, 0x0000, 0x0020,   // 0x121E0 (74208) pixels
-0x0840, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1062, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1061, 0x1061, 0x1061,   // 0x121F0 (74224) pixels
-0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x0881, 0x0861, 0x1061, 0x1061,   // 0x12200 (74240) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1062, 0x1081, 0x1082, 0x1082, 0x1082, 0x1062,   // 0x12210 (74256) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841,   // 0x12220 (74272) pixels
-0x0020, 0x0020, 0x0000, 0x0000, 0x0861, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082,   // 0x12230 (74288) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x10A2, 0x18C2, 0x1081, 0x18C2,   // 0x12240 (74304) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104,   // 0x12250 (74320) pixels
-0x2103, 0x2104, 0x2103, 0x2123, 0x2924, 0x2904, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x12260 (74336) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x12270 (74352) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2945, 0x39A6, 0x3185, 0x39A6, 0x2924, 0x2924, 0x2944,   // 0x12280 (74368) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x12290 (74384) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x122A0 (74400) pixels
-0x2944, 0x3145, 0x3144, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2964, 0x2944, 0x2944, 0x2945,   // 0x122B0 (74416) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x122C0 (74432) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x122D0 (74448) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x122E0 (74464) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2123, 0x2124, 0x2124, 0x2104, 0x2103,   // 0x122F0 (74480) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x2924, 0x20E3, 0x20E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0x12300 (74496) pixels
-0x1081, 0x1082, 0x0841, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x12310 (74512) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x0861, 0x0841, 0x0000, 0x0000, 0x0020, 0x0840,   // 0x12320 (74528) pixels
-0x0841, 0x0861, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061, 0x1082, 0x1082, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1062, 0x1082,   // 0x12330 (74544) pixels
-0x1061, 0x1061, 0x1081, 0x1082, 0x1081, 0x1061, 0x1082, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061, 0x0861,   // 0x12340 (74560) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061,   // 0x12350 (74576) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841,   // 0x12360 (74592) pixels
-0x0840, 0x0020, 0x0020, 0x0000, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x12370 (74608) pixels
-0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18A2, 0x1082, 0x1082, 0x1061,   // 0x12380 (74624) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x12390 (74640) pixels
-0x2103, 0x2104, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944,   // 0x123A0 (74656) pixels
-0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2124, 0x2965, 0x2124, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x123B0 (74672) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2945, 0x41E7, 0x3164, 0x3165, 0x2944, 0x2944, 0x2924,   // 0x123C0 (74688) pixels
-0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x123D0 (74704) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2945, 0x2944,   // 0x123E0 (74720) pixels
-0x2944, 0x3145, 0x3164, 0x2944, 0x2944, 0x3164, 0x2944, 0x2944, 0x2945, 0x2944, 0x3164, 0x3164, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x123F0 (74736) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x12400 (74752) pixels
-0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x3165, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x12410 (74768) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x12420 (74784) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2123, 0x2124, 0x2924, 0x2124, 0x2124, 0x2103, 0x2104,   // 0x12430 (74800) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2924, 0x20E3, 0x20E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x0861,   // 0x12440 (74816) pixels
-0x1082, 0x1082, 0x1061, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082,   // 0x12450 (74832) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x0000, 0x0020, 0x0020, 0x0841,   // 0x12460 (74848) pixels
-0x0861, 0x1061, 0x1082, 0x1061, 0x1081, 0x1061, 0x1082, 0x1082, 0x1061, 0x1061, 0x1081, 0x1061, 0x1082, 0x1082, 0x1061, 0x1082,   // 0x12470 (74864) pixels
-0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1061, 0x1081, 0x1081, 0x1061, 0x1082, 0x1082, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081,   // 0x12480 (74880) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1062, 0x1082, 0x1061, 0x1061, 0x1062, 0x1061, 0x0861, 0x0861,   // 0x12490 (74896) pixels
-0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841,   // 0x124A0 (74912) pixels
-0x0841, 0x0840, 0x0020, 0x0000, 0x0000, 0x0861, 0x0882, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082,   // 0x124B0 (74928) pixels
-0x1082, 0x10C2, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18A2, 0x10A2,   // 0x124C0 (74944) pixels
-0x0861, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x124D0 (74960) pixels
-0x2104, 0x2104, 0x2103, 0x2103, 0x2124, 0x2124, 0x2103, 0x2124, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944,   // 0x124E0 (74976) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x3165, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x124F0 (74992) pixels
-0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2124, 0x2945, 0x2124, 0x2924, 0x3165, 0x2944, 0x2964,   // 0x12500 (75008) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x12510 (75024) pixels
-0x2945, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x12520 (75040) pixels
-0x2944, 0x2964, 0x3144, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x3145, 0x2944, 0x2944, 0x2945, 0x2944, 0x2924,   // 0x12530 (75056) pixels
-0x3145, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2964, 0x2924,   // 0x12540 (75072) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x12550 (75088) pixels
-0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x12560 (75104) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104,   // 0x12570 (75120) pixels
-0x20E3, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x1081, 0x1082,   // 0x12580 (75136) pixels
-0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x0861, 0x1082, 0x1082, 0x10A2,   // 0x12590 (75152) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861,   // 0x125A0 (75168) pixels
-0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1062, 0x1082, 0x1081, 0x1081, 0x0861, 0x1081, 0x1081, 0x1081, 0x0881, 0x1081, 0x1061,   // 0x125B0 (75184) pixels
-0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1081, 0x1061, 0x1082, 0x1062, 0x1061, 0x1061, 0x1081, 0x1061, 0x1062,   // 0x125C0 (75200) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1082, 0x1062, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x125D0 (75216) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x125E0 (75232) pixels
-0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x125F0 (75248) pixels
-0x10A2, 0x10A2, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x10C2,   // 0x12600 (75264) pixels
-0x1082, 0x1061, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x20E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103,   // 0x12610 (75280) pixels
-0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2123, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x3165, 0x4A47,   // 0x12620 (75296) pixels
-0x4A27, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2103, 0x2104, 0x2944, 0x2944, 0x2124, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x12630 (75312) pixels
-0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x3185, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x12640 (75328) pixels
-0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2944, 0x2945, 0x2944, 0x2944,   // 0x12650 (75344) pixels
-0x2945, 0x2944, 0x3145, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x12660 (75360) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944,   // 0x12670 (75376) pixels
-0x2944, 0x3144, 0x2945, 0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2964, 0x2944, 0x2944,   // 0x12680 (75392) pixels
-0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924,   // 0x12690 (75408) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2103, 0x2104, 0x2103, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924,   // 0x126A0 (75424) pixels
-0x2944, 0x2124, 0x2124, 0x2924, 0x2924, 0x2123, 0x2124, 0x2124, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104, 0x2103,   // 0x126B0 (75440) pixels
-0x2103, 0x2103, 0x20E3, 0x2104, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x1081, 0x1081, 0x18A2,   // 0x126C0 (75456) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x126D0 (75472) pixels
-0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x0861, 0x0841, 0x0020, 0x0020, 0x0820, 0x0841, 0x0861, 0x1061,   // 0x126E0 (75488) pixels
-0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1061, 0x1061, 0x1061, 0x1081, 0x0881, 0x1082, 0x1081, 0x1061, 0x1082, 0x1081,   // 0x126F0 (75504) pixels
-0x1061, 0x1081, 0x1081, 0x1081, 0x1061, 0x1082, 0x1081, 0x1081, 0x1061, 0x1082, 0x1062, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x12700 (75520) pixels
-0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1082, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12710 (75536) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12720 (75552) pixels
-0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020, 0x0841, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2,   // 0x12730 (75568) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x10C2,   // 0x12740 (75584) pixels
-0x18C2, 0x1082, 0x1081, 0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x20E3,   // 0x12750 (75600) pixels
-0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2103, 0x2124, 0x2923, 0x2924, 0x2924, 0x2924, 0x2124, 0x2103, 0x2104, 0x3985, 0x41C6,   // 0x12760 (75616) pixels
-0x2924, 0x2924, 0x2924, 0x3185, 0x39C6, 0x3165, 0x7B8D, 0x8BEE, 0x83CE, 0x736C, 0x4A27, 0x3165, 0x2124, 0x2103, 0x2103, 0x2924,   // 0x12770 (75632) pixels
-0x2124, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944, 0x2924, 0x2124, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x12780 (75648) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944,   // 0x12790 (75664) pixels
-0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x127A0 (75680) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x41E7, 0x3164, 0x2944, 0x2944, 0x3145, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x127B0 (75696) pixels
-0x2944, 0x2964, 0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x127C0 (75712) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924,   // 0x127D0 (75728) pixels
-0x2924, 0x2924, 0x2124, 0x2944, 0x3185, 0x62CA, 0x8BEE, 0x8BEE, 0x730B, 0x39C6, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924,   // 0x127E0 (75744) pixels
-0x2124, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924, 0x2124, 0x2904, 0x2124, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x127F0 (75760) pixels
-0x2103, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x10A2, 0x1081, 0x1061, 0x0861,   // 0x12800 (75776) pixels
-0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x12810 (75792) pixels
-0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x0000, 0x0020, 0x0820, 0x0841, 0x0861, 0x0861, 0x1081,   // 0x12820 (75808) pixels
-0x1081, 0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x0881, 0x1061, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061,   // 0x12830 (75824) pixels
-0x1081, 0x1061, 0x1082, 0x1081, 0x1061, 0x1082, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1062, 0x1061,   // 0x12840 (75840) pixels
-0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12850 (75856) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12860 (75872) pixels
-0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2,   // 0x12870 (75888) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18C3,   // 0x12880 (75904) pixels
-0x10A2, 0x10A2, 0x1082, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103,   // 0x12890 (75920) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2904, 0x2904, 0x2124, 0x2103, 0x2924, 0x2924, 0x2124, 0x2924, 0x2904, 0x39A6,   // 0x128A0 (75936) pixels
-0x2944, 0x2124, 0x2924, 0x2124, 0x41C6, 0x9C6F, 0x9C70, 0x9C70, 0x9C4F, 0x8BEE, 0x8BEF, 0x9C90, 0x9C70, 0x83CE, 0x6B2B, 0x41E7,   // 0x128B0 (75952) pixels
-0x2124, 0x2103, 0x2124, 0x2924, 0x2924, 0x2124, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x128C0 (75968) pixels
-0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x128D0 (75984) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2965, 0x3144, 0x3144, 0x2944, 0x2944,   // 0x128E0 (76000) pixels
-0x2945, 0x2944, 0x2964, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144,   // 0x128F0 (76016) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x3144, 0x2944,   // 0x12900 (76032) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2104, 0x3144,   // 0x12910 (76048) pixels
-0x4A28, 0x734B, 0x8C0F, 0x9C70, 0x9C70, 0x942F, 0x9C70, 0x9C70, 0x9C70, 0xA4D1, 0x39A6, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124,   // 0x12920 (76064) pixels
-0x2124, 0x2944, 0x2124, 0x2124, 0x2124, 0x2123, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x2103,   // 0x12930 (76080) pixels
-0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1061, 0x1081, 0x1082, 0x1081, 0x1082,   // 0x12940 (76096) pixels
-0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x12950 (76112) pixels
-0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x1061, 0x1061, 0x1061,   // 0x12960 (76128) pixels
-0x1081, 0x1082, 0x1082, 0x0881, 0x0881, 0x0881, 0x1081, 0x1061, 0x1061, 0x1082, 0x1061, 0x0881, 0x1061, 0x1081, 0x1061, 0x1081,   // 0x12970 (76144) pixels
-0x0881, 0x1081, 0x1082, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1061,   // 0x12980 (76160) pixels
-0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12990 (76176) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x129A0 (76192) pixels
-0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0020, 0x0000, 0x0000, 0x0841, 0x0882, 0x10A2, 0x18E3, 0x18C3, 0x10C2, 0x10A2, 0x1082,   // 0x129B0 (76208) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3,   // 0x129C0 (76224) pixels
-0x18E3, 0x18E3, 0x18E3, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18C2, 0x18E3, 0x18E3, 0x20E3, 0x20E3,   // 0x129D0 (76240) pixels
-0x2103, 0x20E3, 0x2103, 0x2104, 0x2104, 0x2103, 0x2904, 0x2103, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x129E0 (76256) pixels
-0x2924, 0x2944, 0x2124, 0x2945, 0x9C4F, 0x8BEE, 0x8BEE, 0x83EE, 0x83CE, 0x7BAE, 0x7BAD, 0x83EE, 0x8C0F, 0x942F, 0x9C70, 0x9C70,   // 0x129F0 (76272) pixels
-0x7B8D, 0x62EA, 0x39A6, 0x2924, 0x2103, 0x2124, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x12A00 (76288) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x12A10 (76304) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2944, 0x2924, 0x2944, 0x3144, 0x2944, 0x2945,   // 0x12A20 (76320) pixels
-0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x39A6,   // 0x12A30 (76336) pixels
-0x3144, 0x3144, 0x2944, 0x2944, 0x2964, 0x2944, 0x2945, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x12A40 (76352) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x39A6, 0x5A69, 0x7BAD, 0x940F,   // 0x12A50 (76368) pixels
-0x9C70, 0x942F, 0x83EE, 0x83EE, 0x7BCE, 0x7BAD, 0x83CE, 0x83EE, 0x8BEF, 0x8BEF, 0x942F, 0x5248, 0x2924, 0x2924, 0x2124, 0x2124,   // 0x12A60 (76384) pixels
-0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2103, 0x2104, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3,   // 0x12A70 (76400) pixels
-0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18A2, 0x18C2, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x12A80 (76416) pixels
-0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18A2, 0x10A2,   // 0x12A90 (76432) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0841, 0x0000, 0x0020, 0x0040, 0x0841, 0x1061, 0x1061, 0x1082, 0x1081,   // 0x12AA0 (76448) pixels
-0x1061, 0x1082, 0x1081, 0x0861, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081,   // 0x12AB0 (76464) pixels
-0x1081, 0x1061, 0x1081, 0x1061, 0x1082, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061,   // 0x12AC0 (76480) pixels
-0x1082, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12AD0 (76496) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12AE0 (76512) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0000, 0x0000, 0x0020, 0x0841, 0x18C3, 0x2945, 0x2945, 0x2104, 0x18E3, 0x1082,   // 0x12AF0 (76528) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18C3,   // 0x12B00 (76544) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x1081, 0x18A2, 0x18C2, 0x18C2, 0x18A2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x20E3, 0x20E3, 0x20E3,   // 0x12B10 (76560) pixels
-0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104, 0x2924, 0x2124, 0x2103, 0x2924, 0x2924, 0x2924,   // 0x12B20 (76576) pixels
-0x2924, 0x2124, 0x2124, 0x2924, 0x83EE, 0x6B0B, 0x630B, 0x630B, 0x62EA, 0x6B0C, 0x6B0B, 0x6B2C, 0x732C, 0x736C, 0x7BAE, 0x83EE,   // 0x12B30 (76592) pixels
-0x8C0F, 0x942F, 0x9C90, 0xA4B1, 0x8C0F, 0x7B6C, 0x4A07, 0x3165, 0x2924, 0x2103, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x12B40 (76608) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x12B50 (76624) pixels
-0x2944, 0x2944, 0x2944, 0x2964, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3164, 0x3144, 0x2944,   // 0x12B60 (76640) pixels
-0x2945, 0x2944, 0x2964, 0x2944, 0x2924, 0x2944, 0x3144, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x3164, 0x2964, 0x2944,   // 0x12B70 (76656) pixels
-0x3165, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2964, 0x3164, 0x2944, 0x2944,   // 0x12B80 (76672) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x3165, 0x41E7, 0x734C, 0x8BEE, 0x9C70, 0x9C70, 0x944F, 0x8C0F, 0x8BEF,   // 0x12B90 (76688) pixels
-0x83CE, 0x7B8D, 0x734C, 0x6B2C, 0x6B0B, 0x630B, 0x6B0B, 0x630C, 0x62EA, 0x6B0B, 0x7B8D, 0x5A89, 0x2924, 0x2924, 0x2924, 0x2124,   // 0x12BA0 (76704) pixels
-0x2924, 0x2124, 0x2123, 0x2124, 0x2103, 0x2124, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3,   // 0x12BB0 (76720) pixels
-0x20E3, 0x18C3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x1082, 0x1081, 0x1082, 0x0840, 0x1082, 0x1082, 0x1082,   // 0x12BC0 (76736) pixels
-0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x12BD0 (76752) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x0000, 0x0000, 0x0020, 0x0841, 0x0841, 0x1082, 0x1061, 0x1082, 0x1062,   // 0x12BE0 (76768) pixels
-0x1081, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1061, 0x0861, 0x1081, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1061, 0x1061,   // 0x12BF0 (76784) pixels
-0x1081, 0x1061, 0x0881, 0x1081, 0x1061, 0x1082, 0x1061, 0x1061, 0x1081, 0x1061, 0x0881, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061,   // 0x12C00 (76800) pixels
-0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12C10 (76816) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12C20 (76832) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0840, 0x0020, 0x0000, 0x0000, 0x0820, 0x10A2, 0x2104, 0x2104, 0x20E3, 0x18C3, 0x1082,   // 0x12C30 (76848) pixels
-0x10A2, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x12C40 (76864) pixels
-0x18E3, 0x18E3, 0x18E3, 0x10A2, 0x18C2, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18A2, 0x18C3, 0x18C2, 0x18E3, 0x18E2, 0x18E3, 0x18E3,   // 0x12C50 (76880) pixels
-0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124, 0x2124, 0x2103, 0x2103, 0x2124,   // 0x12C60 (76896) pixels
-0x2924, 0x2124, 0x2124, 0x2103, 0x734C, 0x62EB, 0x6B0B, 0x62EA, 0x6B0B, 0x62EB, 0x6B0B, 0x6B2C, 0x6B2B, 0x734C, 0x736C, 0x736C,   // 0x12C70 (76912) pixels
-0x7B8D, 0x83CE, 0x83EE, 0x8C0F, 0x8C0F, 0x9470, 0x9C90, 0x8C0F, 0x734B, 0x41E7, 0x39C6, 0x2944, 0x2124, 0x2103, 0x2924, 0x2924,   // 0x12C80 (76928) pixels
-0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x12C90 (76944) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x3144, 0x3144, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x12CA0 (76960) pixels
-0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944,   // 0x12CB0 (76976) pixels
-0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x3144, 0x2944, 0x2944, 0x2944, 0x2124, 0x2924, 0x2924, 0x2124,   // 0x12CC0 (76992) pixels
-0x2103, 0x2924, 0x2924, 0x2924, 0x3185, 0x5248, 0x62CA, 0x8BEE, 0x9C70, 0x944F, 0x8C0F, 0x8BEF, 0x83EE, 0x83CE, 0x7BCE, 0x7B8E,   // 0x12CD0 (77008) pixels
-0x736D, 0x736C, 0x734C, 0x6B2C, 0x6B2B, 0x6B2B, 0x630B, 0x6B0B, 0x6B0C, 0x62EB, 0x6B2B, 0x5268, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x12CE0 (77024) pixels
-0x2124, 0x2924, 0x2103, 0x2123, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3,   // 0x12CF0 (77040) pixels
-0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x1061, 0x1082, 0x0020, 0x0861, 0x1082, 0x10A2, 0x1082,   // 0x12D00 (77056) pixels
-0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2,   // 0x12D10 (77072) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0020, 0x0020, 0x0020, 0x0040, 0x0841, 0x1061, 0x1082, 0x1082, 0x1061, 0x1061,   // 0x12D20 (77088) pixels
-0x1061, 0x1061, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1061, 0x1081, 0x1082,   // 0x12D30 (77104) pixels
-0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x0881, 0x1061, 0x1081, 0x1081, 0x1081,   // 0x12D40 (77120) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12D50 (77136) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12D60 (77152) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000, 0x0841, 0x0861, 0x1081, 0x1082, 0x1082, 0x10A2,   // 0x12D70 (77168) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3,   // 0x12D80 (77184) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x1082, 0x1061, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18C3,   // 0x12D90 (77200) pixels
-0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x12DA0 (77216) pixels
-0x2104, 0x2924, 0x2124, 0x2103, 0x734C, 0x6B0B, 0x736C, 0x736C, 0x736C, 0x6B2C, 0x734C, 0x734C, 0x736C, 0x736C, 0x7B8D, 0x736C,   // 0x12DB0 (77232) pixels
-0x7B8D, 0x7B8D, 0x7B8D, 0x7B8D, 0x7BAD, 0x7BAE, 0x8BEF, 0x940F, 0x942F, 0x946F, 0x9C90, 0x9C90, 0x9C90, 0x9C70, 0x83CE, 0x736C,   // 0x12DC0 (77248) pixels
-0x5A89, 0x39C6, 0x3185, 0x3185, 0x3985, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x3144,   // 0x12DD0 (77264) pixels
-0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x12DE0 (77280) pixels
-0x2944, 0x2944, 0x2945, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944,   // 0x12DF0 (77296) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2124, 0x2924, 0x2944, 0x3985, 0x3185, 0x3165, 0x39A6, 0x5A89, 0x6B0B,   // 0x12E00 (77312) pixels
-0x7BAD, 0x8C0F, 0x9C71, 0xA491, 0xA4B1, 0x9450, 0x9430, 0x8C0F, 0x8C0E, 0x83CE, 0x7BAE, 0x736D, 0x7B8D, 0x736D, 0x7B8E, 0x7B8D,   // 0x12E10 (77328) pixels
-0x736D, 0x734C, 0x734C, 0x734C, 0x732C, 0x6B2B, 0x734C, 0x734C, 0x736C, 0x732C, 0x732C, 0x5248, 0x2924, 0x2124, 0x2924, 0x2924,   // 0x12E20 (77344) pixels
-0x2124, 0x2924, 0x2104, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3,   // 0x12E30 (77360) pixels
-0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x0861, 0x1082, 0x18C2, 0x0841, 0x0881, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x12E40 (77376) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2,   // 0x12E50 (77392) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0020, 0x0020, 0x0820, 0x0841, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061,   // 0x12E60 (77408) pixels
-0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061, 0x1061, 0x0881, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061,   // 0x12E70 (77424) pixels
-0x1061, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1061, 0x0881, 0x1061, 0x1082, 0x1061, 0x1061, 0x0861, 0x1081, 0x1061,   // 0x12E80 (77440) pixels
-0x0841, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12E90 (77456) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12EA0 (77472) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0840, 0x0020, 0x0000, 0x0020, 0x0841, 0x0861, 0x1081, 0x1082, 0x1082,   // 0x12EB0 (77488) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x12EC0 (77504) pixels
-0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x1081, 0x1061, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3,   // 0x12ED0 (77520) pixels
-0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2923, 0x2104, 0x2103, 0x2104,   // 0x12EE0 (77536) pixels
-0x2103, 0x2124, 0x2124, 0x20E3, 0x736C, 0x6B2B, 0x7B8C, 0x7B8D, 0x736C, 0x7B8D, 0x7B8D, 0x7BAE, 0x7B8C, 0x7B6C, 0x7B8D, 0x7BAD,   // 0x12EF0 (77552) pixels
-0x7B8D, 0x7B8D, 0x7B8D, 0x7BAE, 0x7B8D, 0x7BAE, 0x7B8D, 0x7BAD, 0x7BAE, 0x83EE, 0x8BEF, 0x8C0F, 0x8C0F, 0x944F, 0x9C70, 0x9C4F,   // 0x12F00 (77568) pixels
-0xA4B1, 0x9C90, 0xA4B1, 0x8C0F, 0x83CE, 0x734B, 0x5A89, 0x4207, 0x41E7, 0x41C6, 0x3185, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924,   // 0x12F10 (77584) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x12F20 (77600) pixels
-0x2924, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2924, 0x2924,   // 0x12F30 (77616) pixels
-0x2924, 0x2924, 0x2924, 0x2924, 0x39A6, 0x39C6, 0x39C6, 0x41E7, 0x4A28, 0x734C, 0x7BAD, 0x83EE, 0x942F, 0x9C90, 0xA4B1, 0x9C91,   // 0x12F40 (77632) pixels
-0x9C70, 0x8C0F, 0x942F, 0x8C0F, 0x8C0F, 0x83EE, 0x83CE, 0x7BAD, 0x7B8D, 0x7BAE, 0x7BAD, 0x7B8D, 0x7BAD, 0x7BAE, 0x7BAD, 0x7B8D,   // 0x12F50 (77648) pixels
-0x7B8C, 0x736C, 0x7B8D, 0x7BAD, 0x7B8D, 0x7B6C, 0x7B8D, 0x7B8D, 0x7BAD, 0x734C, 0x732C, 0x5248, 0x2924, 0x2124, 0x2124, 0x2904,   // 0x12F60 (77664) pixels
-0x2124, 0x2924, 0x2124, 0x2104, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x20E3,   // 0x12F70 (77680) pixels
-0x18C2, 0x18C3, 0x18C2, 0x18A2, 0x18A2, 0x10A2, 0x1081, 0x1082, 0x10A2, 0x0861, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x12F80 (77696) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x12F90 (77712) pixels
-0x10A2, 0x1082, 0x1082, 0x0861, 0x0841, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082,   // 0x12FA0 (77728) pixels
-0x1082, 0x1061, 0x1061, 0x0881, 0x1061, 0x0881, 0x0881, 0x1081, 0x1081, 0x1061, 0x0861, 0x0861, 0x0881, 0x1081, 0x1081, 0x1081,   // 0x12FB0 (77744) pixels
-0x1082, 0x1082, 0x1081, 0x1061, 0x1082, 0x1061, 0x1081, 0x1081, 0x1081, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1081,   // 0x12FC0 (77760) pixels
-0x0840, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12FD0 (77776) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x12FE0 (77792) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0840, 0x0841, 0x0841, 0x0020, 0x0000, 0x0020, 0x0840, 0x0861, 0x1061, 0x1082,   // 0x12FF0 (77808) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3,   // 0x13000 (77824) pixels
-0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x20E4, 0x2103, 0x18E3, 0x18C2, 0x1082, 0x0861, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E3,   // 0x13010 (77840) pixels
-0x18E3, 0x18E3, 0x20E2, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2903, 0x2124,   // 0x13020 (77856) pixels
-0x2124, 0x2924, 0x2124, 0x20E3, 0x7B6C, 0x734C, 0x7BAD, 0x83CE, 0x7BAD, 0x83CE, 0x83EF, 0x83CE, 0x83EE, 0x83CE, 0x83EE, 0x840F,   // 0x13030 (77872) pixels
-0x83EF, 0x83EF, 0x83EF, 0x83CE, 0x83CE, 0x83CE, 0x83CD, 0x7BAE, 0x7BAE, 0x7BCE, 0x7BAD, 0x7BAE, 0x7BAD, 0x83CE, 0x83EF, 0x83EE,   // 0x13040 (77888) pixels
-0x83EE, 0x8C0F, 0x8C0F, 0x8C0F, 0x8C2F, 0x8C0F, 0x940F, 0x944F, 0x9C6F, 0x9C90, 0x9C70, 0x9470, 0x83EE, 0x83CE, 0x83CE, 0x83CE,   // 0x13050 (77904) pixels
-0x7BAD, 0x7B8D, 0x7B6C, 0x734C, 0x6B2B, 0x6AEA, 0x62CA, 0x5A89, 0x5248, 0x4207, 0x39C6, 0x39C6, 0x39A6, 0x3185, 0x3165, 0x3165,   // 0x13060 (77920) pixels
-0x3165, 0x3165, 0x3185, 0x39C6, 0x39C6, 0x39C6, 0x4A28, 0x5A89, 0x5AAA, 0x62CA, 0x6B0B, 0x732C, 0x734C, 0x7B8D, 0x7B8D, 0x7BAD,   // 0x13070 (77936) pixels
-0x7BAD, 0x83AE, 0x83CE, 0x942F, 0x9C70, 0x944F, 0x9C70, 0x9450, 0x942F, 0x8C0F, 0x8C0F, 0x8BEF, 0x8C2F, 0x8C2F, 0x8C0F, 0x83EF,   // 0x13080 (77952) pixels
-0x7BCE, 0x7BAE, 0x7BAD, 0x7B8D, 0x7BAD, 0x7BAD, 0x7BAE, 0x7BAD, 0x7BAD, 0x7BAD, 0x83EE, 0x83CE, 0x83CE, 0x83CE, 0x83CE, 0x83CE,   // 0x13090 (77968) pixels
-0x83EF, 0x7BCE, 0x83CE, 0x83CE, 0x7BAD, 0x7BAD, 0x7B8D, 0x83CE, 0x7BAD, 0x736C, 0x6B0B, 0x4A27, 0x2924, 0x2924, 0x2124, 0x2103,   // 0x130A0 (77984) pixels
-0x2103, 0x2924, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3,   // 0x130B0 (78000) pixels
-0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18C2, 0x0861, 0x1081, 0x1082, 0x0861, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x130C0 (78016) pixels
-0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x130D0 (78032) pixels
-0x10A2, 0x1082, 0x0861, 0x0841, 0x0000, 0x0020, 0x0840, 0x0841, 0x0861, 0x0861, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1081,   // 0x130E0 (78048) pixels
-0x1081, 0x1081, 0x0861, 0x0861, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1082, 0x1061, 0x1061, 0x1081, 0x1081, 0x0881, 0x1061,   // 0x130F0 (78064) pixels
-0x1081, 0x1061, 0x1081, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081, 0x0881, 0x0881, 0x0881, 0x1081, 0x1061, 0x1062, 0x1081, 0x1061,   // 0x13100 (78080) pixels
-0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13110 (78096) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13120 (78112) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0820, 0x0020, 0x0000, 0x0020, 0x0841, 0x0861, 0x1081,   // 0x13130 (78128) pixels
-0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3,   // 0x13140 (78144) pixels
-0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E4, 0x10A2, 0x0841, 0x1082, 0x0861, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C2,   // 0x13150 (78160) pixels
-0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x2124,   // 0x13160 (78176) pixels
-0x2924, 0x2124, 0x2904, 0x20E3, 0x732C, 0x734C, 0x83CE, 0x83CE, 0x83CE, 0x83CE, 0x83CD, 0x8C0F, 0x840F, 0x942F, 0x942F, 0x9430,   // 0x13170 (78192) pixels
-0x8C2F, 0x8C2F, 0x942F, 0x8C2F, 0x8C0F, 0x8C2F, 0x8C0F, 0x83EF, 0x83EE, 0x83EF, 0x83EE, 0x83CE, 0x7BCE, 0x83EF, 0x83EF, 0x83EE,   // 0x13180 (78208) pixels
-0x83CE, 0x7BCE, 0x7BAE, 0x7BAE, 0x7B8C, 0x7B8D, 0x738D, 0x7BAE, 0x7BAE, 0x83CE, 0x83EE, 0x83EF, 0x83EE, 0x83EE, 0x7BAE, 0x83CD,   // 0x13190 (78224) pixels
-0x7BAD, 0x736C, 0x736C, 0x7B8D, 0x7BAD, 0x83CE, 0x83CE, 0x8BCE, 0x8BEF, 0x8BEF, 0x8C0F, 0x8C0F, 0x8C0F, 0x8C0F, 0x8C0F, 0x8BEE,   // 0x131A0 (78240) pixels
-0x8C0E, 0x8C0F, 0x8C0F, 0x8C0F, 0x83EE, 0x83CE, 0x83EE, 0x83EE, 0x83CE, 0x83CE, 0x83CE, 0x6B2C, 0x6B0B, 0x62CA, 0x83CE, 0x83EE,   // 0x131B0 (78256) pixels
-0x83EE, 0x83CE, 0x83EE, 0x83EF, 0x7BCE, 0x7BCE, 0x7BAE, 0x7B8D, 0x7B8D, 0x7B8D, 0x7B8D, 0x7BAE, 0x7BCE, 0x7BAE, 0x83EF, 0x83EE,   // 0x131C0 (78272) pixels
-0x83CE, 0x83EE, 0x83EF, 0x83EE, 0x83CD, 0x8BEF, 0x83EE, 0x8C0F, 0x840F, 0x8C0F, 0x8C2F, 0x940F, 0x8C0F, 0x8C0F, 0x8C0F, 0x8C2F,   // 0x131D0 (78288) pixels
-0x940F, 0x940F, 0x8C0F, 0x8C2F, 0x83CE, 0x7BCE, 0x83CD, 0x83EE, 0x83CE, 0x734C, 0x6AEA, 0x4A27, 0x2924, 0x2924, 0x2924, 0x2123,   // 0x131E0 (78304) pixels
-0x2904, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2,   // 0x131F0 (78320) pixels
-0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x1081, 0x1082, 0x0861, 0x1061, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082,   // 0x13200 (78336) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13210 (78352) pixels
-0x1082, 0x0861, 0x0841, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061,   // 0x13220 (78368) pixels
-0x1081, 0x1061, 0x0861, 0x1061, 0x1081, 0x0861, 0x1061, 0x1082, 0x1082, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081,   // 0x13230 (78384) pixels
-0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1061, 0x1061, 0x1081, 0x1061, 0x0861, 0x0881, 0x1061, 0x1082, 0x1082, 0x1061,   // 0x13240 (78400) pixels
-0x0020, 0x0040, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13250 (78416) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13260 (78432) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0000, 0x0000, 0x0020, 0x0841, 0x1061,   // 0x13270 (78448) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3,   // 0x13280 (78464) pixels
-0x18E3, 0x18E3, 0x18E4, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x18C3, 0x1082, 0x0861, 0x1081, 0x1081, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x13290 (78480) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2904, 0x2104,   // 0x132A0 (78496) pixels
-0x2924, 0x2103, 0x2124, 0x20E3, 0x6B2B, 0x734C, 0x83AE, 0x7BAE, 0x83CD, 0x7BCE, 0x83EE, 0x8C0E, 0x8C0F, 0x9430, 0x944F, 0x944F,   // 0x132B0 (78512) pixels
-0x8C2F, 0x9450, 0x944F, 0x942F, 0x942F, 0x9450, 0x9450, 0x9430, 0x942F, 0x9430, 0x942F, 0x8C2F, 0x8C0F, 0x8C0F, 0x83EE, 0x8BEF,   // 0x132C0 (78528) pixels
-0x83EF, 0x83CE, 0x83CE, 0x83CE, 0x7BAD, 0x7BAE, 0x7BAE, 0x7BAD, 0x7BAD, 0x738C, 0x736C, 0x738D, 0x736D, 0x736C, 0x6B4C, 0x6B4C,   // 0x132D0 (78544) pixels
-0x736C, 0xAD12, 0xC5B4, 0x942F, 0x734C, 0x734C, 0x734C, 0x734C, 0x736C, 0x7B6D, 0x7B8D, 0x7B8D, 0x7BAD, 0x7BAD, 0x83AE, 0x83CE,   // 0x132E0 (78560) pixels
-0x83AD, 0x7BAD, 0x7BAD, 0x7B8D, 0x736D, 0x736C, 0x736C, 0x734C, 0x734C, 0x6B2C, 0x6B4C, 0x8BEE, 0xACF1, 0xACF2, 0x734D, 0x734C,   // 0x132F0 (78576) pixels
-0x6B2C, 0x6B2B, 0x734C, 0x736D, 0x738D, 0x736D, 0x7B8D, 0x7B8D, 0x7BAE, 0x7B8D, 0x7BCE, 0x83EF, 0x83EE, 0x83EE, 0x83EF, 0x83EE,   // 0x13300 (78592) pixels
-0x83EE, 0x83EE, 0x8BEF, 0x942F, 0x940F, 0x9430, 0x9430, 0x942F, 0x942F, 0x8C2F, 0x944F, 0x942F, 0x944F, 0x9450, 0x944F, 0x8C2F,   // 0x13310 (78608) pixels
-0x942F, 0x940F, 0x8C0F, 0x940F, 0x8BEF, 0x83EF, 0x838D, 0x83CE, 0x7BAD, 0x734C, 0x6AEB, 0x4A07, 0x2924, 0x2924, 0x2924, 0x2103,   // 0x13320 (78624) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2,   // 0x13330 (78640) pixels
-0x18A2, 0x18C2, 0x10A2, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x13340 (78656) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13350 (78672) pixels
-0x1082, 0x0861, 0x0000, 0x0000, 0x0020, 0x0040, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x13360 (78688) pixels
-0x1082, 0x1062, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x1062, 0x1061, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061, 0x1082, 0x1081,   // 0x13370 (78704) pixels
-0x1081, 0x1061, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x0881, 0x0881, 0x1061, 0x1081, 0x1061, 0x1061, 0x1082,   // 0x13380 (78720) pixels
-0x0000, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13390 (78736) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x133A0 (78752) pixels
-0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0040, 0x0840, 0x0020, 0x0020, 0x0000, 0x0020, 0x0841,   // 0x133B0 (78768) pixels
-0x0861, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18E3, 0x18C3, 0x18E3, 0x18E3,   // 0x133C0 (78784) pixels
-0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x20E4, 0x20E3, 0x18C3, 0x18C2, 0x10A2, 0x0020, 0x1082, 0x1061, 0x1081, 0x18C2, 0x18C2,   // 0x133D0 (78800) pixels
-0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103,   // 0x133E0 (78816) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x6B2B, 0x734C, 0x7B8D, 0x7BAD, 0x83CE, 0x83CD, 0x8BEF, 0x8C0F, 0x942F, 0x9430, 0x9C6F, 0x9C70,   // 0x133F0 (78832) pixels
-0x944F, 0x944F, 0x9C6F, 0x9C70, 0x9C91, 0x9C70, 0x9471, 0x9C6F, 0x9C6F, 0x9C91, 0x946F, 0x9C71, 0x9C70, 0x944F, 0x942F, 0x8C2F,   // 0x13400 (78848) pixels
-0x8C2F, 0x940F, 0x8C0F, 0x840F, 0x8C0F, 0x8C0F, 0x83EF, 0x7BCE, 0x83CF, 0x7BAE, 0x7BAE, 0x7B8D, 0x736C, 0x738D, 0x734B, 0x734C,   // 0x13410 (78864) pixels
-0x734C, 0xC5D5, 0xD635, 0xAD12, 0x8C0F, 0x83EE, 0x7BCE, 0x83CE, 0x83EE, 0x8BEF, 0x8C0F, 0x8C0F, 0x8C0F, 0x942F, 0x944F, 0x942F,   // 0x13420 (78880) pixels
-0x8C0E, 0x7B8D, 0x7B8D, 0x7B8D, 0x7B8D, 0x7B8D, 0x7BAD, 0x7B8D, 0x7B8D, 0x738D, 0x7B8D, 0xA4B0, 0xD616, 0xCDD5, 0x736D, 0x736C,   // 0x13430 (78896) pixels
-0x734D, 0x736D, 0x736C, 0x7B6C, 0x7B6D, 0x7B8D, 0x7BAD, 0x83CE, 0x83EE, 0x83EE, 0x83EE, 0x83EF, 0x8C0F, 0x83EF, 0x942F, 0x8C2F,   // 0x13440 (78912) pixels
-0x942F, 0x944F, 0x942F, 0x944F, 0x944F, 0x944F, 0x9C4F, 0x9C8F, 0x946F, 0x9470, 0x944F, 0x942F, 0x9C70, 0x942F, 0x9C6F, 0x944F,   // 0x13450 (78928) pixels
-0x944F, 0x9450, 0x8C0F, 0x8C0F, 0x83EF, 0x83EE, 0x83AE, 0x7BAE, 0x7B8D, 0x734B, 0x6B0B, 0x4A07, 0x2103, 0x2103, 0x2104, 0x2104,   // 0x13460 (78944) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2,   // 0x13470 (78960) pixels
-0x18C3, 0x1082, 0x1082, 0x1082, 0x0840, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x13480 (78976) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18A3, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13490 (78992) pixels
-0x0861, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1062, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082,   // 0x134A0 (79008) pixels
-0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x0881, 0x1081, 0x1081, 0x1062, 0x1082, 0x1082, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x134B0 (79024) pixels
-0x1061, 0x1061, 0x1061, 0x1082, 0x1082, 0x1061, 0x1081, 0x1082, 0x1081, 0x0881, 0x0861, 0x1061, 0x1081, 0x1081, 0x1061, 0x1082,   // 0x134C0 (79040) pixels
-0x0000, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x134D0 (79056) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x134E0 (79072) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020,   // 0x134F0 (79088) pixels
-0x0861, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18E3, 0x18E3, 0x18E3,   // 0x13500 (79104) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E4, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x0881, 0x0020, 0x1081, 0x1081, 0x18C2, 0x18C2,   // 0x13510 (79120) pixels
-0x18A2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104,   // 0x13520 (79136) pixels
-0x2103, 0x2104, 0x2924, 0x20E3, 0x734C, 0x734C, 0x7B6C, 0x7B6C, 0x7BAE, 0x7B8D, 0x83EE, 0x8C0F, 0x942F, 0x8C0F, 0x9C6F, 0x9C70,   // 0x13530 (79152) pixels
-0x9C4F, 0x9C6F, 0x9C4F, 0x9CB0, 0x9C6F, 0x9C91, 0x9C91, 0x9C90, 0x9C91, 0xA4B1, 0x9C90, 0xA4B1, 0xA4D2, 0xA4B1, 0x9C6F, 0x9C70,   // 0x13540 (79168) pixels
-0x9C70, 0x946F, 0x942F, 0x942F, 0x9450, 0x942F, 0x8C2F, 0x8C2F, 0x8C0F, 0x83EE, 0x83CE, 0x7BAD, 0x7BAE, 0x7BAD, 0x7B8D, 0x7B8D,   // 0x13550 (79184) pixels
-0x738C, 0xCDD5, 0xDE77, 0xB533, 0x9450, 0x8C0F, 0x83CE, 0x83CE, 0x83EE, 0x83EE, 0x83EE, 0x83EE, 0x83EE, 0x83EE, 0x83EE, 0x83EE,   // 0x13560 (79200) pixels
-0x83CE, 0x7BAD, 0x7BAD, 0x7BAD, 0x7B8D, 0x7B8D, 0x738D, 0x736D, 0x734C, 0x734C, 0x734C, 0xACD0, 0xD615, 0xCE15, 0x7B8D, 0x7BAE,   // 0x13570 (79216) pixels
-0x7B8D, 0x7BAE, 0x7B8D, 0x7BAD, 0x83CE, 0x83CD, 0x7BCE, 0x840F, 0x8C0F, 0x9430, 0x8C0F, 0x9430, 0x9450, 0x944F, 0x9450, 0x9450,   // 0x13580 (79232) pixels
-0x9C70, 0x9C70, 0x9C6F, 0x9C6F, 0x9C4F, 0x9C91, 0x9470, 0x9C4F, 0x9C70, 0x9C6F, 0x9C4F, 0x9C6F, 0x9C70, 0x9C70, 0x9C91, 0x944F,   // 0x13590 (79248) pixels
-0x9450, 0x942F, 0x8C2F, 0x8BEF, 0x83EE, 0x7BCD, 0x7B8D, 0x7B8D, 0x736C, 0x734C, 0x6B0B, 0x4207, 0x2103, 0x2104, 0x2924, 0x2104,   // 0x135A0 (79264) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18A2,   // 0x135B0 (79280) pixels
-0x1081, 0x1081, 0x10A2, 0x0841, 0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2,   // 0x135C0 (79296) pixels
-0x10A2, 0x10A2, 0x18C3, 0x18A2, 0x10C3, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861,   // 0x135D0 (79312) pixels
-0x0020, 0x0000, 0x0020, 0x0020, 0x0820, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x1081, 0x1062, 0x1061,   // 0x135E0 (79328) pixels
-0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1061, 0x1082, 0x1061, 0x1061, 0x1081, 0x1062,   // 0x135F0 (79344) pixels
-0x1082, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x0881, 0x0861, 0x1081, 0x1082, 0x1061, 0x1061, 0x1061, 0x1081,   // 0x13600 (79360) pixels
-0x0000, 0x0000, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13610 (79376) pixels
-0x0861, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13620 (79392) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020,   // 0x13630 (79408) pixels
-0x0041, 0x0841, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18E3, 0x18C3,   // 0x13640 (79424) pixels
-0x20E3, 0x20E3, 0x18E3, 0x1903, 0x20E4, 0x20E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x10A2, 0x1082, 0x10A2, 0x1081, 0x0861,   // 0x13650 (79440) pixels
-0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x20E3, 0x20E3, 0x2103, 0x2104, 0x2124, 0x2904, 0x2924, 0x2924,   // 0x13660 (79456) pixels
-0x2924, 0x2103, 0x2104, 0x18E3, 0x732B, 0x734C, 0x7B6C, 0x7B8D, 0x7B8C, 0x83AE, 0x7BAD, 0x83EE, 0x942F, 0x8C2F, 0x9450, 0x9450,   // 0x13670 (79472) pixels
-0x9C70, 0x9C50, 0x9C6F, 0x9C8F, 0x9C6F, 0x9CB1, 0x9C8F, 0x9C90, 0xA491, 0xA4D1, 0xA4B0, 0xA4F2, 0xA4F2, 0xA4B1, 0xA4B1, 0xA4D1,   // 0x13680 (79488) pixels
-0x9C90, 0x9C90, 0x9C90, 0xA4B1, 0x9C4F, 0x9C4F, 0x9C6F, 0x944F, 0x9450, 0x944F, 0x8C0F, 0x8C0F, 0x8C0F, 0x83EE, 0x83EF, 0x83CE,   // 0x13690 (79504) pixels
-0x83EE, 0xCDD5, 0xDE98, 0xBD94, 0x9C91, 0x8C0F, 0x83EF, 0x83EE, 0x83EE, 0x83EE, 0x8BEF, 0x83EF, 0x83EE, 0x83CE, 0x83CE, 0x8C0F,   // 0x136A0 (79520) pixels
-0x8C0F, 0x8C0F, 0x83EE, 0x83CE, 0x83AE, 0x7BAD, 0x7B8D, 0x7B8D, 0x736D, 0x736C, 0x736C, 0xAD12, 0xD636, 0xD616, 0x83CE, 0x83CE,   // 0x136B0 (79536) pixels
-0x83EE, 0x83EE, 0x83EE, 0x8BEF, 0x8C0F, 0x9430, 0x9430, 0x9450, 0x944F, 0x9C70, 0x9C71, 0x9C70, 0x9C90, 0x9CB1, 0x9C90, 0xA490,   // 0x136C0 (79552) pixels
-0xA491, 0xA491, 0xA4D1, 0xA490, 0xA4D1, 0xA4B1, 0xA4B1, 0x9C90, 0x9C90, 0x9C90, 0x9C91, 0x9C91, 0x9C6F, 0x9C70, 0x946F, 0x944F,   // 0x136D0 (79568) pixels
-0x9450, 0x942F, 0x942F, 0x83EE, 0x83CD, 0x83AE, 0x7B6C, 0x736C, 0x736C, 0x734C, 0x62EB, 0x4207, 0x2103, 0x2103, 0x2124, 0x2104,   // 0x136E0 (79584) pixels
-0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E2, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C3, 0x1061,   // 0x136F0 (79600) pixels
-0x1081, 0x10A2, 0x1061, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13700 (79616) pixels
-0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0840,   // 0x13710 (79632) pixels
-0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1082, 0x1082, 0x1061,   // 0x13720 (79648) pixels
-0x1061, 0x0881, 0x0861, 0x1062, 0x1061, 0x1061, 0x1061, 0x1061, 0x1062, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061,   // 0x13730 (79664) pixels
-0x1081, 0x1082, 0x1082, 0x1061, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x13740 (79680) pixels
-0x0081, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13750 (79696) pixels
-0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13760 (79712) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0020,   // 0x13770 (79728) pixels
-0x0020, 0x0020, 0x0861, 0x0861, 0x0882, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3,   // 0x13780 (79744) pixels
-0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x2103, 0x2104, 0x2104, 0x2104, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x18C2, 0x10A2, 0x1081,   // 0x13790 (79760) pixels
-0x1061, 0x18C2, 0x18C2, 0x18A2, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x2104, 0x2103,   // 0x137A0 (79776) pixels
-0x2103, 0x2104, 0x2103, 0x20E3, 0x732B, 0x734D, 0x7B6C, 0x7B8D, 0x7B8C, 0x83AE, 0x7BCD, 0x8C0F, 0x8C0F, 0x940F, 0x946F, 0x9450,   // 0x137B0 (79792) pixels
-0x942F, 0x944F, 0x9C90, 0x9C6F, 0x9C70, 0x9CB1, 0xA4B1, 0xA4B0, 0xA4D1, 0xA4B0, 0xA4D1, 0xA4D1, 0xA4B0, 0xA4B1, 0xA4D2, 0xA4D1,   // 0x137C0 (79808) pixels
-0xACF2, 0xA4B1, 0xA4D2, 0xA4B1, 0xA4D1, 0x9C90, 0x9C6F, 0x9C6F, 0x9C90, 0x944F, 0x9C91, 0x9470, 0x8C0F, 0x8C0F, 0x8C0F, 0x8C2F,   // 0x137D0 (79824) pixels
-0x8C0F, 0xCDD4, 0xDE77, 0xC594, 0xA4B1, 0x9450, 0x9450, 0x9430, 0x9450, 0x9450, 0x9450, 0x9450, 0x9450, 0x942F, 0x942F, 0x942F,   // 0x137E0 (79840) pixels
-0x9450, 0x9450, 0x9430, 0x8C2F, 0x8C0F, 0x8C0F, 0x83EE, 0x83EE, 0x83CE, 0x83CE, 0x83CE, 0xB532, 0xD636, 0xD636, 0x8C2F, 0x8C0F,   // 0x137F0 (79856) pixels
-0x8C0F, 0x8C2F, 0x8C0F, 0x8C0F, 0x940F, 0x944F, 0x9C70, 0x9C70, 0x9C70, 0x9C90, 0x9C91, 0xA4B1, 0xA4D1, 0xA4B1, 0xA4B2, 0xA4D1,   // 0x13800 (79872) pixels
-0xA4D1, 0xA4D1, 0xA4D1, 0xA4D1, 0xA4B1, 0xA4D1, 0xA490, 0xA4D1, 0xA4B0, 0xA490, 0xA490, 0x9C6F, 0xA491, 0x9C70, 0x9C50, 0x9C50,   // 0x13810 (79888) pixels
-0x944F, 0x942F, 0x8C0F, 0x8BEF, 0x83EF, 0x7BAD, 0x7B8C, 0x7B6D, 0x732B, 0x732C, 0x6B2B, 0x4207, 0x2103, 0x2104, 0x2103, 0x2103,   // 0x13820 (79904) pixels
-0x2103, 0x2103, 0x20E3, 0x2104, 0x20E3, 0x2103, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x0861, 0x1081,   // 0x13830 (79920) pixels
-0x0861, 0x1081, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13840 (79936) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C2, 0x10A2, 0x1082, 0x0861, 0x0020, 0x0000,   // 0x13850 (79952) pixels
-0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1081, 0x1061, 0x1081,   // 0x13860 (79968) pixels
-0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1082, 0x1062, 0x1061, 0x1061,   // 0x13870 (79984) pixels
-0x1082, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1061, 0x1082, 0x1081,   // 0x13880 (80000) pixels
-0x0061, 0x0081, 0x0000, 0x0040, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13890 (80016) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x138A0 (80032) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840,   // 0x138B0 (80048) pixels
-0x0020, 0x0020, 0x0840, 0x0861, 0x0881, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x138C0 (80064) pixels
-0x18E3, 0x18E3, 0x2104, 0x18E3, 0x2104, 0x20E3, 0x18E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x18E3, 0x10A2, 0x0861,   // 0x138D0 (80080) pixels
-0x1081, 0x0861, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103,   // 0x138E0 (80096) pixels
-0x2124, 0x2104, 0x2104, 0x20E3, 0x6B2B, 0x732B, 0x736C, 0x7B8D, 0x7B8C, 0x83AD, 0x83CE, 0x8C0F, 0x8C2F, 0x93EF, 0x942F, 0x942F,   // 0x138F0 (80112) pixels
-0x944F, 0xA491, 0xA4B0, 0xA4B1, 0xA4B1, 0x9C90, 0xA4D1, 0xA4F1, 0xA4B0, 0xA4B1, 0xACF2, 0xA4D1, 0xA4D1, 0xACF2, 0xACF2, 0xA4D1,   // 0x13900 (80128) pixels
-0xA4D1, 0xA4D1, 0xA4D1, 0xA4D1, 0xA4D1, 0xACF2, 0xA4B1, 0xA4B1, 0x9C6F, 0x9C6F, 0x942F, 0x9C70, 0x9470, 0x9450, 0x942F, 0x942F,   // 0x13910 (80144) pixels
-0x9C71, 0xCDF5, 0xDE97, 0xC5B4, 0xA4B1, 0x9C90, 0x9C90, 0x9C70, 0x9C90, 0x9C90, 0x9C90, 0x9C90, 0x9C90, 0x9C70, 0x9C70, 0x9450,   // 0x13920 (80160) pixels
-0x9450, 0x9C70, 0x9470, 0x9450, 0x942F, 0x942F, 0x8C0F, 0x8C0F, 0x83EF, 0x83EE, 0x8C0F, 0xACF1, 0xD636, 0xD656, 0x9C70, 0x944F,   // 0x13930 (80176) pixels
-0x9450, 0x8C0F, 0x8C0F, 0x942F, 0x9C90, 0x9C90, 0x9C6F, 0x9C70, 0xA4B1, 0xA491, 0xA490, 0x9C90, 0x9C90, 0xA48F, 0xACF2, 0xA4D2,   // 0x13940 (80192) pixels
-0xA4D2, 0xA4D1, 0xA4B0, 0xACD1, 0xA4B1, 0xA4D1, 0xA4B1, 0xA4D1, 0xA4B1, 0xA4B1, 0xA490, 0x9C70, 0x9C90, 0x9C70, 0x944F, 0x942F,   // 0x13950 (80208) pixels
-0x942F, 0x942F, 0x8C0F, 0x8BEF, 0x83CD, 0x7BAE, 0x7B8D, 0x7B8D, 0x734B, 0x734C, 0x6B0B, 0x41E7, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x13960 (80224) pixels
-0x2103, 0x20E3, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x18C2, 0x1061, 0x1082, 0x1082,   // 0x13970 (80240) pixels
-0x0861, 0x1082, 0x18C2, 0x10C2, 0x18C2, 0x18A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13980 (80256) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18E3, 0x18C3, 0x10A2, 0x0861, 0x0841, 0x0020, 0x0020,   // 0x13990 (80272) pixels
-0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1062, 0x1061,   // 0x139A0 (80288) pixels
-0x1081, 0x1061, 0x1081, 0x1061, 0x0861, 0x1081, 0x0861, 0x1061, 0x1061, 0x1061, 0x1062, 0x1081, 0x1081, 0x1061, 0x1061, 0x1061,   // 0x139B0 (80304) pixels
-0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x0881, 0x1061, 0x1081,   // 0x139C0 (80320) pixels
-0x0041, 0x0041, 0x0061, 0x0020, 0x0040, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861,   // 0x139D0 (80336) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x139E0 (80352) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0841, 0x0861,   // 0x139F0 (80368) pixels
-0x0820, 0x0020, 0x0020, 0x0040, 0x0861, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13A00 (80384) pixels
-0x10A2, 0x18C3, 0x20E3, 0x20E3, 0x2104, 0x20E3, 0x20E3, 0x1903, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x18C3, 0x10C2,   // 0x13A10 (80400) pixels
-0x0861, 0x1082, 0x1082, 0x1081, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x20E3, 0x20E3, 0x2103,   // 0x13A20 (80416) pixels
-0x2103, 0x2103, 0x2103, 0x18E3, 0x732C, 0x732B, 0x736C, 0x7B6D, 0x7BAD, 0x7BAD, 0x83AD, 0x83EE, 0x8BEF, 0x8C0F, 0x8C0E, 0x9C50,   // 0x13A30 (80432) pixels
-0x9C4F, 0x9C90, 0x9C6F, 0xA470, 0xA491, 0xA490, 0xA4D1, 0xA4D2, 0xA48F, 0xA4B1, 0xA4B0, 0xA4F2, 0xA4B1, 0xACD2, 0xACD2, 0xA4D1,   // 0x13A40 (80448) pixels
-0xACF1, 0xACF2, 0xACD1, 0xA4B1, 0xA4B0, 0xA4B2, 0xA491, 0xA490, 0xA4B1, 0x9C6F, 0x9C70, 0x942F, 0x942F, 0x942F, 0x942F, 0x9450,   // 0x13A50 (80464) pixels
-0x9C70, 0xCDD5, 0xDE97, 0xC594, 0xA4D1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4D1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0x9C91,   // 0x13A60 (80480) pixels
-0x9C90, 0x9C90, 0x9C90, 0x9C70, 0x9C70, 0x9450, 0x9430, 0x8C2F, 0x8C2F, 0x942F, 0x9450, 0xB512, 0xD615, 0xD636, 0x9C90, 0x9C70,   // 0x13A70 (80496) pixels
-0x9470, 0x942F, 0x8C2F, 0x942F, 0x9C70, 0x944F, 0x9C50, 0x9C6F, 0xA491, 0xA4B1, 0xA4D1, 0xA4B0, 0xA4D1, 0xA4D1, 0xA4B0, 0xA4B0,   // 0x13A80 (80512) pixels
-0xA4D1, 0xA4D1, 0xA490, 0xA490, 0xA4B0, 0xA4D1, 0xA4B0, 0xA4B1, 0xA4B1, 0xA4B1, 0xA491, 0x9C8F, 0x9C70, 0x9C70, 0x946F, 0x942F,   // 0x13A90 (80528) pixels
-0x940F, 0x8BEF, 0x8C0F, 0x83EE, 0x83CD, 0x83AE, 0x7B6C, 0x734C, 0x732B, 0x6B2C, 0x62EB, 0x41E7, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x13AA0 (80544) pixels
-0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18A2, 0x18A2, 0x18C2, 0x1061, 0x1081, 0x1082, 0x0861, 0x1081,   // 0x13AB0 (80560) pixels
-0x10A2, 0x10A2, 0x18C2, 0x18A2, 0x10C2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x10A2,   // 0x13AC0 (80576) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0820, 0x0841,   // 0x13AD0 (80592) pixels
-0x0841, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061,   // 0x13AE0 (80608) pixels
-0x1061, 0x1061, 0x1081, 0x0861, 0x1081, 0x1081, 0x0861, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081, 0x1061, 0x1061, 0x1061,   // 0x13AF0 (80624) pixels
-0x1081, 0x1061, 0x1061, 0x1082, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1081, 0x1061, 0x1081,   // 0x13B00 (80640) pixels
-0x0040, 0x0040, 0x0061, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061,   // 0x13B10 (80656) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13B20 (80672) pixels
-0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0841,   // 0x13B30 (80688) pixels
-0x0840, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13B40 (80704) pixels
-0x10A2, 0x10A2, 0x18C3, 0x2104, 0x2103, 0x20E3, 0x2103, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x18E3,   // 0x13B50 (80720) pixels
-0x18C2, 0x10A2, 0x18A2, 0x1082, 0x1061, 0x18C3, 0x18A2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x20E3, 0x20E3, 0x20E3,   // 0x13B60 (80736) pixels
-0x2103, 0x2103, 0x2103, 0x20E3, 0x732C, 0x734C, 0x7B6D, 0x7B4C, 0x7B8D, 0x7B8C, 0x83AD, 0x83EE, 0x940F, 0x940F, 0x942F, 0x940F,   // 0x13B70 (80752) pixels
-0x9C70, 0x9C90, 0xA491, 0xA491, 0x9C6F, 0xA491, 0xA4D1, 0xA4B0, 0xA490, 0xA4D2, 0xA4D1, 0xACD2, 0xA4B2, 0xACF2, 0xA4D0, 0xACD1,   // 0x13B80 (80768) pixels
-0xACF2, 0xACD1, 0xACF2, 0xA4B0, 0xA4B0, 0x9C90, 0xA4D1, 0xA4B0, 0x9C70, 0x9C70, 0x9C4F, 0x9C6F, 0x944F, 0x944F, 0x9470, 0x9C70,   // 0x13B90 (80784) pixels
-0x946F, 0xC5B4, 0xDE98, 0xC594, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4D1, 0xA4D1, 0xA4D1,   // 0x13BA0 (80800) pixels
-0xA4B1, 0xA4B1, 0xA491, 0x9C90, 0x9C70, 0x9C70, 0x9450, 0x9C70, 0x9450, 0x944F, 0x9C70, 0xACF1, 0xD636, 0xD656, 0x9C90, 0x9C4F,   // 0x13BB0 (80816) pixels
-0x942F, 0x944F, 0x942F, 0x9C70, 0x9C70, 0x944F, 0xA491, 0x9C70, 0x9C70, 0xA4D1, 0xA4B1, 0x9C90, 0xA4B0, 0xA48F, 0xA4B0, 0xA490,   // 0x13BC0 (80832) pixels
-0xA490, 0xA4B1, 0xA490, 0xA4B0, 0xA4D1, 0xA4B0, 0xA490, 0xA490, 0xA490, 0xA490, 0x9C70, 0xA491, 0x942F, 0x9C50, 0x942F, 0x9450,   // 0x13BD0 (80848) pixels
-0x942F, 0x940F, 0x8C0F, 0x8BEE, 0x83AD, 0x7B8D, 0x7B6C, 0x734B, 0x732C, 0x6B0A, 0x62EB, 0x41E7, 0x2103, 0x2103, 0x2103, 0x2104,   // 0x13BE0 (80864) pixels
-0x20E3, 0x20E3, 0x18E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x0861, 0x1081, 0x10A2, 0x0841, 0x1082, 0x10A2,   // 0x13BF0 (80880) pixels
-0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x18A2, 0x10A2, 0x18A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13C00 (80896) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0841, 0x0020, 0x0020, 0x0840, 0x0841,   // 0x13C10 (80912) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x0881, 0x1061,   // 0x13C20 (80928) pixels
-0x1061, 0x1082, 0x1061, 0x0881, 0x1081, 0x1081, 0x0861, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061,   // 0x13C30 (80944) pixels
-0x1081, 0x1061, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x0861, 0x1061,   // 0x13C40 (80960) pixels
-0x0040, 0x0040, 0x0040, 0x0041, 0x0040, 0x0840, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13C50 (80976) pixels
-0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13C60 (80992) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0040, 0x0840, 0x0840, 0x0040, 0x0840, 0x0820, 0x0040, 0x0020,   // 0x13C70 (81008) pixels
-0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x0861, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13C80 (81024) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x18E3, 0x2104, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2104,   // 0x13C90 (81040) pixels
-0x2103, 0x18E3, 0x18E3, 0x18C2, 0x10A2, 0x1082, 0x1082, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x18C2, 0x18E3, 0x18E3, 0x20E3,   // 0x13CA0 (81056) pixels
-0x2103, 0x2103, 0x2103, 0x18E3, 0x6B0B, 0x734C, 0x734B, 0x734C, 0x7B8D, 0x7B8C, 0x7BAD, 0x83EE, 0x8C0F, 0x8C0F, 0x942F, 0x940F,   // 0x13CB0 (81072) pixels
-0x9C70, 0x9C6F, 0x9C90, 0x9C70, 0x9C6F, 0x9C6F, 0xA4B0, 0xA4B0, 0xA4B0, 0xA4B0, 0xACD2, 0xACD1, 0xA4D1, 0xACF2, 0xA4D0, 0xA4B1,   // 0x13CC0 (81088) pixels
-0xACD1, 0xACD2, 0xACF1, 0xA4B1, 0xA4B1, 0xA490, 0xA491, 0xA490, 0x9C6F, 0x9C90, 0x9C4F, 0x944F, 0x944F, 0x940F, 0x944F, 0x942F,   // 0x13CD0 (81104) pixels
-0x946F, 0xC5B4, 0xDE76, 0xC594, 0xACD2, 0xA4D1, 0xA4D1, 0xA4B1, 0xA4D1, 0xA4D1, 0xA4D1, 0xA4D2, 0xA4D1, 0xA4D2, 0xACD1, 0xACD1,   // 0x13CE0 (81120) pixels
-0xA4D1, 0xA4D2, 0xA4B1, 0x9C90, 0x9C70, 0x9C70, 0x9450, 0x9450, 0x944F, 0x944F, 0x9C50, 0xAD12, 0xD615, 0xD636, 0xA4B1, 0x9C4F,   // 0x13CF0 (81136) pixels
-0x9450, 0x942F, 0x9450, 0x942F, 0x942F, 0x9C70, 0x9C6F, 0x9C91, 0x9C8F, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B0, 0xA4B0, 0xA4D1, 0xACD2,   // 0x13D00 (81152) pixels
-0xA4B0, 0xA4B0, 0xA4D2, 0xA4B1, 0xA4D1, 0xA4B0, 0xA4B1, 0xA490, 0xA490, 0xA491, 0xA490, 0xA491, 0x9C4F, 0x944F, 0x942F, 0x940F,   // 0x13D10 (81168) pixels
-0x942F, 0x940F, 0x8C0F, 0x83CD, 0x83CE, 0x7B8D, 0x734B, 0x734C, 0x6B0B, 0x6B0A, 0x6AEA, 0x41E6, 0x2103, 0x2103, 0x2103, 0x20E3,   // 0x13D20 (81184) pixels
-0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x1061, 0x1081, 0x1082, 0x0861, 0x1081, 0x10A2, 0x18A2, 0x18C2,   // 0x13D30 (81200) pixels
-0x18A2, 0x18A2, 0x18C2, 0x18A2, 0x10A2, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13D40 (81216) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0841, 0x0000, 0x0020, 0x0020, 0x0820, 0x0820,   // 0x13D50 (81232) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x1081, 0x1082, 0x1081,   // 0x13D60 (81248) pixels
-0x1061, 0x1081, 0x1061, 0x1081, 0x1061, 0x0881, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061,   // 0x13D70 (81264) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x0861, 0x1081, 0x1081,   // 0x13D80 (81280) pixels
-0x0040, 0x0040, 0x0040, 0x0040, 0x0061, 0x0020, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061,   // 0x13D90 (81296) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x13DA0 (81312) pixels
-0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0840, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x13DB0 (81328) pixels
-0x0020, 0x0841, 0x0820, 0x0020, 0x0000, 0x0020, 0x0041, 0x0861, 0x0882, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2,   // 0x13DC0 (81344) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x1903, 0x20E3, 0x20E3, 0x20E3, 0x2103, 0x2104, 0x2103, 0x2103,   // 0x13DD0 (81360) pixels
-0x2104, 0x2103, 0x20E3, 0x18C2, 0x1081, 0x10A2, 0x1081, 0x1061, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x20E3, 0x20E3, 0x20E3,   // 0x13DE0 (81376) pixels
-0x20E3, 0x2103, 0x2103, 0x18C2, 0x6B0B, 0x734C, 0x732B, 0x7B6C, 0x7B8E, 0x7BAD, 0x83CE, 0x83EE, 0x8C0E, 0x942F, 0x944F, 0x940F,   // 0x13DF0 (81392) pixels
-0x944F, 0x9C70, 0xA4B0, 0xA491, 0xA491, 0x9C8F, 0xA4D1, 0xA490, 0xA4B0, 0xA4D1, 0xA4F1, 0xA4B0, 0xA4B0, 0xACF2, 0xA4D1, 0xA4B0,   // 0x13E00 (81408) pixels
-0xACD1, 0xACF2, 0xA4D1, 0xA491, 0xA490, 0xA4D1, 0xA4B1, 0xA4B1, 0x9C70, 0x9C70, 0x9C70, 0x944F, 0x940F, 0x944F, 0x942F, 0x942F,   // 0x13E10 (81424) pixels
-0x9C6F, 0xC594, 0xDE77, 0xC594, 0xACD1, 0xA4D1, 0xA4B1, 0xA4D1, 0xA4B1, 0xA4D1, 0xA4D1, 0xACD1, 0xACD2, 0xACF2, 0xACD1, 0xACF2,   // 0x13E20 (81440) pixels
-0xACF2, 0xA4D1, 0xA4B1, 0x9C90, 0x9C70, 0x9C70, 0x9450, 0x944F, 0x9450, 0x944F, 0x9C70, 0xB511, 0xD636, 0xD636, 0xA4B1, 0x9C4F,   // 0x13E30 (81456) pixels
-0x942F, 0x942F, 0x942F, 0x940F, 0x9C70, 0x9C4F, 0x9C4F, 0x9C8F, 0x9C8F, 0xA490, 0xA4B1, 0xA4B0, 0xA4D1, 0xA4B0, 0xA4B1, 0xACF2,   // 0x13E40 (81472) pixels
-0xA4B1, 0xA4B2, 0xA4B1, 0xA490, 0xA490, 0xA4B1, 0xA4B2, 0xA48F, 0xA490, 0xA4B1, 0xA490, 0x9C70, 0x9C70, 0x9C70, 0x942F, 0x940F,   // 0x13E50 (81488) pixels
-0x940F, 0x8C0F, 0x83EE, 0x8BCE, 0x83AD, 0x7B6C, 0x736C, 0x734B, 0x6B0A, 0x6B0A, 0x62EA, 0x39C6, 0x2103, 0x2103, 0x20E3, 0x20E3,   // 0x13E60 (81504) pixels
-0x18E3, 0x20E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x0861, 0x1081, 0x1081, 0x0841, 0x1082, 0x10A2, 0x18A2, 0x18A2, 0x18C3,   // 0x13E70 (81520) pixels
-0x18C3, 0x18C2, 0x18C2, 0x10C2, 0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13E80 (81536) pixels
-0x10A2, 0x10A2, 0x18A3, 0x18A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0820, 0x0820, 0x0020, 0x0840,   // 0x13E90 (81552) pixels
-0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0841, 0x0861, 0x0861, 0x0861, 0x1081, 0x1061, 0x1062,   // 0x13EA0 (81568) pixels
-0x1061, 0x0861, 0x1081, 0x1081, 0x0881, 0x0861, 0x0861, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1082, 0x1061,   // 0x13EB0 (81584) pixels
-0x1082, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061,   // 0x13EC0 (81600) pixels
-0x0861, 0x0040, 0x0040, 0x0040, 0x0040, 0x0020, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861,   // 0x13ED0 (81616) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841,   // 0x13EE0 (81632) pixels
-0x0841, 0x0841, 0x0841, 0x0840, 0x0040, 0x0020, 0x0020, 0x0841, 0x18C2, 0x18C2, 0x10A2, 0x1082, 0x1082, 0x0841, 0x0020, 0x0020,   // 0x13EF0 (81648) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0840, 0x0861, 0x1081, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x13F00 (81664) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x2104, 0x18E3, 0x2104, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2104, 0x2103, 0x2103,   // 0x13F10 (81680) pixels
-0x2104, 0x2124, 0x2944, 0x2124, 0x18E3, 0x0861, 0x1081, 0x1082, 0x1081, 0x1081, 0x18C2, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0x13F20 (81696) pixels
-0x20E3, 0x20E3, 0x20E3, 0x18C2, 0x6B2B, 0x734B, 0x6B2B, 0x734B, 0x7B8D, 0x7BAC, 0x7BAD, 0x83EE, 0x8BEE, 0x942F, 0x942F, 0x940F,   // 0x13F30 (81712) pixels
-0x942F, 0x9C6F, 0x9C6F, 0xA491, 0xA48F, 0xA490, 0x9C6F, 0xA4B1, 0xA48F, 0xA490, 0xACD1, 0xACD1, 0xACB1, 0xA4B1, 0xACD2, 0xACD1,   // 0x13F40 (81728) pixels
-0xACF2, 0xACF1, 0xACF1, 0xA4D1, 0xA4B0, 0xA490, 0xA4B1, 0xACD1, 0x9C8F, 0x9C6F, 0x9C90, 0x946F, 0x942F, 0x942F, 0x940F, 0x942F,   // 0x13F50 (81744) pixels
-0x9C90, 0xC593, 0xDE77, 0xC5B4, 0xACF2, 0xA4D1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4D1, 0xA4D1, 0xA4D1, 0xACD1, 0xACD2, 0xACD2,   // 0x13F60 (81760) pixels
-0xACF2, 0xA4D1, 0xA4B0, 0x9C90, 0x9C70, 0x9C50, 0x944F, 0x942F, 0x942F, 0x942F, 0x9C50, 0xB512, 0xD615, 0xD615, 0xA4B0, 0x9C70,   // 0x13F70 (81776) pixels
-0x942F, 0x944F, 0x942F, 0x9C70, 0x944F, 0x9C90, 0x9C71, 0x9CB1, 0xA46F, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B0, 0xA4B0, 0xACF2, 0xACF2,   // 0x13F80 (81792) pixels
-0xACD2, 0xA4D0, 0xA4B1, 0xA4D2, 0xA4B1, 0xA4D1, 0xA490, 0xA490, 0xA48F, 0x9C90, 0x9C6F, 0x9C6F, 0x942F, 0x942F, 0x942F, 0x942F,   // 0x13F90 (81808) pixels
-0x940F, 0x8C0F, 0x8C0E, 0x83CE, 0x7BAD, 0x7B6C, 0x736C, 0x734D, 0x6B0B, 0x6B2B, 0x62CA, 0x39C6, 0x2103, 0x20E3, 0x20E3, 0x18E3,   // 0x13FA0 (81824) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x10A2, 0x10A2, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x13FB0 (81840) pixels
-0x18C2, 0x18C2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x13FC0 (81856) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1081, 0x0861, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x13FD0 (81872) pixels
-0x0020, 0x0020, 0x0861, 0x10A2, 0x10A2, 0x18C2, 0x1082, 0x0861, 0x0020, 0x0820, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082,   // 0x13FE0 (81888) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1061,   // 0x13FF0 (81904) pixels
-0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x1062, 0x1082, 0x1082, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x0881,   // 0x14000 (81920) pixels
-0x0861, 0x0861, 0x0040, 0x0040, 0x0020, 0x0041, 0x0020, 0x0840, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x14010 (81936) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841,   // 0x14020 (81952) pixels
-0x0841, 0x0820, 0x0020, 0x0020, 0x0841, 0x1082, 0x2924, 0x39C7, 0x4207, 0x4A28, 0x4A68, 0x4A69, 0x4A48, 0x39E7, 0x3185, 0x18C2,   // 0x14030 (81968) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0861, 0x0881, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x14040 (81984) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18E3, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2104,   // 0x14050 (82000) pixels
-0x2104, 0x2104, 0x2124, 0x2944, 0x2124, 0x10A2, 0x0841, 0x0020, 0x1081, 0x1081, 0x1081, 0x1082, 0x18C2, 0x18C3, 0x18C2, 0x18E3,   // 0x14060 (82016) pixels
-0x18E3, 0x20E3, 0x20E3, 0x18C2, 0x6B0B, 0x736C, 0x734C, 0x734C, 0x7B6C, 0x7B8D, 0x83AE, 0x8BCE, 0x83CE, 0x8BEE, 0x8C0F, 0x940F,   // 0x14070 (82032) pixels
-0x9C4F, 0x944F, 0x9C6F, 0x9C90, 0x9C8F, 0xA490, 0xA4B1, 0x9C90, 0xA4B1, 0xA4B1, 0xA4B0, 0xA4D1, 0xA4B1, 0xA4D1, 0xA4B0, 0xACD1,   // 0x14080 (82048) pixels
-0xAD12, 0xACD1, 0xA4D2, 0xACD1, 0xACD1, 0xACD2, 0xA4B0, 0xA4D1, 0xA490, 0xA490, 0x9C71, 0x942F, 0x942F, 0x942F, 0x942F, 0x9C70,   // 0x14090 (82064) pixels
-0x9C70, 0xBD73, 0xDE57, 0xC5B4, 0xACD1, 0xA4B1, 0xA4D1, 0xA4B1, 0xA4B1, 0xA4D1, 0xA4D1, 0xA4B1, 0xACD1, 0xACD2, 0xACD1, 0xACD1,   // 0x140A0 (82080) pixels
-0xA4D1, 0xA4B1, 0xA491, 0x9C70, 0x9C50, 0x9C50, 0x9C70, 0x9C70, 0x9C70, 0x9C70, 0x9C50, 0xB532, 0xD636, 0xD5F5, 0xA4B1, 0x9C6F,   // 0x140B0 (82096) pixels
-0x944F, 0x9450, 0x944F, 0x9C70, 0x942F, 0x9C70, 0xA4B0, 0x9C6F, 0xA490, 0xA490, 0xA4B1, 0xA4B1, 0xA4B1, 0xA490, 0xA4B1, 0xA4D1,   // 0x140C0 (82112) pixels
-0xACD1, 0xA4B0, 0xA4B0, 0xA48F, 0xA4B1, 0xA4B0, 0xA490, 0x9C6F, 0x9C70, 0x9C90, 0x9C6F, 0x9C70, 0x9C70, 0x942F, 0x8BEF, 0x942F,   // 0x140D0 (82128) pixels
-0x8C0F, 0x83EE, 0x83CE, 0x83CE, 0x83AE, 0x7B6C, 0x734C, 0x734B, 0x732B, 0x732B, 0x62CA, 0x39A6, 0x20E3, 0x20E3, 0x20E3, 0x18C3,   // 0x140E0 (82144) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18A2, 0x1081, 0x1081, 0x10A2, 0x1082, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3,   // 0x140F0 (82160) pixels
-0x18C3, 0x18C3, 0x10A3, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x18C2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x14100 (82176) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841,   // 0x14110 (82192) pixels
-0x18C3, 0x3185, 0x4207, 0x4A69, 0x5ACA, 0x630B, 0x4A69, 0x4228, 0x3185, 0x2124, 0x0861, 0x0020, 0x0841, 0x0841, 0x0861, 0x1061,   // 0x14120 (82208) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1081, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081,   // 0x14130 (82224) pixels
-0x1061, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x0881, 0x0861, 0x1061,   // 0x14140 (82240) pixels
-0x0861, 0x0861, 0x0040, 0x0040, 0x0020, 0x0040, 0x0061, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x14150 (82256) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840,   // 0x14160 (82272) pixels
-0x0820, 0x0020, 0x0020, 0x0020, 0x18C2, 0x2924, 0x41E7, 0x5249, 0x52A9, 0x630B, 0x5ACA, 0x5289, 0x5289, 0x4A48, 0x41E7, 0x3165,   // 0x14170 (82288) pixels
-0x18C2, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x0861, 0x0882, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x14180 (82304) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C3, 0x18E3, 0x2103, 0x2104, 0x2104, 0x2104, 0x2103, 0x2104, 0x2124,   // 0x14190 (82320) pixels
-0x2124, 0x2104, 0x2103, 0x2104, 0x2124, 0x18A2, 0x0861, 0x0020, 0x0020, 0x0841, 0x1081, 0x1081, 0x1082, 0x18C3, 0x18C2, 0x18C2,   // 0x141A0 (82336) pixels
-0x18E3, 0x20E3, 0x20E3, 0x18C3, 0x6B0B, 0x7B6D, 0x734C, 0x736C, 0x7B6D, 0x736C, 0x7BAD, 0x8BEE, 0x83EE, 0x8BEE, 0x8C0F, 0x942F,   // 0x141B0 (82352) pixels
-0x946F, 0x9C70, 0x9C70, 0x9C4F, 0x9C90, 0x9C6F, 0xA491, 0x9C90, 0xA490, 0xA4B1, 0xA4D1, 0xA4B1, 0xACD1, 0xA4B1, 0xA4B1, 0xACB1,   // 0x141C0 (82368) pixels
-0xACF1, 0xACF1, 0xACD1, 0xA4B0, 0xACB1, 0xACD1, 0xA4B0, 0xA490, 0xA4B1, 0xA491, 0x9C6F, 0x9C70, 0x944F, 0x9C4F, 0x944F, 0x9C50,   // 0x141D0 (82384) pixels
-0x9C90, 0xBD73, 0xD636, 0xBD94, 0xACD1, 0xA4D1, 0xA4D1, 0xA4B1, 0xA4B1, 0xA4D1, 0xA4D1, 0xA4D1, 0xACD1, 0xACD2, 0xACD1, 0xACD1,   // 0x141E0 (82400) pixels
-0xACD1, 0xA4B1, 0xA4B0, 0x9C90, 0x9C90, 0x9C70, 0x9C90, 0x9C90, 0x9C70, 0x9C70, 0x944F, 0xBD53, 0xD616, 0xCDD5, 0xA4B0, 0x9C90,   // 0x141F0 (82416) pixels
-0x944F, 0x942F, 0x944F, 0x9470, 0x9C2F, 0x9C4F, 0xA490, 0x9C91, 0x9C90, 0x9C8F, 0xA4B1, 0xA490, 0xA4B0, 0xA4B1, 0xA4D1, 0xA4B0,   // 0x14200 (82432) pixels
-0xA4D0, 0xA4B0, 0xA4B0, 0xA4D1, 0xA4B0, 0xA4B1, 0xA4B0, 0xA4B1, 0x9C91, 0x9C70, 0x946F, 0x9C91, 0x942F, 0x942F, 0x8C0F, 0x942F,   // 0x14210 (82448) pixels
-0x942F, 0x83EE, 0x83CD, 0x7BCD, 0x7B8C, 0x7B8D, 0x734B, 0x734C, 0x6B0B, 0x6B0A, 0x62EA, 0x39A6, 0x20E3, 0x20E3, 0x20E3, 0x18E3,   // 0x14220 (82464) pixels
-0x18C2, 0x18C3, 0x10A2, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0x14230 (82480) pixels
-0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x10C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x14240 (82496) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x10C2, 0x2104,   // 0x14250 (82512) pixels
-0x3185, 0x39C7, 0x4207, 0x5269, 0x62EA, 0x6B6C, 0x5ACA, 0x5AAA, 0x41E7, 0x39A6, 0x2924, 0x18C2, 0x0020, 0x0841, 0x0861, 0x1061,   // 0x14260 (82528) pixels
-0x1061, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1082, 0x1082, 0x1081, 0x1061, 0x1082, 0x1061, 0x1061, 0x1061, 0x1082,   // 0x14270 (82544) pixels
-0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061, 0x0881, 0x0861, 0x1081, 0x1081, 0x0861, 0x0861, 0x0861,   // 0x14280 (82560) pixels
-0x0861, 0x0861, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0000, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861,   // 0x14290 (82576) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020,   // 0x142A0 (82592) pixels
-0x0020, 0x0020, 0x0820, 0x18E3, 0x3165, 0x39E7, 0x5289, 0x5289, 0x5289, 0x62EB, 0x5A89, 0x4A48, 0x4A28, 0x41E7, 0x4A48, 0x4A48,   // 0x142B0 (82608) pixels
-0x39C7, 0x2945, 0x1081, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x0861, 0x1082, 0x10A2, 0x10A2,   // 0x142C0 (82624) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x18C3, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x2104,   // 0x142D0 (82640) pixels
-0x2124, 0x2103, 0x2103, 0x2103, 0x2124, 0x18C3, 0x0881, 0x0040, 0x0020, 0x0020, 0x0020, 0x0861, 0x1081, 0x1081, 0x18C2, 0x18C2,   // 0x142E0 (82656) pixels
-0x18C2, 0x18E3, 0x18E3, 0x18C2, 0x732B, 0x7B6C, 0x7B6D, 0x7B6C, 0x7B6C, 0x7B6C, 0x7B8D, 0x8BEF, 0x83EE, 0x83EE, 0x8C0F, 0x944F,   // 0x142F0 (82672) pixels
-0x942F, 0x942F, 0x9C70, 0x9C70, 0x9C4F, 0x9C6F, 0xA48F, 0xA4B1, 0xA4B0, 0x9C8F, 0x9C70, 0xA4B1, 0xA4B1, 0xA4B0, 0xA4D1, 0xACF2,   // 0x14300 (82688) pixels
-0xACF2, 0xA4D1, 0xA4D1, 0xA4B0, 0xACD1, 0xACB1, 0xA4B0, 0xA490, 0xA4B0, 0xA491, 0x9C4F, 0x9C70, 0x9C4F, 0x942F, 0x942F, 0x942F,   // 0x14310 (82704) pixels
-0xA491, 0xB552, 0xCDF5, 0xBD73, 0xA4D1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xACD1, 0xA4D1, 0xACD2, 0xACD2, 0xACD2, 0xACD1,   // 0x14320 (82720) pixels
-0xA4D1, 0xA4B1, 0xA4B1, 0xA490, 0xA490, 0x9C70, 0x9C70, 0x9C70, 0x9C50, 0x944F, 0x942F, 0xACF1, 0xCDF5, 0xCDD5, 0xA490, 0x9C70,   // 0x14330 (82736) pixels
-0x940F, 0x942F, 0x942F, 0x942F, 0x944F, 0x9C6F, 0x9C70, 0xA491, 0x9C90, 0xA490, 0xA490, 0xA4B0, 0xA490, 0xA490, 0xA4D1, 0xACD2,   // 0x14340 (82752) pixels
-0xA4D2, 0xA490, 0xA490, 0xA4B0, 0xA490, 0x9C90, 0x9C91, 0xA490, 0x9C71, 0x9C70, 0x946F, 0x9450, 0x940F, 0x8C2F, 0x940F, 0x940F,   // 0x14350 (82768) pixels
-0x8C0F, 0x8BEE, 0x83CD, 0x83AD, 0x7BAD, 0x7B8C, 0x7B6C, 0x734C, 0x732B, 0x734C, 0x62EA, 0x3185, 0x18E2, 0x18E3, 0x18C3, 0x18C2,   // 0x14360 (82784) pixels
-0x18C3, 0x1081, 0x1081, 0x1082, 0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0x14370 (82800) pixels
-0x10A2, 0x18C3, 0x18E3, 0x18E3, 0x10C2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x14380 (82816) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x1082, 0x2124, 0x39A6, 0x41E7,   // 0x14390 (82832) pixels
-0x4A28, 0x39C6, 0x39A6, 0x41E7, 0x4A68, 0x5ACA, 0x528A, 0x4A28, 0x5289, 0x4A28, 0x3165, 0x2944, 0x2104, 0x0820, 0x0841, 0x0861,   // 0x143A0 (82848) pixels
-0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1081, 0x1061, 0x1082, 0x1061, 0x1061, 0x1082, 0x1082,   // 0x143B0 (82864) pixels
-0x1082, 0x1061, 0x1081, 0x1062, 0x1082, 0x1061, 0x0861, 0x1081, 0x1061, 0x0881, 0x1061, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x143C0 (82880) pixels
-0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0020, 0x0040, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861,   // 0x143D0 (82896) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0020,   // 0x143E0 (82912) pixels
-0x0020, 0x0840, 0x10A2, 0x2944, 0x39E7, 0x4228, 0x5289, 0x5289, 0x5AAA, 0x5AA9, 0x5289, 0x5289, 0x5269, 0x41C6, 0x4A48, 0x5289,   // 0x143F0 (82928) pixels
-0x5269, 0x4207, 0x2965, 0x2103, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0841, 0x1081, 0x1082, 0x1082,   // 0x14400 (82944) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18E3, 0x2103, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x14410 (82960) pixels
-0x2124, 0x2124, 0x2104, 0x2103, 0x2104, 0x18E3, 0x1081, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x1061, 0x1081, 0x1081, 0x18C2,   // 0x14420 (82976) pixels
-0x18C3, 0x20E3, 0x20E3, 0x18C2, 0x6B2B, 0x7B8D, 0x7B8D, 0x7B8D, 0x7B8D, 0x7BAD, 0x83CE, 0x8BEF, 0x8BEF, 0x8BEF, 0x8C0F, 0x942F,   // 0x14430 (82992) pixels
-0x944F, 0x946F, 0x942F, 0x9C70, 0x946F, 0x9C90, 0xA490, 0xA4B1, 0xA4B1, 0xA490, 0xA4B1, 0xA4B0, 0xA4B0, 0xA4D2, 0xACD1, 0xA4D1,   // 0x14440 (83008) pixels
-0xACF2, 0xA4D0, 0xA4B0, 0xA4B1, 0xA4B1, 0xA490, 0xA4B1, 0xA4AF, 0x9C8F, 0x9C90, 0x944F, 0x942F, 0x944F, 0x942F, 0x942F, 0x944F,   // 0x14450 (83024) pixels
-0xA491, 0xB532, 0xCDD4, 0xB552, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4D1, 0xA4B1, 0xA4D1, 0xACD1, 0xACD1, 0xACD1, 0xACD1, 0xACD1,   // 0x14460 (83040) pixels
-0xA4D1, 0xA4D1, 0xA4D1, 0xA4B1, 0xA490, 0x9C90, 0x9C70, 0x9C50, 0x9450, 0x942F, 0x942F, 0x940F, 0xCDD5, 0xC5B4, 0x9C70, 0x942F,   // 0x14470 (83056) pixels
-0x942F, 0x8C0F, 0x944F, 0x940F, 0x942F, 0x9C50, 0x9C6F, 0x9C91, 0x9C6F, 0xA491, 0xA490, 0xA490, 0xA490, 0xA4B1, 0xA4D2, 0xA490,   // 0x14480 (83072) pixels
-0xA4D1, 0xA4B1, 0xA490, 0xA4B1, 0xA470, 0xA4B0, 0xA4B0, 0x9C6F, 0x9C6F, 0x9C70, 0x944F, 0x944F, 0x942F, 0x8C0F, 0x942F, 0x8C0F,   // 0x14490 (83088) pixels
-0x8BEE, 0x83EE, 0x8BEE, 0x7BAD, 0x7BAD, 0x7BCD, 0x7B8D, 0x7B8D, 0x734C, 0x734C, 0x62EA, 0x3185, 0x20E3, 0x18E3, 0x18C3, 0x1081,   // 0x144A0 (83104) pixels
-0x1081, 0x1081, 0x1081, 0x0820, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x10C2, 0x18C3, 0x18C3, 0x18C3,   // 0x144B0 (83120) pixels
-0x10A2, 0x18C3, 0x18E3, 0x10C2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x144C0 (83136) pixels
-0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x2104, 0x3185, 0x41E7, 0x4A49,   // 0x144D0 (83152) pixels
-0x4A48, 0x41E7, 0x41E7, 0x4227, 0x4A48, 0x5289, 0x5A89, 0x39C6, 0x5ACA, 0x5269, 0x39A6, 0x31A6, 0x3185, 0x2944, 0x0841, 0x0861,   // 0x144E0 (83168) pixels
-0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x144F0 (83184) pixels
-0x1061, 0x1082, 0x1061, 0x1062, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081,   // 0x14500 (83200) pixels
-0x0861, 0x0861, 0x0861, 0x0040, 0x0040, 0x0020, 0x0020, 0x0020, 0x0040, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x14510 (83216) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0840, 0x0020,   // 0x14520 (83232) pixels
-0x0020, 0x10A2, 0x20E3, 0x2965, 0x39E7, 0x41E7, 0x39E6, 0x39A6, 0x39A6, 0x39A6, 0x4207, 0x4A48, 0x4A69, 0x4207, 0x4A48, 0x5289,   // 0x14530 (83248) pixels
-0x5289, 0x4A48, 0x39C7, 0x3165, 0x20E3, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861,   // 0x14540 (83264) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18E3, 0x2104, 0x2103, 0x2104,   // 0x14550 (83280) pixels
-0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x20E3, 0x10A2, 0x0881, 0x0041, 0x0040, 0x0040, 0x0020, 0x0020, 0x0020, 0x1082, 0x1081,   // 0x14560 (83296) pixels
-0x1081, 0x1082, 0x18E3, 0x18C2, 0x62EB, 0x736C, 0x7B8D, 0x7BAD, 0x83AD, 0x83EE, 0x83EF, 0x83EE, 0x8C0F, 0x8C0F, 0x942F, 0x940F,   // 0x14570 (83312) pixels
-0x942F, 0x942F, 0x9C70, 0x944F, 0x9C4F, 0x9C71, 0x9C6F, 0x9C6F, 0xA4B0, 0xA490, 0xA4B0, 0xA4B0, 0xA4B1, 0xA4B0, 0xA490, 0xA4D1,   // 0x14580 (83328) pixels
-0xA4B0, 0xA490, 0xA4D1, 0xA46F, 0xA48F, 0xA4B1, 0x9C90, 0x9C70, 0x9C70, 0xA491, 0x9C4F, 0x9C70, 0x9C50, 0x940F, 0x942F, 0x942F,   // 0x14590 (83344) pixels
-0x9C70, 0xB512, 0xC594, 0xB532, 0xA4B1, 0xA490, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4D1, 0xA4D1, 0xA4D1, 0xACD1, 0xA4D1, 0xA4B1, 0xA4B1,   // 0x145A0 (83360) pixels
-0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0x9C70, 0x9C70, 0x9C70, 0x9C50, 0x944F, 0x942F, 0x944F, 0x940F, 0xCDD4, 0xC5B4, 0x9C90, 0x8C0F,   // 0x145B0 (83376) pixels
-0x942F, 0x8C0F, 0x942F, 0x940F, 0x942F, 0x942F, 0x9C70, 0x9C6F, 0x9C6F, 0xA491, 0xA491, 0x9C6F, 0xA490, 0xA48F, 0xA4B1, 0xA491,   // 0x145C0 (83392) pixels
-0xA4B1, 0xA490, 0xA490, 0xA48F, 0xA4B1, 0xA490, 0x9C6F, 0x9C70, 0x944F, 0x9C70, 0x942F, 0x944F, 0x942F, 0x8C0F, 0x940F, 0x940F,   // 0x145D0 (83408) pixels
-0x8C0F, 0x8BEF, 0x8BEF, 0x83CD, 0x83CE, 0x7BAC, 0x83AD, 0x7B8C, 0x736C, 0x732B, 0x6B0B, 0x3185, 0x18E3, 0x1081, 0x1081, 0x1081,   // 0x145E0 (83424) pixels
-0x1081, 0x0000, 0x0020, 0x1082, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x18C3,   // 0x145F0 (83440) pixels
-0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x14600 (83456) pixels
-0x10A2, 0x10A2, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x20E3, 0x3165, 0x31A6, 0x39A6,   // 0x14610 (83472) pixels
-0x39C6, 0x39C7, 0x39A6, 0x4207, 0x4A28, 0x4207, 0x5268, 0x5269, 0x62CB, 0x62EB, 0x5269, 0x4207, 0x39C6, 0x2965, 0x2944, 0x0841,   // 0x14620 (83488) pixels
-0x0841, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1081, 0x0881, 0x1061, 0x0861, 0x1061, 0x1061,   // 0x14630 (83504) pixels
-0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x0861, 0x1082, 0x1081, 0x1081, 0x1081, 0x1061, 0x0861, 0x1061, 0x1082, 0x1081, 0x1061,   // 0x14640 (83520) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0040, 0x0020, 0x0020, 0x0020, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841,   // 0x14650 (83536) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0020,   // 0x14660 (83552) pixels
-0x0861, 0x18C2, 0x18E3, 0x2103, 0x2104, 0x3185, 0x4207, 0x4207, 0x2965, 0x3185, 0x31A6, 0x31A6, 0x39C6, 0x2945, 0x2124, 0x39A6,   // 0x14670 (83568) pixels
-0x39E7, 0x39C6, 0x39A6, 0x2945, 0x2124, 0x10A2, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0041, 0x0861,   // 0x14680 (83584) pixels
-0x1081, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x18E3,   // 0x14690 (83600) pixels
-0x2104, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x18C3, 0x10C2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0841, 0x0020,   // 0x146A0 (83616) pixels
-0x10A2, 0x10A2, 0x1082, 0x1081, 0x6B0B, 0x7BAE, 0x7BAD, 0x7B8D, 0x7BCE, 0x83EE, 0x83CE, 0x8C0F, 0x8C0F, 0x8C0F, 0x940F, 0x8BEF,   // 0x146B0 (83632) pixels
-0x942F, 0x942F, 0x944F, 0x9C70, 0x9C2F, 0x9C70, 0x9C71, 0x9C70, 0x9C6F, 0x9C70, 0xA4B1, 0xA4D1, 0xA4B0, 0x9C90, 0x9C90, 0xA4B1,   // 0x146C0 (83648) pixels
-0xA4D1, 0xA4B0, 0xA490, 0xA4B0, 0xA491, 0xA490, 0x9C4F, 0x9C4F, 0x9C4F, 0x9C70, 0x9C70, 0x942F, 0x942F, 0x942F, 0x8C0F, 0x944F,   // 0x146D0 (83664) pixels
-0x9C70, 0xB511, 0xC593, 0xB532, 0xA4B1, 0xA4B0, 0xA4B0, 0xA490, 0xA4B0, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4D1, 0xA4B0, 0xA490,   // 0x146E0 (83680) pixels
-0xA4B0, 0xA490, 0xA490, 0xA490, 0x9C70, 0x9C70, 0x9C50, 0x9450, 0x942F, 0x942F, 0x944F, 0x9450, 0xCDB4, 0xC594, 0xA490, 0x942F,   // 0x146F0 (83696) pixels
-0x8C0F, 0x8C0E, 0x8C0F, 0x944F, 0x9C2F, 0x9C50, 0x942F, 0x9C6F, 0xA490, 0x9C70, 0xA4B1, 0x9C50, 0xA4B0, 0xA490, 0xA4B1, 0xA4B0,   // 0x14700 (83712) pixels
-0xA4B1, 0xA4B1, 0xA4B1, 0xA4B0, 0xA490, 0x9C90, 0xA490, 0x9C70, 0x9C6F, 0x942F, 0x942F, 0x942F, 0x9C50, 0x944F, 0x942F, 0x8C0F,   // 0x14710 (83728) pixels
-0x8BEE, 0x8BEE, 0x83ED, 0x83EE, 0x83EE, 0x83AD, 0x7BAE, 0x7BAD, 0x7B6D, 0x7B6C, 0x41E6, 0x1082, 0x1082, 0x1082, 0x1082, 0x0020,   // 0x14720 (83744) pixels
-0x0020, 0x0820, 0x0861, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18A2, 0x10C2, 0x10C2, 0x10C2, 0x18C3,   // 0x14730 (83760) pixels
-0x18C2, 0x18E3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082,   // 0x14740 (83776) pixels
-0x0861, 0x0861, 0x0020, 0x0020, 0x0820, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x10A2, 0x18C3, 0x18E3, 0x2124, 0x2104, 0x2124,   // 0x14750 (83792) pixels
-0x2104, 0x2103, 0x2124, 0x3185, 0x39C6, 0x3186, 0x3165, 0x3165, 0x4A49, 0x5AAA, 0x5A8A, 0x4A69, 0x39C6, 0x2944, 0x2965, 0x0841,   // 0x14760 (83808) pixels
-0x0841, 0x0841, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1081, 0x1061, 0x1061, 0x1082, 0x1082, 0x1061,   // 0x14770 (83824) pixels
-0x1082, 0x1082, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1061, 0x1061, 0x1082, 0x0881, 0x1061,   // 0x14780 (83840) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x14790 (83856) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0861,   // 0x147A0 (83872) pixels
-0x1082, 0x10A2, 0x10A2, 0x18E3, 0x2945, 0x39A6, 0x4207, 0x39C6, 0x2944, 0x2124, 0x2924, 0x2945, 0x2945, 0x2124, 0x20E3, 0x2124,   // 0x147B0 (83888) pixels
-0x2945, 0x2944, 0x2944, 0x1903, 0x18E3, 0x18C3, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0041,   // 0x147C0 (83904) pixels
-0x0861, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x2104,   // 0x147D0 (83920) pixels
-0x2103, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x10A2, 0x10A2,   // 0x147E0 (83936) pixels
-0x1082, 0x1082, 0x18C2, 0x10A2, 0x10A2, 0x18C3, 0x8BEE, 0x7BAD, 0x8BEF, 0x83EE, 0x83EE, 0x8C0F, 0x8BEF, 0x942F, 0x8C0F, 0x942F,   // 0x147F0 (83952) pixels
-0x9450, 0x944F, 0x944F, 0x9C70, 0x9C91, 0x9C6F, 0xA491, 0x9C90, 0xA4B1, 0xA491, 0xA490, 0xA4D1, 0xA491, 0xA4D1, 0x9C8F, 0xA48F,   // 0x14800 (83968) pixels
-0xA490, 0xA491, 0xA4B1, 0xA4B1, 0xA491, 0x9C6F, 0xA490, 0x9C90, 0x9C70, 0x9C70, 0x942F, 0x944F, 0x940F, 0x942F, 0x942F, 0x944F,   // 0x14810 (83984) pixels
-0x9C6F, 0xACD0, 0xCDB4, 0xB532, 0xA4B1, 0xA490, 0xA490, 0xA490, 0xA490, 0xA490, 0xA4B0, 0xA4B1, 0xA4D1, 0xA4D1, 0xA4D1, 0xA4B1,   // 0x14820 (84000) pixels
-0xA4B1, 0x9C90, 0x9C70, 0x9C90, 0x9C70, 0x9C70, 0x9C50, 0x944F, 0x942F, 0x942F, 0x942F, 0x942F, 0xC5B4, 0xBD93, 0x9C70, 0x8C0F,   // 0x14830 (84016) pixels
-0x942F, 0x8C0F, 0x942F, 0x942F, 0x944F, 0x944F, 0x9C50, 0x9C90, 0x9C4F, 0x9C70, 0x9C4F, 0x9C6F, 0x9C4F, 0xA490, 0xA491, 0xA46F,   // 0x14840 (84032) pixels
-0xA4B1, 0xA4B1, 0xA4D1, 0xA490, 0xA4B1, 0x9C90, 0x9C6F, 0x9C90, 0x9C6F, 0x9C8F, 0x944F, 0x9C6F, 0x942F, 0x9430, 0x8C0F, 0x942F,   // 0x14850 (84048) pixels
-0x940F, 0x8BEE, 0x8BEE, 0x8BEF, 0x83ED, 0x83CD, 0x83CD, 0x83CE, 0x83CE, 0x20E3, 0x10A2, 0x10A2, 0x10A2, 0x0841, 0x0841, 0x0861,   // 0x14860 (84064) pixels
-0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18C2, 0x10C2, 0x10A2, 0x18C3,   // 0x14870 (84080) pixels
-0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861,   // 0x14880 (84096) pixels
-0x0861, 0x0020, 0x0020, 0x0820, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x1082, 0x10A2, 0x18C2, 0x2924, 0x2965, 0x2944,   // 0x14890 (84112) pixels
-0x20E3, 0x18C2, 0x18E3, 0x2944, 0x2965, 0x2103, 0x2104, 0x3165, 0x41E7, 0x4A28, 0x5249, 0x5269, 0x4A48, 0x39A6, 0x2965, 0x10A2,   // 0x148A0 (84128) pixels
-0x0841, 0x0841, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061, 0x0861, 0x1061, 0x1062, 0x1061, 0x1082,   // 0x148B0 (84144) pixels
-0x1081, 0x1081, 0x1082, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1061, 0x1081, 0x1082, 0x1081, 0x0861,   // 0x148C0 (84160) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861, 0x0861,   // 0x148D0 (84176) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0820, 0x0020, 0x1082,   // 0x148E0 (84192) pixels
-0x0861, 0x10A2, 0x18E3, 0x2104, 0x39A6, 0x39A6, 0x39A6, 0x41E7, 0x2924, 0x18C3, 0x18C3, 0x2104, 0x2124, 0x18E3, 0x18C3, 0x18E3,   // 0x148F0 (84208) pixels
-0x18C3, 0x18A2, 0x10A2, 0x10A2, 0x2103, 0x2124, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x14900 (84224) pixels
-0x0020, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x14910 (84240) pixels
-0x18E3, 0x2104, 0x20E3, 0x2104, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x14920 (84256) pixels
-0x2104, 0x2103, 0x2103, 0x18C2, 0x18E3, 0x18A2, 0x10A2, 0x18A2, 0x942F, 0x942F, 0x8C0F, 0x8BEF, 0x942F, 0x942F, 0x942F, 0x942F,   // 0x14930 (84272) pixels
-0x944F, 0x944F, 0x9C70, 0x9C6F, 0x9C70, 0x9C6F, 0x9C90, 0xA4B1, 0xA490, 0xA4B0, 0xA490, 0xA4B0, 0xA490, 0xA4B1, 0xA4B0, 0xA4D1,   // 0x14940 (84288) pixels
-0xA4B1, 0xA4B1, 0xA490, 0xA4B1, 0xA48F, 0xA490, 0xA4B1, 0xA490, 0x9C70, 0x9C4F, 0x944F, 0x942F, 0x93EF, 0x8BEF, 0x942F, 0x942F,   // 0x14950 (84304) pixels
-0x9C91, 0xACD1, 0xBD72, 0xACF1, 0xA490, 0x9C70, 0x9C90, 0x9C90, 0xA490, 0xA491, 0xA490, 0xA4B1, 0xA4B1, 0xA4D1, 0xA4D1, 0xA4D1,   // 0x14960 (84320) pixels
-0xA4D1, 0xACB1, 0xA4B1, 0x9C90, 0x9C70, 0x9C50, 0x9C50, 0x9C50, 0x944F, 0x942F, 0x942F, 0x9C6F, 0xBD73, 0xBD73, 0xA4B0, 0x944F,   // 0x14970 (84336) pixels
-0x8C0E, 0x8C0F, 0x8C0F, 0x940F, 0x942F, 0x944F, 0x9C4F, 0x9C2F, 0x942F, 0x9C90, 0x9C70, 0x9C90, 0xA491, 0x9C90, 0xA4B0, 0xA491,   // 0x14980 (84352) pixels
-0xA4B1, 0xA490, 0xA4B0, 0xA4B0, 0xA4D1, 0xA491, 0xA490, 0xA490, 0xA491, 0x9C8F, 0x9C6F, 0x9C70, 0x9C50, 0x9C50, 0x944F, 0x942F,   // 0x14990 (84368) pixels
-0x940E, 0x8BEE, 0x8BEE, 0x8C0F, 0x8C0F, 0x8C0F, 0x4A27, 0x18A2, 0x10A2, 0x10A2, 0x18C2, 0x1061, 0x10A2, 0x18C2, 0x18E3, 0x18E3,   // 0x149A0 (84384) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C3, 0x18C3, 0x10A2,   // 0x149B0 (84400) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0841,   // 0x149C0 (84416) pixels
-0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x1082, 0x10A2, 0x2104, 0x3185, 0x3186,   // 0x149D0 (84432) pixels
-0x2124, 0x10A2, 0x18C2, 0x2124, 0x2124, 0x2124, 0x20E3, 0x2103, 0x39A6, 0x41E7, 0x5269, 0x5ACA, 0x5AAA, 0x39C6, 0x3185, 0x2103,   // 0x149E0 (84448) pixels
-0x0861, 0x0841, 0x0861, 0x1062, 0x0861, 0x0861, 0x1062, 0x1061, 0x1061, 0x0861, 0x0861, 0x1082, 0x0861, 0x0881, 0x1061, 0x1061,   // 0x149F0 (84464) pixels
-0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1061, 0x1082, 0x1082, 0x1061, 0x1061, 0x1081, 0x1082, 0x1061, 0x1061, 0x1082,   // 0x14A00 (84480) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0840, 0x0861, 0x0861, 0x0861,   // 0x14A10 (84496) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0020, 0x1082,   // 0x14A20 (84512) pixels
-0x1082, 0x18E3, 0x2124, 0x2924, 0x39A6, 0x3165, 0x2945, 0x39C7, 0x2124, 0x10A2, 0x10A2, 0x2103, 0x2924, 0x18E3, 0x18C2, 0x18C2,   // 0x14A30 (84528) pixels
-0x18A2, 0x1082, 0x1082, 0x1082, 0x18E3, 0x18E3, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000,   // 0x14A40 (84544) pixels
-0x0020, 0x0020, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2,   // 0x14A50 (84560) pixels
-0x10A2, 0x18C3, 0x18E3, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x14A60 (84576) pixels
-0x2124, 0x2124, 0x2124, 0x2104, 0x18E3, 0x18C2, 0x18A2, 0x10A2, 0x18A2, 0x18C2, 0x9C70, 0x942F, 0x942F, 0x942F, 0x9C4F, 0x9C50,   // 0x14A70 (84592) pixels
-0x9C50, 0x9C70, 0x9C90, 0x9C90, 0x9C90, 0x9C90, 0xA4B1, 0xA4B1, 0xA4B0, 0xA4D1, 0xA4B0, 0xA4D1, 0xA4B0, 0xACD1, 0xACF2, 0xA4D0,   // 0x14A80 (84608) pixels
-0xA4B0, 0xA490, 0xA4B0, 0xA491, 0xA4B1, 0xA4B0, 0xA490, 0x9C90, 0x9C71, 0x9C70, 0x9C4F, 0x944F, 0x942F, 0x942F, 0x8C0F, 0x940F,   // 0x14A90 (84624) pixels
-0x9C8F, 0xA4D0, 0xBD52, 0xACF1, 0x9C70, 0x9C70, 0x9C70, 0x9C90, 0xA4B0, 0xA490, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1,   // 0x14AA0 (84640) pixels
-0xA4B1, 0xA4B1, 0xA4B0, 0xA4B0, 0x9C90, 0x9C70, 0x9C70, 0x9C90, 0x9C70, 0x9C70, 0x942F, 0xACF1, 0xB532, 0xB512, 0xA4D1, 0x9C70,   // 0x14AB0 (84656) pixels
-0x8C0E, 0x8C0F, 0x942F, 0x940F, 0x942F, 0x942F, 0x9C70, 0x9C4F, 0x9C4F, 0x9C4F, 0x9C6F, 0x9C6F, 0xA4B0, 0x9C90, 0xA491, 0xACB1,   // 0x14AC0 (84672) pixels
-0xA4B0, 0xA4B1, 0xA4D1, 0xA4B1, 0xA490, 0xA4D1, 0xA4B1, 0x9C90, 0x9CB1, 0x9C90, 0x9C70, 0x9C70, 0x9C6F, 0x9C70, 0x942F, 0x942F,   // 0x14AD0 (84688) pixels
-0x942F, 0x8C0F, 0x8BEE, 0x942F, 0x944F, 0x18C3, 0x18A2, 0x10A2, 0x18A2, 0x1081, 0x10A2, 0x18C2, 0x18E3, 0x2103, 0x2124, 0x18E3,   // 0x14AE0 (84704) pixels
-0x18C3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18C3, 0x10A2, 0x10A2,   // 0x14AF0 (84720) pixels
-0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1061, 0x0861, 0x0000,   // 0x14B00 (84736) pixels
-0x0020, 0x0020, 0x0840, 0x0841, 0x0840, 0x0841, 0x0820, 0x0020, 0x0000, 0x0020, 0x1081, 0x10A2, 0x10A2, 0x2103, 0x3185, 0x39A6,   // 0x14B10 (84752) pixels
-0x2945, 0x0861, 0x0841, 0x18C3, 0x2103, 0x2965, 0x20E3, 0x1082, 0x3186, 0x4207, 0x5269, 0x5ACA, 0x52AA, 0x4207, 0x31A6, 0x18E3,   // 0x14B20 (84768) pixels
-0x1082, 0x0841, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0881, 0x0861, 0x1082, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061,   // 0x14B30 (84784) pixels
-0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1082, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1082, 0x1061,   // 0x14B40 (84800) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x0861,   // 0x14B50 (84816) pixels
-0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0020, 0x0020, 0x0020, 0x18A2,   // 0x14B60 (84832) pixels
-0x18C3, 0x2104, 0x2945, 0x3186, 0x39A6, 0x2924, 0x18E3, 0x2945, 0x2124, 0x18C2, 0x0820, 0x18C2, 0x2945, 0x3165, 0x2104, 0x18C3,   // 0x14B70 (84848) pixels
-0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18A2, 0x18C2, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0841, 0x0020,   // 0x14B80 (84864) pixels
-0x0020, 0x0000, 0x0020, 0x0861, 0x1081, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x14B90 (84880) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x2103, 0x1903, 0x2104, 0x2104, 0x2104, 0x2104, 0x2124, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124,   // 0x14BA0 (84896) pixels
-0x2124, 0x2944, 0x2124, 0x2104, 0x2103, 0x20E3, 0x18C2, 0x1082, 0x18C2, 0x10A2, 0x18A2, 0x18C2, 0x944F, 0x9C50, 0x944F, 0x944F,   // 0x14BB0 (84912) pixels
-0x9C4F, 0x9C70, 0x9C91, 0x9C90, 0xA4B1, 0xA490, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4D1, 0xA4D1, 0xAD11, 0xACD1, 0xACF2, 0xA4D1, 0xACF1,   // 0x14BC0 (84928) pixels
-0xACF2, 0xACD1, 0xA4B1, 0xA4D1, 0xA4B0, 0xA4B1, 0xA490, 0xA4B1, 0x9C90, 0x9C50, 0x9450, 0x942F, 0x9C50, 0x944F, 0x9450, 0x9C70,   // 0x14BD0 (84944) pixels
-0x9C70, 0x942F, 0xACF1, 0xA4D0, 0x9C70, 0x9C70, 0x9C70, 0xA491, 0xA491, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA490, 0xA4B1, 0xA4B1,   // 0x14BE0 (84960) pixels
-0xA4B1, 0xA491, 0xA490, 0xA4B1, 0xA490, 0xA490, 0x9C70, 0x9C90, 0x9C70, 0x9C70, 0x9C50, 0xACD1, 0xAD11, 0xACF1, 0xACF2, 0xA4B1,   // 0x14BF0 (84976) pixels
-0x8C0F, 0x8C0F, 0x8C0F, 0x942F, 0x9C2F, 0x9C70, 0x944F, 0x9C91, 0x9C70, 0x9C8F, 0x9C70, 0xA4B1, 0xA4D0, 0xA491, 0xA48F, 0xACD1,   // 0x14C00 (84992) pixels
-0xA4B0, 0xA4D1, 0xA4D1, 0xA4B0, 0xA4B1, 0xA4B0, 0xA4B0, 0xA4B0, 0xA4B1, 0x9C90, 0xA491, 0x9C6F, 0x9C70, 0x942F, 0x944F, 0x8C0F,   // 0x14C10 (85008) pixels
-0x9450, 0x9C6F, 0x942F, 0x18A2, 0x18A2, 0x10A2, 0x1082, 0x0841, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x18C3, 0x2924, 0x2944, 0x2103,   // 0x14C20 (85024) pixels
-0x20E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18C2, 0x10A2, 0x10A2, 0x10A2,   // 0x14C30 (85040) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0841, 0x0020, 0x0020,   // 0x14C40 (85056) pixels
-0x0840, 0x0841, 0x0840, 0x0841, 0x0841, 0x0841, 0x0820, 0x0020, 0x0000, 0x0861, 0x1082, 0x18A2, 0x18A2, 0x18E3, 0x3165, 0x39A6,   // 0x14C50 (85072) pixels
-0x39A6, 0x18C2, 0x1081, 0x0840, 0x1082, 0x20E3, 0x0861, 0x1082, 0x2924, 0x4207, 0x6B2C, 0x736D, 0x5ACA, 0x4A69, 0x31A6, 0x18C2,   // 0x14C60 (85088) pixels
-0x1082, 0x0841, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0881, 0x1081, 0x1082, 0x1081, 0x1061,   // 0x14C70 (85104) pixels
-0x1061, 0x1081, 0x1061, 0x0881, 0x1061, 0x1082, 0x1061, 0x1082, 0x1061, 0x1081, 0x1081, 0x1061, 0x1081, 0x0881, 0x1082, 0x1061,   // 0x14C80 (85120) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0841, 0x0861,   // 0x14C90 (85136) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0840, 0x0020, 0x0020, 0x0840, 0x18E3,   // 0x14CA0 (85152) pixels
-0x2104, 0x2924, 0x2944, 0x3186, 0x3186, 0x2945, 0x2924, 0x39A6, 0x3185, 0x20E3, 0x0841, 0x10A2, 0x2124, 0x18E3, 0x1082, 0x1082,   // 0x14CB0 (85168) pixels
-0x18C3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x0841,   // 0x14CC0 (85184) pixels
-0x0020, 0x0000, 0x0000, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x14CD0 (85200) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x2103, 0x1903, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x14CE0 (85216) pixels
-0x2124, 0x2944, 0x2944, 0x2124, 0x2124, 0x2104, 0x2103, 0x18E3, 0x18A2, 0x1081, 0x18C2, 0x18A2, 0x18C2, 0x39C6, 0xA4B1, 0x944F,   // 0x14CF0 (85232) pixels
-0x9C91, 0x9C91, 0xA490, 0x9C91, 0xA4B1, 0xA491, 0xA4D1, 0xA4B1, 0xA4B0, 0xA4F2, 0xA4F1, 0xACD1, 0xAD12, 0xACF2, 0xA4D1, 0xACF2,   // 0x14D00 (85248) pixels
-0xACF2, 0xACF2, 0xACF2, 0xA4D2, 0xA4B1, 0xA4B0, 0xA490, 0x9C90, 0x9C8F, 0x9C90, 0x944F, 0x9470, 0x9C70, 0x9C70, 0x9C70, 0x9C70,   // 0x14D10 (85264) pixels
-0xA491, 0x940E, 0xB512, 0xA490, 0x9C70, 0x9C90, 0xA490, 0xA4B0, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1,   // 0x14D20 (85280) pixels
-0xA4B1, 0xA490, 0xA490, 0xA4B0, 0xA490, 0x9C90, 0xA490, 0x9C70, 0x9C70, 0x9C4F, 0x944F, 0xA490, 0xACD1, 0xA4D0, 0xACF2, 0xA490,   // 0x14D30 (85296) pixels
-0x942F, 0x8BEE, 0x8C0F, 0x940F, 0x942F, 0x9C70, 0x9C70, 0x9CB1, 0xA4B0, 0xA491, 0xA4B1, 0xA490, 0xA490, 0xA490, 0xA4B0, 0xA4B0,   // 0x14D40 (85312) pixels
-0xA4D1, 0xA4D1, 0xA4F2, 0xA4B1, 0xA4D2, 0xA4B0, 0xA4B1, 0xA491, 0xA490, 0xA4B1, 0xA4B0, 0x9C4F, 0x9C70, 0x942F, 0x9C50, 0x9C70,   // 0x14D50 (85328) pixels
-0xA4B1, 0x18A2, 0x18A2, 0x10A2, 0x18A2, 0x0861, 0x1082, 0x10A2, 0x18A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x2944, 0x2944, 0x2103,   // 0x14D60 (85344) pixels
-0x20E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x14D70 (85360) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0841, 0x0020, 0x0820, 0x0841,   // 0x14D80 (85376) pixels
-0x0841, 0x0840, 0x0840, 0x0841, 0x0841, 0x0841, 0x0820, 0x0020, 0x0020, 0x1082, 0x1081, 0x0861, 0x18C2, 0x2124, 0x3185, 0x3185,   // 0x14D90 (85392) pixels
-0x3186, 0x2103, 0x1082, 0x0841, 0x0861, 0x1082, 0x1082, 0x20E4, 0x39E7, 0x5289, 0x6B2C, 0x6B4C, 0x630C, 0x5269, 0x31A6, 0x18C2,   // 0x14DA0 (85408) pixels
-0x10A2, 0x0841, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x1081, 0x0861,   // 0x14DB0 (85424) pixels
-0x1061, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1082, 0x1061,   // 0x14DC0 (85440) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x0020, 0x0020, 0x0841,   // 0x14DD0 (85456) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0000, 0x0841, 0x2104,   // 0x14DE0 (85472) pixels
-0x2124, 0x2124, 0x2944, 0x3165, 0x2124, 0x20E3, 0x18A2, 0x18C2, 0x18A2, 0x1081, 0x0841, 0x0861, 0x1082, 0x0861, 0x0841, 0x18E3,   // 0x14DF0 (85488) pixels
-0x2944, 0x2965, 0x2124, 0x18E3, 0x2103, 0x18C3, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0841,   // 0x14E00 (85504) pixels
-0x0841, 0x0020, 0x0020, 0x0000, 0x0020, 0x0841, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x14E10 (85520) pixels
-0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18E3, 0x2104, 0x2104, 0x2124, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x14E20 (85536) pixels
-0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2103, 0x10A2, 0x20E3, 0x18A2, 0x18A2, 0x18C2,   // 0x14E30 (85552) pixels
-0x4A07, 0xA4B1, 0x9C90, 0x9C91, 0x9C91, 0x9CB1, 0x9CB1, 0x9C8F, 0xA4B0, 0xACF2, 0xA4D1, 0xA4D1, 0xACD1, 0xACD1, 0xACF2, 0xA4D1,   // 0x14E40 (85568) pixels
-0xA4D1, 0xACF2, 0xA4D1, 0xA4D1, 0xA4B1, 0xA4B1, 0xA4B1, 0x9C70, 0x9C6F, 0x9C6F, 0x9450, 0x946F, 0x9C70, 0x9C6F, 0x944F, 0x9C70,   // 0x14E50 (85584) pixels
-0xA490, 0x8BEE, 0xACF1, 0xA48F, 0x9C90, 0xA490, 0xA490, 0xA4B1, 0xA4D1, 0xA4D1, 0xA4B1, 0xA4D1, 0xA4D1, 0xA4D1, 0xA4D1, 0xA4B1,   // 0x14E60 (85600) pixels
-0xA4B1, 0xA4B1, 0xA4B1, 0xA490, 0xA490, 0xA4B1, 0xA490, 0x9C70, 0x9C70, 0x9450, 0x944F, 0x9C6F, 0x9C6F, 0x9C90, 0xAD12, 0x9C90,   // 0x14E70 (85616) pixels
-0x942F, 0x8BEF, 0x942F, 0x944F, 0x942F, 0x942F, 0x9C90, 0x9C91, 0x9C90, 0xA4B1, 0xA4D1, 0xA4B1, 0x9CB1, 0xA4D2, 0xA4B0, 0xA490,   // 0x14E80 (85632) pixels
-0xA490, 0xACF2, 0xACF2, 0xA4D2, 0xA4D1, 0xA4D2, 0xA491, 0x9C91, 0x9C70, 0x9C4F, 0x9C90, 0x9C6F, 0xA490, 0xA4B1, 0x2924, 0x18C2,   // 0x14E90 (85648) pixels
-0x18A2, 0x18A2, 0x18C2, 0x0861, 0x10A2, 0x18C3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x18C3,   // 0x14EA0 (85664) pixels
-0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x14EB0 (85680) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0020, 0x0020, 0x0841, 0x0861, 0x0841,   // 0x14EC0 (85696) pixels
-0x0840, 0x0840, 0x0841, 0x0841, 0x0841, 0x0840, 0x0020, 0x0020, 0x0020, 0x1082, 0x0861, 0x0861, 0x18C2, 0x2124, 0x2945, 0x2124,   // 0x14ED0 (85712) pixels
-0x3186, 0x3185, 0x20E3, 0x1061, 0x0841, 0x1082, 0x39A6, 0x62EB, 0x6B4C, 0x736C, 0x6B4C, 0x6B2C, 0x4A69, 0x4248, 0x39C6, 0x2103,   // 0x14EE0 (85728) pixels
-0x10A2, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1081, 0x0861, 0x1061, 0x1061,   // 0x14EF0 (85744) pixels
-0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1061, 0x1082, 0x1082, 0x1061,   // 0x14F00 (85760) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020,   // 0x14F10 (85776) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0020, 0x0000, 0x0020, 0x18C2,   // 0x14F20 (85792) pixels
-0x20E3, 0x2104, 0x2124, 0x18E3, 0x1903, 0x18C2, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x10A2, 0x2103, 0x3186, 0x39C7, 0x3186,   // 0x14F30 (85808) pixels
-0x3186, 0x3165, 0x20E3, 0x10A2, 0x1082, 0x1082, 0x0020, 0x0841, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0820,   // 0x14F40 (85824) pixels
-0x0820, 0x0840, 0x0040, 0x0020, 0x0020, 0x0020, 0x0841, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2,   // 0x14F50 (85840) pixels
-0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x20E3, 0x2124, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x14F60 (85856) pixels
-0x2124, 0x2124, 0x2124, 0x2124, 0x2945, 0x2945, 0x2945, 0x2924, 0x2124, 0x2924, 0x2124, 0x2104, 0x20E3, 0x18A2, 0x18C2, 0x18C3,   // 0x14F70 (85872) pixels
-0x18A2, 0x18A2, 0x18C2, 0x18C2, 0x9C50, 0xACF2, 0xA4B1, 0xA4B1, 0x9C91, 0x9C70, 0x9C90, 0xA4B1, 0xA4D2, 0xACF1, 0xA4D0, 0xACF2,   // 0x14F80 (85888) pixels
-0xACD2, 0xA4D1, 0xA4D0, 0xA4F2, 0xA4D1, 0xA4D1, 0xA490, 0xA4B1, 0xA4B1, 0x9C90, 0x9C70, 0xA470, 0x9C70, 0x9C70, 0x9C70, 0x9C70,   // 0x14F90 (85904) pixels
-0xA4B1, 0x83CD, 0xA48F, 0x9C6F, 0x9C90, 0xA4B1, 0xA4B1, 0xA4D1, 0xA4D1, 0xA4D1, 0xA4D1, 0xACF2, 0xACF2, 0xACF2, 0xACF2, 0xACF1,   // 0x14FA0 (85920) pixels
-0xACD2, 0xA4D2, 0xA4D1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0x9C90, 0x9C70, 0x944F, 0x8C0F, 0x9C4F, 0x8BEE, 0xB512, 0xA4B0,   // 0x14FB0 (85936) pixels
-0x942F, 0x940F, 0x9C70, 0x9C4F, 0x944F, 0x9C70, 0x9C70, 0x9C4F, 0x944F, 0x9C90, 0x9C91, 0xA4D2, 0xA4B0, 0xA490, 0x9C90, 0x9C90,   // 0x14FC0 (85952) pixels
-0xA4B0, 0xA4D1, 0x9C8F, 0xA4B1, 0xA490, 0x9C70, 0x9C50, 0x9C71, 0x9C70, 0xA4D1, 0x5AA9, 0x18C2, 0x18A2, 0x18A2, 0x10A2, 0x18A2,   // 0x14FD0 (85968) pixels
-0x1081, 0x1061, 0x1082, 0x18A2, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x2104,   // 0x14FE0 (85984) pixels
-0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x18E3, 0x18C2, 0x18C3, 0x18C3, 0x1082, 0x10A2, 0x10C3, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2,   // 0x14FF0 (86000) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0841, 0x0020, 0x0020, 0x0820, 0x0861, 0x0841, 0x0841,   // 0x15000 (86016) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0861, 0x1082, 0x1082, 0x2104, 0x3185, 0x2965, 0x2124,   // 0x15010 (86032) pixels
-0x3165, 0x2924, 0x18C3, 0x0861, 0x0861, 0x1082, 0x2924, 0x4A49, 0x5AAA, 0x5AAA, 0x5AAA, 0x528A, 0x5269, 0x4207, 0x3186, 0x18E3,   // 0x15020 (86048) pixels
-0x1082, 0x0841, 0x0861, 0x1062, 0x0861, 0x1061, 0x0881, 0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081,   // 0x15030 (86064) pixels
-0x0861, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1061, 0x1082, 0x1081, 0x1082, 0x1082, 0x1061, 0x1082,   // 0x15040 (86080) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x0020,   // 0x15050 (86096) pixels
-0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x1082,   // 0x15060 (86112) pixels
-0x10A2, 0x20E3, 0x20E3, 0x20E3, 0x2124, 0x2104, 0x18C3, 0x10A2, 0x2103, 0x18C3, 0x1082, 0x18C3, 0x2965, 0x4A48, 0x5269, 0x41E7,   // 0x15070 (86128) pixels
-0x39A6, 0x2965, 0x18E3, 0x1082, 0x1082, 0x0861, 0x0020, 0x0841, 0x0841, 0x0840, 0x0040, 0x0020, 0x0040, 0x0840, 0x0841, 0x0820,   // 0x15080 (86144) pixels
-0x0020, 0x0020, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x15090 (86160) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x18C3, 0x2104, 0x2104, 0x2124, 0x2104, 0x2124, 0x2124,   // 0x150A0 (86176) pixels
-0x2124, 0x2124, 0x2124, 0x2124, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x2124, 0x2104, 0x20E3, 0x18E3, 0x18C3,   // 0x150B0 (86192) pixels
-0x10A2, 0x18C3, 0x18C2, 0x18A2, 0x18C2, 0x18C2, 0x5248, 0xACF1, 0xA4B1, 0xA4B1, 0x9CB0, 0xA4B0, 0x9CB0, 0xACF1, 0xA4F2, 0xA4B1,   // 0x150C0 (86208) pixels
-0xA4D0, 0xA4F1, 0xA4D2, 0xA4B1, 0xA4B0, 0xA4B0, 0xA4B0, 0xA4B1, 0xA4B1, 0x9C70, 0x9C6F, 0x9C91, 0x942F, 0x944F, 0x942F, 0x942F,   // 0x150D0 (86224) pixels
-0xA490, 0x7B6C, 0x9C6F, 0x8C2F, 0xA4B0, 0xA4B1, 0xA4B1, 0xA4D1, 0xACF2, 0xACF2, 0xACF2, 0xACF2, 0xACF2, 0xACF2, 0xACF2, 0xACF1,   // 0x150E0 (86240) pixels
-0xACF2, 0xACF2, 0xACF1, 0xA4D1, 0xA4D1, 0xA4B1, 0xA4B1, 0xA490, 0x9C90, 0x9C70, 0x9C50, 0x8BEE, 0x8C0E, 0x83CD, 0xB512, 0x9C90,   // 0x150F0 (86256) pixels
-0x9C70, 0x9C50, 0x9450, 0x9C50, 0x944F, 0x9C70, 0x9C90, 0x9C50, 0x9C70, 0x9C70, 0x9C70, 0xA4B0, 0xA4B0, 0xA490, 0xA4D1, 0x9C90,   // 0x15100 (86272) pixels
-0xA4B0, 0xA4D1, 0xA4B0, 0xA4B1, 0x9C8F, 0xA4B1, 0xA4B0, 0xACD1, 0x5AA9, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18C2, 0x0861, 0x0861,   // 0x15110 (86288) pixels
-0x1082, 0x18A2, 0x18A2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3,   // 0x15120 (86304) pixels
-0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15130 (86320) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x15140 (86336) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0820, 0x0020, 0x0000, 0x0821, 0x1061, 0x1082, 0x2104, 0x2945, 0x2945, 0x2124,   // 0x15150 (86352) pixels
-0x2924, 0x18C3, 0x1082, 0x2124, 0x3185, 0x2124, 0x18C3, 0x3165, 0x4A69, 0x4A49, 0x5269, 0x4A49, 0x4208, 0x39C7, 0x3185, 0x18C3,   // 0x15160 (86368) pixels
-0x0861, 0x0841, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x1082,   // 0x15170 (86384) pixels
-0x0861, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1081, 0x1061,   // 0x15180 (86400) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x15190 (86416) pixels
-0x0020, 0x0041, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0820, 0x0020, 0x0020, 0x0841,   // 0x151A0 (86432) pixels
-0x0861, 0x18C3, 0x18E3, 0x2104, 0x2924, 0x2924, 0x2104, 0x2104, 0x3185, 0x2944, 0x18C3, 0x20E3, 0x3185, 0x4A28, 0x4208, 0x39E7,   // 0x151B0 (86448) pixels
-0x3186, 0x2924, 0x10A2, 0x0861, 0x1082, 0x0861, 0x0020, 0x0861, 0x0861, 0x0861, 0x0841, 0x0840, 0x0840, 0x0841, 0x0840, 0x0840,   // 0x151C0 (86464) pixels
-0x0020, 0x0020, 0x0820, 0x0861, 0x1082, 0x1061, 0x0881, 0x1061, 0x0020, 0x0040, 0x0881, 0x0881, 0x0882, 0x1082, 0x10A2, 0x10A2,   // 0x151D0 (86480) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x18A2, 0x18C3, 0x2104, 0x2124, 0x2124, 0x2124,   // 0x151E0 (86496) pixels
-0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2144, 0x2924, 0x2124, 0x2944, 0x2945, 0x2924, 0x2945, 0x2944, 0x2924, 0x2124, 0x2124,   // 0x151F0 (86512) pixels
-0x2124, 0x2103, 0x20E3, 0x18C3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x2103, 0xA4B1, 0xACF2, 0xA4D2, 0xACF2, 0xA4D1, 0xA4B0,   // 0x15200 (86528) pixels
-0xA4B2, 0xA4D1, 0xA4B0, 0xA4B1, 0xA4B1, 0xA4B2, 0xA4B1, 0x9C90, 0x9C70, 0x9C91, 0xA4B1, 0x9C91, 0x944F, 0x942F, 0x942F, 0x9470,   // 0x15210 (86544) pixels
-0xA490, 0x734B, 0x8BEE, 0x83CE, 0xA490, 0x9C90, 0x9C90, 0xA4B0, 0xACF2, 0xACF1, 0xACF2, 0xACF2, 0xACF2, 0xACF1, 0xACF1, 0xACF2,   // 0x15220 (86560) pixels
-0xACF2, 0xACD2, 0xA4D1, 0xACD1, 0xA4D1, 0xA4B1, 0xA4B1, 0x9C90, 0x9C90, 0x9C70, 0x9C70, 0x7BAD, 0x7BAD, 0x736C, 0xAD12, 0x9C6F,   // 0x15230 (86576) pixels
-0x9470, 0x9C70, 0x942F, 0x9450, 0x9C70, 0x9C70, 0x944F, 0x9C70, 0x9C70, 0x9CB1, 0xA4B1, 0x9CB1, 0xA4B1, 0xA48F, 0xA4B0, 0xA4B1,   // 0x15240 (86592) pixels
-0xA4B0, 0xA4B1, 0xA4B1, 0xACF1, 0xA4D1, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18C3, 0x18A2, 0x1082, 0x18C2, 0x18C3, 0x18C3, 0x18C2,   // 0x15250 (86608) pixels
-0x18C3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3,   // 0x15260 (86624) pixels
-0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15270 (86640) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x0020, 0x0020, 0x0820, 0x0840, 0x0841, 0x0840, 0x0840, 0x0861, 0x0861,   // 0x15280 (86656) pixels
-0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0841, 0x0820, 0x0020, 0x0000, 0x0820, 0x1082, 0x18C3, 0x2924, 0x2944, 0x2945, 0x2944,   // 0x15290 (86672) pixels
-0x2124, 0x18C2, 0x2124, 0x5269, 0x5ACA, 0x4A68, 0x18C3, 0x1082, 0x4A48, 0x528A, 0x5269, 0x4A49, 0x39C7, 0x39C7, 0x3165, 0x10A2,   // 0x152A0 (86688) pixels
-0x0020, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061,   // 0x152B0 (86704) pixels
-0x1061, 0x1061, 0x1061, 0x1062, 0x1061, 0x1061, 0x1082, 0x1061, 0x1082, 0x1061, 0x1061, 0x1082, 0x1061, 0x1061, 0x1082, 0x1061,   // 0x152C0 (86720) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x152D0 (86736) pixels
-0x0020, 0x0020, 0x0040, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0840, 0x0020, 0x0020, 0x0020,   // 0x152E0 (86752) pixels
-0x0861, 0x10A2, 0x2103, 0x2104, 0x2104, 0x20E3, 0x2103, 0x2945, 0x2944, 0x2104, 0x18C2, 0x18C2, 0x2924, 0x41E7, 0x41E7, 0x39A6,   // 0x152F0 (86768) pixels
-0x2944, 0x2103, 0x0861, 0x0841, 0x0861, 0x0841, 0x0840, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0840, 0x0841,   // 0x15300 (86784) pixels
-0x0841, 0x0840, 0x0840, 0x0841, 0x0861, 0x1082, 0x1061, 0x1061, 0x0861, 0x0040, 0x0040, 0x0861, 0x0881, 0x1082, 0x10A2, 0x10A2,   // 0x15310 (86800) pixels
-0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x18C3, 0x1903, 0x2124, 0x2104,   // 0x15320 (86816) pixels
-0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2944, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965,   // 0x15330 (86832) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2104, 0x20E3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x6B2B, 0xB512, 0xA4D0, 0xACD2,   // 0x15340 (86848) pixels
-0xA4D1, 0xACD2, 0xA4D2, 0xA4B0, 0xA4D2, 0xA4D2, 0xA4D1, 0x9C90, 0xA491, 0x9C6F, 0x9C91, 0x946F, 0x942F, 0x944F, 0x942F, 0x9470,   // 0x15350 (86864) pixels
-0xA4B0, 0x62EB, 0x7B8D, 0x7BAD, 0xA490, 0xA4B1, 0x9C90, 0x9C91, 0xA4B1, 0xA4D1, 0xA4D2, 0xA4D1, 0xACD1, 0xACF2, 0xACD1, 0xACF2,   // 0x15360 (86880) pixels
-0xA4D1, 0xA4D1, 0xA4D1, 0xA4D1, 0xA4D2, 0xA4B1, 0xA491, 0x9C90, 0x9C91, 0x9C90, 0x9C70, 0x734C, 0x732B, 0x6B0A, 0xACF2, 0x9C90,   // 0x15370 (86896) pixels
-0x9C70, 0x944F, 0x940F, 0x944F, 0x944F, 0x944F, 0x944F, 0x9C70, 0x9C90, 0x9C90, 0x9C8F, 0xA4D1, 0xA4D1, 0xA4B0, 0xA4D2, 0xA4B0,   // 0x15380 (86912) pixels
-0xA4D1, 0xAD12, 0x6AEA, 0x18C2, 0x18C2, 0x18A2, 0x18A2, 0x18C2, 0x10A2, 0x10A2, 0x18C3, 0x20E3, 0x2103, 0x20E3, 0x2103, 0x18E3,   // 0x15390 (86928) pixels
-0x18E3, 0x2104, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x153A0 (86944) pixels
-0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2,   // 0x153B0 (86960) pixels
-0x10C3, 0x18C3, 0x10C3, 0x18C3, 0x10A2, 0x1082, 0x0020, 0x0840, 0x0841, 0x0841, 0x0841, 0x0840, 0x0840, 0x0841, 0x0861, 0x1061,   // 0x153C0 (86976) pixels
-0x1061, 0x0861, 0x1061, 0x0861, 0x1061, 0x0841, 0x0840, 0x0020, 0x0000, 0x0020, 0x18A2, 0x2103, 0x3185, 0x3186, 0x31A6, 0x31A6,   // 0x153D0 (86992) pixels
-0x39C6, 0x2965, 0x4207, 0x62EB, 0x630C, 0x62EB, 0x3145, 0x20E3, 0x5289, 0x5A8A, 0x5269, 0x4A49, 0x39C6, 0x39A6, 0x2945, 0x1061,   // 0x153E0 (87008) pixels
-0x0020, 0x0841, 0x0861, 0x0861, 0x1061, 0x0861, 0x1081, 0x1082, 0x1062, 0x1082, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061,   // 0x153F0 (87024) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1081, 0x1061, 0x1082, 0x1081, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081,   // 0x15400 (87040) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0041, 0x0040, 0x0020, 0x0020, 0x0020,   // 0x15410 (87056) pixels
-0x0020, 0x0020, 0x0020, 0x0041, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0020, 0x0000,   // 0x15420 (87072) pixels
-0x0040, 0x1061, 0x1062, 0x10A2, 0x0861, 0x0841, 0x1082, 0x18C2, 0x2104, 0x2104, 0x18E3, 0x1082, 0x18C3, 0x4A28, 0x39C7, 0x39C7,   // 0x15430 (87088) pixels
-0x2965, 0x20E3, 0x0861, 0x0841, 0x0020, 0x0000, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0840, 0x0840,   // 0x15440 (87104) pixels
-0x0841, 0x0841, 0x0841, 0x0840, 0x0820, 0x0841, 0x0861, 0x1061, 0x1081, 0x0841, 0x0020, 0x0020, 0x0841, 0x0881, 0x10A2, 0x10A2,   // 0x15450 (87120) pixels
-0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x18E3,   // 0x15460 (87136) pixels
-0x2104, 0x2104, 0x2124, 0x2104, 0x2124, 0x2944, 0x2944, 0x2124, 0x2124, 0x2944, 0x2124, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944,   // 0x15470 (87152) pixels
-0x2944, 0x2945, 0x2924, 0x2924, 0x2924, 0x2104, 0x2103, 0x18C3, 0x18C2, 0x1082, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18C2,   // 0x15480 (87168) pixels
-0x5AA9, 0x8C0F, 0xACF2, 0xAD13, 0xA4D1, 0xACD1, 0xA4B1, 0xA4B0, 0xA4B0, 0x9C90, 0x9C4F, 0x9C50, 0x942F, 0x9450, 0x944F, 0x942F,   // 0x15490 (87184) pixels
-0x9C6F, 0x4A27, 0x5ACA, 0x62EB, 0xA490, 0xA4B1, 0xA490, 0xA4B0, 0x9C90, 0x9C90, 0x9C91, 0xA4B1, 0xA4B1, 0xA4D1, 0xA4D1, 0xA4D2,   // 0x154A0 (87200) pixels
-0xA4D1, 0xA4D1, 0xA4D1, 0xA4D1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0x9C90, 0x62CA, 0x5AA9, 0x5289, 0xA4D1, 0x944F,   // 0x154B0 (87216) pixels
-0x9450, 0x944F, 0x940F, 0x8C0F, 0x9C70, 0x9C90, 0x9C6F, 0x9C6F, 0xA491, 0xA4B0, 0xA4D1, 0xAD12, 0xACF1, 0x944F, 0x39C6, 0x18C2,   // 0x154C0 (87232) pixels
-0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x18A2, 0x0861, 0x1082, 0x10A2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3,   // 0x154D0 (87248) pixels
-0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x10C2,   // 0x154E0 (87264) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x10A2, 0x10A2, 0x10A2,   // 0x154F0 (87280) pixels
-0x10C2, 0x18C3, 0x0882, 0x1082, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0840, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861,   // 0x15500 (87296) pixels
-0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x10A2, 0x2104, 0x3185, 0x4207, 0x4207, 0x4228,   // 0x15510 (87312) pixels
-0x4A69, 0x62EB, 0x62EB, 0x5AAA, 0x5289, 0x62EB, 0x736D, 0x5AAA, 0x5ACB, 0x4A28, 0x3186, 0x39A6, 0x31A6, 0x31A6, 0x2104, 0x0020,   // 0x15520 (87328) pixels
-0x0840, 0x0841, 0x1061, 0x0861, 0x1081, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1061,   // 0x15530 (87344) pixels
-0x1061, 0x1082, 0x1061, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x1061, 0x1082, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081,   // 0x15540 (87360) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020,   // 0x15550 (87376) pixels
-0x0020, 0x0020, 0x0040, 0x0020, 0x0041, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020,   // 0x15560 (87392) pixels
-0x0020, 0x0841, 0x0861, 0x1081, 0x10A2, 0x10A2, 0x18E3, 0x18E3, 0x2124, 0x2924, 0x3165, 0x39C6, 0x39C7, 0x39C7, 0x39C6, 0x39C6,   // 0x15570 (87408) pixels
-0x2945, 0x18C2, 0x1082, 0x0841, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0040,   // 0x15580 (87424) pixels
-0x0840, 0x0841, 0x0841, 0x0840, 0x0040, 0x0841, 0x0840, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0020, 0x0841, 0x1082,   // 0x15590 (87440) pixels
-0x0882, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x155A0 (87456) pixels
-0x10A2, 0x18C3, 0x18E3, 0x2124, 0x2124, 0x2124, 0x2144, 0x2124, 0x2944, 0x2124, 0x2924, 0x2945, 0x2945, 0x2924, 0x2945, 0x2944,   // 0x155B0 (87472) pixels
-0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2103, 0x2103, 0x20E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18C3,   // 0x155C0 (87488) pixels
-0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x2104, 0x5248, 0x942F, 0xA4B0, 0xA4D1, 0xACF2, 0xA4B0, 0x9C90, 0x9C70, 0x944F, 0x9C70,   // 0x155D0 (87504) pixels
-0x9C90, 0x41E6, 0x4A48, 0x62EB, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA490, 0xA490, 0x9C70, 0x9C70, 0x9450, 0x9C70, 0xA4B1, 0xA4B1,   // 0x155E0 (87520) pixels
-0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0xA4B1, 0x9C90, 0x9C90, 0x9C90, 0x5268, 0x4A28, 0x4207, 0x9C70, 0x9C70,   // 0x155F0 (87536) pixels
-0x9C70, 0x9C70, 0x9C6F, 0x9C90, 0xA4B1, 0xA4B1, 0xA490, 0x940F, 0x5248, 0x20E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2,   // 0x15600 (87552) pixels
-0x18C3, 0x10A2, 0x10A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x15610 (87568) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x10C2, 0x10A2, 0x1082,   // 0x15620 (87584) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15630 (87600) pixels
-0x0861, 0x0841, 0x0820, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x15640 (87616) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0820, 0x0020, 0x0020, 0x0020, 0x10A2, 0x2945, 0x39C7, 0x4A48, 0x4A69,   // 0x15650 (87632) pixels
-0x4A49, 0x5269, 0x528A, 0x528A, 0x5269, 0x4A49, 0x4A69, 0x4A48, 0x4248, 0x4207, 0x39C7, 0x39A6, 0x39A6, 0x2924, 0x18C3, 0x0040,   // 0x15660 (87648) pixels
-0x0840, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1082, 0x1061, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1061,   // 0x15670 (87664) pixels
-0x1082, 0x1061, 0x1061, 0x1061, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061,   // 0x15680 (87680) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0040, 0x0020,   // 0x15690 (87696) pixels
-0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020,   // 0x156A0 (87712) pixels
-0x0020, 0x0020, 0x0840, 0x0861, 0x20E3, 0x2104, 0x2104, 0x2104, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x39A6, 0x39C6, 0x3186,   // 0x156B0 (87728) pixels
-0x2104, 0x10A2, 0x1082, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0840, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0840,   // 0x156C0 (87744) pixels
-0x0840, 0x0840, 0x0841, 0x0840, 0x0840, 0x0841, 0x0841, 0x0840, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0840,   // 0x156D0 (87760) pixels
-0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x156E0 (87776) pixels
-0x10A2, 0x1082, 0x10A2, 0x18E3, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2944, 0x2124, 0x2944, 0x2924, 0x2944, 0x2945, 0x2945,   // 0x156F0 (87792) pixels
-0x2944, 0x2944, 0x2945, 0x2924, 0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2104, 0x2103, 0x18E3,   // 0x15700 (87808) pixels
-0x18C3, 0x18E3, 0x18E3, 0x18C2, 0x18C2, 0x18C2, 0x18C2, 0x18A2, 0x18C2, 0x20E3, 0x734C, 0x83AD, 0x7B6C, 0x7B6C, 0x7BAD, 0x83CE,   // 0x15710 (87824) pixels
-0x83CE, 0x39C6, 0x39C6, 0x5268, 0x9C70, 0x9C90, 0x9C90, 0x9C90, 0x9C70, 0x9C70, 0x9C50, 0x944F, 0x942F, 0x9C70, 0x9C70, 0xA4B1,   // 0x15720 (87840) pixels
-0xA4B1, 0xA4B1, 0x9C90, 0x9C91, 0x9C91, 0x9C90, 0x9C70, 0x9C70, 0x944F, 0x9C50, 0x83AD, 0x41E7, 0x39A6, 0x3185, 0x7BAD, 0x7BAD,   // 0x15730 (87856) pixels
-0x7BAD, 0x734C, 0x734C, 0x7B6C, 0x41E6, 0x18C2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18A2, 0x18C2, 0x10A2, 0x1081, 0x10A2,   // 0x15740 (87872) pixels
-0x18C3, 0x18E3, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3,   // 0x15750 (87888) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x10A2, 0x1082, 0x10A2, 0x1082,   // 0x15760 (87904) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0861,   // 0x15770 (87920) pixels
-0x0841, 0x0820, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x15780 (87936) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0840, 0x0020, 0x0020, 0x0861, 0x2965, 0x39E7, 0x4207, 0x4A48,   // 0x15790 (87952) pixels
-0x4A69, 0x528A, 0x5269, 0x526A, 0x4A49, 0x4A48, 0x4207, 0x3A07, 0x41E7, 0x41E7, 0x39E7, 0x31A6, 0x3186, 0x2104, 0x10A2, 0x0841,   // 0x157A0 (87968) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061,   // 0x157B0 (87984) pixels
-0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x1062, 0x1082, 0x1061, 0x1061, 0x1062, 0x1061, 0x1061, 0x1081, 0x1061,   // 0x157C0 (88000) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0040,   // 0x157D0 (88016) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0020,   // 0x157E0 (88032) pixels
-0x0020, 0x0000, 0x0020, 0x10A2, 0x20E3, 0x2103, 0x2124, 0x3165, 0x3186, 0x3165, 0x2965, 0x2924, 0x2124, 0x2945, 0x2924, 0x2104,   // 0x157F0 (88048) pixels
-0x18C2, 0x1082, 0x0020, 0x0000, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861,   // 0x15800 (88064) pixels
-0x0841, 0x0841, 0x0840, 0x0840, 0x0840, 0x0841, 0x0841, 0x0040, 0x0841, 0x0020, 0x0020, 0x0841, 0x0020, 0x0020, 0x0000, 0x0000,   // 0x15810 (88080) pixels
-0x0020, 0x0841, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x15820 (88096) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x18C3, 0x2104, 0x2944, 0x2124, 0x2924, 0x2124, 0x2945, 0x2945, 0x2945, 0x2944, 0x2944,   // 0x15830 (88112) pixels
-0x2945, 0x2944, 0x2924, 0x2924, 0x2924, 0x2924, 0x2945, 0x2944, 0x2944, 0x2945, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2124,   // 0x15840 (88128) pixels
-0x2104, 0x2103, 0x18E3, 0x18C2, 0x10A2, 0x1081, 0x1081, 0x10A2, 0x18C2, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2,   // 0x15850 (88144) pixels
-0x18C3, 0x18A2, 0x18C2, 0x20E3, 0x2103, 0x2944, 0x3165, 0x3165, 0x3165, 0x3165, 0x2944, 0x2944, 0x39A6, 0x5A89, 0x5AA9, 0x6B2B,   // 0x15860 (88160) pixels
-0x732B, 0x5A89, 0x41C6, 0x3165, 0x39A6, 0x3185, 0x2945, 0x3144, 0x3165, 0x2944, 0x2103, 0x20E3, 0x18C2, 0x18C2, 0x18C2, 0x18A2,   // 0x15870 (88176) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x10A2, 0x1061, 0x0841, 0x0861, 0x1081, 0x1082, 0x18C2, 0x18C3, 0x18E3,   // 0x15880 (88192) pixels
-0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2104, 0x2104, 0x20E3, 0x2103, 0x20E3, 0x1903, 0x18E3, 0x18E3,   // 0x15890 (88208) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x2103, 0x18E3, 0x18E3, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x158A0 (88224) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x0881, 0x0861, 0x0020,   // 0x158B0 (88240) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x0881, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x158C0 (88256) pixels
-0x0861, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0820, 0x0020, 0x0020, 0x2104, 0x2945, 0x39E7, 0x4A48,   // 0x158D0 (88272) pixels
-0x528A, 0x526A, 0x5269, 0x4A29, 0x4A28, 0x4207, 0x4207, 0x39C7, 0x39E7, 0x4207, 0x39C6, 0x2965, 0x2945, 0x18C3, 0x0040, 0x0841,   // 0x158E0 (88288) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x1082, 0x1062, 0x1082, 0x1082, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082,   // 0x158F0 (88304) pixels
-0x1081, 0x1081, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x15900 (88320) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040,   // 0x15910 (88336) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0840, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020,   // 0x15920 (88352) pixels
-0x0020, 0x0020, 0x0020, 0x0861, 0x18C3, 0x18C3, 0x2124, 0x3165, 0x3186, 0x2965, 0x2944, 0x2944, 0x2124, 0x2124, 0x20E3, 0x18C3,   // 0x15930 (88368) pixels
-0x10A2, 0x0840, 0x0020, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1061, 0x0861, 0x0861, 0x0841, 0x0861, 0x1082, 0x1082, 0x0861,   // 0x15940 (88384) pixels
-0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0840, 0x0840, 0x0040, 0x0840, 0x0840, 0x0020, 0x0020, 0x0841, 0x0841, 0x0020, 0x0020,   // 0x15950 (88400) pixels
-0x0020, 0x0020, 0x0841, 0x1081, 0x0881, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2,   // 0x15960 (88416) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10C2, 0x18E3, 0x2124, 0x2965, 0x2144, 0x2144, 0x2124, 0x2944, 0x2944, 0x2945,   // 0x15970 (88432) pixels
-0x2944, 0x2945, 0x2924, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2944, 0x2965, 0x3185, 0x3185, 0x3165, 0x2965, 0x2944,   // 0x15980 (88448) pixels
-0x2124, 0x2124, 0x2104, 0x2103, 0x1903, 0x18E3, 0x18C3, 0x18C2, 0x10A2, 0x1081, 0x1081, 0x10A2, 0x18C2, 0x10A2, 0x10A2, 0x18A2,   // 0x15990 (88464) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x18E3, 0x18E3,   // 0x159A0 (88480) pixels
-0x18C3, 0x18A2, 0x10A2, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x159B0 (88496) pixels
-0x10A2, 0x18A2, 0x18C2, 0x18C2, 0x1081, 0x1061, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x18C3, 0x18E3, 0x20E3, 0x2103,   // 0x159C0 (88512) pixels
-0x2104, 0x2124, 0x2104, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E3, 0x18E3,   // 0x159D0 (88528) pixels
-0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x159E0 (88544) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x0861, 0x0861, 0x0020, 0x0020,   // 0x159F0 (88560) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x15A00 (88576) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x1082, 0x2124, 0x39A6, 0x41E7,   // 0x15A10 (88592) pixels
-0x4A49, 0x5269, 0x5269, 0x4A28, 0x4208, 0x39E7, 0x39C7, 0x3A07, 0x39C6, 0x39C6, 0x3186, 0x2965, 0x18E3, 0x0840, 0x0841, 0x0861,   // 0x15A20 (88608) pixels
-0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1082, 0x1081, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081, 0x1061, 0x1081, 0x1061,   // 0x15A30 (88624) pixels
-0x1081, 0x0881, 0x0861, 0x0881, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x1081, 0x0861, 0x1061,   // 0x15A40 (88640) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x15A50 (88656) pixels
-0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0840,   // 0x15A60 (88672) pixels
-0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0841, 0x10A2, 0x18E3, 0x2103, 0x18E3, 0x18C3, 0x18E3, 0x18E3, 0x10A2, 0x0861, 0x0020,   // 0x15A70 (88688) pixels
-0x0020, 0x0020, 0x0861, 0x0861, 0x0881, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0841, 0x0841, 0x0861, 0x1082, 0x10A2, 0x1082,   // 0x15A80 (88704) pixels
-0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0840, 0x0040, 0x0040, 0x0840, 0x0840, 0x0841, 0x0841, 0x0840, 0x0820, 0x0861, 0x0840,   // 0x15A90 (88720) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x0861, 0x0861, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15AA0 (88736) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18C3, 0x2124, 0x2944, 0x2124, 0x2945, 0x2944, 0x2945,   // 0x15AB0 (88752) pixels
-0x2945, 0x2945, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2965, 0x3165, 0x3165, 0x2965, 0x2965, 0x2965,   // 0x15AC0 (88768) pixels
-0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2103, 0x2103,   // 0x15AD0 (88784) pixels
-0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x18E3, 0x20E3, 0x18E3, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C2, 0x18C2,   // 0x15AE0 (88800) pixels
-0x18A2, 0x18C2, 0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C3,   // 0x15AF0 (88816) pixels
-0x18E3, 0x2103, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x15B00 (88832) pixels
-0x2124, 0x2104, 0x2124, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x20E4, 0x20E3,   // 0x15B10 (88848) pixels
-0x1903, 0x20E3, 0x18E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15B20 (88864) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x0861, 0x0861, 0x0020, 0x0000, 0x0020, 0x0840,   // 0x15B30 (88880) pixels
-0x0861, 0x1081, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x15B40 (88896) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0841, 0x0841, 0x0040, 0x0020, 0x0020, 0x0841, 0x10A2,   // 0x15B50 (88912) pixels
-0x2124, 0x3186, 0x3186, 0x3186, 0x3186, 0x2965, 0x2944, 0x2945, 0x2124, 0x2103, 0x1082, 0x0020, 0x0840, 0x0861, 0x0861, 0x1082,   // 0x15B60 (88928) pixels
-0x1061, 0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1062, 0x1061, 0x1062, 0x1061, 0x1081, 0x1081, 0x1081, 0x1061,   // 0x15B70 (88944) pixels
-0x1061, 0x1081, 0x0881, 0x1081, 0x1081, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861,   // 0x15B80 (88960) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x15B90 (88976) pixels
-0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0840, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841,   // 0x15BA0 (88992) pixels
-0x0820, 0x0840, 0x0020, 0x0020, 0x0000, 0x0020, 0x0820, 0x0841, 0x0861, 0x0861, 0x0861, 0x0881, 0x0861, 0x0020, 0x0020, 0x0020,   // 0x15BB0 (89008) pixels
-0x0040, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x1082, 0x18A2, 0x18A2,   // 0x15BC0 (89024) pixels
-0x18A2, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0820, 0x0840, 0x0841,   // 0x15BD0 (89040) pixels
-0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x0861, 0x0861, 0x1081, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x15BE0 (89056) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10C2, 0x18E3, 0x2103, 0x2944, 0x2944, 0x2124,   // 0x15BF0 (89072) pixels
-0x2945, 0x2944, 0x2945, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2945, 0x2944, 0x2965, 0x2944, 0x2964,   // 0x15C00 (89088) pixels
-0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2944, 0x2965, 0x3185, 0x3165, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x3165, 0x2945,   // 0x15C10 (89104) pixels
-0x2924, 0x2924, 0x2124, 0x2104, 0x2104, 0x2104, 0x2103, 0x20E3, 0x20E3, 0x2103, 0x18E3, 0x18E3, 0x18E3, 0x18C2, 0x18C3, 0x18C3,   // 0x15C20 (89120) pixels
-0x18C2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x20E3, 0x20E3, 0x2104, 0x2124, 0x2104, 0x2124, 0x2124, 0x2124,   // 0x15C30 (89136) pixels
-0x2944, 0x2924, 0x2944, 0x2924, 0x2924, 0x2944, 0x2124, 0x2944, 0x2124, 0x2944, 0x2944, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x15C40 (89152) pixels
-0x2124, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2103, 0x2103,   // 0x15C50 (89168) pixels
-0x2103, 0x2103, 0x18E3, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15C60 (89184) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x0861, 0x0861, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841,   // 0x15C70 (89200) pixels
-0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x0881, 0x1061, 0x0861,   // 0x15C80 (89216) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x15C90 (89232) pixels
-0x0841, 0x1082, 0x18C2, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x10A2, 0x1061, 0x0841, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061,   // 0x15CA0 (89248) pixels
-0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x1081, 0x1061, 0x1061, 0x1081, 0x1082, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061,   // 0x15CB0 (89264) pixels
-0x0861, 0x1081, 0x0861, 0x1081, 0x1061, 0x1061, 0x0881, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x0881, 0x0861, 0x1061, 0x0861,   // 0x15CC0 (89280) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x15CD0 (89296) pixels
-0x0861, 0x0040, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0040, 0x0020, 0x0020, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0841,   // 0x15CE0 (89312) pixels
-0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x15CF0 (89328) pixels
-0x0820, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1081, 0x0861, 0x1082, 0x10A2, 0x18A2, 0x18C3,   // 0x15D00 (89344) pixels
-0x18C3, 0x18C2, 0x18C2, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0020,   // 0x15D10 (89360) pixels
-0x0841, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020, 0x0840, 0x1081, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15D20 (89376) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10C2, 0x18C2, 0x20E3,   // 0x15D30 (89392) pixels
-0x2124, 0x2944, 0x2124, 0x2945, 0x2945, 0x2965, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2965, 0x2965, 0x2944, 0x2944, 0x2944,   // 0x15D40 (89408) pixels
-0x2945, 0x2944, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2944, 0x2964, 0x2945, 0x2945, 0x2944, 0x2944,   // 0x15D50 (89424) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104,   // 0x15D60 (89440) pixels
-0x2104, 0x2103, 0x2103, 0x2103, 0x20E3, 0x2103, 0x2103, 0x2103, 0x2103, 0x2104, 0x2124, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124,   // 0x15D70 (89456) pixels
-0x2124, 0x2944, 0x2124, 0x2924, 0x2124, 0x2924, 0x2944, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2124, 0x2104,   // 0x15D80 (89472) pixels
-0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2103, 0x2103, 0x2103, 0x2104, 0x2103, 0x2103, 0x2104, 0x2104, 0x2103, 0x2103, 0x18E3,   // 0x15D90 (89488) pixels
-0x18C3, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15DA0 (89504) pixels
-0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0820, 0x0020, 0x0020, 0x0820, 0x0840, 0x0841, 0x0841,   // 0x15DB0 (89520) pixels
-0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x0861, 0x1061, 0x0861, 0x1081, 0x0861, 0x0861, 0x0861,   // 0x15DC0 (89536) pixels
-0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0820, 0x0020,   // 0x15DD0 (89552) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0840, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061,   // 0x15DE0 (89568) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1082, 0x1082, 0x1082, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081,   // 0x15DF0 (89584) pixels
-0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x0861, 0x1081, 0x1081, 0x0881, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x0881,   // 0x15E00 (89600) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x15E10 (89616) pixels
-0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0040, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841,   // 0x15E20 (89632) pixels
-0x0861, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0820, 0x0840, 0x0820, 0x0820, 0x0040, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020,   // 0x15E30 (89648) pixels
-0x0020, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1081, 0x1062, 0x1082, 0x18A2, 0x18A2, 0x18A2,   // 0x15E40 (89664) pixels
-0x10A2, 0x18C3, 0x18C3, 0x18A3, 0x10A2, 0x1082, 0x1061, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x15E50 (89680) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0881, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x15E60 (89696) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15E70 (89712) pixels
-0x10A2, 0x18C3, 0x18E3, 0x2104, 0x2945, 0x2965, 0x2945, 0x2945, 0x2944, 0x2944, 0x2945, 0x2945, 0x2965, 0x2945, 0x2944, 0x2945,   // 0x15E80 (89728) pixels
-0x2945, 0x2944, 0x2945, 0x2965, 0x2944, 0x2945, 0x2944, 0x2965, 0x3165, 0x2965, 0x2945, 0x2965, 0x2944, 0x2965, 0x2945, 0x2965,   // 0x15E90 (89744) pixels
-0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2965, 0x2944, 0x2944, 0x2945, 0x2945, 0x2964, 0x2945, 0x2945, 0x2944, 0x2944,   // 0x15EA0 (89760) pixels
-0x2124, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2944,   // 0x15EB0 (89776) pixels
-0x2924, 0x2924, 0x2924, 0x2944, 0x2924, 0x2124, 0x2144, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,   // 0x15EC0 (89792) pixels
-0x2104, 0x2124, 0x2104, 0x2104, 0x2103, 0x2103, 0x2104, 0x2104, 0x2124, 0x2103, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x10A2, 0x10A2,   // 0x15ED0 (89808) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15EE0 (89824) pixels
-0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0841, 0x0841, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861,   // 0x15EF0 (89840) pixels
-0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x15F00 (89856) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1082, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841,   // 0x15F10 (89872) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861,   // 0x15F20 (89888) pixels
-0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1062, 0x1082, 0x1061, 0x1061, 0x1081, 0x1081,   // 0x15F30 (89904) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x0861, 0x1061, 0x1061, 0x0881, 0x1081, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x15F40 (89920) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x15F50 (89936) pixels
-0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x15F60 (89952) pixels
-0x0841, 0x0841, 0x0841, 0x0840, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0041, 0x0020, 0x0020, 0x0000, 0x0020,   // 0x15F70 (89968) pixels
-0x0040, 0x0840, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x18C3, 0x18C2, 0x18A2,   // 0x15F80 (89984) pixels
-0x1082, 0x1082, 0x10A2, 0x18A2, 0x18A3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0841,   // 0x15F90 (90000) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x0861, 0x1082, 0x1081, 0x10A2,   // 0x15FA0 (90016) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x15FB0 (90032) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x2104, 0x2124, 0x2944, 0x2944, 0x2965, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2945,   // 0x15FC0 (90048) pixels
-0x2945, 0x2944, 0x2965, 0x2965, 0x2945, 0x2945, 0x2944, 0x3165, 0x3185, 0x2965, 0x2965, 0x2965, 0x2944, 0x2945, 0x2944, 0x2944,   // 0x15FD0 (90064) pixels
-0x2944, 0x2944, 0x2945, 0x2965, 0x2945, 0x2945, 0x2944, 0x2944, 0x2945, 0x2945, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,   // 0x15FE0 (90080) pixels
-0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2124, 0x2944, 0x2924,   // 0x15FF0 (90096) pixels
-0x2944, 0x2944, 0x2924, 0x2924, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2124, 0x2124,   // 0x16000 (90112) pixels
-0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104, 0x2103, 0x18E3, 0x18C2, 0x18C2, 0x10A2, 0x1082, 0x10A2, 0x10A2,   // 0x16010 (90128) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16020 (90144) pixels
-0x10A2, 0x10A2, 0x10A2, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0841, 0x0861, 0x1061, 0x0881,   // 0x16030 (90160) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0881, 0x1061,   // 0x16040 (90176) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x1062, 0x1061, 0x1081, 0x1081, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16050 (90192) pixels
-0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1062, 0x1061, 0x0881, 0x1062,   // 0x16060 (90208) pixels
-0x1062, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1082, 0x1062, 0x1081, 0x1061, 0x1061, 0x1081, 0x1082, 0x1081,   // 0x16070 (90224) pixels
-0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x0881, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x0861, 0x0861, 0x1061, 0x1061,   // 0x16080 (90240) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16090 (90256) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0040, 0x0840,   // 0x160A0 (90272) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0040, 0x0020, 0x0040,   // 0x160B0 (90288) pixels
-0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x1062, 0x10A2, 0x10A2, 0x10A2,   // 0x160C0 (90304) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18C3, 0x18C3, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0841, 0x0841,   // 0x160D0 (90320) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0820, 0x0840, 0x0841, 0x0841, 0x0861, 0x0841, 0x0820, 0x0020, 0x0020, 0x0841, 0x0841, 0x10A2,   // 0x160E0 (90336) pixels
-0x10A2, 0x10C2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2,   // 0x160F0 (90352) pixels
-0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x2124, 0x2944, 0x2124, 0x2944, 0x2944, 0x2945, 0x2945,   // 0x16100 (90368) pixels
-0x2965, 0x2944, 0x2965, 0x2944, 0x2944, 0x2944, 0x2944, 0x2965, 0x2965, 0x2965, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x16110 (90384) pixels
-0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x16120 (90400) pixels
-0x2944, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2124, 0x2944, 0x2124, 0x2144, 0x2924, 0x2944,   // 0x16130 (90416) pixels
-0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2104, 0x2104, 0x2104, 0x2104,   // 0x16140 (90432) pixels
-0x2124, 0x2124, 0x2124, 0x2104, 0x2124, 0x20E3, 0x18E3, 0x18C2, 0x18A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16150 (90448) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16160 (90464) pixels
-0x0882, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0840, 0x0841, 0x0840, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061,   // 0x16170 (90480) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1081,   // 0x16180 (90496) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16190 (90512) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0881, 0x1061,   // 0x161A0 (90528) pixels
-0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x0881, 0x0861, 0x1061, 0x0881, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x161B0 (90544) pixels
-0x1061, 0x1061, 0x1081, 0x0881, 0x1081, 0x1061, 0x1081, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061,   // 0x161C0 (90560) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x161D0 (90576) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840,   // 0x161E0 (90592) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x161F0 (90608) pixels
-0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x1081, 0x1082, 0x1082,   // 0x16200 (90624) pixels
-0x1081, 0x0861, 0x1081, 0x1082, 0x10A2, 0x18C3, 0x18C3, 0x18C2, 0x18C2, 0x18C2, 0x18C3, 0x10A2, 0x0841, 0x0861, 0x0861, 0x0861,   // 0x16210 (90640) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x1061, 0x1061, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020, 0x0861,   // 0x16220 (90656) pixels
-0x0881, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16230 (90672) pixels
-0x1082, 0x10A2, 0x10A2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x18C2, 0x18E3, 0x2104, 0x2124, 0x2944, 0x2924, 0x2945,   // 0x16240 (90688) pixels
-0x2965, 0x2944, 0x2965, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2965, 0x2945, 0x2945, 0x2945, 0x2945, 0x2924, 0x2944, 0x2944,   // 0x16250 (90704) pixels
-0x2945, 0x2945, 0x2944, 0x2945, 0x2945, 0x2944, 0x2945, 0x2944, 0x2944, 0x2945, 0x2965, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944,   // 0x16260 (90720) pixels
-0x2924, 0x2944, 0x2944, 0x2924, 0x2924, 0x2944, 0x2945, 0x2944, 0x2924, 0x2944, 0x2944, 0x2124, 0x2944, 0x2124, 0x2124, 0x2144,   // 0x16270 (90736) pixels
-0x2124, 0x2124, 0x2124, 0x2945, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x2124, 0x2924, 0x2124,   // 0x16280 (90752) pixels
-0x2124, 0x2124, 0x2103, 0x18E3, 0x18E3, 0x18C2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16290 (90768) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861,   // 0x162A0 (90784) pixels
-0x0861, 0x0020, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0840, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061,   // 0x162B0 (90800) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x1081, 0x0861, 0x1061, 0x1061,   // 0x162C0 (90816) pixels
-0x1081, 0x0881, 0x0881, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x162D0 (90832) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x162E0 (90848) pixels
-0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0881, 0x0882, 0x0882, 0x0881, 0x1082, 0x1081, 0x1061, 0x1082, 0x1082,   // 0x162F0 (90864) pixels
-0x1081, 0x1061, 0x1061, 0x1061, 0x1081, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x16300 (90880) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16310 (90896) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020,   // 0x16320 (90912) pixels
-0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841,   // 0x16330 (90928) pixels
-0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16340 (90944) pixels
-0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0861, 0x0861, 0x0841,   // 0x16350 (90960) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0820, 0x0020, 0x0820, 0x0820,   // 0x16360 (90976) pixels
-0x0020, 0x0040, 0x0841, 0x0882, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16370 (90992) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C3, 0x18E3, 0x20E3,   // 0x16380 (91008) pixels
-0x2104, 0x2104, 0x2944, 0x2944, 0x2945, 0x2945, 0x2944, 0x2945, 0x2945, 0x2945, 0x2945, 0x2944, 0x2945, 0x2944, 0x2945, 0x2944,   // 0x16390 (91024) pixels
-0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2945, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2945,   // 0x163A0 (91040) pixels
-0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2924, 0x2944, 0x2944, 0x2944,   // 0x163B0 (91056) pixels
-0x2124, 0x2124, 0x2924, 0x2924, 0x2924, 0x2124, 0x2124, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x20E3, 0x18E3,   // 0x163C0 (91072) pixels
-0x18C2, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x163D0 (91088) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x0861, 0x0841, 0x0841, 0x0020,   // 0x163E0 (91104) pixels
-0x0020, 0x0820, 0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061,   // 0x163F0 (91120) pixels
-0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1081, 0x1061, 0x1061, 0x0861, 0x0861, 0x1081, 0x0861,   // 0x16400 (91136) pixels
-0x1081, 0x1081, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x16410 (91152) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0881, 0x0881, 0x1061,   // 0x16420 (91168) pixels
-0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x0861, 0x0861, 0x0881, 0x0881, 0x0861, 0x0882, 0x1082, 0x1081, 0x1062, 0x1081, 0x1061,   // 0x16430 (91184) pixels
-0x1082, 0x1061, 0x1081, 0x1082, 0x1081, 0x0861, 0x1081, 0x1061, 0x1061, 0x1082, 0x1061, 0x1082, 0x1081, 0x1061, 0x1081, 0x1061,   // 0x16440 (91200) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16450 (91216) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000,   // 0x16460 (91232) pixels
-0x0020, 0x0840, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x16470 (91248) pixels
-0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861,   // 0x16480 (91264) pixels
-0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0861,   // 0x16490 (91280) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x164A0 (91296) pixels
-0x0841, 0x0020, 0x0020, 0x0841, 0x0861, 0x0881, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x164B0 (91312) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x164C0 (91328) pixels
-0x10A2, 0x18A2, 0x18C3, 0x18E3, 0x2103, 0x2124, 0x2944, 0x2944, 0x2945, 0x2944, 0x2945, 0x2965, 0x2945, 0x2944, 0x2945, 0x2944,   // 0x164D0 (91344) pixels
-0x2924, 0x2945, 0x2944, 0x2944, 0x2944, 0x2945, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2945, 0x2944, 0x2945, 0x2944, 0x2924,   // 0x164E0 (91360) pixels
-0x2924, 0x2945, 0x2944, 0x2924, 0x2124, 0x2944, 0x2124, 0x2944, 0x2944, 0x2924, 0x2945, 0x2945, 0x2144, 0x2924, 0x2944, 0x2124,   // 0x164F0 (91376) pixels
-0x2944, 0x2124, 0x2944, 0x2924, 0x2924, 0x2124, 0x2124, 0x2124, 0x2124, 0x2104, 0x20E3, 0x18E3, 0x18C3, 0x18C3, 0x10A2, 0x10A2,   // 0x16500 (91392) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16510 (91408) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0861, 0x0841, 0x0020, 0x0020, 0x0840,   // 0x16520 (91424) pixels
-0x0841, 0x0841, 0x0861, 0x0840, 0x0840, 0x0840, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061,   // 0x16530 (91440) pixels
-0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x1081, 0x1061, 0x0861, 0x0861, 0x1081, 0x1081,   // 0x16540 (91456) pixels
-0x1081, 0x1081, 0x0881, 0x0861, 0x0861, 0x1081, 0x0881, 0x0881, 0x0881, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16550 (91472) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x1081, 0x1061, 0x1061,   // 0x16560 (91488) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1081, 0x1061, 0x1061,   // 0x16570 (91504) pixels
-0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x0861, 0x1082, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061,   // 0x16580 (91520) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16590 (91536) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0020,   // 0x165A0 (91552) pixels
-0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841,   // 0x165B0 (91568) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861,   // 0x165C0 (91584) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861,   // 0x165D0 (91600) pixels
-0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0820, 0x0841, 0x0861, 0x1061, 0x1082,   // 0x165E0 (91616) pixels
-0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x165F0 (91632) pixels
-0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16600 (91648) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18C2, 0x18C3, 0x18E3, 0x2103, 0x2104, 0x2924, 0x2944, 0x2944, 0x2945,   // 0x16610 (91664) pixels
-0x2144, 0x2945, 0x2944, 0x2944, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x2944, 0x2144, 0x2944, 0x2924, 0x2945, 0x2945,   // 0x16620 (91680) pixels
-0x2944, 0x2945, 0x2945, 0x2945, 0x2944, 0x2944, 0x2944, 0x2944, 0x2944, 0x2924, 0x2944, 0x2944, 0x2944, 0x2944, 0x2945, 0x2945,   // 0x16630 (91696) pixels
-0x2965, 0x2944, 0x2124, 0x2104, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16640 (91712) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16650 (91728) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x0882, 0x0861, 0x0841, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861,   // 0x16660 (91744) pixels
-0x0861, 0x0841, 0x0840, 0x0840, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x16670 (91760) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061,   // 0x16680 (91776) pixels
-0x1082, 0x1081, 0x0881, 0x0861, 0x0861, 0x1081, 0x0861, 0x0861, 0x0881, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061,   // 0x16690 (91792) pixels
-0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1082, 0x1081, 0x0881,   // 0x166A0 (91808) pixels
-0x1061, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1061,   // 0x166B0 (91824) pixels
-0x1081, 0x1082, 0x1061, 0x1081, 0x1081, 0x0861, 0x1082, 0x1061, 0x1081, 0x0881, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061,   // 0x166C0 (91840) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x166D0 (91856) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,   // 0x166E0 (91872) pixels
-0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841,   // 0x166F0 (91888) pixels
-0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841,   // 0x16700 (91904) pixels
-0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841,   // 0x16710 (91920) pixels
-0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861,   // 0x16720 (91936) pixels
-0x0861, 0x0861, 0x0841, 0x0840, 0x0840, 0x0820, 0x0020, 0x0020, 0x0041, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0881,   // 0x16730 (91952) pixels
-0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16740 (91968) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x18A2, 0x18C2,   // 0x16750 (91984) pixels
-0x18C2, 0x18C3, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x2103, 0x2103, 0x2104, 0x2104, 0x2104, 0x2124, 0x2124, 0x2124, 0x2924, 0x2924,   // 0x16760 (92000) pixels
-0x2924, 0x2124, 0x2124, 0x2124, 0x2104, 0x2103, 0x2103, 0x20E3, 0x20E3, 0x18E3, 0x18E3, 0x18E3, 0x18C3, 0x18C2, 0x18C3, 0x18C3,   // 0x16770 (92016) pixels
-0x18C3, 0x18C2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16780 (92032) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16790 (92048) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841,   // 0x167A0 (92064) pixels
-0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1081, 0x0861,   // 0x167B0 (92080) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1081, 0x0861, 0x0861, 0x1081,   // 0x167C0 (92096) pixels
-0x1081, 0x1081, 0x1082, 0x1081, 0x0881, 0x1081, 0x1081, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x167D0 (92112) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1061, 0x1082,   // 0x167E0 (92128) pixels
-0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061,   // 0x167F0 (92144) pixels
-0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1082, 0x1081, 0x1081, 0x1082, 0x1062, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081,   // 0x16800 (92160) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16810 (92176) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0000, 0x0000, 0x0000,   // 0x16820 (92192) pixels
-0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861,   // 0x16830 (92208) pixels
-0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841,   // 0x16840 (92224) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861,   // 0x16850 (92240) pixels
-0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840,   // 0x16860 (92256) pixels
-0x0040, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0820, 0x0020, 0x0820, 0x0040, 0x0841, 0x0861, 0x0861, 0x0861,   // 0x16870 (92272) pixels
-0x0882, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16880 (92288) pixels
-0x10A2, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x16890 (92304) pixels
-0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x18A2, 0x18C2, 0x18C3, 0x18E3, 0x18E3, 0x18E3,   // 0x168A0 (92320) pixels
-0x18E3, 0x18C3, 0x18C3, 0x18C3, 0x18C2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x168B0 (92336) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x168C0 (92352) pixels
-0x10A2, 0x10A2, 0x10C2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x168D0 (92368) pixels
-0x1082, 0x10A2, 0x1082, 0x0841, 0x0841, 0x0820, 0x0020, 0x0820, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841,   // 0x168E0 (92384) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861,   // 0x168F0 (92400) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081,   // 0x16900 (92416) pixels
-0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1081, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x16910 (92432) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x16920 (92448) pixels
-0x1061, 0x1061, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1061,   // 0x16930 (92464) pixels
-0x1081, 0x1081, 0x1061, 0x1082, 0x1061, 0x1061, 0x1061, 0x1082, 0x1081, 0x1061, 0x1061, 0x0861, 0x1081, 0x1061, 0x0861, 0x1081,   // 0x16940 (92480) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16950 (92496) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0000, 0x0000,   // 0x16960 (92512) pixels
-0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0040, 0x0840, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841,   // 0x16970 (92528) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861,   // 0x16980 (92544) pixels
-0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861,   // 0x16990 (92560) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x169A0 (92576) pixels
-0x0840, 0x0040, 0x0020, 0x0840, 0x1061, 0x10A2, 0x1082, 0x1081, 0x0861, 0x0841, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0841,   // 0x169B0 (92592) pixels
-0x0861, 0x0881, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x169C0 (92608) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082,   // 0x169D0 (92624) pixels
-0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x169E0 (92640) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x169F0 (92656) pixels
-0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x16A00 (92672) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082,   // 0x16A10 (92688) pixels
-0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0820, 0x0841, 0x0861, 0x1081, 0x1082, 0x0861, 0x0841, 0x0840, 0x0841, 0x0841, 0x0841,   // 0x16A20 (92704) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061,   // 0x16A30 (92720) pixels
-0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x16A40 (92736) pixels
-0x1062, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861,   // 0x16A50 (92752) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1061, 0x1082, 0x1081, 0x1061,   // 0x16A60 (92768) pixels
-0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1061, 0x1061,   // 0x16A70 (92784) pixels
-0x1082, 0x1061, 0x1061, 0x1082, 0x0881, 0x0861, 0x1062, 0x1081, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061,   // 0x16A80 (92800) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16A90 (92816) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0020, 0x0000,   // 0x16AA0 (92832) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841,   // 0x16AB0 (92848) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861,   // 0x16AC0 (92864) pixels
-0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x16AD0 (92880) pixels
-0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841,   // 0x16AE0 (92896) pixels
-0x0841, 0x0840, 0x0840, 0x0040, 0x0841, 0x0861, 0x1081, 0x1082, 0x1081, 0x0861, 0x0841, 0x0820, 0x0020, 0x0020, 0x0000, 0x0020,   // 0x16AF0 (92912) pixels
-0x0020, 0x0840, 0x0861, 0x0861, 0x0881, 0x0881, 0x0882, 0x0881, 0x10A2, 0x18C3, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2,   // 0x16B00 (92928) pixels
-0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x16B10 (92944) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082,   // 0x16B20 (92960) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x16B30 (92976) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16B40 (92992) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x0861, 0x0841, 0x0841, 0x0840,   // 0x16B50 (93008) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16B60 (93024) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x16B70 (93040) pixels
-0x1081, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x16B80 (93056) pixels
-0x1062, 0x1082, 0x1062, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16B90 (93072) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1081, 0x1081, 0x1082, 0x1081, 0x1081, 0x1082,   // 0x16BA0 (93088) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1061, 0x1082, 0x1081, 0x1082, 0x1061, 0x1081, 0x1082, 0x1061,   // 0x16BB0 (93104) pixels
-0x1061, 0x1082, 0x1061, 0x1081, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1061, 0x1082, 0x1061, 0x1081, 0x1081, 0x1081, 0x1061,   // 0x16BC0 (93120) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16BD0 (93136) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020,   // 0x16BE0 (93152) pixels
-0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x16BF0 (93168) pixels
-0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861,   // 0x16C00 (93184) pixels
-0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841,   // 0x16C10 (93200) pixels
-0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x16C20 (93216) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0840, 0x0020,   // 0x16C30 (93232) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x0841, 0x0861, 0x0861, 0x0861, 0x1081, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x16C40 (93248) pixels
-0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2,   // 0x16C50 (93264) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x16C60 (93280) pixels
-0x10A2, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x16C70 (93296) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16C80 (93312) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0841, 0x0820, 0x0020, 0x0020, 0x0820, 0x0841,   // 0x16C90 (93328) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0840, 0x0840, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16CA0 (93344) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x0881, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x16CB0 (93360) pixels
-0x1081, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x0881, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x16CC0 (93376) pixels
-0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1061, 0x1061, 0x0861, 0x0881, 0x0861, 0x1061, 0x0861, 0x1061,   // 0x16CD0 (93392) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x16CE0 (93408) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1062, 0x0861, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x16CF0 (93424) pixels
-0x1061, 0x1062, 0x1081, 0x1081, 0x1081, 0x0881, 0x1082, 0x1081, 0x0861, 0x1081, 0x1061, 0x1082, 0x1081, 0x1081, 0x1061, 0x1061,   // 0x16D00 (93440) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16D10 (93456) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040,   // 0x16D20 (93472) pixels
-0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x16D30 (93488) pixels
-0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861,   // 0x16D40 (93504) pixels
-0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x16D50 (93520) pixels
-0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x16D60 (93536) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0820, 0x0840, 0x0841, 0x1081, 0x0861,   // 0x16D70 (93552) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x0861, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2,   // 0x16D80 (93568) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x18A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081,   // 0x16D90 (93584) pixels
-0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082,   // 0x16DA0 (93600) pixels
-0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x16DB0 (93616) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x10A2, 0x10A2,   // 0x16DC0 (93632) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0020, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0861,   // 0x16DD0 (93648) pixels
-0x1081, 0x1081, 0x0861, 0x0841, 0x0040, 0x0840, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16DE0 (93664) pixels
-0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x16DF0 (93680) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061,   // 0x16E00 (93696) pixels
-0x1082, 0x1061, 0x1082, 0x1062, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16E10 (93712) pixels
-0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082,   // 0x16E20 (93728) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1081, 0x0881, 0x0861, 0x1061, 0x1061, 0x1061,   // 0x16E30 (93744) pixels
-0x1061, 0x1082, 0x1081, 0x1061, 0x1061, 0x0861, 0x0861, 0x1081, 0x1061, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x1081, 0x1061,   // 0x16E40 (93760) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16E50 (93776) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16E60 (93792) pixels
-0x0861, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0841, 0x0861, 0x0841,   // 0x16E70 (93808) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841,   // 0x16E80 (93824) pixels
-0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841,   // 0x16E90 (93840) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x16EA0 (93856) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0820, 0x0841, 0x0861,   // 0x16EB0 (93872) pixels
-0x10A2, 0x10A2, 0x10A2, 0x1082, 0x0841, 0x0040, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0041, 0x0861, 0x0861, 0x0861, 0x0882,   // 0x16EC0 (93888) pixels
-0x0881, 0x0881, 0x0881, 0x0882, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x16ED0 (93904) pixels
-0x1082, 0x1082, 0x1081, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2,   // 0x16EE0 (93920) pixels
-0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x16EF0 (93936) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x16F00 (93952) pixels
-0x1082, 0x1082, 0x0861, 0x0841, 0x0841, 0x0840, 0x0820, 0x0000, 0x0000, 0x0020, 0x0020, 0x0820, 0x0841, 0x0841, 0x0861, 0x0861,   // 0x16F10 (93968) pixels
-0x1061, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16F20 (93984) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861,   // 0x16F30 (94000) pixels
-0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x16F40 (94016) pixels
-0x1062, 0x1062, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16F50 (94032) pixels
-0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1062, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x16F60 (94048) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x0861, 0x0861, 0x1081, 0x1081, 0x1061, 0x0861, 0x0861, 0x1081, 0x1082, 0x1081,   // 0x16F70 (94064) pixels
-0x1061, 0x1081, 0x1082, 0x1082, 0x0861, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081,   // 0x16F80 (94080) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16F90 (94096) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x16FA0 (94112) pixels
-0x0861, 0x0040, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840,   // 0x16FB0 (94128) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861,   // 0x16FC0 (94144) pixels
-0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841,   // 0x16FD0 (94160) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x16FE0 (94176) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x16FF0 (94192) pixels
-0x0841, 0x0861, 0x0861, 0x1081, 0x1082, 0x0861, 0x0840, 0x0020, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x17000 (94208) pixels
-0x0020, 0x0020, 0x0841, 0x0861, 0x1062, 0x1082, 0x0861, 0x0861, 0x0882, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x17010 (94224) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x17020 (94240) pixels
-0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x17030 (94256) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0840,   // 0x17040 (94272) pixels
-0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x17050 (94288) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17060 (94304) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x0881,   // 0x17070 (94320) pixels
-0x1081, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x17080 (94336) pixels
-0x1062, 0x1062, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1061,   // 0x17090 (94352) pixels
-0x1061, 0x1081, 0x1082, 0x1061, 0x1081, 0x1061, 0x1061, 0x0881, 0x1061, 0x1062, 0x1061, 0x0861, 0x1082, 0x1081, 0x1082, 0x1082,   // 0x170A0 (94368) pixels
-0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1062, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061,   // 0x170B0 (94384) pixels
-0x1061, 0x1081, 0x1062, 0x1062, 0x1061, 0x1081, 0x1062, 0x0861, 0x0861, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081,   // 0x170C0 (94400) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x170D0 (94416) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x170E0 (94432) pixels
-0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,   // 0x170F0 (94448) pixels
-0x0020, 0x0840, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841,   // 0x17100 (94464) pixels
-0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841,   // 0x17110 (94480) pixels
-0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x17120 (94496) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x17130 (94512) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0040, 0x0020, 0x0020, 0x0020, 0x0040, 0x0840, 0x0840, 0x0840, 0x0840,   // 0x17140 (94528) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1082,   // 0x17150 (94544) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x10A2, 0x10A2,   // 0x17160 (94560) pixels
-0x10A2, 0x10A2, 0x10A2, 0x10A2, 0x1082, 0x1082, 0x10A2, 0x1082, 0x10A2, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082,   // 0x17170 (94576) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x0861, 0x0861, 0x0841, 0x0841, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x17180 (94592) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0840, 0x0840, 0x0841, 0x0840, 0x0841, 0x0841, 0x0841,   // 0x17190 (94608) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x171A0 (94624) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061,   // 0x171B0 (94640) pixels
-0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x171C0 (94656) pixels
-0x1062, 0x1061, 0x1062, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081,   // 0x171D0 (94672) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1081,   // 0x171E0 (94688) pixels
-0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1062, 0x1062, 0x1081, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1062, 0x1082,   // 0x171F0 (94704) pixels
-0x1081, 0x1081, 0x1061, 0x1062, 0x1061, 0x0861, 0x1061, 0x1061, 0x1081, 0x1061, 0x1061, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081,   // 0x17200 (94720) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17210 (94736) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17220 (94752) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x17230 (94768) pixels
-0x0000, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861,   // 0x17240 (94784) pixels
-0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x17250 (94800) pixels
-0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x17260 (94816) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x17270 (94832) pixels
-0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0820, 0x0841, 0x0840, 0x0840, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861,   // 0x17280 (94848) pixels
-0x0841, 0x0841, 0x0020, 0x0020, 0x0040, 0x0840, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17290 (94864) pixels
-0x0881, 0x0881, 0x1082, 0x1082, 0x0882, 0x1082, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x0881, 0x0881, 0x1082, 0x0881, 0x1082,   // 0x172A0 (94880) pixels
-0x1082, 0x1082, 0x0882, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1081,   // 0x172B0 (94896) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0840,   // 0x172C0 (94912) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0040, 0x0840, 0x0840, 0x0840, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861,   // 0x172D0 (94928) pixels
-0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x172E0 (94944) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x172F0 (94960) pixels
-0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061,   // 0x17300 (94976) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1062, 0x1081, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x17310 (94992) pixels
-0x0881, 0x1061, 0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861,   // 0x17320 (95008) pixels
-0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1061, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082,   // 0x17330 (95024) pixels
-0x1081, 0x1061, 0x1062, 0x1062, 0x1061, 0x1081, 0x1081, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1061,   // 0x17340 (95040) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17350 (95056) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17360 (95072) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x17370 (95088) pixels
-0x0000, 0x0000, 0x0020, 0x0820, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841,   // 0x17380 (95104) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841,   // 0x17390 (95120) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861,   // 0x173A0 (95136) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x173B0 (95152) pixels
-0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x1061,   // 0x173C0 (95168) pixels
-0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040,   // 0x173D0 (95184) pixels
-0x0020, 0x0040, 0x0040, 0x0841, 0x0041, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x173E0 (95200) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x173F0 (95216) pixels
-0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0820, 0x0840, 0x0841, 0x0841, 0x0820, 0x0020, 0x0841, 0x0841,   // 0x17400 (95232) pixels
-0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17410 (95248) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17420 (95264) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x17430 (95280) pixels
-0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861,   // 0x17440 (95296) pixels
-0x1061, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081,   // 0x17450 (95312) pixels
-0x0861, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861,   // 0x17460 (95328) pixels
-0x1061, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x1081, 0x0881, 0x1061, 0x1081, 0x1082, 0x1081,   // 0x17470 (95344) pixels
-0x1082, 0x1082, 0x1082, 0x1061, 0x1082, 0x1081, 0x1081, 0x1082, 0x1061, 0x1081, 0x1061, 0x1061, 0x1082, 0x1082, 0x1061, 0x1062,   // 0x17480 (95360) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17490 (95376) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x174A0 (95392) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x174B0 (95408) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861,   // 0x174C0 (95424) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x174D0 (95440) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841,   // 0x174E0 (95456) pixels
-0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841,   // 0x174F0 (95472) pixels
-0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0840, 0x0840, 0x0840, 0x0841,   // 0x17500 (95488) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x17510 (95504) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0840, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,   // 0x17520 (95520) pixels
-0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0840,   // 0x17530 (95536) pixels
-0x0840, 0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0840,   // 0x17540 (95552) pixels
-0x0840, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17550 (95568) pixels
-0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17560 (95584) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861,   // 0x17570 (95600) pixels
-0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0881, 0x1061, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061,   // 0x17580 (95616) pixels
-0x1062, 0x1061, 0x1061, 0x1061, 0x1061, 0x1081, 0x1081, 0x1082, 0x1082, 0x1082, 0x1062, 0x1082, 0x1082, 0x1082, 0x1081, 0x0881,   // 0x17590 (95632) pixels
-0x1061, 0x1061, 0x0861, 0x1061, 0x1062, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861,   // 0x175A0 (95648) pixels
-0x1061, 0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1082, 0x1081, 0x1082, 0x1081, 0x1081, 0x1061, 0x1081, 0x1081, 0x1081, 0x1061,   // 0x175B0 (95664) pixels
-0x1082, 0x1081, 0x1061, 0x1082, 0x1082, 0x1081, 0x1081, 0x1082, 0x1082, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061,   // 0x175C0 (95680) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x175D0 (95696) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x175E0 (95712) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0040, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0x175F0 (95728) pixels
-0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0840, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0841, 0x0861,   // 0x17600 (95744) pixels
-0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841,   // 0x17610 (95760) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841, 0x0861, 0x0841,   // 0x17620 (95776) pixels
-0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861, 0x0841, 0x0861, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841,   // 0x17630 (95792) pixels
-0x0841, 0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x17640 (95808) pixels
-0x0841, 0x0841, 0x0841, 0x0841, 0x0840, 0x0841, 0x0861, 0x0861, 0x0861, 0x1082, 0x1082, 0x1081, 0x0861, 0x0881, 0x1081, 0x1081,   // 0x17650 (95824) pixels
-0x1061, 0x1082, 0x1081, 0x1081, 0x1081, 0x1061, 0x1081, 0x1061, 0x1061, 0x0861, 0x1061, 0x0861, 0x1081, 0x1082, 0x1081, 0x1082,   // 0x17660 (95840) pixels
-0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x1061, 0x0861, 0x1061, 0x0881, 0x0861, 0x0861,   // 0x17670 (95856) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,   // 0x17680 (95872) pixels
-0x0841, 0x0841, 0x0861, 0x0841, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x17690 (95888) pixels
-0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,   // 0x176A0 (95904) pixels
-0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x0861, 0x0861,   // 0x176B0 (95920) pixels
-0x0861, 0x0861, 0x1061, 0x1061, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x1061,   // 0x176C0 (95936) pixels
-0x1061, 0x1061, 0x1062, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1061, 0x1061, 0x1061, 0x1061, 0x0881,   // 0x176D0 (95952) pixels
-0x1081, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861, 0x1061, 0x0861, 0x0861, 0x1061, 0x1061, 0x1061, 0x0861, 0x0861, 0x1061, 0x0861,   // 0x176E0 (95968) pixels
-0x1061, 0x1081, 0x1061, 0x1061, 0x1061, 0x1061, 0x1082, 0x1082, 0x1082, 0x1082, 0x1081, 0x1081, 0x1061, 0x1061, 0x1061, 0x1081,   // 0x176F0 (95984) pixels
-0x1061, 0x1062, 0x1082, 0x1081, 0x0881, 0x1081, 0x1082, 0x0881, 0x1081, 0x1082, 0x1081, 0x1062, 0x1061, 0x1061, 0x1082, 0x1082,   // 0x17700 (96000) pixels
-
-};
\ No newline at end of file
@@ -0,0 +1,6035 @@
+#pragma once
+
+// Generated by tools/gen_plane_cache.cpp from assets/plane.png. Do not edit.
+// Source hash: aa895028bdb8b509
+// Angles -30 to 30, 71160 pixels, 4792 spans, 4922 rows
+// Flash used : 191234 bytes
+
+static const uint16_t planeCachePixels[71160] PROGMEM = {
+0x2F94, 0xAD7B, 0xB0A4, 0x6F9C, 0x77DE, 0x15D6, 0xD1AC, 0xF1AC, 0x97E6, 0x77E6, 0x57DE, 0x15D6, 0xF1AC, 0xD1AC, 0x76DE, 0x77DE,
+0x56DE, 0x57DE, 0xF1AC, 0xF1AC, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x11AD, 0xF1AC, 0x97E6, 0x76E6, 0x77DE, 0x77DE, 0x8FA4, 0x32B5,
+0x12B5, 0xB8E6, 0x97E6, 0x98DE, 0x76DE, 0x11B5, 0x8FA4, 0x32B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0x98DE, 0x52BD, 0x11B5, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0x15D6, 0x32B5, 0x32B5, 0x96E6, 0x77DE, 0x77E6, 0x77E6, 0x56DE, 0x36DE, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x77DE, 0x32B5, 0x32B5, 0x76E6, 0xB8E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x32B5,
+0x32B5, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x32B5, 0x52BD, 0x97E6, 0x96E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x8C7B,
+0x32B5, 0x32B5, 0x97E6, 0xB8E6, 0x98E6, 0x96E6, 0x98E6, 0x98E6, 0x6FA4, 0x6FA4, 0x32B5, 0x52BD, 0x97E6, 0x97E6, 0x77DE, 0x77DE,
+0x97E6, 0x97E6, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97DE, 0xF5D5, 0xD4CD, 0x32B5, 0x32B5,
+0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x96DE, 0x96DE, 0x36D6, 0x15D6, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x96DE,
+0x35DE, 0x35DE, 0x32B5, 0x32BD, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x77DE, 0x77DE, 0x77E6, 0x77DE, 0x32B5, 0x32B5, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x32B5, 0x93C5, 0x32B5, 0x32B5, 0x97E6, 0xB7E6, 0xB8E6, 0x96DE, 0x96E6, 0x77DE,
+0x97E6, 0x97E6, 0x32B5, 0x73C5, 0x35D6, 0x32BD, 0x32BD, 0x97E6, 0xB7E6, 0x97DE, 0xB8E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x94C5,
+0x77DE, 0x32BD, 0x32B5, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xF5CD, 0x56DE, 0x32B5, 0x52BD, 0x77E6,
+0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x77E6, 0x96E6, 0xB7E6, 0xF5D5, 0x77DE, 0x32B5, 0x32B5, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x98E6,
+0x96E6, 0x96DE, 0xB7E6, 0xF5CD, 0x35D6, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x96E6,
+0x97E6, 0x2F94, 0xEE8B, 0xD4D5, 0x35D6, 0x35D6, 0x15CE, 0xD5CD, 0xF5CD, 0x52BD, 0x12B5, 0x32B5, 0x98E6, 0x77E6, 0xB8E6, 0x97E6,
+0x97DE, 0x97DE, 0x96E6, 0x96DE, 0x32BD, 0x6FA4, 0xD4CD, 0x15D6, 0x15CE, 0xF5CD, 0x56DE, 0x36D6, 0xF1B4, 0xF1AC, 0x76E6, 0x77E6,
+0xB8E6, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0xD4CD, 0x72BD, 0xD4CD, 0xF5D5, 0x15D6, 0x16D6, 0x15CE, 0x56DE, 0x56DE, 0xF1AC,
+0xF1B4, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x15D6, 0xF5D5, 0x15D6, 0x56DE, 0x36D6, 0x36D6, 0x77DE,
+0x56DE, 0x11AD, 0xF1AC, 0x77E6, 0x76DE, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x15D6, 0xF5D5, 0x55DE, 0x55DE, 0xEE8B,
+0x15D6, 0x16D6, 0x36D6, 0x97E6, 0x77DE, 0xF1AC, 0xF1AC, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0xB7DE, 0x97DE, 0x56DE,
+0x56DE, 0x77DE, 0x55DE, 0x32B5, 0xD5CD, 0x36D6, 0x98E6, 0x97E6, 0x98E6, 0x15D6, 0xD5CD, 0xD5CD, 0x53BD, 0x16D6, 0x16D6, 0x97E6,
+0x96E6, 0x6F9C, 0x6F9C, 0xF1AC, 0xF1AC, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x36D6, 0x35DE, 0xED8B,
+0x56DE, 0x76DE, 0xD5CD, 0x97E6, 0x98E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x98E6, 0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x77E6, 0x97E6, 0xD0AC,
+0xD0AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB8E6, 0x36DE, 0x36DE, 0x57DE, 0x56DE, 0x77DE,
+0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6, 0xD8E6, 0x98E6, 0x76DE, 0x36D6, 0x35DE, 0x56DE, 0x52BD, 0xD0AC, 0xF1AC, 0xF1AC, 0x76E6,
+0x97E6, 0xB7E6, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0x56DE, 0x57DE, 0x0E94, 0x52B5, 0x52B5, 0x96DE, 0x77DE, 0x76DE, 0x77DE,
+0xD4CD, 0xB8E6, 0x98E6, 0x98E6, 0x98DE, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x32B5, 0x11AD, 0x98E6, 0x97E6, 0x77E6, 0x77E6,
+0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x76DE, 0x77E6, 0xF1AC, 0xF1AC, 0x56DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x14CE,
+0x77DE, 0x97DE, 0xB8E6, 0x56DE, 0x77DE, 0x56DE, 0xB4CD, 0xD5CD, 0xD4CD, 0x11B5, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6,
+0x98E6, 0x97E6, 0x77DE, 0x77DE, 0xB4CD, 0x93C5, 0xF5CD, 0x56DE, 0x97E6, 0xB8E6, 0xB8E6, 0x36D6, 0x77DE, 0x97E6, 0x56DE, 0x77DE,
+0x97E6, 0xB7E6, 0x98E6, 0x77DE, 0x32BD, 0xB4CD, 0x96DE, 0x96DE, 0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6,
+0x97E6, 0x77DE, 0xD4CD, 0xB4CD, 0x56DE, 0x76DE, 0x97E6, 0x98E6, 0x96DE, 0xB8E6, 0x77DE, 0x96DE, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6,
+0xB0AC, 0xB0AC, 0x77E6, 0xB8E6, 0xD8E6, 0x77E6, 0x77E6, 0x98E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x15D6, 0xF5CD,
+0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x77DE, 0x56DE, 0x98E6, 0x97E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x4F9C, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE,
+0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0x97E6, 0x77DE, 0x55DE, 0x77DE, 0x36DE, 0x35D6, 0x97E6, 0x35D6, 0x56DE, 0x97DE, 0x97E6,
+0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x97E6, 0xB7E6, 0x97E6, 0x97E6, 0xD8E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x96E6, 0x77DE, 0x32B5, 0x35D6, 0x56D6, 0x56D6, 0x57DE, 0x76DE, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0xB7E6, 0xB7E6, 0xB8E6, 0xD9E6,
+0x97E6, 0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x77DE, 0x97E6, 0x96E6, 0x36D6, 0x56DE, 0x76DE, 0x77DE, 0x56DE, 0x77DE,
+0xB0A4, 0xB0A4, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x76E6, 0xB8E6, 0x97E6, 0x76DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6,
+0x15D6, 0x15D6, 0x98E6, 0x35D6, 0x56D6, 0x56D6, 0x32BD, 0x12B5, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6,
+0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x96DE, 0x15D6, 0x15D6, 0x97E6, 0x97E6, 0x15D6, 0x36D6, 0xB4CD, 0x32BD, 0x77E6, 0xB8E6,
+0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0xD9E6, 0xD9E6, 0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0x16D6, 0x16D6, 0x97E6, 0x76DE,
+0xB0A4, 0x94C5, 0xD4CD, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0x97DE, 0x76DE, 0x76DE, 0x36D6, 0x36D6, 0x55DE, 0x77DE, 0x2F9C, 0x8FA4, 0x32B5, 0xF5D5, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6,
+0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x76DE, 0xB8E6, 0x35D6, 0x8C7B, 0x36D6, 0x36D6, 0x15D6, 0x55DE, 0x2E94,
+0x2E94, 0x11B5, 0x12B5, 0xB7E6, 0x97E6, 0xB9E6, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x96E6, 0xB8EE, 0xB8E6,
+0x97E6, 0x76DE, 0x56DE, 0x36D6, 0x36D6, 0x15D6, 0x36D6, 0xF1B4, 0xF1B4, 0x98E6, 0xB7E6, 0x97E6, 0xB9E6, 0xB8E6, 0x98E6, 0xB8E6,
+0xB8E6, 0xB7E6, 0x98E6, 0x97E6, 0x96E6, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0xD5CD, 0x2E94, 0xD5CD, 0x36D6, 0xF5D5, 0xF5D5, 0x11B5,
+0x32B5, 0x97E6, 0x76E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0x97DE, 0xB7E6, 0x97DE, 0x97DE, 0x97DE, 0x56DE,
+0x76DE, 0x35D6, 0xF5D5, 0xF5CD, 0xF5D5, 0x32B5, 0x12B5, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97DE, 0x98E6, 0xB8E6, 0x97E6, 0x98E6,
+0x98E6, 0xB8E6, 0xB8E6, 0x35DE, 0x35D6, 0xF5D5, 0x32B5, 0x32B5, 0x96DE, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97E6, 0x97DE,
+0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x52BD, 0x52BD, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0xB6E6, 0x97E6, 0x77DE, 0x97DE,
+0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x77DE, 0x96E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98DE, 0x97E6, 0x98E6, 0x56DE, 0x97E6,
+0x53BD, 0x32B5, 0x96E6, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x77DE, 0x97E6, 0xD4CD, 0x15D6, 0x53BD, 0x53BD,
+0x97E6, 0x76E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0xD4CD, 0xD4CD, 0x53BD, 0x32B5, 0x97E6, 0x97E6,
+0x98E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x76DE, 0x76E6, 0x11B5, 0x93C5, 0x53BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0xB9E6, 0x97E6, 0xB8E6, 0xB8E6, 0x76DE, 0x76DE, 0xB0AC, 0xB0AC, 0x52BD, 0x73BD, 0x96E6, 0x76DE, 0x77DE, 0x98E6, 0xB8E6, 0x77DE,
+0x97E6, 0x97E6, 0x56D6, 0x56DE, 0x8C7B, 0x52BD, 0x52BD, 0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x56DE,
+0x35D6, 0x73BD, 0x73BD, 0x97DE, 0x97E6, 0xB8E6, 0x77DE, 0x97DE, 0x97DE, 0x76E6, 0x97DE, 0x36D6, 0x56DE, 0x93BD, 0x73BD, 0x97E6,
+0x97E6, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xF5CD, 0xF5D5, 0x93C5, 0x93C5, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x98E6,
+0x97DE, 0x97E6, 0x97E6, 0x11B5, 0x11B5, 0x93BD, 0x93BD, 0x77E6, 0x97E6, 0xB8E6, 0x77DE, 0x76DE, 0x98E6, 0x96E6, 0x96E6, 0x6FA4,
+0xF1AC, 0x93C5, 0x93C5, 0x76E6, 0xB7E6, 0x77E6, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0x98E6, 0xAC83, 0x0E94, 0xB4C5, 0xB4C5, 0x97E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x97DE, 0x76E6, 0x77DE, 0x76DE, 0x96E6,
+0x97E6, 0xB4C5, 0xB4C5, 0x97E6, 0x96E6, 0xB8E6, 0x97DE, 0x98E6, 0x77DE, 0x97DE, 0x76E6, 0xD4CD, 0xD4CD, 0x96DE, 0x76DE, 0x76DE,
+0x77E6, 0x98DE, 0x77DE, 0x77DE, 0x97E6, 0xD4CD, 0xD4C5, 0x77DE, 0x96E6, 0x96DE, 0x96DE, 0x97E6, 0x98E6, 0x56DE, 0x56DE, 0xD4CD,
+0xD4CD, 0x97DE, 0x98E6, 0x97DE, 0xB8E6, 0x76DE, 0x97E6, 0x35D6, 0x35D6, 0xD5CD, 0xD4CD, 0x97DE, 0x97E6, 0x97E6, 0x98E6, 0x96DE,
+0x76DE, 0xB4CD, 0xF5CD, 0xD5CD, 0xD5CD, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0xF1B4, 0x52BD, 0xF5CD, 0xD5CD, 0x76DE,
+0x76DE, 0x78E6, 0x98E6, 0x97E6, 0x97E6, 0xED8B, 0x4F9C, 0xD5CD, 0xF5CD, 0x98DE, 0x77E6, 0x98E6, 0x78E6, 0x97E6, 0x97E6, 0xF5CD,
+0xF5CD, 0x97DE, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0x77E6, 0xF5CD,
+0xF5CD, 0x96DE, 0x97E6, 0x76DE, 0x77E6, 0xD4CD, 0x35D6, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x97DE, 0x76DE, 0xF1B4, 0xD4CD, 0xF5CD,
+0xF5CD, 0xB8E6, 0x76DE, 0x77E6, 0x77E6, 0x6FA4, 0x6FA4, 0xF5CD, 0xF5CD, 0x97DE, 0x97E6, 0x56DE, 0x56DE, 0xF5CD, 0xF5CD, 0x97E6,
+0x97E6, 0x56DE, 0x57DE, 0xD5CD, 0xD5CD, 0x76E6, 0x98E6, 0x35D6, 0x56DE, 0x36D6, 0x56DE, 0x36D6, 0x35D6, 0xF5D5, 0xF5D5, 0xAD7B,
+0x6F9C, 0x2F94, 0x77DE, 0x15D6, 0xD1AC, 0xF1AC, 0x97E6, 0x77E6, 0x15D6, 0xF5CD, 0xF1AC, 0xF1AC, 0xD1AC, 0x77DE, 0x97E6, 0x57DE,
+0x57DE, 0xF1AC, 0xF1AC, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0xF1AC, 0xF1AC, 0x97E6, 0x76E6, 0x77DE, 0x77DE, 0x32B5, 0x12B5, 0xB8E6,
+0x97E6, 0x76DE, 0x76DE, 0x8FA4, 0x8FA4, 0x32B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xF5D5, 0x52BD, 0x11B5, 0x32B5, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0xF5D5, 0x32B5, 0x32B5, 0x96E6, 0x77DE, 0x77E6, 0x76DE, 0x36DE, 0x36D6, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x32B5, 0x32B5, 0x76E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x32B5,
+0x32B5, 0x98E6, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x96E6, 0xB8E6, 0x97DE, 0x96DE, 0x97E6,
+0x8C7B, 0x32BD, 0x32B5, 0x97E6, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x32B5, 0x52BD, 0x97E6, 0x97E6, 0x76DE,
+0x77DE, 0x76DE, 0x97E6, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x77DE, 0x97E6, 0x97DE, 0x97DE, 0xF5D5, 0xD4CD, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x96DE, 0x36D6, 0x36D6, 0x15D6, 0x32BD, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6,
+0x97E6, 0x97DE, 0x77DE, 0x57DE, 0x35DE, 0x32B5, 0x32BD, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x77DE, 0x77E6, 0x77DE, 0x32B5,
+0x93C5, 0x35D6, 0x32B5, 0x32B5, 0xB7E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x73C5, 0x35D6, 0x32BD, 0x32B5,
+0xB7E6, 0x97E6, 0xB8E6, 0x96DE, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x94C5, 0x94C5, 0x76DE, 0x32B5, 0x32BD, 0xB7E6, 0x97E6, 0xB8E6,
+0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF5CD, 0x56DE, 0x52BD, 0x32BD, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB8E6, 0x98E6,
+0xB8E6, 0xB8E6, 0x97E6, 0xF5D5, 0xF5CD, 0x77DE, 0x32B5, 0x52BD, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0x77E6, 0x96E6, 0xB7E6,
+0xF5CD, 0x35D6, 0x53BD, 0x32B5, 0x32B5, 0x98E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0x96DE, 0xEE8B, 0xF5D5, 0x35D6,
+0xD5CD, 0xB4C5, 0x52BD, 0x32B5, 0x11B5, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x96DE, 0x96E6, 0x6FA4, 0x2F94, 0xD4CD,
+0x15D6, 0xF5CD, 0x15CE, 0x36D6, 0xF5CD, 0xF1AC, 0x12B5, 0x77E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97DE, 0x97E6, 0x96E6, 0x72BD,
+0x32BD, 0x32BD, 0xF5D5, 0x15D6, 0x16D6, 0x15CE, 0x56DE, 0x56DE, 0xF1AC, 0xF1B4, 0x98E6, 0x77E6, 0x76E6, 0xB8E6, 0xB8E6, 0x96DE,
+0x98E6, 0x97E6, 0x97E6, 0xF5D5, 0xD4CD, 0x15D6, 0x56DE, 0x15D6, 0x36D6, 0x36D6, 0x77DE, 0x56DE, 0xF1AC, 0xD1AC, 0x76DE, 0x98E6,
+0x98E6, 0xB8E6, 0x97DE, 0x97DE, 0x98E6, 0x76E6, 0xF5D5, 0x15D6, 0x55DE, 0x55DE, 0xEE8B, 0x93C5, 0x15D6, 0x36D6, 0x36D6, 0x77DE,
+0x77DE, 0xF1AC, 0x11AD, 0x98E6, 0x77E6, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x56DE, 0x15D6, 0x77DE, 0x55DE, 0x55DE,
+0xD5CD, 0x36D6, 0x98E6, 0x97E6, 0x15D6, 0x15D6, 0xD5CD, 0x16D6, 0x16D6, 0x96E6, 0x96E6, 0x6F9C, 0x2F94, 0xF1AC, 0xF1AC, 0x98E6,
+0x98E6, 0xB8E6, 0xB7E6, 0x97DE, 0x97E6, 0x97E6, 0xB7DE, 0x35DE, 0x35DE, 0xED8B, 0x56DE, 0x76DE, 0xD5CD, 0x97E6, 0x98E6, 0xB7E6,
+0xB7E6, 0xB8E6, 0x98E6, 0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x77E6, 0x97E6, 0xD0AC, 0xD0AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x77DE,
+0x98E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB8E6, 0x36DE, 0x36DE, 0x36D6, 0x57DE, 0x56DE, 0x56DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6,
+0xD8E6, 0x98E6, 0x76DE, 0x36D6, 0x35DE, 0x56DE, 0x52BD, 0xD0AC, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0xB7E6, 0x98E6, 0x77DE, 0x97E6,
+0x97E6, 0x97E6, 0xB7DE, 0x57DE, 0x36DE, 0x52B5, 0x96DE, 0x77DE, 0x76DE, 0x77DE, 0xD4CD, 0xB8E6, 0x97E6, 0x98E6, 0x98DE, 0x77DE,
+0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x11AD, 0xF1AC, 0x97E6, 0x76E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x77E6, 0x56DE,
+0xB0A4, 0xB0A4, 0x56DE, 0x97E6, 0x97E6, 0x98E6, 0x36D6, 0x97E6, 0x97E6, 0x14CE, 0x77DE, 0x97DE, 0x98DE, 0x56DE, 0x56DE, 0x56DE,
+0x56DE, 0xD5CD, 0x11B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x76DE, 0x97E6, 0x97DE, 0x77DE, 0x77DE, 0x93C5, 0x11B5,
+0xF5CD, 0xF5CD, 0x97E6, 0xB8E6, 0xB8E6, 0x36D6, 0x77DE, 0x97E6, 0x56DE, 0x56DE, 0x97E6, 0xB7E6, 0x98E6, 0x77DE, 0x32BD, 0xB4CD,
+0x96DE, 0x96DE, 0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0xD4CD, 0xB4CD, 0x56DE, 0x76DE,
+0x97E6, 0x98E6, 0x96DE, 0x96DE, 0x77DE, 0x96DE, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0xB0AC, 0xB0AC, 0x77E6, 0xB8E6, 0xD8E6, 0x77E6,
+0x77E6, 0x98E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xF5CD, 0xD4CD, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE,
+0x56DE, 0x98E6, 0x97E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x4F9C, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6,
+0x97E6, 0x77E6, 0x55DE, 0x97E6, 0x36DE, 0x15D6, 0x35D6, 0x97E6, 0x35D6, 0x56DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C,
+0x4F9C, 0xB7E6, 0xB8E6, 0x97E6, 0x77E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xB8E6, 0x56E6, 0x77DE, 0x77DE, 0x32B5,
+0x55D6, 0x56D6, 0x56D6, 0x57DE, 0x76DE, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0xB7E6, 0xB7E6, 0xB8E6, 0xD9E6, 0x97E6, 0xD8E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x77DE, 0x97E6, 0x96E6, 0x36D6, 0x56DE, 0x76DE, 0x77DE, 0x56DE, 0x77DE, 0xB0A4, 0xB0A4, 0x97E6,
+0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x76E6, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6, 0x15D6, 0x15D6, 0x98E6,
+0x35D6, 0x56D6, 0x56D6, 0x32BD, 0x12B5, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97DE, 0x98E6, 0x77E6,
+0x97E6, 0x96DE, 0x96DE, 0xB8E6, 0x36D6, 0x15D6, 0x97E6, 0x97E6, 0x94C5, 0x15D6, 0xD4CD, 0xB4CD, 0x97DE, 0x77E6, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0xD9E6, 0x97DE, 0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0x15D6, 0x15D6, 0x77DE, 0x97E6, 0x8FA4,
+0xB0A4, 0xD4CD, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97DE,
+0x76DE, 0x56DE, 0x36D6, 0x36D6, 0x36D6, 0x55DE, 0x77DE, 0x2F9C, 0x8FA4, 0x32B5, 0xF5D5, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6,
+0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x96E6, 0x76DE, 0xB8E6, 0x35D6, 0x8C7B, 0x36D6, 0x36D6, 0x15D6, 0x55DE, 0x2E94,
+0x11B5, 0x12B5, 0xB7E6, 0x97E6, 0xB9E6, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x96E6, 0xB8EE, 0xB8E6, 0x97E6,
+0x76DE, 0x56DE, 0x36D6, 0x36D6, 0x15D6, 0x15D6, 0x12B5, 0xF1B4, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6,
+0x97DE, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xD5CD, 0x2E94, 0xD5CD, 0xD5CD, 0xF5D5, 0xF5D5, 0x11B5,
+0x11B5, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x96DE, 0x97E6, 0x97DE, 0xB7E6, 0x97DE, 0x97DE, 0x97E6,
+0x56DE, 0x76DE, 0x35D6, 0xF5D5, 0xF5CD, 0x32B5, 0x32B5, 0x12B5, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97DE, 0x98E6, 0xB8E6, 0x97E6,
+0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0x35DE, 0x35D6, 0xF5D5, 0x32B5, 0x32B5, 0x96DE, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97E6,
+0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x32B5, 0x52BD, 0x96E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB6E6, 0x97E6, 0x98E6,
+0x77DE, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x98E6, 0x77DE, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x36D6,
+0x56DE, 0x97E6, 0x53BD, 0x53BD, 0x76E6, 0x96E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x77DE, 0x97E6, 0x15D6,
+0x15D6, 0x32B5, 0x53BD, 0x53BD, 0x97E6, 0x97E6, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x93C5, 0xD4CD,
+0x53BD, 0x32B5, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0x97E6, 0x98E6, 0x76DE, 0x76DE, 0xB0AC, 0x11B5, 0x73BD, 0x53BD,
+0x76DE, 0x97E6, 0x77E6, 0x97E6, 0xB9E6, 0x97E6, 0x97E6, 0xB8E6, 0x56DE, 0x76DE, 0xCD8B, 0xB0AC, 0x52BD, 0x52BD, 0x97E6, 0x96E6,
+0x77DE, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x35D6, 0x56D6, 0x8C7B, 0x73BD, 0x53BD, 0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0x97DE,
+0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x56DE, 0x56DE, 0x73BD, 0x73BD, 0x73BD, 0x97E6, 0x97DE, 0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0x76E6,
+0x76E6, 0xF5D5, 0x36D6, 0x93C5, 0x93BD, 0x76DE, 0x97E6, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x52BD, 0xF5CD, 0x93BD,
+0x93C5, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0xF1AC, 0x11B5, 0x93C5, 0x93C5, 0xB7E6, 0xB7E6, 0x77E6,
+0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x96DE, 0x0E94, 0x0E94, 0xB4C5, 0x93C5, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6,
+0xB8E6, 0xB8E6, 0xAC83, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB4C5, 0xB4C5,
+0x96E6, 0x97E6, 0x97DE, 0x97DE, 0x98E6, 0x77DE, 0x76E6, 0x96E6, 0xD4CD, 0xB4C5, 0x76DE, 0x76DE, 0x76DE, 0x77E6, 0x77DE, 0x97DE,
+0x97E6, 0x97DE, 0xD4C5, 0xD4C5, 0x77DE, 0x96E6, 0x96DE, 0x98E6, 0x98E6, 0x98DE, 0x56DE, 0x56DE, 0xD4CD, 0xD4CD, 0x97DE, 0x98E6,
+0x97DE, 0xB8E6, 0x76DE, 0x76DE, 0x15D6, 0x35D6, 0x56DE, 0xD5CD, 0xD4CD, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x96DE, 0x76DE,
+0xF5CD, 0x15D6, 0xD5CD, 0xD5CD, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x52BD, 0xB4CD, 0xD5CD, 0xD5CD, 0x76DE, 0x76DE,
+0x98E6, 0x97DE, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0xD5CD, 0xD5CD, 0x98DE, 0x77E6, 0x98E6, 0x78E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD,
+0x97DE, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x77E6, 0x97E6, 0xF5CD,
+0xF5CD, 0x96DE, 0x97E6, 0x77E6, 0x77E6, 0x35D6, 0x56DE, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x97DE, 0x76DE, 0xD0AC, 0xF1B4, 0xF5CD,
+0xF5CD, 0xB8E6, 0x76DE, 0x56DE, 0x77E6, 0xCD83, 0x6FA4, 0xF5CD, 0xF5CD, 0x97E6, 0x97DE, 0x57DE, 0x56DE, 0xF5CD, 0xF5CD, 0x98E6,
+0x97E6, 0x56DE, 0x57DE, 0x57DE, 0x94C5, 0xD5CD, 0x76E6, 0x98E6, 0x35D6, 0x56DE, 0x36D6, 0x56DE, 0x36D6, 0x36D6, 0xF5D5, 0xAD7B,
+0x6F9C, 0x2F94, 0x15D6, 0xF1AC, 0xB0A4, 0x77E6, 0x77E6, 0x77DE, 0xF5CD, 0xF1AC, 0xF1AC, 0xD1AC, 0x77DE, 0x97E6, 0x57DE, 0x15D6,
+0xF1AC, 0xF1AC, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0x77DE, 0x77DE, 0x12B5, 0x11AD, 0x97E6, 0x97E6,
+0x76DE, 0x76DE, 0x8FA4, 0x8FA4, 0x32B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0x98DE, 0x52BD, 0x11B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0x15D6, 0x15D6, 0xF5D5, 0x32B5, 0x32B5, 0x96E6, 0x77DE, 0x77E6, 0x77E6, 0x56DE, 0x36DE, 0x36D6, 0x32B5, 0x32B5,
+0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x76DE, 0x77DE, 0x56DE, 0x32B5, 0x32B5, 0x98E6, 0x76E6, 0xB8E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6,
+0x52BD, 0x32B5, 0x32B5, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0x32B5, 0x52BD, 0x97E6, 0x96E6, 0xB8E6, 0xB8E6, 0x98E6,
+0x96DE, 0x8C7B, 0x32BD, 0x32B5, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x32B5, 0x32B5, 0x97E6, 0x97E6,
+0x76DE, 0x77DE, 0x76DE, 0x97E6, 0x52BD, 0x52BD, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97DE, 0x97DE, 0x15D6, 0xF5D5,
+0xD4CD, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x96DE, 0x96DE, 0x36D6, 0x15D6, 0x32BD, 0x32B5, 0x97E6, 0x97E6,
+0x97DE, 0x77DE, 0x98E6, 0x97DE, 0x77DE, 0x57DE, 0x35DE, 0x32B5, 0x35D6, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE,
+0xB8E6, 0x77DE, 0x77E6, 0x77E6, 0x73C5, 0x35D6, 0x32B5, 0x32B5, 0x32B5, 0xB7E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6,
+0x96E6, 0x94C5, 0x76DE, 0x32BD, 0x32B5, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0xF5CD, 0x56DE, 0x56DE,
+0x32B5, 0x32BD, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xF5CD, 0x77DE, 0x52BD, 0x52BD, 0x77E6, 0xB8E6,
+0x98E6, 0x97E6, 0x77E6, 0x98E6, 0xB7E6, 0xB7E6, 0xF5CD, 0x35D6, 0x35D6, 0x53BD, 0x32B5, 0x32B5, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6,
+0x96E6, 0x96E6, 0x96DE, 0xB7E6, 0x96E6, 0xF5D5, 0x35D6, 0xD5CD, 0xB4C5, 0x53BD, 0x11B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0x97E6,
+0xB8E6, 0x76DE, 0x98E6, 0x97E6, 0x96DE, 0xEE8B, 0xD4CD, 0xD4CD, 0x15D6, 0x15CE, 0xD5CD, 0xF5CD, 0xF5CD, 0x12B5, 0x32B5, 0x98E6,
+0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x96DE, 0x96E6, 0x6FA4, 0x6FA4, 0xF5D5, 0x15D6, 0x15CE, 0x15CE, 0x56DE, 0x56DE,
+0xF1B4, 0xF1B4, 0x77E6, 0x76E6, 0x77E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0xD4CD, 0x72BD, 0x15D6, 0x15D6, 0x15D6,
+0x36D6, 0x36D6, 0x56DE, 0x56DE, 0xF1AC, 0xD1AC, 0xF1AC, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0x76E6, 0x76DE, 0x15D6,
+0xF5D5, 0x55DE, 0x55DE, 0xEE8B, 0x93C5, 0x15D6, 0x36D6, 0x36D6, 0x77DE, 0x77DE, 0xF1AC, 0x11AD, 0xF1AC, 0x77E6, 0x76DE, 0xB8E6,
+0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x15D6, 0xF5D5, 0x56DE, 0x55DE, 0xD5CD, 0x36D6, 0x93C5, 0x97E6, 0x15D6, 0x15D6, 0x15D6,
+0xD5CD, 0x16D6, 0x16D6, 0x96E6, 0x96E6, 0x6F9C, 0x2F94, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xB7DE,
+0x97DE, 0x56DE, 0x56DE, 0xED8B, 0x56DE, 0x76DE, 0xD5CD, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x98E6, 0x96DE, 0x53BD, 0x16D6,
+0x16D6, 0x77E6, 0x97E6, 0xD0AC, 0xD0AC, 0x6F9C, 0xF1AC, 0xF1AC, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0xB8E6, 0xB8E6,
+0x36DE, 0x36D6, 0x35DE, 0x57DE, 0x57DE, 0x56DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6, 0xD8E6, 0xD8E6, 0x76DE, 0x36D6, 0x35DE,
+0x56DE, 0x77E6, 0xD0AC, 0xD0AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB7DE, 0x57DE, 0x36DE,
+0x36DE, 0x52B5, 0x96DE, 0x77DE, 0x76DE, 0x77DE, 0xD4CD, 0xD4CD, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x76DE, 0x56DE, 0x35DE, 0xF5D5,
+0xF5D5, 0x11AD, 0xF1AC, 0x97E6, 0x76E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x56DE, 0x57DE, 0x0E94, 0x0E94,
+0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x36D6, 0x97E6, 0x97E6, 0x14CE, 0x97E6, 0x97DE, 0x98DE, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0xD5CD,
+0x11B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x76DE, 0x76DE, 0x11B5, 0xF1AC, 0x76DE,
+0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x77DE, 0x97E6, 0x56DE, 0x56DE, 0x97E6, 0xB7E6, 0x98E6, 0x77DE, 0x32BD, 0xB4CD, 0x96DE, 0x96DE,
+0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x98E6, 0x77DE, 0x77DE, 0xB4CD, 0x93C5, 0x56DE, 0x76DE, 0x97E6,
+0x98E6, 0x96DE, 0x96DE, 0x77DE, 0x96DE, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0xB0AC, 0xB0AC, 0x77E6, 0xB8E6, 0xD8E6, 0x77E6, 0x97DE,
+0x98E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97E6, 0xF5CD, 0xD4CD, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x56DE,
+0x98E6, 0x97E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x4F9C, 0xB8E6, 0xB8E6, 0x77E6, 0x76DE, 0xD8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97E6,
+0x77E6, 0x55DE, 0x97E6, 0x15D6, 0x15D6, 0x35D6, 0x97E6, 0x35D6, 0x56DE, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C,
+0xB7E6, 0xB8E6, 0x77E6, 0x77E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x56E6, 0x56E6, 0x77DE, 0x77DE, 0x32B5, 0x55D6,
+0x55D6, 0x77DE, 0x57DE, 0x77DE, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0xB7E6, 0xB7E6, 0xB8E6, 0xD9E6, 0x97E6, 0xD8E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x77E6, 0x77DE, 0x97E6, 0x96E6, 0x77DE, 0x15D6, 0x36D6, 0x35D6, 0x76DE, 0x77DE, 0x56DE, 0x77DE, 0xB0A4, 0xB0A4,
+0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x76E6, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0xB8E6, 0x97E6, 0x77E6, 0xB7E6, 0x97E6, 0x15D6,
+0x15D6, 0x15D6, 0x98E6, 0x35D6, 0x56D6, 0x56D6, 0x32BD, 0x12B5, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6,
+0x97DE, 0x98E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x36D6, 0x15D6, 0x97E6, 0x97E6, 0x94C5, 0x15D6, 0xD4CD, 0xB4CD, 0x97DE,
+0x77E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xD9E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x15D6, 0x15D6,
+0x77DE, 0x97E6, 0x8FA4, 0xB0A4, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0x97E6, 0x97DE, 0x76DE, 0x56DE, 0x36D6, 0x36D6, 0x55DE, 0x55DE, 0x4F9C, 0x2F9C, 0x12B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6,
+0x98E6, 0xB7E6, 0x97DE, 0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x96E6, 0xB8E6, 0xB8E6, 0x35D6, 0x8C7B, 0x36D6, 0x36D6,
+0x36D6, 0x15D6, 0xF1B4, 0x11B5, 0x12B5, 0xB7E6, 0x97E6, 0x98E6, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB8EE,
+0xB8EE, 0xB8E6, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x36D6, 0x36D6, 0xF5D5, 0xF5D5, 0x12B5, 0xF1B4, 0x98E6, 0x98E6, 0x98E6, 0x97E6,
+0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0x2E94, 0x2E94, 0xF5CD,
+0xF5D5, 0x11B5, 0x11B5, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x97DE,
+0x97DE, 0x97E6, 0x76DE, 0x76DE, 0x35D6, 0xF5D5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x97DE, 0x97DE, 0x97DE, 0xB8E6,
+0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0x35DE, 0x35DE, 0x35D6, 0xF5D5, 0x52BD, 0x32B5, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97DE,
+0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x96E6, 0x96E6, 0x77E6, 0x97E6, 0x97E6, 0xB8E6,
+0x97DE, 0xB6E6, 0x97E6, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x96E6, 0x98E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x36D6, 0x56DE, 0x53BD, 0x53BD, 0x97E6, 0x76E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x98E6, 0x77E6, 0x77DE, 0xD4CD, 0x15D6, 0x53BD, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x76DE, 0x97E6, 0x98E6, 0x97E6,
+0x76E6, 0xB8E6, 0x93C5, 0x93C5, 0x53BD, 0x53BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE,
+0x76DE, 0xB0AC, 0xB0AC, 0x73BD, 0x73BD, 0x96E6, 0x76DE, 0x98E6, 0x77E6, 0x77DE, 0xB9E6, 0x97E6, 0x97E6, 0x56D6, 0x56DE, 0x8C7B,
+0xCD8B, 0xB0AC, 0x53BD, 0x52BD, 0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x56DE, 0x35D6, 0x8C7B, 0x73BD,
+0x73BD, 0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0x76E6, 0x97DE, 0x36D6, 0x56DE, 0x56DE, 0x93BD, 0x73BD, 0x97E6, 0x97E6,
+0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x76E6, 0xF5D5, 0xF5D5, 0x93C5, 0x93C5, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6,
+0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x11B5, 0x52BD, 0x93C5, 0x93C5, 0xB7E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x76DE, 0x76DE, 0x96DE,
+0x96E6, 0x6FA4, 0xF1AC, 0xB4C5, 0x93C5, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x77E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xAC83, 0x0E94,
+0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB4C5, 0xB4C5, 0x96E6, 0x97E6, 0x97DE,
+0x76E6, 0x77DE, 0x76DE, 0x96E6, 0x96E6, 0xD4CD, 0xB4C5, 0x76DE, 0x97E6, 0x77E6, 0xB8E6, 0x97DE, 0x97DE, 0x97E6, 0x97DE, 0xD4C5,
+0xD4CD, 0x96E6, 0x96DE, 0x98E6, 0x98E6, 0x98E6, 0x98DE, 0x56DE, 0x77DE, 0xD4CD, 0xD4CD, 0x98E6, 0x98E6, 0x97DE, 0xB8E6, 0x76DE,
+0x97E6, 0x35D6, 0x56DE, 0x56DE, 0xD4CD, 0xD4CD, 0x97DE, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x15D6, 0x15D6, 0xD5CD,
+0xD5CD, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x52BD, 0xB4CD, 0xF5CD, 0xD5CD, 0x76DE, 0x76DE, 0x97DE, 0x97DE,
+0x97DE, 0x97E6, 0x97E6, 0x4F9C, 0xF1B4, 0xD5CD, 0xD5CD, 0xF5CD, 0x77E6, 0x77E6, 0x98E6, 0x78E6, 0x97E6, 0x97E6, 0xED8B, 0xF5CD,
+0xF5CD, 0x97DE, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x77E6, 0x77E6, 0xF5CD,
+0xF5CD, 0x96DE, 0x97E6, 0x77E6, 0x77E6, 0xD4CD, 0x35D6, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x77E6, 0x97DE, 0xD0AC, 0xF1B4, 0xF5CD,
+0xF5CD, 0x97E6, 0xB8E6, 0x56DE, 0x77E6, 0xCD83, 0x6FA4, 0xF5CD, 0xF5CD, 0x97E6, 0x97DE, 0x57DE, 0x56DE, 0xD5CD, 0xF5CD, 0x98E6,
+0x97E6, 0x56DE, 0x57DE, 0x57DE, 0x94C5, 0x56DE, 0x76E6, 0x76E6, 0x35D6, 0x35D6, 0x36D6, 0x36D6, 0x36D6, 0xF5D5, 0x6F9C, 0x2F94,
+0x15D6, 0xF1AC, 0xB0A4, 0x77E6, 0x77DE, 0x15D6, 0xF1AC, 0xD1AC, 0xF1AC, 0x97E6, 0x77E6, 0x57DE, 0x15D6, 0xF1AC, 0xF1AC, 0xF1AC,
+0x76DE, 0x76DE, 0x77DE, 0x56DE, 0xF1AC, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0x77DE, 0x77DE, 0x32B5, 0x12B5, 0x11AD, 0x97E6, 0x97E6,
+0x76DE, 0x77DE, 0x8FA4, 0x8FA4, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0xB8E6, 0x98DE, 0x98DE, 0x52BD, 0x11B5, 0x32B5, 0x32B5, 0x97E6,
+0x97E6, 0x98E6, 0x97E6, 0x15D6, 0xF5D5, 0x32B5, 0x32B5, 0x96E6, 0x77DE, 0x77E6, 0x76DE, 0x36DE, 0x36D6, 0x32B5, 0x32B5, 0x97E6,
+0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x56DE, 0x32B5, 0x32B5, 0x76E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x98E6,
+0x98E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x96E6, 0xB8E6, 0x98E6, 0x96DE, 0x97E6, 0x52BD, 0x32BD,
+0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x98E6, 0xB0AC, 0x6FA4, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x97DE,
+0x76DE, 0x97E6, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x98E6, 0x77DE, 0x96DE, 0x97DE, 0x97DE, 0xF5D5, 0xD4CD, 0x93C5,
+0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x96DE, 0x96DE, 0x36D6, 0x15D6, 0x32B5, 0x35D6, 0x32B5, 0x32BD, 0x97E6,
+0x97E6, 0x97DE, 0x77DE, 0x77DE, 0x97DE, 0x77DE, 0x77DE, 0x57DE, 0x73C5, 0x77DE, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x77E6, 0x94C5, 0x76DE, 0x32B5, 0x32B5, 0x97E6, 0xB7E6, 0xB8E6, 0x96DE, 0x98E6, 0x77DE, 0x76DE,
+0x97E6, 0x96E6, 0xF5D5, 0x56DE, 0x32BD, 0x32BD, 0xB7E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0xF5CD,
+0x77DE, 0x52BD, 0x32BD, 0xB8E6, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0xD4D5, 0x35D6, 0x32B5, 0x32B5,
+0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x77E6, 0x96E6, 0xB7E6, 0xF5D5, 0x35D6, 0xB4C5, 0x53BD, 0x32B5, 0x32B5, 0x98E6,
+0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96E6, 0x96DE, 0xB7E6, 0xD4CD, 0x15D6, 0x15CE, 0xD5CD, 0xD5CD, 0xF5CD, 0x52BD, 0x32B5,
+0x11B5, 0x77E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x96E6, 0x97E6, 0x2F94, 0x2F94, 0xF5D5, 0x15D6, 0x16D6, 0x15CE,
+0xF5CD, 0x56DE, 0x36D6, 0xF1B4, 0xF1AC, 0x76E6, 0x77E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97DE, 0x97DE, 0x96E6, 0x96E6, 0x72BD, 0x32BD,
+0x15D6, 0x15D6, 0x36D6, 0x36D6, 0x16D6, 0x56DE, 0x56DE, 0xD1AC, 0xF1AC, 0x98E6, 0x77E6, 0x76E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE,
+0x76DE, 0x97E6, 0xF5D5, 0xD4CD, 0x55DE, 0x55DE, 0xEE8B, 0x32B5, 0x93C5, 0x36D6, 0x36D6, 0x36D6, 0x77DE, 0x56DE, 0x11AD, 0xF1AC,
+0x77E6, 0x76DE, 0x98E6, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6, 0xF5D5, 0x15D6, 0x56DE, 0x55DE, 0xD5CD, 0x36D6, 0x93C5,
+0x97E6, 0x15D6, 0x98E6, 0x15D6, 0xD5CD, 0x16D6, 0x16D6, 0x36D6, 0x96E6, 0x97E6, 0x2F94, 0xF1AC, 0xF1AC, 0x11AD, 0x97E6, 0x98E6,
+0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x56DE, 0x56DE, 0x15D6, 0xED8B, 0x56DE, 0x76DE, 0xD5CD, 0xF5CD, 0x97E6, 0xB7E6,
+0xB7E6, 0xB8E6, 0x98E6, 0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0xD0AC, 0x6F9C, 0xF1AC, 0xF1AC, 0xF1AC, 0x98E6, 0x98E6,
+0xB8E6, 0xB7E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x36D6, 0x35DE, 0x56DE, 0x36D6, 0x57DE, 0x56DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6,
+0x98E6, 0xD8E6, 0xD8E6, 0x98E6, 0x36D6, 0x36D6, 0x56DE, 0x77E6, 0xD0AC, 0xD0AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x77DE,
+0x98E6, 0xB8E6, 0xB8E6, 0xB7DE, 0xB8E6, 0x36DE, 0x36DE, 0x36D6, 0x52B5, 0x96DE, 0x77DE, 0x76DE, 0x77DE, 0x97E6, 0xD4CD, 0x97E6,
+0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x56DE, 0x35DE, 0xF5D5, 0xF5D5, 0x11AD, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0xB7E6, 0xB7E6, 0x77E6,
+0x98E6, 0xB8E6, 0x97E6, 0x56DE, 0x57DE, 0x36DE, 0x56DE, 0x97E6, 0xB8E6, 0x97E6, 0x36D6, 0x97E6, 0x97E6, 0x14CE, 0x97E6, 0x97DE,
+0x98DE, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0xD5CD, 0x11B5, 0x32B5, 0x11AD, 0x98E6, 0x98E6, 0xB7E6, 0x77E6, 0x76DE, 0xB8E6, 0x97DE,
+0x97E6, 0x76DE, 0x77E6, 0x77E6, 0xF1AC, 0xB0A4, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x77DE, 0x97E6, 0x75DE, 0x56DE, 0x97E6,
+0xB7E6, 0x98E6, 0x77DE, 0x32BD, 0xB4CD, 0x96DE, 0x96DE, 0xD4CD, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6,
+0x97E6, 0x77DE, 0x77DE, 0x93C5, 0x11B5, 0x56DE, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x96DE, 0x77DE, 0x96DE, 0xB8E6, 0x98E6, 0xB7E6,
+0x97E6, 0xB0AC, 0xB0AC, 0x6FA4, 0xB8E6, 0x98E6, 0x77E6, 0x97DE, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6,
+0x77DE, 0xD4CD, 0xB4CD, 0x73BD, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x56DE, 0x98E6, 0x97E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x4F9C,
+0x6F9C, 0xB8E6, 0x77E6, 0x76DE, 0xD8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x15D6, 0x15D6,
+0x35D6, 0x97E6, 0x35D6, 0x56DE, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0x77E6, 0x77E6, 0xB7E6,
+0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x36DE, 0x32B5, 0x55D6, 0x55D6, 0x77DE, 0x57DE, 0x77DE,
+0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB7E6, 0xB8E6, 0xD9E6, 0x97E6, 0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE,
+0xB8E6, 0x96E6, 0x77DE, 0x15D6, 0x36D6, 0x35D6, 0x76DE, 0x36D6, 0x56DE, 0xD0AC, 0xB0A4, 0xB0A4, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6,
+0x98E6, 0x76E6, 0x97E6, 0x77DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x77E6, 0xB7E6, 0x97E6, 0x15D6, 0x15D6, 0x97E6, 0x98E6, 0x36D6,
+0x56D6, 0x56D6, 0x32BD, 0x12B5, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x98E6, 0x76DE, 0x97E6,
+0xB8E6, 0xB8E6, 0x97E6, 0x16D6, 0x36D6, 0x76DE, 0x76DE, 0xB0A4, 0x94C5, 0x15D6, 0xD4CD, 0xB4CD, 0x97DE, 0x77E6, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xD9E6, 0x97DE, 0x97E6, 0x77E6, 0x97E6, 0x97E6, 0x36D6, 0x36D6, 0x55DE, 0x77DE, 0x2F9C,
+0x8FA4, 0xB0A4, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6,
+0x97DE, 0x76DE, 0x56DE, 0x36D6, 0x36D6, 0x15D6, 0x55DE, 0x2E94, 0x4F9C, 0x2F9C, 0x12B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0x98E6,
+0x97E6, 0x97DE, 0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x96E6, 0xB8E6, 0x97DE, 0x8C7B, 0x8C7B, 0x36D6, 0x36D6, 0x15D6,
+0x36D6, 0xF1B4, 0x11B5, 0xB7E6, 0xB7E6, 0xB9E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB8EE, 0xB8E6,
+0xB8E6, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0xD5CD, 0x36D6, 0xF5D5, 0xF5D5, 0x32B5, 0x12B5, 0x76E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6,
+0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0x2E94, 0xF5CD, 0xF5D5,
+0x12B5, 0x11B5, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x77DE,
+0x97DE, 0x97E6, 0x76DE, 0x76DE, 0x35D6, 0xF5D5, 0x32B5, 0x32B5, 0x96DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x97DE,
+0xB8E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0x35DE, 0x77DE, 0x35D6, 0xF5D5, 0x32B5, 0x52BD, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x98E6,
+0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x77DE, 0x96E6, 0x77E6, 0x77E6, 0x97E6, 0x97E6,
+0xB8E6, 0x98DE, 0xB6E6, 0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x53BD, 0x32B5, 0x76E6, 0x96E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6,
+0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x15D6, 0x36D6, 0x56DE, 0x32B5, 0x53BD, 0x97E6, 0x97E6, 0x76E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0xD4CD, 0xD4CD, 0x15D6, 0x53BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x76DE,
+0x97E6, 0x98E6, 0x76DE, 0x76E6, 0x11B5, 0x93C5, 0xD4CD, 0x73BD, 0x53BD, 0x76DE, 0x97E6, 0x97E6, 0x77E6, 0x97E6, 0xB9E6, 0x97E6,
+0xB8E6, 0xB8E6, 0x76DE, 0x76DE, 0xB0AC, 0xB0AC, 0xB0AC, 0x52BD, 0x52BD, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x98E6, 0xB8E6, 0x77DE,
+0x97E6, 0x97E6, 0x56D6, 0x56D6, 0x8C7B, 0xCD8B, 0x73BD, 0x73BD, 0x97DE, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE,
+0x97DE, 0x56DE, 0x56DE, 0x93BD, 0x73BD, 0x73BD, 0x97E6, 0x97DE, 0x76DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x76E6, 0xF5D5, 0x36D6,
+0x56DE, 0x93C5, 0x93C5, 0x93BD, 0x76DE, 0x97E6, 0x76DE, 0x76DE, 0x97DE, 0xB8E6, 0x97E6, 0xB7E6, 0x52BD, 0xF5CD, 0xF5D5, 0x93C5,
+0x93BD, 0x93C5, 0x77E6, 0x97E6, 0xB8E6, 0x77DE, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0xF1AC, 0x11B5, 0x11B5, 0x93C5, 0x93C5, 0x93C5,
+0x76E6, 0xB7E6, 0x77E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x98E6, 0xAC83, 0x0E94, 0x6FA4, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6,
+0xB8E6, 0x97E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0xAC83, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x76E6, 0x76E6, 0x77DE, 0x76DE,
+0x96E6, 0x97E6, 0x97E6, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x97DE, 0x98E6, 0x97DE, 0x76E6, 0x96E6, 0xD4CD, 0xD4CD,
+0x96E6, 0x96DE, 0x98E6, 0x76DE, 0x98DE, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0xD4CD, 0xD4CD, 0x98E6, 0x77DE, 0xB8E6, 0x96DE, 0x97E6,
+0x98E6, 0x35D6, 0x56DE, 0x56DE, 0xD4CD, 0xD4CD, 0x97E6, 0x97DE, 0x98E6, 0x97DE, 0x96DE, 0x76DE, 0xF5CD, 0x15D6, 0x35D6, 0xD5CD,
+0xD5CD, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x52BD, 0xB4CD, 0xF5CD, 0xD5CD, 0xD5CD, 0x76DE, 0x76DE, 0x98E6, 0x97DE,
+0x97E6, 0x97E6, 0x97E6, 0xF1B4, 0x52BD, 0xD5CD, 0xD5CD, 0x98DE, 0x77E6, 0x98E6, 0x78E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0xF5CD,
+0xF5CD, 0x97DE, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x56DE, 0x77E6,
+0x97E6, 0xF5CD, 0xF5CD, 0x97E6, 0x96DE, 0x76DE, 0x77E6, 0xD4CD, 0x35D6, 0x56DE, 0xF5CD, 0xF5CD, 0x76DE, 0x97E6, 0x77E6, 0x97DE,
+0x76DE, 0xF1B4, 0xD4CD, 0xF5CD, 0xF5CD, 0x97E6, 0xB8E6, 0x56DE, 0x77E6, 0x77E6, 0xCD83, 0x6FA4, 0xF5CD, 0xF5CD, 0x97E6, 0x97DE,
+0x57DE, 0x57DE, 0x56DE, 0xD5CD, 0xF5CD, 0x76E6, 0x98E6, 0x35D6, 0x56DE, 0x57DE, 0x36D6, 0x56DE, 0x36D6, 0x35D6, 0x35D6, 0x36D6,
+0x36D6, 0x36D6, 0x2F94, 0xAD7B, 0xB0A4, 0x6F9C, 0x2F94, 0x77DE, 0x15D6, 0xF1AC, 0xD1AC, 0xF1AC, 0x97E6, 0x77E6, 0x15D6, 0xF5CD,
+0xF1AC, 0xF1AC, 0xF1AC, 0x76DE, 0x77DE, 0x56DE, 0x57DE, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x12B5, 0x11AD,
+0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x8FA4, 0x32B5, 0x32B5, 0x97E6, 0x98E6, 0xB8E6, 0x98DE, 0x76DE, 0x11B5, 0x8FA4, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF5D5, 0xF5D5, 0x32B5, 0x32B5, 0x96E6, 0x77DE, 0x97E6, 0x76DE, 0x76DE, 0x36DE,
+0x36D6, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x56DE, 0x32B5, 0x32B5, 0x98E6, 0x76E6, 0x97DE, 0x98E6,
+0x76DE, 0x97E6, 0x97E6, 0x52BD, 0x32B5, 0x96E6, 0x98E6, 0x97DE, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0xB8E6, 0x97E6,
+0x96E6, 0xB8E6, 0x97DE, 0x98E6, 0x96DE, 0x8C7B, 0x52BD, 0x32BD, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0xB0AC,
+0x6FA4, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x76DE, 0x97E6, 0x52BD, 0x32BD, 0x93C5, 0x32B5, 0x32B5, 0x97E6,
+0xB8E6, 0x98E6, 0x77DE, 0x96DE, 0x97DE, 0x97DE, 0xF5D5, 0xF5D5, 0x73C5, 0x35D6, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x98E6, 0x97E6,
+0x77DE, 0x77DE, 0x96DE, 0x35DE, 0x36D6, 0x73C5, 0x77DE, 0x32B5, 0x32BD, 0x97E6, 0x97E6, 0x97DE, 0x97DE, 0xB8E6, 0x77DE, 0x97DE,
+0x77DE, 0x57DE, 0xF5CD, 0x76DE, 0x32B5, 0x32B5, 0x32B5, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x97E6, 0x77E6,
+0xF5D5, 0x56DE, 0x32BD, 0x32BD, 0x32B5, 0xB7E6, 0x97E6, 0xB8E6, 0x96DE, 0x96E6, 0x77DE, 0x76DE, 0x97E6, 0x97E6, 0xF5CD, 0x77DE,
+0x32BD, 0x32B5, 0x32BD, 0xB7E6, 0x97E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xD4D5, 0x35D6, 0x32B5, 0x52BD,
+0x32BD, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0x77E6, 0x98E6, 0xB7E6, 0xB8E6, 0x97E6, 0xF5D5, 0xF5D5, 0x15D6, 0x53BD, 0x32B5, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0xB7E6, 0x96E6, 0xB7E6, 0xD4CD, 0x15D6, 0xD5CD, 0xD5CD, 0xF5CD, 0x52BD,
+0x11B5, 0x32B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x97E6, 0x96DE, 0xB7E6, 0xEE8B, 0xF5D5, 0xF5D5, 0x56DE,
+0x15CE, 0xF5CD, 0x56DE, 0x36D6, 0xF5CD, 0xF1AC, 0x12B5, 0x77E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x96E6, 0x96DE,
+0x96E6, 0x6FA4, 0x2F94, 0x15D6, 0x15D6, 0x36D6, 0x16D6, 0x56DE, 0x56DE, 0x56DE, 0xF1AC, 0xF1B4, 0x77E6, 0x76E6, 0x77E6, 0xB8E6,
+0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x96E6, 0x72BD, 0x32BD, 0x55DE, 0x77DE, 0x55DE, 0x32B5, 0x36D6, 0x36D6, 0x77DE, 0x56DE,
+0x56DE, 0xF1AC, 0xD1AC, 0x76DE, 0x98E6, 0x77E6, 0x98E6, 0xB8E6, 0x97DE, 0x98E6, 0x76E6, 0x76DE, 0x15D6, 0xF5D5, 0xD4CD, 0x56DE,
+0x55DE, 0x32B5, 0x36D6, 0x93C5, 0x97E6, 0x97E6, 0x98E6, 0x15D6, 0xD5CD, 0x16D6, 0x16D6, 0x96E6, 0x97E6, 0x2F94, 0xF1AC, 0x11AD,
+0x97E6, 0x98E6, 0x77E6, 0x77DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x15D6, 0x15D6, 0xF5D5, 0xED8B, 0x56DE, 0x56DE, 0x76DE,
+0xF5CD, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x98E6, 0xD5CD, 0x53BD, 0x53BD, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0xD0AC, 0x6F9C, 0x2F94,
+0xF1AC, 0xF1AC, 0x98E6, 0x98E6, 0x97E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xB7DE, 0xB7DE, 0x35DE, 0x56DE, 0x56DE, 0x52B5, 0x36D6,
+0x57DE, 0x56DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0xD8E6, 0x98E6, 0x36D6, 0x36D6, 0x56DE, 0x77E6, 0xD0AC, 0xD0AC,
+0xD0AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0x77E6, 0x77E6, 0xB8E6, 0xB8E6, 0x36DE, 0x36D6, 0x35DE, 0x52B5,
+0x96DE, 0x77DE, 0x76DE, 0x76DE, 0x97E6, 0xD4CD, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x56DE, 0x35DE, 0x36DE, 0xF5D5, 0x52BD,
+0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xB7DE, 0x57DE, 0x36DE, 0x36DE, 0x56DE, 0x56DE,
+0xB8E6, 0x97E6, 0x36D6, 0x97E6, 0x97E6, 0x14CE, 0x97E6, 0x97DE, 0x98DE, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0x32B5, 0x11AD,
+0x98E6, 0x98E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x77E6, 0x56DE, 0x56DE, 0xB0A4, 0x0E94, 0x76DE, 0x97E6,
+0x98E6, 0xB8E6, 0xB8E6, 0x77DE, 0x97E6, 0x75DE, 0x56DE, 0x97E6, 0xB7E6, 0x98E6, 0x77DE, 0x56DE, 0xB4CD, 0xD5CD, 0xD4CD, 0xD4CD,
+0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0xB7E6, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0x93C5, 0x11B5, 0xF1AC, 0x56DE, 0x98E6,
+0x97E6, 0x97E6, 0x97E6, 0x96DE, 0x77DE, 0x96DE, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0xB0AC, 0xB0AC, 0x6FA4, 0xB8E6, 0x98E6, 0x77E6,
+0x97DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0x77DE, 0xD4CD, 0xB4CD, 0x93C5, 0x73BD, 0x97E6, 0x98E6,
+0x97E6, 0x77DE, 0x56DE, 0x98E6, 0x97E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x4F9C, 0x6F9C, 0xB8E6, 0x77E6, 0x76DE, 0xD8E6, 0xB8E6, 0x77E6,
+0x77E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x15D6, 0xF5CD, 0xD4CD, 0x32B5, 0x35D6, 0x97E6, 0x35D6, 0x56DE, 0x97DE,
+0x97DE, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0x77E6, 0x77E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB7E6, 0x97E6,
+0x97E6, 0x77DE, 0x55DE, 0x77DE, 0x36DE, 0x15D6, 0x56DE, 0x56DE, 0x55D6, 0x77DE, 0x57DE, 0x77DE, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C,
+0xB7E6, 0xB7E6, 0xB8E6, 0xD9E6, 0x97E6, 0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0xB8E6, 0x96E6, 0x77DE, 0x77DE,
+0x15D6, 0x15D6, 0x36D6, 0x35D6, 0x76DE, 0x36D6, 0x56DE, 0xD0AC, 0xB0A4, 0xB0A4, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x76E6,
+0x97E6, 0x77DE, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x77E6, 0xB7E6, 0x97E6, 0x96E6, 0x36D6, 0x15D6, 0x15D6, 0x97E6, 0x98E6, 0x36D6,
+0x36D6, 0xB4CD, 0x32BD, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x98E6, 0x76DE, 0x97E6,
+0xB8E6, 0xB8E6, 0x97E6, 0x15D6, 0x16D6, 0x36D6, 0x76DE, 0x76DE, 0xB0A4, 0x94C5, 0xD4CD, 0x98E6, 0x97DE, 0x77E6, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xD9E6, 0x97DE, 0x97E6, 0x77E6, 0x97E6, 0x97E6, 0x36D6, 0x36D6, 0x36D6, 0x55DE, 0x77DE,
+0x2F9C, 0x8FA4, 0xF5D5, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x97E6, 0x97DE, 0x76DE, 0x56DE, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x55DE, 0x2E94, 0x4F9C, 0x11B5, 0x12B5, 0x32B5, 0x97E6, 0x98E6,
+0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x96E6, 0xB8E6, 0x97DE, 0x76DE, 0x36D6, 0x36D6,
+0xF5D5, 0x15D6, 0x36D6, 0x12B5, 0xF1B4, 0x11B5, 0xB7E6, 0xB7E6, 0xB9E6, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6,
+0xB8E6, 0xB8EE, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x56DE, 0x35D6, 0xD5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x11B5, 0x32B5, 0x12B5, 0x76E6,
+0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6,
+0x76DE, 0x2E94, 0xF5CD, 0x32B5, 0x12B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6,
+0x97E6, 0x97E6, 0xB7E6, 0x77DE, 0x97DE, 0x56DE, 0x76DE, 0x76DE, 0xF5D5, 0xD5CD, 0x32B5, 0x32B5, 0x97DE, 0x96DE, 0x97E6, 0x98E6,
+0xB8E6, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0x35DE, 0x35D6, 0x56DE, 0xF5D5, 0x32B5, 0x32B5,
+0x96E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0x97DE, 0xB6E6, 0x97E6, 0x77DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5,
+0x98E6, 0x77DE, 0x96E6, 0x77E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x98DE, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x53BD, 0x53BD,
+0x76E6, 0x96E6, 0x96E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x15D6, 0x36D6, 0x32B5, 0x32B5,
+0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x76E6, 0xB8E6, 0x77E6, 0xD4CD, 0xD4CD, 0x53BD, 0x53BD,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x76E6, 0x11B5, 0x93C5, 0x52BD, 0x73BD,
+0x96E6, 0x76DE, 0x98E6, 0x77E6, 0x97E6, 0x77DE, 0xB9E6, 0x97E6, 0xB8E6, 0x56DE, 0x76DE, 0x76DE, 0xB0AC, 0xB0AC, 0x53BD, 0x52BD,
+0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x35D6, 0x56D6, 0x8C7B, 0x73BD, 0x73BD, 0x97E6, 0x97DE,
+0x76DE, 0xB8E6, 0x77DE, 0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0x56DE, 0x56DE, 0x93C5, 0x93BD, 0x76DE, 0x97E6, 0x76DE, 0x76DE, 0x76DE,
+0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xF5CD, 0xF5D5, 0x93BD, 0x93C5, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x98E6, 0x97DE, 0x97E6,
+0x97E6, 0x11B5, 0x52BD, 0x93C5, 0x93C5, 0xB7E6, 0x77E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x76DE, 0x96DE, 0x96E6, 0x6FA4, 0xF1AC,
+0xB4C5, 0x93C5, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xAC83, 0xAC83, 0xB4C5, 0xB4C5, 0xB4C5,
+0x97E6, 0x97E6, 0x76E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xD4CD, 0xB4C5, 0xB4C5, 0x97E6, 0x96E6, 0xB8E6, 0x97DE,
+0x98E6, 0x77DE, 0x77DE, 0x76E6, 0x96E6, 0xD4C5, 0xD4CD, 0xD4CD, 0x96DE, 0x76DE, 0x76DE, 0x76DE, 0x98DE, 0x77DE, 0x97DE, 0x97E6,
+0x97DE, 0xD4CD, 0xD4CD, 0xD4C5, 0x77DE, 0x77DE, 0xB8E6, 0x96DE, 0x97E6, 0x98E6, 0x56DE, 0x56DE, 0x77DE, 0xD4CD, 0xD4CD, 0xD4CD,
+0x97E6, 0x97DE, 0x98E6, 0x97DE, 0x76DE, 0x76DE, 0x15D6, 0x35D6, 0x56DE, 0xD5CD, 0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97E6, 0x97E6,
+0x98E6, 0x96DE, 0x52BD, 0xB4CD, 0xF5CD, 0xF5CD, 0xD5CD, 0x76DE, 0x76DE, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x4F9C, 0xF1B4,
+0x52BD, 0xD5CD, 0xD5CD, 0x98DE, 0x77E6, 0x76DE, 0x98E6, 0x78E6, 0x97E6, 0x97E6, 0xED8B, 0x4F9C, 0xF5CD, 0xF5CD, 0x76DE, 0x97DE,
+0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x77E6, 0x97E6, 0xF5CD, 0xF5CD,
+0x97E6, 0x96DE, 0x97E6, 0x77E6, 0x77E6, 0x35D6, 0x35D6, 0xF5CD, 0xF5CD, 0x76DE, 0x97E6, 0x77E6, 0x77E6, 0x97DE, 0xD0AC, 0xF1B4,
+0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x56DE, 0x56DE, 0x77E6, 0xCD83, 0x6FA4, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x57DE, 0x57DE, 0x56DE,
+0x94C5, 0xD5CD, 0x76E6, 0x98E6, 0x35D6, 0x56DE, 0x57DE, 0x36D6, 0x56DE, 0x36D6, 0x35D6, 0x35D6, 0xF5D5, 0x36D6, 0xAD7B, 0xB0A4,
+0x6F9C, 0x2F94, 0x15D6, 0xD1AC, 0xF1AC, 0xB0A4, 0x77E6, 0x77DE, 0x15D6, 0xF5CD, 0xF1AC, 0xF1AC, 0xD1AC, 0x76DE, 0x77DE, 0x56DE,
+0x57DE, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x12B5, 0x11AD, 0x97E6, 0x97E6, 0x76E6, 0x77DE, 0x77DE, 0x32B5,
+0x32B5, 0x98E6, 0xB8E6, 0x98DE, 0x76DE, 0x76DE, 0x11B5, 0x8FA4, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xF5D5,
+0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x96E6, 0x77DE, 0x77E6, 0x76DE, 0x98E6, 0x36D6, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6,
+0x97E6, 0x76DE, 0x77DE, 0x56DE, 0x36DE, 0x32B5, 0x32B5, 0x32B5, 0x76E6, 0xB8E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x52BD,
+0x32B5, 0x96E6, 0x98E6, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x32B5, 0x32B5, 0xB8E6, 0xB8E6, 0x97E6, 0x96E6, 0xB8E6, 0x98E6,
+0x96DE, 0x8C7B, 0x32B5, 0x52BD, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x6FA4, 0x32B5, 0x93C5,
+0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x76DE, 0x76DE, 0xD4CD, 0x52BD, 0x73C5, 0x35D6, 0x32B5, 0x32B5, 0x32B5,
+0x97E6, 0xB8E6, 0x98E6, 0x77DE, 0x77DE, 0x96DE, 0x97DE, 0x15D6, 0xF5D5, 0x73C5, 0x94C5, 0x77DE, 0x32BD, 0x32B5, 0x32B5, 0x97E6,
+0x97E6, 0x77DE, 0x98E6, 0x97DE, 0x77DE, 0x96DE, 0x35DE, 0x36D6, 0xF5CD, 0x76DE, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6,
+0x97DE, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x57DE, 0xF5D5, 0x56DE, 0x77DE, 0x32B5, 0x32B5, 0x97E6, 0xB7E6, 0xB8E6, 0x98E6, 0x97E6,
+0x76DE, 0x98E6, 0x96E6, 0x96E6, 0x97E6, 0xF5CD, 0x77DE, 0x32BD, 0x32BD, 0x97E6, 0xB7E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0x96E6,
+0x97E6, 0x97E6, 0x97E6, 0xD4D5, 0x35D6, 0x35D6, 0x32BD, 0x32B5, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0xF5D5, 0x15D6, 0x32B5, 0x52BD, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0x77E6, 0x98E6, 0xB7E6, 0xB8E6, 0xD4CD,
+0x15D6, 0xD5CD, 0xB4C5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0xB7E6, 0x96E6,
+0xF5D5, 0x56DE, 0xF5CD, 0x15CE, 0x36D6, 0xF5CD, 0x52BD, 0x12B5, 0x32B5, 0x11B5, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x76DE,
+0x76DE, 0x96E6, 0x97E6, 0x2F94, 0xEE8B, 0x15D6, 0x15D6, 0x16D6, 0x15CE, 0x56DE, 0x56DE, 0xF1B4, 0xF1AC, 0x76E6, 0x77E6, 0x98E6,
+0xB8E6, 0xB8E6, 0x98E6, 0x97DE, 0x97DE, 0x96E6, 0x96DE, 0x32BD, 0x6FA4, 0x77DE, 0x55DE, 0x32B5, 0x36D6, 0x36D6, 0x77DE, 0x56DE,
+0xD1AC, 0xF1AC, 0x98E6, 0x77E6, 0x77E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x76DE, 0x97E6, 0x97E6, 0xD4CD, 0x72BD, 0x56DE, 0x55DE,
+0x32B5, 0x36D6, 0x36D6, 0x98E6, 0x97E6, 0x98E6, 0x15D6, 0x16D6, 0x16D6, 0x36D6, 0x97E6, 0x77DE, 0x11AD, 0xF1AC, 0x98E6, 0x77E6,
+0x76DE, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6, 0x76DE, 0xF5D5, 0x15D6, 0xED8B, 0x57DE, 0x56DE, 0x76DE, 0xF5CD, 0x97E6,
+0xB7E6, 0xB7E6, 0xB8E6, 0x98E6, 0xD5CD, 0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x16D6, 0x97E6, 0x96E6, 0x6F9C, 0x2F94, 0xF1AC, 0xF1AC,
+0x98E6, 0x97E6, 0xB7E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97DE, 0x97DE, 0x98E6, 0x56DE, 0x15D6, 0x52B5, 0x36D6, 0x57DE, 0x56DE,
+0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0xD8E6, 0x98E6, 0x36D6, 0x36D6, 0x56DE, 0x77E6, 0x97E6, 0xD0AC, 0xD0AC, 0xF1AC,
+0xF1AC, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0xB7E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x36D6, 0x35DE, 0x56DE, 0x97E6, 0x96DE, 0x77DE,
+0x98E6, 0x76DE, 0x97E6, 0xD4CD, 0xB8E6, 0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x56DE, 0x35DE, 0x35DE, 0xF5D5, 0x52BD, 0xF1AC, 0xF1AC,
+0xF1AC, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x77DE, 0x97E6, 0xB8E6, 0xB7DE, 0xB8E6, 0x36DE, 0x36DE, 0x36D6, 0xF5CD, 0xF5CD, 0x56DE,
+0xB8E6, 0x97E6, 0x36D6, 0x97E6, 0x97E6, 0x14CE, 0x97E6, 0x97DE, 0x98DE, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0x32B5, 0x11AD,
+0xF1AC, 0x98E6, 0x97E6, 0x77E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x56DE, 0x57DE, 0xB0A4, 0x0E94, 0x76DE, 0x97E6,
+0x98E6, 0xB8E6, 0xB8E6, 0x77DE, 0x77DE, 0x75DE, 0x56DE, 0x97E6, 0xB7E6, 0x98E6, 0x77DE, 0x56DE, 0xB4CD, 0xD5CD, 0xD4CD, 0xD4CD,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97DE, 0x77DE, 0x76DE, 0x11B5, 0xF1AC, 0xB0A4, 0x56DE,
+0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x96DE, 0x77DE, 0x96DE, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0xB8E6, 0x98E6,
+0x77E6, 0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x77DE, 0xB4CD, 0x93C5, 0x11B5, 0x73BD,
+0x97E6, 0x98E6, 0x56DE, 0x77DE, 0x56DE, 0x98E6, 0x97E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x4F9C, 0x6F9C, 0xB8E6, 0x77E6, 0x76DE, 0xD8E6,
+0x77E6, 0x77E6, 0x77E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97E6, 0xF5CD, 0xD4CD, 0x32B5, 0x35D6, 0x56D6, 0x35D6,
+0x56DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0x77E6, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB7E6,
+0xB7E6, 0x97E6, 0x97E6, 0x77E6, 0x55DE, 0x97E6, 0x15D6, 0x15D6, 0x56DE, 0x56DE, 0x76DE, 0x77DE, 0x57DE, 0x77DE, 0x97E6, 0x4F9C,
+0x4F9C, 0x4F9C, 0xB7E6, 0xB7E6, 0xB8E6, 0xD9E6, 0x97E6, 0xD8E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x56E6,
+0x77DE, 0x77DE, 0x15D6, 0x15D6, 0x98E6, 0x35D6, 0x76DE, 0x36D6, 0x56DE, 0xD0AC, 0xB0A4, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6,
+0x98E6, 0x76E6, 0x97E6, 0x77DE, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x77E6, 0x77DE, 0x97E6, 0x96E6, 0x36D6, 0x15D6, 0x97E6, 0x97E6,
+0x98E6, 0x36D6, 0x36D6, 0xB4CD, 0x32BD, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x98E6,
+0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x15D6, 0x16D6, 0x97E6, 0x76DE, 0x8FA4, 0xB0A4, 0x94C5, 0xD4CD, 0x98E6, 0x97DE,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xD9E6, 0x97DE, 0x97E6, 0x77E6, 0x97E6, 0x96DE, 0x96DE, 0x36D6,
+0x36D6, 0x36D6, 0x55DE, 0x55DE, 0x4F9C, 0x2F9C, 0x8FA4, 0xF5D5, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x96DE, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD8E6, 0x97E6, 0x97DE, 0x97E6, 0x56DE, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x2E94, 0x11B5,
+0x12B5, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x96E6, 0xB8E6,
+0x97DE, 0x76DE, 0xD5CD, 0x36D6, 0x36D6, 0xF5D5, 0x15D6, 0x12B5, 0xF1B4, 0x98E6, 0xB7E6, 0x97E6, 0xB9E6, 0x98E6, 0x98E6, 0x98E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB8EE, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x56DE, 0x35D6, 0xF5CD, 0xF5D5, 0xF5D5, 0x11B5,
+0x32B5, 0x97E6, 0x76E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x97E6, 0x96E6, 0x97E6,
+0x97E6, 0x76DE, 0x97E6, 0x76DE, 0x2E94, 0x32B5, 0x32B5, 0x12B5, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6,
+0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB7E6, 0x77DE, 0x97DE, 0x56DE, 0x76DE, 0x76DE, 0xF5D5, 0xD5CD, 0x52BD, 0x32B5, 0x32B5,
+0x97DE, 0x96DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x35DE, 0x35D6,
+0x56DE, 0xF5D5, 0xF5D5, 0x32B5, 0x32B5, 0x77DE, 0x96E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB6E6, 0x97E6, 0x77DE,
+0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x32B5, 0x96E6, 0x98E6, 0x77DE, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0x77E6, 0x97E6, 0x98DE,
+0x97E6, 0x98E6, 0x56DE, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x97E6, 0x76E6, 0x96E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6,
+0x77E6, 0x77DE, 0x97E6, 0x15D6, 0x36D6, 0x53BD, 0x32B5, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x76DE, 0x97E6, 0x98E6, 0x97E6,
+0x76E6, 0xB8E6, 0xB8E6, 0x93C5, 0xD4CD, 0x73BD, 0x53BD, 0x76DE, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0x76DE, 0x76DE, 0x76DE, 0xB0AC, 0x11B5, 0x53BD, 0x52BD, 0x52BD, 0x97E6, 0x96E6, 0x77DE, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x97E6,
+0x97E6, 0x56D6, 0x56DE, 0x76DE, 0xCD8B, 0xB0AC, 0x73BD, 0x73BD, 0x53BD, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6,
+0x97DE, 0xB8E6, 0x56DE, 0x35D6, 0x8C7B, 0x93BD, 0x73BD, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0x76E6,
+0x97DE, 0x36D6, 0x56DE, 0x93C5, 0x93C5, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x76DE, 0x97DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB7E6, 0x52BD,
+0xF5CD, 0x93C5, 0x93C5, 0xB7E6, 0x77E6, 0x97E6, 0xB8E6, 0x77DE, 0x76DE, 0x98E6, 0x96E6, 0x96E6, 0x97E6, 0xF1AC, 0x11B5, 0xB4C5,
+0x93C5, 0x97E6, 0x76E6, 0x97E6, 0x77E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xAC83, 0x0E94, 0x6FA4, 0xB4C5, 0xB4C5, 0x97E6,
+0x97E6, 0x77DE, 0x77DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xAC83, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x96E6, 0xB8E6, 0x97DE,
+0x98E6, 0x77DE, 0x76DE, 0x96E6, 0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0x96DE, 0x76DE, 0x76DE, 0x77E6, 0x77DE, 0x97DE, 0x98E6, 0x97DE,
+0x76E6, 0xD4CD, 0xD4CD, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x98E6, 0x98E6, 0x98DE, 0x98DE, 0x56DE, 0x77DE, 0xD4CD, 0xD4CD, 0x97E6,
+0x97DE, 0x98E6, 0x97DE, 0xB8E6, 0x76DE, 0x76DE, 0x15D6, 0x35D6, 0x56DE, 0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6,
+0x98E6, 0x96DE, 0xB4CD, 0xF5CD, 0x15D6, 0xD5CD, 0xD5CD, 0x76DE, 0x76DE, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0xF1B4, 0x52BD,
+0xF5CD, 0xD5CD, 0xD5CD, 0x98DE, 0x77E6, 0x98E6, 0x78E6, 0x98E6, 0x97E6, 0x97E6, 0xED8B, 0xED8B, 0xF5CD, 0xF5CD, 0xF5CD, 0x97DE,
+0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x76DE, 0x76DE, 0x76DE, 0x56DE, 0x77E6, 0x97E6,
+0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x96DE, 0x76DE, 0x77E6, 0xD4CD, 0x35D6, 0x56DE, 0xF5CD, 0xF5CD, 0xB8E6, 0x76DE, 0x97E6, 0x77E6,
+0x97DE, 0xD0AC, 0xF1B4, 0xF5CD, 0xF5CD, 0x97DE, 0x97E6, 0xB8E6, 0x56DE, 0x77E6, 0xCD83, 0x6FA4, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6,
+0x57DE, 0x57DE, 0x57DE, 0x94C5, 0xD5CD, 0x76E6, 0x98E6, 0x35D6, 0x35D6, 0x56DE, 0x36D6, 0x36D6, 0x36D6, 0xF5D5, 0x2F94, 0xAD7B,
+0x15D6, 0xD1AC, 0xF1AC, 0xB0A4, 0x77E6, 0x77DE, 0xF5CD, 0xF1AC, 0xF1AC, 0xD1AC, 0x77DE, 0x97E6, 0x57DE, 0x15D6, 0xF1AC, 0xF1AC,
+0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x11AD, 0xF1AC, 0x97E6, 0x76E6, 0x76E6, 0x77DE, 0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x98E6,
+0xB8E6, 0x98DE, 0x76DE, 0x76DE, 0x8FA4, 0x8FA4, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98DE, 0x52BD, 0x11B5,
+0x32B5, 0x32B5, 0x96E6, 0x77DE, 0x97E6, 0x76DE, 0x98E6, 0x36D6, 0x36D6, 0x15D6, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x96E6, 0x97E6,
+0x76DE, 0x77DE, 0x56DE, 0x32B5, 0x32B5, 0x32B5, 0x76E6, 0x76E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x52BD, 0x52BD, 0x32B5,
+0x96E6, 0x98E6, 0x97DE, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x32BD, 0x32B5, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0xB8E6, 0x98E6, 0x96DE,
+0x97E6, 0x8C7B, 0x32B5, 0x93C5, 0x32B5, 0x52BD, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x32BD, 0xB0AC, 0x6FA4,
+0x73C5, 0x35D6, 0x35D6, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x77DE, 0x97E6, 0x76DE, 0x97DE, 0x76DE, 0xD4CD, 0x52BD, 0x32BD,
+0x94C5, 0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x96DE, 0x97DE, 0x15D6, 0xF5D5, 0xF5CD, 0x76DE,
+0x32B5, 0x32BD, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x97DE, 0x77DE, 0x96DE, 0x35DE, 0x36D6, 0xF5D5, 0x77DE, 0x32B5, 0x32B5,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0xF5CD, 0x77DE, 0x32BD, 0x32B5, 0x32B5, 0x97E6,
+0xB7E6, 0x96DE, 0x98E6, 0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0xD4D5, 0x35D6, 0x32B5, 0x32BD, 0x32BD, 0x97E6, 0x97E6,
+0xB8E6, 0x97DE, 0xB8E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0xF5D5, 0x15D6, 0x52BD, 0x32BD, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB8E6,
+0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xF5D5, 0x15D6, 0xB4C5, 0x53BD, 0x32B5, 0x32B5, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6,
+0x97E6, 0x77E6, 0x98E6, 0xB7E6, 0xB7E6, 0x15D6, 0x56DE, 0x15CE, 0xD5CD, 0xF5CD, 0x52BD, 0x32B5, 0x11B5, 0x32B5, 0x97E6, 0x98E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x96DE, 0xB7E6, 0x15D6, 0x55DE, 0x15D6, 0xEE8B, 0x16D6, 0x15CE, 0xF5CD, 0x56DE,
+0x36D6, 0xF1AC, 0x12B5, 0x32B5, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x96DE, 0x96E6, 0x6FA4, 0x2F94, 0xEE8B,
+0x77DE, 0x55DE, 0x32B5, 0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x56DE, 0x56DE, 0xF1AC, 0xF1B4, 0x77E6, 0x77E6, 0x76E6, 0xB8E6, 0xB8E6,
+0x96DE, 0x98E6, 0x97DE, 0x97E6, 0x96E6, 0x72BD, 0x32BD, 0x6FA4, 0x56DE, 0x55DE, 0x32B5, 0xD5CD, 0x36D6, 0x98E6, 0x97E6, 0x98E6,
+0x15D6, 0x16D6, 0x36D6, 0x97E6, 0x77DE, 0x77DE, 0xF1AC, 0xF1AC, 0x77E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0x97DE, 0x98E6, 0x96DE,
+0x76DE, 0x97E6, 0x15D6, 0xF5D5, 0x57DE, 0x56DE, 0x76DE, 0xF5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0xD5CD, 0x96DE, 0x53BD,
+0x16D6, 0x16D6, 0x97E6, 0x96E6, 0x97E6, 0x2F94, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0xB8E6, 0x97E6, 0x97E6,
+0x98E6, 0x98E6, 0x98E6, 0x15D6, 0xF5D5, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0xD8E6,
+0x98E6, 0x36D6, 0x36D6, 0x16D6, 0x77E6, 0x97E6, 0xD0AC, 0xD0AC, 0xD0AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x98E6, 0x98E6, 0xB8E6, 0xB7E6,
+0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB7DE, 0x35DE, 0x56DE, 0x56DE, 0x97E6, 0x96DE, 0x96DE, 0x98E6, 0x76DE, 0x97E6, 0xD4CD, 0xB8E6,
+0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x36D6, 0x35DE, 0x35DE, 0xF5D5, 0x52BD, 0xD0AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x97E6, 0x98E6,
+0x77DE, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB8E6, 0x36DE, 0x36D6, 0x35DE, 0xF5CD, 0x56DE, 0xB8E6, 0x97E6, 0x36D6, 0x97E6, 0x97E6,
+0x14CE, 0x97E6, 0x97DE, 0x97DE, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0x11AD, 0xF1AC, 0x97E6, 0x97E6, 0x76E6, 0xB8E6, 0xB7E6,
+0x77E6, 0x98E6, 0x97E6, 0x97E6, 0xB7DE, 0x57DE, 0x36DE, 0x0E94, 0x56DE, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE,
+0x75DE, 0x56DE, 0x97E6, 0xB7E6, 0xB8E6, 0x77DE, 0x56DE, 0xB4CD, 0xD5CD, 0xD4CD, 0xD4CD, 0x11B5, 0x97E6, 0x97E6, 0x97E6, 0xB7E6,
+0x77E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0xF1AC, 0xB0A4, 0x0E94, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6,
+0x56DE, 0x77DE, 0x96DE, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0xB8E6, 0x98E6, 0x96DE, 0x97DE, 0xB8E6, 0x97DE,
+0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x93C5, 0x11B5, 0x73BD, 0x97E6, 0x98E6, 0x56DE, 0x77DE,
+0x56DE, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x6F9C, 0xB8E6, 0x77E6, 0x76DE, 0xD8E6, 0x77E6, 0x77E6, 0x98E6, 0x98E6,
+0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97E6, 0x77DE, 0xD4CD, 0xB4CD, 0x32B5, 0x35D6, 0x56D6, 0x35D6, 0x76DE, 0x76DE, 0x97DE,
+0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97E6,
+0x77E6, 0x55DE, 0x97E6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x76DE, 0x77DE, 0x57DE, 0x77DE, 0x97E6, 0x4F9C, 0x4F9C, 0x97E6,
+0xB7E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97E6, 0xD8E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x56E6, 0x56E6, 0x77DE, 0x77DE,
+0x36DE, 0x15D6, 0x15D6, 0x15D6, 0x98E6, 0x35D6, 0x56D6, 0x36D6, 0x56DE, 0xD0AC, 0xB0A4, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6,
+0x98E6, 0x76E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x77DE, 0x97E6, 0x96E6, 0x16D6, 0x36D6, 0x15D6, 0x97E6,
+0x97E6, 0x15D6, 0x36D6, 0x36D6, 0xB4CD, 0x32BD, 0x77E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6,
+0x98E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6, 0x36D6, 0x15D6, 0x77DE, 0x97E6, 0x97E6, 0x8FA4, 0xB0A4, 0xD4CD, 0x98E6,
+0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xD9E6, 0x97DE, 0x97E6, 0x77E6, 0x97E6, 0x96DE, 0xB8E6,
+0x36D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x4F9C, 0x2F9C, 0x32B5, 0xF5D5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x96DE,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD8E6, 0x97DE, 0x97DE, 0x97E6, 0x56DE, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x36D6, 0x2E94,
+0x11B5, 0x12B5, 0x12B5, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6,
+0x96E6, 0xB8E6, 0x97DE, 0x76DE, 0xD5CD, 0x36D6, 0xF5D5, 0xF5D5, 0x32B5, 0x12B5, 0x76E6, 0x98E6, 0xB7E6, 0x97E6, 0xB9E6, 0xB8E6,
+0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0xB8E6, 0xB8EE, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x35D6, 0x8C7B, 0xF5CD, 0xF5D5,
+0x12B5, 0x11B5, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x97E6,
+0x96E6, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x76DE, 0x2E94, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97DE, 0x98E6,
+0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x97DE, 0x77DE, 0x97DE, 0x56DE, 0x76DE, 0x76DE, 0xF5D5, 0xD5CD, 0x32B5,
+0x52BD, 0x32B5, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x97E6, 0x98E6,
+0x35DE, 0x35D6, 0xF5D5, 0x35D6, 0x32B5, 0x32B5, 0x98E6, 0x77DE, 0x96E6, 0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB6E6, 0x97E6,
+0x98E6, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x76E6, 0x96E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x56DE, 0x97E6, 0x32B5, 0x53BD, 0x97E6, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6,
+0xB8E6, 0x98E6, 0x77E6, 0x77DE, 0xD4CD, 0x15D6, 0x36D6, 0x53BD, 0x53BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6,
+0x76DE, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0xB8E6, 0x93C5, 0xD4CD, 0x52BD, 0x73BD, 0x97E6, 0x96E6, 0x76DE, 0x98E6, 0x77E6, 0x77DE,
+0xB9E6, 0x97E6, 0xB8E6, 0xB8E6, 0x76DE, 0x76DE, 0x76DE, 0xB0AC, 0xB0AC, 0x73BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77DE,
+0xB8E6, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0x35D6, 0x56D6, 0x56DE, 0x8C7B, 0xCD8B, 0x73BD, 0x73BD, 0x97E6, 0x97DE, 0x76DE, 0xB8E6,
+0x77DE, 0x97DE, 0xB8E6, 0x76E6, 0x97DE, 0x97DE, 0x56DE, 0x56DE, 0x93C5, 0x93C5, 0x93BD, 0x76DE, 0x97E6, 0x76DE, 0x76DE, 0x76DE,
+0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x76E6, 0xF5D5, 0x36D6, 0x93C5, 0x93BD, 0x93C5, 0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0x76DE, 0x98E6,
+0x97DE, 0x97E6, 0x97E6, 0x11B5, 0x52BD, 0xF5CD, 0x93C5, 0x93C5, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x98E6, 0x98E6, 0x97E6, 0x76DE,
+0x96DE, 0x96E6, 0x6FA4, 0x6FA4, 0xF1AC, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0xAC83, 0xB4C5, 0xB4C5, 0xB4C5, 0x96E6, 0x97E6, 0x97DE, 0x76E6, 0x77DE, 0x76DE, 0x76DE, 0x96E6, 0x97E6, 0x97E6, 0xD4CD,
+0xD4CD, 0xB4C5, 0x76DE, 0x97E6, 0x77E6, 0x77E6, 0x77DE, 0x97DE, 0x98E6, 0x97DE, 0x76E6, 0xD4CD, 0xD4C5, 0x77DE, 0x77DE, 0x96E6,
+0x96DE, 0x98E6, 0x98E6, 0x98DE, 0x77DE, 0x77DE, 0x97E6, 0xD4CD, 0xD4CD, 0x97E6, 0x97DE, 0x98E6, 0x97DE, 0xB8E6, 0x76DE, 0x97E6,
+0x35D6, 0x56DE, 0x56DE, 0xD5CD, 0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0xB4CD, 0xF5CD, 0x15D6,
+0xF5CD, 0xD5CD, 0xD5CD, 0x76DE, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0xF1B4, 0x52BD, 0xD5CD, 0xD5CD, 0x98DE, 0x77E6,
+0x76DE, 0x98E6, 0x78E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0x4F9C, 0xF5CD, 0xF5CD, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0xB7E6, 0x97E6,
+0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x77E6, 0x76DE, 0x77DE, 0x77E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x96DE,
+0x76DE, 0x77E6, 0xD4CD, 0x35D6, 0x35D6, 0xF5CD, 0xF5CD, 0xB8E6, 0x76DE, 0x97E6, 0x77E6, 0x97DE, 0x6FA4, 0xD0AC, 0xF1B4, 0xF5CD,
+0xF5CD, 0x97DE, 0x97E6, 0x97E6, 0x56DE, 0x56DE, 0xCD83, 0xD5CD, 0xF5CD, 0xF5CD, 0x98E6, 0x97E6, 0x56DE, 0x57DE, 0x57DE, 0x94C5,
+0x56DE, 0x76E6, 0x35D6, 0x35D6, 0x36D6, 0x36D6, 0x36D6, 0x2F94, 0xAD7B, 0xF1AC, 0xB0A4, 0x6F9C, 0x77DE, 0x15D6, 0xF1AC, 0xD1AC,
+0xF1AC, 0x97E6, 0x97E6, 0x57DE, 0x15D6, 0xF5CD, 0xF1AC, 0xF1AC, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0x12B5, 0x11AD, 0xF1AC,
+0x97E6, 0x76E6, 0x97E6, 0x77DE, 0x77DE, 0x32B5, 0x32B5, 0x12B5, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x8FA4, 0x8FA4, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xF5D5, 0x52BD, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x77DE, 0x77DE, 0x77E6, 0x76DE,
+0x98E6, 0x36D6, 0x15D6, 0xF5D5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0x56DE, 0x36DE, 0x32B5, 0x32B5,
+0x98E6, 0x76E6, 0xB8E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x77DE, 0x32B5, 0x52BD, 0x32B5, 0x96E6, 0x98E6, 0x97DE, 0x97E6, 0x97DE,
+0xB8E6, 0xB8E6, 0x32B5, 0x93C5, 0x93C5, 0x32BD, 0x32B5, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x96E6, 0xB8E6, 0x98E6, 0x96DE, 0x8C7B,
+0x73C5, 0x35D6, 0x32B5, 0x52BD, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x94C5, 0x77DE,
+0x32B5, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x76DE, 0x97DE, 0x76DE, 0xD4CD, 0x52BD, 0x32BD, 0xF5CD, 0x56DE, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x96DE, 0x97DE, 0x15D6, 0x15D6, 0xF5D5, 0xF5D5, 0x77DE, 0x32B5, 0x32B5,
+0x32BD, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x97DE, 0x97DE, 0x77DE, 0x57DE, 0x35DE, 0xF5CD, 0x35D6, 0x32B5, 0x32B5, 0x32B5,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0xD4D5, 0x35D6, 0x32BD, 0x32B5, 0xB7E6, 0xB7E6,
+0x97E6, 0xB8E6, 0x96DE, 0x96E6, 0x77DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0xF5D5, 0x15D6, 0x15D6, 0x32BD, 0x32BD, 0x32B5, 0xB7E6,
+0xB7E6, 0x97E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0xF5D5, 0x15D6, 0x53BD, 0x32B5, 0x32B5, 0x52BD, 0x77E6,
+0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x15D6, 0x56DE, 0x15CE, 0xD5CD, 0xB4C5, 0x52BD, 0x32B5,
+0x32B5, 0x98E6, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x96E6, 0x96E6, 0x97E6, 0xB7E6, 0x96E6, 0x55DE, 0x15D6, 0xEE8B, 0x15CE, 0xF5CD,
+0x15CE, 0x56DE, 0x36D6, 0x12B5, 0x32B5, 0x11B5, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x97E6, 0x96DE,
+0xEE8B, 0x77DE, 0x55DE, 0x32B5, 0x36D6, 0x36D6, 0x56DE, 0x56DE, 0x56DE, 0xF1B4, 0xF1AC, 0x12B5, 0x76E6, 0x77E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x97DE, 0x97DE, 0x96E6, 0x96DE, 0x96E6, 0x6FA4, 0x2F94, 0x56DE, 0x56DE, 0x55DE, 0xD5CD, 0x36D6, 0x98E6, 0x97E6, 0x15D6,
+0x15D6, 0x16D6, 0x36D6, 0x36D6, 0x77DE, 0x77DE, 0x56DE, 0xF1AC, 0xD1AC, 0x76DE, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE,
+0x98E6, 0x97E6, 0x97E6, 0xD4CD, 0xD4CD, 0x72BD, 0x57DE, 0x56DE, 0x76DE, 0xF5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0xB8E6, 0x98E6,
+0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x16D6, 0x96E6, 0x97E6, 0x2F94, 0xF1AC, 0xF1AC, 0x11AD, 0x98E6, 0x77E6, 0x77DE, 0xB8E6, 0x98E6,
+0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0xF5D5, 0x15D6, 0xF5D5, 0x52B5, 0x36D6, 0x77DE, 0x56DE, 0x77DE, 0xD5CD, 0xD5CD, 0x97E6,
+0xB8E6, 0x98E6, 0xD8E6, 0x98E6, 0x96DE, 0x36D6, 0x16D6, 0x77E6, 0x97E6, 0x97E6, 0xD0AC, 0xD0AC, 0xF1AC, 0xF1AC, 0x98E6, 0x98E6,
+0x97E6, 0xB7E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x56DE, 0x15D6, 0x97E6, 0x97E6, 0x96DE, 0x98E6, 0x76DE,
+0x97E6, 0xD4CD, 0xB8E6, 0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x36D6, 0x56DE, 0x35DE, 0xF5D5, 0x52BD, 0xD0AC, 0xF1AC, 0xF1AC, 0x97E6,
+0x97E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x36D6, 0x35DE, 0x56DE, 0xF5CD, 0x97E6, 0xB8E6, 0x97E6,
+0x36D6, 0x97E6, 0x97E6, 0x14CE, 0x97E6, 0x77DE, 0x97DE, 0x98DE, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x11AD, 0xF1AC, 0xF1AC,
+0x97E6, 0x76E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xB7DE, 0xB8E6, 0x36DE, 0x36DE, 0x36DE, 0x56DE, 0x76DE, 0x97E6,
+0x98E6, 0xB8E6, 0x96DE, 0xB8E6, 0x77DE, 0x75DE, 0x56DE, 0x97E6, 0xB7E6, 0xB8E6, 0x77DE, 0x56DE, 0xB4CD, 0xD5CD, 0xD4CD, 0x11B5,
+0x97E6, 0x97E6, 0x98E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x56DE, 0xB0A4, 0x0E94, 0x73BD,
+0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x56DE, 0x77DE, 0x96DE, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0xB8E6, 0x98E6,
+0x96DE, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x76DE, 0x11B5, 0xF1AC,
+0x35D6, 0x97E6, 0x98E6, 0x56DE, 0x77DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x6F9C, 0xB8E6, 0x77E6, 0xB8E6,
+0xD8E6, 0x77E6, 0x77E6, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0x77DE, 0xD4CD, 0xB4CD, 0x93C5, 0x32B5,
+0x35D6, 0x56D6, 0x35D6, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0x77E6, 0x97E6, 0x76DE,
+0xB7E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x15D6, 0xF5CD, 0xF5CD, 0x15D6, 0x36D6, 0x56DE,
+0x76DE, 0x77DE, 0x56DE, 0x77DE, 0x97E6, 0x4F9C, 0x4F9C, 0x97E6, 0xB7E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97E6, 0xD8E6, 0xB7E6, 0x97E6,
+0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x56E6, 0x77DE, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0x97E6, 0x98E6, 0x35D6, 0x56D6, 0x36D6,
+0x56DE, 0xD0AC, 0xB0A4, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x76E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x77E6, 0x77DE, 0x97E6, 0x96E6, 0x77DE, 0x15D6, 0x16D6, 0x36D6, 0x76DE, 0x97E6, 0x97E6, 0x15D6, 0x36D6, 0xD4CD, 0xB4CD, 0x32BD,
+0x77E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6,
+0xB7E6, 0x97E6, 0x36D6, 0x36D6, 0x15D6, 0x77DE, 0x97E6, 0x2F9C, 0x8FA4, 0xB0A4, 0x97E6, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xD9E6, 0x97DE, 0x97E6, 0x77E6, 0x97E6, 0x96DE, 0xB8E6, 0x36D6, 0x36D6, 0x36D6, 0x15D6,
+0x55DE, 0x2E94, 0x4F9C, 0x32B5, 0xF5D5, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xB7E6, 0x98E6, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0xB8E6, 0xD8E6, 0x97DE, 0x97E6, 0x97E6, 0x56DE, 0xD5CD, 0x36D6, 0x36D6, 0xF5D5, 0x15D6, 0x36D6, 0x11B5, 0x12B5, 0xB7E6, 0xB7E6,
+0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x76DE,
+0xD5CD, 0xF5D5, 0xF5D5, 0x11B5, 0x32B5, 0x12B5, 0x76E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0xB8E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6,
+0x98E6, 0x77E6, 0xB8E6, 0xB8EE, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x35D6, 0x8C7B, 0xF5CD, 0x32B5, 0x12B5, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x96DE, 0x97E6, 0x97DE, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0x97E6, 0xB8E6, 0x97E6,
+0x76DE, 0x76DE, 0x2E94, 0x32B5, 0x32B5, 0x96DE, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x97DE, 0x98E6, 0xB8E6, 0x97E6, 0x98E6,
+0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x77DE, 0x97DE, 0x97DE, 0x56DE, 0x76DE, 0x76DE, 0xF5D5, 0xD5CD, 0x32B5, 0x32B5, 0x52BD, 0x97E6,
+0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x98E6, 0x35DE, 0x35D6,
+0xF5D5, 0x35D6, 0x32B5, 0x32B5, 0x96E6, 0x98E6, 0x77DE, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0x98DE, 0xB6E6, 0x97E6, 0x77DE,
+0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x97E6, 0x76E6, 0x96E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x77E6, 0x97E6,
+0x77DE, 0x97E6, 0x97E6, 0x36D6, 0x56DE, 0x53BD, 0x53BD, 0x32B5, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x77DE, 0xD4CD, 0x15D6, 0x73BD, 0x53BD, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB9E6, 0x97E6,
+0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x76E6, 0x11B5, 0x93C5, 0xD4CD, 0x53BD, 0x52BD, 0x52BD, 0x97E6, 0x96E6, 0x96E6, 0x77DE,
+0x98E6, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6, 0xB8E6, 0x56DE, 0x76DE, 0x76DE, 0xB0AC, 0xB0AC, 0x73BD, 0x73BD, 0x73BD, 0x97DE, 0x97E6,
+0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97E6, 0x35D6, 0x35D6, 0x8C7B, 0x93C5, 0x93BD, 0x76DE, 0x97E6, 0x97E6,
+0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0x76E6, 0x97DE, 0x97DE, 0x36D6, 0x56DE, 0x93C5, 0x93BD, 0x93C5, 0x97E6, 0x76DE, 0x77DE,
+0x77DE, 0x76DE, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x52BD, 0xF5CD, 0xF5D5, 0x93C5, 0x93C5, 0x93C5, 0xB7E6, 0x77E6, 0x98E6,
+0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0x96DE, 0x96E6, 0x97E6, 0xF1AC, 0x11B5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0x97DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xAC83, 0x0E94, 0x6FA4, 0xB4C5, 0xB4C5, 0xB4C5, 0x96E6, 0x97E6, 0x97DE, 0x76E6, 0x77DE,
+0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xD4CD, 0xD4CD, 0xB4C5, 0x76DE, 0x97E6, 0x77E6, 0xB8E6, 0x97DE, 0x98E6, 0x77DE, 0x76E6,
+0x96E6, 0x96E6, 0xD4CD, 0xD4C5, 0x77DE, 0x96E6, 0x96DE, 0x98E6, 0x76DE, 0x98DE, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0xD4CD, 0xD4CD,
+0xD4CD, 0x97DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0x76DE, 0x97E6, 0x35D6, 0x56DE, 0x56DE, 0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97DE,
+0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0xF5CD, 0x15D6, 0x35D6, 0xD5CD, 0xD5CD, 0x76DE, 0x76DE, 0x97DE, 0x97DE, 0x98E6, 0x97E6,
+0x97E6, 0x98E6, 0x52BD, 0xB4CD, 0xF5CD, 0xD5CD, 0xD5CD, 0x98DE, 0x77E6, 0x98E6, 0x78E6, 0x98E6, 0x97E6, 0x97E6, 0xED8B, 0x4F9C,
+0x4F9C, 0xF5CD, 0xF5CD, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6,
+0x76DE, 0x76DE, 0x76DE, 0x56DE, 0x77E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x97DE, 0x76DE, 0x77E6, 0xD4CD, 0x35D6,
+0xF5CD, 0xF5CD, 0x97E6, 0xB8E6, 0x76DE, 0x77E6, 0x77E6, 0x6FA4, 0xD0AC, 0xF1B4, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97DE, 0x97E6,
+0x56DE, 0x56DE, 0xCD83, 0x6FA4, 0x94C5, 0xD5CD, 0xF5CD, 0x98E6, 0x97E6, 0x56DE, 0x57DE, 0x57DE, 0x36D6, 0x56DE, 0x76E6, 0x35D6,
+0x35D6, 0xF5D5, 0x36D6, 0xAD7B, 0xB0A4, 0x6F9C, 0x77DE, 0x15D6, 0xF1AC, 0xD1AC, 0xF1AC, 0x97E6, 0x77E6, 0x15D6, 0xF5CD, 0xF1AC,
+0xF1AC, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0x11AD, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x32B5,
+0x12B5, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x8FA4, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x98DE,
+0x52BD, 0x11B5, 0x8FA4, 0x32B5, 0x32B5, 0x96E6, 0x77DE, 0x97E6, 0x76DE, 0x98E6, 0x97E6, 0x15D6, 0xF5D5, 0x32B5, 0x32B5, 0x32B5,
+0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x77E6, 0x56DE, 0x36DE, 0x36DE, 0x93C5, 0x32B5, 0x32B5, 0x98E6, 0x76E6, 0xB8E6, 0x98E6, 0x98E6,
+0x76DE, 0x97E6, 0x97E6, 0x32B5, 0x93C5, 0x32B5, 0x52BD, 0x32B5, 0x96E6, 0x96E6, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0x73C5, 0x35D6, 0x32BD, 0x32BD, 0x32B5, 0x97E6, 0xB8E6, 0x98E6, 0x96E6, 0xB8E6, 0x98E6, 0x96DE, 0x97E6, 0x94C5, 0x76DE, 0x32B5,
+0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x6FA4, 0xF5CD, 0x56DE, 0x32B5,
+0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x76DE, 0x97DE, 0x76DE, 0x76DE, 0xD4CD, 0x52BD, 0xF5D5, 0x77DE, 0x77DE, 0x32BD,
+0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x96DE, 0x96DE, 0x36D6, 0x15D6, 0xF5D5, 0xF5CD, 0x35D6, 0x32B5,
+0x32B5, 0x32BD, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x77DE, 0x97DE, 0x77DE, 0x57DE, 0x35DE, 0xD4D5, 0x35D6, 0x32B5, 0x32B5,
+0x32B5, 0x97E6, 0xB7E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0xD4CD, 0x15D6, 0x32B5, 0x32BD,
+0x32BD, 0x97E6, 0xB7E6, 0x97DE, 0xB8E6, 0x96DE, 0x96E6, 0x77DE, 0x76DE, 0x97E6, 0x96E6, 0xF5D5, 0x15D6, 0x52BD, 0x32BD, 0xB8E6,
+0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x15D6, 0x15D6, 0x56DE, 0xD5CD, 0xB4C5, 0x53BD,
+0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x77E6, 0x98E6, 0xB7E6, 0xB8E6, 0x55DE, 0x15D6, 0xEE8B,
+0xF5CD, 0x15CE, 0x15CE, 0x36D6, 0xF5CD, 0x11B5, 0x32B5, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96E6, 0x96DE,
+0xB7E6, 0x96E6, 0x77DE, 0x55DE, 0x32B5, 0x93C5, 0x36D6, 0x36D6, 0x16D6, 0x56DE, 0x56DE, 0x56DE, 0xF1AC, 0x12B5, 0x12B5, 0x77E6,
+0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x76DE, 0x96E6, 0x97E6, 0x2F94, 0xEE8B, 0xED8B, 0x56DE, 0x55DE, 0xD5CD, 0x36D6,
+0x98E6, 0x97E6, 0x15D6, 0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x77DE, 0x56DE, 0xD1AC, 0xF1AC, 0x98E6, 0x77E6, 0x76E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x98E6, 0x97DE, 0x97E6, 0x96E6, 0x96DE, 0x72BD, 0x32BD, 0x6FA4, 0x57DE, 0x56DE, 0x76DE, 0xF5CD, 0x97E6, 0xB7E6, 0xB7E6,
+0xB7E6, 0xB8E6, 0x98E6, 0xD5CD, 0x53BD, 0x16D6, 0x16D6, 0x16D6, 0x96E6, 0x97E6, 0x77DE, 0xF1AC, 0x11AD, 0xF1AC, 0x77E6, 0x76DE,
+0xB8E6, 0x98E6, 0xB8E6, 0x97DE, 0x98E6, 0x96DE, 0x76E6, 0x76DE, 0x97E6, 0xF5D5, 0xD4CD, 0x52B5, 0x36D6, 0x77DE, 0x56DE, 0x56DE,
+0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6, 0xD8E6, 0x98E6, 0x96DE, 0x36D6, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0xD0AC, 0xD0AC, 0x6F9C,
+0xF1AC, 0xF1AC, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x15D6, 0xF5D5, 0x15D6,
+0x56DE, 0x97E6, 0x96DE, 0x98E6, 0x76DE, 0x97E6, 0xD4CD, 0xB8E6, 0x98E6, 0x97E6, 0xD8E6, 0x76DE, 0x36D6, 0x56DE, 0x35DE, 0x56DE,
+0x52BD, 0xD0AC, 0xD0AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xB7DE,
+0x97DE, 0x56DE, 0x56DE, 0xF5CD, 0x97E6, 0xB8E6, 0x97E6, 0x36D6, 0x97E6, 0x97E6, 0x14CE, 0x14CE, 0x77DE, 0x97DE, 0x98DE, 0x56DE,
+0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0xF1AC, 0xF1AC, 0x97E6, 0x76E6, 0x97E6, 0xB7E6, 0x98E6, 0x77DE, 0x97E6, 0xB8E6, 0xB7DE, 0xB8E6,
+0xB8E6, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x76DE, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0xB8E6, 0x77DE, 0x75DE, 0x56DE, 0x97E6, 0xB7E6,
+0xB8E6, 0x77DE, 0x56DE, 0x56DE, 0xD5CD, 0xD4CD, 0x11B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0x77E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6,
+0xB8E6, 0x97E6, 0xB7DE, 0x56DE, 0x57DE, 0x0E94, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x56DE, 0x77DE, 0x96DE, 0xB8E6, 0x98E6,
+0xB7E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x32BD, 0x98E6, 0x96DE, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0xB7E6, 0x97E6, 0x76DE,
+0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x76DE, 0x77E6, 0xF1AC, 0xB0A4, 0x35D6, 0x97E6, 0x98E6, 0x56DE, 0x77DE, 0x97E6, 0x98E6, 0x97E6,
+0xB8E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x6F9C, 0xB8E6, 0x77E6, 0xB8E6, 0xD8E6, 0x77E6, 0x97DE, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6,
+0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x77DE, 0xB4CD, 0x93C5, 0x11B5, 0x32B5, 0x55D6, 0x56D6, 0x35D6, 0x57DE, 0x76DE, 0x97E6, 0x97E6,
+0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6, 0x77E6,
+0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xF5CD, 0xD4CD, 0xB4CD, 0x15D6, 0x36D6, 0x35D6, 0x76DE, 0x77DE, 0x56DE, 0x77DE, 0x97E6, 0x4F9C,
+0x4F9C, 0x97E6, 0xB7E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97E6, 0xD8E6, 0xB7E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x77DE,
+0x55DE, 0x36DE, 0x36DE, 0x15D6, 0x36D6, 0x15D6, 0x15D6, 0x97E6, 0x98E6, 0x35D6, 0x56D6, 0x36D6, 0x12B5, 0xD0AC, 0xB0A4, 0x97DE,
+0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x76E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0xB8E6, 0x96E6,
+0x77DE, 0x77DE, 0x15D6, 0x16D6, 0x97E6, 0x76DE, 0x97E6, 0x94C5, 0x15D6, 0x36D6, 0xD4CD, 0xB4CD, 0x97DE, 0x77E6, 0xB8E6, 0x97E6,
+0xB8E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x36D6,
+0x36D6, 0x36D6, 0x55DE, 0x77DE, 0x97E6, 0x2F9C, 0x8FA4, 0x97E6, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6,
+0xB8E6, 0x97E6, 0xD9E6, 0x97DE, 0x97E6, 0x77E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x2E94,
+0x4F9C, 0x12B5, 0x32B5, 0xF5D5, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0xB7E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6,
+0xD8E6, 0x97DE, 0x97E6, 0x97E6, 0xD5CD, 0x36D6, 0xF5D5, 0xF5D5, 0x15D6, 0xF1B4, 0x11B5, 0x12B5, 0xB7E6, 0xB7E6, 0xB9E6, 0x98E6,
+0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x96E6, 0x96E6, 0x97E6, 0x97DE, 0x76DE, 0xF5CD, 0xF5D5,
+0x11B5, 0x32B5, 0x97E6, 0x76E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0x77E6, 0xB8E6,
+0xB8EE, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x35D6, 0x8C7B, 0x32B5, 0x32B5, 0x12B5, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x77E6,
+0x97E6, 0x97DE, 0x96DE, 0x96DE, 0x97E6, 0x97DE, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0x56DE, 0x52BD,
+0x32B5, 0x97DE, 0x96DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97DE, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6,
+0xB7E6, 0x77DE, 0x97DE, 0x97E6, 0x76DE, 0x76DE, 0x76DE, 0xF5D5, 0xD5CD, 0x32B5, 0x32B5, 0x32B5, 0x96E6, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x35D6, 0xF5D5, 0x35D6, 0x53BD,
+0x32B5, 0x96E6, 0x96E6, 0x98E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x98DE, 0xB6E6, 0x98E6, 0x77DE, 0x97DE, 0x97E6,
+0x97E6, 0x32B5, 0x32B5, 0x53BD, 0x97E6, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x77DE, 0x97E6,
+0x97E6, 0x15D6, 0x36D6, 0x56DE, 0x53BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x76DE, 0x97E6, 0x98E6, 0x97E6,
+0x97E6, 0x76E6, 0xB8E6, 0x77E6, 0xD4CD, 0xD4CD, 0x52BD, 0x52BD, 0x73BD, 0x96E6, 0x76DE, 0x97E6, 0x77E6, 0x97E6, 0xB9E6, 0x97E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0xB0AC, 0x11B5, 0x93C5, 0x73BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6,
+0x77DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x56D6, 0x56DE, 0x76DE, 0xCD8B, 0xB0AC, 0x93BD, 0x73BD, 0x73BD, 0x97E6, 0x97E6,
+0x97DE, 0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0xB8E6, 0x56DE, 0x35D6, 0x93C5, 0x93C5, 0x97E6, 0x76DE, 0x76DE,
+0x77DE, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x76E6, 0xF5D5, 0x36D6, 0x36D6, 0x93C5, 0x93C5, 0x93C5, 0xB7E6, 0x77E6,
+0x97E6, 0xB8E6, 0x77DE, 0x76DE, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x11B5, 0x52BD, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x76E6,
+0x97E6, 0x77E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x0E94, 0x6FA4, 0xF1AC, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6,
+0x97E6, 0x77DE, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xAC83, 0xD4CD, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x77E6,
+0xB8E6, 0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x96E6, 0x97E6, 0xD4CD, 0xD4C5, 0xD4C5, 0x77DE, 0x96E6, 0x96DE, 0x98E6, 0x76DE, 0x98DE,
+0x77DE, 0x97DE, 0x97E6, 0x97DE, 0x76E6, 0xD4CD, 0xD4CD, 0xD4CD, 0x97DE, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x97E6, 0x98E6, 0x98DE,
+0x56DE, 0x77DE, 0xD5CD, 0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0xF5CD, 0x15D6, 0x35D6,
+0xF5CD, 0xD5CD, 0xD5CD, 0x76DE, 0x97DE, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x52BD, 0xB4CD, 0xF5CD, 0xD5CD, 0xD5CD,
+0x98DE, 0x77E6, 0x77E6, 0x98E6, 0x78E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0x4F9C, 0xF1B4, 0xF5CD, 0xF5CD, 0xF5CD, 0x76DE, 0x97DE,
+0x77DE, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0x96DE, 0x97E6, 0x97E6, 0x77E6, 0x76DE, 0x77DE, 0x77E6, 0x97E6,
+0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x97DE, 0x76DE, 0x77E6, 0xD4CD, 0x35D6, 0x56DE, 0xF5CD, 0xF5CD, 0x97E6, 0xB8E6, 0x76DE,
+0x77E6, 0x77E6, 0x77E6, 0x6FA4, 0xD0AC, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97DE, 0x57DE, 0x57DE, 0x56DE, 0xCD83, 0x94C5, 0xD5CD,
+0x56DE, 0x76E6, 0x98E6, 0x35D6, 0x56DE, 0x57DE, 0x36D6, 0x36D6, 0x36D6, 0x35D6, 0xF5D5, 0x36D6, 0xAD7B, 0x6F9C, 0x2F94, 0xAD7B,
+0xD1AC, 0xF1AC, 0xB0A4, 0x77E6, 0x77DE, 0x15D6, 0xF5CD, 0xF1AC, 0xF1AC, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF1AC,
+0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x32B5, 0x32B5, 0x12B5, 0xB8E6, 0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE,
+0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0x98DE, 0x76DE, 0x11B5, 0x8FA4, 0x8FA4, 0x32B5, 0x32B5, 0x32B5, 0x77DE, 0x97E6,
+0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x15D6, 0xF5D5, 0x93C5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0x56DE,
+0x36DE, 0x36D6, 0x32B5, 0x93C5, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0x76E6, 0xB8E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x77DE, 0x73C5,
+0x77DE, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x96E6, 0x98E6, 0x97DE, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x94C5, 0x76DE, 0x52BD,
+0x32BD, 0x32B5, 0x97E6, 0xB8E6, 0x98E6, 0x96E6, 0xB8E6, 0x98E6, 0x96DE, 0x97E6, 0x8C7B, 0xF5CD, 0x56DE, 0x56DE, 0x32B5, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x32BD, 0xB0AC, 0x6FA4, 0xF5CD, 0x77DE, 0x32B5, 0x32B5,
+0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x97DE, 0x97DE, 0x76DE, 0xD4CD, 0x52BD, 0x32BD, 0xF5CD, 0x35D6, 0x32BD, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x96DE, 0x96DE, 0x36D6, 0x15D6, 0xF5D5, 0xF5D5, 0x35D6, 0x32B5, 0x32B5,
+0x32B5, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x77DE, 0x97DE, 0x77DE, 0x57DE, 0x35DE, 0xD4CD, 0x15D6, 0x32BD, 0x32B5,
+0x32B5, 0x97E6, 0xB7E6, 0x96DE, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xF5D5, 0x15D6, 0x32BD, 0x32B5,
+0x32BD, 0xB7E6, 0x97E6, 0xB7E6, 0x97DE, 0xB8E6, 0x96DE, 0x96E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x15D6, 0x56DE, 0xB4C5, 0x53BD,
+0x32B5, 0x52BD, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x55DE, 0x15D6,
+0xEE8B, 0xF5CD, 0x15CE, 0xD5CD, 0xF5CD, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0xB7E6, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6,
+0x77E6, 0x96E6, 0xB7E6, 0xB8E6, 0x77DE, 0x77DE, 0x55DE, 0x32B5, 0x93C5, 0x36D6, 0x16D6, 0x15CE, 0x56DE, 0x56DE, 0x36D6, 0x12B5,
+0x12B5, 0x32B5, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x96DE, 0xB7E6, 0xED8B, 0x56DE, 0x55DE,
+0xD5CD, 0x36D6, 0x98E6, 0x97E6, 0x15D6, 0x15D6, 0x36D6, 0x36D6, 0x77DE, 0x56DE, 0x56DE, 0xF1AC, 0xF1B4, 0xF1AC, 0x76E6, 0x77E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0x97DE, 0xB8E6, 0x96DE, 0x96E6, 0x96E6, 0x6FA4, 0x2F94, 0x57DE, 0x56DE, 0x76DE, 0xF5CD, 0x97E6,
+0x98E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x98E6, 0xD5CD, 0x53BD, 0x16D6, 0x16D6, 0x36D6, 0x97E6, 0x77DE, 0x77DE, 0x11AD, 0xF1AC, 0xD1AC,
+0x76DE, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0xD4CD, 0x72BD, 0x32BD, 0x52B5, 0x36D6,
+0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x96DE, 0x36D6, 0x16D6, 0x16D6, 0x97E6, 0x97E6,
+0x97E6, 0xD0AC, 0x6F9C, 0x2F94, 0xF1AC, 0xF1AC, 0x97E6, 0x98E6, 0x77E6, 0x77DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6,
+0x76E6, 0xF5D5, 0x15D6, 0xF5D5, 0x56DE, 0x97E6, 0x97E6, 0x98E6, 0x76DE, 0x97E6, 0xD4CD, 0xB8E6, 0x98E6, 0x97E6, 0xD8E6, 0x76DE,
+0x76DE, 0x36D6, 0x35DE, 0x56DE, 0x52BD, 0xD0AC, 0xD0AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0xB7E6, 0x97DE,
+0x97E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x56DE, 0x15D6, 0xF5D5, 0xF5CD, 0x97E6, 0xB8E6, 0x97E6, 0x36D6, 0x97E6, 0x97E6, 0x97E6,
+0x14CE, 0x77DE, 0x97DE, 0x98DE, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0xF1AC, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0x97E6,
+0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB8E6, 0x97E6, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6,
+0x96DE, 0xB8E6, 0x77DE, 0x75DE, 0x56DE, 0x97E6, 0xB7E6, 0xB8E6, 0x77DE, 0x56DE, 0x56DE, 0xD5CD, 0x11B5, 0x32B5, 0x11AD, 0x98E6,
+0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x77E6, 0x98E6, 0x97E6, 0x97E6, 0xB7DE, 0xB8E6, 0x57DE, 0x36DE, 0x73BD, 0x97E6, 0x98E6, 0x97E6,
+0x97E6, 0x56DE, 0x77DE, 0x96DE, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x32BD, 0x98E6, 0x96DE, 0xD4CD, 0xB8E6,
+0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97DE, 0x97E6, 0x76DE, 0x77E6, 0x56DE, 0xB0A4, 0x0E94, 0x35D6,
+0x97E6, 0x35D6, 0x56DE, 0x77DE, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x77E6, 0xB8E6, 0xD8E6,
+0x77E6, 0x97DE, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x77DE, 0x77DE, 0x93C5, 0x11B5, 0xF1AC,
+0x32B5, 0x55D6, 0x56D6, 0x56D6, 0x57DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0xB8E6, 0x97E6,
+0x76DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97E6, 0x77DE, 0xD4CD, 0xB4CD, 0x15D6,
+0x15D6, 0x36D6, 0x35D6, 0x76DE, 0x77DE, 0x56DE, 0x77DE, 0xB0A4, 0x4F9C, 0x4F9C, 0x97E6, 0xB7E6, 0x97E6, 0xD9E6, 0xD9E6, 0x97E6,
+0xD8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x77DE, 0x55DE, 0x97E6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x15D6,
+0x97E6, 0x97E6, 0x98E6, 0x36D6, 0x56D6, 0x36D6, 0x12B5, 0xD0AC, 0xB0A4, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x76E6,
+0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x96E6, 0x77DE, 0x77DE, 0x36D6, 0x15D6, 0x16D6, 0x97E6,
+0x76DE, 0xB0A4, 0x94C5, 0x15D6, 0xD4CD, 0xD4CD, 0xB4CD, 0x97DE, 0x77E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB7E6,
+0xB8E6, 0x97E6, 0x76DE, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x77E6, 0xB7E6, 0x97E6, 0x96E6, 0x36D6, 0x36D6, 0x36D6, 0x55DE, 0x55DE,
+0x77DE, 0x4F9C, 0x2F9C, 0x8FA4, 0xF5D5, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6,
+0xD9E6, 0x97DE, 0x97E6, 0x77E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0x36D6, 0x36D6, 0x15D6, 0x15D6, 0x36D6, 0x2E94, 0x12B5, 0x32B5,
+0xF5D5, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD8E6, 0x97E6, 0x97E6,
+0x97E6, 0xD5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x12B5, 0xF1B4, 0x11B5, 0xB7E6, 0xB7E6, 0xB7E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6,
+0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x97DE, 0x76DE, 0x56DE, 0xF5CD, 0x11B5, 0x11B5, 0x97E6,
+0x97E6, 0x76E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x96E6, 0xB8EE, 0xB8E6,
+0x97E6, 0x76DE, 0xB8E6, 0x35D6, 0x8C7B, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6,
+0xB8E6, 0x96DE, 0x97E6, 0x97E6, 0x97DE, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0x56DE, 0x32B5, 0x32B5,
+0x52BD, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6,
+0x97E6, 0xB7E6, 0x77DE, 0x97DE, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0xD5CD, 0xD5CD, 0x32B5, 0x32B5, 0x32B5, 0x77DE, 0x96E6, 0x77E6,
+0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x98E6, 0x35DE, 0x35D6, 0xF5D5,
+0x35D6, 0x53BD, 0x53BD, 0x53BD, 0x76E6, 0x96E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x98DE, 0x97E6,
+0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x98E6, 0x77E6, 0x77DE, 0x97E6, 0x15D6, 0x15D6, 0x36D6, 0x52BD, 0x73BD, 0x53BD, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0x76E6, 0xB8E6, 0x93C5, 0xD4CD, 0xD4CD, 0x73BD, 0x53BD, 0x52BD, 0x97E6,
+0x97E6, 0x96E6, 0x77DE, 0x98E6, 0x77E6, 0x77DE, 0xB9E6, 0x97E6, 0xB8E6, 0xB8E6, 0x56DE, 0x76DE, 0x76DE, 0xB0AC, 0xB0AC, 0x11B5,
+0x73BD, 0x73BD, 0x73BD, 0x97DE, 0x97E6, 0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97E6, 0x35D6, 0x56D6,
+0x56DE, 0x8C7B, 0xCD8B, 0x93C5, 0x93C5, 0x93BD, 0x76DE, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0xB7E6, 0x76E6,
+0x97DE, 0x36D6, 0x56DE, 0x56DE, 0x93C5, 0x93BD, 0x77E6, 0x77E6, 0x97E6, 0xB8E6, 0x77DE, 0x77DE, 0x98E6, 0x97DE, 0xB8E6, 0x97E6,
+0xB7E6, 0xB7E6, 0xF5CD, 0xF5D5, 0xB4C5, 0xB4C5, 0x93C5, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x98E6, 0x98E6, 0x97E6, 0x76DE, 0x96DE,
+0x96E6, 0x97E6, 0xF1AC, 0x11B5, 0x11B5, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6,
+0x98E6, 0xB8E6, 0x98E6, 0xAC83, 0x0E94, 0xD4CD, 0xB4C5, 0xB4C5, 0x97E6, 0x96E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0x76DE, 0x76DE,
+0x96E6, 0x97E6, 0x97E6, 0xD4CD, 0xD4C5, 0xD4CD, 0x96E6, 0x96DE, 0x76DE, 0x76DE, 0x77E6, 0x77E6, 0x77DE, 0x97DE, 0x97E6, 0x97DE,
+0x76E6, 0xD4CD, 0xD4CD, 0x97DE, 0x98E6, 0x77DE, 0x97DE, 0xB8E6, 0x96DE, 0x97E6, 0x98E6, 0x98DE, 0x56DE, 0x77DE, 0x97E6, 0xD5CD,
+0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x15D6, 0x35D6, 0x56DE, 0xD5CD, 0xF5CD, 0xD5CD,
+0x76DE, 0x76DE, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0xB4CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0x98DE, 0x77E6,
+0x98E6, 0x78E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0x4F9C, 0xF1B4, 0xF5CD, 0xF5CD, 0xF5CD, 0x76DE, 0x97DE, 0x97E6, 0x98E6,
+0xB7E6, 0x98E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0x96DE, 0x97E6, 0x97E6, 0x77E6, 0x77E6, 0x76DE, 0x56DE, 0x77E6, 0x97E6, 0xF5CD,
+0xF5CD, 0xF5CD, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x76DE, 0xF1B4, 0xD4CD, 0x35D6, 0xF5CD, 0xF5CD, 0xF5CD, 0x97DE, 0x97E6, 0xB8E6,
+0x56DE, 0x77E6, 0x77E6, 0x6FA4, 0xD0AC, 0xF1B4, 0xD5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x57DE, 0x57DE, 0x56DE, 0xCD83, 0x94C5,
+0x56DE, 0x76E6, 0x98E6, 0x35D6, 0x56DE, 0x57DE, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x2F94, 0xAD7B, 0xD1AC, 0xF1AC, 0xB0A4, 0x77E6,
+0x77DE, 0x15D6, 0xF1AC, 0xF1AC, 0xD1AC, 0x77DE, 0x97E6, 0x57DE, 0x15D6, 0xF5CD, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x76DE, 0x76DE,
+0x77DE, 0x56DE, 0x57DE, 0x32B5, 0x12B5, 0x11AD, 0x97E6, 0x97E6, 0x76E6, 0x77DE, 0x77DE, 0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x97E6,
+0x98E6, 0x98E6, 0x97E6, 0x98DE, 0x76DE, 0x11B5, 0x8FA4, 0x8FA4, 0x93C5, 0x32B5, 0x32B5, 0x32B5, 0x77DE, 0x97E6, 0x97E6, 0x98E6,
+0x97E6, 0x15D6, 0xF5D5, 0x52BD, 0x32B5, 0x35D6, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x77E6, 0x76DE, 0x36DE,
+0x36D6, 0x15D6, 0x73C5, 0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0x76E6, 0xB8E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x77DE, 0x56DE,
+0x94C5, 0x76DE, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x96E6, 0x98E6, 0x97DE, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0xF5D5, 0x56DE,
+0x52BD, 0x32BD, 0x32B5, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x96E6, 0x98E6, 0x98E6, 0x96DE, 0x8C7B, 0xF5CD, 0x77DE, 0x32B5, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x8C7B, 0xD4D5, 0xD4D5, 0x35D6,
+0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x77DE, 0x97E6, 0x97DE, 0x97DE, 0x76DE, 0xD4CD, 0x52BD, 0x32BD, 0xF5D5,
+0x35D6, 0x32B5, 0x32B5, 0x32BD, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x97E6, 0x77DE, 0x96DE, 0x96DE, 0x36D6, 0x15D6, 0xF5D5,
+0xD4CD, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x77DE, 0x97DE, 0x77E6, 0x77DE, 0x57DE,
+0xF5D5, 0x15D6, 0x32BD, 0x32BD, 0x32B5, 0xB7E6, 0x97E6, 0xB7E6, 0x96DE, 0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x98E6, 0x96E6, 0x97E6,
+0x77E6, 0x15D6, 0x56DE, 0x53BD, 0x53BD, 0x52BD, 0x32BD, 0x32B5, 0xB7E6, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6,
+0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x55DE, 0x15D6, 0xEE8B, 0x15CE, 0xD5CD, 0xB4C5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0xB7E6, 0x97E6,
+0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x77DE, 0x55DE, 0x32B5, 0x93C5, 0x16D6, 0x15CE,
+0xF5CD, 0x56DE, 0x36D6, 0xF5CD, 0x32B5, 0x11B5, 0x32B5, 0x97E6, 0x98E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0xB7E6,
+0x96E6, 0xB7E6, 0xED8B, 0x56DE, 0x55DE, 0xD5CD, 0x36D6, 0x93C5, 0x97E6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x56DE,
+0x56DE, 0x56DE, 0xF1B4, 0xF1AC, 0x12B5, 0x77E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x97E6, 0x96DE,
+0x96DE, 0xEE8B, 0x57DE, 0x56DE, 0x76DE, 0xF5CD, 0xF5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0xD5CD, 0x16D6, 0x16D6, 0x36D6,
+0x97E6, 0x77DE, 0x77DE, 0xF1AC, 0xD1AC, 0xF1AC, 0x98E6, 0x77E6, 0x76E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6,
+0x96E6, 0x96DE, 0x32BD, 0x6FA4, 0x2F94, 0x52B5, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6,
+0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0x96E6, 0x6F9C, 0x2F94, 0xF1AC, 0xF1AC, 0x11AD, 0x98E6, 0x77E6, 0x76DE,
+0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0xF5D5, 0xD4CD, 0x72BD, 0xF5CD, 0x56DE, 0x97E6, 0x97E6,
+0x98E6, 0x76DE, 0x97E6, 0xD4CD, 0xB8E6, 0x98E6, 0x97E6, 0xD8E6, 0x77DE, 0x76DE, 0x36D6, 0x35DE, 0x56DE, 0x77E6, 0xD0AC, 0xD0AC,
+0xD0AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x15D6,
+0xF5D5, 0x15D6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0x36D6, 0x97E6, 0x77DE, 0x97E6, 0x14CE, 0x77DE, 0x97DE, 0x98DE, 0x56DE, 0x56DE,
+0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6,
+0x97E6, 0xB7DE, 0x97DE, 0x56DE, 0x56DE, 0x56DE, 0x76DE, 0x98E6, 0x97E6, 0x98E6, 0x96DE, 0xB8E6, 0x77DE, 0x75DE, 0x56DE, 0x97E6,
+0xB7E6, 0xB8E6, 0x77DE, 0x56DE, 0x56DE, 0xD5CD, 0x11B5, 0x32B5, 0x11AD, 0x98E6, 0x97E6, 0x76E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6,
+0x97E6, 0xB8E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x36DE, 0x36DE, 0x36D6, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x56DE, 0x77DE, 0x96DE,
+0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x6FA4, 0x32BD, 0x98E6, 0x96DE, 0xD4CD, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6,
+0x77E6, 0x76DE, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0x77E6, 0x56DE, 0x57DE, 0x0E94, 0x32B5, 0x35D6, 0x97E6, 0x35D6, 0x56DE,
+0x77DE, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x77E6, 0xB8E6, 0x98E6, 0x77E6, 0x97DE, 0xB8E6,
+0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x76DE, 0x11B5, 0xF1AC, 0xB0A4, 0x56DE, 0x55D6,
+0x55D6, 0x77DE, 0x57DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0xD8E6,
+0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0xB4CD, 0x93C5, 0x15D6, 0x15D6,
+0x98E6, 0x35D6, 0x76DE, 0x36D6, 0x56DE, 0x77DE, 0xB0A4, 0x4F9C, 0x4F9C, 0x97E6, 0xB7E6, 0x97E6, 0xD9E6, 0xD9E6, 0x97E6, 0xD8E6,
+0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB7E6, 0x97E6, 0x97E6, 0x77E6, 0x55DE, 0x97E6, 0x98E6, 0x15D6, 0xF5CD, 0xD4CD, 0x16D6, 0x36D6,
+0x15D6, 0x97E6, 0x97E6, 0x98E6, 0x36D6, 0x56D6, 0x36D6, 0x12B5, 0xD0AC, 0x97DE, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6,
+0x76E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x56E6, 0x77DE, 0x77DE, 0x77DE, 0x36DE, 0x36D6, 0x36D6,
+0x15D6, 0x77DE, 0x97E6, 0x76DE, 0xB0A4, 0x94C5, 0x15D6, 0xD4CD, 0xD4CD, 0xB4CD, 0x97DE, 0x77E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6,
+0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0xB7E6, 0x97E6, 0x96E6, 0x36D6, 0x36D6,
+0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x4F9C, 0x4F9C, 0x2F9C, 0xF5D5, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0xB8E6, 0x97E6, 0xB7E6, 0xD9E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x36D6, 0x36D6, 0xF5D5, 0xF5D5, 0x15D6,
+0x11B5, 0x12B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6,
+0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0x96DE, 0xF5CD, 0xF5D5, 0xF5D5, 0x32B5, 0x12B5, 0xF1B4, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB9E6,
+0x98E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x76DE, 0x56DE, 0x56DE,
+0x12B5, 0x11B5, 0x32B5, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6,
+0xB8E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x35D6, 0x8C7B, 0x52BD, 0x32B5, 0x32B5, 0x96DE, 0x97E6, 0x97E6, 0xB8E6,
+0x98E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0x97DE, 0xB7E6, 0xB7E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0x97E6, 0x76DE, 0x56DE, 0x32B5, 0x32B5, 0x32B5, 0x96E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97DE, 0x97DE,
+0xB8E6, 0xB8E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x77DE, 0x97DE, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0xD5CD, 0x2E94,
+0x53BD, 0x53BD, 0x32B5, 0x96E6, 0x98E6, 0x77DE, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98DE, 0xB6E6, 0x97E6, 0x77DE,
+0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x35DE, 0x35D6, 0x56DE, 0xF5D5, 0xF5D5, 0x35D6, 0x32B5, 0x53BD, 0x53BD, 0x97E6, 0x76E6,
+0x96E6, 0xB8E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x56DE, 0x97E6, 0x97E6, 0x53BD,
+0x53BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x77DE,
+0x97E6, 0x15D6, 0x36D6, 0x52BD, 0x52BD, 0x52BD, 0x97E6, 0x96E6, 0x76DE, 0x98E6, 0x77E6, 0x97E6, 0xB9E6, 0x97E6, 0x97E6, 0xB8E6,
+0x97E6, 0x98E6, 0x76DE, 0x76E6, 0xB8E6, 0x93C5, 0x93C5, 0xD4CD, 0x73BD, 0x73BD, 0x73BD, 0x97DE, 0x97E6, 0x97E6, 0x77DE, 0xB8E6,
+0x77DE, 0xB8E6, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0xB8E6, 0x56DE, 0x56DE, 0x76DE, 0xCD8B, 0xB0AC, 0xB0AC, 0x93C5, 0x93BD, 0x73BD,
+0x97E6, 0x97E6, 0x97DE, 0x76DE, 0xB8E6, 0x77DE, 0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0x97DE, 0x56DE, 0x56DE, 0x35D6, 0x8C7B, 0x93C5,
+0x93BD, 0x93C5, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x76E6, 0xF5D5, 0x36D6,
+0x56DE, 0xB4C5, 0x93C5, 0x93C5, 0x76E6, 0xB7E6, 0x77E6, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x97E6,
+0x11B5, 0x52BD, 0xF5CD, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6,
+0x96DE, 0x0E94, 0x6FA4, 0xF1AC, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x76E6, 0x77DE, 0x76DE, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0xAC83, 0xD4CD, 0xD4C5, 0xD4CD, 0x96E6, 0x96DE, 0x76DE, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x98E6, 0x77DE, 0x76E6,
+0x96E6, 0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0x96DE, 0x98E6, 0x98E6, 0x98DE, 0x77DE, 0x56DE, 0x77DE,
+0x97E6, 0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x96DE, 0x76DE, 0x76DE, 0x15D6, 0x35D6, 0x56DE, 0xF5CD,
+0xD5CD, 0xD5CD, 0x76DE, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x52BD, 0xB4CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD,
+0x97E6, 0x98DE, 0x77E6, 0x98E6, 0x78E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x4F9C, 0xF1B4, 0x52BD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6,
+0x76DE, 0x97DE, 0x77DE, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0xF5CD, 0xF5CD, 0x97E6, 0x96DE, 0x97E6, 0x77E6, 0x77E6,
+0x76DE, 0x56DE, 0x77E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x76DE, 0x77E6, 0xD4CD, 0x35D6, 0xF5CD,
+0xF5CD, 0xF5CD, 0x97DE, 0x97E6, 0xB8E6, 0x56DE, 0x77E6, 0x77E6, 0xCD83, 0x6FA4, 0xD0AC, 0x94C5, 0xD5CD, 0xF5CD, 0x98E6, 0x97E6,
+0x97E6, 0x56DE, 0x57DE, 0x57DE, 0x36D6, 0x56DE, 0x36D6, 0x35D6, 0x35D6, 0xF5D5, 0x36D6, 0x36D6, 0xAD7B, 0xB0A4, 0x6F9C, 0x2F94,
+0x15D6, 0xF1AC, 0xD1AC, 0xF1AC, 0x97E6, 0x77E6, 0x77DE, 0xF5CD, 0xF1AC, 0xF1AC, 0xF1AC, 0x76DE, 0x76DE, 0x76DE, 0x77DE, 0x56DE,
+0x57DE, 0x12B5, 0x11AD, 0x11AD, 0x97E6, 0x97E6, 0x76E6, 0x77DE, 0x77DE, 0x77DE, 0x32B5, 0x93C5, 0x32B5, 0x32B5, 0x32B5, 0x97E6,
+0x98E6, 0xB8E6, 0x98DE, 0x76DE, 0x76DE, 0x8FA4, 0x8FA4, 0x32B5, 0x35D6, 0x32B5, 0x32B5, 0x32B5, 0x77DE, 0x97E6, 0x97E6, 0x98E6,
+0x97E6, 0x97E6, 0xF5D5, 0x52BD, 0x11B5, 0x73C5, 0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x77E6, 0x76DE,
+0x36DE, 0x36D6, 0x36D6, 0x15D6, 0xF5CD, 0x76DE, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0x76E6, 0xB8E6, 0x98E6, 0x76DE, 0x76DE, 0x97E6,
+0x97E6, 0x77DE, 0x56DE, 0xF5D5, 0x56DE, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x96E6, 0x96E6, 0x98E6, 0x97DE, 0x97E6, 0x97DE, 0xB8E6,
+0x97E6, 0x97E6, 0xF5CD, 0x77DE, 0x77DE, 0x52BD, 0x52BD, 0x32BD, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96E6, 0xB8E6, 0x98E6, 0x96DE,
+0x97E6, 0xD4D5, 0x35D6, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0xB0AC,
+0x6FA4, 0x8C7B, 0xF5D5, 0x35D6, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x77DE, 0x97E6, 0x97DE, 0x97DE, 0x76DE,
+0xD4CD, 0x52BD, 0x52BD, 0xD4CD, 0x15D6, 0x15D6, 0x32B5, 0x32B5, 0x32BD, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x97E6, 0x77DE,
+0x96DE, 0x96DE, 0x35DE, 0x36D6, 0x15D6, 0xF5D5, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0xB8E6, 0x77DE, 0x77E6, 0x77DE, 0x57DE, 0x15D6, 0x56DE, 0x32B5, 0x32BD, 0x32BD, 0x97E6, 0xB7E6, 0xB7E6, 0x97DE, 0xB8E6,
+0x96DE, 0x96E6, 0x77DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x55DE, 0x55DE, 0x55DE, 0xEE8B, 0xD5CD, 0xB4C5, 0x53BD, 0x32B5, 0x52BD,
+0x52BD, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x55DE, 0x32B5,
+0x15CE, 0xF5CD, 0x15CE, 0x36D6, 0xF5CD, 0x52BD, 0x11B5, 0x32B5, 0x32B5, 0x98E6, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6,
+0x77E6, 0x98E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0xED8B, 0x56DE, 0x55DE, 0xD5CD, 0x36D6, 0x93C5, 0x97E6, 0x97E6, 0x15D6, 0x15D6,
+0x36D6, 0x36D6, 0x16D6, 0x56DE, 0x56DE, 0x56DE, 0xF1AC, 0x12B5, 0x32B5, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x76DE,
+0x98E6, 0x96E6, 0x97E6, 0xB7E6, 0xB7E6, 0x96E6, 0x57DE, 0x57DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6,
+0xD5CD, 0x16D6, 0x36D6, 0x36D6, 0x77DE, 0x77DE, 0x77DE, 0xD1AC, 0xF1AC, 0xF1B4, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0xB8E6, 0xB8E6,
+0x97E6, 0x97DE, 0x97DE, 0xB8E6, 0x96DE, 0x96E6, 0x97E6, 0x2F94, 0xEE8B, 0x52B5, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xD5CD, 0x97E6,
+0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0x96E6, 0x6F9C, 0x2F94, 0xF1AC, 0x11AD,
+0xF1AC, 0xD1AC, 0x76DE, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x96E6, 0x72BD, 0x32BD,
+0x6FA4, 0xF5CD, 0x56DE, 0x97E6, 0x97E6, 0x98E6, 0x76DE, 0x97E6, 0xD4CD, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x77DE, 0x76DE, 0x36D6,
+0x35DE, 0x56DE, 0x77E6, 0xD0AC, 0xD0AC, 0xD0AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0xB8E6, 0x97E6,
+0x97E6, 0x97DE, 0x98E6, 0x76E6, 0x76DE, 0x15D6, 0xF5D5, 0xD4CD, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0x36D6, 0x36D6, 0x77DE, 0x97E6,
+0x14CE, 0x77DE, 0x97DE, 0x98DE, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0xF5D5, 0x52BD, 0xD0AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6,
+0x98E6, 0x98E6, 0xB8E6, 0xB7E6, 0x97DE, 0x97E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x56DE, 0x15D6, 0xF5D5, 0x97E6, 0x98E6, 0x97E6,
+0x97E6, 0x96DE, 0xB8E6, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0x32B5, 0x11AD, 0xF1AC,
+0x97E6, 0x76E6, 0x97E6, 0xB7E6, 0x98E6, 0x77DE, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB8E6, 0x97E6, 0x36D6, 0x35DE, 0x35DE, 0x73BD,
+0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x56DE, 0x77DE, 0x96DE, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x6FA4, 0x32BD, 0xB4CD,
+0x96DE, 0xD4CD, 0x11B5, 0x97E6, 0x97E6, 0x98E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x56DE,
+0x57DE, 0x36DE, 0x32B5, 0x35D6, 0x97E6, 0x35D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x6F9C,
+0xB0AC, 0x77E6, 0xB8E6, 0x98E6, 0x77E6, 0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE,
+0x77DE, 0x76DE, 0x77E6, 0xF1AC, 0xB0A4, 0x0E94, 0x56DE, 0x56DE, 0x55D6, 0x77DE, 0x57DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x4F9C,
+0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0xD8E6, 0xB8E6, 0x77E6, 0x77E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6,
+0x97E6, 0x97E6, 0x77DE, 0x77DE, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0x15D6, 0x15D6, 0x15D6, 0x98E6, 0x35D6, 0x76DE, 0x36D6, 0x56DE,
+0x77DE, 0xB0A4, 0x4F9C, 0x4F9C, 0x97E6, 0xB7E6, 0x97E6, 0xD9E6, 0x97E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB7E6,
+0x97E6, 0x97E6, 0x77E6, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0xF5CD, 0xD4CD, 0xB4CD, 0x15D6, 0x16D6, 0x36D6, 0x76DE, 0x97E6, 0x97E6,
+0x15D6, 0x36D6, 0x56D6, 0x32BD, 0x12B5, 0xD0AC, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x76E6, 0x97E6, 0x77DE,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x56E6, 0x77DE, 0x55DE, 0x36DE, 0x36DE, 0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x55DE,
+0x77DE, 0x97E6, 0x8FA4, 0xB0A4, 0x94C5, 0xD4CD, 0xD4CD, 0x98E6, 0x97DE, 0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6,
+0x98E6, 0xB8E6, 0x97E6, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0x77E6, 0x77E6, 0x77DE, 0x97E6, 0x96E6, 0x77DE, 0x36D6, 0x36D6, 0x36D6,
+0x36D6, 0x15D6, 0x55DE, 0x2E94, 0x4F9C, 0x4F9C, 0x32B5, 0xF5D5, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xD5CD, 0x36D6, 0xF5D5, 0xF5D5,
+0xF5D5, 0x11B5, 0x12B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x96DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0xB8E6, 0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0x96DE, 0xF5CD, 0x32B5, 0x12B5, 0xF1B4, 0x98E6, 0xB7E6, 0xB7E6, 0xB9E6, 0xB9E6, 0x98E6,
+0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x76DE, 0x56DE, 0x32B5, 0x12B5,
+0x11B5, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0xB8E6,
+0xB8EE, 0xB8E6, 0xB8E6, 0x76DE, 0xB8E6, 0xB8E6, 0x35D6, 0x8C7B, 0x52BD, 0x52BD, 0x32B5, 0x97DE, 0x96DE, 0x97E6, 0x98E6, 0xB8E6,
+0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0x97DE, 0xB7E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0x97E6, 0x76DE, 0x56DE, 0x32B5, 0x32B5, 0x32B5, 0x77DE, 0x96E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x97E6,
+0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0x35DE, 0x77DE, 0x97DE, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0xD5CD,
+0x2E94, 0x53BD, 0x53BD, 0x53BD, 0x76E6, 0x96E6, 0x98E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0x98DE, 0xB6E6, 0xB6E6,
+0x98E6, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x35DE, 0x35D6, 0x56DE, 0xF5D5, 0x35D6, 0xF5D5, 0x53BD, 0x53BD, 0x32B5, 0x97E6,
+0x97E6, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x56DE,
+0x97E6, 0x97E6, 0x52BD, 0x73BD, 0x53BD, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x98E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x77DE, 0xD4CD, 0x15D6, 0x36D6, 0x73BD, 0x53BD, 0x52BD, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77DE,
+0x98E6, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x76E6, 0x11B5, 0x93C5, 0xD4CD, 0x93BD, 0x73BD,
+0x73BD, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x56D6, 0x56DE,
+0x76DE, 0xCD8B, 0xCD8B, 0xB0AC, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6,
+0x97DE, 0x76E6, 0x97DE, 0x97DE, 0x56DE, 0x56DE, 0x56DE, 0x93C5, 0x93C5, 0x93C5, 0xB7E6, 0x77E6, 0x97E6, 0xB8E6, 0x77DE, 0x77DE,
+0x98E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6, 0x52BD, 0xF5CD, 0xF5D5, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x76E6, 0x97E6,
+0x77E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x96DE, 0x96E6, 0x6FA4, 0xF1AC, 0x11B5, 0xB4C5, 0xB4C5, 0xB4C5, 0x96E6, 0x97E6,
+0x97E6, 0x76E6, 0x76E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xAC83, 0x0E94, 0xD4C5, 0xD4CD, 0xD4CD, 0x96DE,
+0x96DE, 0x76DE, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x98E6, 0x77DE, 0x76E6, 0x96E6, 0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0x97DE, 0x98E6,
+0x77DE, 0xB8E6, 0x96DE, 0x98E6, 0x98E6, 0x98DE, 0x77DE, 0x77DE, 0x97E6, 0x97DE, 0xD5CD, 0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97E6,
+0x97E6, 0x98E6, 0x97DE, 0x76DE, 0x76DE, 0x97E6, 0x35D6, 0x56DE, 0x56DE, 0xD5CD, 0xF5CD, 0xD5CD, 0x76DE, 0x76DE, 0x97DE, 0x97DE,
+0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0xB4CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0x97E6, 0x98DE, 0x77E6, 0x98E6, 0x78E6,
+0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x4F9C, 0xF1B4, 0x52BD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x76DE, 0x97DE, 0x77DE, 0x98E6,
+0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x96DE, 0x96DE, 0x97E6, 0x77E6, 0x77E6, 0x76DE,
+0x56DE, 0x77E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xB8E6, 0x76DE, 0x97E6, 0x77E6, 0x97DE, 0x76DE, 0xF1B4, 0xD4CD, 0x35D6, 0xF5CD,
+0xF5CD, 0xF5CD, 0x97E6, 0x97DE, 0x97E6, 0x56DE, 0x56DE, 0x77E6, 0xCD83, 0x6FA4, 0xD0AC, 0x94C5, 0xD5CD, 0x76E6, 0x98E6, 0x97E6,
+0x56DE, 0x57DE, 0x57DE, 0x36D6, 0x56DE, 0x36D6, 0x35D6, 0x35D6, 0xF5D5, 0x6F9C, 0x2F94, 0xAD7B, 0xD1AC, 0xD1AC, 0xF1AC, 0x97E6,
+0x77E6, 0x77DE, 0xF5CD, 0xF1AC, 0xF1AC, 0xF1AC, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x32B5, 0x93C5, 0x12B5,
+0x11AD, 0xF1AC, 0x97E6, 0x76E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x73C5, 0x35D6, 0x35D6, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0xB8E6,
+0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x8FA4, 0x94C5, 0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0xF5CD, 0x76DE, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x96E6, 0x96E6, 0x76DE, 0x77E6, 0x76DE, 0x36DE,
+0x36D6, 0x15D6, 0xF5D5, 0x56DE, 0x56DE, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0x76E6, 0xB8E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6,
+0x77DE, 0x56DE, 0xF5CD, 0x77DE, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x96E6, 0x98E6, 0x97DE, 0x97E6, 0x97DE, 0xB8E6, 0x97E6,
+0x97E6, 0xD4D5, 0x35D6, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96E6, 0xB8E6, 0x98E6, 0x96DE, 0x97E6,
+0xF5D5, 0x35D6, 0x32B5, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x32BD,
+0xB0AC, 0x6FA4, 0xD4CD, 0x15D6, 0x32BD, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x77DE, 0x97E6, 0x96DE, 0x97DE,
+0x97DE, 0xF5D5, 0xD4CD, 0x52BD, 0xF5D5, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6,
+0x97DE, 0x77DE, 0x96DE, 0x35DE, 0x36D6, 0x15D6, 0x15D6, 0x56DE, 0x32BD, 0x32B5, 0x32B5, 0xB7E6, 0x97E6, 0xB7E6, 0x96DE, 0x98E6,
+0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x77DE, 0x77E6, 0x77DE, 0x57DE, 0x55DE, 0x55DE, 0xEE8B, 0xB4C5, 0x53BD, 0x52BD, 0x32BD, 0x32B5,
+0xB7E6, 0xB7E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x96E6, 0x77DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x55DE, 0x32B5,
+0xF5CD, 0x15CE, 0xD5CD, 0xF5CD, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0x56DE, 0x55DE, 0xD5CD, 0x36D6, 0x36D6, 0x98E6, 0x97E6, 0x15D6, 0x15D6, 0x36D6,
+0x16D6, 0x15CE, 0x56DE, 0x56DE, 0x36D6, 0x32B5, 0x11B5, 0x32B5, 0x97E6, 0x98E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6,
+0x77E6, 0x98E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x36D6, 0x57DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0xD5CD,
+0x36D6, 0x36D6, 0x36D6, 0x77DE, 0x77DE, 0x56DE, 0xF1B4, 0xF1AC, 0x12B5, 0x77E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6,
+0xB8E6, 0x76DE, 0x98E6, 0x97E6, 0x96DE, 0xB7E6, 0x52B5, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6,
+0x98E6, 0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x16D6, 0x97E6, 0x96E6, 0x97E6, 0x2F94, 0xF1AC, 0xD1AC, 0xF1AC, 0x98E6, 0x77E6, 0x76E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0x96E6, 0x96DE, 0x96E6, 0x6FA4, 0x2F94, 0xEE8B, 0xF5CD, 0x56DE, 0x97E6,
+0x97E6, 0x98E6, 0x76DE, 0x97E6, 0xD4CD, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xD8E6, 0x76DE, 0x36D6, 0x36D6, 0x56DE, 0x77E6, 0x97E6,
+0xD0AC, 0xD0AC, 0x6F9C, 0xF1AC, 0xF1AC, 0x11AD, 0x98E6, 0x98E6, 0x77E6, 0x77DE, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6,
+0x76DE, 0x97E6, 0x97E6, 0xD4CD, 0x72BD, 0x32BD, 0x76DE, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x36D6, 0x77DE, 0x97E6, 0x14CE, 0x77DE,
+0x97DE, 0x98DE, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0xF5D5, 0x52BD, 0xD0AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x98E6, 0x98E6,
+0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0xF5D5, 0x15D6, 0xF5D5, 0x97E6, 0x98E6, 0x97E6,
+0x97E6, 0x96DE, 0xB8E6, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0x32B5, 0x11AD, 0xF1AC,
+0xF1AC, 0x76E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x56DE, 0x56DE,
+0x56DE, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x56DE, 0x77DE, 0x96DE, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x6FA4,
+0x32BD, 0xB4CD, 0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x77E6, 0x98E6, 0x97E6, 0x97E6,
+0xB7DE, 0xB7DE, 0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x32B5, 0x35D6, 0x56D6, 0x35D6, 0x56DE, 0x97DE, 0x97E6, 0x97E6, 0x98E6, 0xB8E6,
+0xB7E6, 0xB7E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x77E6, 0xB8E6, 0x98E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0xB7E6, 0x97E6,
+0x76DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x0E94, 0x36D6, 0x36D6, 0x56DE, 0x76DE, 0x77DE, 0x57DE,
+0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x77E6, 0x98E6,
+0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x11B5, 0xF1AC, 0xB0A4, 0x36D6, 0x15D6,
+0x15D6, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x36D6, 0x56DE, 0x77DE, 0xB0A4, 0x4F9C, 0x4F9C, 0x97E6, 0xB7E6, 0x97E6, 0xD9E6, 0x97E6,
+0x97E6, 0x77E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xF5CD, 0xD4CD,
+0xB4CD, 0x93C5, 0x36D6, 0x15D6, 0x16D6, 0x97E6, 0x76DE, 0x97E6, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x32BD, 0x12B5, 0xD0AC, 0x97DE,
+0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x56E6,
+0x77DE, 0x55DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0x36D6, 0x36D6, 0x36D6, 0x55DE, 0x55DE, 0x77DE, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5,
+0xD4CD, 0xD4CD, 0x98E6, 0x97DE, 0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x77DE, 0x97DE,
+0x97E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x36D6, 0x15D6, 0x2E94,
+0x2E94, 0x4F9C, 0x32B5, 0xF5D5, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE,
+0x98E6, 0x76DE, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xD5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0xF1B4, 0x11B5, 0x12B5, 0xB7E6,
+0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD8E6, 0x97E6, 0x97E6,
+0x97E6, 0x96DE, 0x11B5, 0x32B5, 0x12B5, 0x76E6, 0x98E6, 0xB7E6, 0x97E6, 0xB9E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6,
+0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x76DE, 0x56DE, 0x32B5, 0x32B5, 0x12B5, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0xB8E6, 0xB8EE, 0xB8E6, 0xB8E6,
+0x76DE, 0xB8E6, 0x97DE, 0x8C7B, 0x8C7B, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6,
+0x97DE, 0x98E6, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0x97DE, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0x76DE, 0x56DE, 0x35D6, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x98E6, 0x77DE, 0x96E6, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6,
+0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x35DE, 0x77DE, 0x97DE, 0x56DE, 0x76DE, 0x76DE,
+0x97E6, 0xD5CD, 0x2E94, 0x53BD, 0x32B5, 0x53BD, 0x53BD, 0x97E6, 0x76E6, 0x96E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6,
+0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x35D6, 0xF5D5, 0x35D6, 0xF5D5, 0x73BD, 0x53BD,
+0x53BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x77DE,
+0x97E6, 0x97E6, 0x36D6, 0x56DE, 0x97E6, 0x53BD, 0x52BD, 0x52BD, 0x97E6, 0x96E6, 0x76DE, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0xD4CD, 0xD4CD, 0x15D6, 0x73BD, 0x73BD, 0x73BD, 0x97DE,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0xB8E6, 0x56DE, 0x76DE, 0x76DE, 0x76DE,
+0xB0AC, 0x11B5, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6,
+0x97DE, 0x97DE, 0xB8E6, 0x56DE, 0x35D6, 0x56D6, 0x8C7B, 0xCD8B, 0xB0AC, 0x93C5, 0x93C5, 0x93C5, 0xB7E6, 0x77E6, 0x97E6, 0xB8E6,
+0x77DE, 0x77DE, 0x76DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x76E6, 0xF5D5, 0x36D6, 0x56DE, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6,
+0x97E6, 0x76E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x97E6, 0x11B5, 0x52BD, 0x52BD, 0xB4C5,
+0xB4C5, 0xB4C5, 0x96E6, 0x97E6, 0x97E6, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0xAC83,
+0x0E94, 0x6FA4, 0xD4C5, 0xD4CD, 0xD4CD, 0x96DE, 0x76DE, 0x97E6, 0x77E6, 0xB8E6, 0x97DE, 0x98E6, 0x77DE, 0x77DE, 0x76DE, 0x96E6,
+0x97E6, 0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x98E6, 0x98E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x97E6,
+0x97DE, 0x76E6, 0xD5CD, 0xD5CD, 0xD4CD, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x56DE,
+0x56DE, 0x77DE, 0xD5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0x76DE, 0x76DE, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0xB4CD,
+0xF5CD, 0x15D6, 0x35D6, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0x97E6, 0x98DE, 0x77E6, 0x98E6, 0x78E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6,
+0x4F9C, 0xF1B4, 0x52BD, 0xB4CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x76DE, 0x97DE, 0x77DE, 0x98E6, 0xB7E6, 0x97E6, 0x97E6,
+0x97E6, 0xED8B, 0xED8B, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x77E6, 0x77E6, 0x76DE, 0x56DE, 0x77E6, 0x97E6,
+0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x77E6, 0x97DE, 0x76DE, 0xD0AC, 0xF1B4, 0xD4CD, 0xD5CD, 0xF5CD, 0xF5CD,
+0x97E6, 0x97E6, 0x97DE, 0x97DE, 0x57DE, 0x56DE, 0x56DE, 0xCD83, 0x6FA4, 0x94C5, 0x36D6, 0x56DE, 0x76E6, 0x35D6, 0x35D6, 0x56DE,
+0x57DE, 0xF5D5, 0x36D6, 0x36D6, 0x35D6, 0xF5D5, 0x6F9C, 0x2F94, 0xAD7B, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x77DE, 0x15D6, 0x32B5,
+0x93C5, 0xF1AC, 0xF1AC, 0xF1AC, 0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x15D6, 0xF5CD, 0x73C5, 0x35D6, 0x11AD, 0xF1AC, 0xF1AC, 0x76E6,
+0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x56DE, 0x56DE, 0x94C5, 0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0xB8E6, 0x97E6, 0x97E6, 0x76DE,
+0x76DE, 0x77DE, 0x77DE, 0xF5CD, 0x76DE, 0x76DE, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98DE,
+0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0xF5D5, 0x56DE, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x77E6, 0x76DE, 0x98E6,
+0x36D6, 0x15D6, 0xF5D5, 0xF5CD, 0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0x76E6, 0xB8E6, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77DE,
+0x56DE, 0x36DE, 0xD4D5, 0x35D6, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x96E6, 0x98E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x97E6,
+0x97E6, 0x97E6, 0xF5D5, 0x35D6, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96E6, 0xB8E6, 0x98E6, 0x96DE,
+0x96DE, 0x97E6, 0xD4CD, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x76DE, 0x97E6,
+0x97E6, 0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0xF5D5, 0x15D6, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6,
+0x98E6, 0x77DE, 0x96DE, 0x97DE, 0x97DE, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0x15D6, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xB8E6,
+0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x35DE, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0xEE8B, 0x53BD,
+0x32B5, 0x32BD, 0x32BD, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0x96DE, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x77E6, 0x77DE,
+0x57DE, 0x77DE, 0x55DE, 0x32B5, 0x15CE, 0xD5CD, 0xB4C5, 0x52BD, 0x32B5, 0x52BD, 0x32BD, 0xB8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6,
+0x97DE, 0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0xED8B, 0x56DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x98E6,
+0x97E6, 0x15D6, 0x15D6, 0x16D6, 0x15CE, 0xF5CD, 0x56DE, 0x36D6, 0x36D6, 0xF5CD, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0xB7E6, 0x97E6,
+0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x77DE,
+0xF5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x77DE, 0x56DE, 0x56DE, 0xF1AC, 0x12B5,
+0x32B5, 0x11B5, 0x77E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0x96E6, 0x97E6, 0xB7E6, 0x96E6, 0xB7E6, 0x97E6,
+0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x96DE, 0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x16D6,
+0x16D6, 0x96E6, 0x97E6, 0x77DE, 0xD1AC, 0xF1AC, 0xF1B4, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0x97DE,
+0xB8E6, 0x76DE, 0x96E6, 0x97E6, 0x96DE, 0xEE8B, 0xF5CD, 0x56DE, 0x97E6, 0x97E6, 0x98E6, 0x76DE, 0x97E6, 0xD4CD, 0xD4CD, 0x97E6,
+0x98E6, 0x97E6, 0xD8E6, 0x76DE, 0x36D6, 0x36D6, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0xD0AC, 0x6F9C, 0x2F94, 0xF1AC, 0x11AD, 0xF1AC,
+0x77E6, 0x77E6, 0x76DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x32BD, 0x6FA4,
+0x2F94, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x97DE, 0x98DE, 0x77DE, 0x56DE,
+0x56DE, 0x35DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x98E6, 0x98E6, 0x97E6, 0xB7E6, 0x97E6, 0x77DE,
+0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6, 0x76DE, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE,
+0xB8E6, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x11AD, 0xF1AC, 0xF1AC, 0x76E6,
+0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x56DE, 0x15D6, 0xF5D5,
+0xF5D5, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x56DE, 0x77DE, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x6FA4,
+0x32BD, 0xB4CD, 0xD5CD, 0xD4CD, 0x11B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6,
+0xB7DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x36DE, 0x36D6, 0x35DE, 0x32B5, 0x35D6, 0x56D6, 0x35D6, 0x56DE, 0x97DE, 0x97DE, 0x97E6, 0x98E6,
+0xB8E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0xB7E6,
+0x77E6, 0x76DE, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x56DE, 0x57DE, 0x36DE, 0x15D6, 0x36D6, 0x56DE, 0x76DE, 0x77DE,
+0x57DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x76DE, 0xD8E6, 0x77E6, 0x77E6,
+0x98E6, 0x97DE, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0xF1AC, 0xB0A4, 0x0E94,
+0x16D6, 0x36D6, 0x15D6, 0x15D6, 0x97E6, 0x98E6, 0x35D6, 0x56D6, 0x36D6, 0x56DE, 0x77DE, 0xB0A4, 0x4F9C, 0x4F9C, 0x97E6, 0xB7E6,
+0x97E6, 0xD9E6, 0x97E6, 0x77E6, 0x77E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6,
+0x97E6, 0x77DE, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0x36D6, 0x36D6, 0x15D6, 0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x94C5, 0x15D6, 0x36D6,
+0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x76E6, 0x97E6, 0xD8E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77DE, 0x55DE, 0x97E6, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0x36D6, 0x36D6, 0x36D6, 0x15D6,
+0x55DE, 0x55DE, 0x77DE, 0x2F9C, 0x8FA4, 0xB0A4, 0xD4CD, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6,
+0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x77DE, 0x77DE, 0xD5CD,
+0x36D6, 0x36D6, 0xF5D5, 0x15D6, 0x36D6, 0x2E94, 0x2E94, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0xF5CD,
+0xF5D5, 0xF5D5, 0x12B5, 0xF1B4, 0x11B5, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6,
+0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x12B5, 0x11B5, 0x32B5, 0x97E6, 0x76E6, 0x98E6,
+0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x96E6, 0x97E6,
+0x97DE, 0x97E6, 0x56DE, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6,
+0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x32B5,
+0x32B5, 0x32B5, 0x96E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0xB8E6, 0x97E6, 0xB8E6,
+0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x56DE, 0x35D6, 0x53BD, 0x53BD,
+0x53BD, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6,
+0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x35DE, 0x77DE, 0x97DE, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0xD5CD, 0x2E94, 0x53BD,
+0x53BD, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6,
+0x98E6, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x35D6, 0xF5D5, 0x35D6, 0xF5D5, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x76DE, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x77E6, 0x77DE, 0x97E6, 0x15D6,
+0x36D6, 0x56DE, 0x73BD, 0x73BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x98E6, 0x77E6, 0x77DE, 0xB9E6, 0x97E6, 0x97E6,
+0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x76E6, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x93C5, 0x93BD, 0x73BD, 0x97E6, 0x97E6, 0x97DE,
+0x97E6, 0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x56D6, 0x56DE, 0x76DE, 0xCD8B, 0xB0AC,
+0xB0AC, 0x11B5, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0xB8E6,
+0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0x56DE, 0x56DE, 0x35D6, 0x8C7B, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x97E6, 0x76E6, 0xB7E6, 0x77E6,
+0x98E6, 0xB8E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0xB4C5, 0xB4C5, 0xB4C5,
+0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x96DE, 0x96E6, 0x6FA4, 0xF1AC,
+0x11B5, 0xD4C5, 0xD4CD, 0xD4CD, 0x96DE, 0x76DE, 0x97E6, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0xAC83, 0x0E94, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0x77DE,
+0x97DE, 0x98E6, 0x97DE, 0x76E6, 0x96E6, 0xD5CD, 0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x97DE, 0xB8E6, 0x76DE,
+0x97E6, 0x98E6, 0x98E6, 0x56DE, 0x56DE, 0x77DE, 0xD5CD, 0xF5CD, 0xD5CD, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6,
+0x97E6, 0x98E6, 0x96DE, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0xF5CD, 0xF5CD, 0xD5CD, 0x97E6, 0x98DE, 0x77E6, 0xB7E6, 0x98E6, 0x78E6,
+0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x4F9C, 0xF1B4, 0x52BD, 0xB4CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x76DE, 0x76DE,
+0x77DE, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0xF5CD, 0xF5CD, 0xF5CD, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x76DE, 0x77E6,
+0x77E6, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x77E6, 0x77E6, 0x97DE, 0xD0AC,
+0xF1B4, 0xD4CD, 0x94C5, 0xD5CD, 0xF5CD, 0x98E6, 0x97E6, 0x97E6, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0xCD83, 0x6FA4, 0x36D6, 0x56DE,
+0x76E6, 0x35D6, 0x35D6, 0x56DE, 0xF5D5, 0x36D6, 0x36D6, 0xAD7B, 0x32B5, 0x93C5, 0xB0A4, 0x6F9C, 0x2F94, 0x15D6, 0x73C5, 0x35D6,
+0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0x97E6, 0x77E6, 0x77E6, 0x15D6, 0xF5CD, 0x94C5, 0x94C5, 0x77DE, 0xF1AC, 0xF1AC, 0xF1AC, 0x76E6,
+0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0x57DE, 0xF5CD, 0x76DE, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0xB8E6, 0x97E6, 0x97E6, 0x76DE,
+0x77DE, 0x77DE, 0x77DE, 0xF5D5, 0x56DE, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x98DE, 0x76DE, 0x11B5,
+0x8FA4, 0x8FA4, 0xF5CD, 0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x96E6, 0x77DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x15D6,
+0xF5D5, 0x52BD, 0x11B5, 0xD4D5, 0x35D6, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0x76E6, 0xB8E6, 0x97E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6,
+0x56DE, 0x36DE, 0x36D6, 0xF5D5, 0x35D6, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x96E6, 0x98E6, 0x97DE, 0x97E6, 0x97DE, 0x97DE,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xD4CD, 0x15D6, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x96E6,
+0xB8E6, 0x98E6, 0x96DE, 0x97E6, 0xF5D5, 0xF5D5, 0x56DE, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6,
+0x76DE, 0x77DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x8C7B, 0x15D6, 0x15D6, 0x32B5, 0x32B5, 0x32BD, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x96DE, 0x97DE, 0x97DE, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0x55DE, 0x55DE, 0xEE8B,
+0x32BD, 0x32B5, 0x32B5, 0x32B5, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x35DE,
+0x36D6, 0x15D6, 0x77DE, 0x55DE, 0x32B5, 0x93C5, 0xD5CD, 0xB4C5, 0x53BD, 0x32BD, 0x32B5, 0x32BD, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6,
+0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0xED8B, 0x56DE, 0x76DE, 0xD5CD, 0x36D6,
+0x98E6, 0x97E6, 0x15D6, 0x15CE, 0xF5CD, 0x15CE, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x77E6, 0xB8E6,
+0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x52B5, 0x36D6, 0x57DE, 0x56DE,
+0x77DE, 0xF5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x56DE, 0x56DE, 0x56DE, 0x32B5,
+0x11B5, 0x32B5, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x77E6, 0x98E6, 0xB7E6, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x53BD, 0x16D6,
+0x16D6, 0x16D6, 0x96E6, 0x97E6, 0x77DE, 0x77DE, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x77E6, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0x97E6,
+0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x96DE, 0xB7E6, 0x96E6, 0xF5CD, 0x56DE, 0xB8E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6,
+0xD4CD, 0xB8E6, 0x98E6, 0x97E6, 0xD8E6, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x77E6, 0x97E6, 0x97E6, 0xD0AC, 0x6F9C, 0x2F94, 0x11AD,
+0xF1AC, 0xD1AC, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97DE, 0x97DE, 0x96E6, 0x96DE, 0x96E6,
+0x97E6, 0x2F94, 0xEE8B, 0x56DE, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x97DE, 0x98DE, 0x77DE,
+0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x98E6, 0x97E6, 0x98E6, 0x77E6,
+0x77DE, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x96DE, 0x76DE, 0x97E6, 0x97E6, 0xD4CD, 0x72BD, 0x32BD, 0x6FA4, 0x73BD, 0x97E6,
+0x98E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5,
+0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6,
+0x98E6, 0x76E6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x56DE, 0x77DE, 0x97E6, 0xB8E6, 0x98E6,
+0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x32BD, 0xB4CD, 0xD5CD, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0x98E6, 0x97E6, 0x76E6, 0x97E6,
+0xB7E6, 0x98E6, 0x77DE, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0xB7DE, 0x35DE, 0x35DE, 0x56DE, 0x56DE, 0x32B5, 0x55D6,
+0x56D6, 0x35D6, 0x56DE, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0xB8E6, 0x98E6,
+0x96DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7DE,
+0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x15D6, 0x15D6, 0x36D6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x4F9C,
+0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB8E6, 0x98E6,
+0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0xB0A4, 0x0E94, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x97E6, 0x97E6,
+0x98E6, 0x35D6, 0x56D6, 0x36D6, 0x56DE, 0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0x97E6, 0xB7E6, 0x97E6, 0xD9E6, 0x97E6, 0x77E6, 0x97E6,
+0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x93C5,
+0x11B5, 0xF1AC, 0x36D6, 0x36D6, 0x36D6, 0x55DE, 0x77DE, 0x97E6, 0x76DE, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0xB4CD, 0x32BD, 0x12B5,
+0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x76E6, 0x97E6, 0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6,
+0x97E6, 0x97E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6,
+0x55DE, 0x55DE, 0x4F9C, 0x2F9C, 0x8FA4, 0xD4CD, 0x97E6, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6,
+0x98E6, 0xB8E6, 0x97E6, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0xD5CD,
+0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x2E94, 0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0xB8E6, 0x97E6, 0x77E6, 0xB7E6, 0xB7E6, 0x97E6, 0x96E6, 0xF5CD,
+0xF5D5, 0x32B5, 0x12B5, 0xF1B4, 0x11B5, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0xD9E6, 0xD8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0x96DE, 0xB8E6, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x97E6, 0x97E6,
+0x76E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6,
+0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x56DE, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x96DE, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6,
+0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x76DE, 0xB8E6,
+0x97DE, 0x76DE, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6,
+0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE,
+0x56DE, 0x35D6, 0x8C7B, 0x32B5, 0x53BD, 0x53BD, 0x53BD, 0x97E6, 0x76E6, 0x96E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0x97E6,
+0xB8E6, 0x98DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0x35DE, 0x77DE, 0x97DE, 0x97E6,
+0x76DE, 0x76DE, 0x76DE, 0x97E6, 0xD5CD, 0x2E94, 0x73BD, 0x73BD, 0x53BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6,
+0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x35D6, 0xF5D5, 0x35D6, 0xF5D5, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x97E6, 0x96E6, 0x76DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6,
+0x97E6, 0x76DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x15D6, 0x15D6, 0x36D6, 0x93C5, 0x93BD, 0x73BD,
+0x73BD, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6,
+0x76DE, 0x76DE, 0x76DE, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x76DE,
+0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0x97DE, 0xB8E6, 0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x8C7B, 0xCD8B, 0xB0AC,
+0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0xB8E6, 0x77DE, 0x77DE, 0x98E6, 0x98E6, 0x97DE, 0xB8E6, 0x97E6,
+0xB7E6, 0xB7E6, 0x76E6, 0xF5D5, 0x36D6, 0x56DE, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6,
+0x77E6, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x96DE, 0x96E6, 0x97E6, 0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xD4CD, 0xD4CD, 0xB4C5, 0x76DE,
+0x76DE, 0x97E6, 0x96E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xAC83, 0x0E94,
+0x6FA4, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0x77DE, 0x97DE, 0x98E6, 0x77DE,
+0x76E6, 0x96E6, 0x97E6, 0xD5CD, 0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x97DE, 0xB8E6, 0x76DE, 0x97E6, 0x98E6,
+0x98DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0x76DE, 0x76DE, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6,
+0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x15D6, 0x35D6, 0x56DE, 0xF5CD, 0xF5CD, 0xF5CD, 0x97DE, 0x97E6, 0x98DE, 0x77E6, 0x98E6, 0x78E6,
+0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF1B4, 0x52BD, 0x52BD, 0xB4CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x76DE,
+0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0xF5CD, 0xF5CD, 0xF5CD, 0x76DE, 0x97E6, 0x97E6, 0x96DE,
+0x76DE, 0x76DE, 0x77E6, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97DE, 0x97DE, 0x97E6, 0x56DE, 0x56DE,
+0x77E6, 0x77E6, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x94C5, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x56DE, 0x57DE, 0x57DE, 0xCD83, 0x36D6,
+0x36D6, 0x36D6, 0x35D6, 0x35D6, 0xF5D5, 0x36D6, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x6F9C, 0x2F94, 0x2F94, 0xAD7B, 0x94C5, 0x77DE,
+0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0x97E6, 0x77E6, 0x77DE, 0x15D6, 0xF5CD, 0x76DE, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x76DE, 0x76DE,
+0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0xF5D5, 0x56DE, 0x32B5, 0x32B5, 0x12B5, 0x11AD, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x77DE,
+0x77DE, 0x77DE, 0xF5CD, 0x35D6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98DE, 0x76DE, 0x76DE, 0x77DE,
+0x8FA4, 0xD4D5, 0x35D6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x15D6,
+0xF5D5, 0x52BD, 0x11B5, 0xF5D5, 0x35D6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x76E6, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x76DE,
+0x77DE, 0x56DE, 0x36DE, 0x36D6, 0xD4CD, 0x15D6, 0x15D6, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x97DE,
+0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0xF5D5, 0x56DE, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x15D6, 0x15D6, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6,
+0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x8C7B, 0x55DE, 0x55DE, 0xEE8B,
+0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x96DE, 0x96DE, 0x97DE, 0x97DE, 0xF5D5,
+0xD4CD, 0x52BD, 0x32BD, 0x56DE, 0x55DE, 0x32B5, 0x93C5, 0x53BD, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x77DE, 0x97DE, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x36D6, 0xED8B, 0x56DE, 0x76DE, 0xD5CD, 0x36D6,
+0x98E6, 0x97E6, 0x15D6, 0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xF5CD, 0x52BD, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0xB7E6, 0xB7E6, 0x97E6,
+0xB7E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x77DE, 0x76DE, 0x98E6, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x52B5, 0x36D6, 0x57DE,
+0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x15D6, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x16D6, 0x56DE, 0x56DE, 0x56DE,
+0x36D6, 0x32B5, 0x32B5, 0x32B5, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6,
+0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x97E6, 0x77DE, 0x77DE, 0x56DE, 0xF1AC, 0x12B5, 0x32B5, 0x11B5, 0x77E6, 0x97E6,
+0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0xF5CD, 0x56DE, 0x97E6,
+0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x97E6,
+0x97E6, 0x96E6, 0x6F9C, 0x2F94, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1AC, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6,
+0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x97E6, 0x96DE, 0xB7E6, 0x56DE, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x77DE, 0x97E6, 0x14CE,
+0x97E6, 0x97DE, 0x98DE, 0x77DE, 0x76DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0xD0AC, 0xD0AC, 0xD0AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0x97E6, 0x98E6, 0x77E6, 0x76DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97E6, 0x96E6, 0x96DE, 0x96E6,
+0x6FA4, 0x2F94, 0xEE8B, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0xB7E6, 0xB8E6,
+0x56DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0xF5D5, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6,
+0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0xF5D5, 0xD4CD, 0x72BD, 0x32BD, 0x35D6, 0x97E6, 0x98E6,
+0x56DE, 0x77DE, 0x56DE, 0x77DE, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x32BD, 0xB4CD, 0xD5CD, 0x11B5,
+0x32B5, 0x11AD, 0xF1AC, 0x97E6, 0x76E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xB7DE,
+0x97DE, 0x98E6, 0x56DE, 0x56DE, 0x15D6, 0xF5D5, 0x32B5, 0x55D6, 0x56D6, 0x56D6, 0x35D6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6,
+0xB7E6, 0xB7E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0xB7E6, 0x77E6,
+0xB8E6, 0xB7E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7DE, 0xB7DE, 0xB8E6, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x15D6, 0x15D6, 0x15D6,
+0x36D6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6,
+0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0xB8E6,
+0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x36D6, 0x56D6, 0x36D6, 0x56DE,
+0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0x77E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6,
+0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0x36D6,
+0x36D6, 0x36D6, 0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xB8E6, 0x97DE,
+0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6,
+0x77E6, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x36D6, 0x15D6,
+0x55DE, 0x2E94, 0x4F9C, 0x2F9C, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6,
+0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x56E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD,
+0xF5D5, 0xF5D5, 0xF5D5, 0x11B5, 0x12B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x97E6, 0xB7E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x11B5, 0x32B5,
+0x12B5, 0xF1B4, 0x98E6, 0xB7E6, 0xB7E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0xD9E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x97E6, 0x97E6, 0x97E6,
+0x76E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0xB8E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6,
+0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x56DE, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6,
+0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6,
+0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x53BD, 0x53BD, 0x32B5, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6,
+0x97DE, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0x97E6,
+0xB8E6, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x97E6, 0x97E6, 0x76E6, 0x76E6, 0x77E6, 0xB8E6,
+0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x98E6, 0xB8E6,
+0x97E6, 0x35DE, 0x77DE, 0x97DE, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x2E94, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x96E6, 0x76DE,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6,
+0x98E6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x35D6, 0xF5D5, 0x35D6, 0xF5D5, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x97DE, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x77DE, 0xB9E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0xB8E6, 0x77E6,
+0x77DE, 0xD4CD, 0x15D6, 0x36D6, 0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x76DE, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0x97DE,
+0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0xB0AC, 0x11B5, 0x11B5, 0x93C5, 0xB4C5,
+0x93C5, 0x93C5, 0x93C5, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x76E6,
+0x97DE, 0x97DE, 0x56DE, 0x56DE, 0x56DE, 0x35D6, 0x8C7B, 0xCD8B, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x97E6, 0x76E6,
+0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x52BD, 0xF5CD, 0xF5D5, 0xD4C5,
+0xD4CD, 0xD4CD, 0xB4C5, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6,
+0xB8E6, 0x98E6, 0x96DE, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0x77DE, 0x96E6, 0x96DE, 0x98E6, 0x76DE,
+0x76DE, 0x77E6, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0xAC83, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0x97DE,
+0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x97E6, 0x98E6, 0x98DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0xD5CD, 0xD5CD,
+0xD5CD, 0xF5CD, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x15D6, 0x35D6,
+0x56DE, 0x56DE, 0xF5CD, 0xF5CD, 0xF5CD, 0x76DE, 0x97DE, 0x97E6, 0x98DE, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0xF1B4, 0x52BD, 0xB4CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x98E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0x4F9C, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x76DE,
+0x77E6, 0x77E6, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x56DE, 0x56DE,
+0x77E6, 0x77E6, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x36D6, 0xF5D5,
+0x36D6, 0x36D6, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0x2F94, 0xAD7B, 0xF5CD, 0x76DE, 0x56DE, 0xD1AC, 0xF1AC, 0xB0A4,
+0x6F9C, 0x77DE, 0x15D6, 0xF5D5, 0x77DE, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x15D6, 0xF5CD, 0xF5CD,
+0x35D6, 0x32B5, 0x12B5, 0x11AD, 0xF1AC, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0xD4D5, 0x35D6, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x76DE, 0x77DE, 0x8FA4, 0xF5D5, 0x35D6, 0x15D6, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x96E6, 0x96E6, 0x77DE, 0x97E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0xD4CD,
+0x15D6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0x76E6, 0xB8E6, 0x97E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x56DE, 0x36DE, 0x36D6,
+0x15D6, 0xF5D5, 0x56DE, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x97E6,
+0x97E6, 0x97E6, 0x77DE, 0x15D6, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x96E6,
+0xB8E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x55DE, 0x55DE, 0x55DE, 0xEE8B, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0xB8E6,
+0x97E6, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x8C7B, 0x56DE, 0x55DE, 0x32B5, 0x93C5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x96DE, 0x96DE, 0x97DE, 0x97DE,
+0xF5D5, 0xD4CD, 0xD4CD, 0x52BD, 0xED8B, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0x97E6, 0x15D6, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5,
+0x52BD, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x77DE, 0x77DE,
+0x97DE, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x15D6,
+0x36D6, 0x36D6, 0x16D6, 0x15CE, 0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6,
+0xB8E6, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x97E6, 0x96DE, 0x77DE, 0x56DE,
+0x77DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x77DE, 0x77DE,
+0x56DE, 0x56DE, 0x32B5, 0x11B5, 0x32B5, 0x32B5, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0x77E6, 0x98E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF5CD, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0x98E6,
+0x97E6, 0xD8E6, 0x98E6, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x2F94, 0xF1AC, 0xF1AC, 0xF1B4, 0xF1AC,
+0x76E6, 0x77E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0xB7E6, 0x96E6, 0xB7E6, 0xB8E6,
+0x56DE, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x97DE, 0x98DE, 0x77DE, 0x76DE, 0x56DE, 0x35DE,
+0x56DE, 0x77E6, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xEE8B, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x97E6,
+0x96DE, 0xB8E6, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0x36DE, 0xF5D5, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF1AC, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x96DE, 0x76DE, 0x97E6,
+0x97E6, 0x96E6, 0x72BD, 0x32BD, 0x6FA4, 0x2F94, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x56DE, 0x77DE, 0x56DE, 0x77DE, 0x97E6, 0xB8E6,
+0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x32BD, 0xB4CD, 0xD5CD, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0x97E6,
+0x97E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0xF5D5, 0x15D6, 0xF5D5,
+0xF5D5, 0x56DE, 0x55D6, 0x55D6, 0x56D6, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x6F9C, 0xB0AC,
+0x6FA4, 0x32BD, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6,
+0xB8E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x98E6, 0x35D6,
+0x76DE, 0x77DE, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0xD8E6,
+0x77E6, 0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x97E6, 0x76DE, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x56DE,
+0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x12B5,
+0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6,
+0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0xF1AC, 0xB0A4, 0x0E94, 0x36D6,
+0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x77DE, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xB8E6,
+0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x97E6,
+0x97E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xD5CD, 0x36D6, 0xF5D5, 0xF5D5, 0x15D6,
+0x36D6, 0x2E94, 0x4F9C, 0x97E6, 0x98E6, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0xB8E6,
+0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0xF5CD,
+0xF5D5, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6,
+0xB7E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x12B5, 0x11B5, 0x32B5,
+0x12B5, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0xD9E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0x97E6, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6,
+0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x56DE, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6,
+0x98E6, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0x96E6,
+0xB8EE, 0xB8E6, 0xB8E6, 0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0x53BD, 0x32B5, 0x53BD, 0x53BD, 0x53BD, 0x76E6, 0x96E6, 0x98E6,
+0x77DE, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x98E6,
+0x97E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0x52BD, 0x73BD, 0x53BD,
+0x53BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x77E6, 0x97E6,
+0x98DE, 0xB6E6, 0x98E6, 0x77DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x35DE, 0x77DE, 0x97DE, 0x97E6, 0x76DE, 0x76DE,
+0x97E6, 0x76DE, 0x2E94, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x97E6, 0x96E6, 0x76DE, 0x76DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6,
+0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x36D6, 0x56DE, 0x97E6, 0x97E6,
+0x35D6, 0x56DE, 0xF5D5, 0x35D6, 0xF5D5, 0xF5D5, 0x93C5, 0x93C5, 0x93BD, 0x93BD, 0x73BD, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6,
+0x77DE, 0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x93C5,
+0xD4CD, 0xD4CD, 0x15D6, 0xB4C5, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE,
+0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5,
+0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x76DE, 0x98E6, 0x97DE,
+0xB8E6, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0xF5D5, 0x36D6, 0x56DE, 0x56DE, 0x8C7B, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0x97E6,
+0x96E6, 0x97E6, 0x97E6, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0xF1AC,
+0x11B5, 0x52BD, 0xF5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x76DE, 0x77E6, 0xB8E6, 0x97DE,
+0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xAC83, 0x0E94, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0x97DE,
+0x97E6, 0x97DE, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x98E6, 0x98DE, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0x97DE, 0x76E6, 0xF5CD,
+0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE,
+0x15D6, 0x35D6, 0x56DE, 0x56DE, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97DE, 0x97E6, 0x98DE, 0x98DE, 0xB7E6, 0x98E6, 0x78E6,
+0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF1B4, 0x52BD, 0xB4CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x96DE,
+0x97E6, 0x97E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0x4F9C, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD,
+0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x77E6, 0x97DE, 0x76DE, 0x77E6, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0x94C5, 0xD5CD, 0x76E6,
+0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0x36D6, 0x56DE, 0x76E6, 0x35D6,
+0x35D6, 0x56DE, 0x57DE, 0xF5D5, 0x36D6, 0x36D6, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x76DE, 0xF5CD, 0x56DE, 0xF5D5, 0x77DE,
+0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0xF5CD, 0x35D6, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0x15D6,
+0xD4D5, 0xD4D5, 0x35D6, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6,
+0xF5D5, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE,
+0xD4CD, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x52BD,
+0x11B5, 0x8FA4, 0x8FA4, 0xF5D5, 0x56DE, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE,
+0x77E6, 0x76DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x96E6,
+0x98E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x77DE, 0x55DE, 0xEE8B, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x56DE,
+0x55DE, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x76DE,
+0x97E6, 0x97E6, 0x98E6, 0xB0AC, 0xB0AC, 0x6FA4, 0x8C7B, 0xED8B, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0x97E6, 0x15D6, 0xD5CD,
+0xB4C5, 0x53BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6,
+0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x15D6, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6,
+0x98E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0xD5CD, 0x36D6, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0x36D6, 0xF5CD, 0x52BD, 0x52BD, 0x32BD,
+0x32B5, 0x32BD, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x97DE,
+0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x96DE, 0x77DE, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6,
+0x98E6, 0x96DE, 0x53BD, 0x16D6, 0x36D6, 0x36D6, 0x36D6, 0x77DE, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x96E6,
+0x97E6, 0x77E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE,
+0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0xF1B4, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x98E6, 0x77E6, 0x97E6,
+0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x56DE,
+0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x97DE, 0x98DE, 0x77DE, 0x76DE, 0x36D6, 0x35DE, 0x56DE,
+0x77E6, 0x97E6, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0xF1AC, 0x11AD, 0xF1AC, 0xD1AC, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x96DE, 0xB7E6, 0x96E6, 0xB7E6, 0x73BD, 0x97E6, 0x98E6, 0x97E6,
+0x97E6, 0x96DE, 0xB8E6, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x52BD,
+0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x98E6,
+0x97DE, 0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x2F94, 0xEE8B, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x56DE, 0x77DE, 0x56DE, 0x77DE,
+0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0xB4CD, 0xD5CD, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6, 0x76DE,
+0x97E6, 0x97E6, 0xD4CD, 0x72BD, 0x32BD, 0x6FA4, 0x36D6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6,
+0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x6F9C, 0xB0AC, 0x6FA4, 0x32BD, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x97E6, 0x97E6, 0x98E6, 0x97E6,
+0x76E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x56DE, 0x56DE,
+0x15D6, 0xF5D5, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x15D6, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x77DE, 0x56DE, 0x77DE, 0x97E6, 0x97E6,
+0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0xD8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6,
+0xB7E6, 0x77E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7DE, 0xB8E6, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x36D6,
+0x36D6, 0x36D6, 0x15D6, 0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x12B5, 0xD0AC, 0xB0A4, 0x4F9C,
+0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6,
+0xB8E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x0E94, 0xD5CD, 0x36D6, 0x36D6, 0x36D6,
+0x36D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x4F9C, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0xD4CD, 0xB4CD, 0x32BD, 0x77E6, 0xB8E6, 0x97DE,
+0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97E6,
+0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5,
+0x15D6, 0x2E94, 0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0xB8E6,
+0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD,
+0xB4CD, 0xF5CD, 0x32B5, 0x12B5, 0xF1B4, 0x11B5, 0x12B5, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x96E6, 0x77DE, 0x77DE,
+0x36DE, 0x15D6, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6,
+0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6,
+0x97E6, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE,
+0xB8E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6,
+0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97DE,
+0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77E6, 0x77E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6,
+0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0xB8E6, 0x98E6, 0xB8E6,
+0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97E6,
+0xB7E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0x53BD, 0x52BD, 0x52BD, 0x73BD, 0x96E6,
+0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6,
+0x98DE, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x35DE, 0x77DE, 0x97DE, 0x56DE, 0x76DE, 0x76DE,
+0x97E6, 0x76DE, 0x2E94, 0x93C5, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0x98E6, 0x98E6,
+0x77E6, 0x77DE, 0xB9E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x15D6, 0x36D6,
+0x56DE, 0x97E6, 0x97E6, 0x35D6, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x76DE, 0x76DE, 0x76DE,
+0x97E6, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x56DE, 0x76DE,
+0x76DE, 0x76DE, 0x76E6, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6,
+0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0x56DE, 0x56DE, 0x35D6,
+0x56D6, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x76E6, 0x77DE,
+0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6,
+0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x98E6, 0x77DE, 0x76DE,
+0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0x97E6,
+0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x98E6, 0x97DE, 0x76E6, 0x96E6,
+0x97E6, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE,
+0x76DE, 0x76DE, 0x97E6, 0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x76DE, 0x97DE, 0x97E6,
+0x98DE, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x52BD, 0xB4CD, 0xB4CD, 0xF5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0xED8B, 0x4F9C, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x77E6, 0x77E6, 0x77E6, 0x97DE, 0x76DE,
+0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x94C5, 0xD5CD, 0x76E6, 0x98E6, 0x98E6, 0x97E6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0xCD83, 0x6FA4,
+0xD0AC, 0x36D6, 0x36D6, 0x36D6, 0x35D6, 0x35D6, 0xF5D5, 0x32B5, 0x35D6, 0x73C5, 0x77DE, 0x94C5, 0x76DE, 0xF5CD, 0x56DE, 0xF5D5,
+0x77DE, 0xD4D5, 0x35D6, 0x6F9C, 0x2F94, 0xAD7B, 0xD4D5, 0x35D6, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0x97E6, 0x77E6, 0x77DE,
+0x15D6, 0xF5D5, 0x15D6, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD,
+0xD4CD, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x77DE, 0x77DE, 0x77DE, 0x77DE,
+0xF5D5, 0x56DE, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98DE, 0x76DE,
+0x76DE, 0x8FA4, 0x8FA4, 0x55DE, 0x15D6, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE,
+0x77E6, 0x76DE, 0x98E6, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5, 0x77DE, 0x55DE, 0xEE8B, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32B5,
+0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x56DE, 0x55DE,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE,
+0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0xED8B, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0x97E6, 0x15D6, 0xB4C5, 0x53BD, 0x32B5, 0x32B5,
+0x32BD, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x77DE, 0x97E6, 0x76DE, 0x76DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6,
+0x98E6, 0xB0AC, 0x6FA4, 0x8C7B, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6,
+0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xF5CD, 0x52BD, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97DE, 0x77DE, 0x98E6, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x15D6, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xF5CD, 0x56DE,
+0x97E6, 0x96DE, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0x53BD, 0x36D6, 0x36D6, 0x36D6,
+0x36D6, 0x16D6, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32BD, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6,
+0xB7E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x76DE,
+0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x36D6, 0x16D6, 0x16D6,
+0x16D6, 0x16D6, 0x96E6, 0x97E6, 0x77DE, 0x77DE, 0x56DE, 0xF1AC, 0x12B5, 0x32B5, 0x11B5, 0x32B5, 0x97E6, 0x98E6, 0xB7E6, 0x97E6,
+0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x56DE,
+0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x97DE, 0x98DE, 0x77DE, 0x76DE, 0x36D6, 0x35DE, 0x56DE,
+0x77E6, 0x97E6, 0x97E6, 0xD0AC, 0x6F9C, 0x2F94, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x76E6, 0x77E6, 0x98E6, 0x77E6, 0xB8E6,
+0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x73BD, 0x97E6,
+0x98E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0x36DE,
+0xF5D5, 0x52BD, 0xD0AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x11AD, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6, 0x32B5, 0x35D6, 0x97E6, 0x35D6, 0x56DE,
+0x77DE, 0x56DE, 0x56DE, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0xD5CD, 0x11AD, 0xF1AC,
+0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6,
+0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x77DE,
+0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x6F9C, 0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0x96DE, 0xD4CD,
+0x11B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0x97E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6,
+0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE, 0x15D6, 0x15D6, 0xF5D5, 0xD4CD, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x97E6, 0x97E6,
+0x98E6, 0x35D6, 0x76DE, 0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0xB8E6, 0xB8E6, 0x77E6,
+0xB8E6, 0x98E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6,
+0xB7DE, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x55DE,
+0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x4F9C, 0xB8E6, 0x97E6, 0xB7E6,
+0x97E6, 0xB7E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6,
+0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36DE, 0xD5CD, 0x36D6, 0x36D6, 0xF5D5, 0x15D6, 0x36D6,
+0x15D6, 0x55DE, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0xB0A4, 0xD4CD, 0xB4CD, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6,
+0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0xB7E6,
+0x97E6, 0x98E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0xF5CD, 0xF5D5, 0xF5D5, 0x32B5, 0xF5D5, 0x97E6,
+0x98E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x32B5, 0x32B5,
+0x12B5, 0xF1B4, 0x11B5, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6,
+0xB7E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6,
+0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6,
+0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6,
+0x97E6, 0x96E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6,
+0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97DE,
+0x97E6, 0x97E6, 0x96DE, 0x53BD, 0x32B5, 0x53BD, 0x53BD, 0x53BD, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x77E6, 0x97E6, 0xB8E6,
+0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6,
+0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x96E6, 0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x53BD, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB6E6, 0x97E6, 0x97E6,
+0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE,
+0x56DE, 0x35D6, 0x8C7B, 0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6,
+0x98E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x35DE, 0x77DE, 0x97DE, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x2E94, 0x93C5, 0x93BD, 0x93C5,
+0x93C5, 0x93BD, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0x77DE, 0xB9E6, 0xB9E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0xD4CD, 0x15D6, 0x36D6, 0x56DE, 0x97E6, 0x35D6,
+0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE,
+0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x35D6, 0x56D6, 0x56DE, 0x76DE,
+0x76DE, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0xF5CD, 0xF5D5,
+0x36D6, 0x56DE, 0x56DE, 0x8C7B, 0xCD8B, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x76DE, 0x77E6,
+0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x6FA4, 0xF1AC, 0x11B5,
+0x52BD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6,
+0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x98E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0xAC83, 0x0E94, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD,
+0xD5CD, 0x98DE, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6,
+0x56DE, 0x56DE, 0x77DE, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0xB7E6, 0x98E6,
+0x78E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x52BD, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B,
+0x4F9C, 0xF1B4, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x56DE, 0x77E6, 0x77E6, 0x97DE, 0x76DE,
+0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0xCD83, 0x6FA4, 0xD0AC,
+0xF5D5, 0x36D6, 0x36D6, 0x35D6, 0x93C5, 0x32B5, 0x35D6, 0x73C5, 0x77DE, 0x94C5, 0x76DE, 0xF5CD, 0x56DE, 0x56DE, 0xF5CD, 0x77DE,
+0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0x2F94, 0xAD7B, 0xF5D5, 0x15D6, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x77DE, 0x15D6, 0xD4CD,
+0x15D6, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x15D6, 0xF5CD, 0x15D6, 0x56DE, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x12B5, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0x55DE,
+0x15D6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x98DE, 0x76DE, 0x76DE, 0x77DE,
+0x8FA4, 0x77DE, 0x55DE, 0xEE8B, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x77E6,
+0x76DE, 0x98E6, 0x97E6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x56DE, 0x55DE, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD,
+0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0x56DE,
+0x36DE, 0xED8B, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0x98E6, 0x97E6, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x52B5,
+0x36D6, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x76DE, 0x97DE,
+0x76DE, 0x97E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x8C7B, 0xF5CD, 0x56DE, 0x97E6, 0x96DE, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6,
+0xB7E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x16D6, 0x15CE, 0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0x32BD,
+0x32B5, 0x32B5, 0x32BD, 0x32BD, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6, 0x97DE,
+0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x15D6, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x36D6, 0x97E6,
+0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x97E6, 0x77DE,
+0x77DE, 0x56DE, 0x56DE, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x97DE,
+0xB8E6, 0x96DE, 0x98E6, 0x77DE, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x97E6, 0x98E6, 0x97E6,
+0x98E6, 0xB8E6, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x76DE, 0x36D6, 0x36D6, 0x56DE, 0x77E6, 0x97E6,
+0x97E6, 0x96E6, 0x6F9C, 0x2F94, 0x2F94, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x73BD,
+0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE, 0xB8E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE,
+0x36DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC, 0xD1AC, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x32B5,
+0x35D6, 0x56D6, 0x35D6, 0x35D6, 0x56DE, 0x77DE, 0x56DE, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE,
+0x56DE, 0xD5CD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x77DE, 0xB8E6, 0x98E6,
+0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x15D6, 0x15D6, 0x15D6,
+0x36D6, 0x56DE, 0x55D6, 0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x6F9C, 0xB0AC, 0x6FA4,
+0x32BD, 0xB4CD, 0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0x97E6, 0x76E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0xB8E6,
+0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0xD4CD, 0x72BD, 0x32BD, 0x6FA4,
+0x6FA4, 0x2F94, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x36D6, 0x56DE, 0x77DE,
+0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6,
+0x97E6, 0x98E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE,
+0x97DE, 0x56DE, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x77DE,
+0x97E6, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x4F9C, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6,
+0xB7E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x76DE,
+0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0xD5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6,
+0x36D6, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0xD4CD, 0xB4CD, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6,
+0xD9E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6,
+0x97E6, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0xB0A4, 0x0E94, 0xF5CD, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0x97E6, 0x97E6, 0x77E6, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0x11B5, 0x32B5, 0x12B5,
+0x12B5, 0xF1B4, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6,
+0xB7E6, 0xB8E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6,
+0xF5CD, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6,
+0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x96DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x97E6, 0x77E6, 0x97E6, 0xB8E6,
+0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE,
+0x96DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6,
+0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x73BD, 0x53BD, 0x53BD, 0x53BD, 0x32B5,
+0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x97DE,
+0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6,
+0x97DE, 0x76DE, 0x56DE, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x97E6, 0x96E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6,
+0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE,
+0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B,
+0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x73BD, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6,
+0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x35DE, 0x77DE, 0x97DE, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x2E94, 0xB4C5, 0xB4C5,
+0x93C5, 0x93C5, 0x93C5, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6,
+0xB8E6, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x93C5, 0xD4CD, 0xD4CD,
+0x15D6, 0x36D6, 0x35D6, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x76E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x76E6, 0x97DE,
+0x97DE, 0x56DE, 0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5,
+0xD4CD, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x98E6,
+0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD,
+0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x98DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE,
+0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0x98DE, 0x98DE,
+0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x56DE, 0x56DE,
+0x77DE, 0x97E6, 0x97DE, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x77DE, 0x98E6, 0xB7E6,
+0x98E6, 0x78E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x52BD, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0xF5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x77E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0xED8B, 0x4F9C, 0xF1B4, 0x94C5, 0xD5CD, 0x76E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6,
+0x77E6, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x36D6, 0x56DE, 0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x57DE, 0xCD83, 0xF5D5,
+0x36D6, 0x93C5, 0x32B5, 0x35D6, 0x73C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6,
+0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0x15D6, 0x56DE, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0xD1AC, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0x15D6, 0x55DE, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11AD, 0xF1AC, 0x97E6, 0x76E6,
+0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x77DE, 0x55DE, 0xEE8B, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x55DE, 0x32B5, 0x32B5,
+0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6,
+0x97E6, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0x97E6, 0x15D6, 0x32B5, 0x32B5,
+0x52BD, 0x32BD, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x97E6,
+0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0x52B5, 0x36D6, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x15D6,
+0xD5CD, 0xB4C5, 0x53BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE,
+0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xF5CD, 0x56DE, 0x97E6, 0x96DE, 0x98E6, 0x76DE,
+0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0x36D6, 0x36D6, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0x36D6, 0xF5CD,
+0x52BD, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6,
+0x77DE, 0x97E6, 0x76DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0xB0AC, 0x6FA4, 0x8C7B, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6,
+0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x36D6,
+0x77DE, 0x77DE, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6,
+0xB7E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x15D6, 0xF5D5, 0xD4CD,
+0x52BD, 0x32BD, 0xB0AC, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x98DE, 0x77DE,
+0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x96E6, 0x97E6, 0x2F94, 0xF1AC, 0x12B5, 0x32B5, 0x11B5, 0x32B5,
+0x32B5, 0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE,
+0x98E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0x77DE, 0x96DE,
+0x75DE, 0x56DE, 0x77DE, 0x77DE, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C,
+0xF1AC, 0x11AD, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x98E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x32B5, 0x55D6, 0x56D6,
+0x35D6, 0x56DE, 0x77DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF1AC,
+0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x96DE, 0xB7E6, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x36D6, 0x15D6, 0x15D6, 0x15D6,
+0x36D6, 0x56DE, 0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x6F9C, 0xB0AC, 0x6FA4,
+0x32BD, 0xB4CD, 0xD5CD, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0xB8E6,
+0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x97E6,
+0x2F94, 0xEE8B, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x56D6, 0x36D6,
+0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0x97DE,
+0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6,
+0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE, 0x15D6, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0x32BD, 0xD5CD, 0x36D6, 0x36D6, 0x36D6,
+0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x77DE, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC,
+0xB0A4, 0x4F9C, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x77E6, 0x98E6, 0x97DE,
+0x97DE, 0x97E6, 0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0x36D6,
+0x35DE, 0x56DE, 0x56DE, 0x15D6, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x2E94, 0x4F9C, 0xD4CD, 0x98E6, 0x97DE, 0x77E6, 0xB8E6,
+0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6,
+0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36DE, 0xF1B4,
+0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6,
+0x76E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE,
+0x77DE, 0x77DE, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x12B5, 0x76E6, 0x98E6, 0x98E6, 0xB7E6,
+0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x98E6, 0x76DE,
+0x97DE, 0x97E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6,
+0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x96DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x97E6, 0x77E6, 0x97E6, 0xB8E6,
+0x97E6, 0x77E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x53BD, 0x53BD, 0x76E6, 0x96E6, 0x98E6,
+0x77DE, 0x96E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6,
+0x53BD, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6,
+0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6,
+0x98E6, 0x77E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x76DE, 0x56DE, 0x93C5, 0x93C5, 0x93BD, 0x73BD, 0x73BD,
+0x73BD, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0x97E6,
+0xB7E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x35D6, 0x8C7B, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x93C5,
+0x93BD, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0x77DE,
+0xB9E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x56DE, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x35DE, 0x35DE, 0x77DE, 0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x2E94, 0xD4CD, 0xB4C5,
+0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x97DE,
+0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6,
+0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0xD4CD, 0x15D6, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD,
+0x96E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x76DE,
+0x98E6, 0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0xF5D5, 0x36D6, 0x56DE, 0x56DE, 0x56DE, 0x35D6, 0x8C7B, 0xCD8B, 0xB0AC,
+0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0x96DE, 0x98E6, 0x76DE,
+0x77E6, 0xB8E6, 0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0xAC83, 0x0E94, 0x6FA4,
+0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0x97E6, 0x98DE, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97DE, 0x98E6,
+0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98E6, 0x98DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76E6, 0xF5CD,
+0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x77DE, 0x98E6, 0xB7E6, 0x98E6, 0x98E6, 0x78E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x52BD, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x76DE, 0x97E6, 0x77E6, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x56DE, 0x77E6,
+0x97E6, 0x97E6, 0x97E6, 0xED8B, 0x4F9C, 0xF1B4, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE,
+0x77E6, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0xF5D5, 0x36D6, 0x36D6, 0x35D6, 0x35D6, 0x32B5, 0x93C5, 0x73C5, 0x35D6,
+0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6,
+0x15D6, 0x56DE, 0x6F9C, 0x2F94, 0xAD7B, 0x55DE, 0x15D6, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x77DE, 0x15D6,
+0x77DE, 0x55DE, 0xEE8B, 0x32B5, 0x32B5, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x77E6,
+0x15D6, 0xF5CD, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x98E6, 0xB8E6,
+0x97E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0x97E6,
+0x15D6, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x77E6, 0x76DE,
+0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x52B5, 0x36D6, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6,
+0xB7E6, 0x98E6, 0x15D6, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6,
+0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0xF5CD, 0x56DE, 0x97E6,
+0x96DE, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0xD5CD,
+0xB4C5, 0x52BD, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77DE,
+0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6,
+0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x36D6,
+0x36D6, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x32BD, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0xB7E6, 0xB8E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x97DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6,
+0x98E6, 0x6FA4, 0x8C7B, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x98DE,
+0x77DE, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x11B5, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x52BD, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6,
+0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x15D6, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x35D6, 0x97E6, 0x98E6, 0x97E6,
+0x97E6, 0x96DE, 0x77DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x52BD,
+0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0x96E6, 0x97E6,
+0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6,
+0x97E6, 0xB7E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC, 0x77E6,
+0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0x77E6,
+0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x35D6,
+0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB0AC, 0x6FA4, 0x32BD, 0xB4CD,
+0xD5CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE,
+0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6,
+0xB7E6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x36D6, 0x56D6,
+0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE,
+0xD4CD, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97DE, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0xD5CD,
+0x36D6, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x4F9C, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0xD4CD, 0xB4CD,
+0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6,
+0x97DE, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB8E6,
+0x97E6, 0xB7DE, 0x97DE, 0x97DE, 0x56DE, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0xF5CD, 0xF5D5, 0x2E94, 0x97E6, 0x98E6,
+0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6,
+0x77E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x56DE, 0x57DE,
+0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x12B5, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x76E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6,
+0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0xF1AC, 0xB0A4, 0x0E94, 0x52BD, 0x32B5, 0x32B5,
+0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6,
+0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x56E6,
+0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6,
+0x98E6, 0x97E6, 0x97DE, 0x96DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6,
+0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x52BD, 0x73BD, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x97E6, 0x97E6, 0x97E6,
+0x76E6, 0x96E6, 0x98E6, 0x77DE, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6,
+0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97DE, 0x97E6, 0x97E6,
+0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0x93C5, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB6E6, 0x97E6,
+0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6,
+0x97E6, 0x97DE, 0x76DE, 0x56DE, 0xB4C5, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97DE,
+0x97E6, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x77DE, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6,
+0x98E6, 0x77E6, 0x97E6, 0x98DE, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x35D6, 0x8C7B, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6,
+0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x15D6,
+0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x35DE, 0x77DE, 0x97DE, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0xD4CD,
+0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6,
+0x77E6, 0x98E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0x56DE,
+0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0xD5CD,
+0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0x96DE, 0x98E6, 0x76DE,
+0x77E6, 0xB8E6, 0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0xF1AC,
+0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x8C7B, 0xCD8B, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97DE, 0x97E6,
+0x98DE, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE,
+0x77DE, 0x97DE, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0xAC83, 0x0E94, 0x6FA4, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x98E6, 0x96DE, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0x97E6,
+0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x77E6, 0x77E6, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0xED8B, 0xED8B, 0x4F9C, 0xF1B4, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE,
+0xCD83, 0x6FA4, 0xD0AC, 0xD0AC, 0xF1B4, 0xD4CD, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE,
+0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x56DE,
+0x55DE, 0x15D6, 0x77DE, 0x55DE, 0xEE8B, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0xED8B, 0x56DE, 0x55DE, 0x32B5,
+0x32B5, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0xF5CD, 0x36D6,
+0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0x15D6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6,
+0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x52B5, 0x96DE, 0x77DE,
+0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x15D6, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x76E6,
+0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x76DE, 0x76DE, 0x8FA4, 0x8FA4, 0xF5CD,
+0x56DE, 0x97E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x98E6, 0xD5CD, 0xF5CD, 0x15CE, 0xD5CD,
+0xB4C5, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6,
+0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x56DE,
+0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x98E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0x16D6,
+0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x16D6, 0x15CE, 0x56DE, 0x56DE, 0x36D6, 0x36D6, 0xF5CD, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x32BD, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6,
+0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x77DE,
+0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0x96E6, 0x97E6,
+0x77DE, 0x77DE, 0x56DE, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6,
+0x97E6, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x97DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x6FA4,
+0x8C7B, 0x32B5, 0x35D6, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE, 0xB8E6,
+0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x11B5,
+0x32B5, 0x32B5, 0x32B5, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6,
+0x97E6, 0x98E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x36D6, 0x15D6, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x36D6,
+0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0x98E6, 0x77DE, 0x56DE,
+0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0xF1AC, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0x77E6, 0x76E6, 0x77E6, 0x98E6,
+0x77E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE,
+0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x15D6, 0x15D6,
+0x98E6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB0AC, 0x6FA4,
+0x32BD, 0xB4CD, 0xD5CD, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6,
+0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6,
+0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x55DE, 0x55DE,
+0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C,
+0x4F9C, 0x4F9C, 0x6F9C, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0x97E6,
+0x97E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x96DE, 0x98E6, 0x97DE,
+0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x2E94, 0x4F9C,
+0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6,
+0xB8E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6,
+0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0xF5D5, 0xD4CD,
+0x72BD, 0x32BD, 0x6FA4, 0x6FA4, 0x2F94, 0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6,
+0xB8E6, 0xD9E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE,
+0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0xB7DE, 0xB8E6, 0xB8E6, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x15D6, 0xF5D5,
+0x11B5, 0x32B5, 0x12B5, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6,
+0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5,
+0x32B5, 0x12B5, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0xB7E6, 0x98E6,
+0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x56E6,
+0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0x53BD, 0x32B5, 0x53BD,
+0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6,
+0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE,
+0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0x73BD,
+0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x77E6, 0xB8E6,
+0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6,
+0xB7E6, 0x97E6, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6,
+0x96E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0x98DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x97E6, 0x96E6, 0xB8EE,
+0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x76DE, 0x56DE, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6,
+0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x77DE, 0xB9E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x77DE,
+0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6,
+0x97DE, 0x8C7B, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6,
+0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0x76E6,
+0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0xD4CD, 0xD4CD, 0x15D6,
+0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x35DE, 0x77DE, 0x97DE, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0xF5CD, 0xD5CD,
+0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0x96DE, 0x98E6, 0x76DE,
+0x77E6, 0xB8E6, 0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6,
+0xB7E6, 0xB7E6, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x56DE, 0x35D6, 0x56D6, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0x35D6,
+0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x76DE, 0x97DE, 0x97E6, 0x98DE,
+0x77E6, 0x76DE, 0x76DE, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0x77DE,
+0x97DE, 0x98E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0x52BD, 0xD5CD,
+0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x77E6, 0x76DE, 0x77DE,
+0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE,
+0x56DE, 0x77DE, 0x97E6, 0x94C5, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x56DE, 0x56DE, 0x77E6, 0x77E6, 0x97DE,
+0x76DE, 0x77E6, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0xB4CD, 0x36D6, 0x36D6,
+0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xF5D5, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5,
+0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6,
+0x56DE, 0x55DE, 0x15D6, 0x77DE, 0x55DE, 0xEE8B, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0xB0A4, 0x6F9C, 0x2F94, 0x2F94, 0xAD7B, 0x36D6,
+0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0x15D6, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0x77DE,
+0x97E6, 0x77E6, 0x77DE, 0x15D6, 0x52B5, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x15D6, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE,
+0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0xF5CD, 0x56DE, 0x97E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6,
+0x98E6, 0xD5CD, 0xB4C5, 0x53BD, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x97E6,
+0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98DE, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x76DE, 0x97E6,
+0xB8E6, 0xB8E6, 0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x98E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0x36D6, 0x36D6, 0x36D6,
+0x36D6, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0x36D6, 0xF5CD, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD,
+0x32BD, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x76DE,
+0x98E6, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x96DE, 0xB8E6, 0x77DE,
+0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x16D6, 0x96E6, 0x97E6,
+0x77DE, 0x77DE, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x56DE, 0x77DE, 0x96DE,
+0x75DE, 0x56DE, 0x77DE, 0x97DE, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0xD0AC, 0x6F9C, 0x2F94,
+0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x97DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6,
+0x96DE, 0x8C7B, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6,
+0x97E6, 0xB7E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0x11AD, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4,
+0xF1AC, 0x12B5, 0x32B5, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE,
+0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x36D6, 0x15D6, 0xF5D5, 0xD4CD,
+0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x97E6, 0x97E6, 0x98E6, 0x35D6,
+0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x6FA4, 0x32BD, 0xB4CD,
+0xD5CD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6,
+0x77E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6,
+0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x36D6,
+0x15D6, 0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x76DE, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x77DE, 0xB0A4, 0x4F9C,
+0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0xB0AC, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0x98E6,
+0x97E6, 0x76E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6,
+0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0x97DE, 0x97E6, 0xB8E6,
+0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6,
+0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6,
+0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x6FA4, 0x2F94, 0xEE8B, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x77E6,
+0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0x77E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6,
+0x97DE, 0x97DE, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7DE,
+0x97DE, 0x98E6, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0xD4CD, 0x72BD, 0x32BD, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x32B5,
+0x12B5, 0xF1B4, 0x11B5, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6,
+0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6,
+0x97E6, 0x97DE, 0x97DE, 0x97E6, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x53BD, 0x53BD, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6,
+0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x93C5, 0x11B5, 0xF1AC,
+0xB0A4, 0x0E94, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE,
+0x96E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6,
+0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6,
+0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x73BD,
+0x73BD, 0x73BD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x77E6,
+0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE,
+0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6,
+0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x76E6, 0xB7E6, 0x77E6, 0x97E6,
+0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x77DE, 0xB9E6, 0x97E6, 0x97E6,
+0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x98E6,
+0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x76DE, 0x56DE, 0xD5CD,
+0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x77DE,
+0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6,
+0x97DE, 0x8C7B, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE,
+0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x98E6,
+0x97E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0x56DE, 0x56DE, 0x35D6, 0x56D6, 0x56DE,
+0x76DE, 0x76DE, 0x76DE, 0x76E6, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6, 0x36D6, 0x56DE, 0x97E6, 0x35DE, 0x77DE, 0x35D6, 0x56DE,
+0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97E6,
+0x76DE, 0x97DE, 0x97E6, 0x98DE, 0x77E6, 0x76DE, 0x76DE, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x76DE,
+0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x0E94,
+0x6FA4, 0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94,
+0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x76DE, 0x77E6, 0x77E6,
+0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0xF5CD, 0x15D6,
+0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0xAC83, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x56DE, 0x57DE, 0x57DE, 0x56DE,
+0x56DE, 0x77E6, 0x77E6, 0x97DE, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0xED8B, 0x4F9C, 0xF1B4,
+0x52BD, 0xB4CD, 0xF5D5, 0x36D6, 0x36D6, 0x35D6, 0x35D6, 0xCD83, 0x6FA4, 0xD0AC, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE,
+0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x56DE,
+0x55DE, 0x15D6, 0x77DE, 0x55DE, 0xEE8B, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6,
+0x93C5, 0x2F94, 0xAD7B, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0x15D6, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x77DE, 0x15D6, 0xF5CD, 0x56DE, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE,
+0xD5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0xD5CD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x12B5,
+0x11AD, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0xF5CD, 0x56DE, 0x76DE, 0x97E6, 0x98E6,
+0xB8E6, 0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0x36D6, 0x36D6, 0x16D6,
+0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xB8E6,
+0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98DE, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE,
+0x56DE, 0x57DE, 0x15D6, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x97E6,
+0x77DE, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x77DE, 0x77DE, 0x56DE, 0x56DE, 0x56DE, 0x56DE,
+0x36D6, 0xF5CD, 0x52BD, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6,
+0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE,
+0x77DE, 0x97DE, 0x98DE, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x2F94, 0x52BD, 0x32BD,
+0x32B5, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE,
+0x56DE, 0x36DE, 0x36D6, 0x15D6, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x97DE, 0x97E6,
+0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0xB8E6, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC,
+0x6F9C, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6,
+0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x96DE, 0x97DE,
+0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6,
+0x16D6, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6,
+0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x6FA4, 0x32BD, 0xB4CD, 0xD5CD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC,
+0xD1AC, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6,
+0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x35DE, 0x36D6,
+0x15D6, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0xD5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x55DE,
+0x55DE, 0x77DE, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x77DE, 0xB0A4, 0x4F9C, 0x4F9C, 0x4F9C,
+0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0xB0AC, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0x76E6,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x77DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0xF5CD, 0x2E94, 0x4F9C, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0x97DE, 0x97E6, 0xB8E6,
+0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6,
+0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x96DE,
+0x98E6, 0x97DE, 0x97DE, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0xF1B4, 0x11B5, 0x12B5,
+0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0x77E6,
+0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6,
+0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0xD4CD, 0x72BD, 0x32BD,
+0x6FA4, 0x2F94, 0xEE8B, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x12B5, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6,
+0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0x97E6,
+0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6,
+0xB7DE, 0xB8E6, 0xB8E6, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0x53BD, 0x53BD, 0x53BD, 0x32B5,
+0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6,
+0x97E6, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE,
+0x77DE, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x0E94, 0x93C5, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x73BD,
+0x96E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6,
+0x98E6, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0xB7E6, 0xB8E6,
+0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE,
+0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5,
+0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0x98E6,
+0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6,
+0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6,
+0xB8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0xD5CD, 0xD4CD, 0xD4CD,
+0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6,
+0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB9E6,
+0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x77DE, 0x97DE, 0x98E6,
+0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x97E6,
+0x56DE, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0x76DE, 0x97DE, 0x97E6, 0x97DE, 0x97E6,
+0x97DE, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x97DE, 0x97E6,
+0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6,
+0xB8E6, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x98DE, 0x77E6,
+0x76DE, 0x78E6, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE,
+0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0x11B5, 0x52BD, 0xF5CD,
+0xF5D5, 0x36D6, 0x56DE, 0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6,
+0x36D6, 0x35DE, 0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0x94C5, 0xD5CD, 0x76E6, 0x98E6, 0x97E6,
+0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x77E6, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x98E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x97E6,
+0x97DE, 0x76E6, 0x96E6, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x36D6, 0x56DE, 0x36D6,
+0x35D6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x77E6,
+0x97E6, 0x97E6, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0xB4CD, 0xF5D5, 0x36D6, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD,
+0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x56DE, 0x55DE,
+0x15D6, 0x77DE, 0x55DE, 0xEE8B, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5,
+0x56DE, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0xF5CD, 0x56DE, 0xB8E6, 0x97E6, 0x98E6,
+0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0xD5CD, 0xD5CD, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C,
+0x2F94, 0xAD7B, 0x56DE, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6,
+0x96DE, 0x53BD, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0x15D6, 0x73BD, 0x97E6, 0x98E6,
+0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x97E6, 0xD8E6, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6,
+0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x16D6, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0x52BD, 0x32BD, 0x32B5,
+0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6,
+0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x32B5, 0x35D6, 0x97E6, 0x98E6,
+0x56DE, 0x77DE, 0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE, 0x98DE, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6,
+0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x77DE, 0x56DE, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6, 0xB8E6, 0x98E6, 0x76DE, 0x97E6,
+0x76DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x76DE, 0x76DE, 0x8FA4, 0x8FA4, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x15D6,
+0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6,
+0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0x11B5, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x97E6,
+0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6,
+0x36D6, 0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x77DE, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x32BD, 0xB4CD, 0xD5CD, 0xF1AC, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC,
+0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6,
+0x97E6, 0xB7E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x96DE, 0x96DE, 0x97DE,
+0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6,
+0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0x4F9C,
+0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF1AC, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6,
+0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x15D6, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0xD4CD,
+0xB4CD, 0x32BD, 0x12B5, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x76DE, 0xD8E6,
+0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6,
+0x77DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6,
+0x98E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x11B5, 0x32B5, 0x12B5, 0xF1B4,
+0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6,
+0x97E6, 0x77E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x77E6,
+0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0x96E6,
+0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5,
+0x12B5, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6,
+0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6,
+0x98E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x56DE,
+0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x73BD,
+0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6,
+0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6,
+0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6,
+0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0xB4C5, 0xB4C5,
+0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x73BD, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6,
+0x96E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6,
+0x98E6, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6,
+0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6,
+0x98E6, 0x97E6, 0x97E6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0xD5CD, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD,
+0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x97E6,
+0x76DE, 0x76DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0xB9E6, 0x97E6, 0x97E6,
+0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6,
+0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6,
+0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0x76DE, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0x96E6,
+0x96DE, 0x76DE, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x76DE, 0x98E6,
+0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6,
+0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97DE,
+0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x98DE, 0x77E6,
+0x76DE, 0x78E6, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x98E6, 0x98DE, 0x77DE,
+0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6,
+0x76E6, 0x97DE, 0x97DE, 0x56DE, 0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0xD4CD,
+0x15D6, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x35DE, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6,
+0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x56DE,
+0x56DE, 0x77E6, 0x77E6, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x15D6, 0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6,
+0x97E6, 0x97E6, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5,
+0x93C5, 0xD4CD, 0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0xF5D5, 0x36D6, 0x36D6, 0x35D6, 0x35D6,
+0x56DE, 0x57DE, 0x57DE, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD,
+0xB4CD, 0xF5CD, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5,
+0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x56DE, 0x55DE, 0x15D6, 0x77DE,
+0x55DE, 0xEE8B, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0xF5CD, 0x56DE,
+0x97E6, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6,
+0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0xD5CD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6,
+0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x96DE, 0x53BD, 0xB4C5, 0x53BD, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B,
+0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE,
+0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xF5CD, 0x52BD,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0x97E6, 0x77E6,
+0x77DE, 0x15D6, 0x32B5, 0x35D6, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE, 0x98DE,
+0x77DE, 0x76DE, 0x36D6, 0x35DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x77DE, 0x56DE, 0x56DE, 0x56DE, 0x56DE,
+0x36D6, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x96E6,
+0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6,
+0xF5CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x77DE,
+0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5,
+0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE,
+0x77DE, 0xD5CD, 0x36D6, 0x36D6, 0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x98E6,
+0x35D6, 0x76DE, 0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE,
+0x56DE, 0xD5CD, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD,
+0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6,
+0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x77DE,
+0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0xF5CD, 0xF5D5, 0xF5D5, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4,
+0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C,
+0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0xF1AC, 0x11AD, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x77E6,
+0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x77DE,
+0x96DE, 0x96DE, 0x97DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0xD4CD, 0xB4CD, 0x97DE,
+0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x77E6, 0x97DE,
+0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6,
+0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6,
+0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x15D6, 0xF5D5, 0xD4CD,
+0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x12B5, 0xF1B4, 0x11B5, 0x12B5, 0x32B5,
+0xF5D5, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0x77E6, 0x97E6,
+0x76DE, 0xD8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6,
+0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x96E6, 0x97E6,
+0x96DE, 0xB7E6, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x52BD, 0x73BD, 0x53BD,
+0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6,
+0x97E6, 0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6,
+0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE,
+0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x93C5,
+0x93C5, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6,
+0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6,
+0x56DE, 0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0xD5CD, 0xD5CD,
+0xD5CD, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6,
+0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6,
+0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6,
+0x97DE, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE,
+0x77DE, 0x77DE, 0x76DE, 0x77E6, 0xF1AC, 0xB0A4, 0x0E94, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0x96E6,
+0x96DE, 0x76DE, 0x97E6, 0x96E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE,
+0x76DE, 0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB7E6,
+0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6,
+0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD,
+0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x98DE, 0xB7E6, 0x98E6,
+0x78E6, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0x77DE, 0x97DE, 0x98E6,
+0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0x97DE,
+0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6,
+0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6,
+0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x96DE, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE,
+0x77E6, 0x77E6, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x56DE, 0x35D6, 0x56D6,
+0x56DE, 0x76DE, 0x76DE, 0x76DE, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x98E6, 0xB8E6, 0x35DE, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0xF5D5,
+0x36D6, 0x36D6, 0x35D6, 0x35D6, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD,
+0xB4CD, 0xF5CD, 0xF5CD, 0x15D6, 0x35D6, 0xAC83, 0x0E94, 0x8C7B, 0xCD8B, 0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE,
+0x35D6, 0x8C7B, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5,
+0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x56DE, 0x55DE, 0x15D6, 0x77DE,
+0x55DE, 0xEE8B, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0xF5CD, 0x56DE,
+0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6,
+0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x97E6,
+0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6,
+0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x36D6,
+0x36D6, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x56DE, 0x77DE,
+0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE, 0x98DE, 0x77DE, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6,
+0x77DE, 0x77DE, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6,
+0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x98E6,
+0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C,
+0x2F94, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE,
+0x97E6, 0x77E6, 0x77DE, 0x15D6, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x76DE,
+0x97E6, 0x97E6, 0x98E6, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6,
+0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32BD, 0x32BD,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6,
+0x97E6, 0x98DE, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4,
+0xB0A4, 0x94C5, 0x15D6, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C,
+0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0xD5CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0x11AD, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6,
+0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77DE,
+0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77DE, 0x56DE,
+0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6,
+0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6,
+0x76E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6,
+0x97DE, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11B5,
+0x32B5, 0x12B5, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6,
+0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x77E6,
+0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x98E6,
+0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6,
+0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x15D6, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0x93C5,
+0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x53BD, 0x53BD,
+0x32B5, 0x53BD, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6,
+0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB8E6,
+0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97E6,
+0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xD5CD, 0xF5CD,
+0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5,
+0xB4C5, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6,
+0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6,
+0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6,
+0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6,
+0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x56DE, 0x15D6, 0xF5D5,
+0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0x97E6, 0x98DE, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97E6,
+0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x76E6, 0x77DE, 0xB8E6, 0x97E6,
+0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0xB9E6,
+0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6,
+0x97E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x76DE,
+0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE,
+0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6,
+0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x77DE, 0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97DE,
+0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6,
+0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0x97E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6,
+0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x77E6,
+0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5,
+0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0xF5D5, 0x36D6, 0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6, 0x77E6,
+0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6,
+0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x76DE,
+0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6,
+0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6,
+0xB7E6, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE,
+0x56DE, 0x77DE, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC,
+0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x35DE, 0x77DE, 0x97DE, 0x97E6, 0x97E6,
+0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B,
+0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD,
+0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x56DE, 0x55DE, 0x15D6, 0x77DE, 0x55DE, 0xEE8B,
+0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0xF5CD, 0x56DE, 0x97E6, 0x96DE,
+0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE,
+0xD5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x97E6, 0x97E6, 0xD4CD,
+0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x77DE, 0x97E6,
+0x14CE, 0x97E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0x36D6, 0x36D6, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5,
+0x53BD, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x56DE, 0x77DE, 0x96DE, 0x75DE,
+0x56DE, 0x77DE, 0x97DE, 0x98DE, 0x77DE, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x77DE, 0x77DE,
+0x56DE, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6,
+0x16D6, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6,
+0x98E6, 0x97E6, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x2F94, 0xF1AC,
+0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6,
+0x15D6, 0x55DE, 0x55DE, 0x77DE, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC,
+0x6F9C, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11AD, 0x97E6, 0x97E6,
+0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0x15D6, 0x2E94, 0x4F9C, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC,
+0xB0A4, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0xD5CD, 0xF1AC, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x52BD, 0x32BD, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6,
+0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98DE, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6,
+0xF5CD, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6,
+0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0x76E6, 0x97E6,
+0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0x77E6, 0x97E6, 0x98E6,
+0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE,
+0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x76DE,
+0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x93C5, 0x93BD, 0x73BD, 0x73BD,
+0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x12B5, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE,
+0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6,
+0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE,
+0xB8E6, 0x96DE, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x97DE, 0x76DE, 0x97E6,
+0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD,
+0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6,
+0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6,
+0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6,
+0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6,
+0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97DE, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x15D6, 0xF5D5, 0xD4CD, 0x52BD,
+0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD,
+0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x98DE, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6,
+0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE,
+0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6,
+0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6,
+0x98E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6,
+0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6,
+0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6,
+0xB7E6, 0xB8E6, 0x97E6, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x97DE,
+0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE,
+0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x98E6, 0x97E6, 0x76DE,
+0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36DE,
+0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0xF5D5, 0x36D6,
+0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6, 0x77E6, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE,
+0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE,
+0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0xB7E6,
+0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6,
+0x98DE, 0xB6E6, 0x97E6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6,
+0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6,
+0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0xCD83, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0xB4CD,
+0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5,
+0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE,
+0x97E6, 0x97E6, 0x98E6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0xB8EE,
+0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE,
+0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6, 0x36D6, 0x35DE, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6,
+0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0xF5D5,
+0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE,
+0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x56DE, 0x55DE, 0x15D6, 0x77DE, 0x55DE, 0xEE8B, 0xED8B,
+0x56DE, 0x55DE, 0x32B5, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0xF5CD, 0x56DE, 0x97E6, 0x96DE, 0x77DE,
+0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD,
+0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6,
+0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE,
+0x97E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6,
+0x16D6, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x56DE, 0x77DE, 0x96DE, 0x75DE,
+0x56DE, 0x77DE, 0x97DE, 0x98DE, 0x77DE, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6,
+0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE,
+0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6,
+0x98E6, 0x97E6, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x77DE,
+0x56DE, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6,
+0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36DE,
+0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0x4F9C,
+0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0xD5CD, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD,
+0x32B5, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0x53BD,
+0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x12B5, 0xF1B4, 0x11B5, 0x12B5,
+0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6,
+0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0x11AD, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6,
+0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6,
+0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0x15D6, 0x94C5, 0xD5CD,
+0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD,
+0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5,
+0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x73BD,
+0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6,
+0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6,
+0x76E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6,
+0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97DE,
+0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE,
+0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6,
+0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x98DE, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6,
+0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE,
+0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6,
+0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6,
+0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6,
+0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE,
+0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6,
+0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x97DE, 0x76DE,
+0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5,
+0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0xF5D5, 0x36D6, 0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6, 0x77E6,
+0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6,
+0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE,
+0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6,
+0x98E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6,
+0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6,
+0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x15D6, 0xF5D5,
+0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x98E6,
+0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6,
+0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6,
+0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6,
+0x97DE, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6,
+0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5,
+0xD4CD, 0x72BD, 0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x56DE,
+0x77DE, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6,
+0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6,
+0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6,
+0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6,
+0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0xAC83, 0x0E94, 0x6FA4,
+0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6,
+0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6,
+0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6,
+0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0x35DE, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE,
+0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0xF5D5, 0x35D6, 0xF5D5,
+0xD5CD, 0x2E94, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6,
+0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x56DE, 0x55DE, 0x15D6, 0x77DE, 0x55DE, 0xEE8B, 0xED8B, 0x56DE, 0x55DE,
+0x32B5, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0xF5CD, 0x56DE, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE,
+0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6,
+0xB7E6, 0x98E6, 0x15D6, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x98E6,
+0xB8E6, 0x98E6, 0xD5CD, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6,
+0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6,
+0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE,
+0x97DE, 0x98DE, 0x77DE, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x16D6, 0x15CE,
+0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x77DE, 0x97E6,
+0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6,
+0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x77DE, 0x56DE, 0x56DE,
+0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x56DE,
+0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x52BD,
+0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C,
+0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0xD5CD, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0xD4CD,
+0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x93C5,
+0x93C5, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x53BD, 0x53BD,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x12B5, 0xF1B4, 0x11B5, 0x12B5, 0x32B5,
+0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6,
+0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x11AD,
+0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32BD,
+0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD,
+0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0x36D6, 0x56DE, 0x76E6,
+0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x98DE,
+0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6,
+0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6,
+0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0x77E6, 0x97E6,
+0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6, 0xB8E6, 0x97E6,
+0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x97E6,
+0x77E6, 0x77DE, 0x15D6, 0xF5D5, 0x36D6, 0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6, 0x77E6, 0x97DE,
+0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE,
+0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x77DE,
+0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6,
+0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6,
+0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6,
+0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6,
+0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE,
+0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6,
+0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x76DE,
+0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE,
+0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE,
+0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6,
+0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6,
+0x97DE, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6,
+0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6,
+0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x96DE,
+0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE,
+0x98E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0xED8B, 0x4F9C,
+0xF1B4, 0x52BD, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6,
+0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE,
+0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0xB8E6,
+0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6,
+0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x15D6,
+0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6,
+0x56DE, 0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x77DE,
+0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6,
+0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE,
+0x77DE, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD,
+0x72BD, 0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6, 0x36D6, 0x56DE,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6,
+0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD,
+0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0x35DE, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE,
+0x76DE, 0x56DE, 0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94,
+0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6,
+0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x56DE, 0x55DE, 0x15D6, 0x77DE, 0x55DE, 0xEE8B, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x52B5,
+0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0xF5CD, 0x56DE, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6,
+0x98E6, 0x97E6, 0x15D6, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6,
+0x15D6, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6,
+0xD5CD, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x97E6, 0xD8E6,
+0x98E6, 0x96DE, 0x53BD, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x15D6,
+0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE, 0x98DE,
+0x77DE, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x16D6, 0x15CE, 0xF5CD, 0x15CE,
+0xD5CD, 0xB4C5, 0x53BD, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x76DE, 0x97E6,
+0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0xB8E6,
+0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x77DE, 0x56DE, 0x56DE, 0x56DE, 0x56DE,
+0x36D6, 0xF5CD, 0x52BD, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x77DE, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC,
+0xD0AC, 0x6F9C, 0x2F94, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD,
+0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x73BD, 0x73BD,
+0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4,
+0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0xD5CD, 0x36D6, 0x56DE, 0x76E6, 0x98E6,
+0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x98DE, 0x77E6,
+0x76DE, 0x76DE, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x76DE,
+0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x32B5,
+0x12B5, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6,
+0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0xF5D5, 0x36D6, 0x36D6, 0x35D6,
+0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6, 0x77E6, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0xB7E6,
+0x98E6, 0x78E6, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE,
+0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE,
+0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6,
+0xB8E6, 0xD9E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0x97E6,
+0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x11B5, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C,
+0x2F94, 0xAD7B, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE,
+0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x98E6,
+0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6,
+0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6,
+0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6,
+0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6,
+0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0x15D6, 0xED8B, 0x4F9C, 0xF1B4,
+0x52BD, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6,
+0x98E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6,
+0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6,
+0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x77DE,
+0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x98DE,
+0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0x52BD,
+0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE,
+0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6,
+0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6,
+0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x96DE, 0x98E6,
+0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6,
+0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6,
+0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x56DE, 0x35D6, 0x56D6,
+0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6,
+0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6,
+0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0x56DE,
+0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x96DE,
+0xB7E6, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6,
+0x15D6, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD,
+0x15D6, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6,
+0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6,
+0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD,
+0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0x35DE, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x56DE,
+0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x32B5, 0x93C5,
+0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6,
+0xF5D5, 0x15D6, 0x15D6, 0x56DE, 0x55DE, 0x15D6, 0x77DE, 0x55DE, 0xEE8B, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x52B5, 0x36D6, 0x57DE,
+0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0xF5CD, 0x56DE, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6,
+0x15D6, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0x73BD,
+0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0xD5CD,
+0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE,
+0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6,
+0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x77DE, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x77DE,
+0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE, 0x98DE, 0x77DE, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x16D6,
+0x36D6, 0x36D6, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x2E94, 0x4F9C,
+0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6,
+0x97E6, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x36D6, 0x36D6, 0x16D6,
+0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE,
+0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD,
+0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x2F9C,
+0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6,
+0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x77DE, 0x77DE, 0x56DE, 0x56DE,
+0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0xF5D5, 0x36D6, 0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6,
+0x77E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x98DE, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE,
+0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x93C5, 0x93BD,
+0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x12B5, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4,
+0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0xD5CD, 0x2F94, 0xCD83, 0x97DE, 0x76DE,
+0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6,
+0x96DE, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6,
+0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6,
+0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x77E6,
+0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5,
+0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6,
+0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6,
+0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76E6, 0x98E6, 0xB7E6,
+0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0x77E6,
+0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0x11AD, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5,
+0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x56DE,
+0x77DE, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE,
+0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE,
+0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6,
+0x97E6, 0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x76E6,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0x77E6, 0x97E6,
+0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11AD, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6,
+0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6,
+0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x96DE,
+0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6,
+0xB8E6, 0x98E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6,
+0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE,
+0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE,
+0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6,
+0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6,
+0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x76DE,
+0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6,
+0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6,
+0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0x15D6, 0x8C7B,
+0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6, 0x36D6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6,
+0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6,
+0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6,
+0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6,
+0xB7E6, 0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x97DE, 0x76DE,
+0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0x98DE,
+0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6,
+0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6,
+0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0x57DE,
+0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0x32BD, 0x6FA4, 0x2F94, 0xEE8B,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x15D6, 0xF5D5, 0xD4CD, 0x52BD,
+0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x35DE, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0x35D6,
+0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x32B5, 0x93C5, 0x73C5,
+0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5,
+0x15D6, 0x15D6, 0x56DE, 0x55DE, 0x15D6, 0x77DE, 0x55DE, 0xEE8B, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x52B5, 0x36D6, 0x57DE, 0x56DE,
+0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0xF5CD, 0x56DE, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6,
+0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0x73BD, 0x97E6,
+0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0xD5CD, 0x36D6,
+0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x32B5, 0x35D6, 0x97E6,
+0x98E6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0x94C5,
+0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD,
+0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x56DE,
+0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE, 0x98DE, 0x77DE, 0x76DE, 0x36D6,
+0x36D6, 0x16D6, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6,
+0x97E6, 0x76DE, 0x97DE, 0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD,
+0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x35D6, 0x76DE, 0x77DE,
+0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE,
+0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD, 0xF5D5, 0x36D6,
+0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6, 0x77E6, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x97E6,
+0x98DE, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6,
+0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x73BD,
+0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6,
+0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x77DE, 0x56DE,
+0x56DE, 0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x77DE, 0x98E6, 0xB7E6, 0x98E6,
+0x78E6, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6,
+0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x97E6,
+0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x12B5,
+0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C,
+0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0xD5CD, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0x56DE, 0x77E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE,
+0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE,
+0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6,
+0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0xB4CD, 0xF5CD, 0x15D6,
+0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6,
+0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6,
+0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0x11B5, 0x32B5, 0x11AD,
+0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5,
+0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6,
+0x97DE, 0x97DE, 0xB8E6, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6,
+0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6,
+0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0x97E6,
+0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x11B5, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0xAC83,
+0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6,
+0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6,
+0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6,
+0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6,
+0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6,
+0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6,
+0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE,
+0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6,
+0x98E6, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6,
+0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6,
+0xB8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6,
+0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x96DE, 0x98E6, 0x97DE,
+0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0x77DE,
+0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x76DE,
+0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x77E6,
+0x77DE, 0x15D6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x97E6,
+0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE,
+0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x96E6,
+0x97E6, 0x96DE, 0xB7E6, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE,
+0x96DE, 0x97DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x76DE,
+0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x35DE, 0x77DE,
+0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6,
+0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD,
+0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x15D6, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD,
+0xB0AC, 0x6FA4, 0x8C7B, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x35D6, 0x56DE, 0x76DE,
+0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5,
+0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6,
+0x56DE, 0x55DE, 0x15D6, 0x77DE, 0x55DE, 0xEE8B, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD,
+0x36D6, 0x93C5, 0x56DE, 0xF5CD, 0x56DE, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x15D6,
+0x73BD, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0x94C5,
+0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0x36D6, 0x36D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x97E6,
+0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6,
+0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6,
+0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0xF5D5, 0x36D6, 0x36D6, 0x35D6, 0x35D6,
+0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x98DE, 0xD5CD, 0xD5CD,
+0xD5CD, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6,
+0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x56DE, 0x77DE,
+0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE, 0x98DE, 0x77DE, 0x76DE, 0x36D6, 0x53BD, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6,
+0x77E6, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE,
+0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x93BD,
+0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x77DE, 0x57DE,
+0x76DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0x16D6, 0x16D6,
+0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD,
+0x35D6, 0x56DE, 0x77E6, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6,
+0x76DE, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6,
+0x52BD, 0x73BD, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0xD4CD, 0xB4CD,
+0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x35DE,
+0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x77DE, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0xB4C5, 0x53BD, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0x97DE,
+0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x76DE,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x32B5,
+0x12B5, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C,
+0x4F9C, 0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0x36DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0xF5CD,
+0x52BD, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x98DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6,
+0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6,
+0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0xB7E6,
+0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6,
+0x77E6, 0xB8E6, 0x98E6, 0xD5CD, 0x56DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6,
+0x96DE, 0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6,
+0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x96DE, 0xD4CD,
+0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x11AD, 0xAC83, 0x0E94, 0x6FA4, 0x97E6,
+0xB7E6, 0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6,
+0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6,
+0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6,
+0x97E6, 0x76E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x11B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x56DE, 0x35D6, 0x56D6,
+0x56DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6,
+0x96DE, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0x98E6,
+0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0x32B5, 0x32BD, 0x32BD,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x8C7B, 0xCD8B, 0xB0AC, 0x76E6,
+0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6,
+0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x98E6, 0xB8E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6,
+0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6,
+0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0xB8E6, 0x98E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0xB7E6, 0x97DE, 0x97E6, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6,
+0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6,
+0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE,
+0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6,
+0xB8E6, 0x77DE, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6,
+0x76DE, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0xB0A4,
+0x6F9C, 0x2F94, 0xAD7B, 0x35DE, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0x97E6,
+0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0x57DE, 0x36DE,
+0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0x96E6, 0x97E6, 0x96DE, 0xB7E6,
+0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x97DE,
+0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6,
+0x98DE, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0x15D6, 0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6,
+0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0xB0A4, 0x0E94, 0x6FA4, 0x2F94, 0xEE8B, 0x77DE, 0x57DE, 0x35DE, 0x35DE, 0x36D6, 0x15D6, 0xF5D5,
+0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5,
+0x8FA4, 0x8FA4, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5,
+0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6,
+0x56DE, 0x55DE, 0x15D6, 0x77DE, 0x55DE, 0xEE8B, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD,
+0x36D6, 0x93C5, 0x56DE, 0xF5CD, 0x56DE, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0x94C5,
+0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x73BD, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6,
+0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0xB7E6, 0x15D6, 0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6,
+0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0x36D6, 0x36D6, 0x36D6,
+0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6,
+0xB8E6, 0x98E6, 0xB8E6, 0x15D6, 0xF5D5, 0x36D6, 0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x76DE, 0x97E6, 0x97E6,
+0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x98DE, 0x77E6, 0x76DE, 0xD5CD, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5,
+0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x15D6,
+0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0x98E6,
+0x97E6, 0xD8E6, 0x98E6, 0xD5CD, 0x56DE, 0x77E6, 0x77E6, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x98E6,
+0x76DE, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5,
+0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x76DE,
+0x77DE, 0x57DE, 0x56DE, 0x77DE, 0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE, 0x98DE, 0x77DE, 0x98E6, 0x96DE, 0x53BD,
+0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0x98E6, 0x78E6, 0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6,
+0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE,
+0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4,
+0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x76DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6,
+0xB8E6, 0x56DE, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x16D6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE,
+0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x97E6, 0x97E6,
+0x97E6, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5,
+0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6,
+0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x77DE, 0x56DE, 0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD, 0xED8B, 0x4F9C, 0xF1B4,
+0x52BD, 0xB4CD, 0xF5CD, 0x15D6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x77DE,
+0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6,
+0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x11B5, 0x32B5, 0x12B5, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0x98E6,
+0x97DE, 0x77E6, 0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0x56DE, 0x56DE, 0x36DE,
+0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0x35D6, 0x56DE, 0x56DE,
+0x77DE, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE,
+0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6,
+0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x32BD, 0xB4CD, 0xD5CD, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0xB7E6,
+0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6,
+0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6,
+0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF1AC, 0xF1AC, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0xB8E6,
+0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE,
+0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0x76DE,
+0xD8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC,
+0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6,
+0x77DE, 0x98DE, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0x96DE, 0x97E6,
+0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6,
+0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x11B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5,
+0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0xB8E6, 0xB7E6,
+0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6,
+0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6,
+0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32BD,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x15D6, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6,
+0x97E6, 0xB7E6, 0x97DE, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6,
+0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x52BD, 0x32BD, 0x32B5, 0x32B5,
+0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x35DE, 0x97DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6,
+0x97DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x97DE,
+0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE,
+0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6,
+0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6, 0xB8E6, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE,
+0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0x77DE,
+0x77DE, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0x96E6,
+0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x97DE,
+0x77DE, 0x96DE, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x96E6,
+0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94,
+0xAD7B, 0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x8C7B, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4,
+0x0E94, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x96DE, 0x97DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE,
+0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x76DE,
+0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0x15D6, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x35DE, 0x36D6, 0x15D6, 0xF5D5, 0xD4CD,
+0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5,
+0x8FA4, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x8FA4, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD,
+0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x56DE, 0x55DE,
+0x15D6, 0x77DE, 0x55DE, 0xEE8B, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0x52B5, 0x36D6, 0x57DE, 0x56DE,
+0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0x36D6, 0x56DE, 0x76E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD,
+0x56DE, 0x76DE, 0x56DE, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0xF5D5, 0x36D6, 0x76E6, 0x98E6,
+0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD,
+0xD5CD, 0xD5CD, 0xD5CD, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0xB7E6,
+0x15D6, 0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6, 0x77E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE,
+0x97E6, 0x98DE, 0x77E6, 0x76DE, 0x76DE, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xF5CD, 0x36D6,
+0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6,
+0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0x15D6, 0xCD83, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x77DE,
+0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0xB4C5, 0xB4C5, 0xB4C5,
+0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x77DE,
+0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x97E6, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE,
+0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0xD5CD, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x78E6,
+0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x76E6, 0xB7E6, 0x77E6, 0x93C5, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x73BD, 0x2E94, 0x4F9C, 0x97E6, 0x76DE,
+0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x77DE, 0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE,
+0x98DE, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x98E6,
+0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6,
+0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5,
+0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x77DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0xB8E6, 0x77DE,
+0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0xB4CD, 0xF5CD, 0x97E6,
+0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x76DE, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE,
+0xB8E6, 0x77DE, 0x96E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x32B5, 0x52BD, 0x32B5, 0x32B5,
+0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x12B5, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6,
+0xB7E6, 0x97E6, 0x98E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x36D6, 0x36D6, 0x16D6,
+0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD, 0x15D6, 0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97DE,
+0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6,
+0x98E6, 0x77E6, 0xB8E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF1B4, 0x11B5, 0x12B5, 0x32B5,
+0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0xB0A4, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0xB0AC, 0x77DE,
+0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x77DE, 0x77DE, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0x36D6,
+0xF5CD, 0x52BD, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6,
+0x77DE, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76E6,
+0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6,
+0xB8E6, 0xB8E6, 0x6FA4, 0x32BD, 0xB4CD, 0xD5CD, 0x2F94, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0xB7E6, 0x76E6, 0x97DE, 0x97DE,
+0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6,
+0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6,
+0x97E6, 0x77E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6,
+0x56DE, 0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x97DE,
+0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6,
+0x97E6, 0xD8E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF1AC, 0x11AD, 0xF1AC, 0xD1AC, 0x8C7B, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x77DE,
+0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6,
+0xB8E6, 0x97E6, 0x77DE, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x76E6, 0x97E6, 0x97E6,
+0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6, 0x36D6, 0x56DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6,
+0x97DE, 0xB7E6, 0x98E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6,
+0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6,
+0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x52BD, 0x32BD, 0x32B5, 0x32BD, 0x32BD, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x77E6, 0xB8E6, 0x97E6, 0x98E6,
+0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6,
+0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0x32B5, 0x32BD, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x35DE, 0x77DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE,
+0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6,
+0xB8E6, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6,
+0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0x97E6, 0x97E6, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x56DE, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x98E6, 0x97E6,
+0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE, 0x97E6,
+0x97E6, 0x96E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE,
+0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6, 0xB8E6, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11AD, 0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6,
+0x8C7B, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x56DE,
+0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x96E6, 0x77DE,
+0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x76DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6,
+0x97DE, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC,
+0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0xD4CD, 0x72BD, 0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x97DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6,
+0x96DE, 0x97E6, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x97E6, 0x76E6, 0x97E6, 0x76DE,
+0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0xAD7B, 0x36D6, 0x15D6, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x8C7B, 0xB8E6,
+0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE,
+0x57DE, 0x15D6, 0x15D6, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0xF5CD, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE,
+0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x56DE, 0x55DE, 0x15D6,
+0x77DE, 0x55DE, 0xEE8B, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x36D6, 0x56DE, 0x76E6,
+0x98E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x56DE, 0x52B5, 0x36D6, 0x57DE,
+0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5, 0xF5D5, 0x36D6, 0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6,
+0x97E6, 0x96DE, 0x97E6, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0x56DE, 0x76DE, 0x97E6, 0x97E6, 0x96DE,
+0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6, 0x77E6, 0x97DE, 0x76DE, 0x97E6, 0x76DE,
+0x97DE, 0x97E6, 0x98DE, 0x77E6, 0x76DE, 0x76DE, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xD5CD,
+0x36D6, 0x36D6, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0x97E6, 0x15D6,
+0xCD83, 0x6FA4, 0xD0AC, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x97DE, 0x97E6, 0x97DE, 0x97E6, 0x97DE,
+0x98E6, 0x77DE, 0x96E6, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x93C5, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5,
+0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x16D6, 0x36D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6,
+0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6, 0x15D6, 0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x76E6, 0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x53BD, 0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x77DE, 0x97E6,
+0x76DE, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x14CE,
+0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x96DE, 0x98E6,
+0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x52BD,
+0x52BD, 0x73BD, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x76DE,
+0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x97DE, 0x98DE, 0xD8E6, 0x98E6, 0x96DE, 0x53BD,
+0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0xB4CD, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6,
+0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0xB8E6, 0x77DE, 0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x16D6, 0xF5CD,
+0x15D6, 0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE,
+0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x97E6,
+0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x12B5, 0xF1B4, 0x11B5, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x36D6, 0x36D6,
+0x36D6, 0x36D6, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x97DE,
+0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0xB0A4,
+0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0xB0AC, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC,
+0x96E6, 0x97E6, 0x77DE, 0x77DE, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0xD5CD, 0xB4C5, 0x53BD, 0xAC83, 0x0E94, 0x97E6, 0x97E6, 0xB7E6,
+0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6,
+0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6,
+0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x6FA4, 0x32BD, 0xB4CD, 0xD5CD, 0xD0AC, 0x6F9C, 0x2F94, 0x36D6, 0xF5CD, 0x52BD,
+0x6FA4, 0xF1AC, 0x11B5, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6,
+0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6,
+0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5,
+0x32B5, 0x11AD, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6,
+0x97E6, 0x97DE, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6,
+0x76E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF1AC, 0xF1AC, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x98E6,
+0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6,
+0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x76E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6,
+0x98E6, 0x11AD, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6, 0x36D6, 0x56DE, 0x97E6,
+0x97E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6,
+0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x77E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6,
+0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD,
+0x32BD, 0x32B5, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6,
+0x97E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6,
+0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x98E6, 0x98E6, 0xB7E6,
+0x97E6, 0x77E6, 0xB8E6, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x35DE, 0x77DE, 0x97DE, 0x96E6, 0xB8EE,
+0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0xB8E6, 0xB7E6,
+0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0xB8E6,
+0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x35D6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x76DE,
+0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE,
+0x77E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x98E6,
+0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6,
+0x97E6, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE,
+0x35D6, 0x8C7B, 0x56DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36DE,
+0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6,
+0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0x96E6, 0x98E6, 0x98E6, 0x76E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0xF5D5, 0x35D6, 0xF5D5,
+0xD5CD, 0x2E94, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0x32BD, 0x6FA4, 0x96DE, 0xB7E6,
+0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x76DE, 0x77DE,
+0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x11AD,
+0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0x2F94, 0xEE8B, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE,
+0x35DE, 0x97DE, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x76DE,
+0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0x36D6, 0x15D6,
+0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x97E6,
+0x98DE, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0x15D6, 0x8C7B, 0x36D6, 0x15D6, 0xF5D5, 0x52BD,
+0x11B5, 0x8FA4, 0x8FA4, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5,
+0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x15D6, 0x56DE, 0x94C5, 0x55DE, 0x15D6,
+0x36D6, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x77DE, 0x55DE, 0xEE8B, 0xF5D5, 0x36D6, 0x76E6, 0x98E6, 0x97E6,
+0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x52B5, 0xED8B, 0x56DE, 0x55DE, 0x32B5,
+0x36D6, 0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0xD5CD,
+0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0x56DE, 0x52B5, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x93C5,
+0x56DE, 0x77E6, 0x77E6, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x97DE, 0x97E6, 0x98DE, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0xD4CD, 0xD4CD,
+0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xD4CD, 0x56DE, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6,
+0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0x97DE,
+0x98E6, 0x77DE, 0x96E6, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6,
+0x73BD, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0xB7E6, 0x97E6, 0x15D6, 0x35D6, 0x56DE,
+0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6,
+0x97E6, 0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x73BD, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0xF5D5, 0x15D6,
+0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x15D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6,
+0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x76DE, 0x96DE,
+0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x73BD, 0x73BD, 0x53BD,
+0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6,
+0x35D6, 0x56DE, 0x97E6, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0xED8B, 0x4F9C,
+0xF1B4, 0x52BD, 0xB4CD, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6,
+0x77DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x32B5,
+0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x98E6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x56DE, 0x77DE, 0x96DE,
+0x75DE, 0x56DE, 0x77DE, 0x97DE, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x53BD, 0x53BD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x56DE, 0x77DE,
+0x97E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x76DE,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x15D6, 0x36D6,
+0x56D6, 0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0x98DE, 0x77DE, 0x76DE, 0x36D6,
+0x36D6, 0x16D6, 0x16D6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6,
+0x97DE, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6,
+0x11B5, 0x32B5, 0x12B5, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x97E6, 0x97E6, 0xB8E6,
+0xB7E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x36D6,
+0x36D6, 0x16D6, 0x15CE, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6,
+0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6,
+0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0x98E6, 0x77DE,
+0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x77DE, 0x56DE, 0x15CE, 0xF5CD, 0x15CE, 0xD5CD,
+0xB4C5, 0x53BD, 0xAC83, 0x0E94, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0x52BD, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6,
+0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB0AC, 0x6FA4, 0x32BD,
+0xB4CD, 0xD5CD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0xF5D5, 0x36D6, 0x56DE,
+0x56DE, 0x35D6, 0x56D6, 0x56DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x97DE,
+0x98E6, 0x77E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6,
+0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x98DE,
+0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x96DE, 0xB8E6, 0x97E6,
+0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0xB8E6, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF1AC, 0xF1AC, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x98E6,
+0x76DE, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x77DE,
+0xB7E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC,
+0xF1AC, 0x11AD, 0xF1AC, 0xD1AC, 0xF1AC, 0xD4CD, 0x15D6, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE,
+0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6,
+0x98E6, 0x98E6, 0x97DE, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE,
+0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x11B5, 0x32B5, 0x32B5, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6,
+0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6,
+0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0x77E6,
+0x97E6, 0x98E6, 0x32B5, 0x52BD, 0x32BD, 0x32BD, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0x35DE, 0x77DE, 0x97DE, 0x96E6, 0xB8EE, 0xB8E6,
+0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6,
+0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x97E6, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x32B5,
+0x35D6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x76DE, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x96E6,
+0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0x97DE, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE,
+0x56DE, 0x35D6, 0x76DE, 0x56DE, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0x57DE,
+0x36DE, 0x36DE, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6,
+0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5,
+0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xF5D5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x8C7B, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC,
+0xB0A4, 0x0E94, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6,
+0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x76DE, 0x97E6,
+0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x76E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xF5D5, 0xD4CD, 0x72BD,
+0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE,
+0x96DE, 0x96DE, 0x97DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6,
+0x97E6, 0x32B5, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6,
+0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x97E6, 0x98E6,
+0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0x36D6, 0x15D6, 0xF5D5, 0xD4CD,
+0x52BD, 0x32BD, 0xB0AC, 0x6FA4, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x76DE,
+0x76DE, 0x77DE, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0x15D6, 0x8C7B, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5,
+0x8FA4, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x8FA4, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD,
+0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0xF5D5, 0x15D6, 0x94C5, 0xD5CD, 0xF5CD,
+0xF5CD, 0x15D6, 0x56DE, 0x36D6, 0x56DE, 0x76E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x55DE, 0x15D6, 0xF5D5,
+0x36D6, 0x36D6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x77DE,
+0x55DE, 0xEE8B, 0x35D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x56DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0xD5CD,
+0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0x52B5, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x77E6, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE,
+0x97E6, 0x98DE, 0x77E6, 0x76DE, 0x76DE, 0x76DE, 0xD5CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xF5CD, 0x56DE, 0x97E6,
+0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x77DE, 0x98E6, 0xB7E6, 0x98E6,
+0x78E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0x96E6, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xD5CD,
+0x36D6, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6, 0x93C5, 0x56DE, 0x77E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x93C5,
+0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x93C5, 0xF5CD, 0xF5D5, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x73BD, 0x97E6, 0x98E6,
+0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6,
+0x96DE, 0x76DE, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x97E6, 0x93BD, 0x73BD,
+0x73BD, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x15D6,
+0x15D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6,
+0x15D6, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6,
+0x77E6, 0x98E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x73BD, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0x2E94,
+0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x96DE, 0xB8E6, 0x77DE,
+0x97E6, 0x14CE, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x98E6,
+0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x97E6, 0x96E6, 0x76DE, 0x97E6,
+0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x4F9C, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x35D6, 0x76DE,
+0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x77DE, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE,
+0x53BD, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6,
+0x77DE, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11B5,
+0x32B5, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0x98DE, 0x77DE,
+0x76DE, 0x36D6, 0x36D6, 0x16D6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6,
+0x77DE, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x12B5, 0xF1B4,
+0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6,
+0x97E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0xAC83, 0x0E94,
+0x6FA4, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6,
+0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6,
+0x97DE, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x6F9C, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0xF5D5, 0x77E6, 0x97E6,
+0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x36D6, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6,
+0x56DE, 0x56DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6,
+0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6,
+0xB7E6, 0xB8E6, 0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0xD5CD, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0x77DE, 0x56DE, 0x56DE,
+0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x53BD, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE,
+0xB6E6, 0x98E6, 0x98E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6,
+0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0x52BD, 0x8C7B, 0xCD8B, 0xB0AC, 0x76E6,
+0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x98E6, 0x98E6, 0x97E6, 0x97DE,
+0x96DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0x11B5,
+0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6, 0x98E6, 0x77DE, 0x97DE, 0x98E6, 0x76DE,
+0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xD8E6, 0xB7E6,
+0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0x11AD, 0xF1AC, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6,
+0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6,
+0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0xD1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x98E6,
+0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x77E6,
+0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x35DE, 0x77DE, 0x97DE, 0x97E6,
+0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0xB8E6,
+0xB7E6, 0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x35D6, 0x56DE, 0x97E6,
+0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6,
+0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0xB8E6,
+0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0x97E6, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x76DE, 0x56DE, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x15D6,
+0x15D6, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0xB8E6, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x96DE, 0x98E6,
+0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5,
+0xF1AC, 0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x98E6, 0x96E6,
+0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xB0A4, 0x0E94, 0x56DE, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD,
+0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6, 0xB7E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0xB8E6, 0x98E6, 0x97E6, 0x98E6,
+0x77DE, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x96DE, 0x96DE,
+0x97DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x32B5, 0x32B5,
+0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x97DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6,
+0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC,
+0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0xF5D5, 0xD4CD, 0x52BD, 0x52BD, 0x32BD, 0xB0AC, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0x77DE, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x76DE, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x6F9C, 0x2F94, 0xAD7B,
+0x8C7B, 0x56DE, 0x36DE, 0x36D6, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x77E6, 0x77DE,
+0x15D6, 0x8FA4, 0x8FA4, 0x15D6, 0xF5CD, 0x32B5, 0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD,
+0x77DE, 0xD4D5, 0x35D6, 0xF5D5, 0x35D6, 0xD4CD, 0x15D6, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5D5, 0x15D6, 0x36D6,
+0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x15D6, 0x56DE, 0xF5D5, 0x36D6, 0x36D6,
+0x35D6, 0x35D6, 0x56DE, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0x55DE, 0x15D6,
+0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0xD5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD,
+0xD5CD, 0x77DE, 0x55DE, 0xEE8B, 0xCD83, 0x97DE, 0x76DE, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x97E6, 0x98DE, 0x77E6, 0x76DE, 0x76DE,
+0x97DE, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0xD4CD, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6,
+0x56DE, 0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97DE, 0x97DE, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5,
+0xB4C5, 0xB4C5, 0xF5CD, 0x56DE, 0x97E6, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5,
+0x93C5, 0x93BD, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x97E6,
+0x93C5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6,
+0xB7E6, 0x77E6, 0x93C5, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x53BD, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0x36D6, 0x36D6,
+0x15D6, 0x16D6, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6,
+0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6,
+0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x53BD, 0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x55DE,
+0x77DE, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x36D6, 0x97E6, 0x97E6,
+0xD4CD, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x56DE, 0x97DE, 0x98E6, 0x77DE, 0x76DE,
+0x97E6, 0x97DE, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x53BD, 0x32B5, 0x53BD,
+0x53BD, 0x53BD, 0x32B5, 0x2E94, 0x4F9C, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x56DE,
+0x77DE, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0x77DE, 0x97E6, 0x97DE, 0x76E6,
+0x96E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x98E6, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x76E6, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x76DE,
+0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x77DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x77DE, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0xB8E6,
+0x98E6, 0x98E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x12B5, 0xD4CD, 0x56D6, 0x36D6,
+0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB7E6, 0x98DE, 0x77DE, 0x76DE, 0x36D6, 0x36D6, 0xAC83,
+0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6,
+0x77E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0xB4CD, 0x32BD, 0x12B5,
+0xD0AC, 0xB0A4, 0x4F9C, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x16D6, 0x16D6,
+0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x6FA4, 0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0xF5CD, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6,
+0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6,
+0x98E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x97E6, 0x98E6, 0x77DE, 0x56DE,
+0x56DE, 0x36DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x36D6, 0x36D6, 0x16D6, 0x15CE, 0xF5CD, 0x15CE, 0x36D6, 0x56DE,
+0x56DE, 0x35D6, 0x56D6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6,
+0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6,
+0x6F9C, 0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0xD5CD, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x77DE, 0x77DE, 0x56DE, 0x56DE,
+0x56DE, 0x56DE, 0xD5CD, 0xB4C5, 0x53BD, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6,
+0x97E6, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6,
+0xB8E6, 0xD9E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0x96DE, 0x2F94, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0x8C7B, 0xCD8B, 0xB0AC,
+0xB0AC, 0x11B5, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0x98E6, 0x97E6,
+0x97DE, 0x96DE, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x76E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0xD4CD,
+0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6, 0x36D6, 0x56DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x98E6,
+0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6,
+0xB8E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x77DE, 0x97E6,
+0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x76E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x11AD,
+0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1B4, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6,
+0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6,
+0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x12B5, 0x32B5, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x35DE, 0x77DE,
+0x97DE, 0x97E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6,
+0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0x76E6,
+0x77E6, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32BD, 0x35D6, 0x56DE, 0x97E6, 0xB8E6, 0x97E6, 0x76DE,
+0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6,
+0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0xB7E6,
+0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xF5D5, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6,
+0x8C7B, 0x56DE, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x97E6, 0xB7DE,
+0xB8E6, 0xB8E6, 0x97E6, 0xB7DE, 0x97E6, 0x97DE, 0x98E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0xB7E6,
+0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x15D6,
+0xF5CD, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0x36DE, 0x36D6, 0x97DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE,
+0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0xF1AC, 0xB0A4, 0x0E94, 0x35DE, 0x56DE, 0x56DE, 0x56DE, 0x15D6, 0xF5D5,
+0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE,
+0x77DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xF5D5, 0xD4CD, 0x72BD,
+0x32BD, 0x6FA4, 0x2F94, 0xB7E6, 0x96E6, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0xB8E6, 0x98E6, 0x97E6,
+0x98E6, 0x77DE, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0xEE8B, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x77DE, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6,
+0xB8E6, 0x97DE, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11AD, 0x77E6, 0x77DE, 0x57DE,
+0x35DE, 0x36D6, 0x15D6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97DE, 0x98E6, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x97E6,
+0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x6FA4,
+0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x98DE, 0x97E6, 0x76E6, 0x76E6, 0x97E6, 0x76DE,
+0x76DE, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0x8C7B, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x76DE, 0x76DE, 0x77DE,
+0x77DE, 0x77DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0x15D6, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x32B5,
+0x93C5, 0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0x56DE, 0xF5CD, 0x77DE, 0xD4D5, 0x35D6, 0x94C5, 0xD5CD,
+0xF5CD, 0xF5D5, 0x35D6, 0x36D6, 0x56DE, 0x76E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD4CD, 0x15D6, 0xF5D5, 0x36D6, 0x36D6,
+0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x35D6, 0x35D6,
+0x56DE, 0x57DE, 0x57DE, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0x15D6, 0x56DE, 0x56DE,
+0x56DE, 0x77E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0x55DE, 0x15D6,
+0xCD83, 0x6FA4, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98DE, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD,
+0xD4C5, 0x77DE, 0x55DE, 0xEE8B, 0xF1B4, 0xD4CD, 0x35D6, 0x35D6, 0x56DE, 0x98E6, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97E6, 0x97DE,
+0x97E6, 0x97DE, 0x98E6, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x52B5, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0xB4C5, 0xB4C5, 0xB4C5,
+0x93C5, 0x93C5, 0x93C5, 0xD5CD, 0xF5CD, 0x56DE, 0x97E6, 0x96DE, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0x96DE, 0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x93BD, 0x93C5, 0x93C5,
+0x93BD, 0x73BD, 0xF5CD, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x77DE, 0x56DE, 0x77DE,
+0xF5CD, 0x97E6, 0x93C5, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0xB8E6, 0x97DE, 0x76E6, 0x77DE,
+0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x73BD, 0x53BD, 0x52BD, 0x52BD, 0x52BD, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5,
+0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x32B5, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x76DE,
+0x77DE, 0xD5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x76DE,
+0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x53BD,
+0x15D6, 0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6,
+0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76E6, 0x97E6, 0x97DE,
+0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0x96E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD,
+0x32B5, 0x32B5, 0x32B5, 0x2E94, 0x4F9C, 0x4F9C, 0x2F9C, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x55D6, 0x56D6, 0x35D6, 0x56DE,
+0x77DE, 0x96DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xD5CD, 0x96E6, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6,
+0x98E6, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x77DE, 0x57DE, 0x76DE, 0x97DE, 0x97DE,
+0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x97E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0x97E6,
+0xB7E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x96DE,
+0x12B5, 0x11B5, 0x32B5, 0x12B5, 0xF1B4, 0x11B5, 0xD4CD, 0xB4CD, 0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6,
+0x98E6, 0x97E6, 0x97DE, 0x98DE, 0x77DE, 0x76DE, 0x76DE, 0x36D6, 0x53BD, 0xAC83, 0x0E94, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0xB7E6,
+0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x76E6, 0x11B5, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0x32BD, 0x12B5, 0xD0AC, 0xB0A4, 0x4F9C, 0x97E6, 0xB8E6,
+0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x16D6, 0x36D6, 0x52BD, 0xF5CD,
+0xF5D5, 0x36D6, 0x56DE, 0x56DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6,
+0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0x4F9C, 0x4F9C,
+0x4F9C, 0x4F9C, 0x4F9C, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x36D6, 0x36D6,
+0x36D6, 0x16D6, 0x15CE, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6,
+0x98E6, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6,
+0x97E6, 0xB7E6, 0x6F9C, 0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0x36DE, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x97E6, 0x77DE, 0x77DE,
+0x56DE, 0x56DE, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD, 0x8C7B, 0xCD8B, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x98DE, 0xB6E6,
+0x97E6, 0x97E6, 0x97DE, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6,
+0xB8E6, 0xB8E6, 0xD9E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x98E6, 0xD5CD, 0xD0AC, 0x6F9C, 0x2F94, 0x56DE, 0x56DE, 0x36D6, 0xF5CD,
+0x52BD, 0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6,
+0x98E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0x77E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6,
+0x96DE, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0xD4CD, 0x15D6, 0x36D6, 0x56DE, 0x97E6, 0x98E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x97DE,
+0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97DE, 0xB7E6,
+0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0x98E6,
+0x97DE, 0x97DE, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC, 0xD1AC, 0xF1AC, 0x97E6, 0xB7E6,
+0x97DE, 0x97E6, 0x96E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x98E6,
+0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE, 0xF1B4, 0xF1AC,
+0x12B5, 0x32B5, 0x11B5, 0x35DE, 0x77DE, 0x97DE, 0x97E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6,
+0x97E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6,
+0x97E6, 0x76DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x35D6, 0x56DE, 0x76DE, 0xB8E6,
+0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0x55DE, 0xB7E6,
+0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x77DE, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6,
+0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x32BD, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0xF5D5, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x76DE,
+0x56DE, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x97E6, 0xB8E6, 0x97E6, 0xB7DE,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB7E6, 0xB7E6,
+0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x8C7B, 0x15D6, 0x15D6, 0xF5CD, 0xD4CD, 0xB4CD,
+0x76DE, 0x77E6, 0x56DE, 0x57DE, 0x36DE, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6,
+0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x93C5,
+0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x96E6, 0x76DE,
+0x98E6, 0x96E6, 0x97E6, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5,
+0x52BD, 0x32BD, 0x32B5, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0xD4CD, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x96E6, 0xB8E6, 0x97E6,
+0x97E6, 0x96E6, 0x96E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x52BD, 0x32B5,
+0x32B5, 0x32B5, 0x32B5, 0x72BD, 0x32BD, 0x6FA4, 0x2F94, 0xEE8B, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6,
+0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x97DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6,
+0x97DE, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x96E6, 0x96E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x77DE, 0x57DE, 0x35DE, 0x36D6,
+0x15D6, 0x76DE, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6,
+0xB8E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6,
+0x76DE, 0x77E6, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0xD1AC, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94,
+0x6FA4, 0x8C7B, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0x98DE, 0x76DE, 0x76DE, 0x77DE, 0x77DE, 0x76DE, 0x77DE, 0x97E6,
+0x77E6, 0x77DE, 0xAD7B, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x77DE, 0x77DE, 0x56DE, 0x57DE, 0x15D6, 0x15D6, 0xF5CD, 0x32B5,
+0x73C5, 0x35D6, 0x94C5, 0x77DE, 0xF5CD, 0x76DE, 0xF5D5, 0x56DE, 0xF5CD, 0x77DE, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0xD4D5, 0x35D6,
+0x36D6, 0x56DE, 0x76E6, 0x98E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5D5, 0x35D6, 0xF5D5, 0x36D6, 0x36D6, 0x35D6,
+0x35D6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD4CD, 0x15D6, 0x56DE, 0x57DE, 0x57DE, 0x56DE,
+0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0xF5CD, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xF5D5, 0x15D6, 0x56DE, 0x77E6, 0x77E6, 0x97DE,
+0x76DE, 0x97E6, 0x76DE, 0x97DE, 0x97E6, 0x98DE, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0x15D6, 0x56DE, 0xCD83, 0x6FA4, 0xD0AC,
+0x77E6, 0x77E6, 0x76DE, 0x77DE, 0x98E6, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0x55DE, 0x15D6,
+0xF1B4, 0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0xD4CD, 0xD4CD,
+0xB4C5, 0xB4C5, 0xB4C5, 0x77DE, 0x55DE, 0xEE8B, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE,
+0x96E6, 0x96DE, 0x76DE, 0x97E6, 0xB4C5, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x52B5, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x97E6, 0x97E6,
+0x97E6, 0x98E6, 0x96DE, 0xB8E6, 0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x93C5, 0x93BD, 0x93C5,
+0x93C5, 0xD5CD, 0x36D6, 0x36D6, 0xF5CD, 0x56DE, 0x97E6, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD,
+0x76DE, 0x76DE, 0x97E6, 0x98E6, 0x98DE, 0xB8E6, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0xB7E6, 0xB7E6, 0x77E6, 0x97E6, 0x93BD, 0x73BD,
+0x73BD, 0x73BD, 0x53BD, 0xF5CD, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x73BD, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6,
+0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0xF5CD, 0x36D6, 0x93C5, 0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x56DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE,
+0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0x53BD, 0xF5D5,
+0xF5D5, 0x15D6, 0x36D6, 0x15D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6,
+0x98E6, 0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76DE, 0x97E6, 0x97DE, 0x97E6,
+0x98E6, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x97E6, 0x32B5, 0x53BD, 0x53BD, 0x53BD, 0x32B5,
+0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x76DE, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0x36D6,
+0x97E6, 0x97E6, 0xD4CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6,
+0x97DE, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x52BD,
+0x2E94, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x56DE, 0xB8E6,
+0x77DE, 0x97E6, 0x14CE, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x96DE, 0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE,
+0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x96E6, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x11B5,
+0x94C5, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x57DE, 0x57DE, 0x76DE, 0x97DE, 0x56DE, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x97E6, 0x98E6,
+0x97E6, 0xD8E6, 0x98E6, 0xD5CD, 0xAC83, 0x0E94, 0x6FA4, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6,
+0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0xB8E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x32B5, 0x12B5, 0xF1B4, 0x11B5, 0x12B5, 0xD4CD,
+0xB4CD, 0x36D6, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0x97DE, 0x97DE, 0x98DE, 0x77DE, 0x76DE,
+0x96DE, 0x53BD, 0x11B5, 0x52BD, 0xF5CD, 0xF5CD, 0x97DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6,
+0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0x32BD, 0x12B5,
+0xD0AC, 0xB0A4, 0x4F9C, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0x16D6, 0x16D6,
+0x16D6, 0x16D6, 0x36D6, 0x56DE, 0x56DE, 0x35D6, 0x56D6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6,
+0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0x4F9C,
+0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x36D6, 0x36D6,
+0x36D6, 0x36D6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0x98E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x98E6, 0x97DE, 0x98E6, 0x98E6,
+0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6, 0x6F9C,
+0xB0AC, 0x6FA4, 0x32BD, 0xB4CD, 0x36DE, 0xF5D5, 0x52BD, 0xD0AC, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x77DE, 0x16D6, 0x15CE, 0xF5CD,
+0x15CE, 0xD5CD, 0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6,
+0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0xB8E6, 0xB8E6,
+0x77E6, 0xB8E6, 0x98E6, 0xD5CD, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0x36D6, 0xB4C5, 0x53BD, 0x11B5,
+0x93C5, 0xD4CD, 0xD4CD, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0x98E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97DE, 0x96DE,
+0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x32B5,
+0xF5CD, 0x52BD, 0x15D6, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6,
+0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xF1AC,
+0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6,
+0xD9E6, 0x97DE, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x76E6, 0x97E6,
+0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC, 0xB7E6, 0x97DE, 0x97E6, 0x96E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x98E6,
+0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6,
+0x98E6, 0x97E6, 0x98E6, 0xD1AC, 0xF1AC, 0xF1B4, 0xF1AC, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6,
+0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB8E6, 0x98E6,
+0x77DE, 0x98E6, 0xB8E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x12B5, 0x32B5, 0x11B5, 0x32B5, 0x32B5, 0x35D6, 0x56DE, 0x76DE,
+0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0x77DE, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0xB8E6,
+0xB7E6, 0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0x76E6, 0x77E6, 0x98E6,
+0x77E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0xF5D5, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x76DE, 0x56DE, 0xB7E6,
+0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x97DE, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x97DE, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0x77E6, 0xB8E6, 0x32BD, 0x32BD, 0x32B5, 0x32B5,
+0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x8C7B, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0xF5CD, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0xB8E6,
+0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x97DE, 0x97DE, 0x98E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6,
+0x97E6, 0xB7E6, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0xF1AC, 0x57DE, 0x36DE, 0x36DE, 0x36D6,
+0x35DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE, 0x97E6, 0x97DE, 0xB8E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6,
+0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xB0A4, 0x0E94, 0x56DE, 0x56DE, 0x15D6, 0xF5D5, 0x15D6,
+0x97E6, 0x96E6, 0x96DE, 0x96E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0x32BD, 0x97E6, 0x96DE, 0xB7E6,
+0x96E6, 0xB7E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x6FA4, 0x2F94, 0xEE8B, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x77DE,
+0x97DE, 0x77DE, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x97DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x76E6, 0xB8E6,
+0x97E6, 0x97E6, 0x96E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x12B5, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x15D6, 0x76DE, 0x97E6, 0x97E6,
+0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC,
+0xF5D5, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6,
+0x97E6, 0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0xD1AC, 0xF1AC, 0xB0A4, 0x6FA4, 0x8C7B, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x97E6, 0x97E6,
+0x98DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x6F9C, 0x2F94, 0xAD7B, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5,
+0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x77E6, 0x77DE, 0x15D6, 0x8FA4, 0x57DE, 0x15D6, 0xF5CD, 0x32B5, 0x73C5, 0x93C5, 0x94C5,
+0x35D6, 0xF5CD, 0x76DE, 0x94C5, 0xF5D5, 0x56DE, 0x36D6, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x77DE, 0xF5D5, 0xF5D5,
+0x56DE, 0x76E6, 0x98E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD4D5, 0x35D6, 0x36D6, 0x35D6, 0x35D6, 0x56DE, 0x97DE,
+0x97E6, 0xB8E6, 0xB8E6, 0x76DE, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5D5, 0x35D6, 0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x77E6, 0x97E6,
+0x96DE, 0x97E6, 0x97E6, 0xF5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xD4CD, 0x15D6, 0x77E6, 0x97DE, 0x76DE, 0x77E6, 0x76DE, 0x97DE,
+0x97E6, 0x98DE, 0x77E6, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0xF5D5, 0x15D6, 0xCD83, 0x6FA4, 0xD0AC, 0xF1B4, 0x77E6, 0x76DE, 0x77DE,
+0x98E6, 0x77E6, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4C5, 0x15D6, 0x56DE, 0xD4CD, 0x35D6, 0x56DE, 0x77E6,
+0xB7E6, 0x98E6, 0x78E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0xB4C5, 0x55DE, 0x15D6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0x97E6, 0xB4C5, 0xB4C5,
+0xB4C5, 0x93C5, 0x77DE, 0x55DE, 0xEE8B, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x96E6, 0x97E6,
+0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x52B5, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0xED8B, 0x4F9C, 0xF1B4, 0x52BD, 0x76DE,
+0x76DE, 0x97E6, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE, 0x76E6, 0x97E6, 0x76E6, 0xB7E6, 0x77E6, 0x93C5, 0x93BD, 0x73BD, 0x73BD,
+0x73BD, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0xF5CD, 0x56DE, 0x97E6, 0x36D6, 0x57DE, 0x56DE, 0x76DE, 0xD5CD, 0xB4CD, 0xF5CD, 0x15D6,
+0x35D6, 0x98DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x53BD,
+0x52BD, 0x52BD, 0x73BD, 0xF5CD, 0xF5D5, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x73BD, 0x97E6, 0x76DE, 0x97E6,
+0xB8E6, 0xB8E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xF5CD, 0x36D6, 0x93C5, 0x56DE, 0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76DE, 0x97E6,
+0x97DE, 0x97E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x15D6,
+0x36D6, 0x15D6, 0x55DE, 0x55DE, 0x16D6, 0x36D6, 0x15D6, 0x15D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6,
+0x76DE, 0x77DE, 0xD5CD, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x15D6, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76DE,
+0x98E6, 0x76DE, 0x76DE, 0xB8E6, 0x77DE, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x2E94,
+0x77DE, 0x97E6, 0x76DE, 0x97E6, 0x15D6, 0x36D6, 0x56DE, 0x55D6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0x36D6, 0x97E6, 0x97E6,
+0xD4CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0x77DE,
+0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x98E6, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x2E94, 0x4F9C, 0x2F9C, 0x8FA4,
+0xB0A4, 0x97E6, 0x98E6, 0x35D6, 0x76DE, 0x56D6, 0x35D6, 0x56DE, 0x77DE, 0x56DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0xB8E6, 0xB8E6,
+0x98E6, 0xB8E6, 0x98E6, 0xAC83, 0x96E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x98E6, 0x98E6,
+0x77E6, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x15D6, 0x36D6, 0x56D6, 0x36D6, 0x77DE, 0x57DE,
+0x76DE, 0x97DE, 0x97E6, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x97E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0xD5CD, 0x0E94, 0x6FA4, 0xF1AC,
+0x11B5, 0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6, 0x96DE,
+0x97E6, 0x97E6, 0x97E6, 0x12B5, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0xD4CD, 0xB4CD, 0x32BD, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x77DE, 0x97DE, 0x98DE, 0x77DE, 0x98E6, 0x96DE, 0x53BD, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x56DE,
+0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x76E6, 0x98E6,
+0xB7E6, 0xB7E6, 0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x12B5, 0xD0AC, 0xB0A4, 0x4F9C, 0x97E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6,
+0xB8E6, 0x56DE, 0x56DE, 0x36D6, 0x36D6, 0x16D6, 0x16D6, 0x16D6, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x98E6, 0x97E6, 0xB8E6, 0x98E6,
+0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6,
+0x97DE, 0x97E6, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6,
+0x16D6, 0x36D6, 0x36D6, 0x36D6, 0x8C7B, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x97E6, 0x97DE, 0x98E6,
+0x77E6, 0x97E6, 0xB9E6, 0xB9E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0xB7E6,
+0x6F9C, 0xB0AC, 0x6FA4, 0x32BD, 0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x36D6, 0x16D6, 0x15CE,
+0xF5CD, 0xCD8B, 0xB0AC, 0xB0AC, 0x11B5, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6,
+0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6,
+0xB4CD, 0xD5CD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x2F94, 0x77DE, 0x56DE, 0x56DE, 0x56DE, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD, 0x93C5,
+0xD4CD, 0xD4CD, 0x15D6, 0x36D6, 0x77DE, 0x97DE, 0x98E6, 0x76DE, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97DE, 0x96DE, 0x97E6,
+0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0xD8E6, 0x98E6, 0x96DE, 0xD4CD, 0x11B5, 0x56DE, 0x36D6,
+0xF5CD, 0x52BD, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6,
+0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x77E6, 0x97DE, 0xB8E6, 0x97E6, 0x11AD, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF1AC, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x97E6,
+0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77E6, 0x98E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC,
+0xF1AC, 0x35DE, 0x97DE, 0x97E6, 0x97E6, 0x96E6, 0xB8EE, 0x98E6, 0x97E6, 0xB8E6, 0xD8E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6,
+0xB7E6, 0xB7E6, 0x98E6, 0x98E6, 0x97DE, 0x97E6, 0xB7E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x11AD, 0xF1AC, 0xD1AC,
+0xF1AC, 0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x77E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0x76DE,
+0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0x11B5, 0x35D6, 0x56DE, 0x76DE, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE,
+0xB8E6, 0x77E6, 0x77DE, 0xB8E6, 0x56E6, 0x77DE, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6,
+0xB7E6, 0x97E6, 0x77DE, 0x98E6, 0x77E6, 0x76E6, 0x77E6, 0x11B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xF5D5, 0x76DE, 0x97E6, 0x76DE,
+0x56DE, 0x35D6, 0x76DE, 0x56DE, 0x97E6, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6,
+0xB8E6, 0xB8E6, 0x77E6, 0x77E6, 0x97DE, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x52BD,
+0x32BD, 0x32B5, 0x32BD, 0x35D6, 0xF5D5, 0xD5CD, 0x2E94, 0x8C7B, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x15D6, 0x77DE, 0x77DE, 0x77DE,
+0x76DE, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0x77E6, 0xB8E6, 0xB7E6, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xF5CD, 0xD4CD, 0xB4CD, 0x93C5, 0x77E6, 0x56DE, 0x57DE, 0x36DE,
+0x36DE, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0xB7E6,
+0xB7E6, 0x97E6, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x32B5, 0x11B5, 0xF1AC, 0xB0A4, 0x0E94, 0x36D6, 0x35DE, 0x56DE, 0x56DE, 0x76E6,
+0x76DE, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0x96E6, 0x96DE, 0x96E6, 0x97E6, 0x96DE, 0x77E6, 0x98E6,
+0xB8E6, 0x97E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x52BD,
+0xD4CD, 0x72BD, 0x32BD, 0x6FA4, 0x2F94, 0xB7E6, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0x77DE, 0x98E6,
+0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xEE8B, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x77DE, 0x97E6, 0x76DE, 0x77DE, 0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x97E6, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x97DE, 0x77DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE,
+0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x35DE, 0x36D6, 0x36D6, 0x15D6, 0x76DE, 0x97E6, 0x97E6,
+0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x32B5, 0x12B5, 0x11AD, 0xF1AC, 0xF1AC, 0xD4CD,
+0x52BD, 0x32BD, 0xB0AC, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x97E6,
+0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xD1AC, 0x6FA4, 0x8C7B, 0x97E6, 0x77DE, 0x56DE, 0x36DE, 0x97E6, 0x97E6, 0x98DE, 0x98DE, 0x76DE,
+0x76E6, 0x97E6, 0x76DE, 0x76DE, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xAD7B, 0x36D6, 0x15D6, 0xF5D5, 0x52BD, 0x11B5, 0x77DE, 0x77DE,
+0x77DE, 0x77DE, 0x97E6, 0x77E6, 0x77E6, 0x77DE, 0xAD7B, 0x11B5, 0x8FA4, 0x8FA4, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0x32B5, 0x73C5,
+0x93C5, 0x94C5, 0x35D6, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0x77DE, 0x36D6, 0x56DE, 0x76E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5D5,
+0x56DE, 0x76DE, 0xF5D5, 0x36D6, 0x36D6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x77DE, 0x35D6,
+0x35D6, 0x56DE, 0x57DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xD4D5, 0x35D6, 0x56DE, 0x56DE, 0x77E6,
+0x77E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0xF5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0xF5D5, 0x35D6, 0xCD83, 0x97DE, 0x76DE, 0x77E6, 0x77E6,
+0x97DE, 0x97E6, 0x98DE, 0x98DE, 0xD5CD, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0x15D6, 0x35D6, 0x6FA4, 0xD0AC, 0xF1B4, 0xD4CD, 0x76DE,
+0x77DE, 0x98E6, 0xB7E6, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xF5D5, 0x15D6, 0x35D6, 0x56DE, 0x77E6,
+0x97E6, 0x98E6, 0x78E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0xD4CD, 0xD4CD, 0xB4C5, 0xB4C5, 0x15D6, 0x56DE, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x76DE, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x55DE,
+0x15D6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x93C5,
+0x93BD, 0x77DE, 0x55DE, 0x55DE, 0xED8B, 0x4F9C, 0x4F9C, 0xF1B4, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0xB8E6, 0x97DE,
+0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x93C5, 0x93C5, 0x93BD, 0x73BD, 0xD5CD, 0xD5CD, 0x52B5, 0x36D6, 0xED8B, 0x56DE, 0x55DE, 0x32B5,
+0xB4CD, 0xF5CD, 0x15D6, 0x35D6, 0x98DE, 0x77DE, 0x77DE, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE,
+0x73BD, 0x73BD, 0x53BD, 0x52BD, 0xF5CD, 0xF5D5, 0x36D6, 0x36D6, 0x36D6, 0x36D6, 0xF5CD, 0x56DE, 0x97E6, 0x36D6, 0x57DE, 0x56DE,
+0x76DE, 0xD5CD, 0x56DE, 0x56DE, 0x77DE, 0x97E6, 0x77DE, 0x76DE, 0x97E6, 0x97DE, 0x98E6, 0xB8E6, 0xB8E6, 0x77DE, 0x97E6, 0x97E6,
+0x97DE, 0x97E6, 0x52BD, 0x73BD, 0x53BD, 0x53BD, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x16D6, 0x73BD, 0x73BD,
+0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xD5CD, 0x36D6, 0x93C5, 0x97DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0x76DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x97E6, 0x96E6, 0x96E6, 0x76DE, 0x53BD, 0x32B5, 0x53BD, 0x53BD, 0x15D6,
+0x55DE, 0x55DE, 0x77DE, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76DE,
+0x77DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6,
+0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x2E94, 0x4F9C, 0x97E6, 0x76DE, 0x97E6, 0x97E6,
+0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0x36D6, 0x97E6, 0x97E6, 0xD4CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6,
+0x96DE, 0x96E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE,
+0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x2F9C, 0x8FA4, 0xB0A4, 0x94C5, 0x98E6, 0x35D6, 0x76DE, 0x77DE, 0x35D6, 0x56DE, 0x77DE, 0x56DE,
+0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x15D6, 0xAC83, 0x0E94, 0x6FA4, 0xF1AC, 0xB7E6, 0xB7E6, 0x76E6,
+0x97DE, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0x97DE, 0x96DE, 0x12B5, 0x11B5, 0x32B5,
+0x12B5, 0x36D6, 0x56D6, 0x56D6, 0x36D6, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x97E6, 0x98E6, 0x97E6,
+0xD8E6, 0x98E6, 0xD5CD, 0x52BD, 0x52BD, 0xF5CD, 0xF5D5, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6,
+0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF1B4, 0x11B5, 0x12B5, 0x32B5, 0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0x77DE,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77DE, 0x97DE, 0x98DE, 0x77DE, 0x98E6, 0x96DE, 0x53BD, 0x56DE, 0x56DE,
+0x35D6, 0x56D6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76E6, 0x98E6,
+0xB7E6, 0xB7E6, 0xF5D5, 0x97E6, 0x98E6, 0x97DE, 0x12B5, 0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6,
+0xB8E6, 0x56DE, 0x56DE, 0x36D6, 0x36D6, 0x36D6, 0x16D6, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97DE,
+0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0x4F9C,
+0x4F9C, 0x4F9C, 0x4F9C, 0x4F9C, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x16D6, 0x16D6, 0x36D6, 0x36D6,
+0x8C7B, 0xCD8B, 0xB0AC, 0x76E6, 0xB8E6, 0x77E6, 0x77DE, 0x98DE, 0xB6E6, 0x97E6, 0x97E6, 0x98E6, 0x77E6, 0x97E6, 0x97DE, 0x98E6,
+0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0x32BD,
+0x56DE, 0x36DE, 0xF5D5, 0x52BD, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x36D6, 0x36D6, 0x16D6, 0x15CE, 0xB0AC, 0x11B5, 0x93C5, 0xD4CD,
+0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6,
+0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x32BD, 0xB4CD, 0xD5CD, 0xD0AC, 0xD0AC, 0xD0AC, 0x6F9C, 0x77DE,
+0x77DE, 0x56DE, 0x56DE, 0xF5CD, 0x15CE, 0xD5CD, 0xB4C5, 0xD4CD, 0x15D6, 0x36D6, 0x56DE, 0x97DE, 0x98E6, 0x76DE, 0x98E6, 0x96DE,
+0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0x96DE, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x98E6,
+0x96DE, 0x96DE, 0xD4CD, 0x2F94, 0x56DE, 0x56DE, 0x36D6, 0xF5CD, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE,
+0xB7E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xD8E6, 0x77E6, 0x97DE,
+0xB8E6, 0x32B5, 0x11AD, 0xF1AC, 0xF1AC, 0x52BD, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6,
+0xD9E6, 0x97DE, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF1AC, 0x35DE, 0x77DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xD8E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6,
+0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB7E6, 0x76E6, 0x97E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC,
+0x77DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0xD1AC, 0xF1AC, 0xF1B4,
+0xF1AC, 0x12B5, 0x35D6, 0x56DE, 0x76DE, 0xB8E6, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x77E6, 0x77DE,
+0xB8E6, 0x56E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE, 0x76DE, 0xB8E6, 0x77E6, 0x77DE, 0x98E6, 0xB8E6, 0xB7E6, 0x77E6, 0x76DE,
+0x98E6, 0x77E6, 0x12B5, 0x32B5, 0x11B5, 0x32B5, 0x32B5, 0xF5D5, 0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x97DE, 0x76DE, 0x56DE, 0x97E6,
+0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x77E6, 0x97DE, 0x77DE,
+0x77DE, 0xB8E6, 0x98E6, 0x76E6, 0x77E6, 0x98E6, 0x77E6, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0xF5D5, 0xF5D5, 0xD5CD, 0x2E94,
+0x35D6, 0x8C7B, 0x77DE, 0x77DE, 0x36DE, 0x15D6, 0x97E6, 0x77DE, 0x77DE, 0x77DE, 0xB8E6, 0x97E6, 0xB7DE, 0xB8E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x97E6, 0x32BD, 0x32B5, 0x32BD, 0x32BD, 0x32B5, 0x15D6,
+0xF5CD, 0xD4CD, 0xB4CD, 0x76DE, 0x77E6, 0x56DE, 0x57DE, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x97DE, 0x98E6, 0x96DE, 0x98E6, 0x97E6,
+0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4,
+0x36DE, 0x36DE, 0x36D6, 0x35DE, 0x98E6, 0x98E6, 0x76E6, 0x76DE, 0x97DE, 0x97DE, 0xB8E6, 0x76DE, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6,
+0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x0E94, 0x56DE, 0x56DE, 0x15D6, 0xF5D5, 0x97E6, 0x97E6,
+0x96E6, 0x96DE, 0x98E6, 0x96E6, 0x97E6, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x52BD, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0x96E6, 0x97E6, 0x96DE, 0xB7E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6,
+0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x52BD, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x6FA4, 0x2F94, 0xEE8B, 0x96E6,
+0xB7E6, 0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x98E6, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x52BD,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x97DE, 0x77DE, 0x77DE, 0x97E6, 0x76DE, 0x77DE,
+0xB8E6, 0x97E6, 0x96E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x96DE, 0x97DE, 0x97DE,
+0x76DE, 0x98E6, 0x98E6, 0x96E6, 0xB8E6, 0x98E6, 0x76E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x35DE, 0x36D6,
+0x15D6, 0xF5D5, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x96E6, 0x96E6, 0x77DE, 0x97E6, 0x32B5, 0x32B5,
+0x12B5, 0x11AD, 0xF1AC, 0xD4CD, 0x52BD, 0x32BD, 0xB0AC, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x97E6,
+0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x6FA4, 0x8C7B, 0x97E6, 0x97E6, 0x77DE, 0x56DE, 0x98E6, 0x97E6,
+0x97E6, 0x98DE, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0x36DE, 0x36D6, 0x15D6, 0xF5D5, 0x76DE,
+0x76DE, 0x77DE, 0x77DE, 0x76DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0xAD7B, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x77DE, 0x77DE, 0x56DE,
+0x57DE, 0x77DE, 0x15D6, 0x15D6, 0xF5CD, 0x32B5, 0x93C5, 0x36D6, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x94C5, 0x35D6, 0xF5D5, 0x56DE,
+0x76E6, 0x98E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x77DE, 0x36D6, 0x36D6, 0x35D6, 0x35D6, 0x97E6, 0x97DE, 0x97E6,
+0xB8E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5D5, 0x76DE, 0x56DE, 0x57DE, 0x57DE, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0x56DE, 0x56DE, 0x56DE, 0x77E6, 0x77E6, 0x96DE, 0x97E6, 0x97E6, 0x76DE, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0xD4D5,
+0x35D6, 0xCD83, 0x6FA4, 0x97DE, 0x76DE, 0x77E6, 0x77E6, 0x97DE, 0x97E6, 0x98DE, 0x77E6, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0xF5D5,
+0x35D6, 0xD0AC, 0xF1B4, 0xD4CD, 0x35D6, 0x77DE, 0x98E6, 0xB7E6, 0xB7E6, 0x76DE, 0x76DE, 0x97DE, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD,
+0xD4CD, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0x98E6, 0x78E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x97DE, 0x98E6, 0xD4C5, 0xD4CD, 0xD4CD,
+0xB4C5, 0xF5D5, 0x15D6, 0x15D6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0x76DE,
+0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0x15D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x96E6,
+0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x93C5, 0x93BD, 0x55DE, 0x15D6, 0xED8B, 0x4F9C, 0xF1B4, 0x96DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE,
+0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x76E6, 0x93BD, 0x93C5, 0x93C5, 0x93BD, 0x77DE, 0x55DE, 0xB4CD, 0xB4CD, 0xF5CD, 0x15D6,
+0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0xB7E6, 0x77E6, 0x97E6, 0x76DE, 0x73BD, 0x73BD, 0x73BD, 0x53BD, 0xD5CD,
+0x36D6, 0x52B5, 0x36D6, 0xED8B, 0x56DE, 0x55DE, 0x32B5, 0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x98E6, 0x98E6, 0x77DE, 0x76DE, 0x97E6,
+0x77E6, 0x98E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x97DE, 0x52BD, 0x52BD, 0x73BD, 0x53BD, 0xF5CD, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6,
+0x36D6, 0x36D6, 0x56DE, 0xF5CD, 0x56DE, 0x97E6, 0x96DE, 0x57DE, 0x56DE, 0x76DE, 0x32B5, 0x97E6, 0x97DE, 0x76E6, 0x96E6, 0x97DE,
+0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x96E6, 0x53BD, 0x53BD, 0x32B5, 0xF5D5, 0x15D6,
+0x36D6, 0x15D6, 0x36D6, 0x15D6, 0x16D6, 0x36D6, 0x73BD, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0x96DE, 0x77DE, 0x56DE, 0x77DE, 0xD5CD,
+0x36D6, 0x93C5, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x76DE, 0x97E6, 0x97E6,
+0x97E6, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x55DE, 0x55DE, 0x77DE, 0x97E6, 0x15D6, 0x15D6, 0x15D6, 0x36D6, 0x32B5, 0x35D6, 0x97E6,
+0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x98E6, 0x76DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x96DE, 0x96E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0x97DE, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x96E6, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x2E94,
+0x4F9C, 0x2F9C, 0x76DE, 0x97E6, 0x97E6, 0x36D6, 0x56DE, 0x55D6, 0x56D6, 0x98E6, 0x97E6, 0x97E6, 0x96DE, 0x36D6, 0x97E6, 0x97E6,
+0xD4CD, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x15D6, 0xAC83, 0x0E94, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE,
+0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0x98E6, 0x77DE, 0x96E6, 0x97E6, 0x32B5, 0x32B5, 0x12B5, 0x11B5, 0x8FA4, 0xB0A4, 0x94C5, 0x98E6,
+0x35D6, 0x76DE, 0x77DE, 0x35D6, 0x56DE, 0x77DE, 0x56DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x15D6,
+0x6FA4, 0xF1AC, 0x11B5, 0x52BD, 0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0xB9E6, 0x97E6, 0x97E6, 0x76DE, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6,
+0x97DE, 0x96DE, 0x97E6, 0x97E6, 0x32B5, 0x12B5, 0xF1B4, 0x36D6, 0x36D6, 0x56D6, 0x36D6, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x77DE,
+0x96DE, 0x75DE, 0x56DE, 0x97E6, 0x98E6, 0x97E6, 0xD8E6, 0x98E6, 0xD5CD, 0xF5D5, 0x36D6, 0x56DE, 0x56DE, 0x97E6, 0x97E6, 0xB8E6,
+0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x11B5, 0x12B5, 0x32B5, 0xF5D5,
+0xD4CD, 0xB4CD, 0x32BD, 0x12B5, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x77DE, 0x97DE, 0x98DE, 0x77DE,
+0x98E6, 0x96DE, 0x53BD, 0x35D6, 0x56D6, 0x56DE, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6,
+0x98E6, 0xB8E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x77E6, 0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0xB8E6, 0xB7E6,
+0xB7E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x56DE, 0x76DE, 0x36D6, 0x36D6, 0x36D6, 0x76DE, 0x76DE, 0x76DE, 0x76E6, 0x98E6, 0x77E6, 0x97E6,
+0x98DE, 0xB8E6, 0x98E6, 0x97DE, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97DE, 0x97E6,
+0xB8E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x16D6, 0x16D6, 0x16D6, 0x36D6,
+0x8C7B, 0xCD8B, 0xB0AC, 0xB0AC, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0x77E6, 0x97E6, 0x97DE, 0xB8E6,
+0x97E6, 0x98E6, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0x56DE,
+0x56DE, 0x36DE, 0xF5D5, 0x77E6, 0x97E6, 0x97E6, 0x96E6, 0x36D6, 0x36D6, 0x36D6, 0x16D6, 0x11B5, 0x93C5, 0xD4CD, 0xD4CD, 0x97E6,
+0x98E6, 0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x32BD, 0xB4CD, 0xD5CD, 0x52BD, 0xD0AC, 0xD0AC, 0xD0AC, 0x97E6, 0x77DE, 0x77DE,
+0x56DE, 0x15CE, 0xF5CD, 0x15CE, 0x15D6, 0x36D6, 0x56DE, 0x97E6, 0x98E6, 0x76DE, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE,
+0x96DE, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x98E6, 0x96DE, 0xD4CD, 0xD4CD, 0x6F9C,
+0x2F94, 0x56DE, 0x56DE, 0x56DE, 0x56DE, 0xD5CD, 0xB4C5, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6,
+0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xD8E6, 0x77E6, 0x97DE, 0xB8E6,
+0x32B5, 0x11AD, 0xF1AC, 0x36D6, 0xF5CD, 0x52BD, 0xB8E6, 0x97E6, 0xB7E6, 0x97DE, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6,
+0xD9E6, 0x97DE, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0xF1AC, 0xF1AC, 0xF1AC,
+0xF1AC, 0x35DE, 0x77DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0x97E6, 0xB8E6, 0xD8E6, 0x97E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6,
+0xB7E6, 0xB7E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x11AD, 0x97DE, 0x97E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97DE, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6,
+0xB8E6, 0xB7E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0xF1AC, 0xD1AC, 0xF1AC, 0xF1B4, 0x35D6, 0x56DE, 0x76DE,
+0x76DE, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x77E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6,
+0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0x98E6, 0x77E6, 0x76DE, 0x98E6, 0xF1AC, 0x12B5, 0x32B5, 0xF5D5,
+0x76DE, 0x97E6, 0x76DE, 0x56DE, 0x97DE, 0x76DE, 0x56DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x56E6, 0x77DE, 0x55DE, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0x97E6, 0x77DE, 0xB8E6, 0x77E6, 0x77E6, 0x76E6, 0x77E6, 0x11B5, 0x32B5,
+0x32B5, 0x32B5, 0xF5D5, 0xD5CD, 0x2E94, 0x8C7B, 0x96E6, 0x77DE, 0x77DE, 0x36DE, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x97E6, 0xB8E6,
+0x97E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x98E6, 0xB7E6, 0x32B5, 0x52BD, 0x32BD,
+0x32B5, 0x15D6, 0x15D6, 0xF5CD, 0x77DE, 0x77DE, 0x76DE, 0x77E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6,
+0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x32BD, 0x32B5, 0x32B5, 0x32B5, 0xB4CD, 0x93C5, 0x93C5, 0x11B5,
+0x56DE, 0x57DE, 0x36DE, 0x36DE, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6,
+0xB7E6, 0x97E6, 0xB7E6, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0xB0A4, 0x0E94, 0x35DE, 0x56DE, 0x56DE, 0x56DE, 0x76E6, 0x76DE, 0x97E6,
+0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0xF5D5, 0x15D6, 0xF5D5, 0x96E6, 0x96DE, 0x96DE, 0x96E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0xD4CD, 0x72BD, 0x32BD, 0x6FA4, 0x96DE, 0xB7E6, 0x96E6, 0xB7E6, 0x97E6,
+0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x32BD, 0x32B5, 0x32B5, 0x52BD, 0x2F94,
+0xEE8B, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x97E6, 0x98E6, 0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6,
+0x52BD, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x77DE, 0x96DE, 0x97E6, 0x76DE, 0x77DE, 0x77DE, 0x97E6,
+0x96E6, 0x96E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x77E6, 0x77DE, 0x57DE, 0x96DE, 0x97DE, 0x97DE, 0x76DE, 0x98E6,
+0x96E6, 0xB8E6, 0x97DE, 0x76E6, 0xB8E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x35DE, 0x36D6, 0x15D6, 0xF5D5, 0x97E6,
+0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x32B5, 0x12B5, 0x11AD, 0xD4CD, 0x52BD,
+0x32BD, 0xB0AC, 0x96DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0xF1AC, 0xF1AC, 0xF1AC,
+0xF1AC, 0x6FA4, 0x8C7B, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x76DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0xF1AC,
+0xD1AC, 0xF1AC, 0xB0A4, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0x98DE, 0x76DE, 0x76DE, 0x77DE, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x6F9C,
+0x2F94, 0xAD7B, 0x52BD, 0x11B5, 0x8FA4, 0x8FA4, 0x77DE, 0x77DE, 0x77DE, 0x56DE, 0x77E6, 0x77DE, 0x15D6, 0x15D6, 0xF5CD, 0x94C5,
+0xD5CD, 0x36D6, 0x56DE, 0xF5CD, 0xF5CD, 0xF5CD, 0x32B5, 0x93C5, 0xF5D5, 0x36D6, 0x36D6, 0x98E6, 0x98E6, 0x97E6, 0xF5CD, 0xF5CD,
+0xF5CD, 0xF5CD, 0x73C5, 0x35D6, 0x35D6, 0x35D6, 0x56DE, 0x97DE, 0x97E6, 0xB8E6, 0x76DE, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0x77DE,
+0x57DE, 0x57DE, 0x56DE, 0x56DE, 0x97E6, 0x97E6, 0x96DE, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0xF5D5, 0x76DE, 0x77E6, 0x77E6, 0x97DE,
+0x97E6, 0x97E6, 0x76DE, 0x97DE, 0xD5CD, 0xF5CD, 0xD5CD, 0xF5CD, 0x56DE, 0xCD83, 0x6FA4, 0x76DE, 0x77E6, 0x77E6, 0x76DE, 0x97E6,
+0x98DE, 0x77E6, 0xD5CD, 0xD5CD, 0xD5CD, 0xD4CD, 0xD4D5, 0x77DE, 0xD0AC, 0xF1B4, 0xD4CD, 0x76DE, 0x77DE, 0x98E6, 0xB7E6, 0x76DE,
+0x76DE, 0x97DE, 0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0xF5D5, 0x35D6, 0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x78E6, 0x78E6, 0x98E6, 0x97DE,
+0x97DE, 0x97E6, 0x97DE, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xD4CD, 0x35D6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6,
+0x77DE, 0x77DE, 0x96E6, 0x96DE, 0xB4C5, 0xB4C5, 0xB4C5, 0xF5D5, 0x15D6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE,
+0x98E6, 0x97E6, 0x96E6, 0x97E6, 0xB4C5, 0xB4C5, 0x93C5, 0x93C5, 0x15D6, 0x56DE, 0xED8B, 0x4F9C, 0xF1B4, 0x96DE, 0x76DE, 0x76DE,
+0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x93BD, 0x93C5, 0x93C5, 0x55DE, 0x15D6, 0x52BD, 0xB4CD, 0xF5CD,
+0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x76E6, 0x77DE, 0xB8E6, 0xB7E6, 0x77E6, 0x97E6, 0x93BD, 0x73BD, 0x73BD, 0x73BD, 0x77DE,
+0x55DE, 0x15D6, 0x35D6, 0x56DE, 0x56DE, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x98E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6,
+0x53BD, 0x52BD, 0x52BD, 0xD5CD, 0x36D6, 0x36D6, 0x36D6, 0x52B5, 0x36D6, 0xED8B, 0xED8B, 0x56DE, 0x55DE, 0xEE8B, 0x97E6, 0x97DE,
+0x76E6, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x77DE, 0x77DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x73BD, 0x53BD, 0x53BD, 0x53BD,
+0xF5D5, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x56DE, 0xF5CD, 0x56DE, 0x97E6, 0x96DE, 0x57DE, 0x56DE, 0x76DE, 0x32B5,
+0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x97E6, 0x96E6, 0x76DE, 0x97E6, 0x32B5,
+0x53BD, 0x53BD, 0x36D6, 0x15D6, 0x55DE, 0x15D6, 0x16D6, 0x36D6, 0x15D6, 0x73BD, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x77DE,
+0x56DE, 0x77DE, 0xD5CD, 0x36D6, 0x93C5, 0xB8E6, 0x98E6, 0x96DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0x98E6, 0x77E6,
+0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x32B5, 0x32B5, 0x32B5, 0x55DE, 0x77DE, 0x97E6, 0x76DE, 0x15D6, 0x15D6, 0x36D6, 0x32B5, 0x35D6,
+0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0xAC83, 0x96E6, 0x97E6,
+0x97E6, 0xB7E6, 0x97DE, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x76E6, 0x96E6, 0x98E6, 0x77DE, 0x32B5, 0x52BD, 0x32B5,
+0x2E94, 0x4F9C, 0x2F9C, 0x8FA4, 0x97E6, 0x97E6, 0x98E6, 0x56DE, 0x55D6, 0x56D6, 0x35D6, 0x97E6, 0x97E6, 0x96DE, 0x36D6, 0x97E6,
+0x97E6, 0xD4CD, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x15D6, 0x0E94, 0x6FA4, 0xF1AC, 0x11B5, 0xB7E6, 0x76E6, 0x97DE, 0xB8E6, 0x77DE,
+0xB9E6, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0x77DE, 0x96E6, 0x97E6, 0x97DE, 0x32B5, 0x12B5, 0x11B5, 0x32B5, 0x8FA4, 0xB0A4, 0x94C5,
+0x15D6, 0x35D6, 0x76DE, 0x77DE, 0x57DE, 0x56DE, 0x77DE, 0x56DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0xB8E6, 0xB8E6, 0x98E6, 0xB8E6,
+0x15D6, 0x11B5, 0x52BD, 0xF5CD, 0xF5D5, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x97E6,
+0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x12B5, 0xF1B4, 0x11B5, 0xD4CD, 0x36D6, 0x56D6, 0x36D6, 0x57DE, 0x76DE, 0x97DE, 0x97E6, 0x77DE,
+0x96DE, 0x75DE, 0x56DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0xD5CD, 0x56DE, 0x56DE, 0x35D6, 0x35D6, 0xB8E6, 0xB8E6, 0x97E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x76E6, 0x98E6, 0x12B5, 0x32B5, 0xF5D5, 0x97E6, 0xB4CD,
+0x32BD, 0x12B5, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x77DE, 0x97DE, 0x98DE, 0xD8E6, 0x98E6, 0x96DE,
+0x53BD, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6,
+0xB7E6, 0xB7E6, 0x97E6, 0x98E6, 0x98E6, 0x97DE, 0x77E6, 0xD0AC, 0xB0A4, 0x4F9C, 0x4F9C, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6,
+0xB8E6, 0x56DE, 0x77DE, 0x76DE, 0x36D6, 0x36D6, 0x8C7B, 0xCD8B, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x98E6,
+0x97DE, 0x98E6, 0x77E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x4F9C, 0x4F9C,
+0x4F9C, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x16D6, 0x16D6, 0x16D6, 0xB0AC, 0xB0AC, 0x11B5, 0x77E6,
+0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0x97E6,
+0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x6FA4, 0x56DE, 0x56DE, 0x36DE, 0x56DE, 0x77E6, 0x97E6, 0x97E6,
+0x36D6, 0x36D6, 0x36D6, 0x36D6, 0x93C5, 0xD4CD, 0xD4CD, 0x15D6, 0x98E6, 0x77DE, 0x97DE, 0x98E6, 0x97E6, 0xB8E6, 0x96DE, 0x98E6,
+0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x32BD, 0xB4CD,
+0xD5CD, 0xF5D5, 0x52BD, 0xD0AC, 0xD0AC, 0x96E6, 0x97E6, 0x77DE, 0x77DE, 0x16D6, 0x15CE, 0xF5CD, 0x36D6, 0x56DE, 0x97E6, 0x98E6,
+0x76DE, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0x77E6,
+0x97E6, 0x76DE, 0x98E6, 0x96DE, 0xD4CD, 0xD0AC, 0x6F9C, 0x2F94, 0x77DE, 0x56DE, 0x56DE, 0x56DE, 0x15CE, 0xD5CD, 0xB4C5, 0x53BD,
+0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6,
+0xD8E6, 0xB7E6, 0x76DE, 0xD8E6, 0x77E6, 0x97DE, 0x11B5, 0x32B5, 0x11AD, 0xF1AC, 0x56DE, 0x36D6, 0xF5CD, 0x52BD, 0x97E6, 0xB7E6,
+0x97DE, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xD9E6, 0x97DE, 0x97E6, 0x77DE, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6,
+0xB8E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x52BD, 0x35DE, 0x77DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0x97E6, 0xB8E6,
+0xD8E6, 0x98E6, 0x76DE, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x76E6, 0x97E6,
+0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6,
+0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0xF1AC, 0x11AD, 0xF1AC,
+0xD1AC, 0x35D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x96DE, 0x97E6, 0x77E6, 0x77DE, 0x97E6,
+0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB8E6, 0x98E6, 0x77DE, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0xF1AC, 0xF1B4,
+0xF1AC, 0x12B5, 0xF5D5, 0x35D6, 0x97E6, 0x76DE, 0x56DE, 0x56DE, 0x97DE, 0x76DE, 0x56DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x56E6,
+0x77DE, 0x55DE, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0x98E6, 0x77E6, 0x76E6,
+0x12B5, 0x32B5, 0x11B5, 0x32B5, 0xF5D5, 0xD5CD, 0x2E94, 0x8C7B, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6,
+0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97DE, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x77E6, 0x97E6, 0x32B5, 0x32B5,
+0x52BD, 0x52BD, 0x15D6, 0x15D6, 0x15D6, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0x32BD, 0x32B5, 0x32BD, 0x32BD, 0xD4CD, 0xB4CD, 0x93C5, 0x11B5, 0x56DE,
+0x57DE, 0x57DE, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x97DE, 0x98E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB7E6,
+0xB7E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xF1AC, 0xB0A4, 0x0E94, 0x36DE, 0x36D6, 0x35DE, 0x56DE, 0x98E6, 0x76E6, 0x76E6, 0x76DE,
+0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0x56DE, 0x15D6,
+0xF5D5, 0x97E6, 0x97E6, 0x96E6, 0x96DE, 0x98E6, 0x96E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x97E6,
+0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0xD4CD, 0x72BD, 0x96E6, 0x97E6, 0x96DE, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x96DE,
+0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x6FA4, 0x2F94, 0xB7E6, 0x96E6, 0xB7E6,
+0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x97DE, 0x77DE, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x32BD, 0x32B5, 0x32B5, 0xEE8B,
+0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x77DE, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x32B5, 0x32B5,
+0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x77DE, 0x96DE, 0x96DE, 0x76DE, 0x77DE, 0x77DE, 0x97E6, 0x96E6, 0x98E6,
+0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x77E6, 0x77DE, 0x57DE, 0x96DE, 0x97DE, 0x97DE, 0x76DE, 0x98E6, 0x96E6, 0xB8E6, 0x97DE, 0x76E6,
+0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0x36D6, 0x15D6, 0x15D6, 0xF5D5, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE,
+0x98E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x32B5, 0x32B5, 0x12B5, 0x52BD, 0x32BD, 0xB0AC, 0x96DE, 0x97E6, 0xB8E6, 0xB8E6, 0x76DE,
+0x97E6, 0x76DE, 0x77E6, 0x97E6, 0x97E6, 0x98E6, 0x11AD, 0xF1AC, 0xF1AC, 0xF1AC, 0x6FA4, 0x8C7B, 0x97E6, 0x97E6, 0x77DE, 0x56DE,
+0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0xD1AC, 0x56DE, 0x36DE, 0x36D6, 0x15D6, 0x98DE, 0x76DE,
+0x76DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xF1AC, 0xB0A4, 0x6F9C, 0x2F94, 0xF5D5, 0x52BD, 0x11B5, 0x8FA4, 0x77DE, 0x77DE, 0x77DE,
+0x97E6, 0x77E6, 0x77DE, 0x15D6, 0x8FA4, 0x8FA4, 0x56DE, 0x57DE, 0x15D6, 0xF5CD, 0xF5CD, 0x94C5, 0xD5CD, 0xF5CD, 0xF5CD, 0x36D6,
+0x56DE, 0x76E6, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5D5, 0x36D6, 0x36D6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0xF5CD, 0xF5CD, 0xF5CD,
+0x32B5, 0x93C5, 0x35D6, 0x35D6, 0x56DE, 0x57DE, 0x97E6, 0xB8E6, 0x76DE, 0xF5CD, 0xF5CD, 0xF5CD, 0x73C5, 0x35D6, 0x57DE, 0x56DE,
+0x56DE, 0x77E6, 0x97E6, 0x97E6, 0x96DE, 0xF5CD, 0xF5CD, 0xF5CD, 0xD5CD, 0x94C5, 0x77DE, 0x77E6, 0x97DE, 0x76DE, 0x97E6, 0x76DE,
+0x97DE, 0xD5CD, 0xD5CD, 0xF5CD, 0xD5CD, 0xF5D5, 0x76DE, 0x76DE, 0xCD83, 0x6FA4, 0xD0AC, 0x77E6, 0x77E6, 0x76DE, 0x97E6, 0x98DE,
+0x77E6, 0x76DE, 0xD5CD, 0xD5CD, 0xD4CD, 0xF5CD, 0x56DE, 0xF1B4, 0xD4CD, 0x35D6, 0x77DE, 0x98E6, 0xB7E6, 0x98E6, 0x76DE, 0x97DE,
+0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4D5, 0x77DE, 0x56DE, 0x77E6, 0x97E6, 0x98E6, 0x78E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x97DE,
+0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xD4D5, 0x35D6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x96E6,
+0x96DE, 0xB4C5, 0xB4C5, 0xB4C5, 0xD4CD, 0x35D6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6,
+0xB4C5, 0xB4C5, 0x93C5, 0xF5D5, 0x15D6, 0xED8B, 0x4F9C, 0xF1B4, 0x96DE, 0x76DE, 0x76DE, 0x98E6, 0x76DE, 0x77E6, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x93BD, 0x93C5, 0x15D6, 0x15D6, 0x52BD, 0xB4CD, 0xF5CD, 0x97E6, 0x98E6, 0x98DE, 0x77DE, 0x97DE,
+0x76E6, 0x77DE, 0x76E6, 0xB7E6, 0x77E6, 0x93C5, 0x93BD, 0x93BD, 0x73BD, 0x55DE, 0x15D6, 0x15D6, 0x35D6, 0x56DE, 0x77DE, 0x97DE,
+0x98E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x97E6, 0x73BD, 0x53BD, 0x52BD, 0xD5CD, 0x36D6, 0x77DE, 0x55DE,
+0x56DE, 0x77DE, 0x97E6, 0x97DE, 0x76DE, 0x97E6, 0x97DE, 0x98E6, 0xB8E6, 0x77DE, 0x77DE, 0x97E6, 0x97DE, 0x97E6, 0x52BD, 0x73BD,
+0x53BD, 0xF5CD, 0xF5D5, 0x36D6, 0x36D6, 0x36D6, 0xF5CD, 0x52B5, 0xED8B, 0x56DE, 0x55DE, 0xEE8B, 0x96E6, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x53BD, 0x53BD, 0x32B5, 0x53BD, 0xF5D5, 0xF5D5, 0xF5D5,
+0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x56DE, 0x76DE, 0x56DE, 0x97E6, 0x96DE, 0x57DE, 0x56DE, 0x76DE, 0x32B5, 0x32B5, 0x97E6, 0xB8E6,
+0x98E6, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x53BD, 0x32B5, 0x15D6,
+0x55DE, 0x55DE, 0x16D6, 0x36D6, 0x36D6, 0x15D6, 0x73BD, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x77DE, 0x56DE, 0x77DE, 0xD5CD,
+0x36D6, 0x93C5, 0x96DE, 0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6,
+0x32B5, 0x32B5, 0x32B5, 0x2E94, 0x77DE, 0x97E6, 0x76DE, 0x15D6, 0x15D6, 0x36D6, 0x56DE, 0x35D6, 0x97E6, 0x97E6, 0x98E6, 0x97E6,
+0x98E6, 0xB8E6, 0x98E6, 0x76DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x97E6, 0xAC83, 0x0E94, 0x6FA4, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6,
+0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0x98E6, 0x77DE, 0x77DE, 0x52BD, 0x32B5, 0x32B5, 0x4F9C, 0x2F9C, 0x8FA4,
+0x97E6, 0x97E6, 0x98E6, 0x35D6, 0x55D6, 0x56D6, 0x35D6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xD5CD, 0x97E6,
+0xB7E6, 0x97E6, 0x15D6, 0xF1AC, 0x11B5, 0x52BD, 0xF5CD, 0x97DE, 0x97DE, 0xB8E6, 0xB9E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6,
+0xB8E6, 0x97E6, 0x97DE, 0x96DE, 0x12B5, 0x11B5, 0x32B5, 0x32B5, 0xB0A4, 0x94C5, 0x15D6, 0x36D6, 0x76DE, 0x77DE, 0x57DE, 0x56DE,
+0x77DE, 0x56DE, 0xB8E6, 0x77DE, 0x97E6, 0x14CE, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0x15D6, 0x15D6, 0xF5D5, 0xF5D5, 0x36D6, 0x56DE,
+0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF1B4, 0x11B5,
+0x12B5, 0xD4CD, 0x36D6, 0x56D6, 0x36D6, 0x56DE, 0x76DE, 0x97DE, 0x97E6, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x97E6, 0x98E6, 0x97E6,
+0xB8E6, 0x98E6, 0xD5CD, 0x35D6, 0x56D6, 0x56DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6,
+0x97E6, 0x76E6, 0x98E6, 0xB7E6, 0x32B5, 0xF5D5, 0x97E6, 0xB4CD, 0x32BD, 0x12B5, 0xD0AC, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6,
+0xB8E6, 0x98E6, 0x77DE, 0x97DE, 0x98DE, 0xD8E6, 0x98E6, 0x96DE, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0xB8E6,
+0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x97E6, 0x98E6, 0x98E6, 0x97DE, 0x77E6, 0xB8E6, 0xB0A4, 0x4F9C, 0x4F9C,
+0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77DE, 0x76DE, 0x36D6, 0x53BD, 0x8C7B, 0xCD8B, 0xB0AC, 0x76E6, 0xB8E6,
+0x77E6, 0x77DE, 0x98DE, 0xB6E6, 0x97E6, 0x97DE, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6,
+0x97DE, 0x97E6, 0xB8E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0x97E6, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x16D6, 0x16D6, 0x16D6,
+0xB0AC, 0x11B5, 0x93C5, 0xD4CD, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6,
+0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x77DE, 0x56DE, 0x56DE, 0x36DE, 0x56DE,
+0x77E6, 0x97E6, 0x16D6, 0x36D6, 0x36D6, 0x36D6, 0xD4CD, 0xD4CD, 0x15D6, 0x36D6, 0x77DE, 0x97DE, 0x98E6, 0x97E6, 0xB8E6, 0x96DE,
+0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xD9E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x6FA4, 0x32BD,
+0xB4CD, 0xD5CD, 0xF5D5, 0x52BD, 0xD0AC, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x36D6, 0x16D6, 0x15CE, 0x97E6, 0x97E6, 0x97E6, 0x76DE,
+0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0x77E6, 0x97E6,
+0xB8E6, 0x98E6, 0x96DE, 0xD4CD, 0xD0AC, 0xD0AC, 0x6F9C, 0x77DE, 0x77DE, 0x56DE, 0x56DE, 0xF5CD, 0x15CE, 0xD5CD, 0x97E6, 0x98E6,
+0xB8E6, 0x97DE, 0xB7E6, 0xB7E6, 0x98E6, 0xB7E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xD8E6, 0xB7E6, 0x76DE,
+0xD8E6, 0x77E6, 0xD4CD, 0x11B5, 0x32B5, 0x11AD, 0x56DE, 0x56DE, 0x36D6, 0xB4C5, 0x53BD, 0x97E6, 0xB7E6, 0x97DE, 0x97E6, 0xB8E6,
+0x97E6, 0x98E6, 0xB8E6, 0xD9E6, 0xD9E6, 0xB8E6, 0x97E6, 0x77DE, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6,
+0xF1AC, 0xF1AC, 0xF1AC, 0x52BD, 0x52BD, 0x35DE, 0x77DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0x97E6, 0xB8E6, 0xD8E6, 0x98E6, 0x76DE,
+0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x97DE,
+0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6,
+0x97E6, 0xB7E6, 0xB7E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0x11AD, 0xF1AC, 0x56DE, 0x76DE, 0x76DE, 0x76DE, 0x97E6,
+0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE,
+0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0xD1AC, 0xF1AC, 0xF1B4, 0xF5D5, 0x35D6, 0x97E6, 0x76DE, 0x56DE, 0x35D6,
+0x76DE, 0x56DE, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0x56E6, 0x77DE, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6,
+0x98E6, 0xB8E6, 0xB7E6, 0x77E6, 0x76DE, 0x98E6, 0x77E6, 0x12B5, 0x12B5, 0x32B5, 0xF5D5, 0xD5CD, 0x2E94, 0x8C7B, 0x96E6, 0x77DE,
+0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x77E6, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0x76E6,
+0x77E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x36DE, 0x15D6, 0x15D6, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x98E6, 0x32B5, 0x52BD, 0x32BD, 0x32B5, 0xF5CD, 0xD4CD, 0xB4CD,
+0x93C5, 0x77E6, 0x56DE, 0x57DE, 0xB8E6, 0x97E6, 0xB7DE, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6,
+0x77E6, 0xB8E6, 0x32BD, 0x32BD, 0x32B5, 0x93C5, 0x11B5, 0xF1AC, 0xB0A4, 0x36DE, 0x36DE, 0x36D6, 0x97DE, 0x98E6, 0x98E6, 0x76E6,
+0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x0E94, 0x35DE, 0x56DE,
+0x56DE, 0x76E6, 0x76DE, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB7E6, 0x32B5,
+0x32BD, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0x15D6, 0xF5D5, 0x96E6, 0x96DE, 0x96E6, 0x96E6, 0x97E6, 0x77E6, 0x98E6, 0x97DE, 0xB8E6,
+0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5, 0xD4CD, 0x72BD, 0x32BD, 0x97E6, 0x96DE, 0xB7E6, 0x98E6, 0xB8E6,
+0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x32B5, 0x52BD, 0x52BD, 0x6FA4, 0x2F94, 0xEE8B, 0x96E6,
+0xB7E6, 0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x76DE, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x77DE, 0x97E6, 0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x32B5, 0x32B5, 0x32B5,
+0x32B5, 0x96E6, 0x97E6, 0x77E6, 0x77DE, 0x77DE, 0x96DE, 0x96DE, 0x76DE, 0x77DE, 0x77DE, 0x97E6, 0x96E6, 0x98E6, 0x98E6, 0x32B5,
+0x32B5, 0x32B5, 0x77DE, 0x57DE, 0x35DE, 0x36D6, 0x97DE, 0x76DE, 0x97E6, 0x98E6, 0x96E6, 0xB8E6, 0x98E6, 0x76E6, 0xB8E6, 0x97E6,
+0x32B5, 0x32B5, 0x32B5, 0x36D6, 0x15D6, 0xF5D5, 0xD4CD, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x96E6,
+0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0xB0AC, 0x96DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x97E6, 0x97E6,
+0x98E6, 0x11AD, 0x11AD, 0xF1AC, 0xF1AC, 0x6FA4, 0x8C7B, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x76DE, 0x98E6, 0x97E6, 0xB8E6, 0x97E6,
+0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0xD1AC, 0x56DE, 0x36DE, 0x36D6, 0x97E6, 0x98DE, 0x76DE, 0x76E6, 0x97E6, 0x76DE, 0x76DE, 0xF1AC,
+0xB0A4, 0x6F9C, 0x15D6, 0xF5D5, 0x52BD, 0x76DE, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0x77E6, 0x2F94, 0xAD7B, 0x8FA4, 0x8FA4,
+0x8FA4, 0x77DE, 0x56DE, 0x57DE, 0x77DE, 0x15D6, 0xF5CD, 0xF5CD, 0x94C5, 0x36D6, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5D5, 0x36D6, 0x76E6,
+0x98E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x36D6, 0x36D6, 0x35D6, 0x35D6, 0x97E6, 0x97DE, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x56DE,
+0x57DE, 0x57DE, 0xB8E6, 0x76DE, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x32B5, 0x93C5, 0x56DE, 0x56DE, 0x77E6, 0x97E6, 0x96DE, 0x97E6,
+0xF5CD, 0xF5CD, 0xD5CD, 0x73C5, 0x35D6, 0x35D6, 0xCD83, 0x97DE, 0x97DE, 0x76DE, 0x97E6, 0x76DE, 0x97DE, 0xD5CD, 0xF5CD, 0xD5CD,
+0x94C5, 0x77DE, 0x6FA4, 0xD0AC, 0xF1B4, 0x77E6, 0x76DE, 0x77DE, 0x98DE, 0x98DE, 0x77E6, 0xD5CD, 0xD5CD, 0xD5CD, 0xF5CD, 0x76DE,
+0xD4CD, 0x35D6, 0x56DE, 0x98E6, 0xB7E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0xD4CD, 0xF5CD, 0x56DE, 0x56DE,
+0x77E6, 0x97E6, 0x97E6, 0x78E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x97DE, 0xD4C5, 0xD4CD, 0xD4CD, 0xB4C5, 0xD4D5, 0x77DE, 0x97E6,
+0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x96E6, 0xB4C5, 0xB4C5, 0xB4C5, 0xB4C5, 0xD4D5, 0x35D6, 0x97E6, 0x97E6,
+0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x76DE, 0x97E6, 0x96E6, 0xB4C5, 0xB4C5, 0x93C5, 0xD4CD, 0xF5D5, 0x35D6, 0xED8B, 0x4F9C,
+0xF1B4, 0x96DE, 0x76DE, 0x76DE, 0x96DE, 0x98E6, 0x76DE, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x93BD, 0xF5D5, 0x15D6,
+0x52BD, 0xB4CD, 0xF5CD, 0x97E6, 0x98E6, 0x98DE, 0xB8E6, 0x97DE, 0x76E6, 0x97E6, 0x97E6, 0x76E6, 0xB7E6, 0x93C5, 0x93C5, 0x93BD,
+0x15D6, 0x15D6, 0x15D6, 0x35D6, 0x56DE, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x73BD,
+0x73BD, 0x73BD, 0x55DE, 0x55DE, 0x56DE, 0x56DE, 0x77DE, 0x97E6, 0x77DE, 0x76DE, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x77DE, 0x97E6,
+0x97E6, 0x97DE, 0x52BD, 0x52BD, 0x73BD, 0xD5CD, 0x36D6, 0x36D6, 0x77DE, 0x55DE, 0x97DE, 0x76E6, 0x96E6, 0x97DE, 0x97E6, 0x98E6,
+0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x53BD, 0xF5CD, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0x36D6,
+0x52B5, 0xED8B, 0x56DE, 0x55DE, 0xEE8B, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0x97DE, 0x76DE, 0xB8E6, 0x77DE, 0x96E6,
+0x76DE, 0x97E6, 0x32B5, 0x53BD, 0x53BD, 0xF5D5, 0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x56DE, 0x76DE, 0x56DE, 0x97E6, 0x96DE,
+0x57DE, 0x57DE, 0x56DE, 0x55DE, 0x32B5, 0x98E6, 0x96DE, 0x96E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0x98E6, 0x97E6,
+0x97E6, 0x97E6, 0x53BD, 0x32B5, 0x32B5, 0x55DE, 0x55DE, 0x77DE, 0x16D6, 0x36D6, 0x15D6, 0x32B5, 0x73BD, 0x97E6, 0x98E6, 0x97E6,
+0xB8E6, 0x97E6, 0x77DE, 0x56DE, 0x77DE, 0xD5CD, 0x36D6, 0x93C5, 0xAC83, 0x0E94, 0x97E6, 0x97E6, 0xB7E6, 0x97DE, 0xB8E6, 0xB8E6,
+0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x76E6, 0x96E6, 0x32B5, 0x32B5, 0x52BD, 0x2E94, 0x4F9C, 0x97E6, 0x76DE, 0x97E6, 0x15D6,
+0x36D6, 0x56DE, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x6FA4,
+0xF1AC, 0x11B5, 0xB7E6, 0x76E6, 0x97DE, 0x97DE, 0x77DE, 0xB9E6, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0x77DE, 0x96E6, 0x96E6, 0x32B5,
+0x32B5, 0x32B5, 0x2F9C, 0x8FA4, 0xB0A4, 0x97E6, 0x98E6, 0x35D6, 0x55D6, 0x56D6, 0x35D6, 0x97E6, 0x97E6, 0x96DE, 0xB8E6, 0x36D6,
+0x97E6, 0x97E6, 0xD5CD, 0x97E6, 0xB7E6, 0x97E6, 0x15D6, 0x52BD, 0xF5CD, 0xF5D5, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE,
+0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0x96DE, 0x97E6, 0x11B5, 0x32B5, 0x32B5, 0x12B5, 0x94C5, 0x15D6, 0x36D6, 0x76DE, 0x77DE,
+0x57DE, 0x56DE, 0x77DE, 0x56DE, 0x77DE, 0x77DE, 0x97E6, 0x14CE, 0xB8E6, 0xB8E6, 0x98E6, 0xB7E6, 0x98E6, 0x15D6, 0x56DE, 0x56DE,
+0x56DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF1B4, 0x11B5,
+0x12B5, 0x32B5, 0xD4CD, 0xD4CD, 0x56D6, 0x36D6, 0x56DE, 0x76DE, 0x97DE, 0x97E6, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x97E6, 0x98E6,
+0x97E6, 0xB8E6, 0x98E6, 0xD5CD, 0x56D6, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6,
+0x98E6, 0x76E6, 0x98E6, 0xB7E6, 0x32B5, 0xF5D5, 0x97E6, 0x98E6, 0x32BD, 0x12B5, 0xD0AC, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6,
+0xB8E6, 0x56DE, 0x77DE, 0x97DE, 0x98DE, 0xD8E6, 0x98E6, 0x96DE, 0x8C7B, 0x76DE, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x97E6, 0x98DE,
+0xB8E6, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x77E6, 0xB8E6, 0xB0A4, 0x4F9C, 0x4F9C,
+0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x77DE, 0x76DE, 0x36D6, 0x53BD, 0xCD8B, 0xB0AC, 0xB0AC, 0xB8E6, 0x77E6,
+0x77DE, 0x97E6, 0xB6E6, 0x97E6, 0x97E6, 0x98E6, 0x77E6, 0x97E6, 0xB9E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97DE,
+0x97E6, 0xB8E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0x97E6, 0x98E6, 0x56DE, 0x56DE, 0x56DE, 0x35DE, 0x16D6, 0x16D6, 0x16D6, 0x11B5,
+0x93C5, 0xD4CD, 0xD4CD, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x97E6,
+0x16D6, 0x36D6, 0x36D6, 0xD4CD, 0x15D6, 0x36D6, 0x56DE, 0x97DE, 0x98E6, 0x76DE, 0xB8E6, 0x96DE, 0x97E6, 0x98E6, 0x97E6, 0x97DE,
+0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xD9E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x6FA4, 0x32BD, 0xB4CD, 0x36DE, 0xF5D5, 0x52BD,
+0xD0AC, 0x97E6, 0x96E6, 0x97E6, 0x36D6, 0x36D6, 0x16D6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x96DE, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0xD0AC, 0xD0AC,
+0xD0AC, 0x6F9C, 0x77DE, 0x77DE, 0x56DE, 0x15CE, 0xF5CD, 0x15CE, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x98E6, 0x77E6, 0xB7E6, 0xB8E6,
+0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x76E6, 0x97E6, 0xD8E6, 0xB7E6, 0x76DE, 0xD8E6, 0x77E6, 0xD4CD, 0x11B5, 0x32B5, 0x2F94, 0x56DE,
+0x56DE, 0x56DE, 0xD5CD, 0xB4C5, 0x53BD, 0xB7E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0xD9E6, 0x97DE, 0xB8E6, 0x97E6,
+0x77DE, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x97E6, 0x11AD, 0xF1AC, 0xF1AC, 0xF5CD, 0xF5CD, 0x52BD, 0x35DE, 0x77DE,
+0x97DE, 0x96E6, 0xB8EE, 0xB8E6, 0x97E6, 0xB8E6, 0xD8E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x77E6, 0x98E6,
+0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x35D6, 0x35D6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97E6,
+0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0x76E6, 0x97E6, 0x97E6, 0xF1AC,
+0xF1AC, 0xF1AC, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0xB8E6,
+0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x11AD, 0xF1AC, 0xD1AC, 0xF1AC,
+0xF5D5, 0x35D6, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x76DE, 0x56DE, 0xB8E6, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x56E6, 0x77E6, 0xB8E6,
+0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x77DE, 0x98E6, 0xB8E6, 0x98E6, 0x77E6, 0x76DE, 0xF1B4, 0xF1AC, 0x12B5, 0x32B5, 0xF5D5,
+0xD5CD, 0x2E94, 0x8C7B, 0x97E6, 0x96E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0xB8E6,
+0xB7E6, 0x97E6, 0x77DE, 0x98E6, 0x77E6, 0x76E6, 0x32B5, 0x11B5, 0x32B5, 0x32B5, 0x77DE, 0x36DE, 0x15D6, 0x97E6, 0x77DE, 0x77DE,
+0x77DE, 0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0x97DE, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x77E6, 0x32B5, 0x32B5, 0x32B5,
+0x52BD, 0x15D6, 0xF5CD, 0xD4CD, 0x77DE, 0x76DE, 0x77E6, 0x56DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x32BD, 0x32B5, 0x32BD, 0xB4CD, 0x93C5, 0x11B5, 0x56DE, 0x57DE, 0x36DE, 0x36DE, 0xB7DE,
+0x97DE, 0x98E6, 0x98E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB7E6, 0x32BD, 0x32B5, 0x32B5, 0xF1AC,
+0xB0A4, 0x0E94, 0x36D6, 0x35DE, 0x56DE, 0x98E6, 0x76E6, 0x76DE, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6,
+0xB7E6, 0xB7E6, 0x32B5, 0x32B5, 0x32B5, 0x56DE, 0x15D6, 0xF5D5, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x98E6, 0x96E6, 0x97E6, 0xB8E6,
+0xB8E6, 0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0xF5D5, 0xF5D5, 0xD4CD, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0x77E6,
+0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0x6FA4, 0x2F94, 0xB7E6, 0xB7E6,
+0x96E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x32B5, 0x52BD, 0x32BD, 0xEE8B, 0xB8E6,
+0x97E6, 0x97E6, 0x77DE, 0x76DE, 0x76DE, 0x98E6, 0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0x97DE, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x32B5, 0x32B5, 0x32B5, 0x96E6,
+0x97E6, 0x77E6, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0x96E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x77DE,
+0x57DE, 0x35DE, 0x36D6, 0x97DE, 0x76DE, 0x97E6, 0x96E6, 0xB8E6, 0x97DE, 0x76E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x32B5,
+0x36D6, 0x15D6, 0xF5D5, 0xD4CD, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x96E6, 0x77DE, 0x32B5, 0x32B5, 0x32B5,
+0x12B5, 0x52BD, 0x52BD, 0x32BD, 0xB0AC, 0x96DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x12B5, 0x11AD,
+0xF1AC, 0xF1AC, 0x8C7B, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC,
+0x56DE, 0x36DE, 0x36D6, 0x97E6, 0x97E6, 0x98DE, 0x97E6, 0x76E6, 0x97E6, 0x76DE, 0xD1AC, 0xF1AC, 0xB0A4, 0x15D6, 0xF5D5, 0x52BD,
+0x76DE, 0x77DE, 0x77DE, 0x76DE, 0x76DE, 0x77DE, 0x97E6, 0x6F9C, 0x2F94, 0xAD7B, 0x11B5, 0x8FA4, 0x8FA4, 0x77DE, 0x77DE, 0x56DE,
+0x57DE, 0x77DE, 0x15D6, 0x57DE, 0x15D6, 0xF5CD, 0x94C5, 0xD5CD, 0x36D6, 0x56DE, 0xF5CD, 0xF5CD, 0xF5CD, 0xF5D5, 0xF5D5, 0x36D6,
+0x76E6, 0x98E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x35D6, 0x35D6, 0x56DE, 0x97DE, 0x97DE, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x57DE,
+0x57DE, 0x56DE, 0x76DE, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x56DE, 0x77E6, 0x77E6, 0x96DE, 0x97E6, 0x97E6, 0xF5CD, 0xD5CD,
+0xD5CD, 0x32B5, 0x93C5, 0xCD83, 0x97DE, 0x76DE, 0x77E6, 0x76DE, 0x97DE, 0x97E6, 0xF5CD, 0xD5CD, 0xD5CD, 0x73C5, 0x35D6, 0x6FA4,
+0xD0AC, 0xD0AC, 0xF1B4, 0x77E6, 0x76DE, 0x77DE, 0x98DE, 0x77E6, 0x76DE, 0xD5CD, 0xD5CD, 0xD4CD, 0x94C5, 0x94C5, 0x77DE, 0xD4CD,
+0x35D6, 0x56DE, 0x98E6, 0xB7E6, 0xB7E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0xF5CD, 0x76DE, 0x77E6, 0x97E6,
+0x97E6, 0x78E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0x97DE, 0xD4C5, 0xD4CD, 0xD4CD, 0xF5D5, 0x56DE, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x96E6, 0xB4C5, 0xB4C5, 0xB4C5, 0xD4D5, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6,
+0x97DE, 0xB8E6, 0x96DE, 0x76DE, 0x97E6, 0xB4C5, 0xB4C5, 0xB4C5, 0xF5D5, 0x35D6, 0xED8B, 0xED8B, 0x4F9C, 0x98E6, 0x96DE, 0x76DE,
+0x96DE, 0x98E6, 0x76DE, 0x96E6, 0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x93C5, 0xF5D5, 0x35D6, 0x52BD, 0xB4CD, 0xF5CD, 0x97E6, 0x97E6,
+0x98E6, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x76E6, 0x93BD, 0x93C5, 0x93C5, 0xF5D5, 0x15D6, 0x15D6, 0x15D6, 0x35D6, 0x56DE,
+0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x77DE, 0xB8E6, 0xB7E6, 0x77E6, 0x97E6, 0x93BD, 0x73BD, 0x73BD, 0x15D6, 0x15D6, 0x56DE, 0x77DE,
+0x97E6, 0x77DE, 0x76DE, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x76DE, 0x76DE, 0x97E6, 0x73BD, 0x53BD, 0x52BD, 0xD5CD, 0x55DE, 0x56DE,
+0x97DE, 0x76E6, 0x96E6, 0x97DE, 0x97E6, 0x98E6, 0x77DE, 0x77DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x73BD, 0x73BD, 0x53BD, 0xF5CD,
+0x36D6, 0x36D6, 0x36D6, 0x77DE, 0x55DE, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0x76DE, 0x76DE, 0xB8E6, 0x97E6,
+0x96E6, 0x76DE, 0x53BD, 0x32B5, 0x53BD, 0xF5D5, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0x36D6, 0x52B5, 0xED8B, 0x56DE, 0x55DE, 0xEE8B,
+0xB8E6, 0x98E6, 0x98E6, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x32B5,
+0x15D6, 0x36D6, 0x15D6, 0x36D6, 0x15D6, 0x16D6, 0x56DE, 0x76DE, 0x56DE, 0x97E6, 0x97E6, 0x36D6, 0x57DE, 0x56DE, 0x55DE, 0x32B5,
+0xAC83, 0x96E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0x97DE, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0x32B5, 0x32B5,
+0x32B5, 0x55DE, 0x55DE, 0x77DE, 0x36D6, 0x15D6, 0x15D6, 0x32B5, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x77DE, 0x56DE,
+0x77DE, 0xD5CD, 0x36D6, 0x36D6, 0x0E94, 0x6FA4, 0xF1AC, 0xB7E6, 0xB7E6, 0x76E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x98E6, 0x98E6,
+0x76E6, 0x96E6, 0x98E6, 0x32B5, 0x52BD, 0x32B5, 0x32B5, 0x2E94, 0x4F9C, 0x2F9C, 0x76DE, 0x97E6, 0x97E6, 0x36D6, 0x36D6, 0x56DE,
+0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x11B5, 0x52BD, 0xF5CD, 0x97DE,
+0x97DE, 0xB8E6, 0xB9E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x12B5, 0x8FA4, 0xB0A4,
+0x94C5, 0x98E6, 0x35D6, 0x76DE, 0x56D6, 0x35D6, 0x56DE, 0x97E6, 0x97E6, 0x96DE, 0x36D6, 0x97E6, 0x97E6, 0xD5CD, 0x97E6, 0xB7E6,
+0x97E6, 0x15D6, 0xF5D5, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x96DE, 0x97E6,
+0x97E6, 0x32B5, 0x12B5, 0x12B5, 0x94C5, 0x15D6, 0x36D6, 0x76DE, 0x77DE, 0x57DE, 0x76DE, 0x77DE, 0x56DE, 0x77DE, 0x77DE, 0x97E6,
+0x14CE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6, 0x15D6, 0x35D6, 0x35D6, 0x56D6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6,
+0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x76E6, 0x11B5, 0x12B5, 0x32B5, 0xD4CD, 0xD4CD, 0x56D6, 0x36D6, 0x56DE, 0x76DE, 0x97DE,
+0x97E6, 0x77DE, 0x96DE, 0x75DE, 0x56DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0xD5CD, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0xB8E6,
+0x98E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xB7E6, 0xB7E6, 0xF5D5, 0x97E6, 0x98E6, 0x32BD, 0x12B5, 0xD0AC,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x56DE, 0x77DE, 0x97DE, 0x97E6, 0xD8E6, 0x98E6, 0x96DE, 0x8C7B, 0xCD8B, 0xB0AC,
+0x76E6, 0xB8E6, 0x77E6, 0x97E6, 0x98DE, 0xB6E6, 0x98E6, 0x98E6, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE,
+0x77E6, 0xB8E6, 0xB0A4, 0x4F9C, 0x4F9C, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98DE, 0x77DE, 0x76DE, 0x96DE, 0x53BD,
+0xB0AC, 0xB0AC, 0x11B5, 0x93C5, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x77E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x97E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0x97E6, 0x98E6, 0x56DE, 0x56DE, 0x56DE, 0x36D6,
+0x16D6, 0x16D6, 0x93C5, 0xD4CD, 0xD4CD, 0x97E6, 0x98E6, 0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6,
+0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE,
+0x77E6, 0x16D6, 0x16D6, 0x36D6, 0x36D6, 0x56DE, 0x56DE, 0x97DE, 0x98E6, 0x76DE, 0xB8E6, 0x96DE, 0x97E6, 0x98E6, 0x97E6, 0x97DE,
+0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xD9E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x6FA4, 0x32BD, 0xB4CD, 0x36DE, 0xF5D5, 0x52BD,
+0x97E6, 0x97E6, 0x96E6, 0x36D6, 0x36D6, 0x36D6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x96DE,
+0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x76E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0xD0AC, 0xD0AC, 0xD0AC, 0x97E6,
+0x77DE, 0x77DE, 0x16D6, 0x15CE, 0xF5CD, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6,
+0xB7E6, 0x76E6, 0x97E6, 0xD8E6, 0x97E6, 0x76DE, 0xD8E6, 0x77E6, 0xD4CD, 0x11B5, 0x32B5, 0x2F94, 0x2F94, 0x56DE, 0x56DE, 0x56DE,
+0x15CE, 0xD5CD, 0xB4C5, 0xB7E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0xD9E6, 0x97DE, 0x97E6, 0x77DE, 0x77DE, 0xB7E6,
+0xB7E6, 0xB8E6, 0x77E6, 0x97DE, 0xB8E6, 0x32B5, 0x11AD, 0xF1AC, 0x36D6, 0x36D6, 0xF5CD, 0x53BD, 0x35DE, 0x77DE, 0x97DE, 0x96E6,
+0xB8EE, 0xB8E6, 0x97E6, 0xB8E6, 0xD8E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6,
+0x98E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x35D6, 0x56DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0xB7E6, 0x98E6, 0x98E6, 0x97DE, 0x97E6, 0xB7E6, 0x76E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x76DE, 0x76DE,
+0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6,
+0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x98E6, 0x11AD, 0xF1AC, 0xF1AC, 0xF5D5, 0x35D6, 0x97E6, 0x76DE, 0x56DE, 0x35D6, 0x76DE,
+0x56DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x56E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x98E6, 0x77DE, 0x98E6,
+0x97E6, 0x98E6, 0x77E6, 0xF1AC, 0xF1B4, 0xF1AC, 0xF5D5, 0xD5CD, 0x2E94, 0x35D6, 0x8C7B, 0x97E6, 0x96E6, 0x77DE, 0x55DE, 0x97E6,
+0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x77E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE, 0x98E6, 0x77E6, 0x12B5, 0x32B5, 0x11B5,
+0x77DE, 0x77DE, 0x36DE, 0x98E6, 0x97E6, 0x77DE, 0x77DE, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x77E6, 0x97DE, 0x77DE, 0xB8E6, 0x98E6,
+0x76E6, 0x77E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x15D6, 0x15D6, 0xF5CD, 0x77DE, 0x77DE, 0x76DE, 0x97E6, 0xB7DE, 0xB8E6, 0xB8E6,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x98E6, 0x32B5, 0x52BD, 0x32BD, 0xD4CD, 0xB4CD, 0x93C5, 0x77E6,
+0x56DE, 0x57DE, 0xB8E6, 0x97E6, 0xB7DE, 0x97E6, 0x97DE, 0x98E6, 0x96DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x32B5,
+0x32BD, 0x32BD, 0xF1AC, 0xB0A4, 0xB0A4, 0x36DE, 0x36DE, 0x36D6, 0x97DE, 0x98E6, 0x98E6, 0x96DE, 0x98E6, 0x97DE, 0x97E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x56DE, 0x56DE, 0x56DE, 0x76E6, 0x76DE, 0x97E6, 0x97DE, 0xB8E6,
+0x76DE, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x32B5, 0x32B5, 0x32BD, 0x32B5, 0xF5D5, 0x15D6, 0xF5D5, 0x96E6, 0x96DE,
+0x96DE, 0x98E6, 0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0xD4CD, 0x72BD, 0x32BD,
+0x97E6, 0x96DE, 0xB7E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x6FA4,
+0x2F94, 0xEE8B, 0x96E6, 0xB7E6, 0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x32B5, 0x52BD,
+0x32BD, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD,
+0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97DE, 0x77DE, 0x77DE, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x97E6,
+0x77E6, 0x77DE, 0x96DE, 0x96DE, 0x97DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6, 0x98E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x35DE, 0x35DE,
+0x36D6, 0x97DE, 0x76DE, 0x97E6, 0x96E6, 0xB8E6, 0x97DE, 0x76E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0xD4CD,
+0x97E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x96E6, 0x77DE, 0x32B5, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0xB0AC,
+0x96DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x12B5, 0x11AD, 0xF1AC, 0x6FA4, 0x8C7B, 0x97E6,
+0x97E6, 0x97E6, 0x77E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0xF1AC, 0xF1AC, 0xF1AC, 0xF1AC, 0x77DE, 0x56DE, 0x36DE, 0x97E6,
+0x97E6, 0x98DE, 0x97E6, 0x76E6, 0x97E6, 0xF1AC, 0xD1AC, 0xD1AC, 0x36D6, 0x15D6, 0xF5D5, 0x76DE, 0x76DE, 0x77DE, 0x76DE, 0x76DE,
+0x77DE, 0xB0A4, 0x6F9C, 0x2F94, 0x52BD, 0x11B5, 0x8FA4, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0x77E6, 0x77DE, 0xAD7B, 0x56DE, 0x57DE,
+0x15D6, 0x15D6, 0x36D6, 0x94C5, 0xD5CD, 0xF5CD, 0xF5D5, 0x56DE, 0x76E6, 0x98E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x36D6, 0x36D6, 0x35D6,
+0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x35D6, 0x35D6, 0x56DE, 0x97DE, 0x97E6, 0xB8E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x57DE, 0x57DE,
+0x56DE, 0x76DE, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x77E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xF5CD, 0xD5CD, 0xD5CD,
+0xCD83, 0x6FA4, 0x76DE, 0x77E6, 0x76DE, 0x97DE, 0x97E6, 0xF5CD, 0xF5CD, 0xD5CD, 0x32B5, 0x93C5, 0x6FA4, 0xD0AC, 0xF1B4, 0x77E6,
+0x76DE, 0x77DE, 0x98DE, 0x77E6, 0x76DE, 0xD5CD, 0xD5CD, 0xD4CD, 0x73C5, 0x35D6, 0xD4CD, 0x35D6, 0x56DE, 0x98E6, 0xB7E6, 0x98E6,
+0x76DE, 0x97DE, 0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0x94C5, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x78E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6,
+0x97DE, 0xD4C5, 0xD4CD, 0xD4CD, 0xF5CD, 0xF5CD, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0xD4CD,
+0xB4C5, 0xB4C5, 0xF5D5, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x76DE, 0x76DE, 0xB4C5, 0xB4C5, 0xB4C5,
+0xF5CD, 0x77DE, 0xED8B, 0x4F9C, 0x98E6, 0x96DE, 0x76DE, 0x96DE, 0x98E6, 0x76DE, 0x96E6, 0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x93C5,
+0xF5D5, 0x35D6, 0xF1B4, 0x52BD, 0xB4CD, 0x76DE, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x76E6, 0x93BD, 0x93C5,
+0x93C5, 0xF5D5, 0x35D6, 0x15D6, 0x35D6, 0x56DE, 0x98DE, 0x77DE, 0x97DE, 0x76E6, 0x77DE, 0x76E6, 0xB7E6, 0x77E6, 0x93C5, 0x93BD,
+0x73BD, 0xD4CD, 0x15D6, 0x56DE, 0x56DE, 0x77DE, 0x98E6, 0x77DE, 0x76DE, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x76DE, 0x73BD,
+0x73BD, 0x53BD, 0x15D6, 0x15D6, 0x97E6, 0x97DE, 0x76E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x97DE,
+0x52BD, 0x52BD, 0x73BD, 0xD5CD, 0x36D6, 0x36D6, 0x55DE, 0x56DE, 0x96E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x76DE, 0x76DE, 0x76DE,
+0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x53BD, 0x53BD, 0x53BD, 0xF5CD, 0xF5D5, 0x36D6, 0x36D6, 0x36D6, 0x77DE, 0x15D6, 0x97E6, 0xB8E6,
+0x98E6, 0x98E6, 0x97DE, 0xB8E6, 0xB8E6, 0x77DE, 0x96E6, 0x76DE, 0x97E6, 0x32B5, 0x53BD, 0x53BD, 0xF5D5, 0xF5D5, 0x15D6, 0x36D6,
+0x36D6, 0x36D6, 0xF5CD, 0x52B5, 0x36D6, 0xED8B, 0x56DE, 0x55DE, 0xEE8B, 0x96DE, 0x96DE, 0x96E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x32B5, 0x32B5, 0x36D6, 0x15D6, 0x55DE, 0x15D6, 0x16D6, 0x36D6, 0x73BD, 0x56DE,
+0x76DE, 0x76DE, 0x56DE, 0x97E6, 0x36D6, 0x57DE, 0x56DE, 0x55DE, 0x32B5, 0xAC83, 0x0E94, 0x6FA4, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x76E6, 0x96E6, 0x32B5, 0x32B5, 0x52BD, 0x2E94, 0x55DE, 0x77DE, 0x97E6, 0x15D6,
+0x15D6, 0x15D6, 0x32B5, 0x73BD, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x77DE, 0x56DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0xF1AC,
+0x11B5, 0x52BD, 0x76E6, 0x97DE, 0x97DE, 0x77DE, 0xB9E6, 0x97E6, 0x98E6, 0x98E6, 0x77E6, 0x98E6, 0x77DE, 0x96E6, 0x32B5, 0x32B5,
+0x32B5, 0x2E94, 0x4F9C, 0x2F9C, 0x76DE, 0x97E6, 0x97E6, 0x15D6, 0x36D6, 0x56DE, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6,
+0x98E6, 0x76DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0xF5CD, 0xF5D5, 0x36D6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x98E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x32B5, 0x12B5, 0x11B5, 0x8FA4, 0xB0A4, 0x94C5, 0x98E6, 0x35D6, 0x76DE, 0x56D6, 0x35D6, 0x56DE,
+0x97E6, 0x97E6, 0x96DE, 0x36D6, 0x97E6, 0x97E6, 0xD5CD, 0x97E6, 0xB7E6, 0x97E6, 0x15D6, 0x56DE, 0x56DE, 0x97E6, 0xB8E6, 0xB8E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x12B5, 0x12B5, 0xF1B4, 0x15D6, 0x36D6, 0x56D6, 0x77DE,
+0x57DE, 0x76DE, 0x77DE, 0x56DE, 0x77DE, 0x77DE, 0x97E6, 0x14CE, 0xD4CD, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6, 0x15D6, 0x56D6, 0x56DE,
+0x56DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x76E6, 0x98E6, 0x12B5, 0x32B5, 0xF5D5,
+0xD4CD, 0xD4CD, 0xB4CD, 0x36D6, 0x56DE, 0x77DE, 0x97DE, 0x97E6, 0x98E6, 0x96DE, 0x75DE, 0x14CE, 0x97E6, 0x98E6, 0x98E6, 0xB8E6,
+0x98E6, 0x15D6, 0x8C7B, 0x76DE, 0x76DE, 0x76E6, 0x98E6, 0x77E6, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xB7E6,
+0xB7E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x12B5, 0xD0AC, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x56DE, 0x77DE, 0x97DE,
+0x97E6, 0xD8E6, 0x98E6, 0xD5CD, 0xCD8B, 0xB0AC, 0xB0AC, 0xB8E6, 0x77E6, 0x77DE, 0x98DE, 0xB6E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6,
+0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x77E6, 0xB8E6, 0xB0A4, 0x4F9C, 0x4F9C, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0x97E6,
+0xB7E6, 0x98DE, 0x77DE, 0x76DE, 0x96DE, 0x53BD, 0x11B5, 0x93C5, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x77E6, 0x97E6,
+0x97DE, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0x97E6, 0x98E6,
+0x56DE, 0x56DE, 0x56DE, 0x36D6, 0x36D6, 0x16D6, 0xD4CD, 0xD4CD, 0x15D6, 0x98E6, 0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6,
+0x98E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x4F9C, 0x6F9C, 0xB0AC, 0x77DE, 0x56DE,
+0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x16D6, 0x16D6, 0x56DE, 0x97E6, 0x97E6, 0x98E6, 0x76DE, 0x98E6, 0x96DE, 0x97E6, 0xB8E6, 0x97E6,
+0x97DE, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xD9E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x6FA4, 0x32BD, 0x56DE, 0x36DE, 0xF5D5,
+0x77E6, 0x97E6, 0x97E6, 0x36D6, 0x36D6, 0x36D6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6,
+0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0xD9E6, 0x97E6, 0x77E6, 0x77E6, 0xB8E6, 0x98E6, 0xD5CD, 0x52BD, 0xD0AC, 0xD0AC, 0x96E6, 0x97E6,
+0x77DE, 0x36D6, 0x16D6, 0x15CE, 0xB8E6, 0x97E6, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0x76E6,
+0x97E6, 0xD8E6, 0x97E6, 0x76DE, 0xD8E6, 0x96DE, 0xD4CD, 0x11B5, 0x6F9C, 0x2F94, 0x2F94, 0x77DE, 0x56DE, 0x56DE, 0xF5CD, 0x15CE,
+0xD5CD, 0xB7E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0xD9E6, 0x97DE, 0x97E6, 0x77DE, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6,
+0x77E6, 0x97DE, 0xB8E6, 0x32B5, 0x11AD, 0xF1AC, 0x56DE, 0x36D6, 0x36D6, 0xB4C5, 0x53BD, 0x77DE, 0x77DE, 0x97DE, 0x96E6, 0xB8EE,
+0xB8E6, 0x97E6, 0xB8E6, 0xD8E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0x98E6,
+0xF1AC, 0xF1AC, 0xF1AC, 0xF5CD, 0x52BD, 0x35D6, 0x56DE, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x76DE, 0x76DE,
+0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6,
+0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0xF1AC, 0x11AD, 0xF1AC, 0xF5D5, 0x35D6, 0x97E6, 0x76DE, 0x56DE, 0x97DE, 0x76DE, 0x56DE,
+0x96DE, 0xB8E6, 0x97E6, 0x77DE, 0xB8E6, 0x56E6, 0x77E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0x76DE, 0xB7E6, 0x98E6, 0x77DE, 0x98E6,
+0x97E6, 0x98E6, 0xD1AC, 0xF1AC, 0xF1B4, 0xD5CD, 0x2E94, 0x2E94, 0x35D6, 0x8C7B, 0xB7E6, 0x97E6, 0x96E6, 0x77DE, 0x55DE, 0x97E6,
+0x97E6, 0x98E6, 0x97E6, 0x77E6, 0x77E6, 0x98E6, 0x98E6, 0xB8E6, 0xB7E6, 0x77E6, 0x76DE, 0x98E6, 0xF1AC, 0x12B5, 0x32B5, 0x77DE,
+0x77DE, 0x36DE, 0x98E6, 0x97E6, 0x77DE, 0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0x77DE, 0x98E6, 0x77E6, 0x76E6,
+0x32B5, 0x11B5, 0x32B5, 0x15D6, 0x15D6, 0x77DE, 0x77DE, 0x77DE, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x97E6, 0x97E6, 0x98E6, 0xB8E6,
+0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0x32B5, 0x32B5, 0x32B5, 0xD4CD, 0xB4CD, 0xB4CD, 0x76DE, 0x77E6, 0x56DE, 0xB8E6, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0x32BD, 0x32BD, 0x32B5, 0x11B5, 0xF1AC, 0xB0A4, 0x36DE,
+0x36DE, 0x36DE, 0xB7DE, 0x97DE, 0x98E6, 0x98E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB7E6, 0x32BD, 0x32B5,
+0x32B5, 0x0E94, 0x35DE, 0x56DE, 0x56DE, 0x76E6, 0x76DE, 0x76DE, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6,
+0x32B5, 0x32B5, 0x32B5, 0x56DE, 0x15D6, 0xF5D5, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6,
+0x97E6, 0xB7E6, 0x32B5, 0x32BD, 0x32B5, 0x15D6, 0xF5D5, 0xD4CD, 0x96DE, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x98E6, 0x97DE, 0xB8E6,
+0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x72BD, 0x32BD, 0x6FA4, 0x96DE, 0xB7E6, 0x96E6, 0xB8E6, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x2F94, 0xEE8B, 0xB7E6, 0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6,
+0x97DE, 0x77DE, 0x97E6, 0xB8E6, 0x97E6, 0x52BD, 0x32BD, 0x32BD, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x98E6, 0x97E6,
+0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x52BD, 0x32B5, 0x97E6, 0x96E6, 0x97E6, 0x77DE, 0x97DE, 0x77DE, 0x77DE, 0x97E6, 0x76DE,
+0x97E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x77E6, 0x77DE, 0x57DE, 0x96DE, 0x97DE, 0x97DE, 0x77DE, 0x77DE, 0x98E6, 0x96E6,
+0x98E6, 0x98E6, 0x32B5, 0x32B5, 0x35DE, 0x36D6, 0x15D6, 0x76DE, 0x97E6, 0x96E6, 0xB8E6, 0x97DE, 0x98E6, 0x76E6, 0xB8E6, 0x32B5,
+0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0xD4CD, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x96E6, 0x77DE, 0x32B5, 0x32B5,
+0x32B5, 0x52BD, 0x32BD, 0xB0AC, 0x96DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x12B5, 0x11AD, 0xF1AC,
+0x8C7B, 0x8C7B, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0xF1AC, 0xF1AC, 0x77DE, 0x56DE, 0x98E6,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0xD1AC, 0x36D6, 0x15D6, 0xF5D5, 0x76DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE,
+0x76DE, 0xF1AC, 0xB0A4, 0x6F9C, 0x52BD, 0x11B5, 0x8FA4, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x77E6, 0x2F94, 0xAD7B, 0x8FA4,
+0x56DE, 0x57DE, 0x15D6, 0x15D6, 0x15D6, 0xF5CD, 0x94C5, 0xD5CD, 0x36D6, 0xD5CD, 0xF5CD, 0xF5CD, 0xF5D5, 0x36D6, 0x56DE, 0x76E6,
+0x98E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x36D6, 0x35D6, 0x35D6, 0x97E6, 0x97DE, 0x97DE, 0xF5CD, 0xF5CD, 0x56DE, 0x57DE, 0x97E6, 0xB8E6,
+0x76DE, 0xF5CD, 0xF5CD, 0xF5CD, 0x57DE, 0x56DE, 0x56DE, 0x97E6, 0x97E6, 0x96DE, 0xF5CD, 0xF5CD, 0xF5CD, 0x77E6, 0x77E6, 0x97DE,
+0x97E6, 0x97E6, 0xF5CD, 0xD5CD, 0xD5CD, 0xCD83, 0x6FA4, 0x76DE, 0x76DE, 0x77E6, 0x76DE, 0x97DE, 0x97E6, 0xF5CD, 0xD5CD, 0xD5CD,
+0xD0AC, 0xF1B4, 0xD4CD, 0x76DE, 0x77DE, 0x98E6, 0x77E6, 0x77E6, 0x76DE, 0xD5CD, 0xD5CD, 0x32B5, 0x93C5, 0x35D6, 0x56DE, 0x77E6,
+0xB7E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0xD4CD, 0xD4CD, 0xD4CD, 0x73C5, 0x93C5, 0x77E6, 0x97E6, 0x97E6, 0x78E6, 0x98E6, 0x97DE,
+0x97DE, 0x97E6, 0x97DE, 0xD4C5, 0xD4CD, 0xD4CD, 0x94C5, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE,
+0xD4CD, 0xB4C5, 0xB4C5, 0xF5CD, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x96E6, 0x96DE, 0x76DE, 0xB4C5, 0xB4C5, 0xB4C5,
+0xF5D5, 0x56DE, 0x56DE, 0xED8B, 0x4F9C, 0x98E6, 0x96DE, 0x76DE, 0x96DE, 0x98E6, 0x76DE, 0x97E6, 0x96E6, 0x97E6, 0xB4C5, 0x93C5,
+0xF5CD, 0x77DE, 0xF1B4, 0x52BD, 0xB4CD, 0x76DE, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x93BD,
+0xD4D5, 0x35D6, 0xF5CD, 0x15D6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x76E6, 0x77DE, 0x76E6, 0xB7E6, 0x77E6, 0x93C5, 0x93BD, 0x73BD,
+0xF5D5, 0x35D6, 0x56DE, 0x56DE, 0x56DE, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x73BD, 0x73BD, 0x73BD,
+0xD4CD, 0x15D6, 0x97E6, 0x97DE, 0x76E6, 0x97E6, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x76DE, 0x97E6, 0x97E6, 0x53BD, 0x52BD, 0x52BD,
+0x15D6, 0xF5D5, 0x15D6, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x73BD,
+0x53BD, 0xF5CD, 0xD5CD, 0x36D6, 0x36D6, 0x55DE, 0x56DE, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x97DE, 0x76DE, 0xB8E6, 0x97E6,
+0x96E6, 0x96E6, 0x53BD, 0x53BD, 0x32B5, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0x36D6, 0x77DE, 0x15D6, 0x98E6, 0x96DE, 0x97DE, 0xB8E6,
+0xB8E6, 0x77DE, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x53BD, 0xF5D5, 0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6,
+0xF5CD, 0x52B5, 0x36D6, 0xED8B, 0x56DE, 0x55DE, 0xEE8B, 0xEE8B, 0xAC83, 0x0E94, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6,
+0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x15D6, 0x55DE, 0x55DE, 0x16D6, 0x36D6, 0x73BD, 0x56DE, 0x76DE,
+0x56DE, 0x97E6, 0x96DE, 0x57DE, 0x56DE, 0x55DE, 0x32B5, 0x6FA4, 0xF1AC, 0x11B5, 0xB7E6, 0x76E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6,
+0xB8E6, 0x98E6, 0x76E6, 0x96E6, 0x98E6, 0x32B5, 0x52BD, 0x32B5, 0x55DE, 0x77DE, 0x97E6, 0x15D6, 0x15D6, 0x15D6, 0x32B5, 0x35D6,
+0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x52BD, 0xF5CD, 0xF5D5, 0x97DE, 0xB8E6,
+0xB9E6, 0x97E6, 0x97E6, 0x77E6, 0x77E6, 0xB8E6, 0x77DE, 0x96E6, 0x97E6, 0x32B5, 0x32B5, 0x4F9C, 0x2F9C, 0x8FA4, 0x97E6, 0x97E6,
+0x97E6, 0x36D6, 0x56DE, 0x55D6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76DE, 0x77DE, 0xF5CD, 0x97E6, 0x98E6, 0x93C5,
+0xF5D5, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97DE, 0x97DE, 0x96DE, 0x12B5, 0x11B5,
+0x32B5, 0xB0A4, 0x94C5, 0x15D6, 0x35D6, 0x76DE, 0x56D6, 0x35D6, 0x35D6, 0x97E6, 0x97E6, 0x96DE, 0x36D6, 0x97E6, 0x97E6, 0xD5CD,
+0x97E6, 0xB7E6, 0x97E6, 0x15D6, 0x56DE, 0x35D6, 0x56D6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x12B5, 0xF1B4, 0x11B5, 0x15D6, 0x36D6, 0x56D6, 0x77DE, 0x57DE, 0x76DE, 0x77DE, 0x56DE, 0x77DE, 0x77DE, 0x97E6,
+0x97E6, 0xD4CD, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x76DE, 0x76DE, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6,
+0x98E6, 0x76E6, 0x98E6, 0x12B5, 0x32B5, 0xF5D5, 0xD4CD, 0xD4CD, 0xB4CD, 0x36D6, 0x56DE, 0x77DE, 0x97DE, 0x97E6, 0x98E6, 0x96DE,
+0x75DE, 0x14CE, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0x15D6, 0x8C7B, 0xCD8B, 0x76DE, 0x76E6, 0xB8E6, 0x77E6, 0x97E6, 0x97E6,
+0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x12B5, 0xD0AC, 0xB0A4, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0xB8E6, 0x56DE, 0x77DE, 0x97DE, 0x97E6, 0xD8E6, 0x98E6, 0xD5CD, 0xB0AC, 0xB0AC, 0x11B5, 0x77E6, 0x77DE, 0x97E6,
+0xB6E6, 0x97E6, 0x97DE, 0x98E6, 0x77E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB0A4, 0x4F9C, 0x4F9C,
+0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0x97E6, 0xB7E6, 0x98DE, 0x77DE, 0x76DE, 0x96DE, 0x53BD, 0x93C5, 0xD4CD, 0x97E6, 0x97E6, 0x98E6,
+0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x4F9C, 0x4F9C,
+0x4F9C, 0xB7E6, 0x97E6, 0x98E6, 0x56DE, 0x56DE, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x15D6, 0x36D6, 0x77DE, 0x97DE, 0x98E6, 0x97E6,
+0xB8E6, 0x96DE, 0x98E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x4F9C, 0x6F9C, 0xB0AC,
+0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x16D6, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0xB8E6,
+0x97E6, 0x97DE, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xD9E6, 0xB8E6, 0xB8E6, 0xB0AC, 0x6FA4, 0x32BD, 0x56DE, 0x36DE,
+0xF5D5, 0x77E6, 0x97E6, 0x97E6, 0x36D6, 0x36D6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6,
+0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0xD9E6, 0x97E6, 0x77E6, 0x77E6, 0xB8E6, 0x98E6, 0xD5CD, 0x52BD, 0xD0AC, 0xD0AC, 0x96E6, 0x97E6,
+0x36D6, 0x36D6, 0x16D6, 0xB8E6, 0x97E6, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x76E6, 0x97E6,
+0xD8E6, 0x97E6, 0x76DE, 0xD8E6, 0x96DE, 0xD4CD, 0x11B5, 0xD0AC, 0x6F9C, 0x2F94, 0x77DE, 0x77DE, 0x56DE, 0x15CE, 0xF5CD, 0x15CE,
+0x35DE, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0xB8E6, 0xD9E6, 0x97DE, 0x97E6, 0x77DE, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6, 0x77E6,
+0x97DE, 0x11B5, 0x32B5, 0x11AD, 0x56DE, 0x56DE, 0x56DE, 0xD5CD, 0xB4C5, 0x77DE, 0x97DE, 0x97E6, 0x96E6, 0xB8EE, 0xB8E6, 0x97E6,
+0xB8E6, 0xD8E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC,
+0x36D6, 0xF5CD, 0x52BD, 0x35D6, 0x56DE, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x97E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6,
+0xB7E6, 0xB7E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0x76E6, 0x97E6, 0xF1AC, 0xF1AC, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0xB8E6,
+0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x77E6, 0x97E6, 0x97E6,
+0x97E6, 0xF1AC, 0xF1AC, 0x11AD, 0x35D6, 0x35D6, 0x97E6, 0x76DE, 0x56DE, 0x97DE, 0x76DE, 0x56DE, 0x96DE, 0xB8E6, 0x97E6, 0x77DE,
+0xB8E6, 0x56E6, 0x77E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0xF1AC, 0xD1AC, 0xF1AC,
+0xD5CD, 0x2E94, 0x8C7B, 0xB7E6, 0x97E6, 0x56E6, 0x77DE, 0x55DE, 0xB7E6, 0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x77DE, 0x98E6,
+0xB8E6, 0x98E6, 0x77E6, 0xF1AC, 0xF1B4, 0xF1AC, 0x96E6, 0x77DE, 0x77DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6,
+0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0x76DE, 0x98E6, 0x77E6, 0x12B5, 0x32B5, 0x11B5, 0x15D6, 0x15D6, 0x15D6, 0x77DE, 0x77DE, 0x97E6,
+0xB8E6, 0x97E6, 0x77E6, 0x97DE, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x77E6, 0x32B5, 0x32B5, 0xF5CD, 0xD4CD, 0xB4CD,
+0x76DE, 0x77E6, 0x77E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x98E6, 0x32B5, 0x52BD,
+0x32BD, 0x93C5, 0x11B5, 0xF1AC, 0x57DE, 0x36DE, 0x36DE, 0xB7DE, 0xB7DE, 0x97E6, 0x97DE, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6,
+0x97E6, 0x77E6, 0x32B5, 0x32BD, 0x32BD, 0xB0A4, 0x0E94, 0x36DE, 0x36D6, 0x35DE, 0x98E6, 0x98E6, 0x76E6, 0x98E6, 0x97DE, 0x97DE,
+0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x32BD, 0x32B5, 0x32B5, 0x56DE, 0x56DE, 0x15D6, 0x76DE, 0x97E6, 0x97E6, 0xB8E6, 0x76DE,
+0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x97E6, 0xB7E6, 0x32B5, 0x32B5, 0x32B5, 0xF5D5, 0x15D6, 0x97E6, 0x96E6, 0x96DE, 0x98E6, 0x96E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB7E6, 0xB8E6, 0xB8E6, 0x32BD, 0x32B5, 0xD4CD, 0xD4CD, 0x72BD, 0x96E6, 0x97E6, 0x96DE, 0x77E6,
+0x98E6, 0xB8E6, 0xB8E6, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x6FA4, 0x2F94, 0xEE8B, 0xB7E6, 0x96E6, 0xB8E6,
+0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD, 0xEE8B, 0xB8E6, 0x97E6, 0x97E6, 0x77DE,
+0x77DE, 0x76DE, 0x97DE, 0x77DE, 0x98E6, 0xB8E6, 0x97E6, 0x52BD, 0x32BD, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0x97E6,
+0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x52BD, 0x32B5, 0x97E6, 0x96E6, 0x97E6, 0x97DE, 0x77DE, 0x96DE, 0x97E6, 0x76DE,
+0x77DE, 0x97E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x77E6, 0x77DE, 0x57DE, 0x96DE, 0x97DE, 0x97DE, 0x77DE, 0x98E6, 0x96E6, 0x98E6,
+0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x35DE, 0x36D6, 0x97DE, 0x76DE, 0x97E6, 0x96E6, 0xB8E6, 0x97DE, 0x76E6, 0xB8E6, 0x97E6, 0x32B5,
+0x32B5, 0x32B5, 0xF5D5, 0xD4CD, 0x52BD, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x96E6, 0x32B5, 0x32B5, 0x32B5,
+0x32BD, 0xB0AC, 0x6FA4, 0x97E6, 0xB8E6, 0x98E6, 0x76DE, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x32B5, 0x12B5, 0x11AD, 0x6FA4, 0x8C7B,
+0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x76DE, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0xF1AC, 0xF1AC, 0x77DE, 0x56DE, 0x36DE, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x36DE, 0x36D6, 0x15D6, 0x98DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x76DE, 0xF1AC,
+0xB0A4, 0xB0A4, 0xF5D5, 0x52BD, 0x11B5, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0x6F9C, 0x2F94, 0xAD7B, 0x8FA4, 0x8FA4, 0x77DE,
+0x77DE, 0x56DE, 0x77E6, 0x77DE, 0x15D6, 0x15D6, 0x15D6, 0xF5CD, 0x94C5, 0xD5CD, 0x36D6, 0x56DE, 0x76E6, 0xF5CD, 0xF5CD, 0xF5D5,
+0x36D6, 0x36D6, 0x98E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x36D6, 0x35D6, 0x35D6, 0x97E6, 0x97DE, 0x97E6, 0xF5CD, 0xF5CD, 0x57DE,
+0x57DE, 0x97E6, 0xB8E6, 0x76DE, 0xF5CD, 0xF5CD, 0xF5CD, 0x56DE, 0x56DE, 0x77E6, 0x97E6, 0x96DE, 0x96DE, 0xF5CD, 0xF5CD, 0x77E6,
+0x97DE, 0x97E6, 0x97E6, 0x76DE, 0xD5CD, 0xD5CD, 0xD5CD, 0xCD83, 0x6FA4, 0x76DE, 0x77E6, 0x77E6, 0x97DE, 0x97E6, 0x98DE, 0xD5CD,
+0xD5CD, 0xF1B4, 0xF1B4, 0xD4CD, 0x76DE, 0x77DE, 0x98DE, 0x77E6, 0x76DE, 0xD5CD, 0xD5CD, 0xD4CD, 0x56DE, 0x77E6, 0xB7E6, 0x98E6,
+0x98E6, 0x76DE, 0x97DE, 0x97E6, 0xD4CD, 0xD4CD, 0x32B5, 0x93C5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6,
+0xD4CD, 0xD4C5, 0xD4CD, 0x73C5, 0x93C5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0xD4CD, 0xB4C5, 0xB4C5,
+0x94C5, 0x35D6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x96E6, 0x96DE, 0x76DE, 0xB4C5, 0xB4C5, 0xB4C5, 0xF5CD, 0x76DE, 0xED8B,
+0x4F9C, 0x98E6, 0x98E6, 0x96DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x96E6, 0xB4C5, 0xB4C5, 0x93C5, 0xF5D5, 0x56DE, 0xF1B4, 0x52BD,
+0xB4CD, 0x76DE, 0x97E6, 0x98E6, 0x77E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x93BD, 0xF5CD, 0x77DE, 0x77DE, 0xF5CD,
+0x15D6, 0x98E6, 0x98DE, 0x77DE, 0x97DE, 0x76E6, 0x77DE, 0x76E6, 0x76E6, 0x93BD, 0x93C5, 0x93C5, 0xD4D5, 0x35D6, 0x35D6, 0x56DE,
+0x56DE, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x73BD, 0x73BD, 0x73BD, 0xF5D5, 0x35D6, 0x77DE, 0x97E6,
+0x77DE, 0x76DE, 0x97E6, 0x77E6, 0x98E6, 0xB8E6, 0x76DE, 0x97E6, 0x73BD, 0x53BD, 0x52BD, 0xD4CD, 0x15D6, 0x76E6, 0x96E6, 0x97E6,
+0x97DE, 0x97E6, 0xB8E6, 0x77DE, 0x77DE, 0x97E6, 0x97DE, 0x97E6, 0x52BD, 0x73BD, 0xD5CD, 0xF5D5, 0x15D6, 0x97E6, 0x97E6, 0x97E6,
+0x76DE, 0x98E6, 0x76DE, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x53BD, 0xF5CD, 0x36D6, 0x36D6, 0x36D6, 0x55DE, 0x56DE,
+0xB8E6, 0x98E6, 0x96DE, 0x97DE, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x76DE, 0x76DE, 0x97E6, 0x32B5, 0x53BD, 0xF5D5, 0xF5D5, 0x36D6,
+0x36D6, 0x36D6, 0x77DE, 0x15D6, 0xAC83, 0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x53BD,
+0x53BD, 0x32B5, 0x15D6, 0x36D6, 0x15D6, 0x36D6, 0x15D6, 0x16D6, 0xF5CD, 0x52B5, 0x36D6, 0xED8B, 0xED8B, 0x56DE, 0x55DE, 0xEE8B,
+0x0E94, 0x6FA4, 0xF1AC, 0x97E6, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0xB8E6, 0x97E6, 0x76E6, 0x96E6, 0x32B5, 0x32B5,
+0x55DE, 0x55DE, 0x16D6, 0x36D6, 0x15D6, 0x56DE, 0x76DE, 0x56DE, 0x97E6, 0x96DE, 0x57DE, 0x56DE, 0x55DE, 0x32B5, 0x11B5, 0x52BD,
+0x76E6, 0x97DE, 0x97DE, 0xB8E6, 0x77DE, 0xB9E6, 0x98E6, 0x98E6, 0x77E6, 0x98E6, 0x77DE, 0x52BD, 0x32B5, 0x32B5, 0x2E94, 0x77DE,
+0x97E6, 0x76DE, 0x15D6, 0x15D6, 0x36D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x77DE, 0x56DE, 0x76DE,
+0xD5CD, 0x36D6, 0xF5CD, 0xF5D5, 0x36D6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0x97DE,
+0x32B5, 0x12B5, 0x2F9C, 0x8FA4, 0xB0A4, 0x97E6, 0x97E6, 0x36D6, 0x56DE, 0x55D6, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6,
+0x76DE, 0x77DE, 0xF5CD, 0xF5CD, 0x97E6, 0x93C5, 0x56DE, 0x56DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6,
+0x96DE, 0x96DE, 0x97E6, 0x11B5, 0x32B5, 0x12B5, 0xB0A4, 0x94C5, 0x15D6, 0x35D6, 0x76DE, 0x77DE, 0x56D6, 0x35D6, 0x97E6, 0x97E6,
+0x96DE, 0x36D6, 0x97E6, 0x97E6, 0xD5CD, 0x97E6, 0x98E6, 0x97E6, 0x15D6, 0x35D6, 0x56D6, 0x56DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6,
+0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x76E6, 0xF1B4, 0x11B5, 0x36D6, 0x56D6, 0x36D6, 0x57DE, 0x76DE, 0x77DE, 0x56DE,
+0x77DE, 0x77DE, 0x77DE, 0x97E6, 0xD4CD, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x8C7B, 0x76DE, 0x76DE, 0x97E6, 0xB8E6, 0x98E6, 0x97E6,
+0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x76E6, 0x98E6, 0xB7E6, 0x32B5, 0xF5D5, 0x97E6, 0xD4CD, 0xB4CD, 0x36D6, 0x56DE, 0x77DE, 0x97DE,
+0x97E6, 0x98E6, 0x96DE, 0x75DE, 0x14CE, 0x97E6, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0x15D6, 0xCD8B, 0xB0AC, 0x76E6, 0xB8E6, 0x77E6,
+0x97E6, 0x98DE, 0x98DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x97E6, 0x98E6, 0x98E6, 0x97DE, 0x12B5, 0xD0AC, 0xB0A4,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x56DE, 0x77DE, 0x97DE, 0x97E6, 0xD8E6, 0x98E6, 0xD5CD, 0xB0AC, 0x11B5, 0x93C5, 0x77DE,
+0x97E6, 0xB6E6, 0x97E6, 0x97E6, 0x98E6, 0x77E6, 0x77E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0x97DE, 0x4F9C,
+0x4F9C, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97E6, 0xB7E6, 0x98DE, 0x77DE, 0x98E6, 0x96DE, 0x53BD, 0x93C5, 0xD4CD, 0xD4CD, 0x97E6,
+0x98E6, 0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x4F9C,
+0x4F9C, 0x4F9C, 0xB7E6, 0x97E6, 0x98E6, 0x56DE, 0x56DE, 0x76DE, 0x36D6, 0x36D6, 0x36D6, 0x56DE, 0x56DE, 0x97DE, 0x98E6, 0x97E6,
+0xB8E6, 0x96DE, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x4F9C, 0x6F9C, 0x98E6,
+0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6,
+0x97DE, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB0AC, 0x6FA4, 0x32BD, 0x56DE, 0x36DE, 0x56DE,
+0x77E6, 0x97E6, 0x16D6, 0x36D6, 0x36D6, 0x97E6, 0x98E6, 0xB8E6, 0x97DE, 0xB7E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6,
+0x97E6, 0x98E6, 0xD9E6, 0x97E6, 0x77E6, 0x77E6, 0xB8E6, 0x98E6, 0xD5CD, 0xF5D5, 0x52BD, 0xD0AC, 0x97E6, 0x96E6, 0x97E6, 0x36D6,
+0x36D6, 0xB8E6, 0x97E6, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x76E6, 0x97E6, 0xD8E6, 0x97E6,
+0x76DE, 0x98E6, 0x96DE, 0xD4CD, 0xD0AC, 0x6F9C, 0x97E6, 0x77DE, 0x77DE, 0x16D6, 0x15CE, 0xF5CD, 0x35DE, 0x35DE, 0x97DE, 0x97E6,
+0x96E6, 0x97E6, 0x98E6, 0xB8E6, 0xD9E6, 0x97DE, 0x97E6, 0x77DE, 0x97E6, 0xB7E6, 0xB8E6, 0xD8E6, 0x77E6, 0x97DE, 0x11B5, 0x32B5,
+0x11AD, 0x2F94, 0x56DE, 0x56DE, 0x56DE, 0x15CE, 0xD5CD, 0x97DE, 0x97E6, 0xB8EE, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xD8E6, 0x98E6,
+0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77E6, 0x98E6, 0x97E6, 0x97E6, 0x11AD, 0xF1AC, 0xF1AC, 0x56DE, 0x36D6, 0xF5CD, 0x53BD,
+0x35D6, 0x56DE, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6,
+0x97DE, 0x97DE, 0x98E6, 0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0x52BD, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6,
+0xB8E6, 0x97E6, 0x77E6, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC,
+0x35D6, 0xF5D5, 0x76DE, 0x56DE, 0x56DE, 0x97DE, 0x76DE, 0x56DE, 0x96DE, 0xB8E6, 0x77E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0xB8E6,
+0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x98E6, 0x11AD, 0xF1AC, 0xD5CD, 0x2E94, 0x8C7B, 0x97E6, 0xB7E6, 0x97E6,
+0x56E6, 0x77DE, 0x55DE, 0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x77E6, 0x77DE, 0x98E6, 0x98E6, 0x97E6, 0x98E6, 0xD1AC, 0xF1AC, 0xF1B4,
+0x77DE, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE, 0x98E6, 0x98E6,
+0xF1AC, 0x12B5, 0x36DE, 0x15D6, 0x15D6, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97DE, 0x77DE, 0xB8E6, 0x98E6,
+0x76E6, 0x77E6, 0x11B5, 0x32B5, 0x32B5, 0xF5CD, 0xD4CD, 0x77DE, 0x76DE, 0x77E6, 0xB7DE, 0xB7DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6,
+0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x32B5, 0x32B5, 0xB4CD, 0x93C5, 0x11B5, 0x56DE, 0x57DE, 0xB8E6, 0x97E6, 0xB7DE, 0x97E6,
+0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0xB7E6, 0x52BD, 0x32BD, 0x32B5, 0xF1AC, 0xB0A4, 0x36DE, 0x36DE, 0x36D6, 0x97DE,
+0x98E6, 0x98E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x32BD, 0x32BD, 0x35DE, 0x56DE, 0x98E6, 0x76E6,
+0x76DE, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0xB7E6, 0x32B5, 0x32B5, 0x32B5, 0x15D6, 0x15D6, 0xF5D5, 0x97E6,
+0x97E6, 0x96E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB7E6, 0x32B5, 0x32B5, 0xF5D5, 0xD4CD, 0x96DE, 0x96DE,
+0x96E6, 0x96E6, 0x97E6, 0x77E6, 0xB8E6, 0x97DE, 0xB7E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x72BD, 0x32BD, 0x6FA4, 0x96DE,
+0xB7E6, 0x96E6, 0x98E6, 0xB8E6, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x2F94, 0xEE8B, 0x96E6, 0xB7E6,
+0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x97E6, 0x77DE, 0x76DE,
+0x98E6, 0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x52BD, 0x32BD, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0x97DE, 0x98E6,
+0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x52BD, 0x52BD, 0x32B5, 0x96E6, 0x97E6, 0x97DE, 0x77DE, 0x96DE, 0x97E6, 0x76DE, 0x77DE, 0xB8E6,
+0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x77DE, 0x57DE, 0x35DE, 0x96DE, 0x97DE, 0x97DE, 0x77DE, 0x98E6, 0x96E6, 0x98E6, 0x98E6, 0x32B5,
+0x32B5, 0x32B5, 0x36D6, 0x15D6, 0x76DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0x76E6, 0xB8E6, 0x32B5, 0x32B5, 0x32B5, 0xF5D5,
+0xD4CD, 0x52BD, 0x98E6, 0x98E6, 0x96DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x96E6, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0xB0AC, 0x96DE,
+0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x12B5, 0x6FA4, 0x8C7B, 0x97E6, 0x97E6, 0x76DE, 0x77E6,
+0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0xF1AC, 0xF1AC, 0x97E6, 0x77DE, 0x56DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC,
+0xF1AC, 0x36D6, 0x15D6, 0x98DE, 0x98DE, 0x76DE, 0x76E6, 0x97E6, 0x76DE, 0xD1AC, 0xF1AC, 0xF5D5, 0x52BD, 0x11B5, 0x77DE, 0x77DE,
+0x77DE, 0x76DE, 0x77DE, 0xB0A4, 0x6F9C, 0x2F94, 0x8FA4, 0x8FA4, 0x77DE, 0x77DE, 0x56DE, 0x77E6, 0x77DE, 0x15D6, 0xAD7B, 0x57DE,
+0x15D6, 0xF5CD, 0xF5CD, 0x94C5, 0x36D6, 0xD5CD, 0xF5CD, 0x36D6, 0x56DE, 0x76E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x36D6, 0x36D6, 0x35D6,
+0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x35D6, 0x56DE, 0x97DE, 0x97E6, 0xB8E6, 0xF5CD, 0xF5CD, 0x57DE, 0x57DE, 0xB8E6, 0x76DE,
+0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x56DE, 0x56DE, 0x77E6, 0x97E6, 0x96DE, 0xF5CD, 0xF5CD, 0xF5CD, 0xCD83, 0x97DE, 0x97DE, 0x97E6,
+0x97E6, 0x76DE, 0xD5CD, 0xD5CD, 0xCD83, 0x6FA4, 0xD0AC, 0x77E6, 0x77E6, 0x76DE, 0x97E6, 0x97E6, 0xF5CD, 0xD5CD, 0xD5CD, 0xF1B4,
+0xD4CD, 0x76DE, 0x77DE, 0x98E6, 0x77E6, 0x76DE, 0xD5CD, 0xD5CD, 0xD5CD, 0x35D6, 0x56DE, 0x77E6, 0xB7E6, 0x98E6, 0x76DE, 0x97DE,
+0x97E6, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x78E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xD4CD, 0xD4C5, 0xD4CD, 0x32B5, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0xD4CD, 0xB4C5, 0x73C5, 0x93C5, 0x93C5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE,
+0x96E6, 0x96DE, 0x96DE, 0xB4C5, 0xB4C5, 0x94C5, 0x35D6, 0xED8B, 0x4F9C, 0x98E6, 0x96DE, 0xB8E6, 0x96DE, 0x98E6, 0x97E6, 0x96E6,
+0xB4C5, 0xB4C5, 0xB4C5, 0xF5CD, 0x77DE, 0xF1B4, 0x52BD, 0x52BD, 0x76DE, 0x76DE, 0x98E6, 0x76DE, 0x77E6, 0x97E6, 0x97E6, 0x97E6,
+0x93C5, 0x93C5, 0xF5D5, 0x56DE, 0xF5CD, 0x15D6, 0x98E6, 0x98DE, 0x98DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x76E6, 0x93BD, 0x93C5,
+0x93C5, 0xF5CD, 0x77DE, 0x35D6, 0x56DE, 0x56DE, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0xB8E6, 0xB7E6, 0x77E6, 0x93C5, 0x93BD, 0x73BD,
+0xD4D5, 0x35D6, 0x56DE, 0x77DE, 0x97E6, 0x77DE, 0x76DE, 0x97E6, 0x77E6, 0x98E6, 0x76DE, 0x76DE, 0x76DE, 0x73BD, 0x73BD, 0xF5D5,
+0x35D6, 0x97DE, 0x76E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0x97DE, 0x52BD, 0x52BD, 0x52BD, 0xD4CD, 0x15D6,
+0x15D6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x73BD, 0x53BD, 0x53BD, 0xD5CD, 0x36D6,
+0xF5D5, 0x15D6, 0xB8E6, 0x98E6, 0x98E6, 0x97DE, 0x97DE, 0x76DE, 0xB8E6, 0x97E6, 0x96E6, 0x76DE, 0x53BD, 0x32B5, 0xF5CD, 0xF5D5,
+0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x56DE, 0x96DE, 0x96E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x53BD,
+0x53BD, 0x53BD, 0xF5D5, 0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x77DE, 0x15D6, 0xAC83, 0x0E94, 0x97E6, 0x97E6, 0xB7E6, 0x97DE, 0xB8E6,
+0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x32B5, 0x32B5, 0x36D6, 0x15D6, 0x55DE, 0x15D6, 0x16D6, 0xF5CD, 0x52B5, 0x52B5,
+0xED8B, 0x56DE, 0x55DE, 0xEE8B, 0xF1AC, 0x11B5, 0x11B5, 0xB7E6, 0x76E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x98E6, 0x76E6, 0x96E6,
+0x98E6, 0x32B5, 0x52BD, 0x55DE, 0x55DE, 0x77DE, 0x36D6, 0x15D6, 0x15D6, 0x73BD, 0x56DE, 0x76DE, 0x56DE, 0x97E6, 0x96DE, 0x57DE,
+0x56DE, 0x55DE, 0x32B5, 0x32B5, 0x52BD, 0xF5CD, 0xF5D5, 0x97DE, 0xB8E6, 0x77DE, 0xB9E6, 0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0x77DE,
+0x96E6, 0x32B5, 0x32B5, 0x32B5, 0x2E94, 0x4F9C, 0x97E6, 0x76DE, 0x15D6, 0x15D6, 0x36D6, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6,
+0x97E6, 0xB8E6, 0x97E6, 0x77DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0xB8E6,
+0x98E6, 0xB8E6, 0x97E6, 0x97DE, 0x96DE, 0x12B5, 0x11B5, 0x8FA4, 0xB0A4, 0x97E6, 0x97E6, 0x98E6, 0x56DE, 0x55D6, 0x97E6, 0x98E6,
+0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76DE, 0x76DE, 0x77DE, 0xF5CD, 0x97E6, 0x93C5, 0x56DE, 0x35D6, 0x56D6, 0xB8E6, 0x97E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x97E6, 0x97E6, 0x32B5, 0x12B5, 0x94C5, 0x15D6, 0x36D6, 0x76DE, 0x77DE, 0x56D6, 0x35D6,
+0x56DE, 0x97E6, 0x96DE, 0x36D6, 0x97E6, 0x97E6, 0xD5CD, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x56DE, 0x56DE, 0x76DE, 0x98E6, 0x97E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x76E6, 0xF1B4, 0x11B5, 0x12B5, 0x36D6, 0x56D6, 0x36D6, 0x57DE, 0x76DE,
+0x77DE, 0x56DE, 0x77DE, 0xB8E6, 0x77DE, 0x97E6, 0xD4CD, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x8C7B, 0xCD8B, 0x76DE, 0x76E6, 0xB8E6,
+0x98E6, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xB7E6, 0xB7E6, 0xF5D5, 0x97E6, 0xD4CD, 0xB4CD, 0x32BD, 0x56DE,
+0x77DE, 0x97DE, 0x97E6, 0x98E6, 0x96DE, 0x75DE, 0x14CE, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0xB8E6, 0x15D6, 0xB0AC, 0xB0AC, 0xB8E6,
+0x77E6, 0x77DE, 0x98DE, 0xB6E6, 0xB8E6, 0x98E6, 0x97DE, 0x98E6, 0x98E6, 0xB7E6, 0x97E6, 0x98E6, 0x98E6, 0x97DE, 0x77E6, 0xD0AC,
+0xB0A4, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x56DE, 0x77DE, 0x97DE, 0x97E6, 0xD8E6, 0x98E6, 0xD5CD, 0x11B5, 0x93C5, 0xD4CD,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x77E6, 0x97E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0x97DE, 0x4F9C,
+0x4F9C, 0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97E6, 0xB7E6, 0x98DE, 0x77DE, 0x98E6, 0x96DE, 0x53BD, 0xD4CD, 0xD4CD, 0x15D6, 0x98E6,
+0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x4F9C, 0x4F9C,
+0x4F9C, 0xB7E6, 0x97E6, 0xB8E6, 0x56DE, 0x56DE, 0x76DE, 0x36D6, 0x53BD, 0x56DE, 0x97E6, 0x98E6, 0x98E6, 0x76DE, 0xB8E6, 0x96DE,
+0x98E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x4F9C, 0x6F9C, 0x98E6, 0x77DE, 0x56DE,
+0x56DE, 0x35DE, 0x16D6, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0x96DE, 0xB8E6,
+0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB0AC, 0x6FA4, 0x56DE, 0x56DE, 0x36DE, 0x56DE, 0x77E6, 0x97E6, 0x16D6,
+0x36D6, 0x97E6, 0x98E6, 0xB8E6, 0x97DE, 0xB7E6, 0xB8E6, 0xB7E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0xD9E6, 0x97E6,
+0x77E6, 0x77E6, 0xB8E6, 0xB4CD, 0xD5CD, 0xF5D5, 0x52BD, 0x97E6, 0x97E6, 0x96E6, 0x36D6, 0x36D6, 0x36D6, 0x97E6, 0xB7E6, 0x98E6,
+0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x76E6, 0x97E6, 0xD8E6, 0x97E6, 0x76DE, 0x98E6, 0x96DE, 0xD4CD, 0xD0AC,
+0xD0AC, 0x6F9C, 0x97E6, 0x77DE, 0x36D6, 0x16D6, 0x15CE, 0x35DE, 0x77DE, 0x97E6, 0x97E6, 0x96E6, 0x97E6, 0x98E6, 0xB8E6, 0xD9E6,
+0x97DE, 0x97E6, 0x77DE, 0xB7E6, 0xB7E6, 0xB8E6, 0xD8E6, 0x77E6, 0xD4CD, 0x11B5, 0x32B5, 0x2F94, 0x56DE, 0x56DE, 0x56DE, 0xF5CD,
+0x15CE, 0x97DE, 0x97E6, 0xB8EE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xD8E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x77E6,
+0xB8E6, 0x97E6, 0x97E6, 0x11AD, 0xF1AC, 0x56DE, 0x56DE, 0x36D6, 0xB4C5, 0x53BD, 0x35D6, 0x56DE, 0x97E6, 0xB8E6, 0x97E6, 0x96E6,
+0x97E6, 0x97E6, 0x77E6, 0x97E6, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0xF1AC, 0xF1AC,
+0xF1AC, 0xF5CD, 0x52BD, 0xF5D5, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6,
+0x97E6, 0x98E6, 0x98E6, 0x97DE, 0x97E6, 0xB7E6, 0x76E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0x35D6, 0xF5D5, 0x76DE, 0x56DE, 0x35D6,
+0x76DE, 0x76DE, 0x56DE, 0x96DE, 0xB8E6, 0x77E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0x77E6, 0xB8E6, 0x97E6,
+0x97E6, 0x98E6, 0xF1AC, 0x11AD, 0xD5CD, 0x2E94, 0x8C7B, 0xB7E6, 0xB7E6, 0xB8E6, 0x56E6, 0x77DE, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE,
+0xB8E6, 0x98E6, 0x77DE, 0x98E6, 0x98E6, 0x97E6, 0xF1AC, 0xD1AC, 0xF1AC, 0x96E6, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6,
+0x97E6, 0x77E6, 0x98E6, 0x98E6, 0xB8E6, 0xB7E6, 0x77E6, 0x76DE, 0x98E6, 0xF1B4, 0xF1AC, 0x36DE, 0x15D6, 0x97E6, 0x77DE, 0x77DE,
+0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x77E6, 0x97E6, 0x77DE, 0x98E6, 0x77E6, 0x76E6, 0x32B5, 0x11B5, 0x15D6, 0xF5CD, 0x77DE, 0x77DE,
+0x76DE, 0x97E6, 0xB7DE, 0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0xD4CD, 0xB4CD,
+0x93C5, 0x77E6, 0x56DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x98E6, 0x32B5, 0x52BD,
+0xF1AC, 0xF1AC, 0x57DE, 0x36DE, 0x36DE, 0xB7DE, 0x97DE, 0x97DE, 0x98E6, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB7E6, 0x97E6, 0x32BD,
+0x32B5, 0x32BD, 0x0E94, 0x35DE, 0x35DE, 0x98E6, 0x98E6, 0x76E6, 0x98E6, 0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x32BD,
+0x32BD, 0x32B5, 0x56DE, 0x15D6, 0x76DE, 0x76DE, 0x97E6, 0x97DE, 0xB8E6, 0x76DE, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0xB7E6, 0x32B5,
+0x32B5, 0xF5D5, 0x15D6, 0xF5D5, 0x96E6, 0x96DE, 0x98E6, 0x98E6, 0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x32B5, 0x32BD,
+0x32B5, 0xD4CD, 0x72BD, 0x96E6, 0x97E6, 0x96DE, 0x77E6, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5,
+0x32BD, 0x6FA4, 0x2F94, 0xB7E6, 0x96E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0xEE8B,
+0xB7E6, 0xB8E6, 0x97E6, 0x96E6, 0x77DE, 0x97E6, 0x97DE, 0x77DE, 0x97E6, 0xB8E6, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x97E6, 0x97E6,
+0x76DE, 0x98E6, 0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x32BD, 0x32B5, 0x32B5, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0x97DE, 0x98E6,
+0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x52BD, 0x32B5, 0x97E6, 0x77E6, 0x77DE, 0x96DE, 0x96DE, 0x76DE, 0x76DE, 0x77DE, 0xB8E6, 0x97E6,
+0x32B5, 0x32B5, 0x32B5, 0x77DE, 0x57DE, 0x35DE, 0x97DE, 0x97DE, 0x77DE, 0x98E6, 0x96E6, 0x98E6, 0x98E6, 0x98E6, 0x32B5, 0x32B5,
+0x36D6, 0x15D6, 0x76DE, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0x76E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0xD4CD, 0xD4CD, 0x52BD, 0x98E6,
+0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x96E6, 0x32B5, 0x32B5, 0x32B5, 0x32BD, 0xB0AC, 0x6FA4, 0x97E6, 0x97E6, 0xB8E6, 0x76DE,
+0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x32B5, 0x12B5, 0x8C7B, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x77E6, 0x97E6, 0x97E6, 0x98E6, 0x11AD,
+0xF1AC, 0xF1AC, 0x77DE, 0x56DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x36DE, 0x36D6, 0x15D6, 0x98DE,
+0x76DE, 0x76E6, 0x97E6, 0x76DE, 0xD1AC, 0xD1AC, 0x15D6, 0xF5D5, 0x52BD, 0x76DE, 0x77DE, 0x76DE, 0x76DE, 0x77DE, 0xB0A4, 0x6F9C,
+0x2F94, 0x8FA4, 0x8FA4, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0x77E6, 0x2F94, 0xAD7B, 0x57DE, 0x57DE, 0x77DE, 0x15D6, 0xF5CD, 0x94C5,
+0x36D6, 0x56DE, 0xD5CD, 0xF5CD, 0xF5D5, 0x36D6, 0x76E6, 0x98E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x36D6, 0x35D6, 0x97E6, 0x97E6, 0xF5CD,
+0xF5CD, 0xF5CD, 0x56DE, 0x56DE, 0x97DE, 0x97E6, 0xB8E6, 0xF5CD, 0xF5CD, 0x57DE, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0xF5CD, 0xF5CD,
+0x56DE, 0x77E6, 0x77E6, 0x96DE, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x77E6, 0x97DE, 0x76DE, 0x97E6, 0x76DE, 0xD5CD, 0xD5CD, 0xF5CD,
+0x6FA4, 0xD0AC, 0xD0AC, 0x77E6, 0x77E6, 0x97DE, 0x97E6, 0x98DE, 0xD5CD, 0xD5CD, 0xD4CD, 0x35D6, 0x77DE, 0x98E6, 0x98DE, 0x77E6,
+0x76DE, 0xD5CD, 0xD5CD, 0x56DE, 0x77E6, 0xB7E6, 0x98E6, 0x78E6, 0x97DE, 0x97DE, 0xD4CD, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x78E6,
+0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xD4CD, 0xD4C5, 0xD4C5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x77DE, 0xD4CD,
+0xB4C5, 0x32B5, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x96E6, 0x96DE, 0xB4C5, 0xB4C5, 0x32B5, 0x93C5, 0xED8B, 0x4F9C, 0x98E6,
+0x96DE, 0xB8E6, 0x96DE, 0x98E6, 0x76DE, 0x97E6, 0xB4C5, 0xB4C5, 0xB4C5, 0x94C5, 0x35D6, 0x35D6, 0xF1B4, 0x52BD, 0x76DE, 0x76DE,
+0x98E6, 0x76DE, 0x77E6, 0x97E6, 0x97E6, 0xB4C5, 0x93C5, 0x93C5, 0xF5CD, 0x77DE, 0xB4CD, 0xF5CD, 0x97E6, 0x98E6, 0x98DE, 0xB8E6,
+0x97DE, 0x97E6, 0x97E6, 0x76E6, 0x93BD, 0x93C5, 0xF5D5, 0xF5D5, 0x76DE, 0x35D6, 0x56DE, 0x56DE, 0x77DE, 0x97DE, 0x76E6, 0x77DE,
+0x76E6, 0xB7E6, 0x77E6, 0x93C5, 0x93BD, 0xF5CD, 0x77DE, 0x56DE, 0x77DE, 0x97E6, 0x77DE, 0x76DE, 0x97E6, 0x97E6, 0x77E6, 0x97E6,
+0x76DE, 0x73BD, 0x73BD, 0x73BD, 0xD4D5, 0x77DE, 0x97DE, 0x76E6, 0x97E6, 0x97DE, 0x98E6, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0x73BD,
+0x53BD, 0x52BD, 0xF5D5, 0x35D6, 0x96E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x97DE, 0x97E6, 0x97E6, 0x52BD, 0x73BD,
+0xD5CD, 0xD4CD, 0x15D6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x96E6, 0x53BD, 0x53BD, 0xF5CD,
+0x36D6, 0x36D6, 0xF5D5, 0x15D6, 0x98E6, 0x96DE, 0x96E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x76DE, 0x97E6, 0x32B5, 0x53BD,
+0x53BD, 0xF5CD, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0x15D6, 0x56DE, 0xAC83, 0x0E94, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0x77DE, 0x98E6,
+0x98E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x32B5, 0xF5D5, 0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x77DE, 0x15D6, 0x0E94, 0x6FA4, 0xF1AC,
+0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x76E6, 0x76E6, 0x32B5, 0x32B5, 0x15D6, 0x55DE, 0x15D6, 0x15D6,
+0x16D6, 0xF5CD, 0x56DE, 0x52B5, 0xED8B, 0x56DE, 0x55DE, 0xEE8B, 0x52BD, 0xF5CD, 0x76E6, 0x97DE, 0xB8E6, 0x77DE, 0xB9E6, 0x98E6,
+0x98E6, 0x96E6, 0x98E6, 0x77DE, 0x52BD, 0x52BD, 0x55DE, 0x77DE, 0x97E6, 0x15D6, 0x15D6, 0x73BD, 0x56DE, 0x76DE, 0x97E6, 0x97E6,
+0x96DE, 0x57DE, 0x56DE, 0x56DE, 0x55DE, 0x32B5, 0xF5D5, 0x36D6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6,
+0x96E6, 0x97E6, 0x32B5, 0x32B5, 0x12B5, 0x2E94, 0x4F9C, 0x97E6, 0x76DE, 0x97E6, 0x15D6, 0x36D6, 0x32B5, 0x35D6, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x77DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x56DE, 0x56DE, 0x35D6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6,
+0x98E6, 0xB8E6, 0x77E6, 0x97DE, 0x96DE, 0x12B5, 0x11B5, 0x32B5, 0x8FA4, 0xB0A4, 0xB0A4, 0x97E6, 0x98E6, 0x56DE, 0x55D6, 0x56D6,
+0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x36D6, 0x98E6, 0x76DE, 0x77DE, 0xF5CD, 0x36D6, 0x93C5, 0x35D6, 0x56D6, 0x56DE, 0x97E6, 0x98E6,
+0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x12B5, 0xF1B4, 0x94C5, 0x15D6, 0x36D6, 0x76DE, 0x76DE, 0x56D6,
+0x35D6, 0x56DE, 0x97E6, 0x96DE, 0x36D6, 0x97E6, 0x97E6, 0xD5CD, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x8C7B, 0x76DE, 0x76DE, 0x97E6,
+0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x97E6, 0x76E6, 0x76E6, 0x11B5, 0x12B5, 0xD4CD, 0x56D6, 0x36D6, 0x57DE, 0x76DE,
+0x97DE, 0x56DE, 0x56DE, 0xB8E6, 0x77DE, 0x97E6, 0xD4CD, 0xB8E6, 0xB7E6, 0xB7E6, 0x15D6, 0x8C7B, 0xCD8B, 0xB0AC, 0x76E6, 0xB8E6,
+0x77E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xB7E6, 0xB7E6, 0xF5D5, 0x97E6, 0x97E6, 0xB4CD, 0x32BD, 0x56DE,
+0x77DE, 0x97DE, 0x97E6, 0x98E6, 0x96DE, 0x75DE, 0x14CE, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x15D6, 0xB0AC, 0x11B5, 0x77E6,
+0x77DE, 0x98DE, 0xB6E6, 0x97E6, 0x98E6, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97DE, 0x77E6, 0xD0AC, 0xB0A4,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x56DE, 0x77DE, 0x97DE, 0x97E6, 0xD8E6, 0x98E6, 0x98E6, 0xD5CD, 0x93C5, 0xD4CD, 0x97E6,
+0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x77E6, 0x97E6, 0x97DE, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97DE, 0x4F9C, 0x4F9C,
+0xB8E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97E6, 0x97DE, 0x98DE, 0x77DE, 0x98E6, 0x96DE, 0x15D6, 0x15D6, 0x36D6, 0x77DE, 0x97DE, 0xB8E6,
+0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0x97E6,
+0xB8E6, 0x56DE, 0x56DE, 0x76DE, 0x36D6, 0x53BD, 0x56DE, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0xB8E6, 0x96DE, 0x97E6, 0x98E6, 0x97E6,
+0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6, 0x97E6, 0x4F9C, 0x6F9C, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x16D6,
+0x16D6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97DE, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6,
+0xB8E6, 0xB8E6, 0xB0AC, 0x6FA4, 0x56DE, 0x56DE, 0x36DE, 0x56DE, 0x77E6, 0x16D6, 0x16D6, 0x36D6, 0x98E6, 0xB8E6, 0x97DE, 0xB7E6,
+0x98E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0xD9E6, 0x97E6, 0x77E6, 0x77E6, 0xB8E6, 0xB4CD, 0xD5CD, 0xF5D5,
+0xF5D5, 0x52BD, 0x97E6, 0x97E6, 0x36D6, 0x36D6, 0x36D6, 0x97E6, 0xB7E6, 0x97DE, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6,
+0xB8E6, 0x97E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x98E6, 0x96DE, 0xD0AC, 0xD0AC, 0x97E6, 0x97E6, 0x77DE, 0x36D6, 0x16D6, 0x35DE,
+0x77DE, 0x97E6, 0x96E6, 0x96E6, 0x97E6, 0x98E6, 0xB8E6, 0xD9E6, 0x97DE, 0x97E6, 0x77DE, 0xB7E6, 0xB7E6, 0xB8E6, 0x77E6, 0x77E6,
+0xD4CD, 0x11B5, 0x32B5, 0x6F9C, 0x2F94, 0x77DE, 0x56DE, 0x56DE, 0x15CE, 0xF5CD, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0xD8E6, 0x97DE, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x97E6, 0x11AD, 0x11AD, 0xF1AC, 0x56DE, 0x56DE,
+0xD5CD, 0xB4C5, 0x53BD, 0x35D6, 0x56DE, 0x97E6, 0xB8E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0xB7E6, 0xB7E6, 0x98E6, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xF1AC, 0xF1AC, 0x36D6, 0xF5CD, 0x53BD, 0xF5D5, 0x76DE, 0x97E6, 0x76DE,
+0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x98E6, 0x97DE, 0x97E6, 0x97E6, 0x76E6,
+0x97E6, 0xF1AC, 0xF1AC, 0x52BD, 0x35D6, 0xF5D5, 0x76DE, 0x56DE, 0x35D6, 0x76DE, 0x56DE, 0x97E6, 0x96DE, 0xB8E6, 0x77E6, 0x77DE,
+0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0x77E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0xD5CD, 0x2E94, 0x8C7B, 0xB7E6,
+0x97E6, 0xB8E6, 0x56E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0x97E6, 0x11AD, 0xF1AC, 0xD1AC,
+0x96E6, 0x77DE, 0x55DE, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x98E6, 0xB8E6, 0x98E6, 0x77E6, 0x76DE, 0xF1B4,
+0xF1B4, 0x77DE, 0x36DE, 0x98E6, 0x97E6, 0x77DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE, 0x98E6, 0x77E6,
+0x12B5, 0x32B5, 0x15D6, 0x15D6, 0xF5CD, 0x77DE, 0x77DE, 0xB8E6, 0x97E6, 0xB7DE, 0x97DE, 0x97E6, 0x77DE, 0xB8E6, 0x98E6, 0x76E6,
+0x77E6, 0x11B5, 0x32B5, 0xD4CD, 0xB4CD, 0x76DE, 0x77E6, 0xB7DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6,
+0x77E6, 0x32B5, 0x32B5, 0x32B5, 0x11B5, 0xF1AC, 0x57DE, 0x57DE, 0x36DE, 0x97E6, 0xB7DE, 0x97E6, 0x97DE, 0x98E6, 0xB8E6, 0xB8E6,
+0x98E6, 0xB7E6, 0x97E6, 0x52BD, 0x32BD, 0xB0A4, 0x0E94, 0x36DE, 0x36D6, 0x35DE, 0x98E6, 0x98E6, 0x98E6, 0x96DE, 0x98E6, 0x97E6,
+0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x32BD, 0x32BD, 0x56DE, 0x56DE, 0x76E6, 0x76DE, 0x97E6, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6,
+0xB7E6, 0xB7E6, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xB7E6,
+0x32B5, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0xD4CD, 0x96DE, 0x96E6, 0x96E6, 0x97E6, 0x77E6, 0xB8E6, 0x97DE, 0xB7E6, 0xB7E6, 0x32B5,
+0x32BD, 0x32B5, 0x72BD, 0x32BD, 0x32BD, 0x97E6, 0x96DE, 0x77E6, 0x98E6, 0xB8E6, 0xB8E6, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x32B5,
+0x32B5, 0x2F94, 0xEE8B, 0x96E6, 0xB7E6, 0xB7E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0xB8E6,
+0x97E6, 0x97E6, 0x77DE, 0x77DE, 0x97E6, 0x97DE, 0x77DE, 0x97E6, 0xB8E6, 0x32B5, 0x52BD, 0x32BD, 0x97E6, 0x97E6, 0x98E6, 0xB8E6,
+0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32BD, 0x32B5, 0x32B5, 0x97E6, 0x96E6, 0x77DE, 0x97DE, 0x77DE, 0x77DE, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x52BD, 0x32B5, 0x97E6, 0x77E6, 0x77DE, 0x96DE, 0x96DE, 0x76DE, 0x77DE, 0x77DE, 0x97E6, 0x96E6, 0x32B5, 0x32B5,
+0x57DE, 0x35DE, 0x36D6, 0x97DE, 0x97DE, 0x77DE, 0x98E6, 0x96E6, 0x98E6, 0x98E6, 0x32B5, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0x76E6, 0xB8E6, 0x32B5, 0x32B5, 0x32B5, 0xD4CD, 0x52BD, 0x98E6, 0x98E6, 0x96DE, 0x97DE, 0x98E6,
+0x97E6, 0x97E6, 0x96E6, 0x32B5, 0x32B5, 0x32BD, 0xB0AC, 0x6FA4, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x32B5,
+0x32B5, 0x8C7B, 0x8C7B, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0x76DE, 0x97E6, 0x98E6, 0x11AD, 0xF1AC, 0xF1AC, 0x77DE, 0x77DE, 0x56DE,
+0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x36DE, 0x36D6, 0x15D6, 0x97E6, 0x98DE, 0x97E6, 0x76E6, 0x97E6, 0xF1AC,
+0xD1AC, 0xF5D5, 0x52BD, 0x76DE, 0x77DE, 0x76DE, 0x76DE, 0x76DE, 0xF1AC, 0xB0A4, 0x11B5, 0x8FA4, 0x77DE, 0x77DE, 0x77DE, 0x97E6,
+0x77E6, 0x2F94, 0x2F94, 0xAD7B, 0x8FA4, 0x56DE, 0x57DE, 0x77DE, 0x15D6, 0x15D6, 0xF5CD, 0x94C5, 0xD5CD, 0x36D6, 0x56DE, 0xF5CD,
+0xF5CD, 0xF5CD, 0x36D6, 0x36D6, 0x76E6, 0x98E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x35D6, 0x35D6, 0x97E6, 0x97DE, 0xF5CD, 0xF5CD, 0xF5CD,
+0x56DE, 0x57DE, 0x97E6, 0xB8E6, 0x76DE, 0xF5CD, 0xF5CD, 0x57DE, 0x56DE, 0x76DE, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0x77E6, 0x77E6,
+0x77E6, 0x96DE, 0x97E6, 0xF5CD, 0xF5CD, 0xCD83, 0x97DE, 0x76DE, 0x77E6, 0x97E6, 0x76DE, 0xD5CD, 0xD5CD, 0x6FA4, 0xD0AC, 0x77E6,
+0x77E6, 0x76DE, 0x97E6, 0x98DE, 0xD5CD, 0xD5CD, 0xD5CD, 0xF1B4, 0xD4CD, 0x35D6, 0x77DE, 0x98E6, 0x77E6, 0x76DE, 0xD5CD, 0xD5CD,
+0xD4CD, 0x56DE, 0x77E6, 0x77E6, 0xB7E6, 0x98E6, 0x76DE, 0x97DE, 0xD4CD, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x97E6,
+0x97DE, 0x97E6, 0xD4CD, 0xD4C5, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0x97DE, 0x96E6, 0x96DE, 0xB4C5, 0xB4C5, 0xED8B, 0x4F9C, 0x98E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x76DE, 0x97E6, 0xB4C5,
+0xB4C5, 0x32B5, 0x93C5, 0xF1B4, 0x52BD, 0x76DE, 0x76DE, 0x98E6, 0x98E6, 0x76DE, 0x96E6, 0x97E6, 0xB4C5, 0x93C5, 0x93C5, 0x73C5,
+0x35D6, 0xB4CD, 0xF5CD, 0x97E6, 0x98E6, 0x98DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x93BD, 0xF5CD, 0x77DE, 0x15D6,
+0x35D6, 0x98DE, 0x77DE, 0x97DE, 0x76E6, 0x77DE, 0x76E6, 0xB7E6, 0x93C5, 0x93C5, 0x93C5, 0xF5D5, 0x76DE, 0x56DE, 0x77DE, 0x77DE,
+0x98E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x76DE, 0x73BD, 0x73BD, 0xF5CD, 0x77DE, 0x56DE, 0x97E6, 0x97DE, 0x76E6, 0x97E6,
+0x97DE, 0x77E6, 0x98E6, 0x76DE, 0x76DE, 0x97E6, 0x73BD, 0x53BD, 0xD4D5, 0x77DE, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE,
+0x77DE, 0x77DE, 0x97E6, 0x97DE, 0x52BD, 0x52BD, 0xF5D5, 0x35D6, 0x35D6, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0x76DE, 0x76DE,
+0x97E6, 0x97E6, 0x73BD, 0x53BD, 0xD5CD, 0xD4CD, 0x15D6, 0xB8E6, 0x98E6, 0x98E6, 0x97DE, 0x76DE, 0xB8E6, 0x77DE, 0x96E6, 0x76DE,
+0x53BD, 0x32B5, 0x32B5, 0xF5CD, 0xF5D5, 0x36D6, 0x36D6, 0xF5D5, 0xF5D5, 0x15D6, 0xAC83, 0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x53BD, 0xF5D5, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0x15D6, 0x56DE, 0x0E94, 0x6FA4,
+0x97E6, 0xB7E6, 0x97DE, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x15D6, 0x36D6, 0x36D6, 0x36D6,
+0x55DE, 0x15D6, 0xF1AC, 0x11B5, 0xB7E6, 0x76E6, 0x97DE, 0xB8E6, 0x77DE, 0xB8E6, 0x98E6, 0x76E6, 0x76E6, 0x96E6, 0x32B5, 0x32B5,
+0x55DE, 0x55DE, 0x15D6, 0x16D6, 0x56DE, 0xF5CD, 0x52B5, 0xED8B, 0x56DE, 0x55DE, 0xEE8B, 0xF5CD, 0xF5D5, 0x97DE, 0x97DE, 0xB8E6,
+0xB9E6, 0x97E6, 0x98E6, 0x77E6, 0x98E6, 0x77DE, 0x96E6, 0x52BD, 0x32B5, 0x2E94, 0x77DE, 0x97E6, 0x15D6, 0x15D6, 0x15D6, 0x73BD,
+0x56DE, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x57DE, 0x57DE, 0x56DE, 0x55DE, 0x32B5, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x76DE, 0xB8E6, 0x98E6, 0xB8E6, 0x97E6, 0x97DE, 0x32B5, 0x12B5, 0x4F9C, 0x2F9C, 0x76DE, 0x97E6, 0x15D6, 0x36D6, 0x56DE, 0x35D6,
+0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x77DE, 0x56DE, 0x76DE, 0xD5CD, 0x36D6, 0x56DE, 0x35D6, 0x56D6, 0xB8E6, 0x97E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x96DE, 0x97E6, 0x11B5, 0x32B5, 0x8FA4, 0xB0A4, 0x97E6, 0x98E6, 0x35D6, 0x55D6, 0x56D6,
+0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x76DE, 0x77DE, 0xF5CD, 0x36D6, 0x93C5, 0x56D6, 0x56DE, 0x76DE, 0x98E6, 0x97E6,
+0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x12B5, 0xF1B4, 0x11B5, 0x15D6, 0x36D6, 0x76DE, 0x76DE, 0x77DE, 0x35D6,
+0x56DE, 0x97E6, 0x96DE, 0x36D6, 0x97E6, 0x97E6, 0xD5CD, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x8C7B, 0xCD8B, 0x76DE, 0x76DE, 0xB8E6,
+0x98E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0x76E6, 0x98E6, 0x11B5, 0x12B5, 0x32B5, 0xD4CD, 0x56D6, 0x36D6, 0x57DE, 0x76DE,
+0x97DE, 0x77DE, 0x56DE, 0xB8E6, 0x77DE, 0x97E6, 0xD4CD, 0xB8E6, 0xB7E6, 0xB7E6, 0x15D6, 0xCD8B, 0xB0AC, 0xB0AC, 0xB8E6, 0x77E6,
+0x97E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xB4CD, 0x32BD, 0x56DE, 0x77DE,
+0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x75DE, 0x14CE, 0x14CE, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x15D6, 0xB0AC, 0x11B5, 0x93C5, 0x77DE,
+0x97E6, 0xB6E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x77E6, 0xD0AC, 0xB0A4, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x56DE, 0x77DE, 0x98E6, 0x97E6, 0xD8E6, 0xB8E6, 0x98E6, 0xD4CD, 0xD4CD, 0x97E6, 0x98E6, 0x97E6,
+0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97DE, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB7E6,
+0x98E6, 0x97E6, 0x97DE, 0x98DE, 0x77DE, 0x98E6, 0x96DE, 0x36D6, 0x36D6, 0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6,
+0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0x97E6, 0xB8E6, 0x56DE, 0x77DE, 0x76DE,
+0x36D6, 0x53BD, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6,
+0xB7E6, 0xB7E6, 0x4F9C, 0x4F9C, 0x6F9C, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0x98E6, 0x97E6,
+0x97DE, 0xB8E6, 0xB8E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB0AC, 0x6FA4, 0x56DE,
+0x56DE, 0x35DE, 0x56DE, 0x77E6, 0x16D6, 0x16D6, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x98E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0x97E6, 0x98E6, 0xD9E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB4CD, 0xD5CD, 0xF5D5, 0xF5D5, 0x77E6, 0x97E6, 0x97E6, 0x36D6, 0x36D6,
+0xB7E6, 0xB7E6, 0x97DE, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xD8E6, 0x77E6, 0x97E6, 0x76DE, 0x98E6,
+0x96DE, 0xD0AC, 0xD0AC, 0xD0AC, 0x96E6, 0x97E6, 0x36D6, 0x36D6, 0x35DE, 0x77DE, 0x97E6, 0x96E6, 0xB8EE, 0x97E6, 0x98E6, 0xB8E6,
+0xD9E6, 0x97DE, 0x97E6, 0x77DE, 0xB7E6, 0xB7E6, 0xD8E6, 0x77E6, 0x77E6, 0xD4CD, 0x11B5, 0xD0AC, 0x6F9C, 0x2F94, 0x77DE, 0x56DE,
+0x15CE, 0x15CE, 0xF5CD, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xD8E6, 0x98E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0xB8E6,
+0xB8E6, 0x97DE, 0xB8E6, 0x97E6, 0x11AD, 0xF1AC, 0x56DE, 0x56DE, 0x15CE, 0xD5CD, 0xB4C5, 0x56DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6,
+0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0x98E6, 0x97DE, 0x97E6, 0x98E6, 0xF1AC, 0xF1AC,
+0x56DE, 0x36D6, 0xB4C5, 0x53BD, 0xF5D5, 0x76DE, 0x97E6, 0x76DE, 0xB8E6, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6,
+0xB8E6, 0x98E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0xF5CD, 0x52BD, 0x35D6, 0xF5D5, 0x76DE, 0x56DE,
+0x35D6, 0x76DE, 0x56DE, 0x96DE, 0xB8E6, 0x97E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6,
+0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x2E94, 0x2E94, 0x35D6, 0x8C7B, 0x97E6, 0xB7E6, 0x97E6, 0x56E6, 0x56E6, 0x77E6, 0xB8E6, 0x98E6,
+0x97E6, 0x76DE, 0xB7E6, 0x98E6, 0x98E6, 0x98E6, 0x11AD, 0x11AD, 0xF1AC, 0x97E6, 0x96E6, 0x77DE, 0x55DE, 0x97E6, 0x97E6, 0x98E6,
+0x76DE, 0xB8E6, 0x77E6, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0x77E6, 0xF1AC, 0xF1B4, 0x77DE, 0x77DE, 0x36DE, 0x98E6, 0x97E6, 0x97E6,
+0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0x77E6, 0x76DE, 0x98E6, 0xF1AC, 0x12B5, 0x15D6, 0x15D6, 0x77DE, 0x77DE, 0x97E6,
+0xB8E6, 0x97E6, 0x77E6, 0x97DE, 0x77DE, 0xB8E6, 0x98E6, 0x77E6, 0x76E6, 0x32B5, 0x11B5, 0xD4CD, 0xB4CD, 0x76DE, 0x76DE, 0x77E6,
+0xB7DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0x32B5, 0x32B5, 0x93C5, 0x11B5, 0x56DE, 0x57DE, 0x36DE,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x32B5, 0x52BD, 0xF1AC, 0xB0A4, 0x36DE, 0x36DE, 0x36D6,
+0x97DE, 0x98E6, 0x98E6, 0x98E6, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x32BD, 0x32B5, 0x32BD, 0x0E94, 0x35DE, 0x56DE, 0x98E6,
+0x76E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0x32BD, 0x32BD, 0x32B5, 0x56DE, 0x15D6, 0x76DE, 0x97E6, 0x97DE,
+0xB8E6, 0x76DE, 0xB8E6, 0x98E6, 0xB7E6, 0xB7E6, 0x97E6, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0x97E6, 0x96E6, 0x96DE, 0x98E6, 0x96E6,
+0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB7E6, 0x32B5, 0x32B5, 0xD4CD, 0x72BD, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x97DE,
+0xB7E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32BD, 0x6FA4, 0x2F94, 0xB7E6, 0x96E6, 0xB8E6, 0x97E6, 0xB8E6, 0x96DE, 0x98E6, 0x97E6,
+0x97E6, 0x32B5, 0x32B5, 0x2F94, 0xEE8B, 0xB7E6, 0xB8E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5,
+0x97E6, 0x97E6, 0x77DE, 0x76DE, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0x97E6, 0x32B5, 0x52BD, 0x32BD, 0x97E6, 0x97E6, 0x98E6, 0xB8E6,
+0x77DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x96E6, 0x97E6, 0x97DE, 0x97DE, 0x77DE, 0x77DE, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0x32B5, 0x32B5, 0x77E6, 0x77DE, 0x57DE, 0x96DE, 0x97DE, 0x76DE, 0x77DE, 0xB8E6, 0x97E6, 0x96E6, 0x32B5, 0x32B5,
+0x57DE, 0x35DE, 0x36D6, 0x97DE, 0x76DE, 0x98E6, 0x96E6, 0x98E6, 0x98E6, 0x98E6, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0x97E6, 0x97E6,
+0xB8E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD, 0x52BD, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x96E6,
+0x32B5, 0x32B5, 0x32B5, 0xB0AC, 0x6FA4, 0x97E6, 0xB8E6, 0xB8E6, 0x76DE, 0x97E6, 0x77DE, 0x97E6, 0x32B5, 0x32B5, 0x12B5, 0x8C7B,
+0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x77E6, 0x97E6, 0x97E6, 0x12B5, 0x11AD, 0xF1AC, 0x97E6, 0x77DE, 0x56DE, 0x98E6, 0x97E6, 0xB8E6,
+0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0x36DE, 0x36D6, 0x97E6, 0x98DE, 0x97E6, 0x76E6, 0x97E6, 0xF1AC, 0xF1AC, 0x15D6, 0xF5D5, 0x76DE,
+0x76DE, 0x97E6, 0x76DE, 0x76DE, 0xF1AC, 0xB0A4, 0x11B5, 0x8FA4, 0x77DE, 0x77DE, 0x77DE, 0x77DE, 0x97E6, 0x6F9C, 0x2F94, 0x8FA4,
+0x77DE, 0x56DE, 0x57DE, 0x77E6, 0x77DE, 0xAD7B, 0x15D6, 0xF5CD, 0x94C5, 0x94C5, 0xD5CD, 0xF5CD, 0xF5D5, 0x56DE, 0x76E6, 0xF5CD,
+0xF5CD, 0xF5CD, 0x36D6, 0x36D6, 0x98E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x35D6, 0x35D6, 0x97E6, 0x97DE, 0xF5CD, 0xF5CD, 0xF5CD,
+0x57DE, 0x57DE, 0x97E6, 0xB8E6, 0x76DE, 0xF5CD, 0xF5CD, 0x56DE, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0x77E6, 0x77E6,
+0x96DE, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xCD83, 0xCD83, 0x97DE, 0x76DE, 0x97E6, 0x76DE, 0x97DE, 0xD5CD, 0xF5CD, 0xD0AC, 0xF1B4,
+0x77E6, 0x77E6, 0x97DE, 0x97E6, 0x98DE, 0xD5CD, 0xD5CD, 0xD4CD, 0x35D6, 0x77DE, 0x98E6, 0x77E6, 0x77E6, 0x76DE, 0xD5CD, 0xD5CD,
+0x56DE, 0x77E6, 0xB7E6, 0x98E6, 0x78E6, 0x97DE, 0x97E6, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x78E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6,
+0xD4CD, 0xD4C5, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97DE,
+0x77DE, 0x96E6, 0xB4C5, 0xB4C5, 0xED8B, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x76DE, 0x97E6, 0xB4C5, 0xB4C5, 0xF1B4, 0xF1B4,
+0x96DE, 0x76DE, 0x76DE, 0x98E6, 0x76DE, 0x96E6, 0x97E6, 0xB4C5, 0x93C5, 0x32B5, 0x93C5, 0xB4CD, 0xF5CD, 0x97E6, 0x98E6, 0x98E6,
+0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x73C5, 0x35D6, 0x15D6, 0x35D6, 0x98DE, 0x77DE, 0x97DE, 0x76E6, 0x76E6, 0x97E6,
+0x76E6, 0x93BD, 0x93C5, 0x94C5, 0x77DE, 0x56DE, 0x56DE, 0x97DE, 0x98E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x77E6, 0x93C5, 0x93BD,
+0x73BD, 0xF5D5, 0x76DE, 0x97E6, 0x97E6, 0x77DE, 0x76DE, 0x97E6, 0x77E6, 0x98E6, 0x76DE, 0x76DE, 0x73BD, 0x73BD, 0x73BD, 0xF5CD,
+0x56DE, 0x76E6, 0x96E6, 0x97DE, 0x97DE, 0x97E6, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0x53BD, 0x52BD, 0x52BD, 0xD4D5, 0x77DE, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0x76DE, 0x97DE, 0x97E6, 0x52BD, 0x73BD, 0x53BD, 0xF5D5, 0x35D6, 0x97E6, 0xB8E6, 0x98E6,
+0x98E6, 0x97DE, 0x76DE, 0xB8E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0x53BD, 0xD5CD, 0x36D6, 0xD4CD, 0x15D6, 0x98E6, 0x96DE, 0x96E6,
+0xB8E6, 0xB8E6, 0x77DE, 0xB8E6, 0x76DE, 0x97E6, 0x32B5, 0x32B5, 0x53BD, 0xF5CD, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0xF5D5, 0x15D6,
+0xAC83, 0x0E94, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x32B5, 0xF5D5, 0xF5D5,
+0x15D6, 0x36D6, 0x36D6, 0x15D6, 0x56DE, 0x6FA4, 0xF1AC, 0xB7E6, 0xB7E6, 0x76E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6,
+0x76E6, 0x32B5, 0x32B5, 0x15D6, 0x36D6, 0x15D6, 0x36D6, 0x15D6, 0x55DE, 0x15D6, 0x11B5, 0x52BD, 0xF5CD, 0x97DE, 0x97DE, 0x77DE,
+0xB9E6, 0x98E6, 0x98E6, 0x76E6, 0x96E6, 0x98E6, 0x32B5, 0x52BD, 0x55DE, 0x55DE, 0x55DE, 0x16D6, 0x36D6, 0xF5CD, 0x52B5, 0xED8B,
+0x56DE, 0x55DE, 0xEE8B, 0xF5D5, 0x36D6, 0x36D6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x77DE, 0x96E6, 0x97E6, 0x32B5,
+0x32B5, 0x2E94, 0x4F9C, 0x97E6, 0x76DE, 0x15D6, 0x15D6, 0x73BD, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0x36D6, 0x57DE, 0x56DE,
+0x55DE, 0x32B5, 0x56DE, 0x56DE, 0x35D6, 0xB8E6, 0xB8E6, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97DE, 0x96DE, 0x12B5, 0x11B5,
+0x4F9C, 0x2F9C, 0x8FA4, 0x97E6, 0x97E6, 0x36D6, 0x56DE, 0x35D6, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x77DE, 0x56DE,
+0x76DE, 0xD5CD, 0xD5CD, 0x35D6, 0x56D6, 0x56DE, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x96DE, 0x97E6, 0x97E6, 0x32B5,
+0x12B5, 0x8FA4, 0xB0A4, 0x94C5, 0x98E6, 0x35D6, 0x55D6, 0x56D6, 0x98E6, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0x98E6, 0x76DE, 0x77DE,
+0xF5CD, 0x36D6, 0x93C5, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xF1B4,
+0x11B5, 0x15D6, 0x36D6, 0x56D6, 0x76DE, 0x77DE, 0x35D6, 0x56DE, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0x97E6, 0xD5CD, 0xD5CD, 0x97E6,
+0x98E6, 0x8C7B, 0xCD8B, 0x76DE, 0x76DE, 0x76E6, 0x98E6, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x12B5,
+0x32B5, 0xD4CD, 0x56D6, 0x36D6, 0x56DE, 0x76DE, 0x97DE, 0x77DE, 0x56DE, 0xB8E6, 0x77DE, 0x97E6, 0xD4CD, 0xB8E6, 0xB7E6, 0xB7E6,
+0x15D6, 0x15D6, 0xB0AC, 0xB0AC, 0x11B5, 0x77E6, 0x77DE, 0x98DE, 0x98DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x97E6,
+0x97E6, 0x97E6, 0xB4CD, 0x32BD, 0x56DE, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x75DE, 0x97E6, 0x14CE, 0x97E6, 0xB8E6, 0x98E6,
+0x98E6, 0x15D6, 0x11B5, 0x93C5, 0xD4CD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x98E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6,
+0x97DE, 0x77E6, 0xD0AC, 0xB0A4, 0xB0A4, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x56DE, 0x77DE, 0x98E6, 0x97E6, 0xD8E6, 0xB8E6, 0x98E6,
+0xD4CD, 0xD4CD, 0x15D6, 0x98E6, 0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97DE,
+0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0xB7E6, 0x98E6, 0x97E6, 0x97DE, 0x98DE, 0xD8E6, 0x98E6, 0x96DE, 0x36D6, 0x56DE, 0x97E6, 0x97DE,
+0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x77DE, 0x76DE, 0x96DE, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0x98E6, 0x97E6,
+0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x4F9C, 0x6F9C, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36D6, 0x16D6,
+0x16D6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97DE, 0x96DE, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6,
+0xB8E6, 0xB0AC, 0xB0AC, 0x6FA4, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x16D6, 0x16D6, 0x16D6, 0xB8E6, 0x97E6, 0xB7E6, 0x98E6, 0xB7E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0xD9E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB4CD, 0xD5CD, 0xF5D5, 0xF5D5, 0x77E6,
+0x97E6, 0x16D6, 0x36D6, 0x36D6, 0x35DE, 0x97DE, 0x97DE, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xD8E6,
+0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0x96DE, 0xD0AC, 0xD0AC, 0x96E6, 0x96E6, 0x36D6, 0x36D6, 0x36D6, 0x35DE, 0x77DE, 0x97DE, 0x96E6,
+0xB8EE, 0x98E6, 0x98E6, 0xB8E6, 0xD9E6, 0xB8E6, 0x97E6, 0x77DE, 0xB7E6, 0xB7E6, 0xD8E6, 0x77E6, 0x96DE, 0xD4CD, 0x11B5, 0xD0AC,
+0x6F9C, 0x77DE, 0x77DE, 0x16D6, 0x16D6, 0x15CE, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xD8E6, 0x98E6, 0x76DE, 0x76DE,
+0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x32B5, 0x11AD, 0xF1AC, 0x2F94, 0x56DE, 0x56DE, 0x56DE, 0x15CE, 0xD5CD, 0x56DE,
+0x76DE, 0xB8E6, 0xB8E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x77E6, 0x98E6, 0x97E6,
+0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x56DE, 0x56DE, 0x36D6, 0xB4C5, 0x53BD, 0xF5D5, 0x76DE, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6,
+0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x36D6,
+0xF5CD, 0x52BD, 0x35D6, 0xF5D5, 0x76DE, 0x56DE, 0x35D6, 0x76DE, 0x56DE, 0x96DE, 0xB8E6, 0x77E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6,
+0x97E6, 0xB8E6, 0xB7E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0x2E94, 0x35D6, 0x8C7B, 0x97E6, 0xB7E6, 0xB8E6, 0x56E6,
+0x77E6, 0x77E6, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0x98E6, 0x11AD, 0x11AD, 0x97E6, 0x96E6, 0x77DE, 0x55DE,
+0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0xD1AC, 0xF1AC, 0x77DE, 0x77DE, 0x97E6, 0x98E6,
+0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0x76DE, 0xF1B4, 0xF1AC, 0x15D6, 0x15D6, 0x97E6, 0x77DE,
+0x77DE, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x77DE, 0x98E6, 0x98E6, 0x77E6, 0x12B5, 0x32B5, 0xF5CD, 0xD4CD, 0x77DE, 0x76DE,
+0x77E6, 0x97E6, 0xB7DE, 0x97DE, 0x97E6, 0xB8E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x32B5, 0x32B5, 0xB4CD, 0x93C5, 0x77E6, 0x56DE,
+0x57DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x32B5, 0x32B5, 0x11B5, 0xF1AC, 0x57DE, 0x36DE,
+0x36DE, 0xB7DE, 0x97DE, 0x97DE, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x98E6, 0xB7E6, 0x52BD, 0x32BD, 0x0E94, 0x36D6, 0x35DE, 0x98E6,
+0x98E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x77E6, 0x32B5, 0x32BD, 0x56DE, 0x56DE, 0x76E6, 0x76DE, 0x97DE, 0x97DE,
+0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x32BD, 0x32B5, 0xF5D5, 0x15D6, 0x97E6, 0x97E6, 0xB8E6, 0x76DE, 0xB8E6, 0x98E6, 0x97E6,
+0x97E6, 0xB7E6, 0x32B5, 0x32B5, 0xF5D5, 0xD4CD, 0x96DE, 0x96E6, 0x96E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x32B5,
+0x32BD, 0x72BD, 0x32BD, 0x97E6, 0x96DE, 0x77E6, 0x98E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x2F94, 0x2F94,
+0xB7E6, 0x96E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0xB8E6, 0xB8E6, 0x97E6, 0x96E6, 0x77DE,
+0x97E6, 0x97DE, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0x97E6,
+0x52BD, 0x32BD, 0x32B5, 0x97E6, 0x97E6, 0xB8E6, 0x77DE, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD, 0x96E6,
+0x97E6, 0x77E6, 0x77DE, 0x96DE, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x52BD, 0x32B5, 0x32B5, 0x77E6, 0x77DE, 0x57DE, 0x96DE, 0x97DE,
+0x77DE, 0x77DE, 0x97E6, 0x96E6, 0x32B5, 0x32B5, 0x32B5, 0x35DE, 0x36D6, 0x15D6, 0x97DE, 0x76DE, 0x98E6, 0x96E6, 0x98E6, 0x98E6,
+0x32B5, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0xD4CD, 0x97E6, 0x98E6, 0xB8E6, 0x97DE, 0x76E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0xD4CD,
+0x52BD, 0x32BD, 0x98E6, 0x96DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x96E6, 0x32B5, 0x32B5, 0xB0AC, 0x6FA4, 0x97E6, 0xB8E6, 0x76DE,
+0x97E6, 0x77DE, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0x97E6, 0x97E6, 0x98E6, 0x11AD, 0xF1AC, 0x77DE,
+0x77DE, 0x76DE, 0x98E6, 0x98E6, 0xB8E6, 0x97E6, 0xF1AC, 0xF1AC, 0x36DE, 0x36D6, 0x97E6, 0x98DE, 0x98DE, 0x97E6, 0x76E6, 0xF1AC,
+0xF1AC, 0x15D6, 0xF5D5, 0x76DE, 0x76DE, 0x77DE, 0x76DE, 0x76DE, 0xD1AC, 0xF1AC, 0x52BD, 0x11B5, 0x77DE, 0x77DE, 0x77DE, 0x77DE,
+0x97E6, 0x6F9C, 0x6F9C, 0x8FA4, 0x8FA4, 0x77DE, 0x77DE, 0x56DE, 0x77E6, 0x77DE, 0xAD7B, 0x57DE, 0x57DE, 0x15D6, 0x15D6, 0xF5CD,
+0x94C5, 0x36D6, 0x56DE, 0xF5CD, 0xF5CD, 0xF5D5, 0x56DE, 0x76E6, 0x98E6, 0xF5CD, 0xF5CD, 0x36D6, 0x35D6, 0x98E6, 0x97E6, 0xF5CD,
+0xF5CD, 0xF5CD, 0x35D6, 0x56DE, 0x97DE, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x57DE, 0x57DE, 0xB8E6, 0x76DE, 0xF5CD, 0xF5CD, 0xF5CD,
+0x56DE, 0x56DE, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD, 0x77E6, 0x77E6, 0x96DE, 0x97E6, 0xF5CD, 0xF5CD, 0xD5CD, 0xCD83, 0x6FA4,
+0x76DE, 0x77E6, 0x76DE, 0x76DE, 0xD5CD, 0xD5CD, 0xD0AC, 0xF1B4, 0x77E6, 0x76DE, 0x97E6, 0x98DE, 0xD5CD, 0xD5CD, 0xD4CD, 0x35D6,
+0x77DE, 0x98E6, 0x77E6, 0x76DE, 0xD5CD, 0xD5CD, 0x77E6, 0x97E6, 0x98E6, 0x98E6, 0x76DE, 0x97DE, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6,
+0x98E6, 0x97DE, 0x97DE, 0x97DE, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0xD4CD, 0xD4CD, 0x97E6,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x96E6, 0xB4C5, 0xB4C5, 0xED8B, 0x97E6, 0x98E6, 0x96DE, 0x97DE, 0xB8E6, 0x96DE, 0x76DE,
+0xB4C5, 0xB4C5, 0x4F9C, 0xF1B4, 0x96DE, 0x76DE, 0x76DE, 0x98E6, 0x76DE, 0x97E6, 0x96E6, 0xB4C5, 0xB4C5, 0x52BD, 0xB4CD, 0x76DE,
+0x97E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x32B5, 0x93C5, 0x15D6, 0x35D6, 0x98E6, 0x98DE, 0x77DE, 0x97DE,
+0x76E6, 0x97E6, 0x76E6, 0x93BD, 0x93C5, 0x73C5, 0x73C5, 0x35D6, 0x56DE, 0x56DE, 0x97DE, 0x98E6, 0x77DE, 0x77DE, 0xB8E6, 0xB7E6,
+0x77E6, 0x93C5, 0x93BD, 0x94C5, 0x77DE, 0x77DE, 0x97E6, 0x77DE, 0x76DE, 0x97E6, 0x77E6, 0x98E6, 0x97E6, 0x76DE, 0x73BD, 0x73BD,
+0xF5D5, 0xF5CD, 0x76DE, 0x97DE, 0x76E6, 0x97E6, 0x97DE, 0x98E6, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0x73BD, 0x53BD, 0xF5CD, 0x56DE,
+0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x77DE, 0x76DE, 0x97DE, 0x97E6, 0x52BD, 0x73BD, 0xD4D5, 0xF5CD, 0x77DE, 0x97E6, 0xB8E6,
+0x76DE, 0x98E6, 0x76DE, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0xD5CD, 0xF5D5, 0x35D6, 0x98E6, 0x96DE, 0x97DE, 0xB8E6,
+0xB8E6, 0x77DE, 0x97E6, 0x96E6, 0x76DE, 0x53BD, 0x32B5, 0xD5CD, 0x36D6, 0x36D6, 0xD4CD, 0xD4CD, 0x35D6, 0xAC83, 0xAC83, 0x96E6,
+0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0x36D6, 0xF5D5,
+0x15D6, 0x6FA4, 0xF1AC, 0xB7E6, 0xB7E6, 0x97DE, 0xB8E6, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0xF5D5, 0x15D6,
+0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x15D6, 0x15D6, 0x11B5, 0x52BD, 0x76E6, 0x97DE, 0xB8E6, 0x77DE, 0x97E6, 0xB8E6, 0x97E6, 0x76E6,
+0x96E6, 0x32B5, 0x32B5, 0x36D6, 0x15D6, 0x36D6, 0x15D6, 0x16D6, 0x55DE, 0x15D6, 0xF5CD, 0xF5D5, 0x97DE, 0xB8E6, 0xB9E6, 0x97E6,
+0x98E6, 0x77E6, 0x96E6, 0x98E6, 0x77DE, 0x52BD, 0x32B5, 0x55DE, 0x55DE, 0x16D6, 0x36D6, 0x15D6, 0xF5CD, 0x52B5, 0x36D6, 0xED8B,
+0x56DE, 0x77DE, 0x55DE, 0x36D6, 0x56DE, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0x32B5, 0x32B5,
+0x32B5, 0x2E94, 0x4F9C, 0x97E6, 0x76DE, 0x15D6, 0x15D6, 0x15D6, 0x32B5, 0x73BD, 0x97E6, 0x76DE, 0x97E6, 0x56DE, 0x97E6, 0x36D6,
+0x57DE, 0x56DE, 0x55DE, 0x32B5, 0x56DE, 0x35D6, 0x56D6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97DE, 0x96DE, 0x12B5,
+0x11B5, 0x11B5, 0x2F9C, 0x8FA4, 0x97E6, 0x97E6, 0x36D6, 0x56DE, 0x32B5, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x77DE,
+0x56DE, 0x56DE, 0x76DE, 0x32B5, 0x56D6, 0x56DE, 0x76DE, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x32B5,
+0x12B5, 0xF1B4, 0xB0A4, 0x94C5, 0x98E6, 0x35D6, 0x55D6, 0x56D6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76DE, 0x77DE,
+0xF5CD, 0x36D6, 0x93C5, 0x76DE, 0x76DE, 0x76DE, 0xB8E6, 0x98E6, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xF1B4, 0x11B5,
+0x12B5, 0x36D6, 0x36D6, 0x76DE, 0x77DE, 0x35D6, 0x56DE, 0x97E6, 0x96DE, 0xB8E6, 0x97E6, 0x97E6, 0x77DE, 0xD5CD, 0x97E6, 0x98E6,
+0xCD8B, 0xB0AC, 0x76E6, 0x76E6, 0xB8E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0x12B5, 0x32B5, 0xF5D5,
+0xD4CD, 0xB4CD, 0x36D6, 0x56DE, 0x76DE, 0x97DE, 0x77DE, 0x56DE, 0xB8E6, 0x77DE, 0x97E6, 0xD4CD, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6,
+0x15D6, 0xB0AC, 0x11B5, 0x77E6, 0x77DE, 0x98DE, 0x98DE, 0xB6E6, 0x98E6, 0x97DE, 0x98E6, 0x98E6, 0xB7E6, 0x97E6, 0x97E6, 0x98E6,
+0x98E6, 0x32BD, 0x12B5, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x75DE, 0x97E6, 0x14CE, 0x97E6, 0xB8E6, 0x98E6, 0x98E6, 0x15D6,
+0x93C5, 0xD4CD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x77E6, 0x77E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0x97DE, 0x77E6, 0xD0AC,
+0xB0A4, 0xB0A4, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x56DE, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x15D6, 0x15D6, 0x98E6,
+0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97DE, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6,
+0xB7E6, 0x98E6, 0x97E6, 0x97DE, 0x98DE, 0xD8E6, 0x98E6, 0xD5CD, 0x56DE, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0xB8E6, 0x96DE, 0x98E6,
+0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77DE, 0x76DE,
+0x96DE, 0x53BD, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6,
+0xB7E6, 0x4F9C, 0x4F9C, 0x6F9C, 0x98E6, 0x77DE, 0x56DE, 0x56DE, 0x36D6, 0x36D6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6,
+0xB7E6, 0x96DE, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB0AC, 0xB0AC, 0x6FA4, 0x56DE, 0x56DE, 0x35DE, 0x56DE,
+0x16D6, 0x16D6, 0xB8E6, 0x97E6, 0xB7E6, 0x98E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0xD9E6, 0x97E6, 0xB8E6,
+0x77E6, 0x32BD, 0xB4CD, 0x36DE, 0x36DE, 0xF5D5, 0x77E6, 0x97E6, 0x16D6, 0x36D6, 0x35DE, 0x97DE, 0x97E6, 0x77E6, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xD8E6, 0x77E6, 0x97E6, 0xB8E6, 0x98E6, 0xD5CD, 0x52BD, 0xD0AC, 0xD0AC, 0x96E6, 0x96E6,
+0x36D6, 0x36D6, 0x77DE, 0x97DE, 0x96E6, 0xB8EE, 0x98E6, 0x97E6, 0xB8E6, 0xD9E6, 0xB8E6, 0x97E6, 0x77DE, 0xB7E6, 0xB7E6, 0xD8E6,
+0x77E6, 0xD4CD, 0xD4CD, 0xD0AC, 0xD0AC, 0x6F9C, 0x77DE, 0x77DE, 0x16D6, 0x16D6, 0x35D6, 0x35D6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0xD8E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97DE, 0xB8E6, 0x32B5, 0x11AD, 0x6F9C, 0x2F94, 0x56DE,
+0x56DE, 0xF5CD, 0x15CE, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xB7E6,
+0xB7E6, 0x77E6, 0x98E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0x56DE, 0x56DE, 0xD5CD, 0xB4C5, 0xF5D5, 0x76DE, 0x97E6, 0x76DE, 0xB8E6,
+0x97DE, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6, 0x98E6, 0x97DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0xF1AC, 0xF1AC,
+0x36D6, 0xF5CD, 0x53BD, 0xF5D5, 0xD5CD, 0x76DE, 0x56DE, 0x97DE, 0x76DE, 0x56DE, 0x96DE, 0xB8E6, 0x77E6, 0x77DE, 0xB8E6, 0x97E6,
+0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0x52BD, 0x2E94, 0x8C7B, 0x56DE, 0x97E6, 0xB7E6, 0xB8E6,
+0x56E6, 0x77E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0xB8E6, 0xB7E6, 0x97E6, 0x98E6, 0xF1AC, 0x11AD, 0x97E6, 0x96E6, 0x77DE, 0x55DE,
+0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0xB7E6, 0x98E6, 0x77DE, 0x98E6, 0x97E6, 0xF1AC, 0xD1AC, 0x77DE, 0x77DE, 0x97E6, 0x98E6, 0x98E6,
+0x97E6, 0x77E6, 0x98E6, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0x77E6, 0xF1AC, 0xF1B4, 0x36DE, 0x15D6, 0x15D6, 0x77DE, 0x77DE, 0x97DE,
+0x97E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x77DE, 0x98E6, 0x77E6, 0xF1AC, 0x12B5, 0x15D6, 0xF5CD, 0xD4CD, 0x77DE, 0x76DE, 0x97E6,
+0xB7DE, 0x77E6, 0x97DE, 0x77DE, 0xB8E6, 0x77E6, 0x76E6, 0x77E6, 0x11B5, 0x32B5, 0xD4CD, 0xB4CD, 0x93C5, 0x77E6, 0x56DE, 0xB8E6,
+0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x77E6, 0x32B5, 0x32B5, 0x11B5, 0xF1AC, 0xF1AC, 0x57DE, 0x36DE, 0x97E6,
+0xB7DE, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x98E6, 0x32B5, 0x52BD, 0xB0A4, 0x0E94, 0x36D6, 0x36D6, 0x97DE, 0x98E6,
+0x98E6, 0x96DE, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x97E6, 0x32BD, 0x32B5, 0x56DE, 0x56DE, 0x76E6, 0x76E6, 0x98E6, 0x97DE, 0x97E6,
+0xB8E6, 0x77E6, 0xB8E6, 0xB7E6, 0x32BD, 0x32BD, 0x56DE, 0x15D6, 0xF5D5, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6,
+0xB7E6, 0x32B5, 0x32B5, 0x32B5, 0xF5D5, 0x15D6, 0xF5D5, 0x96E6, 0x96DE, 0x98E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x32B5,
+0x32B5, 0x32B5, 0xD4CD, 0xD4CD, 0x72BD, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x97DE, 0xB7E6, 0xB8E6, 0x32B5, 0x32BD, 0x32B5,
+0x32BD, 0x6FA4, 0x2F94, 0xB7E6, 0xB7E6, 0x98E6, 0xB8E6, 0xB8E6, 0x96DE, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x2F94, 0xEE8B,
+0xB7E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x97E6, 0x77DE, 0x76DE,
+0x97DE, 0x97DE, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6,
+0x52BD, 0x32BD, 0x97E6, 0x97E6, 0x96E6, 0x77DE, 0x97DE, 0x98E6, 0x77DE, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x97E6, 0x77E6, 0x77DE,
+0x77DE, 0x96DE, 0x97E6, 0x76DE, 0x97E6, 0xB8E6, 0x32B5, 0x32B5, 0x77DE, 0x57DE, 0x35DE, 0x97DE, 0x97DE, 0x77DE, 0x77DE, 0x97E6,
+0x96E6, 0x32B5, 0x32B5, 0x35DE, 0x36D6, 0x15D6, 0x76DE, 0x97E6, 0x96E6, 0xB8E6, 0x98E6, 0x98E6, 0x32B5, 0x32B5, 0x15D6, 0xF5D5,
+0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD, 0x32BD, 0x98E6, 0x98E6, 0x96DE, 0x97DE, 0x98E6,
+0x97E6, 0x96E6, 0x32B5, 0x32B5, 0xB0AC, 0x6FA4, 0x97E6, 0xB8E6, 0x97E6, 0x76DE, 0x97E6, 0x77DE, 0x97E6, 0x32B5, 0x32B5, 0x8C7B,
+0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x76DE, 0x97E6, 0x97E6, 0x12B5, 0x11AD, 0x97E6, 0x77DE, 0x56DE, 0x98E6, 0x97E6, 0xB8E6, 0x97E6,
+0xF1AC, 0xF1AC, 0x56DE, 0x36DE, 0x97E6, 0x97E6, 0x98DE, 0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0x15D6, 0xF5D5, 0x98DE, 0x76DE, 0x76DE,
+0x97E6, 0x76DE, 0xD1AC, 0xF1AC, 0x52BD, 0x11B5, 0x77DE, 0x77DE, 0x77DE, 0x76DE, 0x77DE, 0xB0A4, 0x6F9C, 0x8FA4, 0x8FA4, 0x77DE,
+0x77DE, 0x56DE, 0x77E6, 0x77DE, 0x2F94, 0xAD7B, 0x56DE, 0x57DE, 0x15D6, 0x15D6, 0x15D6, 0xF5CD, 0x94C5, 0xD5CD, 0x36D6, 0x56DE,
+0xF5CD, 0xF5CD, 0xF5D5, 0x36D6, 0x76E6, 0x98E6, 0x98E6, 0xF5CD, 0xF5CD, 0x36D6, 0x35D6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xF5CD,
+0x35D6, 0x56DE, 0x97DE, 0x97E6, 0xF5CD, 0xF5CD, 0x57DE, 0x57DE, 0xB8E6, 0x76DE, 0xF5CD, 0xF5CD, 0x56DE, 0x77E6, 0x97E6, 0x97E6,
+0xF5CD, 0xF5CD, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0xCD83, 0x6FA4, 0x6FA4, 0x76DE, 0x77E6, 0x76DE, 0x97DE, 0xD5CD,
+0xF5CD, 0xD0AC, 0xF1B4, 0xD4CD, 0x76DE, 0x76DE, 0x97E6, 0x98DE, 0xD5CD, 0xD5CD, 0xD4CD, 0x35D6, 0x77DE, 0x98E6, 0xB7E6, 0x76DE,
+0x76DE, 0xD5CD, 0xD5CD, 0x56DE, 0x77E6, 0xB7E6, 0x98E6, 0x76DE, 0x97DE, 0x97E6, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x78E6, 0x98E6,
+0x97E6, 0x97DE, 0xD4CD, 0xD4CD, 0xD4C5, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xD4C5, 0xD4CD, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0x77DE, 0x77DE, 0xD4CD, 0xB4C5, 0xED8B, 0xED8B, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96DE, 0x76DE, 0xB4C5, 0xB4C5, 0x4F9C,
+0xF1B4, 0x52BD, 0x76DE, 0x76DE, 0x96DE, 0x98E6, 0x97E6, 0x96E6, 0xB4C5, 0xB4C5, 0x52BD, 0xB4CD, 0x76DE, 0x97E6, 0x98E6, 0x77E6,
+0x77E6, 0x97E6, 0x97E6, 0x93C5, 0x93C5, 0xF5CD, 0x15D6, 0x98E6, 0x98DE, 0xB8E6, 0x97DE, 0x76E6, 0x97E6, 0x97E6, 0x93C5, 0x93BD,
+0x32B5, 0x32B5, 0x56DE, 0x56DE, 0x77DE, 0x97DE, 0x76E6, 0x77DE, 0x76E6, 0xB7E6, 0x77E6, 0x93C5, 0x93C5, 0x73C5, 0x35D6, 0x77DE,
+0x97E6, 0x77DE, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x97E6, 0x93BD, 0x73BD, 0x73BD, 0x94C5, 0x94C5, 0x35D6, 0x97DE, 0x76E6, 0x97E6,
+0x97DE, 0x98E6, 0x98E6, 0x76DE, 0x76DE, 0x73BD, 0x73BD, 0xF5CD, 0x76DE, 0x96E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0x77DE, 0x97E6,
+0x97E6, 0x53BD, 0x52BD, 0xF5CD, 0x56DE, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x73BD, 0x73BD,
+0xF5CD, 0x77DE, 0xB8E6, 0x98E6, 0x96DE, 0x97DE, 0x97DE, 0x76DE, 0xB8E6, 0x97E6, 0x96E6, 0x53BD, 0x53BD, 0xD5CD, 0x36D6, 0xF5D5,
+0x35D6, 0x35D6, 0x96DE, 0x96E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x76DE, 0x97E6, 0x32B5, 0x53BD, 0xF5CD, 0x36D6, 0x36D6,
+0x36D6, 0xD4CD, 0x35D6, 0x0E94, 0x0E94, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0x77DE, 0x98E6, 0x77E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD,
+0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0xF5D5, 0x15D6, 0xF1AC, 0x11B5, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0x97E6,
+0x76E6, 0x32B5, 0x32B5, 0x15D6, 0x36D6, 0x36D6, 0x36D6, 0x15D6, 0x15D6, 0x52BD, 0xF5CD, 0x97DE, 0x97DE, 0x77DE, 0x77DE, 0xB8E6,
+0x98E6, 0x76E6, 0x96E6, 0x32B5, 0x32B5, 0x52BD, 0x15D6, 0x55DE, 0x15D6, 0x16D6, 0x55DE, 0x15D6, 0xF5D5, 0x36D6, 0xB8E6, 0x97E6,
+0x97E6, 0x97E6, 0x77E6, 0x77E6, 0x98E6, 0x77DE, 0x52BD, 0x32B5, 0x32B5, 0x55DE, 0x77DE, 0x36D6, 0x15D6, 0xF5CD, 0x56DE, 0x52B5,
+0x36D6, 0xED8B, 0xED8B, 0x77DE, 0x55DE, 0x56DE, 0x56DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0x97E6, 0x97E6, 0x32B5,
+0x32B5, 0x4F9C, 0x2F9C, 0x76DE, 0x76DE, 0x15D6, 0x15D6, 0x32B5, 0x73BD, 0x97E6, 0x76DE, 0x76DE, 0x56DE, 0x97E6, 0x36D6, 0x57DE,
+0x56DE, 0x55DE, 0x32B5, 0x35D6, 0x56D6, 0x56DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x96DE, 0x97E6, 0x11B5, 0x11B5,
+0x2F9C, 0x8FA4, 0xB0A4, 0x97E6, 0x98E6, 0x56DE, 0x56DE, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0x77DE, 0x77DE, 0x56DE,
+0x76DE, 0x32B5, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x12B5, 0xF1B4, 0xB0A4,
+0x94C5, 0x98E6, 0x35D6, 0x76DE, 0x56D6, 0x35D6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76DE, 0x77DE, 0xF5CD, 0x36D6, 0x36D6,
+0x8C7B, 0x8C7B, 0x76DE, 0x76DE, 0xB8E6, 0x98E6, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0x76E6, 0x11B5, 0x12B5, 0x36D6,
+0x36D6, 0x76DE, 0x77DE, 0x35D6, 0x56DE, 0x77DE, 0x96DE, 0xB8E6, 0x97E6, 0x97E6, 0x77DE, 0xD5CD, 0x97E6, 0x98E6, 0xB0AC, 0xB0AC,
+0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xB7E6, 0xB7E6, 0x32B5, 0xF5D5, 0xD4CD, 0xB4CD, 0x36D6,
+0x56DE, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0xB8E6, 0x77DE, 0x97E6, 0xD4CD, 0xB8E6, 0xB7E6, 0xB7E6, 0x97E6, 0x15D6, 0x11B5, 0x93C5,
+0x77DE, 0x97E6, 0xB6E6, 0xB6E6, 0x98E6, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x98E6, 0x32BD, 0x12B5, 0x77DE,
+0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x96DE, 0x97E6, 0x14CE, 0xB8E6, 0xB8E6, 0x98E6, 0x98E6, 0x15D6, 0xD4CD, 0xD4CD, 0x97E6, 0x98E6,
+0x97E6, 0x97DE, 0x77E6, 0x77E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB0A4, 0xB0A4, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0x56DE, 0x77DE, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0x15D6, 0x36D6, 0x36D6, 0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6,
+0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97DE, 0x97E6, 0x4F9C, 0x4F9C, 0xB7E6, 0xB7E6, 0x98E6, 0x97E6, 0x97DE, 0x98DE, 0xD8E6,
+0x98E6, 0xD5CD, 0xD5CD, 0x97E6, 0x97E6, 0x76DE, 0x76DE, 0xB8E6, 0x96DE, 0x98E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77DE, 0x76DE, 0x96DE, 0x53BD, 0x97E6, 0x97E6, 0x97E6, 0x98E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x4F9C, 0x97E6, 0x98E6, 0x77DE,
+0x56DE, 0x56DE, 0x36D6, 0x36D6, 0x97E6, 0x98E6, 0x97E6, 0x97DE, 0xB7E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6,
+0xB8E6, 0xB7E6, 0xB8E6, 0xB0AC, 0xB0AC, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x56DE, 0x16D6, 0x16D6, 0x97E6, 0x97E6, 0xB7E6, 0x98E6,
+0xB7E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x98E6, 0xD9E6, 0x97E6, 0xB8E6, 0x77E6, 0x32BD, 0xB4CD, 0x36DE, 0x36DE, 0x56DE,
+0x77E6, 0x16D6, 0x16D6, 0x36D6, 0x35DE, 0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x97E6, 0xD8E6,
+0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xD5CD, 0x52BD, 0xD0AC, 0x97E6, 0x97E6, 0x36D6, 0x36D6, 0x77DE, 0x97DE, 0x96E6, 0xB8EE, 0x98E6,
+0x97E6, 0xD9E6, 0xD9E6, 0xB8E6, 0x97E6, 0xD8E6, 0xB7E6, 0xB7E6, 0xD8E6, 0x77E6, 0xD4CD, 0xD4CD, 0xD0AC, 0xD0AC, 0x97E6, 0x77DE,
+0x36D6, 0x36D6, 0x35D6, 0x56DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0xD8E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6,
+0x77E6, 0x97DE, 0xB8E6, 0x32B5, 0x11AD, 0x6F9C, 0x2F94, 0x77DE, 0x56DE, 0x15CE, 0xF5CD, 0x56DE, 0x76DE, 0x76DE, 0x97E6, 0x76DE,
+0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0x77E6, 0xB8E6, 0x97E6, 0x11AD, 0xF1AC, 0xF1AC, 0x56DE,
+0x56DE, 0x15CE, 0xD5CD, 0xF5D5, 0xF5D5, 0x76DE, 0x97E6, 0x76DE, 0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6,
+0xB7E6, 0x98E6, 0x97DE, 0x97DE, 0x98E6, 0x98E6, 0xF1AC, 0xF1AC, 0x36D6, 0x36D6, 0xB4C5, 0x53BD, 0xF5D5, 0xD5CD, 0x56DE, 0x56DE,
+0x97DE, 0x76DE, 0x97E6, 0x96DE, 0xB8E6, 0x77E6, 0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x76E6, 0x97E6, 0xF1AC,
+0xF1AC, 0x52BD, 0x2E94, 0x8C7B, 0xB8E6, 0x97E6, 0x77DE, 0xB8E6, 0x56E6, 0x77E6, 0xB8E6, 0x98E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6,
+0x97E6, 0xF1AC, 0xF1AC, 0x97E6, 0x97E6, 0x56E6, 0x77DE, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE, 0xB8E6, 0x98E6, 0x98E6, 0x98E6, 0x98E6,
+0x11AD, 0xF1AC, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x98E6, 0xB8E6, 0x98E6, 0x98E6, 0xD1AC,
+0xF1AC, 0x36DE, 0x15D6, 0x97E6, 0x77DE, 0x97DE, 0x97DE, 0x98E6, 0x97E6, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE, 0x98E6, 0xF1AC, 0xF1AC,
+0x15D6, 0xF5CD, 0x77DE, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x77E6, 0x97E6, 0x77DE, 0xB8E6, 0x77E6, 0x76E6, 0x32B5, 0x11B5, 0xB4CD,
+0xB4CD, 0x76DE, 0x77E6, 0xB7DE, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x76E6, 0x77E6, 0x98E6, 0x32B5, 0x32B5, 0x11B5, 0xF1AC,
+0x57DE, 0x57DE, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x77E6, 0x32B5, 0x32B5, 0x32B5, 0xF1AC, 0xB0A4, 0x0E94,
+0x36DE, 0x36D6, 0x97DE, 0x97DE, 0x97DE, 0x98E6, 0xB8E6, 0xB8E6, 0x98E6, 0xB7E6, 0x52BD, 0x52BD, 0x0E94, 0x35DE, 0x56DE, 0x98E6,
+0x76E6, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0x32B5, 0x32BD, 0x56DE, 0x56DE, 0x15D6, 0x76DE, 0x97E6, 0x97DE, 0xB8E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x32BD, 0x32B5, 0xF5D5, 0xF5D5, 0x97E6, 0x97E6, 0x96E6, 0x76DE, 0x98E6, 0x98E6, 0x97E6, 0x97E6,
+0x97E6, 0x32B5, 0x32B5, 0xF5D5, 0xD4CD, 0x96DE, 0x96DE, 0x98E6, 0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x32B5, 0x32B5,
+0x72BD, 0x32BD, 0x97E6, 0x96DE, 0x77E6, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x6FA4, 0x2F94, 0xB7E6,
+0x96E6, 0xB8E6, 0x97E6, 0x96DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0xB7E6, 0xB8E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x77DE, 0x76DE, 0x97DE, 0x77DE, 0x97E6, 0xB8E6, 0x32B5, 0x32B5, 0x97E6,
+0x97E6, 0xB8E6, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x32BD, 0x32B5, 0x96E6, 0x97E6, 0x97DE, 0x77DE, 0x77DE, 0x77DE, 0x97E6,
+0x97E6, 0x32B5, 0x52BD, 0x97E6, 0x77E6, 0x77DE, 0x96DE, 0x96DE, 0x76DE, 0x77DE, 0xB8E6, 0xB8E6, 0x32B5, 0x32B5, 0x57DE, 0x57DE,
+0x96DE, 0x97DE, 0x97DE, 0x77DE, 0x98E6, 0x96E6, 0x98E6, 0x32B5, 0x32B5, 0x36D6, 0x15D6, 0x76DE, 0x76DE, 0x98E6, 0x96E6, 0xB8E6,
+0x98E6, 0x76E6, 0x32B5, 0x32B5, 0xF5D5, 0xD4CD, 0x97E6, 0x98E6, 0x97DE, 0x97DE, 0x76E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x52BD,
+0x32BD, 0x98E6, 0x96DE, 0x97DE, 0x98E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x32B5, 0x6FA4, 0x6FA4, 0x97E6, 0xB8E6, 0x76DE, 0x97E6,
+0x77DE, 0x97E6, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0x97E6, 0x97E6, 0x12B5, 0x11AD, 0x77DE, 0x56DE, 0x98E6, 0x98E6,
+0x98E6, 0xB8E6, 0xF1AC, 0xF1AC, 0x36DE, 0x36D6, 0x97E6, 0x98DE, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0x15D6, 0xF5D5, 0x76DE, 0x76DE,
+0x97E6, 0x76DE, 0xD1AC, 0xD1AC, 0x52BD, 0x52BD, 0x11B5, 0x77DE, 0x77DE, 0x76DE, 0x77DE, 0xB0A4, 0x6F9C, 0x8FA4, 0x8FA4, 0x77DE,
+0x77DE, 0x77DE, 0x97E6, 0x77E6, 0x2F94, 0xAD7B, 0x56DE, 0x57DE, 0x77DE, 0x77DE, 0x15D6, 0x15D6, 0xF5CD, 0x94C5, 0xD5CD, 0xF5D5,
+0x56DE, 0x76E6, 0xF5CD, 0xF5CD, 0x36D6, 0x36D6, 0x98E6, 0x97E6, 0xF5CD, 0xF5CD, 0x35D6, 0x35D6, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD,
+0xF5CD, 0x56DE, 0x57DE, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0x57DE, 0x56DE, 0x76DE, 0x97E6, 0xF5CD, 0xF5CD, 0x56DE, 0x77E6, 0x97E6,
+0x96DE, 0xF5CD, 0xF5CD, 0xCD83, 0x97DE, 0x97DE, 0x97E6, 0x97E6, 0xF5CD, 0xD5CD, 0xCD83, 0x6FA4, 0x76DE, 0x77E6, 0x76DE, 0x76DE,
+0xD5CD, 0xD5CD, 0xF5CD, 0xD0AC, 0xF1B4, 0x77E6, 0x76DE, 0x97E6, 0x98DE, 0xD5CD, 0xD5CD, 0x35D6, 0x35D6, 0x77DE, 0x98E6, 0x77E6,
+0x76DE, 0xD5CD, 0xD5CD, 0x77E6, 0x97E6, 0x98E6, 0x98E6, 0x76DE, 0x97DE, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x97DE,
+0x97DE, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0x97DE, 0x98E6, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0x77DE, 0xD4CD, 0xB4C5, 0xED8B, 0x97E6, 0x98E6, 0x97DE, 0xB8E6, 0x96E6, 0x96DE, 0xB4C5, 0xB4C5, 0x4F9C, 0xF1B4, 0x96DE,
+0x76DE, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0xB4C5, 0xB4C5, 0x52BD, 0xB4CD, 0xB4CD, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x97E6, 0x97E6,
+0x93C5, 0x93C5, 0xF5CD, 0x15D6, 0x98E6, 0x98DE, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x93C5, 0x93BD, 0x35D6, 0x56DE, 0x77DE,
+0x97DE, 0x76E6, 0x77DE, 0x97E6, 0x76E6, 0x93BD, 0x93C5, 0x32B5, 0x56DE, 0x77DE, 0x98E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0x97E6,
+0x93C5, 0x93BD, 0x73C5, 0x35D6, 0x93C5, 0x97DE, 0x76E6, 0x76DE, 0x97E6, 0x77E6, 0x98E6, 0x76DE, 0x76DE, 0x73BD, 0x73BD, 0x94C5,
+0x35D6, 0x76E6, 0x96E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0x53BD, 0x52BD, 0xF5CD, 0x76DE, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0x77DE, 0x76DE, 0x97DE, 0x97DE, 0x97E6, 0x52BD, 0x73BD, 0xF5D5, 0x56DE, 0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x76DE,
+0x76DE, 0x97E6, 0x97E6, 0x73BD, 0x53BD, 0xF5CD, 0x77DE, 0x96DE, 0x96E6, 0x97DE, 0xB8E6, 0xB8E6, 0x77DE, 0x96E6, 0x76DE, 0x53BD,
+0x32B5, 0xD5CD, 0x36D6, 0xD4D5, 0x35D6, 0xAC83, 0x0E94, 0x97E6, 0x97E6, 0xB8E6, 0x97DE, 0xB8E6, 0x77DE, 0x97E6, 0x97E6, 0x53BD,
+0x53BD, 0xF5CD, 0xF5D5, 0x36D6, 0x36D6, 0xD4CD, 0x35D6, 0x6FA4, 0x6FA4, 0xF1AC, 0xB7E6, 0xB7E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6,
+0x97E6, 0x97E6, 0x53BD, 0x32B5, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0xF5D5, 0xF5D5, 0x15D6, 0x11B5, 0x52BD, 0x76E6, 0x76E6, 0xB8E6,
+0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x76E6, 0x96E6, 0x32B5, 0x32B5, 0x36D6, 0x15D6, 0x36D6, 0x36D6, 0x15D6, 0x15D6, 0xF5CD, 0xF5D5,
+0x97DE, 0xB8E6, 0xB9E6, 0xB9E6, 0x98E6, 0x98E6, 0x96E6, 0x98E6, 0x32B5, 0x52BD, 0x55DE, 0x55DE, 0x16D6, 0x36D6, 0x55DE, 0x15D6,
+0x56DE, 0x36D6, 0x56DE, 0x97E6, 0x97E6, 0x97E6, 0x76DE, 0xB8E6, 0xB8E6, 0x77DE, 0x96E6, 0x32B5, 0x32B5, 0x55DE, 0x77DE, 0x36D6,
+0x15D6, 0x56DE, 0xF5CD, 0x56DE, 0x52B5, 0x36D6, 0xED8B, 0x77DE, 0x55DE, 0x35D6, 0x35D6, 0xB8E6, 0xB8E6, 0x97E6, 0xB8E6, 0xB8E6,
+0x77E6, 0x97DE, 0x97DE, 0x32B5, 0x12B5, 0x4F9C, 0x2F9C, 0x76DE, 0x76DE, 0x15D6, 0x15D6, 0x32B5, 0x73BD, 0x97E6, 0x56DE, 0x76DE,
+0x56DE, 0x97E6, 0x96DE, 0x57DE, 0x56DE, 0x55DE, 0x55DE, 0xEE8B, 0x56D6, 0x56DE, 0x76DE, 0x97E6, 0x98E6, 0xB8E6, 0xB8E6, 0x97E6,
+0xB8E6, 0x97E6, 0x97E6, 0x11B5, 0x32B5, 0x8FA4, 0xB0A4, 0x97E6, 0x98E6, 0x36D6, 0x56DE, 0x35D6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6,
+0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x76DE, 0x32B5, 0x76DE, 0x76DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6, 0x97E6,
+0x97E6, 0xF1B4, 0x11B5, 0x94C5, 0x15D6, 0x35D6, 0x76DE, 0x56D6, 0x35D6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6, 0x76DE, 0x77DE,
+0xF5CD, 0xD5CD, 0x36D6, 0xCD8B, 0xCD8B, 0x76DE, 0x76E6, 0x98E6, 0x77E6, 0xB8E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0x76E6, 0x11B5,
+0x12B5, 0xD4CD, 0x36D6, 0x56D6, 0x77DE, 0x57DE, 0x56DE, 0x77DE, 0x96DE, 0xB8E6, 0x36D6, 0x97E6, 0x77DE, 0xD5CD, 0x97E6, 0x98E6,
+0xB0AC, 0x11B5, 0x77E6, 0x77E6, 0x97E6, 0x98DE, 0xB8E6, 0x98E6, 0xB8E6, 0x98E6, 0xB7E6, 0xB7E6, 0x32B5, 0xF5D5, 0xD4CD, 0xB4CD,
+0x36D6, 0x56DE, 0x76DE, 0x76DE, 0x77DE, 0x56DE, 0x77DE, 0x77DE, 0x97E6, 0xD4CD, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x15D6, 0x93C5,
+0xD4CD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x98E6, 0x32BD, 0x12B5, 0x77DE,
+0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x96DE, 0x97E6, 0x14CE, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6, 0xD4CD, 0xD4CD, 0x97E6, 0x98E6, 0x77DE,
+0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB0A4, 0xB0A4, 0x97E6, 0x97E6, 0x97E6, 0xB8E6,
+0x56DE, 0x77DE, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0x15D6, 0x36D6, 0x56DE, 0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6,
+0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x4F9C, 0x4F9C, 0xB7E6, 0xB7E6, 0x98E6, 0x97E6, 0x97DE, 0x98DE, 0xD8E6, 0x98E6,
+0xD5CD, 0xD5CD, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0xB8E6, 0x96DE, 0x98E6, 0x98E6, 0xB7E6, 0x98E6, 0x97E6, 0xB8E6, 0x97E6, 0xB8E6,
+0x4F9C, 0x4F9C, 0x4F9C, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x77DE, 0x76DE, 0x96DE, 0x53BD, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6,
+0xB8E6, 0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB7E6, 0x4F9C, 0x4F9C, 0x97E6, 0x98E6, 0x56DE, 0x56DE, 0x36D6,
+0x36D6, 0x36D6, 0x98E6, 0xB8E6, 0x97DE, 0xB7E6, 0xB8E6, 0xB7E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6,
+0xB0AC, 0xB0AC, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x16D6, 0x16D6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0xB8E6,
+0x97E6, 0x98E6, 0x98E6, 0xD9E6, 0x97E6, 0xB8E6, 0x77E6, 0x32BD, 0xB4CD, 0x36DE, 0x36DE, 0x56DE, 0x77E6, 0x16D6, 0x16D6, 0x35DE,
+0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x76E6, 0x97E6, 0xD8E6, 0x97E6, 0x97E6, 0xB8E6, 0x98E6, 0xD5CD,
+0x52BD, 0xD0AC, 0x97E6, 0x97E6, 0x36D6, 0x36D6, 0x77DE, 0x97DE, 0x96E6, 0xB8EE, 0x98E6, 0x97E6, 0xD9E6, 0x97DE, 0xB8E6, 0x97E6,
+0xD8E6, 0xB7E6, 0x76DE, 0xD8E6, 0x96DE, 0xD4CD, 0xD0AC, 0xD0AC, 0x97E6, 0x77DE, 0x36D6, 0x36D6, 0x35D6, 0x56DE, 0x97E6, 0xB8E6,
+0xB8E6, 0xB8E6, 0xB8E6, 0xD8E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x77E6, 0x97DE, 0x11B5, 0x32B5, 0xD0AC, 0x6F9C,
+0x77DE, 0x77DE, 0x16D6, 0x15CE, 0xF5CD, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x97E6, 0x97DE, 0x97E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6,
+0xB7E6, 0x77E6, 0x98E6, 0xB8E6, 0x97E6, 0x11AD, 0xF1AC, 0x56DE, 0x56DE, 0xF5CD, 0x15CE, 0xF5D5, 0x35D6, 0x97E6, 0x97E6, 0x76DE,
+0xB8E6, 0x97DE, 0x97E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x98E6, 0x97DE, 0x97DE, 0x98E6, 0x98E6, 0xF1AC, 0xF1AC,
+0x56DE, 0x56DE, 0xD5CD, 0xB4C5, 0xF5D5, 0xD5CD, 0x56DE, 0x35D6, 0x97DE, 0x76DE, 0x97E6, 0x96DE, 0x97E6, 0x77E6, 0xB8E6, 0x97E6,
+0x98E6, 0x98E6, 0x97E6, 0x97E6, 0xB7E6, 0x76E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF5CD, 0x52BD, 0x2E94, 0x8C7B, 0xB8E6, 0x97E6, 0x77DE,
+0xB8E6, 0x97E6, 0x77E6, 0xB8E6, 0x98E6, 0xB7E6, 0x77E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0xF1AC, 0x97E6, 0x96E6, 0x56E6, 0x77DE,
+0xB8E6, 0xB7E6, 0x97E6, 0x76DE, 0xB7E6, 0x98E6, 0x97E6, 0x98E6, 0xF1AC, 0x11AD, 0x77DE, 0x77DE, 0x97E6, 0x98E6, 0x97E6, 0x98E6,
+0xB8E6, 0x77E6, 0x77DE, 0x98E6, 0x97E6, 0x98E6, 0xF1AC, 0xD1AC, 0x77DE, 0x36DE, 0x15D6, 0x97E6, 0x77DE, 0x97DE, 0x97E6, 0x98E6,
+0x97E6, 0xB8E6, 0xB7E6, 0x77E6, 0x76DE, 0xF1B4, 0xF1AC, 0x15D6, 0x15D6, 0x77DE, 0x77DE, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97DE,
+0x97E6, 0x77DE, 0x98E6, 0x77E6, 0x12B5, 0x32B5, 0xD4CD, 0xB4CD, 0x76DE, 0x76DE, 0x97E6, 0xB7DE, 0x97DE, 0x97E6, 0xB8E6, 0x98E6,
+0x76E6, 0x76E6, 0x32B5, 0x11B5, 0x32B5, 0x93C5, 0x11B5, 0x56DE, 0x57DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6,
+0x77E6, 0x32B5, 0x32B5, 0xF1AC, 0xB0A4, 0x36DE, 0x36DE, 0xB7DE, 0x97DE, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0x97E6, 0x98E6, 0x32B5,
+0x52BD, 0x0E94, 0x36D6, 0x35DE, 0x98E6, 0x98E6, 0x96DE, 0x98E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x32BD, 0x32B5, 0x56DE, 0x56DE,
+0x98E6, 0x76E6, 0x98E6, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0x77E6, 0xB8E6, 0x32BD, 0x32BD, 0x15D6, 0xF5D5, 0x97E6, 0x97E6, 0x97DE,
+0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB7E6, 0x32B5, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0x96E6, 0x96DE, 0x98E6, 0x98E6, 0x98E6, 0x97E6,
+0x97E6, 0xB7E6, 0x32B5, 0x32B5, 0xD4CD, 0x72BD, 0x96E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x32B5, 0x32BD,
+0x6FA4, 0x6FA4, 0x96DE, 0xB7E6, 0x98E6, 0xB8E6, 0xB8E6, 0x96DE, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x2F94, 0xEE8B, 0x96E6, 0x96E6,
+0xB7E6, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0xB8E6, 0x97E6, 0x96E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6,
+0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0x77DE, 0x77DE, 0x97E6, 0xB8E6, 0x32B5, 0x52BD, 0x97E6, 0x97E6,
+0xB8E6, 0x77DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x32BD, 0x32B5, 0x97E6, 0x97E6, 0x97DE, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x97E6,
+0x52BD, 0x52BD, 0x77E6, 0x77DE, 0x57DE, 0x96DE, 0x96DE, 0x76DE, 0x77DE, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x57DE, 0x35DE, 0x97DE,
+0x97DE, 0x77DE, 0x98E6, 0x97E6, 0x96E6, 0x98E6, 0x32B5, 0x32B5, 0x36D6, 0x15D6, 0x76DE, 0x97E6, 0x96E6, 0xB8E6, 0x98E6, 0x76E6,
+0x32B5, 0x32B5, 0xD4CD, 0xD4CD, 0x97E6, 0x98E6, 0x97DE, 0x97E6, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32BD, 0xB0AC, 0x96DE, 0x96DE,
+0x97DE, 0x98E6, 0x97E6, 0x96E6, 0x32B5, 0x32B5, 0xB0AC, 0x6FA4, 0x8C7B, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x77DE, 0x97E6, 0x32B5,
+0x32B5, 0x8C7B, 0x97E6, 0x97E6, 0x76DE, 0x77E6, 0x97E6, 0x97E6, 0x97E6, 0x12B5, 0x11AD, 0x97E6, 0x77DE, 0x76DE, 0x98E6, 0x98E6,
+0xB8E6, 0xF1AC, 0xF1AC, 0x36DE, 0x36D6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0x15D6, 0xF5D5, 0x76DE, 0x76DE, 0x76E6,
+0x97E6, 0xF1AC, 0xD1AC, 0x52BD, 0x11B5, 0x77DE, 0x77DE, 0x76DE, 0x77DE, 0xF1AC, 0xB0A4, 0x11B5, 0x8FA4, 0x77DE, 0x77DE, 0x77DE,
+0x97E6, 0x77E6, 0x2F94, 0x2F94, 0x77DE, 0x56DE, 0x77E6, 0x77DE, 0xAD7B, 0x15D6, 0xF5CD, 0x15D6, 0x36D6, 0xD5CD, 0xF5CD, 0xF5D5,
+0x56DE, 0x76E6, 0xF5CD, 0xF5CD, 0x36D6, 0x35D6, 0x98E6, 0x97E6, 0xF5CD, 0xF5CD, 0x35D6, 0x35D6, 0x97E6, 0x97DE, 0xF5CD, 0xF5CD,
+0x56DE, 0x57DE, 0x97E6, 0xB8E6, 0xF5CD, 0xF5CD, 0x57DE, 0x56DE, 0x76DE, 0x97E6, 0xF5CD, 0xF5CD, 0x77E6, 0x77E6, 0x97E6, 0x96DE,
+0xF5CD, 0xF5CD, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xF5CD, 0xF5CD, 0x6FA4, 0x6FA4, 0x76DE, 0x77E6, 0x76DE, 0x97DE, 0xD5CD, 0xF5CD,
+0xF1B4, 0xD4CD, 0x76DE, 0x76DE, 0x97E6, 0x98DE, 0xD5CD, 0xD5CD, 0x35D6, 0x56DE, 0x98E6, 0xB7E6, 0x76DE, 0x76DE, 0xD5CD, 0xD5CD,
+0x56DE, 0x77E6, 0xB7E6, 0x98E6, 0x76DE, 0x97DE, 0xD4CD, 0xD4CD, 0x97E6, 0x97E6, 0x78E6, 0x98E6, 0x97E6, 0x97DE, 0xD4CD, 0xD4CD,
+0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xD4C5, 0xD4CD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x98E6, 0x77DE, 0xD4CD, 0xD4CD,
+0xED8B, 0x97E6, 0x97E6, 0x98E6, 0x97DE, 0x96E6, 0x96DE, 0xB4C5, 0xB4C5, 0x4F9C, 0xF1B4, 0x96DE, 0x76DE, 0xB8E6, 0x96DE, 0x76DE,
+0x97E6, 0xB4C5, 0xB4C5, 0x52BD, 0xB4CD, 0x76DE, 0x97E6, 0x76DE, 0x77E6, 0x96E6, 0x97E6, 0xB4C5, 0x93C5, 0xF5CD, 0xF5CD, 0x97E6,
+0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0x97E6, 0x93C5, 0x93C5, 0x35D6, 0x56DE, 0x77DE, 0x77DE, 0x97DE, 0x76E6, 0x97E6, 0x76E6, 0x93BD,
+0x93C5, 0x56DE, 0x77DE, 0x98E6, 0x77DE, 0x77DE, 0xB8E6, 0xB7E6, 0x77E6, 0x93C5, 0x93BD, 0x32B5, 0x97E6, 0x97DE, 0x76DE, 0x97E6,
+0x77E6, 0x98E6, 0x97E6, 0x76DE, 0x73BD, 0x73BD, 0x73C5, 0x93C5, 0x76E6, 0x76E6, 0x97E6, 0x97DE, 0x98E6, 0xB8E6, 0x76DE, 0x97E6,
+0x73BD, 0x73BD, 0x94C5, 0x35D6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x77DE, 0x77DE, 0x97E6, 0x97DE, 0x52BD, 0x52BD, 0xF5CD, 0x77DE,
+0x97E6, 0xB8E6, 0x76DE, 0x98E6, 0x76DE, 0x76DE, 0x97E6, 0x97E6, 0x73BD, 0x53BD, 0xF5D5, 0x56DE, 0x98E6, 0x96DE, 0x97DE, 0xB8E6,
+0xB8E6, 0x77DE, 0x96E6, 0x96E6, 0x53BD, 0x53BD, 0xD5CD, 0xD4D5, 0xF5CD, 0x77DE, 0xAC83, 0x96E6, 0x97E6, 0xB8E6, 0xB8E6, 0x77DE,
+0xB8E6, 0x76DE, 0x97E6, 0x32B5, 0x32B5, 0xF5CD, 0x36D6, 0x36D6, 0xD4D5, 0x35D6, 0x0E94, 0x6FA4, 0x97E6, 0xB7E6, 0x97DE, 0xB8E6,
+0x77DE, 0x98E6, 0x97E6, 0x97E6, 0x53BD, 0x53BD, 0xF5D5, 0xF5D5, 0x36D6, 0x36D6, 0xD4CD, 0x35D6, 0x35D6, 0xF1AC, 0x11B5, 0xB7E6,
+0x76E6, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0xF5D5, 0x15D6, 0x36D6, 0x36D6, 0xF5D5, 0x15D6, 0x52BD,
+0xF5CD, 0x97DE, 0x97DE, 0xB8E6, 0x77DE, 0xB8E6, 0x98E6, 0x76E6, 0x96E6, 0x32B5, 0x32B5, 0x36D6, 0x15D6, 0x36D6, 0x36D6, 0x15D6,
+0x15D6, 0xF5D5, 0x36D6, 0xB8E6, 0x97E6, 0xB9E6, 0x97E6, 0x98E6, 0x77E6, 0x98E6, 0x77DE, 0x52BD, 0x32B5, 0x55DE, 0x55DE, 0x16D6,
+0x16D6, 0x55DE, 0x56DE, 0x56DE, 0x56DE, 0x97E6, 0xB8E6, 0x76DE, 0x97E6, 0xB8E6, 0x98E6, 0x96E6, 0x97E6, 0x32B5, 0x32B5, 0x2E94,
+0x77DE, 0x97E6, 0x15D6, 0x15D6, 0x56DE, 0xF5CD, 0x56DE, 0x52B5, 0x52B5, 0xED8B, 0x77DE, 0x55DE, 0x35D6, 0x56D6, 0xB8E6, 0x97E6,
+0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x97DE, 0x96DE, 0x12B5, 0x11B5, 0x2F9C, 0x2F9C, 0x76DE, 0x97E6, 0x15D6, 0x36D6, 0x32B5, 0x35D6,
+0x97E6, 0x97E6, 0x76DE, 0x97E6, 0x97E6, 0x96DE, 0x57DE, 0x56DE, 0x56DE, 0x55DE, 0xEE8B, 0x56DE, 0x76DE, 0x98E6, 0x98E6, 0xB8E6,
+0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x8FA4, 0xB0A4, 0x97E6, 0x98E6, 0x36D6, 0x56DE, 0x35D6, 0x97E6, 0x98E6,
+0x97E6, 0xB8E6, 0x97E6, 0x96DE, 0x77DE, 0x56DE, 0x76DE, 0x32B5, 0x8C7B, 0x76DE, 0x76DE, 0xB8E6, 0x98E6, 0x97E6, 0x97E6, 0x97E6,
+0x98E6, 0x97E6, 0x97E6, 0xF1B4, 0x11B5, 0x94C5, 0x15D6, 0x35D6, 0x76DE, 0x56D6, 0x35D6, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0x98E6,
+0x76DE, 0x77DE, 0x77DE, 0xD5CD, 0x36D6, 0xB0AC, 0xB0AC, 0x76E6, 0xB8E6, 0x77E6, 0x97E6, 0x97DE, 0xB8E6, 0x98E6, 0x98E6, 0x76E6,
+0x98E6, 0x12B5, 0x32B5, 0xD4CD, 0x36D6, 0x56D6, 0x77DE, 0x57DE, 0x56DE, 0x77DE, 0x96DE, 0xB8E6, 0x36D6, 0x97E6, 0x77DE, 0xD5CD,
+0x97E6, 0x98E6, 0x11B5, 0x93C5, 0x77DE, 0x77DE, 0x98DE, 0xB6E6, 0x98E6, 0x97DE, 0x98E6, 0x98E6, 0xB7E6, 0xB7E6, 0xF5D5, 0x97E6,
+0xB4CD, 0x32BD, 0x56DE, 0x77DE, 0x76DE, 0x97DE, 0x56DE, 0x77DE, 0x77DE, 0x97E6, 0xD4CD, 0xD4CD, 0x97E6, 0xB7E6, 0x97E6, 0x15D6,
+0x93C5, 0xD4CD, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x98E6, 0x32BD, 0x12B5,
+0x77DE, 0x97E6, 0x97E6, 0x98E6, 0x96DE, 0x96DE, 0x97E6, 0x14CE, 0xB8E6, 0xB8E6, 0xB7E6, 0x98E6, 0x15D6, 0xD4CD, 0x15D6, 0x98E6,
+0x77DE, 0x97DE, 0xB8E6, 0x97E6, 0x97E6, 0xB9E6, 0x98E6, 0x97E6, 0xB8E6, 0x77E6, 0xB8E6, 0xB0A4, 0xB0A4, 0x97E6, 0x97E6, 0x97E6,
+0xB8E6, 0x56DE, 0x77DE, 0x97E6, 0x98E6, 0x98E6, 0xB8E6, 0x15D6, 0x56DE, 0x97E6, 0x97DE, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0x98E6,
+0x98E6, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x97E6, 0x4F9C, 0x4F9C, 0xB7E6, 0xB7E6, 0x98E6, 0x97E6, 0x97DE, 0x98DE, 0xD8E6, 0x98E6,
+0x98E6, 0xD5CD, 0x97E6, 0x97E6, 0x98E6, 0x98E6, 0x96DE, 0x97E6, 0x98E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x97E6,
+0x4F9C, 0x4F9C, 0xB7E6, 0x97E6, 0xB7E6, 0xB8E6, 0x77DE, 0x76DE, 0x96DE, 0x53BD, 0x97E6, 0x97E6, 0x98E6, 0x97E6, 0xB8E6, 0xB8E6,
+0x97E6, 0x97DE, 0x97E6, 0xB8E6, 0xB8E6, 0x97E6, 0xB7E6, 0x97E6, 0x4F9C, 0x4F9C, 0x97E6, 0x98E6, 0x56DE, 0x56DE, 0x36D6, 0x36D6,
+0x53BD, 0x98E6, 0xB8E6, 0x97DE, 0xB7E6, 0xB8E6, 0xB7E6, 0x97E6, 0xB8E6, 0x97E6, 0xB7E6, 0xB8E6, 0xB8E6, 0xB7E6, 0xB8E6, 0xB0AC,
+0xB0AC, 0x77DE, 0x56DE, 0x56DE, 0x35DE, 0x16D6, 0x16D6, 0xB7E6, 0x97DE, 0x98E6, 0x77E6, 0xB8E6, 0x97E6, 0xB8E6, 0x97E6, 0x98E6,
+0x76E6, 0xD9E6, 0x97E6, 0xB8E6, 0x77E6, 0x32BD, 0xB4CD, 0x36DE, 0x36DE, 0x56DE, 0x77E6, 0x16D6, 0x16D6, 0x35DE, 0x97DE, 0x97E6,
+0xB8E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xB7E6, 0x76E6, 0x97E6, 0x77E6, 0x97E6, 0x77E6, 0xB8E6, 0xB4CD, 0xD5CD, 0xF5D5, 0x52BD,
+0x97E6, 0x97E6, 0x16D6, 0x36D6, 0x97DE, 0x97DE, 0x96E6, 0xB8EE, 0x98E6, 0x97E6, 0xD9E6, 0x97DE, 0x97E6, 0x97E6, 0xD8E6, 0xB7E6,
+0x76DE, 0xD8E6, 0x96DE, 0xD4CD, 0xD0AC, 0xD0AC, 0x96E6, 0x97E6, 0x36D6, 0x36D6, 0x35D6, 0x56DE, 0x97E6, 0xB8E6, 0xB8E6, 0xB8E6,
+0xB8E6, 0xD8E6, 0x98E6, 0x76DE, 0x97E6, 0x97E6, 0xB7E6, 0xB8E6, 0x77E6, 0x97DE, 0x11B5, 0x32B5, 0xD0AC, 0x6F9C, 0x77DE, 0x77DE,
+0x16D6, 0x15CE, 0x76DE, 0x76DE, 0x97E6, 0x76DE, 0x97E6, 0x97DE, 0x77E6, 0x77E6, 0x97DE, 0x97E6, 0x97E6, 0xB7E6, 0x77E6, 0x98E6,
+0xB8E6, 0x97E6, 0x11AD, 0xF1AC, 0x56DE, 0x56DE, 0xF5CD, 0x15CE, 0xF5D5, 0x35D6, 0x97E6, 0x76DE, 0x76DE, 0xB8E6, 0x97DE, 0x97E6,
+0x97E6, 0xB8E6, 0x97E6, 0x97E6, 0xB7E6, 0xB7E6, 0x98E6, 0x97DE, 0x97E6, 0x98E6, 0xF1AC, 0xF1AC, 0x56DE, 0x56DE, 0x15CE, 0xD5CD,
+0xF5D5, 0xD5CD, 0x56DE, 0x35D6, 0x76DE, 0x56DE, 0x97E6, 0x96DE, 0x97E6, 0x77E6, 0xB8E6, 0x97E6, 0x98E6, 0x98E6, 0x97DE, 0x97E6,
+0x97E6, 0x76E6, 0xF1AC, 0xF1AC, 0x36D6, 0xF5CD, 0x53BD, 0x2E94, 0x8C7B, 0x97E6, 0x97E6, 0x77DE, 0xB8E6, 0x97E6, 0x77E6, 0xB8E6,
+0x98E6, 0x77E6, 0x77E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0x52BD, 0x97E6, 0x96E6, 0x77DE, 0x77DE, 0xB8E6, 0xB7E6, 0x97E6, 0x76DE,
+0xB7E6, 0x98E6, 0x97E6, 0x98E6, 0xF1AC, 0x11AD, 0x96E6, 0x77DE, 0x55DE, 0x97E6, 0x97E6, 0x98E6, 0x76DE, 0xB8E6, 0x98E6, 0x77DE,
+0x98E6, 0x97E6, 0xF1AC, 0xF1AC, 0x77DE, 0x36DE, 0x98E6, 0x97E6, 0x97E6, 0x97DE, 0x98E6, 0x98E6, 0x98E6, 0xB8E6, 0x98E6, 0x77E6,
+0xF1AC, 0xF1B4, 0x15D6, 0xF5CD, 0x77DE, 0x77DE, 0x97E6, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0xF1AC, 0x12B5,
+0xF5CD, 0xD4CD, 0x77DE, 0x76DE, 0xB8E6, 0x97E6, 0x77E6, 0x97DE, 0x77DE, 0xB8E6, 0x77E6, 0x76E6, 0x12B5, 0x32B5, 0xB4CD, 0x93C5,
+0x77E6, 0x56DE, 0xB8E6, 0xB8E6, 0x97E6, 0x97E6, 0x98E6, 0xB8E6, 0x77E6, 0x98E6, 0x32B5, 0x32B5, 0x11B5, 0xF1AC, 0x57DE, 0x36DE,
+0x97E6, 0xB7DE, 0x97E6, 0x97DE, 0xB8E6, 0xB8E6, 0x77E6, 0x97E6, 0x32B5, 0x32B5, 0x0E94, 0x36DE, 0x36D6, 0x97DE, 0x98E6, 0x98E6,
+0x96DE, 0xB8E6, 0x97E6, 0x98E6, 0xB7E6, 0x52BD, 0x32BD, 0x35DE, 0x56DE, 0x98E6, 0x98E6, 0x96DE, 0x98E6, 0x97E6, 0x97E6, 0x97E6,
+0x77E6, 0x32BD, 0x32B5, 0x56DE, 0x15D6, 0x76DE, 0x97E6, 0x97DE, 0x97DE, 0xB8E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x32BD, 0x32B5, 0xF5D5,
+0x15D6, 0x97E6, 0x96E6, 0x76DE, 0x98E6, 0xB8E6, 0x98E6, 0xB7E6, 0x97E6, 0x32B5, 0x32B5, 0xD4CD, 0xD4CD, 0x96DE, 0x96E6, 0x96E6,
+0x97E6, 0xB8E6, 0xB8E6, 0xB7E6, 0x97E6, 0x32B5, 0x32B5, 0x72BD, 0x32BD, 0x97E6, 0x97E6, 0x97E6, 0x77E6, 0xB8E6, 0x97DE, 0xB7E6,
+0xB8E6, 0x32BD, 0x32BD, 0x6FA4, 0x2F94, 0xB7E6, 0x96E6, 0xB8E6, 0xB8E6, 0xB8E6, 0x96DE, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0xEE8B,
+0xB7E6, 0xB8E6, 0x97E6, 0x96E6, 0x97E6, 0x97E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x77DE, 0x76DE, 0x97DE, 0x77DE,
+0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x97E6, 0x97E6, 0x76DE, 0x98E6, 0x77DE, 0x98E6, 0xB8E6, 0x97E6, 0x52BD, 0x52BD, 0x97E6, 0x96E6,
+0x77DE, 0x97DE, 0x97E6, 0x98E6, 0x97E6, 0x97E6, 0x32B5, 0x32B5, 0x97E6, 0x77E6, 0x77DE, 0x96DE, 0x97E6, 0x97E6, 0x97E6, 0x97E6,
+0x52BD, 0x32B5, 0x77DE, 0x77DE, 0x96DE, 0x96DE, 0x76DE, 0x77DE, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x35DE, 0x36D6, 0x97DE, 0x97DE,
+0x77DE, 0x98E6, 0x96E6, 0x98E6, 0x32B5, 0x32B5, 0x15D6, 0xF5D5, 0x97E6, 0x97E6, 0x96E6, 0xB8E6, 0x98E6, 0x76E6, 0x32B5, 0x32B5,
+0xD4CD, 0x52BD, 0x98E6, 0x98E6, 0x97E6, 0x97DE, 0xB8E6, 0x97E6, 0x32B5, 0x32B5, 0x32BD, 0x32BD, 0x98E6, 0x96DE, 0x97DE, 0x98E6,
+0x97E6, 0x96E6, 0x32B5, 0x32B5, 0x6FA4, 0x8C7B, 0xB8E6, 0xB8E6, 0x76DE, 0x97E6, 0x77DE, 0x97E6, 0x32B5, 0x32B5, 0x97E6, 0x97E6,
+0x76DE, 0x77E6, 0x97E6, 0x97E6, 0x12B5, 0x11AD, 0x77DE, 0x56DE, 0x98E6, 0x97E6, 0x98E6, 0xB8E6, 0xF1AC, 0xF1AC, 0x56DE, 0x36DE,
+0x97E6, 0x97E6, 0x97E6, 0x97E6, 0xF1AC, 0xF1AC, 0x15D6, 0x15D6, 0x98DE, 0x76DE, 0x76E6, 0x97E6, 0xF1AC, 0xD1AC, 0x52BD, 0x11B5,
+0x77DE, 0x77DE, 0x76DE, 0x76DE, 0xF1AC, 0xB0A4, 0x8FA4, 0x8FA4, 0x77DE, 0x77DE, 0x97E6, 0x97E6, 0x6F9C, 0x2F94, 0x8FA4, 0x77DE,
+0x56DE, 0x77E6, 0x77DE, 0xAD7B, 0xAD7B, 0x57DE, 0x15D6, 0x15D6,
+};
+
+static const PlaneSpan planeCacheSpans[4792] PROGMEM = {
+{231, 2, planeCachePixels + 0}, {229, 4, planeCachePixels + 2}, {227, 6, planeCachePixels + 6}, {226, 6, planeCachePixels + 12},
+{224, 6, planeCachePixels + 18}, {222, 7, planeCachePixels + 24}, {220, 8, planeCachePixels + 31}, {219, 8, planeCachePixels + 39},
+{217, 8, planeCachePixels + 47}, {215, 8, planeCachePixels + 55}, {213, 8, planeCachePixels + 63}, {212, 8, planeCachePixels + 71},
+{210, 8, planeCachePixels + 79}, {208, 9, planeCachePixels + 87}, {207, 10, planeCachePixels + 96}, {205, 10, planeCachePixels + 106},
+{203, 10, planeCachePixels + 116}, {201, 10, planeCachePixels + 126}, {200, 10, planeCachePixels + 136}, {198, 10, planeCachePixels + 146},
+{196, 10, planeCachePixels + 156}, {148, 2, planeCachePixels + 166}, {194, 10, planeCachePixels + 168}, {148, 3, planeCachePixels + 178},
+{193, 10, planeCachePixels + 181}, {149, 2, planeCachePixels + 191}, {191, 10, planeCachePixels + 193}, {150, 2, planeCachePixels + 203},
+{189, 10, planeCachePixels + 205}, {150, 2, planeCachePixels + 215}, {187, 10, planeCachePixels + 217}, {151, 2, planeCachePixels + 227},
+{178, 2, planeCachePixels + 229}, {186, 12, planeCachePixels + 231}, {151, 3, planeCachePixels + 243}, {176, 4, planeCachePixels + 246},
+{184, 12, planeCachePixels + 250}, {152, 2, planeCachePixels + 262}, {174, 4, planeCachePixels + 264}, {182, 12, planeCachePixels + 268},
+{152, 3, planeCachePixels + 280}, {173, 4, planeCachePixels + 283}, {181, 12, planeCachePixels + 287}, {153, 2, planeCachePixels + 299},
+{171, 4, planeCachePixels + 301}, {179, 12, planeCachePixels + 305}, {154, 3, planeCachePixels + 317}, {161, 1, planeCachePixels + 320},
+{169, 4, planeCachePixels + 321}, {177, 12, planeCachePixels + 325}, {154, 12, planeCachePixels + 337}, {167, 6, planeCachePixels + 349},
+{175, 12, planeCachePixels + 355}, {154, 18, planeCachePixels + 367}, {174, 12, planeCachePixels + 385}, {154, 16, planeCachePixels + 397},
+{172, 13, planeCachePixels + 413}, {152, 16, planeCachePixels + 426}, {170, 14, planeCachePixels + 442}, {152, 30, planeCachePixels + 456},
+{151, 30, planeCachePixels + 486}, {151, 28, planeCachePixels + 516}, {151, 26, planeCachePixels + 544}, {151, 24, planeCachePixels + 570},
+{150, 24, planeCachePixels + 594}, {150, 22, planeCachePixels + 618}, {148, 22, planeCachePixels + 640}, {147, 22, planeCachePixels + 662},
+{145, 6, planeCachePixels + 684}, {152, 17, planeCachePixels + 690}, {143, 6, planeCachePixels + 707}, {151, 18, planeCachePixels + 713},
+{141, 6, planeCachePixels + 731}, {149, 18, planeCachePixels + 737}, {140, 4, planeCachePixels + 755}, {148, 20, planeCachePixels + 759},
+{138, 4, planeCachePixels + 779}, {146, 20, planeCachePixels + 783}, {138, 2, planeCachePixels + 803}, {144, 14, planeCachePixels + 805},
+{159, 1, planeCachePixels + 819}, {161, 1, planeCachePixels + 820}, {163, 1, planeCachePixels + 821}, {142, 14, planeCachePixels + 822},
+{141, 14, planeCachePixels + 836}, {139, 14, planeCachePixels + 850}, {137, 14, planeCachePixels + 864}, {136, 14, planeCachePixels + 878},
+{134, 14, planeCachePixels + 892}, {132, 14, planeCachePixels + 906}, {130, 12, planeCachePixels + 920}, {143, 1, planeCachePixels + 932},
+{129, 12, planeCachePixels + 933}, {127, 12, planeCachePixels + 945}, {125, 12, planeCachePixels + 957}, {123, 12, planeCachePixels + 969},
+{122, 12, planeCachePixels + 981}, {120, 12, planeCachePixels + 993}, {118, 10, planeCachePixels + 1005}, {116, 10, planeCachePixels + 1015},
+{115, 10, planeCachePixels + 1025}, {113, 10, planeCachePixels + 1035}, {111, 10, planeCachePixels + 1045}, {110, 10, planeCachePixels + 1055},
+{108, 10, planeCachePixels + 1065}, {106, 10, planeCachePixels + 1075}, {104, 10, planeCachePixels + 1085}, {103, 8, planeCachePixels + 1095},
+{101, 8, planeCachePixels + 1103}, {99, 8, planeCachePixels + 1111}, {97, 8, planeCachePixels + 1119}, {96, 8, planeCachePixels + 1127},
+{94, 8, planeCachePixels + 1135}, {92, 6, planeCachePixels + 1143}, {90, 6, planeCachePixels + 1149}, {89, 6, planeCachePixels + 1155},
+{89, 4, planeCachePixels + 1161}, {89, 2, planeCachePixels + 1165}, {232, 1, planeCachePixels + 1167}, {230, 4, planeCachePixels + 1168},
+{228, 6, planeCachePixels + 1172}, {226, 7, planeCachePixels + 1178}, {225, 6, planeCachePixels + 1185}, {223, 6, planeCachePixels + 1191},
+{221, 8, planeCachePixels + 1197}, {219, 9, planeCachePixels + 1205}, {217, 9, planeCachePixels + 1214}, {216, 8, planeCachePixels + 1223},
+{214, 8, planeCachePixels + 1231}, {212, 8, planeCachePixels + 1239}, {210, 8, planeCachePixels + 1247}, {208, 10, planeCachePixels + 1255},
+{207, 10, planeCachePixels + 1265}, {205, 10, planeCachePixels + 1275}, {203, 10, planeCachePixels + 1285}, {201, 11, planeCachePixels + 1295},
+{199, 11, planeCachePixels + 1306}, {198, 10, planeCachePixels + 1317}, {148, 3, planeCachePixels + 1327}, {196, 10, planeCachePixels + 1330},
+{149, 2, planeCachePixels + 1340}, {194, 10, planeCachePixels + 1342}, {149, 3, planeCachePixels + 1352}, {192, 11, planeCachePixels + 1355},
+{150, 2, planeCachePixels + 1366}, {190, 11, planeCachePixels + 1368}, {150, 3, planeCachePixels + 1379}, {189, 10, planeCachePixels + 1382},
+{151, 2, planeCachePixels + 1392}, {179, 1, planeCachePixels + 1394}, {187, 11, planeCachePixels + 1395}, {152, 2, planeCachePixels + 1406},
+{177, 3, planeCachePixels + 1408}, {185, 12, planeCachePixels + 1411}, {152, 2, planeCachePixels + 1423}, {175, 4, planeCachePixels + 1425},
+{183, 13, planeCachePixels + 1429}, {153, 2, planeCachePixels + 1442}, {173, 4, planeCachePixels + 1444}, {181, 13, planeCachePixels + 1448},
+{153, 3, planeCachePixels + 1461}, {171, 4, planeCachePixels + 1464}, {180, 12, planeCachePixels + 1468}, {154, 3, planeCachePixels + 1480},
+{159, 1, planeCachePixels + 1483}, {161, 1, planeCachePixels + 1484}, {170, 4, planeCachePixels + 1485}, {178, 12, planeCachePixels + 1489},
+{154, 9, planeCachePixels + 1501}, {164, 1, planeCachePixels + 1510}, {168, 6, planeCachePixels + 1511}, {176, 12, planeCachePixels + 1517},
+{154, 18, planeCachePixels + 1529}, {174, 13, planeCachePixels + 1547}, {154, 16, planeCachePixels + 1560}, {172, 13, planeCachePixels + 1576},
+{153, 15, planeCachePixels + 1589}, {171, 14, planeCachePixels + 1604}, {152, 16, planeCachePixels + 1618}, {169, 14, planeCachePixels + 1634},
+{151, 30, planeCachePixels + 1648}, {151, 29, planeCachePixels + 1678}, {151, 27, planeCachePixels + 1707}, {151, 25, planeCachePixels + 1734},
+{150, 24, planeCachePixels + 1759}, {150, 22, planeCachePixels + 1783}, {148, 23, planeCachePixels + 1805}, {146, 23, planeCachePixels + 1828},
+{144, 6, planeCachePixels + 1851}, {152, 17, planeCachePixels + 1857}, {142, 7, planeCachePixels + 1874}, {151, 18, planeCachePixels + 1881},
+{141, 4, planeCachePixels + 1899}, {146, 1, planeCachePixels + 1903}, {149, 18, planeCachePixels + 1904}, {139, 4, planeCachePixels + 1922},
+{147, 21, planeCachePixels + 1926}, {137, 4, planeCachePixels + 1947}, {145, 21, planeCachePixels + 1951}, {138, 1, planeCachePixels + 1972},
+{143, 15, planeCachePixels + 1973}, {159, 1, planeCachePixels + 1988}, {161, 1, planeCachePixels + 1989}, {163, 1, planeCachePixels + 1990},
+{142, 14, planeCachePixels + 1991}, {140, 14, planeCachePixels + 2005}, {138, 15, planeCachePixels + 2019}, {136, 15, planeCachePixels + 2034},
+{134, 15, planeCachePixels + 2049}, {133, 14, planeCachePixels + 2064}, {131, 14, planeCachePixels + 2078}, {129, 12, planeCachePixels + 2092},
+{142, 1, planeCachePixels + 2104}, {127, 13, planeCachePixels + 2105}, {125, 13, planeCachePixels + 2118}, {124, 12, planeCachePixels + 2131},
+{122, 12, planeCachePixels + 2143}, {120, 12, planeCachePixels + 2155}, {118, 11, planeCachePixels + 2167}, {130, 1, planeCachePixels + 2178},
+{116, 11, planeCachePixels + 2179}, {115, 10, planeCachePixels + 2190}, {113, 10, planeCachePixels + 2200}, {111, 10, planeCachePixels + 2210},
+{109, 11, planeCachePixels + 2220}, {107, 11, planeCachePixels + 2231}, {106, 10, planeCachePixels + 2242}, {104, 10, planeCachePixels + 2252},
+{102, 8, planeCachePixels + 2262}, {100, 8, planeCachePixels + 2270}, {98, 9, planeCachePixels + 2278}, {97, 8, planeCachePixels + 2287},
+{95, 8, planeCachePixels + 2295}, {93, 8, planeCachePixels + 2303}, {91, 6, planeCachePixels + 2311}, {89, 7, planeCachePixels + 2317},
+{88, 6, planeCachePixels + 2324}, {88, 4, planeCachePixels + 2330}, {89, 1, planeCachePixels + 2334}, {233, 1, planeCachePixels + 2335},
+{231, 3, planeCachePixels + 2336}, {229, 6, planeCachePixels + 2339}, {227, 7, planeCachePixels + 2345}, {226, 6, planeCachePixels + 2352},
+{224, 6, planeCachePixels + 2358}, {222, 8, planeCachePixels + 2364}, {220, 8, planeCachePixels + 2372}, {218, 9, planeCachePixels + 2380},
+{216, 9, planeCachePixels + 2389}, {214, 9, planeCachePixels + 2398}, {212, 9, planeCachePixels + 2407}, {210, 9, planeCachePixels + 2416},
+{209, 9, planeCachePixels + 2425}, {207, 10, planeCachePixels + 2434}, {205, 10, planeCachePixels + 2444}, {203, 11, planeCachePixels + 2454},
+{201, 11, planeCachePixels + 2465}, {199, 11, planeCachePixels + 2476}, {149, 2, planeCachePixels + 2487}, {197, 11, planeCachePixels + 2489},
+{149, 2, planeCachePixels + 2500}, {195, 11, planeCachePixels + 2502}, {150, 2, planeCachePixels + 2513}, {194, 10, planeCachePixels + 2515},
+{150, 3, planeCachePixels + 2525}, {192, 10, planeCachePixels + 2528}, {151, 2, planeCachePixels + 2538}, {190, 10, planeCachePixels + 2540},
+{151, 3, planeCachePixels + 2550}, {179, 1, planeCachePixels + 2553}, {188, 11, planeCachePixels + 2554}, {152, 2, planeCachePixels + 2565},
+{177, 3, planeCachePixels + 2567}, {186, 12, planeCachePixels + 2570}, {152, 3, planeCachePixels + 2582}, {176, 4, planeCachePixels + 2585},
+{184, 13, planeCachePixels + 2589}, {153, 2, planeCachePixels + 2602}, {174, 4, planeCachePixels + 2604}, {182, 13, planeCachePixels + 2608},
+{153, 3, planeCachePixels + 2621}, {172, 4, planeCachePixels + 2624}, {180, 13, planeCachePixels + 2628}, {154, 3, planeCachePixels + 2641},
+{159, 1, planeCachePixels + 2644}, {161, 1, planeCachePixels + 2645}, {170, 4, planeCachePixels + 2646}, {178, 13, planeCachePixels + 2650},
+{155, 10, planeCachePixels + 2663}, {168, 6, planeCachePixels + 2673}, {177, 12, planeCachePixels + 2679}, {154, 19, planeCachePixels + 2691},
+{175, 13, planeCachePixels + 2710}, {154, 17, planeCachePixels + 2723}, {173, 13, planeCachePixels + 2740}, {153, 16, planeCachePixels + 2753},
+{171, 15, planeCachePixels + 2769}, {152, 16, planeCachePixels + 2784}, {169, 15, planeCachePixels + 2800}, {152, 30, planeCachePixels + 2815},
+{151, 29, planeCachePixels + 2845}, {151, 27, planeCachePixels + 2874}, {151, 25, planeCachePixels + 2901}, {150, 25, planeCachePixels + 2926},
+{149, 24, planeCachePixels + 2951}, {147, 24, planeCachePixels + 2975}, {146, 23, planeCachePixels + 2999}, {144, 6, planeCachePixels + 3022},
+{152, 17, planeCachePixels + 3028}, {142, 6, planeCachePixels + 3045}, {150, 19, planeCachePixels + 3051}, {140, 4, planeCachePixels + 3070},
+{148, 20, planeCachePixels + 3074}, {138, 4, planeCachePixels + 3094}, {147, 21, planeCachePixels + 3098}, {138, 2, planeCachePixels + 3119},
+{145, 21, planeCachePixels + 3121}, {143, 17, planeCachePixels + 3142}, {161, 1, planeCachePixels + 3159}, {163, 1, planeCachePixels + 3160},
+{141, 15, planeCachePixels + 3161}, {139, 15, planeCachePixels + 3176}, {137, 15, planeCachePixels + 3191}, {135, 15, planeCachePixels + 3206},
+{133, 15, planeCachePixels + 3221}, {131, 15, planeCachePixels + 3236}, {130, 15, planeCachePixels + 3251}, {128, 12, planeCachePixels + 3266},
+{142, 1, planeCachePixels + 3278}, {126, 13, planeCachePixels + 3279}, {124, 13, planeCachePixels + 3292}, {122, 13, planeCachePixels + 3305},
+{120, 13, planeCachePixels + 3318}, {118, 13, planeCachePixels + 3331}, {116, 11, planeCachePixels + 3344}, {115, 10, planeCachePixels + 3355},
+{113, 10, planeCachePixels + 3365}, {111, 10, planeCachePixels + 3375}, {109, 11, planeCachePixels + 3385}, {107, 11, planeCachePixels + 3396},
+{105, 11, planeCachePixels + 3407}, {103, 11, planeCachePixels + 3418}, {101, 9, planeCachePixels + 3429}, {111, 1, planeCachePixels + 3438},
+{100, 8, planeCachePixels + 3439}, {98, 8, planeCachePixels + 3447}, {96, 8, planeCachePixels + 3455}, {94, 8, planeCachePixels + 3463},
+{92, 8, planeCachePixels + 3471}, {90, 6, planeCachePixels + 3479}, {88, 7, planeCachePixels + 3485}, {87, 6, planeCachePixels + 3492},
+{88, 3, planeCachePixels + 3498}, {88, 1, planeCachePixels + 3501}, {232, 3, planeCachePixels + 3502}, {230, 5, planeCachePixels + 3505},
+{228, 7, planeCachePixels + 3510}, {226, 7, planeCachePixels + 3517}, {224, 7, planeCachePixels + 3524}, {222, 9, planeCachePixels + 3531},
+{220, 9, planeCachePixels + 3540}, {219, 8, planeCachePixels + 3549}, {217, 8, planeCachePixels + 3557}, {215, 8, planeCachePixels + 3565},
+{213, 8, planeCachePixels + 3573}, {211, 8, planeCachePixels + 3581}, {209, 9, planeCachePixels + 3589}, {207, 11, planeCachePixels + 3598},
+{205, 11, planeCachePixels + 3609}, {203, 11, planeCachePixels + 3620}, {150, 1, planeCachePixels + 3631}, {201, 11, planeCachePixels + 3632},
+{149, 2, planeCachePixels + 3643}, {199, 11, planeCachePixels + 3645}, {150, 2, planeCachePixels + 3656}, {197, 11, planeCachePixels + 3658},
+{150, 2, planeCachePixels + 3669}, {195, 11, planeCachePixels + 3671}, {151, 2, planeCachePixels + 3682}, {193, 11, planeCachePixels + 3684},
+{151, 2, planeCachePixels + 3695}, {191, 11, planeCachePixels + 3697}, {152, 2, planeCachePixels + 3708}, {189, 11, planeCachePixels + 3710},
+{152, 2, planeCachePixels + 3721}, {178, 2, planeCachePixels + 3723}, {187, 11, planeCachePixels + 3725}, {153, 2, planeCachePixels + 3736},
+{176, 5, planeCachePixels + 3738}, {185, 13, planeCachePixels + 3743}, {153, 2, planeCachePixels + 3756}, {174, 5, planeCachePixels + 3758},
+{183, 13, planeCachePixels + 3763}, {154, 2, planeCachePixels + 3776}, {172, 5, planeCachePixels + 3778}, {181, 13, planeCachePixels + 3783},
+{154, 4, planeCachePixels + 3796}, {159, 1, planeCachePixels + 3800}, {170, 5, planeCachePixels + 3801}, {179, 13, planeCachePixels + 3806},
+{155, 10, planeCachePixels + 3819}, {168, 6, planeCachePixels + 3829}, {177, 14, planeCachePixels + 3835}, {154, 12, planeCachePixels + 3849},
+{167, 6, planeCachePixels + 3861}, {175, 14, planeCachePixels + 3867}, {154, 17, planeCachePixels + 3881}, {173, 14, planeCachePixels + 3898},
+{153, 16, planeCachePixels + 3912}, {171, 14, planeCachePixels + 3928}, {152, 16, planeCachePixels + 3942}, {169, 16, planeCachePixels + 3958},
+{152, 31, planeCachePixels + 3974}, {151, 30, planeCachePixels + 4005}, {150, 29, planeCachePixels + 4035}, {151, 26, planeCachePixels + 4064},
+{150, 25, planeCachePixels + 4090}, {149, 24, planeCachePixels + 4115}, {147, 24, planeCachePixels + 4139}, {145, 24, planeCachePixels + 4163},
+{143, 7, planeCachePixels + 4187}, {152, 17, planeCachePixels + 4194}, {141, 7, planeCachePixels + 4211}, {150, 19, planeCachePixels + 4218},
+{139, 4, planeCachePixels + 4237}, {148, 20, planeCachePixels + 4241}, {137, 4, planeCachePixels + 4261}, {146, 21, planeCachePixels + 4265},
+{138, 2, planeCachePixels + 4286}, {144, 22, planeCachePixels + 4288}, {142, 15, planeCachePixels + 4310}, {158, 2, planeCachePixels + 4325},
+{161, 1, planeCachePixels + 4327}, {163, 1, planeCachePixels + 4328}, {140, 15, planeCachePixels + 4329}, {138, 15, planeCachePixels + 4344},
+{136, 16, planeCachePixels + 4359}, {134, 16, planeCachePixels + 4375}, {132, 16, planeCachePixels + 4391}, {130, 16, planeCachePixels + 4407},
+{128, 13, planeCachePixels + 4423}, {142, 2, planeCachePixels + 4436}, {126, 13, planeCachePixels + 4438}, {124, 14, planeCachePixels + 4451},
+{122, 14, planeCachePixels + 4465}, {120, 14, planeCachePixels + 4479}, {118, 14, planeCachePixels + 4493}, {116, 11, planeCachePixels + 4507},
+{129, 1, planeCachePixels + 4518}, {114, 12, planeCachePixels + 4519}, {113, 11, planeCachePixels + 4531}, {111, 11, planeCachePixels + 4542},
+{109, 11, planeCachePixels + 4553}, {107, 11, planeCachePixels + 4564}, {105, 11, planeCachePixels + 4575}, {103, 11, planeCachePixels + 4586},
+{101, 9, planeCachePixels + 4597}, {111, 1, planeCachePixels + 4606}, {99, 9, planeCachePixels + 4607}, {97, 9, planeCachePixels + 4616},
+{95, 9, planeCachePixels + 4625}, {93, 9, planeCachePixels + 4634}, {91, 9, planeCachePixels + 4643}, {89, 7, planeCachePixels + 4652},
+{87, 7, planeCachePixels + 4659}, {87, 5, planeCachePixels + 4666}, {87, 3, planeCachePixels + 4671}, {233, 2, planeCachePixels + 4674},
+{231, 5, planeCachePixels + 4676}, {229, 7, planeCachePixels + 4681}, {227, 7, planeCachePixels + 4688}, {225, 7, planeCachePixels + 4695},
+{223, 8, planeCachePixels + 4702}, {221, 9, planeCachePixels + 4710}, {219, 9, planeCachePixels + 4719}, {217, 9, planeCachePixels + 4728},
+{215, 9, planeCachePixels + 4737}, {213, 9, planeCachePixels + 4746}, {211, 9, planeCachePixels + 4755}, {209, 10, planeCachePixels + 4764},
+{207, 11, planeCachePixels + 4774}, {205, 11, planeCachePixels + 4785}, {150, 1, planeCachePixels + 4796}, {203, 11, planeCachePixels + 4797},
+{150, 2, planeCachePixels + 4808}, {201, 11, planeCachePixels + 4810}, {150, 2, planeCachePixels + 4821}, {199, 11, planeCachePixels + 4823},
+{151, 2, planeCachePixels + 4834}, {196, 12, planeCachePixels + 4836}, {151, 2, planeCachePixels + 4848}, {194, 12, planeCachePixels + 4850},
+{152, 2, planeCachePixels + 4862}, {192, 12, planeCachePixels + 4864}, {152, 2, planeCachePixels + 4876}, {190, 12, planeCachePixels + 4878},
+{152, 3, planeCachePixels + 4890}, {179, 1, planeCachePixels + 4893}, {188, 12, planeCachePixels + 4894}, {153, 2, planeCachePixels + 4906},
+{177, 4, planeCachePixels + 4908}, {186, 13, planeCachePixels + 4912}, {153, 3, planeCachePixels + 4925}, {175, 5, planeCachePixels + 4928},
+{184, 14, planeCachePixels + 4933}, {154, 2, planeCachePixels + 4947}, {173, 5, planeCachePixels + 4949}, {182, 14, planeCachePixels + 4954},
+{154, 4, planeCachePixels + 4968}, {171, 5, planeCachePixels + 4972}, {180, 14, planeCachePixels + 4977}, {155, 10, planeCachePixels + 4991},
+{169, 5, planeCachePixels + 5001}, {178, 14, planeCachePixels + 5006}, {154, 20, planeCachePixels + 5020}, {176, 14, planeCachePixels + 5040},
+{153, 19, planeCachePixels + 5054}, {174, 14, planeCachePixels + 5073}, {153, 17, planeCachePixels + 5087}, {172, 14, planeCachePixels + 5104},
+{152, 16, planeCachePixels + 5118}, {170, 16, planeCachePixels + 5134}, {152, 32, planeCachePixels + 5150}, {151, 31, planeCachePixels + 5182},
+{151, 29, planeCachePixels + 5213}, {150, 28, planeCachePixels + 5242}, {150, 26, planeCachePixels + 5270}, {148, 26, planeCachePixels + 5296},
+{146, 25, planeCachePixels + 5322}, {144, 7, planeCachePixels + 5347}, {152, 17, planeCachePixels + 5354}, {142, 7, planeCachePixels + 5371},
+{151, 18, planeCachePixels + 5378}, {140, 7, planeCachePixels + 5396}, {149, 19, planeCachePixels + 5403}, {138, 5, planeCachePixels + 5422},
+{147, 21, planeCachePixels + 5427}, {137, 4, planeCachePixels + 5448}, {145, 22, planeCachePixels + 5452}, {138, 1, planeCachePixels + 5474},
+{143, 23, planeCachePixels + 5475}, {141, 16, planeCachePixels + 5498}, {158, 1, planeCachePixels + 5514}, {160, 2, planeCachePixels + 5515},
+{163, 1, planeCachePixels + 5517}, {139, 16, planeCachePixels + 5518}, {137, 16, planeCachePixels + 5534}, {135, 16, planeCachePixels + 5550},
+{133, 16, planeCachePixels + 5566}, {131, 16, planeCachePixels + 5582}, {129, 16, planeCachePixels + 5598}, {127, 13, planeCachePixels + 5614},
+{142, 1, planeCachePixels + 5627}, {125, 13, planeCachePixels + 5628}, {123, 13, planeCachePixels + 5641}, {121, 13, planeCachePixels + 5654},
+{119, 13, planeCachePixels + 5667}, {117, 13, planeCachePixels + 5680}, {114, 12, planeCachePixels + 5693}, {112, 12, planeCachePixels + 5705},
+{110, 12, planeCachePixels + 5717}, {108, 12, planeCachePixels + 5729}, {106, 12, planeCachePixels + 5741}, {104, 12, planeCachePixels + 5753},
+{102, 12, planeCachePixels + 5765}, {100, 9, planeCachePixels + 5777}, {110, 2, planeCachePixels + 5786}, {98, 9, planeCachePixels + 5788},
+{96, 9, planeCachePixels + 5797}, {94, 9, planeCachePixels + 5806}, {92, 9, planeCachePixels + 5815}, {90, 9, planeCachePixels + 5824},
+{88, 7, planeCachePixels + 5833}, {86, 7, planeCachePixels + 5840}, {86, 5, planeCachePixels + 5847}, {87, 2, planeCachePixels + 5852},
+{235, 1, planeCachePixels + 5854}, {232, 4, planeCachePixels + 5855}, {230, 7, planeCachePixels + 5859}, {228, 7, planeCachePixels + 5866},
+{226, 7, planeCachePixels + 5873}, {224, 7, planeCachePixels + 5880}, {222, 9, planeCachePixels + 5887}, {220, 9, planeCachePixels + 5896},
+{217, 10, planeCachePixels + 5905}, {215, 10, planeCachePixels + 5915}, {213, 10, planeCachePixels + 5925}, {211, 9, planeCachePixels + 5935},
+{209, 10, planeCachePixels + 5944}, {207, 12, planeCachePixels + 5954}, {150, 2, planeCachePixels + 5966}, {205, 11, planeCachePixels + 5968},
+{150, 2, planeCachePixels + 5979}, {202, 12, planeCachePixels + 5981}, {150, 3, planeCachePixels + 5993}, {200, 12, planeCachePixels + 5996},
+{151, 2, planeCachePixels + 6008}, {198, 12, planeCachePixels + 6010}, {151, 3, planeCachePixels + 6022}, {196, 12, planeCachePixels + 6025},
+{152, 2, planeCachePixels + 6037}, {194, 12, planeCachePixels + 6039}, {152, 3, planeCachePixels + 6051}, {192, 12, planeCachePixels + 6054},
+{153, 2, planeCachePixels + 6066}, {190, 11, planeCachePixels + 6068}, {153, 2, planeCachePixels + 6079}, {178, 3, planeCachePixels + 6081},
+{187, 12, planeCachePixels + 6084}, {154, 2, planeCachePixels + 6096}, {176, 5, planeCachePixels + 6098}, {185, 14, planeCachePixels + 6103},
+{154, 2, planeCachePixels + 6117}, {174, 4, planeCachePixels + 6119}, {183, 14, planeCachePixels + 6123}, {155, 3, planeCachePixels + 6137},
+{172, 4, planeCachePixels + 6140}, {181, 14, planeCachePixels + 6144}, {155, 9, planeCachePixels + 6158}, {169, 5, planeCachePixels + 6167},
+{179, 14, planeCachePixels + 6172}, {154, 20, planeCachePixels + 6186}, {177, 14, planeCachePixels + 6206}, {153, 19, planeCachePixels + 6220},
+{175, 14, planeCachePixels + 6239}, {153, 17, planeCachePixels + 6253}, {172, 15, planeCachePixels + 6270}, {151, 17, planeCachePixels + 6285},
+{170, 16, planeCachePixels + 6302}, {152, 33, planeCachePixels + 6318}, {151, 32, planeCachePixels + 6351}, {151, 29, planeCachePixels + 6383},
+{150, 28, planeCachePixels + 6412}, {150, 26, planeCachePixels + 6440}, {148, 26, planeCachePixels + 6466}, {146, 26, planeCachePixels + 6492},
+{144, 7, planeCachePixels + 6518}, {152, 18, planeCachePixels + 6525}, {141, 8, planeCachePixels + 6543}, {151, 18, planeCachePixels + 6551},
+{139, 5, planeCachePixels + 6569}, {145, 1, planeCachePixels + 6574}, {149, 19, planeCachePixels + 6575}, {137, 5, planeCachePixels + 6594},
+{147, 21, planeCachePixels + 6599}, {137, 3, planeCachePixels + 6620}, {145, 22, planeCachePixels + 6623}, {142, 24, planeCachePixels + 6645},
+{140, 17, planeCachePixels + 6669}, {158, 1, planeCachePixels + 6686}, {160, 4, planeCachePixels + 6687}, {138, 17, planeCachePixels + 6691},
+{136, 17, planeCachePixels + 6708}, {134, 16, planeCachePixels + 6725}, {132, 16, planeCachePixels + 6741}, {130, 16, planeCachePixels + 6757},
+{127, 17, planeCachePixels + 6773}, {125, 14, planeCachePixels + 6790}, {141, 1, planeCachePixels + 6804}, {123, 14, planeCachePixels + 6805},
+{121, 14, planeCachePixels + 6819}, {119, 14, planeCachePixels + 6833}, {117, 14, planeCachePixels + 6847}, {115, 11, planeCachePixels + 6861},
+{128, 1, planeCachePixels + 6872}, {112, 12, planeCachePixels + 6873}, {110, 12, planeCachePixels + 6885}, {108, 12, planeCachePixels + 6897},
+{106, 12, planeCachePixels + 6909}, {104, 12, planeCachePixels + 6921}, {102, 11, planeCachePixels + 6933}, {99, 12, planeCachePixels + 6944},
+{97, 10, planeCachePixels + 6956}, {95, 10, planeCachePixels + 6966}, {93, 10, planeCachePixels + 6976}, {91, 9, planeCachePixels + 6986},
+{89, 9, planeCachePixels + 6995}, {87, 7, planeCachePixels + 7004}, {85, 7, planeCachePixels + 7011}, {86, 3, planeCachePixels + 7018},
+{86, 1, planeCachePixels + 7021}, {234, 3, planeCachePixels + 7022}, {231, 6, planeCachePixels + 7025}, {229, 7, planeCachePixels + 7031},
+{227, 7, planeCachePixels + 7038}, {225, 7, planeCachePixels + 7045}, {222, 10, planeCachePixels + 7052}, {220, 10, planeCachePixels + 7062},
+{218, 10, planeCachePixels + 7072}, {216, 9, planeCachePixels + 7082}, {213, 10, planeCachePixels + 7091}, {211, 10, planeCachePixels + 7101},
+{209, 11, planeCachePixels + 7111}, {150, 2, planeCachePixels + 7122}, {207, 12, planeCachePixels + 7124}, {150, 3, planeCachePixels + 7136},
+{204, 13, planeCachePixels + 7139}, {151, 2, planeCachePixels + 7152}, {202, 12, planeCachePixels + 7154}, {151, 2, planeCachePixels + 7166},
+{200, 12, planeCachePixels + 7168}, {152, 2, planeCachePixels + 7180}, {198, 12, planeCachePixels + 7182}, {152, 2, planeCachePixels + 7194},
+{195, 13, planeCachePixels + 7196}, {153, 2, planeCachePixels + 7209}, {193, 12, planeCachePixels + 7211}, {153, 2, planeCachePixels + 7223},
+{191, 12, planeCachePixels + 7225}, {154, 2, planeCachePixels + 7237}, {179, 2, planeCachePixels + 7239}, {189, 12, planeCachePixels + 7241},
+{154, 2, planeCachePixels + 7253}, {177, 4, planeCachePixels + 7255}, {186, 13, planeCachePixels + 7259}, {154, 4, planeCachePixels + 7272},
+{174, 5, planeCachePixels + 7276}, {184, 15, planeCachePixels + 7281}, {155, 3, planeCachePixels + 7296}, {162, 1, planeCachePixels + 7299},
+{172, 5, planeCachePixels + 7300}, {182, 15, planeCachePixels + 7305}, {155, 9, planeCachePixels + 7320}, {170, 5, planeCachePixels + 7329},
+{180, 14, planeCachePixels + 7334}, {155, 12, planeCachePixels + 7348}, {168, 6, planeCachePixels + 7360}, {177, 15, planeCachePixels + 7366},
+{153, 20, planeCachePixels + 7381}, {175, 15, planeCachePixels + 7401}, {153, 18, planeCachePixels + 7416}, {173, 15, planeCachePixels + 7434},
+{152, 16, planeCachePixels + 7449}, {171, 15, planeCachePixels + 7465}, {151, 35, planeCachePixels + 7480}, {151, 32, planeCachePixels + 7515},
+{151, 30, planeCachePixels + 7547}, {150, 29, planeCachePixels + 7577}, {150, 27, planeCachePixels + 7606}, {147, 27, planeCachePixels + 7633},
+{145, 27, planeCachePixels + 7660}, {143, 7, planeCachePixels + 7687}, {152, 18, planeCachePixels + 7694}, {141, 7, planeCachePixels + 7712},
+{150, 19, planeCachePixels + 7719}, {138, 5, planeCachePixels + 7738}, {145, 1, planeCachePixels + 7743}, {148, 20, planeCachePixels + 7744},
+{137, 4, planeCachePixels + 7764}, {146, 22, planeCachePixels + 7768}, {137, 2, planeCachePixels + 7790}, {144, 23, planeCachePixels + 7792},
+{142, 24, planeCachePixels + 7815}, {139, 17, planeCachePixels + 7839}, {158, 1, planeCachePixels + 7856}, {160, 1, planeCachePixels + 7857},
+{162, 2, planeCachePixels + 7858}, {137, 17, planeCachePixels + 7860}, {135, 17, planeCachePixels + 7877}, {133, 17, planeCachePixels + 7894},
+{130, 17, planeCachePixels + 7911}, {128, 17, planeCachePixels + 7928}, {126, 17, planeCachePixels + 7945}, {124, 14, planeCachePixels + 7962},
+{121, 15, planeCachePixels + 7976}, {119, 15, planeCachePixels + 7991}, {117, 15, planeCachePixels + 8006}, {115, 12, planeCachePixels + 8021},
+{128, 1, planeCachePixels + 8033}, {112, 13, planeCachePixels + 8034}, {110, 12, planeCachePixels + 8047}, {108, 12, planeCachePixels + 8059},
+{106, 12, planeCachePixels + 8071}, {103, 13, planeCachePixels + 8083}, {101, 12, planeCachePixels + 8096}, {99, 12, planeCachePixels + 8108},
+{97, 9, planeCachePixels + 8120}, {94, 10, planeCachePixels + 8129}, {92, 10, planeCachePixels + 8139}, {90, 10, planeCachePixels + 8149},
+{88, 7, planeCachePixels + 8159}, {96, 1, planeCachePixels + 8166}, {85, 8, planeCachePixels + 8167}, {85, 5, planeCachePixels + 8175},
+{85, 3, planeCachePixels + 8180}, {235, 2, planeCachePixels + 8183}, {232, 5, planeCachePixels + 8185}, {230, 8, planeCachePixels + 8190},
+{228, 7, planeCachePixels + 8198}, {225, 8, planeCachePixels + 8205}, {223, 10, planeCachePixels + 8213}, {221, 10, planeCachePixels + 8223},
+{218, 11, planeCachePixels + 8233}, {216, 10, planeCachePixels + 8244}, {214, 10, planeCachePixels + 8254}, {211, 10, planeCachePixels + 8264},
+{150, 3, planeCachePixels + 8274}, {209, 11, planeCachePixels + 8277}, {151, 2, planeCachePixels + 8288}, {207, 12, planeCachePixels + 8290},
+{151, 2, planeCachePixels + 8302}, {204, 13, planeCachePixels + 8304}, {152, 2, planeCachePixels + 8317}, {202, 13, planeCachePixels + 8319},
+{152, 2, planeCachePixels + 8332}, {199, 13, planeCachePixels + 8334}, {153, 2, planeCachePixels + 8347}, {197, 13, planeCachePixels + 8349},
+{153, 2, planeCachePixels + 8362}, {195, 13, planeCachePixels + 8364}, {153, 3, planeCachePixels + 8377}, {192, 13, planeCachePixels + 8380},
+{154, 2, planeCachePixels + 8393}, {180, 1, planeCachePixels + 8395}, {190, 13, planeCachePixels + 8396}, {154, 2, planeCachePixels + 8409},
+{177, 4, planeCachePixels + 8411}, {188, 12, planeCachePixels + 8415}, {155, 3, planeCachePixels + 8427}, {175, 5, planeCachePixels + 8430},
+{185, 14, planeCachePixels + 8435}, {155, 3, planeCachePixels + 8449}, {173, 5, planeCachePixels + 8452}, {183, 15, planeCachePixels + 8457},
+{155, 9, planeCachePixels + 8472}, {170, 6, planeCachePixels + 8481}, {181, 15, planeCachePixels + 8487}, {155, 12, planeCachePixels + 8502},
+{168, 6, planeCachePixels + 8514}, {178, 16, planeCachePixels + 8520}, {153, 20, planeCachePixels + 8536}, {176, 15, planeCachePixels + 8556},
+{153, 18, planeCachePixels + 8571}, {174, 15, planeCachePixels + 8589}, {152, 17, planeCachePixels + 8604}, {171, 16, planeCachePixels + 8621},
+{151, 17, planeCachePixels + 8637}, {169, 17, planeCachePixels + 8654}, {151, 33, planeCachePixels + 8671}, {151, 31, planeCachePixels + 8704},
+{150, 30, planeCachePixels + 8735}, {149, 28, planeCachePixels + 8765}, {147, 28, planeCachePixels + 8793}, {144, 29, planeCachePixels + 8821},
+{142, 8, planeCachePixels + 8850}, {152, 18, planeCachePixels + 8858}, {140, 7, planeCachePixels + 8876}, {150, 19, planeCachePixels + 8883},
+{137, 6, planeCachePixels + 8902}, {148, 20, planeCachePixels + 8908}, {137, 3, planeCachePixels + 8928}, {145, 23, planeCachePixels + 8931},
+{137, 1, planeCachePixels + 8954}, {143, 24, planeCachePixels + 8955}, {141, 25, planeCachePixels + 8979}, {138, 18, planeCachePixels + 9004},
+{158, 1, planeCachePixels + 9022}, {160, 1, planeCachePixels + 9023}, {162, 2, planeCachePixels + 9024}, {136, 18, planeCachePixels + 9026},
+{134, 17, planeCachePixels + 9044}, {131, 18, planeCachePixels + 9061}, {129, 18, planeCachePixels + 9079}, {126, 18, planeCachePixels + 9097},
+{124, 15, planeCachePixels + 9115}, {141, 1, planeCachePixels + 9130}, {122, 15, planeCachePixels + 9131}, {119, 16, planeCachePixels + 9146},
+{117, 15, planeCachePixels + 9162}, {115, 15, planeCachePixels + 9177}, {112, 13, planeCachePixels + 9192}, {110, 13, planeCachePixels + 9205},
+{108, 12, planeCachePixels + 9218}, {105, 13, planeCachePixels + 9230}, {103, 13, planeCachePixels + 9243}, {101, 12, planeCachePixels + 9256},
+{98, 13, planeCachePixels + 9268}, {96, 10, planeCachePixels + 9281}, {93, 11, planeCachePixels + 9291}, {91, 10, planeCachePixels + 9302},
+{89, 10, planeCachePixels + 9312}, {86, 8, planeCachePixels + 9322}, {95, 2, planeCachePixels + 9330}, {84, 8, planeCachePixels + 9332},
+{84, 5, planeCachePixels + 9340}, {85, 2, planeCachePixels + 9345}, {236, 1, planeCachePixels + 9347}, {234, 4, planeCachePixels + 9348},
+{231, 7, planeCachePixels + 9352}, {229, 8, planeCachePixels + 9359}, {226, 8, planeCachePixels + 9367}, {224, 9, planeCachePixels + 9375},
+{221, 11, planeCachePixels + 9384}, {219, 10, planeCachePixels + 9395}, {216, 11, planeCachePixels + 9405}, {152, 1, planeCachePixels + 9416},
+{214, 10, planeCachePixels + 9417}, {151, 2, planeCachePixels + 9427}, {211, 11, planeCachePixels + 9429}, {151, 2, planeCachePixels + 9440},
+{209, 11, planeCachePixels + 9442}, {152, 2, planeCachePixels + 9453}, {206, 14, planeCachePixels + 9455}, {152, 2, planeCachePixels + 9469},
+{204, 13, planeCachePixels + 9471}, {152, 3, planeCachePixels + 9484}, {201, 14, planeCachePixels + 9487}, {153, 2, planeCachePixels + 9501},
+{199, 13, planeCachePixels + 9503}, {153, 2, planeCachePixels + 9516}, {196, 14, planeCachePixels + 9518}, {154, 2, planeCachePixels + 9532},
+{194, 13, planeCachePixels + 9534}, {154, 2, planeCachePixels + 9547}, {192, 13, planeCachePixels + 9549}, {154, 3, planeCachePixels + 9562},
+{178, 3, planeCachePixels + 9565}, {189, 13, planeCachePixels + 9568}, {155, 3, planeCachePixels + 9581}, {176, 5, planeCachePixels + 9584},
+{187, 13, planeCachePixels + 9589}, {155, 3, planeCachePixels + 9602}, {160, 1, planeCachePixels + 9605}, {173, 6, planeCachePixels + 9606},
+{184, 15, planeCachePixels + 9612}, {155, 9, planeCachePixels + 9627}, {171, 5, planeCachePixels + 9636}, {182, 16, planeCachePixels + 9641},
+{155, 12, planeCachePixels + 9657}, {168, 6, planeCachePixels + 9669}, {179, 16, planeCachePixels + 9675}, {153, 21, planeCachePixels + 9691},
+{177, 16, planeCachePixels + 9712}, {153, 19, planeCachePixels + 9728}, {174, 16, planeCachePixels + 9747}, {152, 17, planeCachePixels + 9763},
+{172, 16, planeCachePixels + 9780}, {151, 17, planeCachePixels + 9796}, {169, 17, planeCachePixels + 9813}, {151, 34, planeCachePixels + 9830},
+{151, 32, planeCachePixels + 9864}, {150, 31, planeCachePixels + 9896}, {149, 29, planeCachePixels + 9927}, {146, 30, planeCachePixels + 9956},
+{144, 29, planeCachePixels + 9986}, {141, 8, planeCachePixels + 10015}, {152, 19, planeCachePixels + 10023}, {139, 5, planeCachePixels + 10042},
+{145, 2, planeCachePixels + 10047}, {149, 19, planeCachePixels + 10049}, {137, 5, planeCachePixels + 10068}, {147, 21, planeCachePixels + 10073},
+{137, 2, planeCachePixels + 10094}, {145, 23, planeCachePixels + 10096}, {142, 24, planeCachePixels + 10119}, {140, 26, planeCachePixels + 10143},
+{137, 19, planeCachePixels + 10169}, {160, 1, planeCachePixels + 10188}, {162, 2, planeCachePixels + 10189}, {135, 18, planeCachePixels + 10191},
+{132, 19, planeCachePixels + 10209}, {130, 18, planeCachePixels + 10228}, {127, 19, planeCachePixels + 10246}, {125, 18, planeCachePixels + 10265},
+{122, 16, planeCachePixels + 10283}, {120, 16, planeCachePixels + 10299}, {117, 16, planeCachePixels + 10315}, {115, 16, planeCachePixels + 10331},
+{112, 14, planeCachePixels + 10347}, {127, 1, planeCachePixels + 10361}, {110, 13, planeCachePixels + 10362}, {107, 14, planeCachePixels + 10375},
+{105, 13, planeCachePixels + 10389}, {102, 14, planeCachePixels + 10402}, {100, 13, planeCachePixels + 10416}, {97, 14, planeCachePixels + 10429},
+{95, 11, planeCachePixels + 10443}, {93, 10, planeCachePixels + 10454}, {90, 11, planeCachePixels + 10464}, {88, 10, planeCachePixels + 10475},
+{85, 8, planeCachePixels + 10485}, {95, 1, planeCachePixels + 10493}, {83, 8, planeCachePixels + 10494}, {84, 4, planeCachePixels + 10502},
+{84, 2, planeCachePixels + 10506}, {237, 1, planeCachePixels + 10508}, {235, 3, planeCachePixels + 10509}, {232, 7, planeCachePixels + 10512},
+{230, 8, planeCachePixels + 10519}, {227, 8, planeCachePixels + 10527}, {224, 9, planeCachePixels + 10535}, {222, 11, planeCachePixels + 10544},
+{219, 11, planeCachePixels + 10555}, {152, 1, planeCachePixels + 10566}, {217, 11, planeCachePixels + 10567}, {151, 2, planeCachePixels + 10578},
+{214, 11, planeCachePixels + 10580}, {152, 2, planeCachePixels + 10591}, {211, 12, planeCachePixels + 10593}, {152, 2, planeCachePixels + 10605},
+{209, 12, planeCachePixels + 10607}, {152, 3, planeCachePixels + 10619}, {206, 14, planeCachePixels + 10622}, {153, 2, planeCachePixels + 10636},
+{204, 14, planeCachePixels + 10638}, {153, 2, planeCachePixels + 10652}, {201, 14, planeCachePixels + 10654}, {154, 2, planeCachePixels + 10668},
+{198, 14, planeCachePixels + 10670}, {154, 2, planeCachePixels + 10684}, {196, 14, planeCachePixels + 10686}, {154, 2, planeCachePixels + 10700},
+{193, 14, planeCachePixels + 10702}, {155, 2, planeCachePixels + 10716}, {179, 2, planeCachePixels + 10718}, {191, 14, planeCachePixels + 10720},
+{155, 3, planeCachePixels + 10734}, {177, 5, planeCachePixels + 10737}, {188, 14, planeCachePixels + 10742}, {155, 4, planeCachePixels + 10756},
+{160, 1, planeCachePixels + 10760}, {174, 6, planeCachePixels + 10761}, {185, 14, planeCachePixels + 10767}, {155, 9, planeCachePixels + 10781},
+{172, 5, planeCachePixels + 10790}, {183, 16, planeCachePixels + 10795}, {155, 12, planeCachePixels + 10811}, {169, 6, planeCachePixels + 10823},
+{180, 17, planeCachePixels + 10829}, {153, 22, planeCachePixels + 10846}, {178, 16, planeCachePixels + 10868}, {153, 19, planeCachePixels + 10884},
+{175, 17, planeCachePixels + 10903}, {152, 18, planeCachePixels + 10920}, {172, 17, planeCachePixels + 10938}, {151, 17, planeCachePixels + 10955},
+{170, 16, planeCachePixels + 10972}, {151, 35, planeCachePixels + 10988}, {151, 33, planeCachePixels + 11023}, {150, 31, planeCachePixels + 11056},
+{148, 31, planeCachePixels + 11087}, {146, 30, planeCachePixels + 11118}, {143, 31, planeCachePixels + 11148}, {140, 9, planeCachePixels + 11179},
+{151, 20, planeCachePixels + 11188}, {138, 5, planeCachePixels + 11208}, {145, 1, planeCachePixels + 11213}, {149, 19, planeCachePixels + 11214},
+{137, 4, planeCachePixels + 11233}, {146, 23, planeCachePixels + 11237}, {137, 1, planeCachePixels + 11260}, {144, 24, planeCachePixels + 11261},
+{141, 25, planeCachePixels + 11285}, {138, 28, planeCachePixels + 11310}, {136, 19, planeCachePixels + 11338}, {157, 1, planeCachePixels + 11357},
+{160, 1, planeCachePixels + 11358}, {162, 2, planeCachePixels + 11359}, {133, 20, planeCachePixels + 11361}, {131, 19, planeCachePixels + 11381},
+{128, 20, planeCachePixels + 11400}, {125, 20, planeCachePixels + 11420}, {123, 19, planeCachePixels + 11440}, {120, 17, planeCachePixels + 11459},
+{118, 16, planeCachePixels + 11476}, {115, 17, planeCachePixels + 11492}, {112, 14, planeCachePixels + 11509}, {127, 2, planeCachePixels + 11523},
+{110, 14, planeCachePixels + 11525}, {107, 14, planeCachePixels + 11539}, {105, 14, planeCachePixels + 11553}, {102, 14, planeCachePixels + 11567},
+{99, 14, planeCachePixels + 11581}, {97, 14, planeCachePixels + 11595}, {94, 11, planeCachePixels + 11609}, {92, 11, planeCachePixels + 11620},
+{89, 11, planeCachePixels + 11631}, {86, 12, planeCachePixels + 11642}, {84, 8, planeCachePixels + 11654}, {94, 1, planeCachePixels + 11662},
+{83, 7, planeCachePixels + 11663}, {83, 4, planeCachePixels + 11670}, {236, 2, planeCachePixels + 11674}, {233, 6, planeCachePixels + 11676},
+{231, 8, planeCachePixels + 11682}, {228, 9, planeCachePixels + 11690}, {225, 9, planeCachePixels + 11699}, {222, 12, planeCachePixels + 11708},
+{152, 1, planeCachePixels + 11720}, {220, 11, planeCachePixels + 11721}, {152, 2, planeCachePixels + 11732}, {217, 12, planeCachePixels + 11734},
+{152, 2, planeCachePixels + 11746}, {214, 12, planeCachePixels + 11748}, {152, 2, planeCachePixels + 11760}, {211, 12, planeCachePixels + 11762},
+{153, 2, planeCachePixels + 11774}, {209, 12, planeCachePixels + 11776}, {153, 2, planeCachePixels + 11788}, {206, 15, planeCachePixels + 11790},
+{153, 3, planeCachePixels + 11805}, {203, 15, planeCachePixels + 11808}, {154, 2, planeCachePixels + 11823}, {200, 15, planeCachePixels + 11825},
+{154, 2, planeCachePixels + 11840}, {198, 14, planeCachePixels + 11842}, {155, 2, planeCachePixels + 11856}, {195, 15, planeCachePixels + 11858},
+{155, 2, planeCachePixels + 11873}, {180, 2, planeCachePixels + 11875}, {192, 15, planeCachePixels + 11877}, {155, 3, planeCachePixels + 11892},
+{178, 4, planeCachePixels + 11895}, {189, 15, planeCachePixels + 11899}, {156, 3, planeCachePixels + 11914}, {160, 1, planeCachePixels + 11917},
+{175, 6, planeCachePixels + 11918}, {187, 14, planeCachePixels + 11924}, {155, 10, planeCachePixels + 11938}, {172, 6, planeCachePixels + 11948},
+{184, 16, planeCachePixels + 11954}, {155, 11, planeCachePixels + 11970}, {169, 6, planeCachePixels + 11981}, {181, 18, planeCachePixels + 11987},
+{154, 21, planeCachePixels + 12005}, {178, 18, planeCachePixels + 12026}, {152, 21, planeCachePixels + 12044}, {176, 17, planeCachePixels + 12065},
+{152, 18, planeCachePixels + 12082}, {173, 17, planeCachePixels + 12100}, {151, 17, planeCachePixels + 12117}, {170, 18, planeCachePixels + 12134},
+{151, 35, planeCachePixels + 12152}, {150, 35, planeCachePixels + 12187}, {150, 32, planeCachePixels + 12222}, {148, 32, planeCachePixels + 12254},
+{145, 32, planeCachePixels + 12286}, {142, 32, planeCachePixels + 12318}, {139, 9, planeCachePixels + 12350}, {151, 20, planeCachePixels + 12359},
+{137, 5, planeCachePixels + 12379}, {148, 21, planeCachePixels + 12384}, {137, 3, planeCachePixels + 12405}, {145, 24, planeCachePixels + 12408},
+{143, 25, planeCachePixels + 12432}, {140, 26, planeCachePixels + 12457}, {137, 29, planeCachePixels + 12483}, {134, 21, planeCachePixels + 12512},
+{157, 1, planeCachePixels + 12533}, {159, 5, planeCachePixels + 12534}, {132, 20, planeCachePixels + 12539}, {129, 20, planeCachePixels + 12559},
+{126, 21, planeCachePixels + 12579}, {123, 21, planeCachePixels + 12600}, {121, 17, planeCachePixels + 12621}, {140, 1, planeCachePixels + 12638},
+{118, 18, planeCachePixels + 12639}, {115, 18, planeCachePixels + 12657}, {113, 17, planeCachePixels + 12675}, {110, 14, planeCachePixels + 12692},
+{126, 1, planeCachePixels + 12706}, {107, 15, planeCachePixels + 12707}, {104, 15, planeCachePixels + 12722}, {102, 14, planeCachePixels + 12737},
+{99, 14, planeCachePixels + 12751}, {96, 15, planeCachePixels + 12765}, {93, 12, planeCachePixels + 12780}, {107, 1, planeCachePixels + 12792},
+{91, 11, planeCachePixels + 12793}, {88, 11, planeCachePixels + 12804}, {85, 12, planeCachePixels + 12815}, {82, 9, planeCachePixels + 12827},
+{83, 5, planeCachePixels + 12836}, {83, 3, planeCachePixels + 12841}, {238, 1, planeCachePixels + 12844}, {235, 4, planeCachePixels + 12845},
+{232, 7, planeCachePixels + 12849}, {229, 9, planeCachePixels + 12856}, {226, 9, planeCachePixels + 12865}, {152, 2, planeCachePixels + 12874},
+{223, 11, planeCachePixels + 12876}, {152, 2, planeCachePixels + 12887}, {220, 12, planeCachePixels + 12889}, {152, 2, planeCachePixels + 12901},
+{217, 13, planeCachePixels + 12903}, {153, 2, planeCachePixels + 12916}, {214, 13, planeCachePixels + 12918}, {153, 2, planeCachePixels + 12931},
+{211, 13, planeCachePixels + 12933}, {153, 3, planeCachePixels + 12946}, {209, 12, planeCachePixels + 12949}, {154, 2, planeCachePixels + 12961},
+{206, 15, planeCachePixels + 12963}, {154, 2, planeCachePixels + 12978}, {203, 15, planeCachePixels + 12980}, {154, 3, planeCachePixels + 12995},
+{200, 15, planeCachePixels + 12998}, {155, 2, planeCachePixels + 13013}, {197, 15, planeCachePixels + 13015}, {155, 2, planeCachePixels + 13030},
+{194, 15, planeCachePixels + 13032}, {155, 4, planeCachePixels + 13047}, {179, 3, planeCachePixels + 13051}, {191, 15, planeCachePixels + 13054},
+{156, 3, planeCachePixels + 13069}, {176, 6, planeCachePixels + 13072}, {188, 16, planeCachePixels + 13078}, {155, 10, planeCachePixels + 13094},
+{173, 6, planeCachePixels + 13104}, {185, 16, planeCachePixels + 13110}, {155, 11, planeCachePixels + 13126}, {170, 6, planeCachePixels + 13137},
+{182, 18, planeCachePixels + 13143}, {154, 21, planeCachePixels + 13161}, {179, 19, planeCachePixels + 13182}, {152, 21, planeCachePixels + 13201},
+{177, 18, planeCachePixels + 13222}, {152, 19, planeCachePixels + 13240}, {174, 18, planeCachePixels + 13259}, {152, 16, planeCachePixels + 13277},
+{171, 18, planeCachePixels + 13293}, {151, 35, planeCachePixels + 13311}, {150, 36, planeCachePixels + 13346}, {150, 34, planeCachePixels + 13382},
+{147, 34, planeCachePixels + 13416}, {144, 34, planeCachePixels + 13450}, {141, 9, planeCachePixels + 13484}, {151, 24, planeCachePixels + 13493},
+{138, 9, planeCachePixels + 13517}, {150, 22, planeCachePixels + 13526}, {136, 5, planeCachePixels + 13548}, {148, 21, planeCachePixels + 13553},
+{137, 1, planeCachePixels + 13574}, {145, 23, planeCachePixels + 13575}, {142, 26, planeCachePixels + 13598}, {139, 27, planeCachePixels + 13624},
+{136, 30, planeCachePixels + 13651}, {133, 21, planeCachePixels + 13681}, {157, 1, planeCachePixels + 13702}, {159, 5, planeCachePixels + 13703},
+{130, 22, planeCachePixels + 13708}, {127, 22, planeCachePixels + 13730}, {124, 22, planeCachePixels + 13752}, {121, 22, planeCachePixels + 13774},
+{118, 19, planeCachePixels + 13796}, {116, 18, planeCachePixels + 13815}, {113, 18, planeCachePixels + 13833}, {110, 15, planeCachePixels + 13851},
+{126, 2, planeCachePixels + 13866}, {107, 15, planeCachePixels + 13868}, {104, 15, planeCachePixels + 13883}, {101, 15, planeCachePixels + 13898},
+{98, 15, planeCachePixels + 13913}, {95, 16, planeCachePixels + 13928}, {92, 13, planeCachePixels + 13944}, {107, 1, planeCachePixels + 13957},
+{89, 13, planeCachePixels + 13958}, {87, 12, planeCachePixels + 13971}, {84, 12, planeCachePixels + 13983}, {82, 8, planeCachePixels + 13995},
+{82, 5, planeCachePixels + 14003}, {83, 1, planeCachePixels + 14008}, {236, 3, planeCachePixels + 14009}, {233, 7, planeCachePixels + 14012},
+{230, 10, planeCachePixels + 14019}, {152, 2, planeCachePixels + 14029}, {227, 9, planeCachePixels + 14031}, {152, 3, planeCachePixels + 14040},
+{224, 10, planeCachePixels + 14043}, {153, 2, planeCachePixels + 14053}, {221, 13, planeCachePixels + 14055}, {153, 2, planeCachePixels + 14068},
+{218, 12, planeCachePixels + 14070}, {153, 3, planeCachePixels + 14082}, {214, 13, planeCachePixels + 14085}, {154, 2, planeCachePixels + 14098},
+{211, 13, planeCachePixels + 14100}, {154, 2, planeCachePixels + 14113}, {208, 13, planeCachePixels + 14115}, {154, 2, planeCachePixels + 14128},
+{205, 16, planeCachePixels + 14130}, {155, 2, planeCachePixels + 14146}, {202, 16, planeCachePixels + 14148}, {155, 2, planeCachePixels + 14164},
+{199, 16, planeCachePixels + 14166}, {155, 2, planeCachePixels + 14182}, {196, 16, planeCachePixels + 14184}, {156, 3, planeCachePixels + 14200},
+{180, 2, planeCachePixels + 14203}, {193, 16, planeCachePixels + 14205}, {156, 3, planeCachePixels + 14221}, {177, 5, planeCachePixels + 14224},
+{190, 16, planeCachePixels + 14229}, {155, 10, planeCachePixels + 14245}, {174, 6, planeCachePixels + 14255}, {187, 16, planeCachePixels + 14261},
+{155, 11, planeCachePixels + 14277}, {171, 6, planeCachePixels + 14288}, {184, 16, planeCachePixels + 14294}, {154, 13, planeCachePixels + 14310},
+{168, 7, planeCachePixels + 14323}, {181, 19, planeCachePixels + 14330}, {152, 22, planeCachePixels + 14349}, {178, 19, planeCachePixels + 14371},
+{152, 19, planeCachePixels + 14390}, {174, 20, planeCachePixels + 14409}, {152, 16, planeCachePixels + 14429}, {171, 20, planeCachePixels + 14445},
+{151, 37, planeCachePixels + 14465}, {150, 36, planeCachePixels + 14502}, {149, 36, planeCachePixels + 14538}, {146, 36, planeCachePixels + 14574},
+{143, 36, planeCachePixels + 14610}, {140, 10, planeCachePixels + 14646}, {151, 25, planeCachePixels + 14656}, {137, 6, planeCachePixels + 14681},
+{144, 3, planeCachePixels + 14687}, {150, 22, planeCachePixels + 14690}, {136, 4, planeCachePixels + 14712}, {147, 22, planeCachePixels + 14716},
+{144, 24, planeCachePixels + 14738}, {141, 27, planeCachePixels + 14762}, {137, 30, planeCachePixels + 14789}, {134, 32, planeCachePixels + 14819},
+{131, 23, planeCachePixels + 14851}, {159, 1, planeCachePixels + 14874}, {161, 3, planeCachePixels + 14875}, {128, 23, planeCachePixels + 14878},
+{125, 23, planeCachePixels + 14901}, {122, 23, planeCachePixels + 14924}, {119, 19, planeCachePixels + 14947}, {139, 3, planeCachePixels + 14966},
+{116, 19, planeCachePixels + 14969}, {113, 19, planeCachePixels + 14988}, {110, 19, planeCachePixels + 15007}, {107, 16, planeCachePixels + 15026},
+{104, 16, planeCachePixels + 15042}, {101, 16, planeCachePixels + 15058}, {97, 17, planeCachePixels + 15074}, {94, 17, planeCachePixels + 15091},
+{91, 13, planeCachePixels + 15108}, {106, 2, planeCachePixels + 15121}, {88, 13, planeCachePixels + 15123}, {85, 13, planeCachePixels + 15136},
+{82, 10, planeCachePixels + 15149}, {93, 2, planeCachePixels + 15159}, {81, 8, planeCachePixels + 15161}, {82, 4, planeCachePixels + 15169},
+{82, 1, planeCachePixels + 15173}, {237, 3, planeCachePixels + 15174}, {234, 6, planeCachePixels + 15177}, {153, 2, planeCachePixels + 15183},
+{231, 9, planeCachePixels + 15185}, {153, 2, planeCachePixels + 15194}, {228, 10, planeCachePixels + 15196}, {153, 2, planeCachePixels + 15206},
+{224, 11, planeCachePixels + 15208}, {153, 3, planeCachePixels + 15219}, {221, 14, planeCachePixels + 15222}, {154, 2, planeCachePixels + 15236},
+{218, 13, planeCachePixels + 15238}, {154, 2, planeCachePixels + 15251}, {215, 13, planeCachePixels + 15253}, {154, 2, planeCachePixels + 15266},
+{211, 14, planeCachePixels + 15268}, {155, 2, planeCachePixels + 15282}, {208, 14, planeCachePixels + 15284}, {155, 2, planeCachePixels + 15298},
+{205, 17, planeCachePixels + 15300}, {155, 2, planeCachePixels + 15317}, {201, 18, planeCachePixels + 15319}, {156, 2, planeCachePixels + 15337},
+{198, 17, planeCachePixels + 15339}, {156, 3, planeCachePixels + 15356}, {181, 1, planeCachePixels + 15359}, {195, 17, planeCachePixels + 15360},
+{156, 3, planeCachePixels + 15377}, {178, 4, planeCachePixels + 15380}, {192, 17, planeCachePixels + 15384}, {155, 10, planeCachePixels + 15401},
+{175, 7, planeCachePixels + 15411}, {188, 17, planeCachePixels + 15418}, {154, 12, planeCachePixels + 15435}, {171, 7, planeCachePixels + 15447},
+{185, 17, planeCachePixels + 15454}, {154, 21, planeCachePixels + 15471}, {182, 18, planeCachePixels + 15492}, {152, 23, planeCachePixels + 15510},
+{179, 20, planeCachePixels + 15533}, {151, 21, planeCachePixels + 15553}, {175, 21, planeCachePixels + 15574}, {152, 17, planeCachePixels + 15595},
+{172, 21, planeCachePixels + 15612}, {151, 38, planeCachePixels + 15633}, {150, 36, planeCachePixels + 15671}, {149, 37, planeCachePixels + 15707},
+{145, 38, planeCachePixels + 15744}, {142, 38, planeCachePixels + 15782}, {139, 10, planeCachePixels + 15820}, {151, 25, planeCachePixels + 15830},
+{136, 6, planeCachePixels + 15855}, {144, 2, planeCachePixels + 15861}, {149, 24, planeCachePixels + 15863}, {136, 3, planeCachePixels + 15887},
+{146, 24, planeCachePixels + 15890}, {143, 25, planeCachePixels + 15914}, {139, 28, planeCachePixels + 15939}, {136, 31, planeCachePixels + 15967},
+{133, 33, planeCachePixels + 15998}, {130, 23, planeCachePixels + 16031}, {159, 1, planeCachePixels + 16054}, {161, 3, planeCachePixels + 16055},
+{126, 24, planeCachePixels + 16058}, {123, 24, planeCachePixels + 16082}, {120, 24, planeCachePixels + 16106}, {116, 21, planeCachePixels + 16130},
+{139, 1, planeCachePixels + 16151}, {113, 21, planeCachePixels + 16152}, {110, 20, planeCachePixels + 16173}, {107, 17, planeCachePixels + 16193},
+{125, 2, planeCachePixels + 16210}, {103, 17, planeCachePixels + 16212}, {100, 17, planeCachePixels + 16229}, {97, 17, planeCachePixels + 16246},
+{94, 17, planeCachePixels + 16263}, {90, 14, planeCachePixels + 16280}, {106, 1, planeCachePixels + 16294}, {87, 14, planeCachePixels + 16295},
+{84, 13, planeCachePixels + 16309}, {81, 10, planeCachePixels + 16322}, {92, 2, planeCachePixels + 16332}, {81, 6, planeCachePixels + 16334},
+{81, 3, planeCachePixels + 16340}, {239, 1, planeCachePixels + 16343}, {153, 2, planeCachePixels + 16344}, {236, 4, planeCachePixels + 16346},
+{153, 2, planeCachePixels + 16350}, {232, 9, planeCachePixels + 16352}, {153, 3, planeCachePixels + 16361}, {229, 10, planeCachePixels + 16364},
+{154, 2, planeCachePixels + 16374}, {225, 11, planeCachePixels + 16376}, {154, 2, planeCachePixels + 16387}, {222, 13, planeCachePixels + 16389},
+{154, 2, planeCachePixels + 16402}, {218, 15, planeCachePixels + 16404}, {155, 2, planeCachePixels + 16419}, {215, 14, planeCachePixels + 16421},
+{155, 2, planeCachePixels + 16435}, {211, 15, planeCachePixels + 16437}, {155, 2, planeCachePixels + 16452}, {208, 14, planeCachePixels + 16454},
+{155, 3, planeCachePixels + 16468}, {204, 18, planeCachePixels + 16471}, {156, 2, planeCachePixels + 16489}, {201, 18, planeCachePixels + 16491},
+{156, 3, planeCachePixels + 16509}, {197, 18, planeCachePixels + 16512}, {156, 3, planeCachePixels + 16530}, {161, 1, planeCachePixels + 16533},
+{179, 3, planeCachePixels + 16534}, {194, 18, planeCachePixels + 16537}, {156, 8, planeCachePixels + 16555}, {176, 7, planeCachePixels + 16563},
+{190, 18, planeCachePixels + 16570}, {154, 12, planeCachePixels + 16588}, {172, 7, planeCachePixels + 16600}, {187, 18, planeCachePixels + 16607},
+{154, 14, planeCachePixels + 16625}, {169, 7, planeCachePixels + 16639}, {183, 18, planeCachePixels + 16646}, {152, 23, planeCachePixels + 16664},
+{180, 20, planeCachePixels + 16687}, {152, 21, planeCachePixels + 16707}, {176, 22, planeCachePixels + 16728}, {151, 18, planeCachePixels + 16750},
+{173, 22, planeCachePixels + 16768}, {151, 40, planeCachePixels + 16790}, {150, 38, planeCachePixels + 16830}, {148, 38, planeCachePixels + 16868},
+{144, 40, planeCachePixels + 16906}, {141, 40, planeCachePixels + 16946}, {137, 11, planeCachePixels + 16986}, {151, 26, planeCachePixels + 16997},
+{136, 5, planeCachePixels + 17023}, {144, 1, planeCachePixels + 17028}, {148, 26, planeCachePixels + 17029}, {136, 2, planeCachePixels + 17055},
+{145, 25, planeCachePixels + 17057}, {141, 27, planeCachePixels + 17082}, {138, 29, planeCachePixels + 17109}, {134, 33, planeCachePixels + 17138},
+{131, 35, planeCachePixels + 17171}, {127, 26, planeCachePixels + 17206}, {159, 1, planeCachePixels + 17232}, {161, 3, planeCachePixels + 17233},
+{124, 25, planeCachePixels + 17236}, {120, 26, planeCachePixels + 17261}, {117, 25, planeCachePixels + 17287}, {113, 22, planeCachePixels + 17312},
+{110, 22, planeCachePixels + 17334}, {107, 21, planeCachePixels + 17356}, {103, 18, planeCachePixels + 17377}, {100, 18, planeCachePixels + 17395},
+{96, 18, planeCachePixels + 17413}, {93, 18, planeCachePixels + 17431}, {89, 15, planeCachePixels + 17449}, {106, 1, planeCachePixels + 17464},
+{86, 14, planeCachePixels + 17465}, {82, 15, planeCachePixels + 17479}, {81, 8, planeCachePixels + 17494}, {92, 1, planeCachePixels + 17502},
+{81, 5, planeCachePixels + 17503}, {81, 2, planeCachePixels + 17508}, {153, 2, planeCachePixels + 17510}, {154, 2, planeCachePixels + 17512},
+{237, 4, planeCachePixels + 17514}, {154, 2, planeCachePixels + 17518}, {233, 8, planeCachePixels + 17520}, {154, 2, planeCachePixels + 17528},
+{230, 11, planeCachePixels + 17530}, {154, 2, planeCachePixels + 17541}, {226, 11, planeCachePixels + 17543}, {155, 2, planeCachePixels + 17554},
+{222, 13, planeCachePixels + 17556}, {155, 2, planeCachePixels + 17569}, {218, 16, planeCachePixels + 17571}, {155, 2, planeCachePixels + 17587},
+{215, 15, planeCachePixels + 17589}, {155, 3, planeCachePixels + 17604}, {211, 15, planeCachePixels + 17607}, {156, 2, planeCachePixels + 17622},
+{207, 16, planeCachePixels + 17624}, {156, 2, planeCachePixels + 17640}, {203, 19, planeCachePixels + 17642}, {156, 3, planeCachePixels + 17661},
+{200, 19, planeCachePixels + 17664}, {157, 3, planeCachePixels + 17683}, {161, 1, planeCachePixels + 17686}, {181, 1, planeCachePixels + 17687},
+{196, 19, planeCachePixels + 17688}, {156, 8, planeCachePixels + 17707}, {177, 6, planeCachePixels + 17715}, {192, 20, planeCachePixels + 17721},
+{154, 12, planeCachePixels + 17741}, {173, 8, planeCachePixels + 17753}, {189, 19, planeCachePixels + 17761}, {154, 14, planeCachePixels + 17780},
+{169, 8, planeCachePixels + 17794}, {185, 19, planeCachePixels + 17802}, {152, 23, planeCachePixels + 17821}, {181, 19, planeCachePixels + 17844},
+{152, 21, planeCachePixels + 17863}, {177, 23, planeCachePixels + 17884}, {151, 19, planeCachePixels + 17907}, {174, 23, planeCachePixels + 17926},
+{151, 18, planeCachePixels + 17949}, {170, 23, planeCachePixels + 17967}, {150, 39, planeCachePixels + 17990}, {147, 39, planeCachePixels + 18029},
+{143, 43, planeCachePixels + 18068}, {140, 42, planeCachePixels + 18111}, {136, 11, planeCachePixels + 18153}, {151, 27, planeCachePixels + 18164},
+{136, 4, planeCachePixels + 18191}, {148, 27, planeCachePixels + 18195}, {144, 27, planeCachePixels + 18222}, {140, 28, planeCachePixels + 18249},
+{136, 31, planeCachePixels + 18277}, {133, 34, planeCachePixels + 18308}, {129, 36, planeCachePixels + 18342}, {125, 27, planeCachePixels + 18378},
+{159, 1, planeCachePixels + 18405}, {161, 3, planeCachePixels + 18406}, {121, 27, planeCachePixels + 18409}, {118, 27, planeCachePixels + 18436},
+{114, 23, planeCachePixels + 18463}, {139, 2, planeCachePixels + 18486}, {110, 23, planeCachePixels + 18488}, {106, 24, planeCachePixels + 18511},
+{103, 19, planeCachePixels + 18535}, {125, 1, planeCachePixels + 18554}, {99, 19, planeCachePixels + 18555}, {95, 20, planeCachePixels + 18574},
+{92, 19, planeCachePixels + 18594}, {88, 15, planeCachePixels + 18613}, {105, 2, planeCachePixels + 18628}, {84, 16, planeCachePixels + 18630},
+{80, 16, planeCachePixels + 18646}, {80, 8, planeCachePixels + 18662}, {80, 4, planeCachePixels + 18670}, {154, 2, planeCachePixels + 18674},
+{154, 2, planeCachePixels + 18676}, {154, 2, planeCachePixels + 18678}, {239, 2, planeCachePixels + 18680}, {154, 3, planeCachePixels + 18682},
+{235, 6, planeCachePixels + 18685}, {155, 2, planeCachePixels + 18691}, {231, 10, planeCachePixels + 18693}, {155, 2, planeCachePixels + 18703},
+{227, 12, planeCachePixels + 18705}, {155, 2, planeCachePixels + 18717}, {223, 13, planeCachePixels + 18719}, {155, 3, planeCachePixels + 18732},
+{219, 16, planeCachePixels + 18735}, {156, 2, planeCachePixels + 18751}, {215, 16, planeCachePixels + 18753}, {156, 2, planeCachePixels + 18769},
+{211, 16, planeCachePixels + 18771}, {156, 2, planeCachePixels + 18787}, {207, 16, planeCachePixels + 18789}, {156, 4, planeCachePixels + 18805},
+{203, 19, planeCachePixels + 18809}, {157, 3, planeCachePixels + 18828}, {161, 1, planeCachePixels + 18831}, {199, 20, planeCachePixels + 18832},
+{156, 8, planeCachePixels + 18852}, {178, 5, planeCachePixels + 18860}, {195, 20, planeCachePixels + 18865}, {154, 11, planeCachePixels + 18885},
+{174, 8, planeCachePixels + 18896}, {191, 20, planeCachePixels + 18904}, {154, 14, planeCachePixels + 18924}, {170, 8, planeCachePixels + 18938},
+{187, 20, planeCachePixels + 18946}, {153, 22, planeCachePixels + 18966}, {183, 20, planeCachePixels + 18988}, {152, 22, planeCachePixels + 19008},
+{179, 21, planeCachePixels + 19030}, {151, 19, planeCachePixels + 19051}, {175, 24, planeCachePixels + 19070}, {150, 19, planeCachePixels + 19094},
+{171, 24, planeCachePixels + 19113}, {150, 41, planeCachePixels + 19137}, {146, 41, planeCachePixels + 19178}, {142, 44, planeCachePixels + 19219},
+{138, 12, planeCachePixels + 19263}, {151, 32, planeCachePixels + 19275}, {136, 6, planeCachePixels + 19307}, {144, 2, planeCachePixels + 19313},
+{151, 28, planeCachePixels + 19315}, {136, 2, planeCachePixels + 19343}, {147, 28, planeCachePixels + 19345}, {143, 28, planeCachePixels + 19373},
+{139, 29, planeCachePixels + 19401}, {134, 34, planeCachePixels + 19430}, {130, 37, planeCachePixels + 19464}, {126, 29, planeCachePixels + 19501},
+{156, 9, planeCachePixels + 19530}, {122, 29, planeCachePixels + 19539}, {158, 6, planeCachePixels + 19568}, {118, 29, planeCachePixels + 19574},
+{114, 29, planeCachePixels + 19603}, {110, 25, planeCachePixels + 19632}, {138, 1, planeCachePixels + 19657}, {106, 25, planeCachePixels + 19658},
+{102, 21, planeCachePixels + 19683}, {125, 2, planeCachePixels + 19704}, {98, 21, planeCachePixels + 19706}, {94, 21, planeCachePixels + 19727},
+{90, 21, planeCachePixels + 19748}, {86, 17, planeCachePixels + 19769}, {105, 2, planeCachePixels + 19786}, {82, 17, planeCachePixels + 19788},
+{80, 15, planeCachePixels + 19805}, {80, 7, planeCachePixels + 19820}, {80, 3, planeCachePixels + 19827}, {154, 2, planeCachePixels + 19830},
+{154, 2, planeCachePixels + 19832}, {155, 2, planeCachePixels + 19834}, {155, 2, planeCachePixels + 19836}, {155, 2, planeCachePixels + 19838},
+{236, 5, planeCachePixels + 19840}, {155, 2, planeCachePixels + 19845}, {232, 9, planeCachePixels + 19847}, {155, 3, planeCachePixels + 19856},
+{228, 13, planeCachePixels + 19859}, {156, 2, planeCachePixels + 19872}, {223, 14, planeCachePixels + 19874}, {156, 2, planeCachePixels + 19888},
+{219, 17, planeCachePixels + 19890}, {156, 2, planeCachePixels + 19907}, {215, 17, planeCachePixels + 19909}, {156, 2, planeCachePixels + 19926},
+{210, 18, planeCachePixels + 19928}, {157, 3, planeCachePixels + 19946}, {206, 18, planeCachePixels + 19949}, {157, 3, planeCachePixels + 19967},
+{202, 21, planeCachePixels + 19970}, {156, 8, planeCachePixels + 19991}, {180, 3, planeCachePixels + 19999}, {197, 23, planeCachePixels + 20002},
+{154, 13, planeCachePixels + 20025}, {175, 8, planeCachePixels + 20038}, {193, 22, planeCachePixels + 20046}, {153, 15, planeCachePixels + 20068},
+{171, 9, planeCachePixels + 20083}, {189, 22, planeCachePixels + 20092}, {153, 22, planeCachePixels + 20114}, {184, 23, planeCachePixels + 20136},
+{152, 23, planeCachePixels + 20159}, {180, 22, planeCachePixels + 20182}, {151, 20, planeCachePixels + 20204}, {176, 24, planeCachePixels + 20224},
+{150, 19, planeCachePixels + 20248}, {171, 27, planeCachePixels + 20267}, {149, 45, planeCachePixels + 20294}, {145, 44, planeCachePixels + 20339},
+{141, 45, planeCachePixels + 20383}, {136, 14, planeCachePixels + 20428}, {151, 34, planeCachePixels + 20442}, {136, 5, planeCachePixels + 20476},
+{144, 1, planeCachePixels + 20481}, {150, 31, planeCachePixels + 20482}, {136, 1, planeCachePixels + 20513}, {145, 32, planeCachePixels + 20514},
+{141, 31, planeCachePixels + 20546}, {137, 31, planeCachePixels + 20577}, {132, 36, planeCachePixels + 20608}, {128, 39, planeCachePixels + 20644},
+{124, 31, planeCachePixels + 20683}, {156, 9, planeCachePixels + 20714}, {119, 32, planeCachePixels + 20723}, {158, 1, planeCachePixels + 20755},
+{160, 4, planeCachePixels + 20756}, {115, 31, planeCachePixels + 20760}, {111, 26, planeCachePixels + 20791}, {138, 4, planeCachePixels + 20817},
+{106, 27, planeCachePixels + 20821}, {102, 27, planeCachePixels + 20848}, {98, 22, planeCachePixels + 20875}, {93, 23, planeCachePixels + 20897},
+{89, 22, planeCachePixels + 20920}, {85, 18, planeCachePixels + 20942}, {105, 2, planeCachePixels + 20960}, {80, 18, planeCachePixels + 20962},
+{79, 10, planeCachePixels + 20980}, {91, 3, planeCachePixels + 20990}, {80, 5, planeCachePixels + 20993}, {80, 1, planeCachePixels + 20998},
+{155, 2, planeCachePixels + 20999}, {155, 2, planeCachePixels + 21001}, {155, 2, planeCachePixels + 21003}, {155, 2, planeCachePixels + 21005},
+{155, 2, planeCachePixels + 21007}, {156, 2, planeCachePixels + 21009}, {238, 3, planeCachePixels + 21011}, {156, 2, planeCachePixels + 21014},
+{233, 9, planeCachePixels + 21016}, {156, 2, planeCachePixels + 21025}, {229, 13, planeCachePixels + 21027}, {156, 2, planeCachePixels + 21040},
+{224, 14, planeCachePixels + 21042}, {156, 2, planeCachePixels + 21056}, {219, 17, planeCachePixels + 21058}, {157, 2, planeCachePixels + 21075},
+{215, 19, planeCachePixels + 21077}, {157, 3, planeCachePixels + 21096}, {210, 19, planeCachePixels + 21099}, {157, 3, planeCachePixels + 21118},
+{205, 19, planeCachePixels + 21121}, {156, 8, planeCachePixels + 21140}, {181, 2, planeCachePixels + 21148}, {201, 22, planeCachePixels + 21150},
+{154, 12, planeCachePixels + 21172}, {177, 6, planeCachePixels + 21184}, {196, 24, planeCachePixels + 21190}, {153, 15, planeCachePixels + 21214},
+{172, 10, planeCachePixels + 21229}, {191, 24, planeCachePixels + 21239}, {153, 24, planeCachePixels + 21263}, {186, 24, planeCachePixels + 21287},
+{152, 23, planeCachePixels + 21311}, {182, 24, planeCachePixels + 21334}, {151, 21, planeCachePixels + 21358}, {177, 24, planeCachePixels + 21379},
+{150, 19, planeCachePixels + 21403}, {172, 28, planeCachePixels + 21422}, {148, 48, planeCachePixels + 21450}, {144, 48, planeCachePixels + 21498},
+{139, 48, planeCachePixels + 21546}, {136, 13, planeCachePixels + 21594}, {151, 35, planeCachePixels + 21607}, {136, 3, planeCachePixels + 21642},
+{149, 33, planeCachePixels + 21645}, {144, 34, planeCachePixels + 21678}, {139, 34, planeCachePixels + 21712}, {135, 33, planeCachePixels + 21746},
+{130, 38, planeCachePixels + 21779}, {125, 42, planeCachePixels + 21817}, {121, 33, planeCachePixels + 21859}, {156, 9, planeCachePixels + 21892},
+{116, 34, planeCachePixels + 21901}, {158, 1, planeCachePixels + 21935}, {160, 4, planeCachePixels + 21936}, {111, 34, planeCachePixels + 21940},
+{106, 29, planeCachePixels + 21974}, {138, 2, planeCachePixels + 22003}, {102, 29, planeCachePixels + 22005}, {97, 24, planeCachePixels + 22034},
+{124, 2, planeCachePixels + 22058}, {92, 24, planeCachePixels + 22060}, {88, 24, planeCachePixels + 22084}, {83, 19, planeCachePixels + 22108},
+{104, 3, planeCachePixels + 22127}, {79, 18, planeCachePixels + 22130}, {79, 9, planeCachePixels + 22148}, {90, 3, planeCachePixels + 22157},
+{79, 4, planeCachePixels + 22160}, {156, 1, planeCachePixels + 22164}, {155, 2, planeCachePixels + 22165}, {155, 2, planeCachePixels + 22167},
+{155, 2, planeCachePixels + 22169}, {155, 3, planeCachePixels + 22171}, {156, 2, planeCachePixels + 22174}, {156, 2, planeCachePixels + 22176},
+{156, 2, planeCachePixels + 22178}, {240, 2, planeCachePixels + 22180}, {156, 2, planeCachePixels + 22182}, {235, 7, planeCachePixels + 22184},
+{156, 2, planeCachePixels + 22191}, {230, 12, planeCachePixels + 22193}, {157, 2, planeCachePixels + 22205}, {225, 16, planeCachePixels + 22207},
+{157, 2, planeCachePixels + 22223}, {220, 16, planeCachePixels + 22225}, {157, 3, planeCachePixels + 22241}, {215, 21, planeCachePixels + 22244},
+{157, 3, planeCachePixels + 22265}, {209, 21, planeCachePixels + 22268}, {156, 9, planeCachePixels + 22289}, {204, 21, planeCachePixels + 22298},
+{155, 11, planeCachePixels + 22319}, {178, 5, planeCachePixels + 22330}, {199, 24, planeCachePixels + 22335}, {153, 14, planeCachePixels + 22359},
+{173, 10, planeCachePixels + 22373}, {194, 26, planeCachePixels + 22383}, {152, 26, planeCachePixels + 22409}, {189, 26, planeCachePixels + 22435},
+{152, 24, planeCachePixels + 22461}, {184, 26, planeCachePixels + 22485}, {151, 22, planeCachePixels + 22511}, {179, 26, planeCachePixels + 22533},
+{150, 19, planeCachePixels + 22559}, {173, 27, planeCachePixels + 22578}, {147, 53, planeCachePixels + 22605}, {142, 53, planeCachePixels + 22658},
+{137, 52, planeCachePixels + 22711}, {136, 6, planeCachePixels + 22763}, {144, 4, planeCachePixels + 22769}, {151, 35, planeCachePixels + 22773},
+{136, 1, planeCachePixels + 22808}, {148, 36, planeCachePixels + 22809}, {143, 36, planeCachePixels + 22845}, {137, 37, planeCachePixels + 22881},
+{132, 37, planeCachePixels + 22918}, {127, 40, planeCachePixels + 22955}, {122, 45, planeCachePixels + 22995}, {117, 37, planeCachePixels + 23040},
+{156, 9, planeCachePixels + 23077}, {112, 36, planeCachePixels + 23086}, {158, 1, planeCachePixels + 23122}, {160, 4, planeCachePixels + 23123},
+{107, 36, planeCachePixels + 23127}, {101, 32, planeCachePixels + 23163}, {96, 26, planeCachePixels + 23195}, {124, 4, planeCachePixels + 23221},
+{91, 26, planeCachePixels + 23225}, {86, 26, planeCachePixels + 23251}, {81, 21, planeCachePixels + 23277}, {104, 3, planeCachePixels + 23298},
+{79, 18, planeCachePixels + 23301}, {79, 7, planeCachePixels + 23319}, {90, 1, planeCachePixels + 23326}, {79, 2, planeCachePixels + 23327},
+{156, 1, planeCachePixels + 23329}, {155, 2, planeCachePixels + 23330}, {155, 2, planeCachePixels + 23332}, {156, 2, planeCachePixels + 23334},
+{156, 2, planeCachePixels + 23336}, {156, 2, planeCachePixels + 23338}, {156, 2, planeCachePixels + 23340}, {156, 2, planeCachePixels + 23342},
+{157, 2, planeCachePixels + 23344}, {157, 2, planeCachePixels + 23346}, {237, 5, planeCachePixels + 23348}, {157, 2, planeCachePixels + 23353},
+{231, 11, planeCachePixels + 23355}, {157, 2, planeCachePixels + 23366}, {226, 16, planeCachePixels + 23368}, {157, 3, planeCachePixels + 23384},
+{220, 17, planeCachePixels + 23387}, {157, 3, planeCachePixels + 23404}, {214, 23, planeCachePixels + 23407}, {157, 8, planeCachePixels + 23430},
+{209, 23, planeCachePixels + 23438}, {155, 11, planeCachePixels + 23461}, {180, 3, planeCachePixels + 23472}, {203, 23, planeCachePixels + 23475},
+{153, 14, planeCachePixels + 23498}, {174, 9, planeCachePixels + 23512}, {197, 26, planeCachePixels + 23521}, {152, 16, planeCachePixels + 23547},
+{169, 11, planeCachePixels + 23563}, {192, 29, planeCachePixels + 23574}, {152, 24, planeCachePixels + 23603}, {186, 29, planeCachePixels + 23627},
+{151, 24, planeCachePixels + 23656}, {180, 29, planeCachePixels + 23680}, {151, 18, planeCachePixels + 23709}, {175, 29, planeCachePixels + 23727},
+{146, 54, planeCachePixels + 23756}, {140, 58, planeCachePixels + 23810}, {136, 56, planeCachePixels + 23868}, {136, 5, planeCachePixels + 23924},
+{144, 2, planeCachePixels + 23929}, {151, 36, planeCachePixels + 23931}, {146, 40, planeCachePixels + 23967}, {141, 40, planeCachePixels + 24007},
+{135, 40, planeCachePixels + 24047}, {129, 41, planeCachePixels + 24087}, {124, 43, planeCachePixels + 24128}, {118, 48, planeCachePixels + 24171},
+{112, 41, planeCachePixels + 24219}, {155, 10, planeCachePixels + 24260}, {107, 40, planeCachePixels + 24270}, {160, 4, planeCachePixels + 24310},
+{101, 35, planeCachePixels + 24314}, {138, 3, planeCachePixels + 24349}, {95, 35, planeCachePixels + 24352}, {90, 28, planeCachePixels + 24387},
+{84, 29, planeCachePixels + 24415}, {78, 23, planeCachePixels + 24444}, {104, 3, planeCachePixels + 24467}, {79, 17, planeCachePixels + 24470},
+{79, 5, planeCachePixels + 24487}, {156, 2, planeCachePixels + 24492}, {156, 2, planeCachePixels + 24494}, {156, 2, planeCachePixels + 24496},
+{156, 2, planeCachePixels + 24498}, {156, 2, planeCachePixels + 24500}, {156, 2, planeCachePixels + 24502}, {156, 2, planeCachePixels + 24504},
+{157, 2, planeCachePixels + 24506}, {157, 2, planeCachePixels + 24508}, {157, 2, planeCachePixels + 24510}, {157, 2, planeCachePixels + 24512},
+{239, 3, planeCachePixels + 24514}, {157, 2, planeCachePixels + 24517}, {233, 9, planeCachePixels + 24519}, {157, 3, planeCachePixels + 24528},
+{227, 15, planeCachePixels + 24531}, {157, 4, planeCachePixels + 24546}, {221, 19, planeCachePixels + 24550}, {157, 8, planeCachePixels + 24569},
+{214, 23, planeCachePixels + 24577}, {155, 11, planeCachePixels + 24600}, {182, 1, planeCachePixels + 24611}, {208, 25, planeCachePixels + 24612},
+{153, 14, planeCachePixels + 24637}, {176, 7, planeCachePixels + 24651}, {202, 25, planeCachePixels + 24658}, {152, 16, planeCachePixels + 24683},
+{170, 12, planeCachePixels + 24699}, {195, 28, planeCachePixels + 24711}, {151, 25, planeCachePixels + 24739}, {189, 32, planeCachePixels + 24764},
+{151, 25, planeCachePixels + 24796}, {183, 32, planeCachePixels + 24821}, {151, 19, planeCachePixels + 24853}, {176, 32, planeCachePixels + 24872},
+{144, 25, planeCachePixels + 24904}, {170, 32, planeCachePixels + 24929}, {138, 62, planeCachePixels + 24961}, {136, 60, planeCachePixels + 25023},
+{136, 2, planeCachePixels + 25083}, {144, 1, planeCachePixels + 25085}, {151, 38, planeCachePixels + 25086}, {145, 41, planeCachePixels + 25124},
+{138, 45, planeCachePixels + 25165}, {132, 45, planeCachePixels + 25210}, {126, 45, planeCachePixels + 25255}, {119, 48, planeCachePixels + 25300},
+{113, 53, planeCachePixels + 25348}, {107, 45, planeCachePixels + 25401}, {155, 9, planeCachePixels + 25446}, {101, 44, planeCachePixels + 25455},
+{160, 4, planeCachePixels + 25499}, {94, 39, planeCachePixels + 25503}, {137, 2, planeCachePixels + 25542}, {88, 32, planeCachePixels + 25544},
+{123, 3, planeCachePixels + 25576}, {82, 32, planeCachePixels + 25579}, {78, 23, planeCachePixels + 25611}, {103, 4, planeCachePixels + 25634},
+{78, 10, planeCachePixels + 25638}, {89, 6, planeCachePixels + 25648}, {78, 4, planeCachePixels + 25654}, {156, 2, planeCachePixels + 25658},
+{156, 2, planeCachePixels + 25660}, {156, 2, planeCachePixels + 25662}, {156, 2, planeCachePixels + 25664}, {156, 2, planeCachePixels + 25666},
+{157, 2, planeCachePixels + 25668}, {157, 2, planeCachePixels + 25670}, {157, 2, planeCachePixels + 25672}, {157, 2, planeCachePixels + 25674},
+{157, 2, planeCachePixels + 25676}, {157, 2, planeCachePixels + 25678}, {157, 2, planeCachePixels + 25680}, {158, 3, planeCachePixels + 25682},
+{235, 7, planeCachePixels + 25685}, {157, 4, planeCachePixels + 25692}, {228, 15, planeCachePixels + 25696}, {156, 7, planeCachePixels + 25711},
+{164, 1, planeCachePixels + 25718}, {221, 22, planeCachePixels + 25719}, {155, 11, planeCachePixels + 25741}, {214, 23, planeCachePixels + 25752},
+{153, 14, planeCachePixels + 25775}, {178, 5, planeCachePixels + 25789}, {207, 29, planeCachePixels + 25794}, {152, 16, planeCachePixels + 25823},
+{171, 13, planeCachePixels + 25839}, {200, 28, planeCachePixels + 25852}, {151, 27, planeCachePixels + 25880}, {193, 30, planeCachePixels + 25907},
+{150, 26, planeCachePixels + 25937}, {185, 36, planeCachePixels + 25963}, {150, 21, planeCachePixels + 25999}, {178, 36, planeCachePixels + 26020},
+{142, 27, planeCachePixels + 26056}, {171, 36, planeCachePixels + 26083}, {136, 64, planeCachePixels + 26119}, {136, 7, planeCachePixels + 26183},
+{144, 6, planeCachePixels + 26190}, {151, 49, planeCachePixels + 26196}, {150, 43, planeCachePixels + 26245}, {143, 43, planeCachePixels + 26288},
+{136, 50, planeCachePixels + 26331}, {129, 50, planeCachePixels + 26381}, {121, 51, planeCachePixels + 26431}, {114, 53, planeCachePixels + 26482},
+{107, 59, planeCachePixels + 26535}, {100, 50, planeCachePixels + 26594}, {155, 10, planeCachePixels + 26644}, {93, 43, planeCachePixels + 26654},
+{137, 6, planeCachePixels + 26697}, {157, 1, planeCachePixels + 26703}, {159, 5, planeCachePixels + 26704}, {86, 36, planeCachePixels + 26709},
+{123, 6, planeCachePixels + 26745}, {79, 36, planeCachePixels + 26751}, {78, 22, planeCachePixels + 26787}, {103, 5, planeCachePixels + 26809},
+{78, 8, planeCachePixels + 26814}, {89, 4, planeCachePixels + 26822}, {78, 1, planeCachePixels + 26826}, {156, 2, planeCachePixels + 26827},
+{156, 2, planeCachePixels + 26829}, {157, 2, planeCachePixels + 26831}, {157, 2, planeCachePixels + 26833}, {157, 2, planeCachePixels + 26835},
+{157, 2, planeCachePixels + 26837}, {157, 2, planeCachePixels + 26839}, {157, 2, planeCachePixels + 26841}, {157, 2, planeCachePixels + 26843},
+{157, 2, planeCachePixels + 26845}, {158, 2, planeCachePixels + 26847}, {158, 2, planeCachePixels + 26849}, {158, 3, planeCachePixels + 26851},
+{157, 4, planeCachePixels + 26854}, {238, 5, planeCachePixels + 26858}, {156, 7, planeCachePixels + 26863}, {164, 1, planeCachePixels + 26870},
+{230, 13, planeCachePixels + 26871}, {155, 11, planeCachePixels + 26884}, {222, 21, planeCachePixels + 26895}, {153, 14, planeCachePixels + 26916},
+{181, 2, planeCachePixels + 26930}, {213, 25, planeCachePixels + 26932}, {152, 16, planeCachePixels + 26957}, {173, 11, planeCachePixels + 26973},
+{205, 32, planeCachePixels + 26984}, {151, 30, planeCachePixels + 27016}, {197, 33, planeCachePixels + 27046}, {151, 25, planeCachePixels + 27079},
+{189, 34, planeCachePixels + 27104}, {148, 25, planeCachePixels + 27138}, {181, 41, planeCachePixels + 27163}, {140, 29, planeCachePixels + 27204},
+{173, 41, planeCachePixels + 27233}, {136, 70, planeCachePixels + 27274}, {136, 4, planeCachePixels + 27344}, {144, 4, planeCachePixels + 27348},
+{151, 49, planeCachePixels + 27352}, {148, 50, planeCachePixels + 27401}, {140, 49, planeCachePixels + 27451}, {132, 54, planeCachePixels + 27500},
+{124, 57, planeCachePixels + 27554}, {116, 57, planeCachePixels + 27611}, {108, 59, planeCachePixels + 27668}, {99, 67, planeCachePixels + 27727},
+{91, 58, planeCachePixels + 27794}, {155, 10, planeCachePixels + 27852}, {83, 49, planeCachePixels + 27862}, {137, 4, planeCachePixels + 27911},
+{159, 5, planeCachePixels + 27915}, {78, 38, planeCachePixels + 27920}, {123, 1, planeCachePixels + 27958}, {78, 22, planeCachePixels + 27959},
+{103, 5, planeCachePixels + 27981}, {78, 5, planeCachePixels + 27986}, {89, 3, planeCachePixels + 27991}, {157, 2, planeCachePixels + 27994},
+{157, 2, planeCachePixels + 27996}, {157, 2, planeCachePixels + 27998}, {157, 2, planeCachePixels + 28000}, {157, 2, planeCachePixels + 28002},
+{157, 2, planeCachePixels + 28004}, {157, 2, planeCachePixels + 28006}, {157, 2, planeCachePixels + 28008}, {158, 2, planeCachePixels + 28010},
+{158, 2, planeCachePixels + 28012}, {158, 2, planeCachePixels + 28014}, {158, 2, planeCachePixels + 28016}, {158, 3, planeCachePixels + 28018},
+{157, 4, planeCachePixels + 28021}, {155, 8, planeCachePixels + 28025}, {241, 2, planeCachePixels + 28033}, {155, 11, planeCachePixels + 28035},
+{232, 11, planeCachePixels + 28046}, {153, 14, planeCachePixels + 28057}, {222, 21, planeCachePixels + 28071}, {152, 17, planeCachePixels + 28092},
+{175, 9, planeCachePixels + 28109}, {213, 29, planeCachePixels + 28118}, {152, 32, planeCachePixels + 28147}, {203, 34, planeCachePixels + 28179},
+{151, 25, planeCachePixels + 28213}, {194, 38, planeCachePixels + 28238}, {146, 29, planeCachePixels + 28276}, {184, 39, planeCachePixels + 28305},
+{137, 32, planeCachePixels + 28344}, {175, 48, planeCachePixels + 28376}, {136, 77, planeCachePixels + 28424}, {136, 1, planeCachePixels + 28501},
+{144, 2, planeCachePixels + 28502}, {151, 53, planeCachePixels + 28504}, {146, 54, planeCachePixels + 28557}, {137, 57, planeCachePixels + 28611},
+{127, 59, planeCachePixels + 28668}, {118, 67, planeCachePixels + 28727}, {108, 67, planeCachePixels + 28794}, {99, 68, planeCachePixels + 28861},
+{89, 77, planeCachePixels + 28929}, {80, 67, planeCachePixels + 29006}, {155, 1, planeCachePixels + 29073}, {157, 9, planeCachePixels + 29074},
+{78, 40, planeCachePixels + 29083}, {123, 5, planeCachePixels + 29123}, {159, 5, planeCachePixels + 29128}, {78, 21, planeCachePixels + 29133},
+{103, 5, planeCachePixels + 29154}, {78, 2, planeCachePixels + 29159}, {157, 2, planeCachePixels + 29161}, {157, 2, planeCachePixels + 29163},
+{157, 2, planeCachePixels + 29165}, {157, 2, planeCachePixels + 29167}, {157, 2, planeCachePixels + 29169}, {158, 2, planeCachePixels + 29171},
+{158, 2, planeCachePixels + 29173}, {158, 2, planeCachePixels + 29175}, {158, 2, planeCachePixels + 29177}, {158, 2, planeCachePixels + 29179},
+{158, 2, planeCachePixels + 29181}, {158, 2, planeCachePixels + 29183}, {158, 3, planeCachePixels + 29185}, {157, 4, planeCachePixels + 29188},
+{155, 8, planeCachePixels + 29192}, {154, 11, planeCachePixels + 29200}, {153, 15, planeCachePixels + 29211}, {235, 8, planeCachePixels + 29226},
+{153, 16, planeCachePixels + 29234}, {177, 7, planeCachePixels + 29250}, {223, 20, planeCachePixels + 29257}, {152, 32, planeCachePixels + 29277},
+{212, 31, planeCachePixels + 29309}, {151, 27, planeCachePixels + 29340}, {201, 36, planeCachePixels + 29367}, {143, 33, planeCachePixels + 29403},
+{189, 46, planeCachePixels + 29436}, {136, 33, planeCachePixels + 29482}, {178, 46, planeCachePixels + 29515}, {136, 7, planeCachePixels + 29561},
+{144, 79, planeCachePixels + 29568}, {151, 61, planeCachePixels + 29647}, {143, 58, planeCachePixels + 29708}, {132, 68, planeCachePixels + 29766},
+{121, 68, planeCachePixels + 29834}, {109, 77, planeCachePixels + 29902}, {98, 80, planeCachePixels + 29979}, {86, 81, planeCachePixels + 30059},
+{77, 90, planeCachePixels + 30140}, {77, 44, planeCachePixels + 30230}, {123, 9, planeCachePixels + 30274}, {137, 7, planeCachePixels + 30283},
+{157, 9, planeCachePixels + 30290}, {78, 8, planeCachePixels + 30299}, {89, 9, planeCachePixels + 30307}, {103, 6, planeCachePixels + 30316},
+{159, 5, planeCachePixels + 30322}, {157, 2, planeCachePixels + 30327}, {158, 2, planeCachePixels + 30329}, {158, 2, planeCachePixels + 30331},
+{158, 2, planeCachePixels + 30333}, {158, 2, planeCachePixels + 30335}, {158, 2, planeCachePixels + 30337}, {158, 2, planeCachePixels + 30339},
+{158, 2, planeCachePixels + 30341}, {158, 2, planeCachePixels + 30343}, {158, 2, planeCachePixels + 30345}, {158, 2, planeCachePixels + 30347},
+{158, 2, planeCachePixels + 30349}, {158, 3, planeCachePixels + 30351}, {157, 4, planeCachePixels + 30354}, {155, 8, planeCachePixels + 30358},
+{153, 13, planeCachePixels + 30366}, {153, 15, planeCachePixels + 30379}, {153, 16, planeCachePixels + 30394}, {182, 2, planeCachePixels + 30410},
+{239, 4, planeCachePixels + 30412}, {152, 32, planeCachePixels + 30416}, {225, 18, planeCachePixels + 30448}, {151, 31, planeCachePixels + 30466},
+{211, 32, planeCachePixels + 30497}, {139, 37, planeCachePixels + 30529}, {196, 43, planeCachePixels + 30566}, {136, 33, planeCachePixels + 30609},
+{182, 55, planeCachePixels + 30642}, {136, 3, planeCachePixels + 30697}, {144, 81, planeCachePixels + 30700}, {151, 72, planeCachePixels + 30781},
+{139, 72, planeCachePixels + 30853}, {125, 75, planeCachePixels + 30925}, {110, 86, planeCachePixels + 31000}, {96, 89, planeCachePixels + 31086},
+{82, 100, planeCachePixels + 31175}, {77, 91, planeCachePixels + 31275}, {77, 77, planeCachePixels + 31366}, {155, 12, planeCachePixels + 31443},
+{77, 5, planeCachePixels + 31455}, {88, 8, planeCachePixels + 31460}, {102, 9, planeCachePixels + 31468}, {123, 2, planeCachePixels + 31477},
+{137, 2, planeCachePixels + 31479}, {157, 9, planeCachePixels + 31481}, {159, 5, planeCachePixels + 31490}, {158, 2, planeCachePixels + 31495},
+{158, 2, planeCachePixels + 31497}, {158, 2, planeCachePixels + 31499}, {158, 2, planeCachePixels + 31501}, {158, 2, planeCachePixels + 31503},
+{158, 2, planeCachePixels + 31505}, {158, 2, planeCachePixels + 31507}, {158, 2, planeCachePixels + 31509}, {158, 2, planeCachePixels + 31511},
+{158, 2, planeCachePixels + 31513}, {158, 2, planeCachePixels + 31515}, {158, 2, planeCachePixels + 31517}, {158, 3, planeCachePixels + 31519},
+{158, 4, planeCachePixels + 31522}, {156, 8, planeCachePixels + 31526}, {154, 12, planeCachePixels + 31534}, {153, 14, planeCachePixels + 31546},
+{152, 16, planeCachePixels + 31560}, {151, 18, planeCachePixels + 31576}, {170, 14, planeCachePixels + 31594}, {151, 33, planeCachePixels + 31608},
+{227, 16, planeCachePixels + 31641}, {136, 40, planeCachePixels + 31657}, {208, 35, planeCachePixels + 31697}, {136, 34, planeCachePixels + 31732},
+{189, 54, planeCachePixels + 31766}, {144, 25, planeCachePixels + 31820}, {170, 67, planeCachePixels + 31845}, {151, 76, planeCachePixels + 31912},
+{132, 91, planeCachePixels + 31988}, {113, 95, planeCachePixels + 32079}, {94, 106, planeCachePixels + 32174}, {77, 112, planeCachePixels + 32280},
+{77, 108, planeCachePixels + 32392}, {77, 93, planeCachePixels + 32500}, {88, 6, planeCachePixels + 32593}, {102, 11, planeCachePixels + 32599},
+{122, 10, planeCachePixels + 32610}, {136, 15, planeCachePixels + 32620}, {154, 12, planeCachePixels + 32635}, {156, 9, planeCachePixels + 32647},
+{159, 5, planeCachePixels + 32656}, {158, 2, planeCachePixels + 32661}, {158, 2, planeCachePixels + 32663}, {158, 2, planeCachePixels + 32665},
+{158, 2, planeCachePixels + 32667}, {158, 2, planeCachePixels + 32669}, {158, 2, planeCachePixels + 32671}, {158, 2, planeCachePixels + 32673},
+{158, 2, planeCachePixels + 32675}, {159, 2, planeCachePixels + 32677}, {159, 2, planeCachePixels + 32679}, {159, 2, planeCachePixels + 32681},
+{159, 2, planeCachePixels + 32683}, {159, 3, planeCachePixels + 32685}, {158, 4, planeCachePixels + 32688}, {156, 8, planeCachePixels + 32692},
+{154, 12, planeCachePixels + 32700}, {153, 14, planeCachePixels + 32712}, {152, 16, planeCachePixels + 32726}, {151, 18, planeCachePixels + 32742},
+{175, 9, planeCachePixels + 32760}, {146, 38, planeCachePixels + 32769}, {136, 40, planeCachePixels + 32807}, {232, 11, planeCachePixels + 32847},
+{136, 39, planeCachePixels + 32858}, {203, 40, planeCachePixels + 32897}, {144, 2, planeCachePixels + 32937}, {151, 18, planeCachePixels + 32939},
+{175, 68, planeCachePixels + 32957}, {146, 91, planeCachePixels + 33025}, {118, 114, planeCachePixels + 33116}, {89, 134, planeCachePixels + 33230},
+{77, 127, planeCachePixels + 33364}, {77, 123, planeCachePixels + 33491}, {77, 108, planeCachePixels + 33614}, {88, 1, planeCachePixels + 33722},
+{102, 16, planeCachePixels + 33723}, {122, 53, planeCachePixels + 33739}, {136, 10, planeCachePixels + 33792}, {154, 12, planeCachePixels + 33802},
+{156, 9, planeCachePixels + 33814}, {158, 5, planeCachePixels + 33823}, {159, 2, planeCachePixels + 33828}, {159, 2, planeCachePixels + 33830},
+{159, 2, planeCachePixels + 33832}, {159, 2, planeCachePixels + 33834}, {159, 2, planeCachePixels + 33836}, {159, 2, planeCachePixels + 33838},
+{159, 2, planeCachePixels + 33840}, {159, 2, planeCachePixels + 33842}, {159, 2, planeCachePixels + 33844}, {159, 2, planeCachePixels + 33846},
+{159, 2, planeCachePixels + 33848}, {159, 2, planeCachePixels + 33850}, {159, 3, planeCachePixels + 33852}, {158, 4, planeCachePixels + 33855},
+{156, 8, planeCachePixels + 33859}, {154, 12, planeCachePixels + 33867}, {153, 14, planeCachePixels + 33879}, {152, 16, planeCachePixels + 33893},
+{151, 18, planeCachePixels + 33909}, {136, 48, planeCachePixels + 33927}, {136, 48, planeCachePixels + 33975}, {144, 32, planeCachePixels + 34023},
+{151, 18, planeCachePixels + 34055}, {189, 54, planeCachePixels + 34073}, {132, 111, planeCachePixels + 34127}, {77, 166, planeCachePixels + 34238},
+{77, 160, planeCachePixels + 34404}, {77, 146, planeCachePixels + 34564}, {88, 112, planeCachePixels + 34710}, {102, 87, planeCachePixels + 34822},
+{122, 10, planeCachePixels + 34909}, {136, 49, planeCachePixels + 34919}, {154, 12, planeCachePixels + 34968}, {156, 9, planeCachePixels + 34980},
+{158, 5, planeCachePixels + 34989}, {159, 2, planeCachePixels + 34994}, {159, 2, planeCachePixels + 34996}, {159, 2, planeCachePixels + 34998},
+{159, 2, planeCachePixels + 35000}, {159, 2, planeCachePixels + 35002}, {159, 2, planeCachePixels + 35004}, {159, 2, planeCachePixels + 35006},
+{159, 2, planeCachePixels + 35008}, {159, 2, planeCachePixels + 35010}, {159, 2, planeCachePixels + 35012}, {159, 2, planeCachePixels + 35014},
+{159, 2, planeCachePixels + 35016}, {159, 3, planeCachePixels + 35018}, {158, 4, planeCachePixels + 35021}, {156, 8, planeCachePixels + 35025},
+{154, 12, planeCachePixels + 35033}, {153, 14, planeCachePixels + 35045}, {152, 16, planeCachePixels + 35059}, {151, 18, planeCachePixels + 35075},
+{136, 48, planeCachePixels + 35093}, {136, 48, planeCachePixels + 35141}, {144, 32, planeCachePixels + 35189}, {151, 18, planeCachePixels + 35221},
+{77, 166, planeCachePixels + 35239}, {77, 166, planeCachePixels + 35405}, {77, 166, planeCachePixels + 35571}, {88, 149, planeCachePixels + 35737},
+{102, 121, planeCachePixels + 35886}, {122, 78, planeCachePixels + 36007}, {136, 49, planeCachePixels + 36085}, {154, 12, planeCachePixels + 36134},
+{156, 9, planeCachePixels + 36146}, {158, 5, planeCachePixels + 36155}, {159, 2, planeCachePixels + 36160}, {159, 2, planeCachePixels + 36162},
+{159, 2, planeCachePixels + 36164}, {159, 2, planeCachePixels + 36166}, {159, 2, planeCachePixels + 36168}, {159, 2, planeCachePixels + 36170},
+{159, 2, planeCachePixels + 36172}, {159, 2, planeCachePixels + 36174}, {159, 2, planeCachePixels + 36176}, {159, 2, planeCachePixels + 36178},
+{159, 2, planeCachePixels + 36180}, {159, 2, planeCachePixels + 36182}, {159, 3, planeCachePixels + 36184}, {158, 4, planeCachePixels + 36187},
+{156, 8, planeCachePixels + 36191}, {154, 12, planeCachePixels + 36199}, {153, 14, planeCachePixels + 36211}, {152, 16, planeCachePixels + 36225},
+{151, 18, planeCachePixels + 36241}, {136, 48, planeCachePixels + 36259}, {136, 48, planeCachePixels + 36307}, {144, 32, planeCachePixels + 36355},
+{77, 55, planeCachePixels + 36387}, {151, 18, planeCachePixels + 36442}, {77, 112, planeCachePixels + 36460}, {77, 166, planeCachePixels + 36572},
+{88, 155, planeCachePixels + 36738}, {102, 141, planeCachePixels + 36893}, {122, 115, planeCachePixels + 37034}, {132, 91, planeCachePixels + 37149},
+{136, 49, planeCachePixels + 37240}, {189, 11, planeCachePixels + 37289}, {154, 12, planeCachePixels + 37300}, {156, 9, planeCachePixels + 37312},
+{158, 5, planeCachePixels + 37321}, {160, 2, planeCachePixels + 37326}, {160, 2, planeCachePixels + 37328}, {160, 2, planeCachePixels + 37330},
+{160, 2, planeCachePixels + 37332}, {160, 2, planeCachePixels + 37334}, {160, 2, planeCachePixels + 37336}, {160, 2, planeCachePixels + 37338},
+{160, 2, planeCachePixels + 37340}, {159, 2, planeCachePixels + 37342}, {159, 2, planeCachePixels + 37344}, {159, 2, planeCachePixels + 37346},
+{159, 2, planeCachePixels + 37348}, {159, 3, planeCachePixels + 37350}, {158, 4, planeCachePixels + 37353}, {156, 8, planeCachePixels + 37357},
+{154, 12, planeCachePixels + 37365}, {153, 14, planeCachePixels + 37377}, {152, 16, planeCachePixels + 37391}, {136, 10, planeCachePixels + 37407},
+{151, 18, planeCachePixels + 37417}, {136, 39, planeCachePixels + 37435}, {77, 12, planeCachePixels + 37474}, {144, 40, planeCachePixels + 37486},
+{77, 41, planeCachePixels + 37526}, {146, 38, planeCachePixels + 37567}, {77, 69, planeCachePixels + 37605}, {151, 18, planeCachePixels + 37674},
+{175, 1, planeCachePixels + 37692}, {88, 87, planeCachePixels + 37693}, {89, 114, planeCachePixels + 37780}, {102, 130, planeCachePixels + 37894},
+{117, 126, planeCachePixels + 38024}, {122, 121, planeCachePixels + 38150}, {136, 107, planeCachePixels + 38271}, {146, 54, planeCachePixels + 38378},
+{203, 20, planeCachePixels + 38432}, {232, 5, planeCachePixels + 38452}, {154, 12, planeCachePixels + 38457}, {175, 10, planeCachePixels + 38469},
+{156, 9, planeCachePixels + 38479}, {158, 5, planeCachePixels + 38488}, {160, 2, planeCachePixels + 38493}, {160, 2, planeCachePixels + 38495},
+{160, 2, planeCachePixels + 38497}, {160, 2, planeCachePixels + 38499}, {160, 2, planeCachePixels + 38501}, {160, 2, planeCachePixels + 38503},
+{160, 2, planeCachePixels + 38505}, {160, 2, planeCachePixels + 38507}, {160, 2, planeCachePixels + 38509}, {160, 2, planeCachePixels + 38511},
+{160, 2, planeCachePixels + 38513}, {160, 2, planeCachePixels + 38515}, {160, 3, planeCachePixels + 38517}, {158, 4, planeCachePixels + 38520},
+{156, 8, planeCachePixels + 38524}, {154, 12, planeCachePixels + 38532}, {153, 14, planeCachePixels + 38544}, {152, 16, planeCachePixels + 38558},
+{136, 33, planeCachePixels + 38574}, {77, 17, planeCachePixels + 38607}, {136, 34, planeCachePixels + 38624}, {77, 36, planeCachePixels + 38658},
+{144, 40, planeCachePixels + 38694}, {77, 55, planeCachePixels + 38734}, {151, 33, planeCachePixels + 38789}, {88, 81, planeCachePixels + 38822},
+{170, 6, planeCachePixels + 38903}, {94, 76, planeCachePixels + 38909}, {102, 87, planeCachePixels + 38985}, {113, 95, planeCachePixels + 39072},
+{122, 105, planeCachePixels + 39167}, {132, 111, planeCachePixels + 39272}, {136, 107, planeCachePixels + 39383}, {151, 92, planeCachePixels + 39490},
+{154, 12, planeCachePixels + 39582}, {170, 15, planeCachePixels + 39594}, {189, 11, planeCachePixels + 39609}, {208, 15, planeCachePixels + 39620},
+{227, 10, planeCachePixels + 39635}, {156, 9, planeCachePixels + 39645}, {157, 5, planeCachePixels + 39654}, {161, 2, planeCachePixels + 39659},
+{160, 2, planeCachePixels + 39661}, {160, 2, planeCachePixels + 39663}, {160, 2, planeCachePixels + 39665}, {160, 2, planeCachePixels + 39667},
+{160, 2, planeCachePixels + 39669}, {160, 2, planeCachePixels + 39671}, {160, 2, planeCachePixels + 39673}, {160, 2, planeCachePixels + 39675},
+{160, 2, planeCachePixels + 39677}, {160, 2, planeCachePixels + 39679}, {160, 2, planeCachePixels + 39681}, {160, 3, planeCachePixels + 39683},
+{159, 4, planeCachePixels + 39686}, {157, 8, planeCachePixels + 39690}, {153, 14, planeCachePixels + 39698}, {152, 15, planeCachePixels + 39712},
+{77, 5, planeCachePixels + 39727}, {136, 3, planeCachePixels + 39732}, {151, 17, planeCachePixels + 39735}, {77, 19, planeCachePixels + 39752},
+{136, 32, planeCachePixels + 39771}, {77, 33, planeCachePixels + 39803}, {139, 30, planeCachePixels + 39836}, {82, 43, planeCachePixels + 39866},
+{144, 38, planeCachePixels + 39909}, {88, 51, planeCachePixels + 39947}, {151, 33, planeCachePixels + 39998}, {96, 80, planeCachePixels + 40031},
+{182, 2, planeCachePixels + 40111}, {102, 67, planeCachePixels + 40113}, {110, 72, planeCachePixels + 40180}, {122, 74, planeCachePixels + 40252},
+{125, 86, planeCachePixels + 40326}, {136, 89, planeCachePixels + 40412}, {139, 100, planeCachePixels + 40501}, {153, 90, planeCachePixels + 40601},
+{153, 12, planeCachePixels + 40691}, {167, 76, planeCachePixels + 40703}, {155, 9, planeCachePixels + 40779}, {182, 2, planeCachePixels + 40788},
+{196, 3, planeCachePixels + 40790}, {210, 13, planeCachePixels + 40793}, {225, 12, planeCachePixels + 40806}, {239, 4, planeCachePixels + 40818},
+{157, 5, planeCachePixels + 40822}, {161, 2, planeCachePixels + 40827}, {161, 2, planeCachePixels + 40829}, {161, 2, planeCachePixels + 40831},
+{161, 2, planeCachePixels + 40833}, {161, 2, planeCachePixels + 40835}, {160, 2, planeCachePixels + 40837}, {160, 2, planeCachePixels + 40839},
+{160, 2, planeCachePixels + 40841}, {160, 2, planeCachePixels + 40843}, {160, 2, planeCachePixels + 40845}, {160, 2, planeCachePixels + 40847},
+{160, 2, planeCachePixels + 40849}, {160, 3, planeCachePixels + 40851}, {159, 4, planeCachePixels + 40854}, {157, 8, planeCachePixels + 40858},
+{154, 13, planeCachePixels + 40866}, {77, 9, planeCachePixels + 40879}, {152, 15, planeCachePixels + 40888}, {77, 21, planeCachePixels + 40903},
+{136, 8, planeCachePixels + 40924}, {151, 16, planeCachePixels + 40932}, {77, 32, planeCachePixels + 40948}, {136, 32, planeCachePixels + 40980},
+{86, 34, planeCachePixels + 41012}, {143, 26, planeCachePixels + 41046}, {88, 44, planeCachePixels + 41072}, {144, 34, planeCachePixels + 41116},
+{97, 46, planeCachePixels + 41150}, {151, 33, planeCachePixels + 41196}, {102, 74, planeCachePixels + 41229}, {178, 6, planeCachePixels + 41303},
+{109, 60, planeCachePixels + 41309}, {120, 58, planeCachePixels + 41369}, {122, 67, planeCachePixels + 41427}, {132, 68, planeCachePixels + 41494},
+{135, 77, planeCachePixels + 41562}, {143, 80, planeCachePixels + 41639}, {153, 82, planeCachePixels + 41719}, {154, 11, planeCachePixels + 41801},
+{166, 77, planeCachePixels + 41812}, {155, 9, planeCachePixels + 41889}, {177, 7, planeCachePixels + 41898}, {189, 10, planeCachePixels + 41905},
+{200, 43, planeCachePixels + 41915}, {157, 5, planeCachePixels + 41958}, {212, 10, planeCachePixels + 41963}, {223, 19, planeCachePixels + 41973},
+{235, 1, planeCachePixels + 41992}, {161, 2, planeCachePixels + 41993}, {161, 2, planeCachePixels + 41995}, {161, 2, planeCachePixels + 41997},
+{161, 2, planeCachePixels + 41999}, {161, 2, planeCachePixels + 42001}, {161, 2, planeCachePixels + 42003}, {161, 2, planeCachePixels + 42005},
+{161, 2, planeCachePixels + 42007}, {160, 2, planeCachePixels + 42009}, {160, 2, planeCachePixels + 42011}, {160, 2, planeCachePixels + 42013},
+{160, 2, planeCachePixels + 42015}, {160, 3, planeCachePixels + 42017}, {159, 4, planeCachePixels + 42020}, {77, 3, planeCachePixels + 42024},
+{155, 1, planeCachePixels + 42027}, {157, 8, planeCachePixels + 42028}, {77, 12, planeCachePixels + 42036}, {154, 12, planeCachePixels + 42048},
+{77, 22, planeCachePixels + 42060}, {136, 1, planeCachePixels + 42082}, {153, 14, planeCachePixels + 42083}, {79, 29, planeCachePixels + 42097},
+{136, 10, planeCachePixels + 42126}, {151, 17, planeCachePixels + 42136}, {88, 30, planeCachePixels + 42153}, {137, 31, planeCachePixels + 42183},
+{89, 38, planeCachePixels + 42214}, {144, 25, planeCachePixels + 42252}, {98, 39, planeCachePixels + 42277}, {146, 29, planeCachePixels + 42316},
+{102, 44, planeCachePixels + 42345}, {151, 33, planeCachePixels + 42389}, {108, 76, planeCachePixels + 42422}, {117, 52, planeCachePixels + 42498},
+{175, 1, planeCachePixels + 42550}, {122, 53, planeCachePixels + 42551}, {127, 57, planeCachePixels + 42604}, {135, 59, planeCachePixels + 42661},
+{136, 67, planeCachePixels + 42720}, {146, 67, planeCachePixels + 42787}, {153, 69, planeCachePixels + 42854}, {155, 77, planeCachePixels + 42923},
+{155, 9, planeCachePixels + 43000}, {174, 67, planeCachePixels + 43009}, {157, 5, planeCachePixels + 43076}, {193, 6, planeCachePixels + 43081},
+{203, 39, planeCachePixels + 43087}, {213, 29, planeCachePixels + 43126}, {232, 4, planeCachePixels + 43155}, {241, 1, planeCachePixels + 43159},
+{162, 2, planeCachePixels + 43160}, {162, 2, planeCachePixels + 43162}, {161, 2, planeCachePixels + 43164}, {161, 2, planeCachePixels + 43166},
+{161, 2, planeCachePixels + 43168}, {161, 2, planeCachePixels + 43170}, {161, 2, planeCachePixels + 43172}, {161, 2, planeCachePixels + 43174},
+{161, 2, planeCachePixels + 43176}, {161, 2, planeCachePixels + 43178}, {160, 2, planeCachePixels + 43180}, {160, 2, planeCachePixels + 43182},
+{160, 3, planeCachePixels + 43184}, {77, 6, planeCachePixels + 43187}, {159, 4, planeCachePixels + 43193}, {77, 14, planeCachePixels + 43197},
+{155, 10, planeCachePixels + 43211}, {77, 22, planeCachePixels + 43221}, {154, 11, planeCachePixels + 43243}, {83, 25, planeCachePixels + 43254},
+{137, 3, planeCachePixels + 43279}, {153, 14, planeCachePixels + 43282}, {88, 28, planeCachePixels + 43296}, {136, 12, planeCachePixels + 43324},
+{152, 16, planeCachePixels + 43336}, {91, 33, planeCachePixels + 43352}, {140, 29, planeCachePixels + 43385}, {99, 33, planeCachePixels + 43414},
+{144, 25, planeCachePixels + 43447}, {102, 38, planeCachePixels + 43472}, {148, 25, planeCachePixels + 43510}, {107, 41, planeCachePixels + 43535},
+{151, 30, planeCachePixels + 43576}, {115, 69, planeCachePixels + 43606}, {122, 47, planeCachePixels + 43675}, {173, 3, planeCachePixels + 43722},
+{181, 3, planeCachePixels + 43725}, {123, 50, planeCachePixels + 43728}, {132, 49, planeCachePixels + 43778}, {135, 54, planeCachePixels + 43827},
+{140, 57, planeCachePixels + 43881}, {148, 57, planeCachePixels + 43938}, {153, 60, planeCachePixels + 43995}, {155, 67, planeCachePixels + 44055},
+{156, 9, planeCachePixels + 44122}, {172, 58, planeCachePixels + 44131}, {157, 5, planeCachePixels + 44189}, {180, 4, planeCachePixels + 44194},
+{189, 49, planeCachePixels + 44198}, {197, 2, planeCachePixels + 44247}, {205, 37, planeCachePixels + 44249}, {213, 29, planeCachePixels + 44286},
+{221, 1, planeCachePixels + 44315}, {229, 7, planeCachePixels + 44316}, {238, 4, planeCachePixels + 44323}, {162, 2, planeCachePixels + 44327},
+{162, 2, planeCachePixels + 44329}, {162, 2, planeCachePixels + 44331}, {162, 2, planeCachePixels + 44333}, {162, 2, planeCachePixels + 44335},
+{161, 2, planeCachePixels + 44337}, {161, 2, planeCachePixels + 44339}, {161, 2, planeCachePixels + 44341}, {161, 2, planeCachePixels + 44343},
+{161, 2, planeCachePixels + 44345}, {161, 2, planeCachePixels + 44347}, {78, 1, planeCachePixels + 44349}, {161, 2, planeCachePixels + 44350},
+{78, 8, planeCachePixels + 44352}, {160, 3, planeCachePixels + 44360}, {77, 16, planeCachePixels + 44363}, {157, 1, planeCachePixels + 44379},
+{159, 4, planeCachePixels + 44380}, {78, 22, planeCachePixels + 44384}, {155, 10, planeCachePixels + 44406}, {86, 21, planeCachePixels + 44416},
+{154, 11, planeCachePixels + 44437}, {88, 26, planeCachePixels + 44448}, {137, 6, planeCachePixels + 44474}, {153, 14, planeCachePixels + 44480},
+{93, 28, planeCachePixels + 44494}, {136, 14, planeCachePixels + 44522}, {152, 16, planeCachePixels + 44536}, {100, 28, planeCachePixels + 44552},
+{143, 26, planeCachePixels + 44580}, {102, 34, planeCachePixels + 44606}, {144, 26, planeCachePixels + 44640}, {107, 36, planeCachePixels + 44666},
+{150, 21, planeCachePixels + 44702}, {114, 36, planeCachePixels + 44723}, {151, 28, planeCachePixels + 44759}, {121, 63, planeCachePixels + 44787},
+{121, 48, planeCachePixels + 44850}, {171, 5, planeCachePixels + 44898}, {178, 6, planeCachePixels + 44903}, {128, 43, planeCachePixels + 44909},
+{135, 43, planeCachePixels + 44952}, {135, 50, planeCachePixels + 44995}, {142, 50, planeCachePixels + 45045}, {149, 51, planeCachePixels + 45095},
+{153, 54, planeCachePixels + 45146}, {155, 59, planeCachePixels + 45200}, {156, 9, planeCachePixels + 45259}, {171, 50, planeCachePixels + 45268},
+{157, 5, planeCachePixels + 45318}, {163, 1, planeCachePixels + 45323}, {178, 6, planeCachePixels + 45324}, {185, 43, planeCachePixels + 45330},
+{192, 43, planeCachePixels + 45373}, {206, 36, planeCachePixels + 45416}, {213, 29, planeCachePixels + 45452}, {221, 1, planeCachePixels + 45481},
+{228, 14, planeCachePixels + 45482}, {235, 1, planeCachePixels + 45496}, {162, 2, planeCachePixels + 45497}, {162, 2, planeCachePixels + 45499},
+{162, 2, planeCachePixels + 45501}, {162, 2, planeCachePixels + 45503}, {162, 2, planeCachePixels + 45505}, {162, 2, planeCachePixels + 45507},
+{162, 2, planeCachePixels + 45509}, {161, 2, planeCachePixels + 45511}, {161, 2, planeCachePixels + 45513}, {161, 2, planeCachePixels + 45515},
+{78, 4, planeCachePixels + 45517}, {161, 2, planeCachePixels + 45521}, {78, 10, planeCachePixels + 45523}, {161, 2, planeCachePixels + 45533},
+{78, 16, planeCachePixels + 45535}, {161, 3, planeCachePixels + 45551}, {81, 19, planeCachePixels + 45554}, {157, 1, planeCachePixels + 45573},
+{159, 4, planeCachePixels + 45574}, {88, 19, planeCachePixels + 45578}, {155, 9, planeCachePixels + 45597}, {88, 25, planeCachePixels + 45606},
+{137, 2, planeCachePixels + 45631}, {154, 11, planeCachePixels + 45633}, {94, 25, planeCachePixels + 45644}, {137, 8, planeCachePixels + 45669},
+{153, 14, planeCachePixels + 45677}, {100, 26, planeCachePixels + 45691}, {139, 12, planeCachePixels + 45717}, {152, 16, planeCachePixels + 45729},
+{102, 30, planeCachePixels + 45745}, {144, 25, planeCachePixels + 45775}, {106, 32, planeCachePixels + 45800}, {145, 25, planeCachePixels + 45832},
+{113, 32, planeCachePixels + 45857}, {151, 19, planeCachePixels + 45889}, {119, 58, planeCachePixels + 45908}, {122, 61, planeCachePixels + 45966},
+{125, 44, planeCachePixels + 46027}, {170, 14, planeCachePixels + 46071}, {132, 38, planeCachePixels + 46085}, {183, 1, planeCachePixels + 46123},
+{135, 41, planeCachePixels + 46124}, {138, 45, planeCachePixels + 46165}, {144, 45, planeCachePixels + 46210}, {150, 45, planeCachePixels + 46255},
+{153, 49, planeCachePixels + 46300}, {155, 53, planeCachePixels + 46349}, {157, 8, planeCachePixels + 46402}, {169, 45, planeCachePixels + 46410},
+{157, 4, planeCachePixels + 46455}, {176, 44, planeCachePixels + 46459}, {182, 2, planeCachePixels + 46503}, {188, 39, planeCachePixels + 46505},
+{195, 4, planeCachePixels + 46544}, {201, 32, planeCachePixels + 46548}, {207, 32, planeCachePixels + 46580}, {214, 28, planeCachePixels + 46612},
+{220, 1, planeCachePixels + 46640}, {226, 16, planeCachePixels + 46641}, {233, 2, planeCachePixels + 46657}, {239, 2, planeCachePixels + 46659},
+{163, 2, planeCachePixels + 46661}, {163, 2, planeCachePixels + 46663}, {163, 2, planeCachePixels + 46665}, {162, 2, planeCachePixels + 46667},
+{162, 2, planeCachePixels + 46669}, {162, 2, planeCachePixels + 46671}, {162, 2, planeCachePixels + 46673}, {162, 2, planeCachePixels + 46675},
+{161, 2, planeCachePixels + 46677}, {78, 6, planeCachePixels + 46679}, {161, 2, planeCachePixels + 46685}, {78, 12, planeCachePixels + 46687},
+{161, 2, planeCachePixels + 46699}, {78, 17, planeCachePixels + 46701}, {161, 2, planeCachePixels + 46718}, {84, 17, planeCachePixels + 46720},
+{161, 3, planeCachePixels + 46737}, {88, 19, planeCachePixels + 46740}, {160, 4, planeCachePixels + 46759}, {89, 23, planeCachePixels + 46763},
+{155, 9, planeCachePixels + 46786}, {95, 23, planeCachePixels + 46795}, {137, 4, planeCachePixels + 46818}, {154, 11, planeCachePixels + 46822},
+{101, 23, planeCachePixels + 46833}, {137, 10, planeCachePixels + 46856}, {153, 14, planeCachePixels + 46866}, {102, 27, planeCachePixels + 46880},
+{141, 27, planeCachePixels + 46907}, {106, 29, planeCachePixels + 46934}, {144, 25, planeCachePixels + 46963}, {112, 29, planeCachePixels + 46988},
+{146, 23, planeCachePixels + 47017}, {117, 29, planeCachePixels + 47040}, {151, 18, planeCachePixels + 47069}, {122, 53, planeCachePixels + 47087},
+{123, 58, planeCachePixels + 47140}, {129, 55, planeCachePixels + 47198}, {134, 35, planeCachePixels + 47253}, {175, 1, planeCachePixels + 47288},
+{180, 4, planeCachePixels + 47289}, {135, 40, planeCachePixels + 47293}, {140, 40, planeCachePixels + 47333}, {146, 40, planeCachePixels + 47373},
+{151, 41, planeCachePixels + 47413}, {153, 44, planeCachePixels + 47454}, {155, 48, planeCachePixels + 47498}, {156, 8, planeCachePixels + 47546},
+{168, 41, planeCachePixels + 47554}, {157, 4, planeCachePixels + 47595}, {174, 40, planeCachePixels + 47599}, {180, 3, planeCachePixels + 47639},
+{185, 35, planeCachePixels + 47642}, {191, 35, planeCachePixels + 47677}, {197, 1, planeCachePixels + 47712}, {203, 28, planeCachePixels + 47713},
+{208, 29, planeCachePixels + 47741}, {214, 28, planeCachePixels + 47770}, {220, 1, planeCachePixels + 47798}, {225, 16, planeCachePixels + 47799},
+{231, 4, planeCachePixels + 47815}, {237, 4, planeCachePixels + 47819}, {163, 2, planeCachePixels + 47823}, {163, 2, planeCachePixels + 47825},
+{163, 2, planeCachePixels + 47827}, {163, 2, planeCachePixels + 47829}, {162, 3, planeCachePixels + 47831}, {162, 2, planeCachePixels + 47834},
+{162, 2, planeCachePixels + 47836}, {78, 3, planeCachePixels + 47838}, {162, 2, planeCachePixels + 47841}, {78, 8, planeCachePixels + 47843},
+{162, 2, planeCachePixels + 47851}, {78, 13, planeCachePixels + 47853}, {161, 3, planeCachePixels + 47866}, {80, 16, planeCachePixels + 47869},
+{161, 2, planeCachePixels + 47885}, {86, 15, planeCachePixels + 47887}, {161, 2, planeCachePixels + 47902}, {89, 17, planeCachePixels + 47904},
+{161, 3, planeCachePixels + 47921}, {91, 21, planeCachePixels + 47924}, {158, 1, planeCachePixels + 47945}, {160, 4, planeCachePixels + 47946},
+{96, 21, planeCachePixels + 47950}, {137, 1, planeCachePixels + 47971}, {155, 9, planeCachePixels + 47972}, {101, 21, planeCachePixels + 47981},
+{137, 6, planeCachePixels + 48002}, {154, 11, planeCachePixels + 48008}, {102, 25, planeCachePixels + 48019}, {137, 11, planeCachePixels + 48044},
+{152, 15, planeCachePixels + 48055}, {106, 26, planeCachePixels + 48070}, {143, 25, planeCachePixels + 48096}, {111, 26, planeCachePixels + 48121},
+{144, 25, planeCachePixels + 48147}, {116, 26, planeCachePixels + 48172}, {148, 21, planeCachePixels + 48198}, {121, 27, planeCachePixels + 48219},
+{151, 19, planeCachePixels + 48246}, {121, 53, planeCachePixels + 48265}, {126, 53, planeCachePixels + 48318}, {132, 52, planeCachePixels + 48371},
+{135, 34, planeCachePixels + 48423}, {173, 3, planeCachePixels + 48457}, {179, 5, planeCachePixels + 48460}, {137, 36, planeCachePixels + 48465},
+{142, 36, planeCachePixels + 48501}, {147, 37, planeCachePixels + 48537}, {152, 37, planeCachePixels + 48574}, {153, 41, planeCachePixels + 48611},
+{154, 45, planeCachePixels + 48652}, {156, 8, planeCachePixels + 48697}, {167, 37, planeCachePixels + 48705}, {157, 4, planeCachePixels + 48742},
+{162, 1, planeCachePixels + 48746}, {173, 36, planeCachePixels + 48747}, {178, 36, planeCachePixels + 48783}, {188, 32, planeCachePixels + 48819},
+{193, 5, planeCachePixels + 48851}, {199, 26, planeCachePixels + 48856}, {204, 26, planeCachePixels + 48882}, {209, 26, planeCachePixels + 48908},
+{214, 26, planeCachePixels + 48934}, {219, 2, planeCachePixels + 48960}, {224, 17, planeCachePixels + 48962}, {230, 11, planeCachePixels + 48979},
+{240, 1, planeCachePixels + 48990}, {164, 1, planeCachePixels + 48991}, {163, 2, planeCachePixels + 48992}, {163, 2, planeCachePixels + 48994},
+{163, 2, planeCachePixels + 48996}, {163, 2, planeCachePixels + 48998}, {163, 2, planeCachePixels + 49000}, {79, 4, planeCachePixels + 49002},
+{162, 2, planeCachePixels + 49006}, {78, 10, planeCachePixels + 49008}, {162, 2, planeCachePixels + 49018}, {78, 14, planeCachePixels + 49020},
+{162, 2, planeCachePixels + 49034}, {83, 14, planeCachePixels + 49036}, {162, 2, planeCachePixels + 49050}, {87, 15, planeCachePixels + 49052},
+{162, 2, planeCachePixels + 49067}, {89, 17, planeCachePixels + 49069}, {161, 2, planeCachePixels + 49086}, {92, 19, planeCachePixels + 49088},
+{161, 3, planeCachePixels + 49107}, {97, 19, planeCachePixels + 49110}, {158, 1, planeCachePixels + 49129}, {160, 4, planeCachePixels + 49130},
+{101, 19, planeCachePixels + 49134}, {137, 3, planeCachePixels + 49153}, {156, 8, planeCachePixels + 49156}, {102, 23, planeCachePixels + 49164},
+{137, 7, planeCachePixels + 49187}, {153, 13, planeCachePixels + 49194}, {106, 24, planeCachePixels + 49207}, {139, 10, planeCachePixels + 49231},
+{152, 15, planeCachePixels + 49241}, {111, 24, planeCachePixels + 49256}, {144, 24, planeCachePixels + 49280}, {115, 24, planeCachePixels + 49304},
+{144, 24, planeCachePixels + 49328}, {120, 24, planeCachePixels + 49352}, {149, 20, planeCachePixels + 49376}, {122, 27, planeCachePixels + 49396},
+{151, 19, planeCachePixels + 49423}, {125, 48, planeCachePixels + 49442}, {129, 48, planeCachePixels + 49490}, {134, 48, planeCachePixels + 49538},
+{135, 34, planeCachePixels + 49586}, {172, 4, planeCachePixels + 49620}, {177, 7, planeCachePixels + 49624}, {139, 33, planeCachePixels + 49631},
+{182, 2, planeCachePixels + 49664}, {143, 34, planeCachePixels + 49666}, {148, 34, planeCachePixels + 49700}, {153, 33, planeCachePixels + 49734},
+{153, 38, planeCachePixels + 49767}, {154, 42, planeCachePixels + 49805}, {156, 8, planeCachePixels + 49847}, {167, 33, planeCachePixels + 49855},
+{157, 4, planeCachePixels + 49888}, {162, 1, planeCachePixels + 49892}, {171, 34, planeCachePixels + 49893}, {176, 34, planeCachePixels + 49927},
+{181, 2, planeCachePixels + 49961}, {186, 29, planeCachePixels + 49963}, {190, 29, planeCachePixels + 49992}, {195, 3, planeCachePixels + 50021},
+{200, 24, planeCachePixels + 50024}, {205, 24, planeCachePixels + 50048}, {209, 24, planeCachePixels + 50072}, {214, 24, planeCachePixels + 50096},
+{219, 2, planeCachePixels + 50120}, {224, 17, planeCachePixels + 50122}, {228, 13, planeCachePixels + 50139}, {233, 1, planeCachePixels + 50152},
+{238, 3, planeCachePixels + 50153}, {164, 1, planeCachePixels + 50156}, {164, 2, planeCachePixels + 50157}, {164, 2, planeCachePixels + 50159},
+{163, 2, planeCachePixels + 50161}, {79, 1, planeCachePixels + 50163}, {163, 2, planeCachePixels + 50164}, {79, 6, planeCachePixels + 50166},
+{163, 2, planeCachePixels + 50172}, {78, 11, planeCachePixels + 50174}, {163, 2, planeCachePixels + 50185}, {80, 13, planeCachePixels + 50187},
+{162, 2, planeCachePixels + 50200}, {84, 14, planeCachePixels + 50202}, {162, 2, planeCachePixels + 50216}, {89, 13, planeCachePixels + 50218},
+{162, 2, planeCachePixels + 50231}, {89, 17, planeCachePixels + 50233}, {162, 2, planeCachePixels + 50250}, {93, 18, planeCachePixels + 50252},
+{162, 2, planeCachePixels + 50270}, {97, 18, planeCachePixels + 50272}, {161, 3, planeCachePixels + 50290}, {102, 17, planeCachePixels + 50293},
+{158, 1, planeCachePixels + 50310}, {160, 4, planeCachePixels + 50311}, {102, 22, planeCachePixels + 50315}, {137, 4, planeCachePixels + 50337},
+{156, 8, planeCachePixels + 50341}, {106, 22, planeCachePixels + 50349}, {137, 9, planeCachePixels + 50371}, {153, 13, planeCachePixels + 50380},
+{110, 22, planeCachePixels + 50393}, {141, 9, planeCachePixels + 50415}, {152, 16, planeCachePixels + 50424}, {114, 23, planeCachePixels + 50440},
+{145, 23, planeCachePixels + 50463}, {119, 22, planeCachePixels + 50486}, {145, 23, planeCachePixels + 50508}, {122, 23, planeCachePixels + 50531},
+{150, 19, planeCachePixels + 50554}, {123, 27, planeCachePixels + 50573}, {151, 19, planeCachePixels + 50600}, {127, 45, planeCachePixels + 50619},
+{132, 44, planeCachePixels + 50664}, {135, 45, planeCachePixels + 50708}, {136, 33, planeCachePixels + 50753}, {171, 13, planeCachePixels + 50786},
+{140, 31, planeCachePixels + 50799}, {180, 4, planeCachePixels + 50830}, {144, 32, planeCachePixels + 50834}, {149, 31, planeCachePixels + 50866},
+{152, 32, planeCachePixels + 50897}, {153, 36, planeCachePixels + 50929}, {154, 39, planeCachePixels + 50965}, {156, 8, planeCachePixels + 51004},
+{166, 31, planeCachePixels + 51012}, {157, 4, planeCachePixels + 51043}, {162, 1, planeCachePixels + 51047}, {170, 32, planeCachePixels + 51048},
+{175, 31, planeCachePixels + 51080}, {179, 4, planeCachePixels + 51111}, {184, 26, planeCachePixels + 51115}, {188, 27, planeCachePixels + 51141},
+{192, 27, planeCachePixels + 51168}, {197, 1, planeCachePixels + 51195}, {201, 22, planeCachePixels + 51196}, {205, 23, planeCachePixels + 51218},
+{210, 22, planeCachePixels + 51241}, {214, 22, planeCachePixels + 51263}, {218, 2, planeCachePixels + 51285}, {223, 18, planeCachePixels + 51287},
+{227, 14, planeCachePixels + 51305}, {231, 3, planeCachePixels + 51319}, {236, 4, planeCachePixels + 51322}, {164, 1, planeCachePixels + 51326},
+{164, 2, planeCachePixels + 51327}, {164, 2, planeCachePixels + 51329}, {79, 3, planeCachePixels + 51331}, {164, 2, planeCachePixels + 51334},
+{79, 7, planeCachePixels + 51336}, {163, 3, planeCachePixels + 51343}, {79, 11, planeCachePixels + 51346}, {163, 2, planeCachePixels + 51357},
+{82, 12, planeCachePixels + 51359}, {163, 2, planeCachePixels + 51371}, {86, 12, planeCachePixels + 51373}, {163, 2, planeCachePixels + 51385},
+{89, 13, planeCachePixels + 51387}, {162, 3, planeCachePixels + 51400}, {90, 16, planeCachePixels + 51403}, {162, 2, planeCachePixels + 51419},
+{94, 16, planeCachePixels + 51421}, {162, 2, planeCachePixels + 51437}, {98, 16, planeCachePixels + 51439}, {162, 2, planeCachePixels + 51455},
+{102, 16, planeCachePixels + 51457}, {161, 3, planeCachePixels + 51473}, {102, 20, planeCachePixels + 51476}, {137, 2, planeCachePixels + 51496},
+{158, 6, planeCachePixels + 51498}, {106, 20, planeCachePixels + 51504}, {137, 6, planeCachePixels + 51524}, {156, 8, planeCachePixels + 51530},
+{110, 20, planeCachePixels + 51538}, {139, 8, planeCachePixels + 51558}, {153, 13, planeCachePixels + 51566}, {114, 20, planeCachePixels + 51579},
+{143, 8, planeCachePixels + 51599}, {152, 15, planeCachePixels + 51607}, {118, 20, planeCachePixels + 51622}, {145, 22, planeCachePixels + 51642},
+{122, 20, planeCachePixels + 51664}, {147, 21, planeCachePixels + 51684}, {122, 24, planeCachePixels + 51705}, {151, 18, planeCachePixels + 51729},
+{126, 24, planeCachePixels + 51747}, {151, 19, planeCachePixels + 51771}, {130, 41, planeCachePixels + 51790}, {134, 41, planeCachePixels + 51831},
+{135, 44, planeCachePixels + 51872}, {138, 31, planeCachePixels + 51916}, {171, 12, planeCachePixels + 51947}, {142, 28, planeCachePixels + 51959},
+{175, 1, planeCachePixels + 51987}, {179, 5, planeCachePixels + 51988}, {146, 28, planeCachePixels + 51993}, {183, 1, planeCachePixels + 52021},
+{150, 28, planeCachePixels + 52022}, {152, 30, planeCachePixels + 52050}, {153, 34, planeCachePixels + 52080}, {154, 37, planeCachePixels + 52114},
+{156, 8, planeCachePixels + 52151}, {166, 29, planeCachePixels + 52159}, {157, 6, planeCachePixels + 52188}, {170, 29, planeCachePixels + 52194},
+{174, 29, planeCachePixels + 52223}, {178, 29, planeCachePixels + 52252}, {182, 1, planeCachePixels + 52281}, {186, 25, planeCachePixels + 52282},
+{190, 25, planeCachePixels + 52307}, {194, 3, planeCachePixels + 52332}, {198, 21, planeCachePixels + 52335}, {202, 21, planeCachePixels + 52356},
+{206, 21, planeCachePixels + 52377}, {210, 21, planeCachePixels + 52398}, {214, 21, planeCachePixels + 52419}, {218, 2, planeCachePixels + 52440},
+{222, 17, planeCachePixels + 52442}, {226, 14, planeCachePixels + 52459}, {230, 10, planeCachePixels + 52473}, {238, 2, planeCachePixels + 52483},
+{165, 2, planeCachePixels + 52485}, {79, 5, planeCachePixels + 52487}, {164, 2, planeCachePixels + 52492}, {79, 9, planeCachePixels + 52494},
+{164, 2, planeCachePixels + 52503}, {80, 11, planeCachePixels + 52505}, {164, 2, planeCachePixels + 52516}, {84, 11, planeCachePixels + 52518},
+{164, 2, planeCachePixels + 52529}, {87, 12, planeCachePixels + 52531}, {163, 2, planeCachePixels + 52543}, {89, 14, planeCachePixels + 52545},
+{163, 2, planeCachePixels + 52559}, {91, 15, planeCachePixels + 52561}, {163, 2, planeCachePixels + 52576}, {95, 15, planeCachePixels + 52578},
+{162, 3, planeCachePixels + 52593}, {98, 16, planeCachePixels + 52596}, {162, 2, planeCachePixels + 52612}, {102, 16, planeCachePixels + 52614},
+{162, 2, planeCachePixels + 52630}, {103, 18, planeCachePixels + 52632}, {162, 2, planeCachePixels + 52650}, {106, 19, planeCachePixels + 52652},
+{138, 2, planeCachePixels + 52671}, {158, 6, planeCachePixels + 52673}, {109, 20, planeCachePixels + 52679}, {137, 7, planeCachePixels + 52699},
+{155, 9, planeCachePixels + 52706}, {113, 19, planeCachePixels + 52715}, {140, 8, planeCachePixels + 52734}, {154, 12, planeCachePixels + 52742},
+{117, 19, planeCachePixels + 52754}, {144, 23, planeCachePixels + 52773}, {121, 19, planeCachePixels + 52796}, {145, 23, planeCachePixels + 52815},
+{122, 22, planeCachePixels + 52838}, {148, 20, planeCachePixels + 52860}, {124, 23, planeCachePixels + 52880}, {151, 18, planeCachePixels + 52903},
+{128, 42, planeCachePixels + 52921}, {132, 38, planeCachePixels + 52963}, {135, 39, planeCachePixels + 53001}, {135, 43, planeCachePixels + 53040},
+{139, 30, planeCachePixels + 53083}, {170, 11, planeCachePixels + 53113}, {143, 27, planeCachePixels + 53124}, {174, 2, planeCachePixels + 53151},
+{177, 7, planeCachePixels + 53153}, {146, 27, planeCachePixels + 53160}, {181, 3, planeCachePixels + 53187}, {150, 27, planeCachePixels + 53190},
+{152, 29, planeCachePixels + 53217}, {154, 31, planeCachePixels + 53246}, {154, 34, planeCachePixels + 53277}, {156, 8, planeCachePixels + 53311},
+{165, 27, planeCachePixels + 53319}, {157, 3, planeCachePixels + 53346}, {161, 1, planeCachePixels + 53349}, {169, 27, planeCachePixels + 53350},
+{173, 27, planeCachePixels + 53377}, {176, 27, planeCachePixels + 53404}, {180, 2, planeCachePixels + 53431}, {184, 23, planeCachePixels + 53433},
+{188, 23, planeCachePixels + 53456}, {191, 24, planeCachePixels + 53479}, {195, 2, planeCachePixels + 53503}, {199, 19, planeCachePixels + 53505},
+{203, 19, planeCachePixels + 53524}, {206, 20, planeCachePixels + 53543}, {210, 19, planeCachePixels + 53563}, {214, 19, planeCachePixels + 53582},
+{218, 2, planeCachePixels + 53601}, {221, 16, planeCachePixels + 53603}, {225, 15, planeCachePixels + 53619}, {229, 11, planeCachePixels + 53634},
+{237, 2, planeCachePixels + 53645}, {80, 2, planeCachePixels + 53647}, {80, 5, planeCachePixels + 53649}, {165, 2, planeCachePixels + 53654},
+{79, 10, planeCachePixels + 53656}, {165, 2, planeCachePixels + 53666}, {82, 10, planeCachePixels + 53668}, {164, 2, planeCachePixels + 53678},
+{85, 11, planeCachePixels + 53680}, {164, 2, planeCachePixels + 53691}, {89, 10, planeCachePixels + 53693}, {164, 2, planeCachePixels + 53703},
+{90, 13, planeCachePixels + 53705}, {164, 2, planeCachePixels + 53718}, {92, 14, planeCachePixels + 53720}, {163, 2, planeCachePixels + 53734},
+{95, 15, planeCachePixels + 53736}, {163, 2, planeCachePixels + 53751}, {99, 14, planeCachePixels + 53753}, {163, 2, planeCachePixels + 53767},
+{102, 15, planeCachePixels + 53769}, {162, 2, planeCachePixels + 53784}, {103, 17, planeCachePixels + 53786}, {162, 2, planeCachePixels + 53803},
+{106, 18, planeCachePixels + 53805}, {162, 2, planeCachePixels + 53823}, {109, 18, planeCachePixels + 53825}, {138, 4, planeCachePixels + 53843},
+{158, 7, planeCachePixels + 53847}, {113, 18, planeCachePixels + 53854}, {138, 7, planeCachePixels + 53872}, {155, 9, planeCachePixels + 53879},
+{116, 18, planeCachePixels + 53888}, {142, 7, planeCachePixels + 53906}, {154, 12, planeCachePixels + 53913}, {120, 18, planeCachePixels + 53925},
+{145, 22, planeCachePixels + 53943}, {122, 19, planeCachePixels + 53965}, {145, 23, planeCachePixels + 53984}, {123, 22, planeCachePixels + 54007},
+{148, 20, planeCachePixels + 54029}, {126, 22, planeCachePixels + 54049}, {151, 18, planeCachePixels + 54071}, {130, 40, planeCachePixels + 54089},
+{133, 37, planeCachePixels + 54129}, {135, 38, planeCachePixels + 54166}, {137, 40, planeCachePixels + 54204}, {140, 40, planeCachePixels + 54244},
+{144, 25, planeCachePixels + 54284}, {173, 11, planeCachePixels + 54309}, {147, 26, planeCachePixels + 54320}, {180, 4, planeCachePixels + 54346},
+{151, 25, planeCachePixels + 54350}, {183, 1, planeCachePixels + 54375}, {152, 28, planeCachePixels + 54376}, {154, 29, planeCachePixels + 54404},
+{154, 33, planeCachePixels + 54433}, {155, 9, planeCachePixels + 54466}, {165, 25, planeCachePixels + 54475}, {157, 3, planeCachePixels + 54500},
+{161, 1, planeCachePixels + 54503}, {168, 26, planeCachePixels + 54504}, {172, 25, planeCachePixels + 54530}, {175, 26, planeCachePixels + 54555},
+{179, 25, planeCachePixels + 54581}, {186, 22, planeCachePixels + 54606}, {189, 22, planeCachePixels + 54628}, {193, 21, planeCachePixels + 54650},
+{196, 1, planeCachePixels + 54671}, {200, 18, planeCachePixels + 54672}, {203, 18, planeCachePixels + 54690}, {207, 18, planeCachePixels + 54708},
+{210, 18, planeCachePixels + 54726}, {214, 18, planeCachePixels + 54744}, {217, 2, planeCachePixels + 54762}, {221, 14, planeCachePixels + 54764},
+{224, 15, planeCachePixels + 54778}, {228, 11, planeCachePixels + 54793}, {231, 2, planeCachePixels + 54804}, {235, 4, planeCachePixels + 54806},
+{238, 1, planeCachePixels + 54810}, {80, 4, planeCachePixels + 54811}, {80, 7, planeCachePixels + 54815}, {80, 10, planeCachePixels + 54822},
+{165, 2, planeCachePixels + 54832}, {83, 10, planeCachePixels + 54834}, {165, 2, planeCachePixels + 54844}, {86, 11, planeCachePixels + 54846},
+{165, 2, planeCachePixels + 54857}, {90, 10, planeCachePixels + 54859}, {164, 3, planeCachePixels + 54869}, {90, 13, planeCachePixels + 54872},
+{164, 2, planeCachePixels + 54885}, {93, 13, planeCachePixels + 54887}, {164, 2, planeCachePixels + 54900}, {96, 14, planeCachePixels + 54902},
+{164, 2, planeCachePixels + 54916}, {99, 14, planeCachePixels + 54918}, {163, 2, planeCachePixels + 54932}, {103, 13, planeCachePixels + 54934},
+{163, 2, planeCachePixels + 54947}, {103, 17, planeCachePixels + 54949}, {163, 2, planeCachePixels + 54966}, {106, 17, planeCachePixels + 54968},
+{162, 2, planeCachePixels + 54985}, {109, 17, planeCachePixels + 54987}, {138, 2, planeCachePixels + 55004}, {162, 2, planeCachePixels + 55006},
+{112, 17, planeCachePixels + 55008}, {138, 5, planeCachePixels + 55025}, {156, 1, planeCachePixels + 55030}, {159, 1, planeCachePixels + 55031},
+{161, 4, planeCachePixels + 55032}, {116, 17, planeCachePixels + 55036}, {139, 7, planeCachePixels + 55053}, {155, 10, planeCachePixels + 55060},
+{119, 17, planeCachePixels + 55070}, {143, 7, planeCachePixels + 55087}, {154, 12, planeCachePixels + 55094}, {122, 17, planeCachePixels + 55106},
+{145, 22, planeCachePixels + 55123}, {122, 20, planeCachePixels + 55145}, {146, 22, planeCachePixels + 55165}, {125, 21, planeCachePixels + 55187},
+{149, 20, planeCachePixels + 55208}, {128, 21, planeCachePixels + 55228}, {151, 18, planeCachePixels + 55249}, {132, 37, planeCachePixels + 55267},
+{135, 35, planeCachePixels + 55304}, {135, 37, planeCachePixels + 55339}, {138, 38, planeCachePixels + 55376}, {141, 38, planeCachePixels + 55414},
+{145, 24, planeCachePixels + 55452}, {172, 10, planeCachePixels + 55476}, {148, 24, planeCachePixels + 55486}, {179, 5, planeCachePixels + 55510},
+{151, 24, planeCachePixels + 55515}, {182, 2, planeCachePixels + 55539}, {152, 26, planeCachePixels + 55541}, {154, 28, planeCachePixels + 55567},
+{154, 31, planeCachePixels + 55595}, {155, 8, planeCachePixels + 55626}, {164, 24, planeCachePixels + 55634}, {157, 3, planeCachePixels + 55658},
+{161, 1, planeCachePixels + 55661}, {168, 23, planeCachePixels + 55662}, {171, 24, planeCachePixels + 55685}, {174, 24, planeCachePixels + 55709},
+{177, 24, planeCachePixels + 55733}, {181, 1, planeCachePixels + 55757}, {184, 21, planeCachePixels + 55758}, {187, 21, planeCachePixels + 55779},
+{191, 20, planeCachePixels + 55800}, {194, 20, planeCachePixels + 55820}, {201, 17, planeCachePixels + 55840}, {204, 17, planeCachePixels + 55857},
+{207, 17, planeCachePixels + 55874}, {210, 17, planeCachePixels + 55891}, {214, 17, planeCachePixels + 55908}, {217, 2, planeCachePixels + 55925},
+{220, 14, planeCachePixels + 55927}, {224, 13, planeCachePixels + 55941}, {227, 12, planeCachePixels + 55954}, {230, 3, planeCachePixels + 55966},
+{234, 5, planeCachePixels + 55969}, {237, 2, planeCachePixels + 55974}, {81, 1, planeCachePixels + 55976}, {81, 4, planeCachePixels + 55977},
+{80, 8, planeCachePixels + 55981}, {81, 10, planeCachePixels + 55989}, {85, 9, planeCachePixels + 55999}, {166, 2, planeCachePixels + 56008},
+{88, 9, planeCachePixels + 56010}, {165, 3, planeCachePixels + 56019}, {90, 10, planeCachePixels + 56022}, {165, 2, planeCachePixels + 56032},
+{91, 12, planeCachePixels + 56034}, {165, 2, planeCachePixels + 56046}, {94, 13, planeCachePixels + 56048}, {164, 3, planeCachePixels + 56061},
+{97, 13, planeCachePixels + 56064}, {164, 2, planeCachePixels + 56077}, {100, 13, planeCachePixels + 56079}, {164, 2, planeCachePixels + 56092},
+{103, 13, planeCachePixels + 56094}, {163, 3, planeCachePixels + 56107}, {103, 16, planeCachePixels + 56110}, {163, 2, planeCachePixels + 56126},
+{106, 16, planeCachePixels + 56128}, {163, 2, planeCachePixels + 56144}, {109, 16, planeCachePixels + 56146}, {162, 3, planeCachePixels + 56162},
+{112, 16, planeCachePixels + 56165}, {138, 3, planeCachePixels + 56181}, {162, 2, planeCachePixels + 56184}, {115, 16, planeCachePixels + 56186},
+{138, 6, planeCachePixels + 56202}, {159, 1, planeCachePixels + 56208}, {161, 4, planeCachePixels + 56209}, {118, 16, planeCachePixels + 56213},
+{141, 6, planeCachePixels + 56229}, {155, 10, planeCachePixels + 56235}, {121, 16, planeCachePixels + 56245}, {144, 6, planeCachePixels + 56261},
+{153, 13, planeCachePixels + 56267}, {122, 18, planeCachePixels + 56280}, {145, 21, planeCachePixels + 56298}, {124, 19, planeCachePixels + 56319},
+{147, 21, planeCachePixels + 56338}, {127, 20, planeCachePixels + 56359}, {150, 19, planeCachePixels + 56379}, {130, 20, planeCachePixels + 56398},
+{151, 18, planeCachePixels + 56418}, {133, 36, planeCachePixels + 56436}, {135, 35, planeCachePixels + 56472}, {136, 36, planeCachePixels + 56507},
+{139, 36, planeCachePixels + 56543}, {142, 36, planeCachePixels + 56579}, {145, 23, planeCachePixels + 56615}, {171, 10, planeCachePixels + 56638},
+{149, 22, planeCachePixels + 56648}, {174, 1, planeCachePixels + 56670}, {178, 6, planeCachePixels + 56671}, {152, 22, planeCachePixels + 56677},
+{181, 3, planeCachePixels + 56699}, {152, 25, planeCachePixels + 56702}, {153, 27, planeCachePixels + 56727}, {154, 30, planeCachePixels + 56754},
+{155, 8, planeCachePixels + 56784}, {164, 23, planeCachePixels + 56792}, {157, 3, planeCachePixels + 56815}, {161, 1, planeCachePixels + 56818},
+{167, 23, planeCachePixels + 56819}, {170, 23, planeCachePixels + 56842}, {173, 23, planeCachePixels + 56865}, {176, 23, planeCachePixels + 56888},
+{179, 3, planeCachePixels + 56911}, {183, 19, planeCachePixels + 56914}, {186, 19, planeCachePixels + 56933}, {189, 19, planeCachePixels + 56952},
+{192, 19, planeCachePixels + 56971}, {195, 1, planeCachePixels + 56990}, {198, 16, planeCachePixels + 56991}, {201, 16, planeCachePixels + 57007},
+{204, 16, planeCachePixels + 57023}, {207, 17, planeCachePixels + 57039}, {210, 17, planeCachePixels + 57056}, {213, 17, planeCachePixels + 57073},
+{217, 1, planeCachePixels + 57090}, {220, 13, planeCachePixels + 57091}, {223, 13, planeCachePixels + 57104}, {226, 13, planeCachePixels + 57117},
+{229, 9, planeCachePixels + 57130}, {235, 3, planeCachePixels + 57139}, {81, 2, planeCachePixels + 57142}, {81, 5, planeCachePixels + 57144},
+{80, 9, planeCachePixels + 57149}, {83, 9, planeCachePixels + 57158}, {86, 9, planeCachePixels + 57167}, {89, 9, planeCachePixels + 57176},
+{166, 2, planeCachePixels + 57185}, {91, 10, planeCachePixels + 57187}, {166, 2, planeCachePixels + 57197}, {91, 13, planeCachePixels + 57199},
+{165, 3, planeCachePixels + 57212}, {94, 13, planeCachePixels + 57215}, {165, 2, planeCachePixels + 57228}, {97, 13, planeCachePixels + 57230},
+{165, 2, planeCachePixels + 57243}, {100, 12, planeCachePixels + 57245}, {164, 3, planeCachePixels + 57257}, {103, 12, planeCachePixels + 57260},
+{164, 2, planeCachePixels + 57272}, {103, 15, planeCachePixels + 57274}, {164, 2, planeCachePixels + 57289}, {106, 15, planeCachePixels + 57291},
+{163, 3, planeCachePixels + 57306}, {109, 15, planeCachePixels + 57309}, {163, 2, planeCachePixels + 57324}, {112, 15, planeCachePixels + 57326},
+{138, 1, planeCachePixels + 57341}, {163, 2, planeCachePixels + 57342}, {115, 15, planeCachePixels + 57344}, {138, 4, planeCachePixels + 57359},
+{162, 2, planeCachePixels + 57363}, {117, 16, planeCachePixels + 57365}, {139, 6, planeCachePixels + 57381}, {159, 1, planeCachePixels + 57387},
+{161, 4, planeCachePixels + 57388}, {120, 16, planeCachePixels + 57392}, {142, 6, planeCachePixels + 57408}, {155, 10, planeCachePixels + 57414},
+{122, 17, planeCachePixels + 57424}, {145, 6, planeCachePixels + 57441}, {153, 13, planeCachePixels + 57447}, {123, 19, planeCachePixels + 57460},
+{145, 21, planeCachePixels + 57479}, {126, 18, planeCachePixels + 57500}, {148, 20, planeCachePixels + 57518}, {129, 18, planeCachePixels + 57538},
+{150, 19, planeCachePixels + 57556}, {132, 18, planeCachePixels + 57575}, {151, 18, planeCachePixels + 57593}, {135, 34, planeCachePixels + 57611},
+{135, 35, planeCachePixels + 57645}, {137, 34, planeCachePixels + 57680}, {140, 34, planeCachePixels + 57714}, {143, 34, planeCachePixels + 57748},
+{146, 22, planeCachePixels + 57782}, {171, 9, planeCachePixels + 57804}, {149, 22, planeCachePixels + 57813}, {174, 2, planeCachePixels + 57835},
+{177, 6, planeCachePixels + 57837}, {152, 21, planeCachePixels + 57843}, {180, 4, planeCachePixels + 57864}, {152, 24, planeCachePixels + 57868},
+{153, 26, planeCachePixels + 57892}, {155, 27, planeCachePixels + 57918}, {155, 8, planeCachePixels + 57945}, {164, 21, planeCachePixels + 57953},
+{157, 5, planeCachePixels + 57974}, {167, 21, planeCachePixels + 57979}, {169, 22, planeCachePixels + 58000}, {172, 22, planeCachePixels + 58022},
+{175, 22, planeCachePixels + 58044}, {178, 22, planeCachePixels + 58066}, {184, 19, planeCachePixels + 58088}, {187, 18, planeCachePixels + 58107},
+{190, 18, planeCachePixels + 58125}, {193, 18, planeCachePixels + 58143}, {199, 15, planeCachePixels + 58161}, {202, 15, planeCachePixels + 58176},
+{205, 15, planeCachePixels + 58191}, {208, 15, planeCachePixels + 58206}, {210, 16, planeCachePixels + 58221}, {213, 16, planeCachePixels + 58237},
+{216, 2, planeCachePixels + 58253}, {219, 13, planeCachePixels + 58255}, {222, 12, planeCachePixels + 58268}, {225, 12, planeCachePixels + 58280},
+{228, 10, planeCachePixels + 58292}, {234, 4, planeCachePixels + 58302}, {81, 4, planeCachePixels + 58306}, {81, 7, planeCachePixels + 58310},
+{82, 8, planeCachePixels + 58317}, {84, 9, planeCachePixels + 58325}, {87, 9, planeCachePixels + 58334}, {90, 9, planeCachePixels + 58343},
+{91, 10, planeCachePixels + 58352}, {167, 2, planeCachePixels + 58362}, {92, 12, planeCachePixels + 58364}, {166, 2, planeCachePixels + 58376},
+{95, 12, planeCachePixels + 58378}, {166, 2, planeCachePixels + 58390}, {98, 12, planeCachePixels + 58392}, {165, 3, planeCachePixels + 58404},
+{101, 11, planeCachePixels + 58407}, {165, 2, planeCachePixels + 58418}, {103, 12, planeCachePixels + 58420}, {165, 2, planeCachePixels + 58432},
+{104, 14, planeCachePixels + 58434}, {164, 2, planeCachePixels + 58448}, {106, 15, planeCachePixels + 58450}, {164, 2, planeCachePixels + 58465},
+{109, 14, planeCachePixels + 58467}, {164, 2, planeCachePixels + 58481}, {111, 15, planeCachePixels + 58483}, {163, 2, planeCachePixels + 58498},
+{114, 15, planeCachePixels + 58500}, {138, 3, planeCachePixels + 58515}, {163, 2, planeCachePixels + 58518}, {117, 15, planeCachePixels + 58520},
+{138, 5, planeCachePixels + 58535}, {163, 2, planeCachePixels + 58540}, {120, 14, planeCachePixels + 58542}, {140, 6, planeCachePixels + 58556},
+{157, 1, planeCachePixels + 58562}, {159, 6, planeCachePixels + 58563}, {122, 15, planeCachePixels + 58569}, {143, 6, planeCachePixels + 58584},
+{154, 11, planeCachePixels + 58590}, {122, 18, planeCachePixels + 58601}, {145, 7, planeCachePixels + 58619}, {153, 13, planeCachePixels + 58626},
+{125, 18, planeCachePixels + 58639}, {145, 21, planeCachePixels + 58657}, {128, 17, planeCachePixels + 58678}, {148, 20, planeCachePixels + 58695},
+{131, 17, planeCachePixels + 58715}, {151, 18, planeCachePixels + 58732}, {133, 36, planeCachePixels + 58750}, {135, 34, planeCachePixels + 58786},
+{136, 34, planeCachePixels + 58820}, {139, 32, planeCachePixels + 58854}, {141, 32, planeCachePixels + 58886}, {144, 32, planeCachePixels + 58918},
+{147, 21, planeCachePixels + 58950}, {170, 9, planeCachePixels + 58971}, {150, 20, planeCachePixels + 58980}, {173, 9, planeCachePixels + 59000},
+{152, 21, planeCachePixels + 59009}, {179, 5, planeCachePixels + 59030}, {152, 24, planeCachePixels + 59035}, {181, 2, planeCachePixels + 59059},
+{153, 25, planeCachePixels + 59061}, {155, 26, planeCachePixels + 59086}, {155, 29, planeCachePixels + 59112}, {157, 5, planeCachePixels + 59141},
+{166, 21, planeCachePixels + 59146}, {169, 20, planeCachePixels + 59167}, {172, 20, planeCachePixels + 59187}, {174, 21, planeCachePixels + 59207},
+{177, 21, planeCachePixels + 59228}, {180, 1, planeCachePixels + 59249}, {183, 17, planeCachePixels + 59250}, {185, 18, planeCachePixels + 59267},
+{188, 18, planeCachePixels + 59285}, {191, 17, planeCachePixels + 59303}, {194, 2, planeCachePixels + 59320}, {197, 14, planeCachePixels + 59322},
+{199, 15, planeCachePixels + 59336}, {202, 15, planeCachePixels + 59351}, {205, 14, planeCachePixels + 59366}, {208, 14, planeCachePixels + 59380},
+{210, 15, planeCachePixels + 59394}, {213, 15, planeCachePixels + 59409}, {216, 2, planeCachePixels + 59424}, {219, 11, planeCachePixels + 59426},
+{222, 11, planeCachePixels + 59437}, {224, 12, planeCachePixels + 59448}, {227, 11, planeCachePixels + 59460}, {230, 1, planeCachePixels + 59471},
+{233, 4, planeCachePixels + 59472}, {235, 2, planeCachePixels + 59476}, {82, 2, planeCachePixels + 59478}, {82, 4, planeCachePixels + 59480},
+{81, 8, planeCachePixels + 59484}, {83, 8, planeCachePixels + 59492}, {86, 8, planeCachePixels + 59500}, {88, 9, planeCachePixels + 59508},
+{91, 8, planeCachePixels + 59517}, {91, 11, planeCachePixels + 59525}, {93, 11, planeCachePixels + 59536}, {167, 2, planeCachePixels + 59547},
+{96, 11, planeCachePixels + 59549}, {167, 2, planeCachePixels + 59560}, {98, 12, planeCachePixels + 59562}, {166, 2, planeCachePixels + 59574},
+{101, 11, planeCachePixels + 59576}, {166, 2, planeCachePixels + 59587}, {104, 11, planeCachePixels + 59589}, {165, 3, planeCachePixels + 59600},
+{104, 13, planeCachePixels + 59603}, {165, 2, planeCachePixels + 59616}, {106, 14, planeCachePixels + 59618}, {165, 2, planeCachePixels + 59632},
+{109, 14, planeCachePixels + 59634}, {164, 2, planeCachePixels + 59648}, {111, 14, planeCachePixels + 59650}, {164, 2, planeCachePixels + 59664},
+{114, 14, planeCachePixels + 59666}, {163, 3, planeCachePixels + 59680}, {116, 14, planeCachePixels + 59683}, {138, 4, planeCachePixels + 59697},
+{163, 2, planeCachePixels + 59701}, {119, 14, planeCachePixels + 59703}, {139, 5, planeCachePixels + 59717}, {163, 2, planeCachePixels + 59722},
+{122, 14, planeCachePixels + 59724}, {141, 6, planeCachePixels + 59738}, {157, 1, planeCachePixels + 59744}, {159, 7, planeCachePixels + 59745},
+{122, 16, planeCachePixels + 59752}, {144, 5, planeCachePixels + 59768}, {154, 1, planeCachePixels + 59773}, {156, 9, planeCachePixels + 59774},
+{124, 17, planeCachePixels + 59783}, {146, 6, planeCachePixels + 59800}, {153, 13, planeCachePixels + 59806}, {127, 16, planeCachePixels + 59819},
+{146, 21, planeCachePixels + 59835}, {129, 17, planeCachePixels + 59856}, {149, 19, planeCachePixels + 59873}, {132, 17, planeCachePixels + 59892},
+{151, 17, planeCachePixels + 59909}, {135, 34, planeCachePixels + 59926}, {135, 34, planeCachePixels + 59960}, {137, 33, planeCachePixels + 59994},
+{140, 30, planeCachePixels + 60027}, {142, 31, planeCachePixels + 60057}, {145, 30, planeCachePixels + 60088}, {147, 21, planeCachePixels + 60118},
+{170, 8, planeCachePixels + 60139}, {150, 20, planeCachePixels + 60147}, {172, 9, planeCachePixels + 60167}, {152, 20, planeCachePixels + 60176},
+{178, 5, planeCachePixels + 60196}, {152, 23, planeCachePixels + 60201}, {180, 3, planeCachePixels + 60224}, {153, 24, planeCachePixels + 60227},
+{155, 25, planeCachePixels + 60251}, {155, 28, planeCachePixels + 60276}, {157, 2, planeCachePixels + 60304}, {160, 1, planeCachePixels + 60306},
+{166, 19, planeCachePixels + 60307}, {168, 20, planeCachePixels + 60326}, {171, 19, planeCachePixels + 60346}, {173, 20, planeCachePixels + 60365},
+{176, 20, planeCachePixels + 60385}, {179, 19, planeCachePixels + 60405}, {184, 17, planeCachePixels + 60424}, {187, 16, planeCachePixels + 60441},
+{189, 17, planeCachePixels + 60457}, {192, 17, planeCachePixels + 60474}, {194, 1, planeCachePixels + 60491}, {197, 14, planeCachePixels + 60492},
+{200, 14, planeCachePixels + 60506}, {202, 14, planeCachePixels + 60520}, {205, 14, planeCachePixels + 60534}, {208, 14, planeCachePixels + 60548},
+{210, 14, planeCachePixels + 60562}, {213, 14, planeCachePixels + 60576}, {215, 2, planeCachePixels + 60590}, {218, 11, planeCachePixels + 60592},
+{221, 11, planeCachePixels + 60603}, {223, 12, planeCachePixels + 60614}, {226, 11, planeCachePixels + 60626}, {229, 8, planeCachePixels + 60637},
+{234, 3, planeCachePixels + 60645}, {83, 2, planeCachePixels + 60648}, {82, 5, planeCachePixels + 60650}, {82, 8, planeCachePixels + 60655},
+{84, 8, planeCachePixels + 60663}, {87, 8, planeCachePixels + 60671}, {89, 8, planeCachePixels + 60679}, {92, 8, planeCachePixels + 60687},
+{92, 10, planeCachePixels + 60695}, {94, 11, planeCachePixels + 60705}, {97, 10, planeCachePixels + 60716}, {167, 2, planeCachePixels + 60726},
+{99, 11, planeCachePixels + 60728}, {167, 2, planeCachePixels + 60739}, {101, 11, planeCachePixels + 60741}, {167, 2, planeCachePixels + 60752},
+{104, 11, planeCachePixels + 60754}, {166, 2, planeCachePixels + 60765}, {104, 13, planeCachePixels + 60767}, {166, 2, planeCachePixels + 60780},
+{106, 14, planeCachePixels + 60782}, {165, 3, planeCachePixels + 60796}, {109, 13, planeCachePixels + 60799}, {165, 2, planeCachePixels + 60812},
+{111, 14, planeCachePixels + 60814}, {165, 2, planeCachePixels + 60828}, {114, 13, planeCachePixels + 60830}, {164, 2, planeCachePixels + 60843},
+{116, 13, planeCachePixels + 60845}, {139, 1, planeCachePixels + 60858}, {164, 2, planeCachePixels + 60859}, {119, 13, planeCachePixels + 60861},
+{139, 4, planeCachePixels + 60874}, {163, 2, planeCachePixels + 60878}, {121, 13, planeCachePixels + 60880}, {140, 5, planeCachePixels + 60893},
+{163, 2, planeCachePixels + 60898}, {123, 14, planeCachePixels + 60900}, {142, 6, planeCachePixels + 60914}, {157, 1, planeCachePixels + 60920},
+{159, 7, planeCachePixels + 60921}, {123, 16, planeCachePixels + 60928}, {145, 5, planeCachePixels + 60944}, {156, 9, planeCachePixels + 60949},
+{126, 16, planeCachePixels + 60958}, {146, 20, planeCachePixels + 60974}, {128, 16, planeCachePixels + 60994}, {147, 20, planeCachePixels + 61010},
+{131, 16, planeCachePixels + 61030}, {149, 19, planeCachePixels + 61046}, {133, 16, planeCachePixels + 61065}, {152, 16, planeCachePixels + 61081},
+{135, 34, planeCachePixels + 61097}, {136, 33, planeCachePixels + 61131}, {138, 32, planeCachePixels + 61164}, {140, 30, planeCachePixels + 61196},
+{143, 29, planeCachePixels + 61226}, {145, 30, planeCachePixels + 61255}, {148, 20, planeCachePixels + 61285}, {169, 8, planeCachePixels + 61305},
+{150, 19, planeCachePixels + 61313}, {172, 8, planeCachePixels + 61332}, {151, 21, planeCachePixels + 61340}, {174, 1, planeCachePixels + 61361},
+{177, 5, planeCachePixels + 61362}, {153, 21, planeCachePixels + 61367}, {179, 4, planeCachePixels + 61388}, {153, 23, planeCachePixels + 61392},
+{182, 1, planeCachePixels + 61415}, {155, 24, planeCachePixels + 61416}, {155, 26, planeCachePixels + 61440}, {157, 2, planeCachePixels + 61466},
+{160, 1, planeCachePixels + 61468}, {165, 19, planeCachePixels + 61469}, {168, 18, planeCachePixels + 61488}, {170, 19, planeCachePixels + 61506},
+{173, 18, planeCachePixels + 61525}, {175, 19, planeCachePixels + 61543}, {178, 18, planeCachePixels + 61562}, {183, 16, planeCachePixels + 61580},
+{185, 16, planeCachePixels + 61596}, {188, 16, planeCachePixels + 61612}, {190, 16, planeCachePixels + 61628}, {193, 16, planeCachePixels + 61644},
+{198, 13, planeCachePixels + 61660}, {200, 14, planeCachePixels + 61673}, {203, 13, planeCachePixels + 61687}, {205, 14, planeCachePixels + 61700},
+{208, 13, planeCachePixels + 61714}, {210, 14, planeCachePixels + 61727}, {213, 13, planeCachePixels + 61741}, {215, 2, planeCachePixels + 61754},
+{218, 10, planeCachePixels + 61756}, {220, 11, planeCachePixels + 61766}, {223, 10, planeCachePixels + 61777}, {225, 11, planeCachePixels + 61787},
+{228, 9, planeCachePixels + 61798}, {233, 3, planeCachePixels + 61807}, {235, 1, planeCachePixels + 61810}, {83, 1, planeCachePixels + 61811},
+{83, 3, planeCachePixels + 61812}, {83, 6, planeCachePixels + 61815}, {83, 8, planeCachePixels + 61821}, {86, 7, planeCachePixels + 61829},
+{88, 8, planeCachePixels + 61836}, {90, 8, planeCachePixels + 61844}, {92, 8, planeCachePixels + 61852}, {92, 11, planeCachePixels + 61860},
+{95, 10, planeCachePixels + 61871}, {97, 10, planeCachePixels + 61881}, {100, 10, planeCachePixels + 61891}, {168, 1, planeCachePixels + 61901},
+{102, 10, planeCachePixels + 61902}, {167, 3, planeCachePixels + 61912}, {104, 10, planeCachePixels + 61915}, {167, 2, planeCachePixels + 61925},
+{105, 12, planeCachePixels + 61927}, {167, 2, planeCachePixels + 61939}, {106, 13, planeCachePixels + 61941}, {166, 2, planeCachePixels + 61954},
+{109, 13, planeCachePixels + 61956}, {166, 2, planeCachePixels + 61969}, {111, 13, planeCachePixels + 61971}, {165, 2, planeCachePixels + 61984},
+{113, 13, planeCachePixels + 61986}, {165, 2, planeCachePixels + 61999}, {116, 13, planeCachePixels + 62001}, {164, 3, planeCachePixels + 62014},
+{118, 13, planeCachePixels + 62017}, {139, 2, planeCachePixels + 62030}, {164, 2, planeCachePixels + 62032}, {121, 12, planeCachePixels + 62034},
+{139, 5, planeCachePixels + 62046}, {164, 2, planeCachePixels + 62051}, {123, 13, planeCachePixels + 62053}, {141, 5, planeCachePixels + 62066},
+{163, 2, planeCachePixels + 62071}, {123, 15, planeCachePixels + 62073}, {143, 5, planeCachePixels + 62088}, {157, 1, planeCachePixels + 62093},
+{159, 2, planeCachePixels + 62094}, {162, 4, planeCachePixels + 62096}, {125, 15, planeCachePixels + 62100}, {145, 6, planeCachePixels + 62115},
+{155, 11, planeCachePixels + 62121}, {127, 16, planeCachePixels + 62132}, {146, 20, planeCachePixels + 62148}, {130, 15, planeCachePixels + 62168},
+{148, 19, planeCachePixels + 62183}, {132, 15, planeCachePixels + 62202}, {150, 18, planeCachePixels + 62217}, {134, 16, planeCachePixels + 62235},
+{152, 16, planeCachePixels + 62251}, {135, 34, planeCachePixels + 62267}, {137, 32, planeCachePixels + 62301}, {139, 31, planeCachePixels + 62333},
+{141, 29, planeCachePixels + 62364}, {144, 28, planeCachePixels + 62393}, {146, 28, planeCachePixels + 62421}, {148, 20, planeCachePixels + 62449},
+{169, 8, planeCachePixels + 62469}, {151, 18, planeCachePixels + 62477}, {171, 8, planeCachePixels + 62495}, {151, 20, planeCachePixels + 62503},
+{174, 1, planeCachePixels + 62523}, {176, 5, planeCachePixels + 62524}, {153, 20, planeCachePixels + 62529}, {178, 5, planeCachePixels + 62549},
+{153, 23, planeCachePixels + 62554}, {181, 2, planeCachePixels + 62577}, {154, 24, planeCachePixels + 62579}, {155, 25, planeCachePixels + 62603},
+{157, 2, planeCachePixels + 62628}, {160, 1, planeCachePixels + 62630}, {165, 18, planeCachePixels + 62631}, {167, 18, planeCachePixels + 62649},
+{170, 17, planeCachePixels + 62667}, {172, 18, planeCachePixels + 62684}, {174, 18, planeCachePixels + 62702}, {177, 18, planeCachePixels + 62720},
+{179, 1, planeCachePixels + 62738}, {182, 15, planeCachePixels + 62739}, {184, 15, planeCachePixels + 62754}, {186, 16, planeCachePixels + 62769},
+{189, 15, planeCachePixels + 62785}, {191, 15, planeCachePixels + 62800}, {193, 1, planeCachePixels + 62815}, {196, 13, planeCachePixels + 62816},
+{198, 13, planeCachePixels + 62829}, {201, 12, planeCachePixels + 62842}, {203, 13, planeCachePixels + 62854}, {205, 13, planeCachePixels + 62867},
+{208, 12, planeCachePixels + 62880}, {210, 13, planeCachePixels + 62892}, {212, 13, planeCachePixels + 62905}, {215, 1, planeCachePixels + 62918},
+{217, 11, planeCachePixels + 62919}, {220, 10, planeCachePixels + 62930}, {222, 10, planeCachePixels + 62940}, {224, 11, planeCachePixels + 62950},
+{227, 9, planeCachePixels + 62961}, {232, 4, planeCachePixels + 62970}, {234, 1, planeCachePixels + 62974}, {84, 1, planeCachePixels + 62975},
+{83, 4, planeCachePixels + 62976}, {83, 7, planeCachePixels + 62980}, {85, 7, planeCachePixels + 62987}, {87, 7, planeCachePixels + 62994},
+{89, 7, planeCachePixels + 63001}, {91, 8, planeCachePixels + 63008}, {93, 8, planeCachePixels + 63016}, {93, 10, planeCachePixels + 63024},
+{96, 9, planeCachePixels + 63034}, {98, 10, planeCachePixels + 63043}, {100, 10, planeCachePixels + 63053}, {102, 10, planeCachePixels + 63063},
+{168, 1, planeCachePixels + 63073}, {105, 9, planeCachePixels + 63074}, {168, 2, planeCachePixels + 63083}, {105, 12, planeCachePixels + 63085},
+{167, 3, planeCachePixels + 63097}, {107, 12, planeCachePixels + 63100}, {167, 2, planeCachePixels + 63112}, {109, 12, planeCachePixels + 63114},
+{166, 3, planeCachePixels + 63126}, {111, 12, planeCachePixels + 63129}, {166, 2, planeCachePixels + 63141}, {113, 13, planeCachePixels + 63143},
+{166, 2, planeCachePixels + 63156}, {116, 12, planeCachePixels + 63158}, {165, 2, planeCachePixels + 63170}, {118, 12, planeCachePixels + 63172},
+{139, 1, planeCachePixels + 63184}, {165, 2, planeCachePixels + 63185}, {120, 12, planeCachePixels + 63187}, {139, 3, planeCachePixels + 63199},
+{164, 2, planeCachePixels + 63202}, {122, 13, planeCachePixels + 63204}, {139, 5, planeCachePixels + 63217}, {164, 2, planeCachePixels + 63222},
+{123, 14, planeCachePixels + 63224}, {142, 5, planeCachePixels + 63238}, {163, 2, planeCachePixels + 63243}, {124, 15, planeCachePixels + 63245},
+{144, 5, planeCachePixels + 63260}, {157, 2, planeCachePixels + 63265}, {160, 1, planeCachePixels + 63267}, {162, 4, planeCachePixels + 63268},
+{127, 14, planeCachePixels + 63272}, {146, 5, planeCachePixels + 63286}, {155, 11, planeCachePixels + 63291}, {129, 15, planeCachePixels + 63302},
+{146, 20, planeCachePixels + 63317}, {131, 15, planeCachePixels + 63337}, {148, 19, planeCachePixels + 63352}, {133, 15, planeCachePixels + 63371},
+{150, 18, planeCachePixels + 63386}, {135, 15, planeCachePixels + 63404}, {152, 16, planeCachePixels + 63419}, {135, 34, planeCachePixels + 63435},
+{138, 32, planeCachePixels + 63469}, {140, 29, planeCachePixels + 63501}, {142, 28, planeCachePixels + 63530}, {144, 27, planeCachePixels + 63558},
+{147, 27, planeCachePixels + 63585}, {149, 27, planeCachePixels + 63612}, {151, 17, planeCachePixels + 63639}, {171, 7, planeCachePixels + 63656},
+{151, 20, planeCachePixels + 63663}, {173, 7, planeCachePixels + 63683}, {153, 20, planeCachePixels + 63690}, {178, 5, planeCachePixels + 63710},
+{153, 22, planeCachePixels + 63715}, {180, 3, planeCachePixels + 63737}, {154, 23, planeCachePixels + 63740}, {182, 1, planeCachePixels + 63763},
+{155, 24, planeCachePixels + 63764}, {157, 2, planeCachePixels + 63788}, {160, 1, planeCachePixels + 63790}, {165, 17, planeCachePixels + 63791},
+{167, 17, planeCachePixels + 63808}, {169, 17, planeCachePixels + 63825}, {171, 17, planeCachePixels + 63842}, {174, 17, planeCachePixels + 63859},
+{176, 17, planeCachePixels + 63876}, {178, 17, planeCachePixels + 63893}, {183, 14, planeCachePixels + 63910}, {185, 15, planeCachePixels + 63924},
+{187, 15, planeCachePixels + 63939}, {189, 15, planeCachePixels + 63954}, {192, 14, planeCachePixels + 63969}, {196, 13, planeCachePixels + 63983},
+{199, 12, planeCachePixels + 63996}, {201, 12, planeCachePixels + 64008}, {203, 12, planeCachePixels + 64020}, {205, 13, planeCachePixels + 64032},
+{208, 12, planeCachePixels + 64045}, {210, 12, planeCachePixels + 64057}, {212, 12, planeCachePixels + 64069}, {214, 2, planeCachePixels + 64081},
+{217, 10, planeCachePixels + 64083}, {219, 10, planeCachePixels + 64093}, {221, 10, planeCachePixels + 64103}, {224, 9, planeCachePixels + 64113},
+{226, 10, planeCachePixels + 64122}, {228, 1, planeCachePixels + 64132}, {231, 4, planeCachePixels + 64133}, {233, 2, planeCachePixels + 64137},
+{84, 2, planeCachePixels + 64139}, {84, 5, planeCachePixels + 64141}, {84, 7, planeCachePixels + 64146}, {86, 7, planeCachePixels + 64153},
+{88, 7, planeCachePixels + 64160}, {90, 7, planeCachePixels + 64167}, {92, 7, planeCachePixels + 64174}, {93, 8, planeCachePixels + 64181},
+{94, 10, planeCachePixels + 64189}, {96, 10, planeCachePixels + 64199}, {98, 10, planeCachePixels + 64209}, {101, 9, planeCachePixels + 64219},
+{103, 9, planeCachePixels + 64228}, {105, 9, planeCachePixels + 64237}, {105, 11, planeCachePixels + 64246}, {168, 2, planeCachePixels + 64257},
+{107, 12, planeCachePixels + 64259}, {168, 2, planeCachePixels + 64271}, {109, 12, planeCachePixels + 64273}, {167, 2, planeCachePixels + 64285},
+{111, 12, planeCachePixels + 64287}, {167, 2, planeCachePixels + 64299}, {113, 12, planeCachePixels + 64301}, {166, 3, planeCachePixels + 64313},
+{115, 12, planeCachePixels + 64316}, {166, 2, planeCachePixels + 64328}, {117, 12, planeCachePixels + 64330}, {165, 3, planeCachePixels + 64342},
+{120, 11, planeCachePixels + 64345}, {140, 1, planeCachePixels + 64356}, {165, 2, planeCachePixels + 64357}, {122, 12, planeCachePixels + 64359},
+{139, 4, planeCachePixels + 64371}, {164, 3, planeCachePixels + 64375}, {123, 13, planeCachePixels + 64378}, {140, 5, planeCachePixels + 64391},
+{164, 2, planeCachePixels + 64396}, {124, 14, planeCachePixels + 64398}, {143, 4, planeCachePixels + 64412}, {164, 2, planeCachePixels + 64416},
+{126, 14, planeCachePixels + 64418}, {145, 4, planeCachePixels + 64432}, {156, 1, planeCachePixels + 64436}, {158, 1, planeCachePixels + 64437},
+{160, 1, planeCachePixels + 64438}, {162, 4, planeCachePixels + 64439}, {128, 14, planeCachePixels + 64443}, {146, 6, planeCachePixels + 64457},
+{155, 11, planeCachePixels + 64463}, {130, 14, planeCachePixels + 64474}, {147, 19, planeCachePixels + 64488}, {132, 14, planeCachePixels + 64507},
+{149, 18, planeCachePixels + 64521}, {134, 15, planeCachePixels + 64539}, {151, 17, planeCachePixels + 64554}, {135, 16, planeCachePixels + 64571},
+{152, 16, planeCachePixels + 64587}, {136, 33, planeCachePixels + 64603}, {138, 31, planeCachePixels + 64636}, {141, 28, planeCachePixels + 64667},
+{143, 27, planeCachePixels + 64695}, {145, 26, planeCachePixels + 64722}, {147, 26, planeCachePixels + 64748}, {149, 26, planeCachePixels + 64774},
+{151, 17, planeCachePixels + 64800}, {170, 7, planeCachePixels + 64817}, {151, 19, planeCachePixels + 64824}, {172, 8, planeCachePixels + 64843},
+{153, 19, planeCachePixels + 64851}, {177, 5, planeCachePixels + 64870}, {153, 21, planeCachePixels + 64875}, {179, 4, planeCachePixels + 64896},
+{154, 22, planeCachePixels + 64900}, {181, 2, planeCachePixels + 64922}, {155, 24, planeCachePixels + 64924}, {157, 4, planeCachePixels + 64948},
+{164, 17, planeCachePixels + 64952}, {166, 17, planeCachePixels + 64969}, {168, 17, planeCachePixels + 64986}, {171, 16, planeCachePixels + 65003},
+{173, 16, planeCachePixels + 65019}, {175, 16, planeCachePixels + 65035}, {177, 17, planeCachePixels + 65051}, {179, 1, planeCachePixels + 65068},
+{182, 14, planeCachePixels + 65069}, {184, 14, planeCachePixels + 65083}, {186, 14, planeCachePixels + 65097}, {188, 14, planeCachePixels + 65111},
+{190, 14, planeCachePixels + 65125}, {192, 2, planeCachePixels + 65139}, {195, 11, planeCachePixels + 65141}, {197, 12, planeCachePixels + 65152},
+{199, 12, planeCachePixels + 65164}, {201, 12, planeCachePixels + 65176}, {203, 12, planeCachePixels + 65188}, {205, 12, planeCachePixels + 65200},
+{208, 11, planeCachePixels + 65212}, {210, 12, planeCachePixels + 65223}, {212, 12, planeCachePixels + 65235}, {214, 1, planeCachePixels + 65247},
+{216, 10, planeCachePixels + 65248}, {218, 10, planeCachePixels + 65258}, {221, 9, planeCachePixels + 65268}, {223, 9, planeCachePixels + 65277},
+{225, 9, planeCachePixels + 65286}, {227, 1, planeCachePixels + 65295}, {229, 6, planeCachePixels + 65296}, {232, 2, planeCachePixels + 65302},
+{85, 1, planeCachePixels + 65304}, {85, 3, planeCachePixels + 65305}, {84, 6, planeCachePixels + 65308}, {85, 7, planeCachePixels + 65314},
+{87, 7, planeCachePixels + 65321}, {89, 7, planeCachePixels + 65328}, {91, 7, planeCachePixels + 65335}, {93, 7, planeCachePixels + 65342},
+{93, 9, planeCachePixels + 65349}, {95, 9, planeCachePixels + 65358}, {97, 9, planeCachePixels + 65367}, {99, 9, planeCachePixels + 65376},
+{101, 9, planeCachePixels + 65385}, {103, 9, planeCachePixels + 65394}, {105, 9, planeCachePixels + 65403}, {106, 10, planeCachePixels + 65412},
+{107, 11, planeCachePixels + 65422}, {169, 2, planeCachePixels + 65433}, {109, 11, planeCachePixels + 65435}, {168, 2, planeCachePixels + 65446},
+{111, 11, planeCachePixels + 65448}, {168, 2, planeCachePixels + 65459}, {113, 12, planeCachePixels + 65461}, {167, 2, planeCachePixels + 65473},
+{115, 12, planeCachePixels + 65475}, {167, 2, planeCachePixels + 65487}, {117, 12, planeCachePixels + 65489}, {166, 2, planeCachePixels + 65501},
+{119, 12, planeCachePixels + 65503}, {166, 2, planeCachePixels + 65515}, {121, 12, planeCachePixels + 65517}, {140, 2, planeCachePixels + 65529},
+{165, 2, planeCachePixels + 65531}, {123, 12, planeCachePixels + 65533}, {139, 5, planeCachePixels + 65545}, {165, 2, planeCachePixels + 65550},
+{123, 14, planeCachePixels + 65552}, {141, 5, planeCachePixels + 65566}, {164, 2, planeCachePixels + 65571}, {125, 14, planeCachePixels + 65573},
+{143, 5, planeCachePixels + 65587}, {164, 2, planeCachePixels + 65592}, {127, 14, planeCachePixels + 65594}, {145, 5, planeCachePixels + 65608},
+{158, 1, planeCachePixels + 65613}, {160, 1, planeCachePixels + 65614}, {162, 4, planeCachePixels + 65615}, {129, 14, planeCachePixels + 65619},
+{146, 6, planeCachePixels + 65633}, {155, 11, planeCachePixels + 65639}, {131, 14, planeCachePixels + 65650}, {147, 19, planeCachePixels + 65664},
+{133, 14, planeCachePixels + 65683}, {149, 18, planeCachePixels + 65697}, {135, 14, planeCachePixels + 65715}, {151, 16, planeCachePixels + 65729},
+{135, 16, planeCachePixels + 65745}, {152, 17, planeCachePixels + 65761}, {137, 32, planeCachePixels + 65778}, {139, 30, planeCachePixels + 65810},
+{141, 28, planeCachePixels + 65840}, {143, 27, planeCachePixels + 65868}, {145, 26, planeCachePixels + 65895}, {147, 26, planeCachePixels + 65921},
+{150, 25, planeCachePixels + 65947}, {151, 17, planeCachePixels + 65972}, {170, 7, planeCachePixels + 65989}, {151, 19, planeCachePixels + 65996},
+{172, 7, planeCachePixels + 66015}, {153, 19, planeCachePixels + 66022}, {174, 1, planeCachePixels + 66041}, {176, 5, planeCachePixels + 66042},
+{153, 21, planeCachePixels + 66047}, {178, 5, planeCachePixels + 66068}, {154, 22, planeCachePixels + 66073}, {180, 3, planeCachePixels + 66095},
+{155, 23, planeCachePixels + 66098}, {157, 1, planeCachePixels + 66121}, {159, 2, planeCachePixels + 66122}, {164, 16, planeCachePixels + 66124},
+{166, 16, planeCachePixels + 66140}, {168, 16, planeCachePixels + 66156}, {170, 16, planeCachePixels + 66172}, {172, 16, planeCachePixels + 66188},
+{174, 16, planeCachePixels + 66204}, {176, 16, planeCachePixels + 66220}, {178, 1, planeCachePixels + 66236}, {181, 13, planeCachePixels + 66237},
+{183, 13, planeCachePixels + 66250}, {185, 13, planeCachePixels + 66263}, {187, 13, planeCachePixels + 66276}, {189, 13, planeCachePixels + 66289},
+{191, 13, planeCachePixels + 66302}, {195, 12, planeCachePixels + 66315}, {197, 12, planeCachePixels + 66327}, {199, 12, planeCachePixels + 66339},
+{201, 12, planeCachePixels + 66351}, {203, 12, planeCachePixels + 66363}, {205, 12, planeCachePixels + 66375}, {207, 12, planeCachePixels + 66387},
+{209, 12, planeCachePixels + 66399}, {212, 11, planeCachePixels + 66411}, {216, 9, planeCachePixels + 66422}, {218, 9, planeCachePixels + 66431},
+{220, 9, planeCachePixels + 66440}, {222, 9, planeCachePixels + 66449}, {224, 9, planeCachePixels + 66458}, {226, 8, planeCachePixels + 66467},
+{230, 4, planeCachePixels + 66475}, {232, 1, planeCachePixels + 66479}, {86, 1, planeCachePixels + 66480}, {85, 4, planeCachePixels + 66481},
+{85, 6, planeCachePixels + 66485}, {86, 7, planeCachePixels + 66491}, {88, 7, planeCachePixels + 66498}, {90, 7, planeCachePixels + 66505},
+{92, 7, planeCachePixels + 66512}, {94, 7, planeCachePixels + 66519}, {94, 8, planeCachePixels + 66526}, {96, 8, planeCachePixels + 66534},
+{98, 8, planeCachePixels + 66542}, {100, 8, planeCachePixels + 66550}, {102, 8, planeCachePixels + 66558}, {103, 9, planeCachePixels + 66566},
+{105, 9, planeCachePixels + 66575}, {106, 10, planeCachePixels + 66584}, {107, 11, planeCachePixels + 66594}, {109, 11, planeCachePixels + 66605},
+{169, 2, planeCachePixels + 66616}, {111, 11, planeCachePixels + 66618}, {168, 3, planeCachePixels + 66629}, {113, 11, planeCachePixels + 66632},
+{168, 2, planeCachePixels + 66643}, {115, 11, planeCachePixels + 66645}, {167, 3, planeCachePixels + 66656}, {117, 11, planeCachePixels + 66659},
+{167, 2, planeCachePixels + 66670}, {119, 11, planeCachePixels + 66672}, {166, 3, planeCachePixels + 66683}, {121, 11, planeCachePixels + 66686},
+{140, 1, planeCachePixels + 66697}, {166, 2, planeCachePixels + 66698}, {123, 11, planeCachePixels + 66700}, {140, 3, planeCachePixels + 66711},
+{165, 3, planeCachePixels + 66714}, {123, 13, planeCachePixels + 66717}, {140, 5, planeCachePixels + 66730}, {165, 2, planeCachePixels + 66735},
+{125, 13, planeCachePixels + 66737}, {142, 5, planeCachePixels + 66750}, {164, 3, planeCachePixels + 66755}, {127, 13, planeCachePixels + 66758},
+{144, 5, planeCachePixels + 66771}, {164, 2, planeCachePixels + 66776}, {129, 13, planeCachePixels + 66778}, {146, 5, planeCachePixels + 66791},
+{158, 1, planeCachePixels + 66796}, {160, 6, planeCachePixels + 66797}, {130, 14, planeCachePixels + 66803}, {146, 7, planeCachePixels + 66817},
+{154, 12, planeCachePixels + 66824}, {132, 14, planeCachePixels + 66836}, {148, 18, planeCachePixels + 66850}, {134, 14, planeCachePixels + 66868},
+{150, 17, planeCachePixels + 66882}, {136, 14, planeCachePixels + 66899}, {152, 15, planeCachePixels + 66913}, {136, 33, planeCachePixels + 66928},
+{138, 31, planeCachePixels + 66961}, {140, 29, planeCachePixels + 66992}, {142, 27, planeCachePixels + 67021}, {144, 26, planeCachePixels + 67048},
+{146, 24, planeCachePixels + 67074}, {148, 24, planeCachePixels + 67098}, {150, 24, planeCachePixels + 67122}, {151, 17, planeCachePixels + 67146},
+{169, 7, planeCachePixels + 67163}, {152, 17, planeCachePixels + 67170}, {171, 7, planeCachePixels + 67187}, {152, 19, planeCachePixels + 67194},
+{173, 2, planeCachePixels + 67213}, {176, 4, planeCachePixels + 67215}, {153, 20, planeCachePixels + 67219}, {178, 4, planeCachePixels + 67239},
+{154, 21, planeCachePixels + 67243}, {180, 3, planeCachePixels + 67264}, {155, 22, planeCachePixels + 67267}, {181, 1, planeCachePixels + 67289},
+{157, 1, planeCachePixels + 67290}, {159, 1, planeCachePixels + 67291}, {161, 1, planeCachePixels + 67292}, {164, 15, planeCachePixels + 67293},
+{166, 15, planeCachePixels + 67308}, {168, 15, planeCachePixels + 67323}, {169, 16, planeCachePixels + 67338}, {171, 16, planeCachePixels + 67354},
+{173, 16, planeCachePixels + 67370}, {175, 16, planeCachePixels + 67386}, {177, 2, planeCachePixels + 67402}, {180, 13, planeCachePixels + 67404},
+{182, 13, planeCachePixels + 67417}, {183, 14, planeCachePixels + 67430}, {185, 14, planeCachePixels + 67444}, {187, 14, planeCachePixels + 67458},
+{189, 14, planeCachePixels + 67472}, {191, 2, planeCachePixels + 67486}, {194, 11, planeCachePixels + 67488}, {195, 12, planeCachePixels + 67499},
+{197, 11, planeCachePixels + 67511}, {199, 11, planeCachePixels + 67522}, {201, 11, planeCachePixels + 67533}, {203, 11, planeCachePixels + 67544},
+{205, 11, planeCachePixels + 67555}, {207, 11, planeCachePixels + 67566}, {209, 11, planeCachePixels + 67577}, {211, 11, planeCachePixels + 67588},
+{213, 1, planeCachePixels + 67599}, {215, 9, planeCachePixels + 67600}, {217, 9, planeCachePixels + 67609}, {219, 9, planeCachePixels + 67618},
+{221, 9, planeCachePixels + 67627}, {223, 9, planeCachePixels + 67636}, {225, 9, planeCachePixels + 67645}, {229, 4, planeCachePixels + 67654},
+{231, 2, planeCachePixels + 67658}, {86, 2, planeCachePixels + 67660}, {86, 4, planeCachePixels + 67662}, {85, 7, planeCachePixels + 67666},
+{87, 7, planeCachePixels + 67673}, {89, 6, planeCachePixels + 67680}, {91, 6, planeCachePixels + 67686}, {93, 6, planeCachePixels + 67692},
+{95, 6, planeCachePixels + 67698}, {94, 9, planeCachePixels + 67704}, {96, 9, planeCachePixels + 67713}, {98, 9, planeCachePixels + 67722},
+{100, 9, planeCachePixels + 67731}, {102, 9, planeCachePixels + 67740}, {104, 8, planeCachePixels + 67749}, {106, 8, planeCachePixels + 67757},
+{106, 10, planeCachePixels + 67765}, {107, 11, planeCachePixels + 67775}, {109, 11, planeCachePixels + 67786}, {111, 11, planeCachePixels + 67797},
+{169, 2, planeCachePixels + 67808}, {113, 11, planeCachePixels + 67810}, {169, 2, planeCachePixels + 67821}, {115, 11, planeCachePixels + 67823},
+{168, 3, planeCachePixels + 67834}, {117, 10, planeCachePixels + 67837}, {168, 2, planeCachePixels + 67847}, {119, 10, planeCachePixels + 67849},
+{167, 3, planeCachePixels + 67859}, {121, 10, planeCachePixels + 67862}, {167, 2, planeCachePixels + 67872}, {122, 11, planeCachePixels + 67874},
+{140, 2, planeCachePixels + 67885}, {166, 3, planeCachePixels + 67887}, {124, 11, planeCachePixels + 67890}, {140, 4, planeCachePixels + 67901},
+{166, 2, planeCachePixels + 67905}, {124, 13, planeCachePixels + 67907}, {141, 4, planeCachePixels + 67920}, {165, 2, planeCachePixels + 67924},
+{126, 13, planeCachePixels + 67926}, {143, 4, planeCachePixels + 67939}, {165, 2, planeCachePixels + 67943}, {128, 13, planeCachePixels + 67945},
+{145, 4, planeCachePixels + 67958}, {164, 2, planeCachePixels + 67962}, {130, 13, planeCachePixels + 67964}, {147, 4, planeCachePixels + 67977},
+{158, 8, planeCachePixels + 67981}, {132, 12, planeCachePixels + 67989}, {147, 6, planeCachePixels + 68001}, {154, 12, planeCachePixels + 68007},
+{133, 13, planeCachePixels + 68019}, {148, 18, planeCachePixels + 68032}, {135, 13, planeCachePixels + 68050}, {150, 17, planeCachePixels + 68063},
+{135, 15, planeCachePixels + 68080}, {152, 15, planeCachePixels + 68095}, {137, 32, planeCachePixels + 68110}, {139, 30, planeCachePixels + 68142},
+{141, 28, planeCachePixels + 68172}, {143, 27, planeCachePixels + 68200}, {145, 25, planeCachePixels + 68227}, {146, 24, planeCachePixels + 68252},
+{148, 24, planeCachePixels + 68276}, {150, 24, planeCachePixels + 68300}, {151, 17, planeCachePixels + 68324}, {169, 6, planeCachePixels + 68341},
+{152, 17, planeCachePixels + 68347}, {171, 6, planeCachePixels + 68364}, {152, 19, planeCachePixels + 68370}, {173, 6, planeCachePixels + 68389},
+{153, 20, planeCachePixels + 68395}, {177, 4, planeCachePixels + 68415}, {153, 21, planeCachePixels + 68419}, {179, 4, planeCachePixels + 68440},
+{155, 21, planeCachePixels + 68444}, {181, 1, planeCachePixels + 68465}, {157, 1, planeCachePixels + 68466}, {159, 1, planeCachePixels + 68467},
+{163, 15, planeCachePixels + 68468}, {165, 15, planeCachePixels + 68483}, {167, 15, planeCachePixels + 68498}, {169, 15, planeCachePixels + 68513},
+{171, 15, planeCachePixels + 68528}, {173, 15, planeCachePixels + 68543}, {175, 15, planeCachePixels + 68558}, {176, 15, planeCachePixels + 68573},
+{178, 1, planeCachePixels + 68588}, {181, 12, planeCachePixels + 68589}, {182, 13, planeCachePixels + 68601}, {184, 13, planeCachePixels + 68614},
+{186, 13, planeCachePixels + 68627}, {188, 13, planeCachePixels + 68640}, {190, 13, planeCachePixels + 68653}, {194, 11, planeCachePixels + 68666},
+{196, 10, planeCachePixels + 68677}, {198, 10, planeCachePixels + 68687}, {200, 10, planeCachePixels + 68697}, {201, 11, planeCachePixels + 68707},
+{203, 11, planeCachePixels + 68718}, {205, 11, planeCachePixels + 68729}, {207, 11, planeCachePixels + 68740}, {209, 11, planeCachePixels + 68751},
+{211, 10, planeCachePixels + 68762}, {215, 8, planeCachePixels + 68772}, {217, 8, planeCachePixels + 68780}, {219, 8, planeCachePixels + 68788},
+{221, 8, planeCachePixels + 68796}, {222, 9, planeCachePixels + 68804}, {224, 9, planeCachePixels + 68813}, {228, 5, planeCachePixels + 68822},
+{230, 2, planeCachePixels + 68827}, {87, 2, planeCachePixels + 68829}, {86, 5, planeCachePixels + 68831}, {87, 6, planeCachePixels + 68836},
+{88, 7, planeCachePixels + 68842}, {90, 6, planeCachePixels + 68849}, {92, 6, planeCachePixels + 68855}, {94, 6, planeCachePixels + 68861},
+{95, 7, planeCachePixels + 68867}, {95, 9, planeCachePixels + 68874}, {97, 8, planeCachePixels + 68883}, {99, 8, planeCachePixels + 68891},
+{101, 8, planeCachePixels + 68899}, {103, 8, planeCachePixels + 68907}, {104, 9, planeCachePixels + 68915}, {106, 8, planeCachePixels + 68924},
+{107, 9, planeCachePixels + 68932}, {108, 10, planeCachePixels + 68941}, {109, 11, planeCachePixels + 68951}, {111, 11, planeCachePixels + 68962},
+{113, 10, planeCachePixels + 68973}, {170, 1, planeCachePixels + 68983}, {115, 10, planeCachePixels + 68984}, {169, 3, planeCachePixels + 68994},
+{117, 10, planeCachePixels + 68997}, {169, 2, planeCachePixels + 69007}, {118, 11, planeCachePixels + 69009}, {168, 2, planeCachePixels + 69020},
+{120, 11, planeCachePixels + 69022}, {168, 2, planeCachePixels + 69033}, {122, 10, planeCachePixels + 69035}, {167, 2, planeCachePixels + 69045},
+{124, 10, planeCachePixels + 69047}, {140, 2, planeCachePixels + 69057}, {167, 2, planeCachePixels + 69059}, {124, 12, planeCachePixels + 69061},
+{140, 4, planeCachePixels + 69073}, {166, 2, planeCachePixels + 69077}, {125, 13, planeCachePixels + 69079}, {142, 4, planeCachePixels + 69092},
+{165, 3, planeCachePixels + 69096}, {127, 13, planeCachePixels + 69099}, {144, 4, planeCachePixels + 69112}, {165, 2, planeCachePixels + 69116},
+{129, 12, planeCachePixels + 69118}, {146, 4, planeCachePixels + 69130}, {164, 3, planeCachePixels + 69134}, {131, 12, planeCachePixels + 69137},
+{147, 4, planeCachePixels + 69149}, {157, 5, planeCachePixels + 69153}, {163, 3, planeCachePixels + 69158}, {133, 12, planeCachePixels + 69161},
+{147, 6, planeCachePixels + 69173}, {154, 13, planeCachePixels + 69179}, {134, 13, planeCachePixels + 69192}, {149, 17, planeCachePixels + 69205},
+{136, 13, planeCachePixels + 69222}, {151, 16, planeCachePixels + 69235}, {136, 14, planeCachePixels + 69251}, {152, 15, planeCachePixels + 69265},
+{138, 31, planeCachePixels + 69280}, {140, 28, planeCachePixels + 69311}, {141, 28, planeCachePixels + 69339}, {143, 27, planeCachePixels + 69367},
+{145, 25, planeCachePixels + 69394}, {147, 23, planeCachePixels + 69419}, {149, 22, planeCachePixels + 69442}, {150, 23, planeCachePixels + 69464},
+{151, 17, planeCachePixels + 69487}, {169, 6, planeCachePixels + 69504}, {152, 16, planeCachePixels + 69510}, {171, 6, planeCachePixels + 69526},
+{152, 18, planeCachePixels + 69532}, {172, 7, planeCachePixels + 69550}, {154, 18, planeCachePixels + 69557}, {176, 4, planeCachePixels + 69575},
+{153, 21, planeCachePixels + 69579}, {178, 4, planeCachePixels + 69600}, {155, 21, planeCachePixels + 69604}, {180, 2, planeCachePixels + 69625},
+{157, 1, planeCachePixels + 69627}, {159, 1, planeCachePixels + 69628}, {163, 15, planeCachePixels + 69629}, {165, 14, planeCachePixels + 69644},
+{167, 14, planeCachePixels + 69658}, {168, 15, planeCachePixels + 69672}, {170, 15, planeCachePixels + 69687}, {172, 15, planeCachePixels + 69702},
+{174, 14, planeCachePixels + 69717}, {176, 14, planeCachePixels + 69731}, {178, 1, planeCachePixels + 69745}, {180, 12, planeCachePixels + 69746},
+{181, 13, planeCachePixels + 69758}, {183, 13, planeCachePixels + 69771}, {185, 12, planeCachePixels + 69784}, {187, 12, planeCachePixels + 69796},
+{189, 12, planeCachePixels + 69808}, {190, 13, planeCachePixels + 69820}, {194, 11, planeCachePixels + 69833}, {196, 10, planeCachePixels + 69844},
+{198, 10, planeCachePixels + 69854}, {200, 10, planeCachePixels + 69864}, {201, 11, planeCachePixels + 69874}, {203, 11, planeCachePixels + 69885},
+{205, 10, planeCachePixels + 69896}, {207, 10, planeCachePixels + 69906}, {209, 10, planeCachePixels + 69916}, {210, 11, planeCachePixels + 69926},
+{212, 1, planeCachePixels + 69937}, {214, 9, planeCachePixels + 69938}, {216, 8, planeCachePixels + 69947}, {218, 8, planeCachePixels + 69955},
+{220, 8, planeCachePixels + 69963}, {222, 8, planeCachePixels + 69971}, {223, 9, planeCachePixels + 69979}, {227, 5, planeCachePixels + 69988},
+{229, 3, planeCachePixels + 69993}, {87, 3, planeCachePixels + 69996}, {87, 5, planeCachePixels + 69999}, {88, 6, planeCachePixels + 70004},
+{89, 6, planeCachePixels + 70010}, {91, 6, planeCachePixels + 70016}, {93, 6, planeCachePixels + 70022}, {95, 6, planeCachePixels + 70028},
+{96, 6, planeCachePixels + 70034}, {96, 8, planeCachePixels + 70040}, {98, 8, planeCachePixels + 70048}, {100, 8, planeCachePixels + 70056},
+{101, 8, planeCachePixels + 70064}, {103, 8, planeCachePixels + 70072}, {105, 8, planeCachePixels + 70080}, {106, 8, planeCachePixels + 70088},
+{107, 9, planeCachePixels + 70096}, {108, 10, planeCachePixels + 70105}, {110, 10, planeCachePixels + 70115}, {111, 10, planeCachePixels + 70125},
+{113, 10, planeCachePixels + 70135}, {115, 10, planeCachePixels + 70145}, {170, 1, planeCachePixels + 70155}, {117, 10, planeCachePixels + 70156},
+{170, 2, planeCachePixels + 70166}, {118, 10, planeCachePixels + 70168}, {169, 2, planeCachePixels + 70178}, {120, 10, planeCachePixels + 70180},
+{169, 2, planeCachePixels + 70190}, {122, 10, planeCachePixels + 70192}, {168, 2, planeCachePixels + 70202}, {124, 10, planeCachePixels + 70204},
+{141, 1, planeCachePixels + 70214}, {167, 3, planeCachePixels + 70215}, {124, 11, planeCachePixels + 70218}, {140, 3, planeCachePixels + 70229},
+{167, 2, planeCachePixels + 70232}, {125, 12, planeCachePixels + 70234}, {141, 4, planeCachePixels + 70246}, {166, 3, planeCachePixels + 70250},
+{127, 12, planeCachePixels + 70253}, {143, 4, planeCachePixels + 70265}, {166, 2, planeCachePixels + 70269}, {128, 12, planeCachePixels + 70271},
+{144, 4, planeCachePixels + 70283}, {165, 2, planeCachePixels + 70287}, {130, 12, planeCachePixels + 70289}, {146, 4, planeCachePixels + 70301},
+{165, 2, planeCachePixels + 70305}, {132, 12, planeCachePixels + 70307}, {147, 5, planeCachePixels + 70319}, {157, 5, planeCachePixels + 70324},
+{163, 3, planeCachePixels + 70329}, {134, 12, planeCachePixels + 70332}, {148, 19, planeCachePixels + 70344}, {135, 12, planeCachePixels + 70363},
+{149, 17, planeCachePixels + 70375}, {136, 13, planeCachePixels + 70392}, {151, 16, planeCachePixels + 70405}, {137, 14, planeCachePixels + 70421},
+{152, 15, planeCachePixels + 70435}, {139, 30, planeCachePixels + 70450}, {140, 29, planeCachePixels + 70480}, {142, 27, planeCachePixels + 70509},
+{144, 26, planeCachePixels + 70536}, {146, 24, planeCachePixels + 70562}, {147, 23, planeCachePixels + 70586}, {149, 22, planeCachePixels + 70609},
+{151, 22, planeCachePixels + 70631}, {151, 23, planeCachePixels + 70653}, {152, 16, planeCachePixels + 70676}, {170, 6, planeCachePixels + 70692},
+{152, 18, planeCachePixels + 70698}, {172, 6, planeCachePixels + 70716}, {154, 18, planeCachePixels + 70722}, {176, 4, planeCachePixels + 70740},
+{153, 20, planeCachePixels + 70744}, {177, 4, planeCachePixels + 70764}, {155, 20, planeCachePixels + 70768}, {179, 3, planeCachePixels + 70788},
+{157, 1, planeCachePixels + 70791}, {159, 1, planeCachePixels + 70792}, {163, 14, planeCachePixels + 70793}, {181, 1, planeCachePixels + 70807},
+{165, 14, planeCachePixels + 70808}, {166, 14, planeCachePixels + 70822}, {168, 14, planeCachePixels + 70836}, {170, 14, planeCachePixels + 70850},
+{171, 14, planeCachePixels + 70864}, {173, 14, planeCachePixels + 70878}, {175, 14, planeCachePixels + 70892}, {177, 1, planeCachePixels + 70906},
+{179, 12, planeCachePixels + 70907}, {180, 12, planeCachePixels + 70919}, {182, 12, planeCachePixels + 70931}, {184, 12, planeCachePixels + 70943},
+{186, 12, planeCachePixels + 70955}, {187, 12, planeCachePixels + 70967}, {189, 12, planeCachePixels + 70979}, {191, 1, planeCachePixels + 70991},
+{193, 10, planeCachePixels + 70992}, {195, 10, planeCachePixels + 71002}, {196, 10, planeCachePixels + 71012}, {198, 10, planeCachePixels + 71022},
+{200, 10, planeCachePixels + 71032}, {201, 10, planeCachePixels + 71042}, {203, 10, planeCachePixels + 71052}, {205, 10, planeCachePixels + 71062},
+{207, 10, planeCachePixels + 71072}, {208, 10, planeCachePixels + 71082}, {210, 10, planeCachePixels + 71092}, {214, 8, planeCachePixels + 71102},
+{216, 8, planeCachePixels + 71110}, {217, 8, planeCachePixels + 71118}, {219, 8, planeCachePixels + 71126}, {221, 8, planeCachePixels + 71134},
+{223, 8, planeCachePixels + 71142}, {224, 1, planeCachePixels + 71150}, {226, 6, planeCachePixels + 71151}, {228, 3, planeCachePixels + 71157},
+};
+
+static const uint16_t planeCacheRowSpans[4923] PROGMEM = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 23, 25, 27,
+29, 31, 34, 37, 40, 43, 46, 50, 53, 55, 57, 59, 60, 61, 62, 63,
+64, 65, 66, 67, 68, 70, 72, 74, 76, 78, 83, 84, 85, 86, 87, 88,
+89, 90, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 118, 118, 118,
+118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 119, 120,
+121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
+137, 138, 140, 142, 144, 146, 148, 151, 154, 157, 160, 163, 168, 172, 174, 176,
+178, 180, 181, 182, 183, 184, 185, 186, 187, 188, 190, 192, 195, 197, 199, 204,
+205, 206, 207, 208, 209, 210, 211, 213, 214, 215, 216, 217, 218, 220, 221, 222,
+223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238,
+239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+255, 256, 257, 258, 260, 262, 264, 266, 268, 271, 274, 277, 280, 283, 288, 291,
+293, 295, 297, 299, 300, 301, 302, 303, 304, 305, 306, 307, 309, 311, 313, 315,
+317, 320, 321, 322, 323, 324, 325, 326, 327, 329, 330, 331, 332, 333, 334, 335,
+336, 337, 338, 339, 340, 341, 342, 344, 345, 346, 347, 348, 349, 350, 351, 352,
+353, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+354, 354, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+368, 369, 370, 372, 374, 376, 378, 380, 382, 384, 387, 390, 393, 396, 400, 403,
+406, 408, 410, 412, 413, 414, 415, 416, 417, 418, 419, 420, 422, 424, 426, 428,
+430, 434, 435, 436, 437, 438, 439, 440, 442, 443, 444, 445, 446, 447, 449, 450,
+451, 452, 453, 454, 455, 456, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467,
+467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467,
+467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467,
+467, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481,
+482, 484, 486, 488, 490, 492, 494, 496, 499, 502, 505, 508, 511, 514, 516, 518,
+520, 522, 523, 524, 525, 526, 527, 528, 529, 531, 533, 535, 537, 539, 541, 545,
+546, 547, 548, 549, 550, 551, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562,
+563, 564, 565, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 576, 576, 576,
+576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576,
+576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576, 577,
+578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 592, 594, 596,
+598, 600, 602, 604, 606, 609, 612, 615, 618, 621, 623, 625, 627, 629, 630, 631,
+632, 633, 634, 635, 636, 638, 640, 643, 645, 647, 648, 651, 652, 653, 654, 655,
+656, 657, 659, 660, 661, 662, 663, 665, 666, 667, 668, 669, 670, 671, 672, 673,
+674, 675, 676, 677, 678, 679, 680, 681, 681, 681, 681, 681, 681, 681, 681, 681,
+681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 681,
+681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 682, 683, 684, 685, 686, 687,
+688, 689, 690, 691, 692, 693, 695, 697, 699, 701, 703, 705, 707, 709, 712, 715,
+718, 722, 725, 728, 730, 732, 734, 735, 736, 737, 738, 739, 740, 741, 743, 745,
+748, 750, 752, 753, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 769,
+770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 782, 783, 784, 785, 785,
+785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785,
+785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785,
+785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 798, 800, 802, 804,
+806, 808, 810, 812, 815, 818, 821, 824, 827, 830, 832, 834, 836, 838, 839, 840,
+841, 842, 843, 844, 846, 848, 850, 852, 854, 855, 859, 860, 861, 862, 863, 864,
+866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881,
+883, 884, 885, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886,
+886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886,
+886, 886, 886, 886, 886, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 897,
+899, 901, 903, 905, 907, 909, 911, 913, 915, 918, 921, 925, 928, 931, 933, 935,
+937, 939, 940, 941, 942, 943, 944, 945, 947, 950, 952, 954, 955, 956, 959, 960,
+961, 962, 963, 964, 965, 966, 967, 968, 970, 971, 972, 973, 974, 975, 976, 977,
+978, 979, 980, 982, 983, 984, 985, 985, 985, 985, 985, 985, 985, 985, 985, 985,
+985, 985, 985, 985, 985, 985, 985, 985, 985, 985, 985, 985, 985, 985, 985, 985,
+985, 985, 985, 985, 985, 985, 985, 985, 985, 986, 987, 988, 989, 990, 991, 992,
+993, 995, 997, 999, 1001, 1003, 1005, 1007, 1009, 1011, 1013, 1016, 1019, 1023, 1026, 1029,
+1031, 1033, 1035, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1045, 1048, 1050, 1052, 1053, 1054,
+1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
+1075, 1076, 1077, 1078, 1080, 1081, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082,
+1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082,
+1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 1083, 1084, 1085, 1086, 1087,
+1088, 1090, 1092, 1094, 1096, 1098, 1100, 1102, 1104, 1106, 1108, 1111, 1114, 1118, 1121, 1124,
+1126, 1128, 1130, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1140, 1142, 1144, 1145, 1146, 1147,
+1150, 1151, 1152, 1153, 1154, 1156, 1157, 1158, 1159, 1161, 1162, 1163, 1164, 1165, 1166, 1168,
+1169, 1170, 1171, 1172, 1173, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1175, 1176, 1177, 1178, 1179, 1181, 1183, 1185,
+1187, 1189, 1191, 1193, 1195, 1197, 1199, 1201, 1204, 1207, 1210, 1213, 1215, 1217, 1219, 1221,
+1222, 1223, 1224, 1225, 1226, 1228, 1230, 1232, 1234, 1235, 1236, 1237, 1240, 1241, 1242, 1243,
+1244, 1245, 1246, 1247, 1249, 1250, 1251, 1252, 1253, 1254, 1256, 1257, 1258, 1259, 1260, 1261,
+1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262,
+1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262,
+1262, 1262, 1262, 1262, 1263, 1264, 1265, 1267, 1269, 1271, 1273, 1275, 1277, 1279, 1281, 1283,
+1285, 1287, 1290, 1293, 1296, 1299, 1302, 1304, 1306, 1308, 1309, 1310, 1311, 1312, 1313, 1315,
+1318, 1320, 1321, 1322, 1323, 1324, 1327, 1328, 1329, 1330, 1332, 1333, 1334, 1335, 1336, 1337,
+1338, 1339, 1340, 1342, 1343, 1344, 1346, 1347, 1348, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
+1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
+1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1350, 1351, 1353,
+1355, 1357, 1359, 1361, 1363, 1365, 1367, 1369, 1371, 1373, 1376, 1379, 1382, 1385, 1387, 1389,
+1391, 1393, 1394, 1395, 1396, 1397, 1398, 1400, 1403, 1405, 1406, 1407, 1408, 1409, 1412, 1413,
+1414, 1415, 1417, 1418, 1419, 1421, 1422, 1423, 1424, 1425, 1427, 1428, 1429, 1431, 1432, 1433,
+1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
+1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433,
+1433, 1433, 1433, 1434, 1436, 1438, 1440, 1442, 1444, 1446, 1448, 1450, 1452, 1454, 1456, 1458,
+1462, 1465, 1468, 1471, 1473, 1475, 1477, 1478, 1479, 1480, 1481, 1482, 1484, 1487, 1489, 1490,
+1491, 1492, 1493, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1508, 1509,
+1510, 1512, 1513, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
+1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
+1514, 1514, 1514, 1514, 1514, 1514, 1515, 1517, 1519, 1521, 1523, 1525, 1527, 1529, 1531, 1533,
+1535, 1537, 1541, 1544, 1547, 1550, 1552, 1554, 1556, 1558, 1559, 1560, 1561, 1562, 1564, 1566,
+1567, 1568, 1569, 1570, 1571, 1574, 1575, 1576, 1578, 1579, 1580, 1582, 1583, 1584, 1585, 1587,
+1588, 1589, 1590, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591,
+1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591,
+1591, 1591, 1591, 1591, 1591, 1591, 1592, 1593, 1595, 1597, 1599, 1601, 1603, 1605, 1607, 1609,
+1611, 1613, 1616, 1619, 1622, 1625, 1627, 1629, 1631, 1633, 1634, 1635, 1636, 1638, 1641, 1643,
+1644, 1645, 1646, 1647, 1649, 1651, 1652, 1653, 1655, 1656, 1658, 1659, 1660, 1661, 1663, 1664,
+1665, 1666, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667,
+1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667,
+1667, 1667, 1667, 1668, 1669, 1670, 1671, 1673, 1675, 1677, 1679, 1681, 1683, 1685, 1687, 1689,
+1692, 1695, 1698, 1700, 1702, 1704, 1706, 1707, 1708, 1709, 1711, 1714, 1716, 1717, 1718, 1719,
+1720, 1722, 1725, 1726, 1728, 1729, 1730, 1731, 1732, 1733, 1735, 1736, 1738, 1739, 1740, 1740,
+1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740,
+1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1741, 1742, 1743,
+1744, 1745, 1747, 1749, 1751, 1753, 1755, 1757, 1759, 1761, 1764, 1767, 1770, 1772, 1774, 1776,
+1778, 1779, 1780, 1781, 1783, 1785, 1786, 1787, 1788, 1789, 1790, 1792, 1795, 1796, 1798, 1799,
+1801, 1802, 1803, 1805, 1806, 1808, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809,
+1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809,
+1809, 1809, 1809, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1818, 1820, 1822, 1824, 1826,
+1828, 1830, 1832, 1835, 1838, 1840, 1842, 1844, 1846, 1847, 1848, 1849, 1852, 1854, 1855, 1856,
+1857, 1858, 1859, 1861, 1864, 1865, 1866, 1868, 1869, 1870, 1872, 1873, 1875, 1876, 1876, 1876,
+1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876,
+1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883,
+1884, 1885, 1887, 1889, 1891, 1893, 1895, 1897, 1900, 1903, 1906, 1908, 1910, 1912, 1913, 1914,
+1915, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1926, 1928, 1930, 1931, 1932, 1933, 1935, 1936,
+1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937,
+1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1937, 1938, 1939, 1940, 1941, 1942,
+1943, 1944, 1945, 1946, 1947, 1949, 1951, 1953, 1955, 1957, 1960, 1963, 1966, 1968, 1970, 1972,
+1974, 1975, 1976, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1987, 1989, 1991, 1993, 1994, 1996,
+1998, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999,
+1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 2000, 2001, 2002, 2003, 2004, 2005,
+2006, 2007, 2008, 2009, 2010, 2011, 2013, 2015, 2018, 2020, 2023, 2026, 2028, 2030, 2032, 2034,
+2035, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2047, 2051, 2053, 2054, 2056, 2058, 2059,
+2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059, 2059,
+2059, 2059, 2059, 2059, 2059, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069,
+2070, 2071, 2072, 2074, 2077, 2079, 2082, 2085, 2087, 2089, 2091, 2093, 2094, 2097, 2098, 2099,
+2100, 2101, 2102, 2103, 2104, 2106, 2109, 2111, 2113, 2115, 2115, 2115, 2115, 2115, 2115, 2115,
+2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115, 2115,
+2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2131, 2133,
+2135, 2138, 2140, 2142, 2144, 2146, 2147, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2160,
+2163, 2165, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166, 2166,
+2166, 2166, 2166, 2166, 2166, 2166, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175,
+2176, 2177, 2178, 2179, 2180, 2181, 2182, 2184, 2187, 2189, 2191, 2193, 2195, 2197, 2198, 2199,
+2200, 2201, 2202, 2203, 2204, 2205, 2209, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2213,
+2213, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2213, 2214, 2215, 2216, 2217, 2218,
+2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2233, 2235, 2237, 2239,
+2241, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2252, 2258, 2259, 2259, 2259, 2259, 2259,
+2259, 2259, 2259, 2259, 2259, 2259, 2259, 2259, 2259, 2259, 2259, 2259, 2260, 2261, 2262, 2263,
+2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2279, 2281,
+2283, 2285, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2299, 2300, 2301, 2301, 2301, 2301,
+2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2301, 2302, 2303, 2304, 2305, 2306, 2307,
+2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2321, 2322, 2324, 2326,
+2329, 2330, 2331, 2332, 2333, 2334, 2335, 2338, 2340, 2341, 2342, 2342, 2342, 2342, 2342, 2342,
+2342, 2342, 2342, 2342, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353,
+2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2366, 2367, 2368, 2369, 2370,
+2371, 2372, 2374, 2375, 2376, 2377, 2377, 2377, 2377, 2377, 2377, 2377, 2377, 2378, 2379, 2380,
+2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396,
+2397, 2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2410, 2410,
+2410, 2410, 2410, 2410, 2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421,
+2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2434, 2435, 2436, 2437, 2438,
+2439, 2440, 2442, 2443, 2444, 2445, 2445, 2445, 2445, 2445, 2445, 2445, 2445, 2445, 2445, 2445,
+2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461,
+2462, 2463, 2465, 2466, 2468, 2470, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2482, 2484, 2485,
+2486, 2486, 2486, 2486, 2486, 2486, 2486, 2486, 2486, 2486, 2486, 2486, 2486, 2486, 2487, 2488,
+2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504,
+2505, 2507, 2509, 2511, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2525, 2526, 2527, 2527,
+2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2527, 2528,
+2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544,
+2547, 2549, 2551, 2553, 2555, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2566, 2572, 2573,
+2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573, 2573,
+2573, 2573, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586,
+2587, 2588, 2589, 2591, 2594, 2596, 2598, 2600, 2602, 2604, 2605, 2606, 2607, 2608, 2609, 2610,
+2611, 2613, 2617, 2620, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621,
+2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2621, 2622, 2623, 2624, 2625, 2626, 2627,
+2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2638, 2640, 2643, 2646, 2648, 2650, 2652, 2654,
+2655, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2666, 2669, 2670, 2672, 2672, 2672, 2672,
+2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672, 2672,
+2672, 2672, 2672, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685,
+2687, 2689, 2691, 2694, 2697, 2699, 2701, 2703, 2705, 2706, 2709, 2710, 2711, 2712, 2713, 2714,
+2715, 2716, 2718, 2721, 2723, 2724, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727,
+2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727, 2727,
+2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2740, 2742, 2745, 2747, 2749,
+2752, 2755, 2757, 2759, 2761, 2763, 2764, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2776,
+2780, 2781, 2782, 2783, 2785, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786,
+2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2786, 2787,
+2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2798, 2800, 2802, 2805, 2807, 2810, 2813,
+2816, 2818, 2820, 2822, 2823, 2824, 2826, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2836, 2838,
+2840, 2842, 2843, 2844, 2846, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848,
+2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848,
+2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857, 2859, 2861, 2863, 2865, 2867, 2869,
+2872, 2875, 2877, 2879, 2881, 2883, 2884, 2885, 2886, 2889, 2890, 2891, 2892, 2893, 2894, 2895,
+2897, 2899, 2901, 2902, 2904, 2905, 2906, 2908, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
+2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910, 2910,
+2910, 2910, 2910, 2910, 2910, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917, 2919, 2921, 2923,
+2925, 2927, 2929, 2932, 2935, 2938, 2941, 2943, 2945, 2947, 2949, 2950, 2951, 2952, 2955, 2956,
+2957, 2958, 2959, 2960, 2961, 2963, 2966, 2967, 2968, 2970, 2971, 2972, 2973, 2975, 2976, 2977,
+2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977,
+2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2977, 2978, 2979, 2980,
+2981, 2982, 2983, 2985, 2987, 2989, 2991, 2993, 2995, 2997, 3000, 3003, 3006, 3009, 3011, 3013,
+3015, 3017, 3018, 3019, 3020, 3023, 3025, 3026, 3027, 3028, 3029, 3030, 3032, 3035, 3036, 3038,
+3039, 3041, 3042, 3043, 3044, 3046, 3047, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049,
+3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049,
+3049, 3049, 3049, 3049, 3049, 3049, 3049, 3049, 3050, 3051, 3052, 3053, 3055, 3057, 3059, 3061,
+3063, 3065, 3067, 3069, 3071, 3074, 3077, 3080, 3083, 3085, 3087, 3089, 3091, 3092, 3093, 3094,
+3096, 3098, 3099, 3100, 3101, 3102, 3103, 3105, 3108, 3109, 3111, 3112, 3113, 3115, 3116, 3117,
+3118, 3120, 3121, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123,
+3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123, 3123,
+3123, 3123, 3123, 3123, 3123, 3124, 3125, 3126, 3128, 3130, 3132, 3134, 3136, 3138, 3140, 3142,
+3144, 3146, 3149, 3152, 3155, 3158, 3160, 3162, 3164, 3166, 3167, 3168, 3169, 3171, 3174, 3176,
+3177, 3178, 3179, 3180, 3182, 3184, 3185, 3186, 3188, 3189, 3191, 3192, 3193, 3194, 3195, 3197,
+3198, 3199, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200,
+3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200, 3200,
+3200, 3200, 3200, 3200, 3200, 3201, 3203, 3205, 3207, 3209, 3211, 3213, 3215, 3217, 3219, 3221,
+3223, 3226, 3229, 3232, 3234, 3236, 3238, 3240, 3241, 3242, 3243, 3244, 3246, 3249, 3251, 3252,
+3253, 3254, 3255, 3257, 3260, 3261, 3262, 3264, 3265, 3266, 3268, 3269, 3270, 3271, 3272, 3274,
+3275, 3276, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277,
+3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277, 3277,
+3277, 3277, 3277, 3277, 3277, 3277, 3277, 3278, 3280, 3282, 3284, 3286, 3288, 3290, 3292, 3294,
+3296, 3298, 3300, 3302, 3305, 3308, 3311, 3313, 3315, 3317, 3319, 3320, 3321, 3322, 3323, 3324,
+3326, 3328, 3330, 3331, 3332, 3333, 3335, 3338, 3339, 3340, 3341, 3342, 3343, 3344, 3346, 3347,
+3348, 3349, 3350, 3352, 3353, 3354, 3356, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357,
+3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357,
+3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3357, 3358, 3359, 3361, 3363, 3365,
+3367, 3369, 3371, 3373, 3375, 3377, 3379, 3381, 3384, 3389, 3392, 3395, 3397, 3399, 3401, 3403,
+3404, 3405, 3406, 3407, 3408, 3410, 3412, 3414, 3415, 3416, 3417, 3419, 3422, 3423, 3424, 3425,
+3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3437, 3438, 3439, 3441, 3442, 3442, 3442,
+3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442,
+3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442, 3442,
+3443, 3444, 3445, 3446, 3448, 3450, 3452, 3454, 3456, 3458, 3460, 3462, 3464, 3466, 3468, 3471,
+3475, 3478, 3481, 3483, 3485, 3487, 3489, 3490, 3491, 3492, 3493, 3494, 3496, 3499, 3501, 3502,
+3503, 3504, 3506, 3509, 3510, 3511, 3512, 3514, 3515, 3516, 3517, 3519, 3520, 3521, 3522, 3523,
+3524, 3526, 3527, 3528, 3529, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530,
+3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530,
+3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3530, 3531, 3532, 3533, 3534, 3535, 3537, 3539,
+3541, 3543, 3545, 3547, 3549, 3551, 3553, 3555, 3558, 3561, 3565, 3568, 3571, 3573, 3575, 3577,
+3579, 3580, 3581, 3582, 3583, 3584, 3586, 3589, 3591, 3592, 3593, 3594, 3596, 3598, 3599, 3600,
+3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3614, 3615, 3616, 3617,
+3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618,
+3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618, 3618,
+3618, 3618, 3618, 3618, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3626, 3628, 3630, 3632, 3634,
+3636, 3638, 3640, 3642, 3644, 3647, 3650, 3654, 3657, 3660, 3662, 3664, 3666, 3667, 3668, 3669,
+3670, 3671, 3672, 3674, 3676, 3678, 3680, 3681, 3682, 3683, 3685, 3686, 3687, 3688, 3689, 3691,
+3692, 3693, 3694, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 3704, 3705, 3706, 3707, 3709, 3710,
+3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710,
+3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710, 3710,
+3710, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717, 3718, 3720, 3722, 3724, 3726, 3728, 3730,
+3732, 3734, 3736, 3738, 3741, 3744, 3748, 3752, 3755, 3757, 3759, 3761, 3762, 3763, 3764, 3765,
+3766, 3767, 3769, 3771, 3773, 3775, 3776, 3777, 3778, 3781, 3782, 3783, 3784, 3785, 3786, 3787,
+3788, 3789, 3790, 3792, 3793, 3794, 3795, 3796, 3797, 3798, 3800, 3801, 3802, 3803, 3804, 3805,
+3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805,
+3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805, 3805,
+3805, 3805, 3805, 3806, 3807, 3808, 3809, 3810, 3811, 3812, 3813, 3814, 3816, 3818, 3820, 3822,
+3824, 3826, 3828, 3830, 3832, 3835, 3838, 3841, 3845, 3848, 3850, 3852, 3854, 3856, 3857, 3858,
+3859, 3860, 3861, 3862, 3864, 3866, 3869, 3871, 3873, 3874, 3875, 3878, 3879, 3880, 3881, 3882,
+3883, 3884, 3885, 3886, 3887, 3888, 3889, 3890, 3891, 3892, 3893, 3894, 3895, 3897, 3898, 3899,
+3900, 3901, 3902, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903,
+3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903, 3903,
+3903, 3903, 3903, 3903, 3903, 3904, 3905, 3906, 3907, 3908, 3909, 3910, 3911, 3912, 3913, 3914,
+3916, 3918, 3920, 3922, 3924, 3926, 3928, 3930, 3932, 3935, 3938, 3941, 3946, 3949, 3951, 3953,
+3955, 3957, 3958, 3959, 3960, 3961, 3962, 3963, 3965, 3967, 3970, 3972, 3974, 3975, 3976, 3979,
+3980, 3981, 3982, 3983, 3984, 3986, 3987, 3988, 3989, 3990, 3992, 3993, 3994, 3995, 3996, 3997,
+3998, 3999, 4001, 4002, 4003, 4004, 4005, 4006, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007,
+4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007,
+4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4007, 4008, 4009, 4010, 4011, 4012, 4013,
+4014, 4015, 4016, 4017, 4018, 4019, 4021, 4023, 4025, 4027, 4029, 4031, 4033, 4035, 4038, 4041,
+4044, 4047, 4052, 4055, 4057, 4059, 4061, 4063, 4064, 4065, 4066, 4067, 4068, 4069, 4070, 4072,
+4074, 4076, 4078, 4080, 4081, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4092, 4093, 4094,
+4095, 4096, 4097, 4098, 4099, 4100, 4101, 4102, 4103, 4105, 4106, 4107, 4108, 4109, 4111, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112, 4112,
+4112, 4112, 4113, 4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126,
+4128, 4130, 4132, 4134, 4136, 4138, 4140, 4143, 4146, 4149, 4152, 4158, 4161, 4163, 4165, 4167,
+4169, 4170, 4171, 4172, 4173, 4174, 4175, 4176, 4178, 4180, 4182, 4184, 4186, 4187, 4189, 4190,
+4191, 4192, 4193, 4194, 4195, 4197, 4198, 4199, 4200, 4201, 4203, 4204, 4205, 4206, 4207, 4208,
+4209, 4210, 4211, 4213, 4214, 4215, 4216, 4217, 4219, 4220, 4220, 4220, 4220, 4220, 4220, 4220,
+4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220,
+4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4220, 4221, 4222, 4223, 4224,
+4225, 4226, 4227, 4228, 4229, 4230, 4231, 4232, 4233, 4234, 4235, 4236, 4238, 4240, 4242, 4244,
+4246, 4248, 4250, 4253, 4256, 4259, 4262, 4267, 4270, 4272, 4274, 4276, 4278, 4279, 4280, 4281,
+4282, 4283, 4284, 4285, 4287, 4289, 4292, 4294, 4296, 4297, 4300, 4301, 4302, 4303, 4304, 4305,
+4306, 4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319, 4320, 4321, 4322,
+4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330,
+4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330,
+4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330, 4330, 4331, 4332, 4333, 4334, 4335, 4336, 4337,
+4338, 4339, 4340, 4341, 4342, 4343, 4344, 4345, 4346, 4347, 4349, 4351, 4353, 4355, 4357, 4359,
+4362, 4365, 4368, 4371, 4374, 4378, 4381, 4383, 4385, 4387, 4388, 4389, 4390, 4391, 4392, 4393,
+4394, 4395, 4397, 4399, 4402, 4404, 4406, 4408, 4412, 4413, 4414, 4415, 4416, 4417, 4418, 4420,
+4421, 4422, 4423, 4424, 4425, 4427, 4428, 4429, 4430, 4431, 4432, 4433, 4434, 4435, 4436, 4438,
+4439, 4440, 4441, 4442, 4443, 4444, 4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445,
+4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445,
+4445, 4445, 4445, 4445, 4445, 4445, 4445, 4445, 4446, 4447, 4448, 4449, 4450, 4451, 4452, 4453,
+4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 4465, 4467, 4469, 4471, 4473, 4475,
+4478, 4481, 4484, 4487, 4490, 4493, 4496, 4498, 4500, 4502, 4503, 4504, 4505, 4506, 4507, 4508,
+4509, 4510, 4512, 4514, 4516, 4518, 4520, 4522, 4525, 4526, 4527, 4528, 4529, 4530, 4531, 4532,
+4534, 4535, 4536, 4537, 4538, 4539, 4540, 4541, 4542, 4543, 4544, 4545, 4546, 4547, 4548, 4549,
+4550, 4551, 4552, 4553, 4554, 4555, 4556, 4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557,
+4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557,
+4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557, 4557, 4558, 4559, 4560, 4561, 4562, 4563, 4564,
+4565, 4566, 4567, 4568, 4569, 4570, 4571, 4572, 4573, 4574, 4575, 4576, 4578, 4580, 4582, 4584,
+4586, 4588, 4591, 4594, 4597, 4600, 4603, 4607, 4610, 4612, 4614, 4616, 4617, 4618, 4619, 4620,
+4621, 4622, 4623, 4624, 4626, 4628, 4630, 4632, 4634, 4636, 4639, 4640, 4641, 4642, 4643, 4644,
+4645, 4646, 4648, 4649, 4650, 4651, 4652, 4653, 4654, 4655, 4656, 4657, 4658, 4659, 4660, 4661,
+4662, 4663, 4664, 4666, 4667, 4668, 4669, 4670, 4671, 4672, 4673, 4673, 4673, 4673, 4673, 4673,
+4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673,
+4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4673, 4674, 4675, 4676, 4677,
+4678, 4679, 4680, 4681, 4682, 4683, 4684, 4685, 4686, 4687, 4688, 4689, 4690, 4691, 4692, 4693,
+4695, 4697, 4699, 4701, 4703, 4706, 4709, 4712, 4715, 4718, 4721, 4725, 4727, 4729, 4731, 4733,
+4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742, 4744, 4746, 4748, 4750, 4752, 4756, 4757,
+4758, 4759, 4760, 4761, 4762, 4763, 4765, 4766, 4767, 4768, 4769, 4770, 4771, 4773, 4774, 4775,
+4776, 4777, 4778, 4779, 4780, 4781, 4782, 4783, 4784, 4785, 4786, 4787, 4788, 4789, 4791, 4792,
+4792, 4792, 4792, 4792, 4792, 4792, 4792, 4792, 4792, 4792, 4792,
+};
+
+static const PlaneRotation planeCacheRotations[PLANE_ANGLES] PROGMEM = {
+{{75, 87, 166, 118}, planeCacheRowSpans + 0},
+{{74, 88, 167, 115}, planeCacheRowSpans + 118},
+{{74, 89, 168, 113}, planeCacheRowSpans + 233},
+{{74, 90, 168, 111}, planeCacheRowSpans + 346},
+{{73, 91, 170, 109}, planeCacheRowSpans + 457},
+{{73, 92, 170, 107}, planeCacheRowSpans + 566},
+{{73, 94, 171, 103}, planeCacheRowSpans + 673},
+{{73, 95, 171, 101}, planeCacheRowSpans + 776},
+{{72, 96, 173, 99}, planeCacheRowSpans + 877},
+{{72, 97, 173, 97}, planeCacheRowSpans + 976},
+{{72, 98, 173, 94}, planeCacheRowSpans + 1073},
+{{72, 100, 174, 91}, planeCacheRowSpans + 1167},
+{{72, 101, 174, 89}, planeCacheRowSpans + 1258},
+{{72, 102, 174, 86}, planeCacheRowSpans + 1347},
+{{72, 103, 174, 84}, planeCacheRowSpans + 1433},
+{{72, 105, 175, 81}, planeCacheRowSpans + 1517},
+{{72, 106, 175, 78}, planeCacheRowSpans + 1598},
+{{72, 107, 175, 76}, planeCacheRowSpans + 1676},
+{{72, 109, 175, 73}, planeCacheRowSpans + 1752},
+{{72, 110, 175, 70}, planeCacheRowSpans + 1825},
+{{72, 111, 175, 68}, planeCacheRowSpans + 1895},
+{{72, 113, 175, 64}, planeCacheRowSpans + 1963},
+{{72, 114, 175, 62}, planeCacheRowSpans + 2027},
+{{72, 116, 175, 59}, planeCacheRowSpans + 2089},
+{{73, 117, 174, 56}, planeCacheRowSpans + 2148},
+{{73, 118, 174, 54}, planeCacheRowSpans + 2204},
+{{73, 120, 174, 50}, planeCacheRowSpans + 2258},
+{{73, 121, 174, 48}, planeCacheRowSpans + 2308},
+{{74, 123, 173, 44}, planeCacheRowSpans + 2356},
+{{74, 124, 173, 42}, planeCacheRowSpans + 2400},
+{{75, 126, 171, 38}, planeCacheRowSpans + 2442},
+{{74, 124, 173, 42}, planeCacheRowSpans + 2480},
+{{74, 123, 173, 44}, planeCacheRowSpans + 2522},
+{{74, 121, 174, 48}, planeCacheRowSpans + 2566},
+{{74, 120, 174, 50}, planeCacheRowSpans + 2614},
+{{74, 118, 174, 54}, planeCacheRowSpans + 2664},
+{{74, 117, 174, 56}, planeCacheRowSpans + 2718},
+{{74, 116, 175, 59}, planeCacheRowSpans + 2774},
+{{74, 114, 175, 62}, planeCacheRowSpans + 2833},
+{{74, 113, 175, 64}, planeCacheRowSpans + 2895},
+{{74, 111, 175, 68}, planeCacheRowSpans + 2959},
+{{74, 110, 175, 70}, planeCacheRowSpans + 3027},
+{{74, 109, 175, 73}, planeCacheRowSpans + 3097},
+{{74, 107, 175, 76}, planeCacheRowSpans + 3170},
+{{74, 106, 175, 78}, planeCacheRowSpans + 3246},
+{{74, 105, 175, 81}, planeCacheRowSpans + 3324},
+{{75, 103, 174, 84}, planeCacheRowSpans + 3405},
+{{75, 102, 174, 86}, planeCacheRowSpans + 3489},
+{{75, 101, 174, 89}, planeCacheRowSpans + 3575},
+{{75, 100, 174, 91}, planeCacheRowSpans + 3664},
+{{76, 98, 173, 94}, planeCacheRowSpans + 3755},
+{{76, 97, 173, 97}, planeCacheRowSpans + 3849},
+{{76, 96, 173, 99}, planeCacheRowSpans + 3946},
+{{77, 95, 171, 101}, planeCacheRowSpans + 4045},
+{{77, 94, 171, 103}, planeCacheRowSpans + 4146},
+{{78, 92, 170, 107}, planeCacheRowSpans + 4249},
+{{78, 91, 170, 109}, planeCacheRowSpans + 4356},
+{{79, 90, 168, 111}, planeCacheRowSpans + 4465},
+{{79, 89, 168, 113}, planeCacheRowSpans + 4576},
+{{80, 88, 167, 115}, planeCacheRowSpans + 4689},
+{{80, 87, 166, 118}, planeCacheRowSpans + 4804},
+};
+
+static const PlaneCacheInfo planeCacheStats = {71160, 4792, 4922, 191234, 0};
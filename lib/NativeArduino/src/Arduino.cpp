@@ -0,0 +1,46 @@
+#include "Arduino.h"
+#include <stdarg.h>
+
+NativeSerial Serial;
+
+static unsigned long simMicros = 0;
+
+unsigned long micros() { return simMicros; }
+unsigned long millis() { return simMicros / 1000; }
+void delay(unsigned long ms) { simMicros += ms * 1000; }
+void delayMicroseconds(unsigned int us) { simMicros += us; }
+void nativeAdvanceMicros(unsigned long us) { simMicros += us; }
+
+void NativeSerial::feed(const uint8_t *bytes, size_t n)
+{
+  // Drop what has been read, then append what fits.
+  memmove(input, input + inputPos, inputLen - inputPos);
+  inputLen -= inputPos;
+  inputPos = 0;
+  n = min(n, sizeof(input) - inputLen);
+  memcpy(input + inputLen, bytes, n);
+  inputLen += n;
+}
+
+size_t NativeSerial::write(uint8_t b) { return write(&b, 1); }
+
+size_t NativeSerial::write(const uint8_t *bytes, size_t n)
+{
+  return quiet ? n : fwrite(bytes, 1, n, stdout);
+}
+
+size_t NativeSerial::print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+size_t NativeSerial::println(const char *s) { return print(s) + print("\r\n"); }
+size_t NativeSerial::print(long v) { return printf("%ld", v); }
+size_t NativeSerial::println(long v) { return printf("%ld\r\n", v); }
+
+size_t NativeSerial::printf(const char *format, ...)
+{
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (n < 0) return 0;
+  return write((const uint8_t *)buf, min((size_t)n, sizeof(buf) - 1));
+}
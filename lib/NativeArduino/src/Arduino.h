@@ -0,0 +1,71 @@
+#pragma once
+// Just enough of the Arduino core for the firmware to build and run on the
+// host (env:native). Time is simulated: it only moves when the harness, or
+// delay(), moves it, so runs are repeatable and a profiler sees only our code.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define LED_BUILTIN 25
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+unsigned long micros();
+unsigned long millis();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+inline void yield() {}
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+
+// Serial goes to stdout. Input comes from whatever the harness queues with
+// feed(); there is no terminal to read from.
+class NativeSerial
+{
+public:
+  void begin(unsigned long) {}
+  explicit operator bool() const { return true; }
+
+  int available() const { return (int)(inputLen - inputPos); }
+  int read() { return inputPos < inputLen ? input[inputPos++] : -1; }
+  void feed(const uint8_t *bytes, size_t n);
+
+  size_t write(uint8_t b);
+  size_t write(const uint8_t *bytes, size_t n);
+  size_t print(const char *s);
+  size_t print(long v);
+  size_t println(const char *s = "");
+  size_t println(long v);
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+  // Silence output, for benchmark runs.
+  bool quiet = false;
+
+private:
+  uint8_t input[4096];
+  size_t inputLen = 0;
+  size_t inputPos = 0;
+};
+
+extern NativeSerial Serial;
+
+// Harness hooks, not part of the Arduino API.
+void nativeAdvanceMicros(unsigned long us);
@@ -0,0 +1,354 @@
+// Runs the firmware on the host: setup() and setup1(), then loop() and
+// loop1() in turn on one thread, on a simulated clock. Reports what each
+// frame sent to the panel, and how long loop1() took to draw it.
+//
+//   pio run -e native && .pio/build/native/program [options]
+//
+//   -s seconds   Simulated time to run for (default 10)
+//   -t us        Simulated time between loop passes (default 1000)
+//   -i hex       Queue bytes on Serial input before starting, e.g. a5...
+//   -c file      Write one CSV line per frame:
+//                frame,micros,pixels,windows,bytes,drawn,copied,ns
+//   -o file      Write the final framebuffer as a binary PPM, or with -g the
+//                first frame that differs from its golden
+//   -r file      Record golden frames: a hash of the screen, what was sent and
+//                how many pixels were drawn and copied, for every frame
+//   -g file      Check every frame against recorded goldens. Pixels and bytes
+//                sent and pixels drawn and copied are budgets: fewer passes,
+//                more fails. Exits 1 on failure.
+//   -p           With -g, check the screens only, not the budgets
+//   -q           Drop the firmware's Serial output
+//
+// Frames are counted when loop1() sends something. Its wall-clock time is
+// real, so run under perf or valgrind to see where it goes. What the
+// compositor costs whatever the host is counted in ComposeStats (Instrument.h):
+// pixels the layers drew, and pixels copied to and from save-unders. They are
+// budgeted apart, since a save-under exists to swap drawing for copying: a
+// build without them copies nothing and draws more, and fails the drawn
+// budget.
+//
+// The goldens in tools/golden/sweep.txt cover one pass of the test sweep.
+// Check them after any change to drawing, and re-record (with the -s and -t
+// the file names) only when the pictures are meant to change:
+//
+//   .pio/build/native/program -q -g tools/golden/sweep.txt
+//
+// The dirty areas, save-unders and tiles are checked against composing the
+// whole screen every frame by building with -D FULL_REDRAW=1 (in build_flags
+// for env:native) and running the same goldens with -p. Every frame then
+// has to come out the same as it did drawing only what changed.
+//
+// The unit tests in test/ link the same firmware and bring their own main(),
+// so none of this is built under pio test.
+
+#if !defined(PIO_UNIT_TESTING)
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "Instrument.h"
+
+void setup();
+void loop();
+void setup1();
+void loop1();
+
+extern TFT_eSPI tft;
+
+struct FrameRecord
+{
+  unsigned long micros; // Simulated time the frame was drawn
+  TftStats sent;
+  ComposeStats composed; // Pixels drawn and copied while composing
+  uint64_t ns;           // Wall clock spent in loop1()
+  uint64_t hash;         // Of the whole screen after the frame
+};
+
+struct Golden
+{
+  unsigned long micros;
+  uint32_t pixels;
+  uint64_t bytes;
+  ComposeStats composed;
+  uint64_t hash;
+};
+
+static uint64_t wallNanos()
+{
+  timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t)t.tv_sec * 1000000000ull + t.tv_nsec;
+}
+
+static bool writePpm(const char *path, const TFT_eSPI &panel)
+{
+  FILE *f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", panel.width(), panel.height());
+  for (int32_t y = 0; y < panel.height(); y++)
+  {
+    for (int32_t x = 0; x < panel.width(); x++)
+    {
+      uint16_t p = panel.readPixel(x, y);
+      uint8_t rgb[3] = {(uint8_t)((p >> 11) * 255 / 31), (uint8_t)((p >> 5 & 63) * 255 / 63),
+                        (uint8_t)((p & 31) * 255 / 31)};
+      fwrite(rgb, 1, 3, f);
+    }
+  }
+  return fclose(f) == 0;
+}
+
+// FNV-1a over the framebuffer.
+static uint64_t screenHash(const TFT_eSPI &panel)
+{
+  const uint16_t *p = panel.framebuffer();
+  uint64_t h = 14695981039346656037ull;
+  for (int32_t i = 0; i < panel.width() * panel.height(); i++)
+  {
+    h = (h ^ (p[i] & 0xFF)) * 1099511628211ull;
+    h = (h ^ (p[i] >> 8)) * 1099511628211ull;
+  }
+  return h;
+}
+
+// Golden files are a header naming the run, then one line per frame:
+//   seconds <s> tick <us>
+//   <frame> <micros> <pixels> <bytes> <drawn> <copied> <hash>
+// Lines starting with # are comments.
+static bool readGoldens(const char *path, double &seconds, unsigned long &tick, std::vector<Golden> &goldens)
+{
+  FILE *f = fopen(path, "r");
+  if (!f) return false;
+  char line[128];
+  bool header = false;
+  while (fgets(line, sizeof(line), f))
+  {
+    if (line[0] == '#' || line[0] == '\n') continue;
+    if (!header)
+    {
+      header = sscanf(line, "seconds %lf tick %lu", &seconds, &tick) == 2;
+      if (!header) break;
+      continue;
+    }
+    Golden g;
+    unsigned long long bytes, hash;
+    size_t frame;
+    if (sscanf(line, "%zu %lu %u %llu %u %u %llx", &frame, &g.micros, &g.pixels, &bytes, &g.composed.drawn,
+               &g.composed.copied, &hash) != 7 ||
+        frame != goldens.size())
+    {
+      header = false;
+      break;
+    }
+    g.bytes = bytes, g.hash = hash;
+    goldens.push_back(g);
+  }
+  fclose(f);
+  return header;
+}
+
+static bool writeGoldens(const char *path, double seconds, unsigned long tick, const std::vector<FrameRecord> &frames)
+{
+  FILE *f = fopen(path, "w");
+  if (!f) return false;
+  fprintf(f, "# Golden frames for NativeHarness -g: one pass of the test sweep.\n");
+  fprintf(f, "# frame, simulated micros, pixels sent, bytes sent, pixels drawn, pixels copied, screen hash\n");
+  fprintf(f, "seconds %g tick %lu\n", seconds, tick);
+  for (size_t i = 0; i < frames.size(); i++)
+  {
+    const FrameRecord &r = frames[i];
+    fprintf(f, "%zu %lu %u %llu %u %u %016llx\n", i, r.micros, r.sent.pixels, (unsigned long long)r.sent.bytes,
+            r.composed.drawn, r.composed.copied, (unsigned long long)r.hash);
+  }
+  return fclose(f) == 0;
+}
+
+// Compare a frame with its golden and say what is wrong, if anything.
+static bool checkFrame(size_t i, const FrameRecord &r, const std::vector<Golden> &goldens, bool budgets)
+{
+  if (i >= goldens.size())
+  {
+    fprintf(stderr, "frame %zu: not in the goldens\n", i);
+    return false;
+  }
+  const Golden &g = goldens[i];
+  bool ok = true;
+  if (r.micros != g.micros)
+    fprintf(stderr, "frame %zu: drawn at %lu us, golden %lu us\n", i, r.micros, g.micros), ok = false;
+  if (r.hash != g.hash) fprintf(stderr, "frame %zu: screen differs from golden\n", i), ok = false;
+  if (!budgets) return ok;
+  if (r.sent.pixels > g.pixels)
+    fprintf(stderr, "frame %zu: %u pixels sent, budget %u\n", i, r.sent.pixels, g.pixels), ok = false;
+  if (r.sent.bytes > g.bytes)
+    fprintf(stderr, "frame %zu: %llu bytes sent, budget %llu\n", i, (unsigned long long)r.sent.bytes,
+            (unsigned long long)g.bytes), ok = false;
+  if (r.composed.drawn > g.composed.drawn)
+    fprintf(stderr, "frame %zu: %u pixels drawn, budget %u\n", i, r.composed.drawn, g.composed.drawn), ok = false;
+  if (r.composed.copied > g.composed.copied)
+    fprintf(stderr, "frame %zu: %u pixels copied, budget %u\n", i, r.composed.copied, g.composed.copied), ok = false;
+  return ok;
+}
+
+static uint64_t percentile(std::vector<uint64_t> v, int p)
+{
+  if (v.empty()) return 0;
+  std::sort(v.begin(), v.end());
+  return v[(v.size() - 1) * p / 100];
+}
+
+int main(int argc, char **argv)
+{
+  double seconds = 10;
+  unsigned long tick = 1000;
+  const char *csvPath = nullptr;
+  const char *ppmPath = nullptr;
+  const char *recordPath = nullptr;
+  const char *goldenPath = nullptr;
+  bool budgets = true;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "s:t:i:c:o:r:g:pq")) != -1)
+  {
+    switch (opt)
+    {
+    case 's': seconds = atof(optarg); break;
+    case 't': tick = max(1ul, strtoul(optarg, nullptr, 10)); break;
+    case 'i':
+      for (const char *h = optarg; h[0] && h[1]; h += 2)
+      {
+        uint8_t b = (uint8_t)strtoul(std::string(h, 2).c_str(), nullptr, 16);
+        Serial.feed(&b, 1);
+      }
+      break;
+    case 'c': csvPath = optarg; break;
+    case 'o': ppmPath = optarg; break;
+    case 'r': recordPath = optarg; break;
+    case 'g': goldenPath = optarg; break;
+    case 'p': budgets = false; break;
+    case 'q': Serial.quiet = true; break;
+    default:
+      fprintf(stderr, "usage: %s [-s seconds] [-t us] [-i hex] [-c frames.csv] [-o frame.ppm]\n"
+                      "       [-r|-g golden.txt [-p]] [-q]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+
+  // Checking replays the run the goldens were recorded with.
+  std::vector<Golden> goldens;
+  if (goldenPath && !readGoldens(goldenPath, seconds, tick, goldens))
+  {
+    fprintf(stderr, "%s: not a golden frame file\n", goldenPath);
+    return 2;
+  }
+  size_t failed = 0;
+
+  setup();
+  setup1();
+  const TftStats setupSent = tft.stats();
+  tft.resetStats();
+  Instrument::resetComposeStats();
+
+  std::vector<FrameRecord> frames;
+  const unsigned long end = micros() + (unsigned long)(seconds * 1e6);
+  while (micros() < end)
+  {
+    loop();
+
+    TftStats before = tft.stats();
+    ComposeStats composedBefore = Instrument::composeStats();
+    uint64_t start = wallNanos();
+    loop1();
+    uint64_t ns = wallNanos() - start;
+
+    const TftStats &after = tft.stats();
+    if (after.windows != before.windows)
+    {
+      TftStats sent = {after.pixels - before.pixels, after.windows - before.windows,
+                       after.dmaTransfers - before.dmaTransfers, after.bytes - before.bytes};
+      ComposeStats composed = {Instrument::composeStats().drawn - composedBefore.drawn,
+                               Instrument::composeStats().copied - composedBefore.copied};
+      frames.push_back(FrameRecord{micros(), sent, composed, ns, screenHash(tft)});
+      if (goldenPath && !checkFrame(frames.size() - 1, frames.back(), goldens, budgets) && !failed++ && ppmPath)
+        writePpm(ppmPath, tft);
+    }
+    nativeAdvanceMicros(tick);
+  }
+
+  if (csvPath)
+  {
+    FILE *f = fopen(csvPath, "w");
+    if (!f)
+    {
+      perror(csvPath);
+      return 1;
+    }
+    fprintf(f, "frame,micros,pixels,windows,bytes,drawn,copied,ns\n");
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+      const FrameRecord &r = frames[i];
+      fprintf(f, "%zu,%lu,%u,%u,%llu,%u,%u,%llu\n", i, r.micros, r.sent.pixels, r.sent.windows,
+              (unsigned long long)r.sent.bytes, r.composed.drawn, r.composed.copied, (unsigned long long)r.ns);
+    }
+    fclose(f);
+  }
+  if (recordPath && !writeGoldens(recordPath, seconds, tick, frames))
+  {
+    perror(recordPath);
+    return 1;
+  }
+  if (ppmPath && !goldenPath && !writePpm(ppmPath, tft))
+  {
+    perror(ppmPath);
+    return 1;
+  }
+
+  std::vector<uint64_t> pixels, bytes, drawn, copied, ns;
+  for (const FrameRecord &r : frames)
+  {
+    pixels.push_back(r.sent.pixels);
+    bytes.push_back(r.sent.bytes);
+    drawn.push_back(r.composed.drawn);
+    copied.push_back(r.composed.copied);
+    ns.push_back(r.ns);
+  }
+  const TftStats &total = tft.stats();
+  fprintf(stderr, "\nsetup: %u pixels, %llu bytes\n", setupSent.pixels, (unsigned long long)setupSent.bytes);
+  fprintf(stderr, "%zu frames in %.1f s: %u pixels, %u windows, %llu bytes\n", frames.size(), seconds, total.pixels,
+          total.windows, (unsigned long long)total.bytes);
+  fprintf(stderr, "%-10s %10s %10s %10s\n", "per frame", "p50", "p99", "max");
+  fprintf(stderr, "%-10s %10llu %10llu %10llu\n", "pixels", (unsigned long long)percentile(pixels, 50),
+          (unsigned long long)percentile(pixels, 99), (unsigned long long)percentile(pixels, 100));
+  fprintf(stderr, "%-10s %10llu %10llu %10llu\n", "bytes", (unsigned long long)percentile(bytes, 50),
+          (unsigned long long)percentile(bytes, 99), (unsigned long long)percentile(bytes, 100));
+  fprintf(stderr, "%-10s %10llu %10llu %10llu\n", "drawn", (unsigned long long)percentile(drawn, 50),
+          (unsigned long long)percentile(drawn, 99), (unsigned long long)percentile(drawn, 100));
+  fprintf(stderr, "%-10s %10llu %10llu %10llu\n", "copied", (unsigned long long)percentile(copied, 50),
+          (unsigned long long)percentile(copied, 99), (unsigned long long)percentile(copied, 100));
+  fprintf(stderr, "%-10s %10llu %10llu %10llu\n", "loop1 ns", (unsigned long long)percentile(ns, 50),
+          (unsigned long long)percentile(ns, 99), (unsigned long long)percentile(ns, 100));
+
+  if (goldenPath)
+  {
+    if (frames.size() < goldens.size())
+      fprintf(stderr, "%zu golden frames were never drawn\n", goldens.size() - frames.size()), failed++;
+    uint64_t goldenBytes = 0, goldenDrawn = 0, goldenCopied = 0, totalDrawn = 0, totalCopied = 0;
+    for (const Golden &g : goldens)
+      goldenBytes += g.bytes, goldenDrawn += g.composed.drawn, goldenCopied += g.composed.copied;
+    for (const FrameRecord &r : frames) totalDrawn += r.composed.drawn, totalCopied += r.composed.copied;
+    fprintf(stderr,
+            "\n%s: %zu of %zu frames failed, %llu of %llu budgeted bytes sent, %llu of %llu pixels drawn, "
+            "%llu of %llu copied\n",
+            goldenPath, failed, goldens.size(), (unsigned long long)total.bytes, (unsigned long long)goldenBytes,
+            (unsigned long long)totalDrawn, (unsigned long long)goldenDrawn, (unsigned long long)totalCopied,
+            (unsigned long long)goldenCopied);
+    if (failed) return 1;
+  }
+  return 0;
+}
+
+#endif // !PIO_UNIT_TESTING
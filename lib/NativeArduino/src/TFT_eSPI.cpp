@@ -0,0 +1,85 @@
+#include "TFT_eSPI.h"
+
+#define FP_SCALE 10 // Fraction bits in TFT_eSPI's rotation arithmetic
+
+static inline uint16_t swap16(uint16_t p) { return (uint16_t)(p >> 8 | p << 8); }
+
+//====================================================================================
+//                                    Panel
+//====================================================================================
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+    : _fb((uint16_t *)calloc((size_t)w * h, sizeof(uint16_t))), _width(w), _height(h)
+{
+}
+
+TFT_eSPI::~TFT_eSPI() { free(_fb); }
+
+void TFT_eSPI::begin() { resetStats(); }
+
+bool TFT_eSPI::initDMA(bool) { return true; }
+
+// The framebuffer is laid out in the current orientation, width pixels a row.
+// Changing rotation does not redraw it.
+void TFT_eSPI::setRotation(uint8_t r)
+{
+  if (r & 1)
+    _width = TFT_HEIGHT, _height = TFT_WIDTH;
+  else
+    _width = TFT_WIDTH, _height = TFT_HEIGHT;
+}
+
+bool TFT_eSPI::openWindow(int32_t &x, int32_t &y, int32_t &w, int32_t &h, int32_t &dx, int32_t &dy)
+{
+  dx = dy = 0;
+  if (x < 0) dx = -x, w += x, x = 0;
+  if (y < 0) dy = -y, h += y, y = 0;
+  if (x + w > _width) w = _width - x;
+  if (y + h > _height) h = _height - y;
+  if (w < 1 || h < 1) return false;
+
+  _stats.windows++;
+  _stats.pixels += w * h;
+  _stats.bytes += TFT_WINDOW_BYTES + 2ull * w * h;
+  return true;
+}
+
+void TFT_eSPI::fillScreen(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+  int32_t dx, dy;
+  if (!openWindow(x, y, w, h, dx, dy)) return;
+  uint16_t p = swap16((uint16_t)color);
+  for (int32_t r = 0; r < h; r++)
+  {
+    uint16_t *dst = _fb + (y + r) * _width + x;
+    for (int32_t c = 0; c < w; c++) dst[c] = p;
+  }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data)
+{
+  int32_t stride = w, dx, dy;
+  if (!openWindow(x, y, w, h, dx, dy)) return;
+  for (int32_t r = 0; r < h; r++)
+  {
+    const uint16_t *src = data + (dy + r) * stride + dx;
+    uint16_t *dst = _fb + (y + r) * _width + x;
+    if (_swapBytes)
+      for (int32_t c = 0; c < w; c++) dst[c] = swap16(src[c]);
+    else
+      memcpy(dst, src, w * sizeof(uint16_t));
+  }
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t const *data, uint16_t *)
+{
+  _stats.dmaTransfers++;
+  pushImage(x, y, w, h, data);
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) const
+{
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+  return swap16(_fb[y * _width + x]);
+}
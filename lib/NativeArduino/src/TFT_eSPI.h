@@ -0,0 +1,90 @@
+#pragma once
+// Host stand-in for the parts of TFT_eSPI the instrument uses, drawing into
+// an in-memory RGB565 framebuffer instead of the ST7796.
+//
+// The framebuffer holds pixels as the panel receives them: in memory order
+// when byte swapping is off, as for the pre-swapped assets, and swapped when
+// it is on. Colour arguments (fillScreen, transparent colours) are in MCU
+// order, as with the real library.
+//
+// Everything pushed to the panel is counted, so a run can report pixels,
+// address windows and bus bytes per frame.
+
+#include "Arduino.h"
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 320
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 480
+#endif
+
+#define TFT_BLACK 0x0000
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREEN 0x03E0
+#define TFT_MAROON 0x7800
+#define TFT_DARKGREY 0x7BEF
+#define TFT_BLUE 0x001F
+#define TFT_GREEN 0x07E0
+#define TFT_RED 0xF800
+#define TFT_ORANGE 0xFDA0
+#define TFT_YELLOW 0xFFE0
+#define TFT_WHITE 0xFFFF
+
+// Bytes of commands and parameters to open an address window: CASET and
+// RASET with four bytes each, then RAMWR.
+#define TFT_WINDOW_BYTES 11
+
+struct TftStats
+{
+  uint32_t pixels;  // Pixels written to the panel
+  uint32_t windows; // Address windows opened
+  uint32_t dmaTransfers;
+  uint64_t bytes; // On the bus: 2 per pixel plus TFT_WINDOW_BYTES per window
+};
+
+class TFT_eSPI
+{
+public:
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+  ~TFT_eSPI();
+
+  void init() { begin(); }
+  void begin();
+  void setRotation(uint8_t r);
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  void setSwapBytes(bool swap) { _swapBytes = swap; }
+  bool getSwapBytes() const { return _swapBytes; }
+
+  void startWrite() {}
+  void endWrite() {}
+
+  void fillScreen(uint32_t color);
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+
+  // DMA completes at once, so dmaWait() has nothing to wait for.
+  bool initDMA(bool ctrl_cs = false);
+  void deInitDMA() {}
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t const *data, uint16_t *buffer = nullptr);
+  void dmaWait() {}
+  bool dmaBusy() { return false; }
+
+  // Host only: the framebuffer, width() x height() in panel order, and what
+  // has been sent so far.
+  const uint16_t *framebuffer() const { return _fb; }
+  uint16_t readPixel(int32_t x, int32_t y) const; // MCU order
+  const TftStats &stats() const { return _stats; }
+  void resetStats() { _stats = TftStats{}; }
+
+private:
+  // Clip to the screen, count the window, and return false if nothing shows.
+  bool openWindow(int32_t &x, int32_t &y, int32_t &w, int32_t &h, int32_t &dx, int32_t &dy);
+
+  uint16_t *_fb;
+  int16_t _width, _height;
+  bool _swapBytes = false;
+  TftStats _stats = {};
+};
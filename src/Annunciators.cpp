@@ -0,0 +1,89 @@
+#include "Annunciators.h"
+
+#define TILE_BORDER 2
+#define TILE_BORDER_COLOR 0x4208 // RGB565, before swapping to panel order
+#define TILE_DARK_COLOR 0x18C3
+#define LABEL_DARK_COLOR 0x630C
+#define LABEL_LIT_COLOR 0x0000
+
+// Labels are drawn from a 5x7 font, each dot LABEL_SCALE pixels square with
+// one dot between letters.
+#define GLYPH_W 5
+#define GLYPH_H 7
+#define LABEL_SCALE 3
+
+// Columns left to right, bit 0 at the top.
+static const uint8_t digitGlyphs[10][GLYPH_W] = {
+    {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00}, {0x42, 0x61, 0x51, 0x49, 0x46},
+    {0x21, 0x41, 0x45, 0x4B, 0x31}, {0x18, 0x14, 0x12, 0x7F, 0x10}, {0x27, 0x45, 0x45, 0x45, 0x39},
+    {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03}, {0x36, 0x49, 0x49, 0x49, 0x36},
+    {0x06, 0x49, 0x49, 0x29, 0x1E},
+};
+
+static const uint8_t letterGlyphs[26][GLYPH_W] = {
+    {0x7E, 0x11, 0x11, 0x11, 0x7E}, {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},
+    {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41}, {0x7F, 0x09, 0x09, 0x09, 0x01},
+    {0x3E, 0x41, 0x49, 0x49, 0x7A}, {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00},
+    {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, {0x7F, 0x40, 0x40, 0x40, 0x40},
+    {0x7F, 0x02, 0x0C, 0x02, 0x7F}, {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, {0x7F, 0x09, 0x19, 0x29, 0x46},
+    {0x46, 0x49, 0x49, 0x49, 0x31}, {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F},
+    {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F}, {0x63, 0x14, 0x08, 0x14, 0x63},
+    {0x07, 0x08, 0x70, 0x08, 0x07}, {0x61, 0x51, 0x49, 0x45, 0x43},
+};
+
+static const uint8_t *glyph(char ch)
+{
+  if (ch >= '0' && ch <= '9') return digitGlyphs[ch - '0'];
+  if (ch >= 'A' && ch <= 'Z') return letterGlyphs[ch - 'A'];
+  return nullptr; // Anything else is a space
+}
+
+static void drawLabel(Canvas &c, const char *label, int16_t x, int16_t y, uint16_t color)
+{
+  for (; *label; label++, x += (GLYPH_W + 1) * LABEL_SCALE)
+  {
+    const uint8_t *g = glyph(*label);
+    if (!g) continue;
+    for (int16_t col = 0; col < GLYPH_W; col++)
+      for (int16_t row = 0; row < GLYPH_H; row++)
+        if (g[col] >> row & 1)
+          fillRect(c, Rect{(int16_t)(x + col * LABEL_SCALE), (int16_t)(y + row * LABEL_SCALE), LABEL_SCALE, LABEL_SCALE},
+                   color);
+  }
+}
+
+AnnunciatorLayer::AnnunciatorLayer(const Rect &tile, const char *label, uint16_t litColor, const bool &on)
+    : label(label), litColor(swap565(litColor)), on(on)
+{
+  bounds = tile;
+}
+
+bool AnnunciatorLayer::update()
+{
+  bool changed = on != shown;
+  shown = on;
+  return changed;
+}
+
+// Border, face, then the label centred on it. Only the rows and columns in
+// the canvas get written.
+void AnnunciatorLayer::draw(Canvas &c)
+{
+  const Rect &b = bounds;
+  Rect face = {(int16_t)(b.x + TILE_BORDER), (int16_t)(b.y + TILE_BORDER), (int16_t)(b.w - 2 * TILE_BORDER),
+               (int16_t)(b.h - 2 * TILE_BORDER)};
+  uint16_t border = swap565(TILE_BORDER_COLOR);
+  fillRect(c, Rect{b.x, b.y, b.w, TILE_BORDER}, border);
+  fillRect(c, Rect{b.x, face.bottom(), b.w, TILE_BORDER}, border);
+  fillRect(c, Rect{b.x, face.y, TILE_BORDER, face.h}, border);
+  fillRect(c, Rect{face.right(), face.y, TILE_BORDER, face.h}, border);
+  fillRect(c, face, shown ? litColor : swap565(TILE_DARK_COLOR));
+
+  int16_t len = 0;
+  while (label[len]) len++;
+  int16_t w = len * (GLYPH_W + 1) * LABEL_SCALE - LABEL_SCALE;
+  int16_t x = b.x + (b.w - w) / 2;
+  int16_t y = b.y + (b.h - GLYPH_H * LABEL_SCALE) / 2;
+  drawLabel(c, label, x, y, swap565(shown ? LABEL_LIT_COLOR : LABEL_DARK_COLOR));
+}
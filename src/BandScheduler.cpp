@@ -0,0 +1,49 @@
+#include "BandScheduler.h"
+
+BandScheduler::BandScheduler(BandSink &sink, uint16_t *bufA, uint16_t *bufB, uint32_t bufPixels)
+    : sink(sink), buf{bufA, bufB}, bufPixels(bufPixels)
+{
+}
+
+void BandScheduler::push(const Rect &r, BandFill fill, void *ctx)
+{
+  if (r.empty()) return;
+
+  int16_t rowsPerBand = bufPixels / r.w;
+  if (rowsPerBand < 1) return; // Wider than a buffer. Callers clip to the instrument width.
+
+  for (int16_t y = r.y; y < r.bottom(); y += rowsPerBand)
+  {
+    Rect band{r.x, y, r.w, (int16_t)(r.bottom() - y < rowsPerBand ? r.bottom() - y : rowsPerBand)};
+
+    // buf[next] is never the one being transferred, so fill it straight away.
+    fill(band, buf[next], ctx);
+
+    // Only one transfer at a time: let the previous band finish, whoever
+    // sent it, then start this one.
+    if (sink.busy) sink.wait();
+    sink.startTransfer(band, buf[next]);
+    sink.busy = true;
+
+    next ^= 1;
+    bands++;
+    pixels += band.area();
+  }
+}
+
+// The buffers are left alone, so buf[next] is still free to fill.
+void BandScheduler::pushPixels(const Rect &r, const uint16_t *src)
+{
+  if (r.empty()) return;
+  if (sink.busy) sink.wait();
+  sink.startTransfer(r, src);
+  sink.busy = true;
+  bands++;
+  pixels += r.area();
+}
+
+void BandScheduler::finish()
+{
+  if (sink.busy) sink.wait();
+  sink.busy = false;
+}
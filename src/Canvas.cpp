@@ -0,0 +1,19 @@
+#include "Canvas.h"
+#include "Kernels565.h"
+
+void drawImage(Canvas &c, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *img)
+{
+  Rect clip = rectIntersect(Rect{x, y, w, h}, c.area);
+  if (clip.empty()) return;
+
+  for (int16_t yy = clip.y; yy < clip.bottom(); yy++)
+    copy565(c.row(yy) + clip.x, img + (yy - y) * w + (clip.x - x), clip.w);
+}
+
+void fillRect(Canvas &c, const Rect &r, uint16_t color)
+{
+  Rect clip = rectIntersect(r, c.area);
+  if (clip.empty()) return;
+
+  for (int16_t yy = clip.y; yy < clip.bottom(); yy++) fill565(c.row(yy) + clip.x, color, clip.w);
+}
@@ -0,0 +1,126 @@
+#include "DirtyRegion.h"
+
+Rect rectUnion(const Rect &a, const Rect &b)
+{
+  if (a.empty()) return b;
+  if (b.empty()) return a;
+
+  int16_t x0 = a.x < b.x ? a.x : b.x;
+  int16_t y0 = a.y < b.y ? a.y : b.y;
+  int16_t x1 = a.right() > b.right() ? a.right() : b.right();
+  int16_t y1 = a.bottom() > b.bottom() ? a.bottom() : b.bottom();
+  return Rect{x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+Rect rectIntersect(const Rect &a, const Rect &b)
+{
+  int16_t x0 = a.x > b.x ? a.x : b.x;
+  int16_t y0 = a.y > b.y ? a.y : b.y;
+  int16_t x1 = a.right() < b.right() ? a.right() : b.right();
+  int16_t y1 = a.bottom() < b.bottom() ? a.bottom() : b.bottom();
+  if (x1 <= x0 || y1 <= y0) return Rect{0, 0, 0, 0};
+  return Rect{x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+bool rectOverlaps(const Rect &a, const Rect &b)
+{
+  return !rectIntersect(a, b).empty();
+}
+
+bool rectContains(const Rect &outer, const Rect &inner)
+{
+  return inner.x >= outer.x && inner.y >= outer.y && inner.right() <= outer.right() &&
+         inner.bottom() <= outer.bottom();
+}
+
+uint8_t rectSubtract(const Rect &a, const Rect &b, Rect out[4])
+{
+  Rect in = rectIntersect(a, b);
+  if (in.empty())
+  {
+    if (a.empty()) return 0;
+    out[0] = a;
+    return 1;
+  }
+
+  uint8_t n = 0;
+  if (in.y > a.y) out[n++] = Rect{a.x, a.y, a.w, (int16_t)(in.y - a.y)};
+  if (in.bottom() < a.bottom()) out[n++] = Rect{a.x, in.bottom(), a.w, (int16_t)(a.bottom() - in.bottom())};
+  if (in.x > a.x) out[n++] = Rect{a.x, in.y, (int16_t)(in.x - a.x), in.h};
+  if (in.right() < a.right()) out[n++] = Rect{in.right(), in.y, (int16_t)(a.right() - in.right()), in.h};
+  return n;
+}
+
+DirtyRegion::DirtyRegion(int16_t width, int16_t height)
+    : bounds{0, 0, width, height}
+{
+}
+
+void DirtyRegion::add(Rect r)
+{
+  r = rectIntersect(r, bounds);
+  if (r.empty()) return;
+
+  if (count == DIRTY_MAX_RECTS)
+  {
+    // Out of slots. Grow the rectangle that absorbs this one most cheaply.
+    uint8_t best = 0;
+    int32_t bestGrowth = INT32_MAX;
+    for (uint8_t i = 0; i < count; i++)
+    {
+      int32_t growth = rectUnion(rects[i], r).area() - rects[i].area();
+      if (growth < bestGrowth)
+      {
+        bestGrowth = growth;
+        best = i;
+      }
+    }
+    rects[best] = rectUnion(rects[best], r);
+  }
+  else
+  {
+    rects[count++] = r;
+  }
+
+  mergeOverlapping();
+}
+
+void DirtyRegion::addAll()
+{
+  rects[0] = bounds;
+  count = 1;
+}
+
+int32_t DirtyRegion::area() const
+{
+  int32_t total = 0;
+  for (uint8_t i = 0; i < count; i++) total += rects[i].area();
+  return total;
+}
+
+// Fold together any pair that overlaps, or that is close enough that one
+// window is cheaper than two. Repeats until nothing changes, so the result
+// never contains overlapping rectangles and no pixel gets pushed twice.
+void DirtyRegion::mergeOverlapping()
+{
+  bool merged = true;
+  while (merged)
+  {
+    merged = false;
+    for (uint8_t i = 0; i < count && !merged; i++)
+    {
+      for (uint8_t j = i + 1; j < count; j++)
+      {
+        Rect u = rectUnion(rects[i], rects[j]);
+        if (rectOverlaps(rects[i], rects[j]) ||
+            u.area() <= rects[i].area() + rects[j].area() + DIRTY_MERGE_SLACK)
+        {
+          rects[i] = u;
+          rects[j] = rects[--count];
+          merged = true;
+          break;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,44 @@
+#include "FrameScheduler.h"
+
+FrameScheduler::FrameScheduler(uint32_t hz, FrameClock clock)
+    : clock(clock)
+{
+  setRate(hz);
+}
+
+void FrameScheduler::setRate(uint32_t hz)
+{
+  periodMicros = 1000000 / (hz ? hz : 1);
+}
+
+bool FrameScheduler::due()
+{
+  uint32_t now = clock();
+  if (!started)
+  {
+    started = true;
+    deadline = now;
+  }
+
+  int32_t behind = (int32_t)(now - deadline);
+  if (behind < 0) return false;
+
+  late = behind;
+  frames++;
+  if ((uint32_t)behind >= periodMicros)
+  {
+    // Drop the deadlines already gone by and aim for the next one ahead.
+    uint32_t gone = behind / periodMicros;
+    missed++;
+    skipped += gone;
+    deadline += gone * periodMicros;
+  }
+  deadline += periodMicros;
+  return true;
+}
+
+void FrameScheduler::resync()
+{
+  uint32_t now = clock();
+  if (started && (int32_t)(now - deadline) > 0) deadline = now;
+}
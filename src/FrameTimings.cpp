@@ -0,0 +1,109 @@
+#include "FrameTimings.h"
+
+uint8_t Histogram::bucket(uint32_t micros)
+{
+  if (micros < 16) return micros;
+
+  uint8_t top = 31 - __builtin_clz(micros); // Highest set bit, 4 or more
+  uint8_t sub = (micros >> (top - 2)) & 3;   // Next two bits
+  uint8_t b = 16 + (top - 4) * 4 + sub;
+  return b < HISTOGRAM_BUCKETS ? b : HISTOGRAM_BUCKETS - 1;
+}
+
+uint32_t Histogram::bucketTop(uint8_t b)
+{
+  if (b < 16) return b;
+  uint8_t top = (b - 16) / 4 + 4;
+  uint8_t sub = (b - 16) % 4;
+  return ((4u + sub + 1) << (top - 2)) - 1;
+}
+
+void Histogram::record(uint32_t micros)
+{
+  counts[bucket(micros)]++;
+  n++;
+  if (micros < lo) lo = micros;
+  if (micros > hi) hi = micros;
+}
+
+void Histogram::clear()
+{
+  for (uint8_t b = 0; b < HISTOGRAM_BUCKETS; b++) counts[b] = 0;
+  n = 0;
+  lo = UINT32_MAX;
+  hi = 0;
+}
+
+uint32_t Histogram::percentile(uint8_t p) const
+{
+  if (!n) return 0;
+
+  // Rank of the sample wanted, counting from 1
+  uint32_t rank = ((uint64_t)n * p + 99) / 100;
+  if (rank == 0) rank = 1;
+
+  uint32_t seen = 0;
+  for (uint8_t b = 0; b < HISTOGRAM_BUCKETS; b++)
+  {
+    seen += counts[b];
+    if (seen >= rank)
+    {
+      uint32_t t = bucketTop(b);
+      return t < hi ? t : hi;
+    }
+  }
+  return hi;
+}
+
+void FrameTimings::beginFrame()
+{
+  for (uint8_t s = 0; s < STAGE_COUNT; s++) total[s] = 0;
+  ran = 0;
+}
+
+void FrameTimings::add(Stage stage, uint32_t micros)
+{
+  total[stage] += micros;
+  ran |= 1u << stage;
+}
+
+void FrameTimings::endFrame()
+{
+  for (uint8_t s = 0; s < STAGE_COUNT; s++)
+  {
+    if (ran & (1u << s)) stages[s].record(total[s]);
+  }
+}
+
+void FrameTimings::clear()
+{
+  for (uint8_t s = 0; s < STAGE_COUNT; s++) stages[s].clear();
+}
+
+static uint8_t *put32(uint8_t *p, uint32_t v)
+{
+  p[0] = v;
+  p[1] = v >> 8;
+  p[2] = v >> 16;
+  p[3] = v >> 24;
+  return p + 4;
+}
+
+size_t FrameTimings::serialize(uint8_t *out) const
+{
+  uint8_t *p = out;
+  *p++ = 'F';
+  *p++ = 'T';
+  *p++ = 1;
+  *p++ = STAGE_COUNT;
+  for (uint8_t s = 0; s < STAGE_COUNT; s++)
+  {
+    const Histogram &h = stages[s];
+    p = put32(p, h.count());
+    p = put32(p, h.min());
+    p = put32(p, h.max());
+    p = put32(p, h.percentile(50));
+    p = put32(p, h.percentile(99));
+  }
+  return p - out;
+}
@@ -0,0 +1,54 @@
+#include "IndexedImage.h"
+
+// Expand n 8-bit indices. Four at a time, so the loads of the next indices
+// overlap the lookups of the last.
+static void expand8(uint16_t *dst, const uint8_t *src, const uint16_t *palette, int16_t n)
+{
+  int16_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    uint8_t a = src[i], b = src[i + 1], c = src[i + 2], d = src[i + 3];
+    dst[i] = palette[a];
+    dst[i + 1] = palette[b];
+    dst[i + 2] = palette[c];
+    dst[i + 3] = palette[d];
+  }
+  for (; i < n; i++) dst[i] = palette[src[i]];
+}
+
+// Expand n 4-bit indices starting at pixel first of the row, a byte (two
+// pixels) at a time once first is even.
+static void expand4(uint16_t *dst, const uint8_t *row, const uint16_t *palette, int16_t first, int16_t n)
+{
+  const uint8_t *src = row + (first >> 1);
+  if (n > 0 && (first & 1))
+  {
+    *dst++ = palette[*src++ & 0x0F];
+    n--;
+  }
+  for (; n >= 2; n -= 2)
+  {
+    uint8_t b = *src++;
+    dst[0] = palette[b >> 4];
+    dst[1] = palette[b & 0x0F];
+    dst += 2;
+  }
+  if (n) *dst = palette[*src >> 4];
+}
+
+void drawIndexed(Canvas &c, const IndexedImage &img, int16_t x, int16_t y)
+{
+  Rect clip = rectIntersect(Rect{x, y, (int16_t)img.w, (int16_t)img.h}, c.area);
+  if (clip.empty()) return;
+
+  const uint32_t stride = img.bits == 8 ? img.w : (img.w + 1) / 2;
+  for (int16_t yy = clip.y; yy < clip.bottom(); yy++)
+  {
+    const uint8_t *row = img.indices + (yy - y) * stride;
+    uint16_t *dst = c.row(yy) + clip.x;
+    if (img.bits == 8)
+      expand8(dst, row + (clip.x - x), img.palette, clip.w);
+    else
+      expand4(dst, row, img.palette, clip.x - x, clip.w);
+  }
+}
@@ -0,0 +1,293 @@
+#include "Instrument.h"
+#include "Rotate.h"
+#include <assert.h>
+
+static bool sameRect(const Rect &a, const Rect &b)
+{
+  return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+//====================================================================================
+//                                    Layers
+//====================================================================================
+ImageLayer::ImageLayer(const PackedImage &img, int16_t x, int16_t y) : packed(&img)
+{
+  bounds = Rect{x, y, (int16_t)img.w, (int16_t)img.h};
+}
+
+ImageLayer::ImageLayer(const IndexedImage &img, int16_t x, int16_t y) : indexed(&img)
+{
+  bounds = Rect{x, y, (int16_t)img.w, (int16_t)img.h};
+}
+
+// Only the part under the canvas gets decoded.
+void ImageLayer::draw(Canvas &c)
+{
+  if (indexed) drawIndexed(c, *indexed, bounds.x, bounds.y);
+  else drawPacked(c, *packed, bounds.x, bounds.y);
+}
+
+FillLayer::FillLayer(const Rect &r, uint16_t color) : color(swap565(color)) { bounds = r; }
+
+void FillLayer::draw(Canvas &c) { fillRect(c, bounds, color); }
+
+SpriteLayer::SpriteLayer(const Sprite &s) : sprite(s) { bounds = spriteRect(s); }
+
+void SpriteLayer::draw(Canvas &c) { drawSprite(c, sprite); }
+
+bool ToggleLayer::update()
+{
+  uint16_t changed = (bits ^ shown) & bit;
+  shown ^= changed;
+  return changed;
+}
+
+void ToggleLayer::draw(Canvas &c)
+{
+  if (shown) drawSprite(c, sprite);
+}
+
+const uint16_t *ToggleLayer::tile() const
+{
+  if (!tiles) return nullptr;
+  return shown ? tiles->on : tiles->off;
+}
+
+TranslatedLayer::TranslatedLayer(const Sprite &s, Point (*position)(), const Rect &sweep)
+    : sprite(s), position(position), reach(sweep)
+{
+}
+
+bool TranslatedLayer::update()
+{
+  Point p = position();
+  bounds = spriteRect(sprite, p.x, p.y);
+  return false;
+}
+
+void TranslatedLayer::draw(Canvas &c) { drawSprite(c, sprite, bounds.x, bounds.y); }
+
+RotatedLayer::RotatedLayer(const Sprite &s, int16_t x, int16_t y, int32_t (*angle)(), int32_t minAngle,
+                           int32_t maxAngle)
+    : sprite(s), pivot{x, y}, angle(angle), minAngle(minAngle), maxAngle(maxAngle)
+{
+}
+
+bool RotatedLayer::update()
+{
+  int32_t a = angle();
+  a = a < minAngle ? minAngle : a > maxAngle ? maxAngle : a;
+  bool changed = !drawnOnce || a != current;
+  current = a;
+  drawnOnce = true;
+  bounds = rotatedBounds(sprite, a, pivot.x, pivot.y);
+  return changed;
+}
+
+void RotatedLayer::draw(Canvas &c) { drawRotated(c, sprite, current, pivot.x, pivot.y); }
+
+Rect RotatedLayer::sweep() const
+{
+  Rect r = {0, 0, 0, 0};
+  for (int32_t a = minAngle; a <= maxAngle; a++) r = rectUnion(r, rotatedBounds(sprite, a, pivot.x, pivot.y));
+  return r;
+}
+
+//====================================================================================
+//                                  Instrument
+//====================================================================================
+ComposeStats Instrument::composed = {0, 0};
+
+Instrument::Instrument(const Rect &area, Layer *const *layers, uint8_t count)
+    : where(area), layers(layers), count(count), dirty(area.w, area.h)
+{
+  assert(count <= INSTRUMENT_MAX_LAYERS);
+}
+
+bool Instrument::begin(bool saveUnders)
+{
+  bool fitted = true;
+  const Rect local = {0, 0, where.w, where.h};
+  for (uint8_t i = 0; i < count && saveUnders; i++)
+  {
+    Layer &l = *layers[i];
+    Rect sweep = rectIntersect(l.sweep(), local);
+    if (sweep.empty()) continue;
+    l.saving = true;
+    fitted &= l.save.begin(sweep);
+  }
+  return fitted;
+}
+
+// Anything that moved dirties where it was and where it is now. Anything
+// that changed in place dirties where it is. Either way, a layer with a
+// save-under above it that it overlaps has to say so, as what the buffer
+// holds there is now stale.
+void Instrument::markDirty(uint8_t i, bool moved)
+{
+  Layer &l = *layers[i];
+  if (moved) dirty.add(l.drawn);
+  dirty.add(l.bounds);
+  for (uint8_t j = i + 1; j < count; j++)
+  {
+    Layer &above = *layers[j];
+    if (above.saving && (rectOverlaps(l.drawn, above.drawn) || rectOverlaps(l.bounds, above.drawn)))
+      above.changedUnder = true;
+  }
+}
+
+void Instrument::collect()
+{
+  TIME_STAGE(STAGE_COLLECT);
+  dirty.clear();
+  const Rect local = {0, 0, where.w, where.h};
+
+  for (uint8_t i = 0; i < count; i++)
+  {
+    layers[i]->changedUnder = false;
+    layers[i]->direct = false;
+  }
+
+  for (uint8_t i = 0; i < count; i++)
+  {
+    Layer &l = *layers[i];
+    bool changed = l.update();
+    l.bounds = rectIntersect(l.bounds, local);
+    bool moved = !sameRect(l.bounds, l.drawn);
+    if (firstFrame || (!changed && !moved)) continue;
+
+    if (!moved && l.tile() && !fullRedraw) l.direct = true; // Settled below, once every layer is where it goes
+    else markDirty(i, moved);
+  }
+
+  // A tile only holds its layer over the bottom one, so it can go out as it
+  // is only if no other layer was there last frame or is there now.
+  for (uint8_t i = 0; i < count; i++)
+  {
+    Layer &l = *layers[i];
+    if (!l.direct) continue;
+    for (uint8_t j = 1; j < count && l.direct; j++)
+    {
+      const Layer &other = *layers[j];
+      if (j != i && (rectOverlaps(l.bounds, other.drawn) || rectOverlaps(l.bounds, other.bounds))) l.direct = false;
+    }
+    if (!l.direct) markDirty(i, false);
+  }
+
+  if (firstFrame || fullRedraw)
+  {
+    dirty.addAll();
+    firstFrame = false;
+  }
+
+  // A layer that moved has its whole new area dirty, as the buffers need.
+  for (uint8_t i = 0; i < count; i++)
+  {
+    Layer &l = *layers[i];
+    if (l.saving) l.save.beginFrame(l.bounds, l.changedUnder);
+    l.drawn = l.bounds;
+  }
+}
+
+// What one dirty rectangle, or the part under a save-under, is composed
+// from: the layers up to top that are in the set.
+struct ComposeBelow
+{
+  Instrument *instrument;
+  uint8_t top;
+  uint32_t layers;
+};
+
+void Instrument::push(BandScheduler &bands)
+{
+  for (uint8_t i = 0; i < count; i++)
+  {
+    const Layer &l = *layers[i];
+    if (!l.direct) continue;
+    Rect r = l.bounds;
+    r.x += where.x;
+    r.y += where.y;
+    bands.pushPixels(r, l.tile());
+  }
+
+  // Which layers a rectangle needs is worked out once for all its bands.
+  for (uint8_t i = 0; i < dirty.size(); i++)
+  {
+    Rect r = dirty[i];
+    ComposeBelow job = {this, count, touching(r)};
+    r.x += where.x;
+    r.y += where.y;
+    bands.push(r, fillBand, &job);
+  }
+}
+
+// The layers with something to do in r: those drawing there, and those with
+// a save-under that can restore part of it. Skipping any other layer gives
+// the same pixels, as its save-under would only compose what lies beneath.
+uint32_t Instrument::touching(const Rect &r) const
+{
+  uint32_t set = 0;
+  for (uint8_t i = 0; i < count; i++)
+  {
+    const Layer &l = *layers[i];
+    if (rectOverlaps(l.bounds, r) || (l.saving && l.save.restores(r))) set |= 1ul << i;
+  }
+  return set;
+}
+
+// The layers draw in instrument coordinates. Moving the canvas's area, not
+// its pixels, puts them in the right place.
+void Instrument::fillBand(const Rect &r, uint16_t *buf, void *ctx)
+{
+  ComposeBelow *job = (ComposeBelow *)ctx;
+  const Rect &where = job->instrument->where;
+  Canvas local{buf, Rect{(int16_t)(r.x - where.x), (int16_t)(r.y - where.y), r.w, r.h}};
+  job->instrument->composeBelow(local, job->top, job->layers);
+}
+
+void Instrument::compose(Canvas &c)
+{
+  Canvas local = c.clip(where);
+  if (local.area.empty()) return;
+  local.area.x -= where.x;
+  local.area.y -= where.y;
+  composeBelow(local, count, touching(local.area));
+}
+
+void Instrument::composeUnder(Canvas &c, void *ctx)
+{
+  ComposeBelow *below = (ComposeBelow *)ctx;
+  below->instrument->composeBelow(c, below->top, below->layers);
+}
+
+// Draw the layers in the set from 0 up to top. The highest of them with a
+// save-under fills in everything beneath it, from its buffer where it can.
+void Instrument::composeBelow(Canvas &c, uint8_t top, uint32_t set)
+{
+  uint8_t from = top;
+  while (from > 0 && !(layers[from - 1]->saving && (set >> (from - 1) & 1))) from--;
+
+  if (from > 0)
+  {
+    from--;
+    ComposeBelow below = {this, from, set};
+    composed.copied += layers[from]->save.fill(c, composeUnder, &below);
+  }
+  for (uint8_t i = from; i < top; i++)
+    if (set >> i & 1) drawLayer(*layers[i], c);
+}
+
+void Instrument::drawLayer(Layer &l, Canvas &c)
+{
+  if (!rectOverlaps(l.bounds, c.area)) return;
+  composed.drawn += rectIntersect(l.bounds, c.area).area();
+  if (l.stage < STAGE_COUNT)
+  {
+    TIME_STAGE(l.stage);
+    l.draw(c);
+  }
+  else
+  {
+    l.draw(c);
+  }
+}
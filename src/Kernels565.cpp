@@ -0,0 +1,30 @@
+#include "Kernels565.h"
+#include <string.h>
+
+// Two pixels, stored as one word. may_alias as the pixels are really
+// uint16_t arrays.
+typedef uint32_t __attribute__((__may_alias__)) Word;
+
+static inline bool oddPixel(const uint16_t *p) { return (uintptr_t)p & 2; }
+
+void copy565(uint16_t *dst, const uint16_t *src, int32_t n)
+{
+  if (n > 0) memcpy(dst, src, n * sizeof(uint16_t));
+}
+
+void fill565(uint16_t *dst, uint16_t color, int32_t n)
+{
+  if (n <= 0) return;
+  if (oddPixel(dst))
+  {
+    *dst++ = color;
+    n--;
+  }
+
+  Word *d = (Word *)dst;
+  uint32_t w = color | (uint32_t)color << 16;
+  int32_t pairs = n >> 1, i = 0;
+  for (; i + 4 <= pairs; i += 4) d[i] = d[i + 1] = d[i + 2] = d[i + 3] = w;
+  for (; i < pairs; i++) d[i] = w;
+  if (n & 1) dst[n - 1] = color;
+}
@@ -0,0 +1,76 @@
+#include "PackedImage.h"
+#include "Kernels565.h"
+
+// What each one-byte delta token adds to the previous pixel. Adding the
+// packed value works because the packer never lets a channel wrap.
+static int16_t deltaTable[128];
+static bool deltaTableReady = false;
+
+static void makeDeltaTable()
+{
+  for (uint8_t t = 0; t < 128; t++)
+  {
+    int16_t dr = ((t >> 5) & 3) - 2;
+    int16_t dg = ((t >> 2) & 7) - 4;
+    int16_t db = (t & 3) - 2;
+    deltaTable[t] = dr * 2048 + dg * 32 + db;
+  }
+  deltaTableReady = true;
+}
+
+// Decode one segment, keeping only screen columns [x0, x1). dst is indexed
+// by screen x and sx is the screen x of the segment's first pixel.
+static void decodeSegment(const uint8_t *p, const uint8_t *end, uint16_t *dst, int16_t sx, int16_t x0, int16_t x1)
+{
+  uint16_t prev = 0;
+  int16_t x = sx;
+
+  while (p < end && x < x1)
+  {
+    uint8_t t = *p++;
+    if (t & 0x80)
+    {
+      prev += deltaTable[t & 0x7F];
+      if (x >= x0) dst[x] = swap565(prev);
+      x++;
+    }
+    else if (t & 0x40)
+    {
+      int16_t n = (t & 0x3F) + 1;
+      int16_t from = x < x0 ? x0 : x;
+      int16_t to = x + n < x1 ? x + n : x1;
+      fill565(dst + from, swap565(prev), to - from);
+      x += n;
+    }
+    else
+    {
+      int16_t n = (t & 0x3F) + 1;
+      for (int16_t i = 0; i < n; i++, p += 2, x++)
+      {
+        prev = p[0] | (p[1] << 8);
+        if (x >= x0 && x < x1) dst[x] = swap565(prev);
+      }
+    }
+  }
+}
+
+void drawPacked(Canvas &c, const PackedImage &img, int16_t x, int16_t y)
+{
+  if (!deltaTableReady) makeDeltaTable();
+
+  Rect clip = rectIntersect(Rect{x, y, (int16_t)img.w, (int16_t)img.h}, c.area);
+  if (clip.empty()) return;
+
+  const uint16_t segments = (img.w + img.segmentWidth - 1) / img.segmentWidth;
+  const uint16_t first = (clip.x - x) / img.segmentWidth;
+  const uint16_t last = (clip.right() - 1 - x) / img.segmentWidth;
+
+  for (int16_t yy = clip.y; yy < clip.bottom(); yy++)
+  {
+    const uint32_t *index = img.index + (yy - y) * segments;
+    uint16_t *dst = c.row(yy);
+    for (uint16_t s = first; s <= last; s++)
+      decodeSegment(img.data + index[s], img.data + index[s + 1], dst,
+                    x + s * img.segmentWidth, clip.x, clip.right());
+  }
+}
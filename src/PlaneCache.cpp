@@ -0,0 +1,202 @@
+#include "PlaneCache.h"
+#include "Kernels565.h"
+#include "Rotate.h"
+#include "assets.h" // Generated by tools/gen_assets.py
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(PLANE_CACHE_RAM)
+#include <Arduino.h>
+static PlaneRotation planeCacheRotations[PLANE_ANGLES];
+static PlaneSpan *planeCacheSpans;
+static PlaneCacheInfo planeCacheStats;
+static bool planeCacheReady = false;
+#else
+#include "plane_cache.h" // Generated by tools/gen_plane_cache.cpp
+static const bool planeCacheReady = true;
+#endif
+
+// The plane comes from the asset pipeline with its mask. The coverage map
+// for smooth rotation is made from the mask once, at first use.
+static uint8_t planeCoverage[COVERAGE_SIZE(planeSprite.w, planeSprite.h)];
+static bool planeCoverageReady = false;
+
+static const Sprite &planeImage()
+{
+  if (!planeCoverageReady)
+  {
+    makeCoverage(planeSprite, planeCoverage);
+    planeCoverageReady = true;
+  }
+  return planeSprite;
+}
+
+Rect planeBounds(int32_t angle)
+{
+  return rectIntersect(rotatedBounds(planeImage(), angle, PLANE_PIVOT_X, PLANE_PIVOT_Y),
+                       Rect{0, 0, TURN_COORD_WIDTH, TURN_COORD_HEIGHT});
+}
+
+Rect planeSweep()
+{
+  Rect sweep = {0, 0, 0, 0};
+  for (int32_t angle = PLANE_MIN_ANGLE * ANGLE_STEPS; angle <= PLANE_MAX_ANGLE * ANGLE_STEPS; angle++)
+    sweep = rectUnion(sweep, planeBounds(angle));
+  return sweep;
+}
+
+// Rotate the plane one row at a time into two scratch rows pre-filled with
+// different colours. A pixel was drawn if it changed in either row, and each
+// unbroken stretch of drawn pixels becomes a span.
+void planeCacheWalk(PlaneCacheBuilder &b)
+{
+  static uint16_t row[2][TURN_COORD_WIDTH];
+  const uint16_t fill[2] = {0x0000, 0xFFFF};
+
+  for (int16_t angle = PLANE_MIN_ANGLE; angle <= PLANE_MAX_ANGLE; angle++)
+  {
+    Rect bounds = planeBounds(angle * ANGLE_STEPS);
+    b.beginAngle(angle, bounds);
+
+    for (int16_t y = bounds.y; y < bounds.bottom(); y++)
+    {
+      for (uint8_t i = 0; i < 2; i++)
+      {
+        Canvas c{row[i], Rect{bounds.x, y, bounds.w, 1}};
+        for (int16_t x = 0; x < bounds.w; x++) row[i][x] = fill[i];
+        drawRotated(c, planeImage(), angle * ANGLE_STEPS, PLANE_PIVOT_X, PLANE_PIVOT_Y);
+      }
+
+      b.beginRow();
+      int16_t x = 0;
+      while (x < bounds.w)
+      {
+        if (row[0][x] == fill[0] && row[1][x] == fill[1])
+        {
+          x++;
+          continue;
+        }
+        int16_t start = x;
+        while (x < bounds.w && (row[0][x] != fill[0] || row[1][x] != fill[1])) x++;
+        b.span(bounds.x + start, x - start, row[0] + start);
+      }
+    }
+  }
+}
+
+#if defined(PLANE_CACHE_RAM)
+// First pass just counts, second pass copies into the allocated arrays.
+struct RamBuilder : PlaneCacheBuilder
+{
+  uint16_t *pixels = nullptr;
+  PlaneSpan *spans = nullptr;
+  uint16_t *rowSpans = nullptr;
+  uint32_t pixelCount = 0, spanCount = 0, rowCount = 0;
+
+  void beginAngle(int16_t angle, const Rect &bounds) override
+  {
+    if (rowSpans)
+      planeCacheRotations[angle - PLANE_MIN_ANGLE] = PlaneRotation{bounds, rowSpans + rowCount};
+  }
+
+  // Rows of all angles share one index array. Entry n is where row n starts
+  // and where row n - 1 ends, so the array has one more entry than rows.
+  void beginRow() override
+  {
+    if (rowSpans)
+    {
+      rowSpans[rowCount] = spanCount;
+      rowSpans[rowCount + 1] = spanCount;
+    }
+    rowCount++;
+  }
+
+  void span(int16_t x, uint16_t len, const uint16_t *p) override
+  {
+    if (spans)
+    {
+      memcpy(pixels + pixelCount, p, len * sizeof(uint16_t));
+      spans[spanCount] = PlaneSpan{x, len, pixels + pixelCount};
+      rowSpans[rowCount] = spanCount + 1;
+    }
+    pixelCount += len;
+    spanCount++;
+  }
+};
+
+bool planeCacheBegin()
+{
+  planeImage();
+  uint32_t start = micros();
+
+  RamBuilder count;
+  planeCacheWalk(count);
+
+  RamBuilder fill;
+  fill.pixels = (uint16_t *)malloc(count.pixelCount * sizeof(uint16_t));
+  fill.spans = (PlaneSpan *)malloc(count.spanCount * sizeof(PlaneSpan));
+  fill.rowSpans = (uint16_t *)malloc((count.rowCount + 1) * sizeof(uint16_t));
+  if (!fill.pixels || !fill.spans || !fill.rowSpans)
+  {
+    free(fill.pixels);
+    free(fill.spans);
+    free(fill.rowSpans);
+    return false;
+  }
+  planeCacheWalk(fill);
+
+  planeCacheSpans = fill.spans;
+  planeCacheStats.pixels = count.pixelCount;
+  planeCacheStats.spans = count.spanCount;
+  planeCacheStats.rows = count.rowCount;
+  planeCacheStats.bytes = count.pixelCount * sizeof(uint16_t) + count.spanCount * sizeof(PlaneSpan) +
+                          (count.rowCount + 1) * sizeof(uint16_t) + sizeof(planeCacheRotations);
+  planeCacheStats.buildMicros = micros() - start;
+  planeCacheReady = true;
+  return true;
+}
+#else
+bool planeCacheBegin()
+{
+  planeImage();
+  return true;
+}
+#endif
+
+const PlaneCacheInfo &planeCacheInfo()
+{
+  return planeCacheStats;
+}
+
+void drawPlane(Canvas &c, int32_t angle)
+{
+  int16_t deg = angle / ANGLE_STEPS;
+  if (!planeCacheReady || angle % ANGLE_STEPS != 0 || deg < PLANE_MIN_ANGLE || deg > PLANE_MAX_ANGLE)
+  {
+    drawRotated(c, planeImage(), angle, PLANE_PIVOT_X, PLANE_PIVOT_Y);
+    return;
+  }
+
+  const PlaneRotation &rot = planeCacheRotations[deg - PLANE_MIN_ANGLE];
+  Rect clip = rectIntersect(rot.bounds, c.area);
+  if (clip.empty()) return;
+
+  for (int16_t y = clip.y; y < clip.bottom(); y++)
+  {
+    uint16_t *dst = c.row(y);
+    uint16_t r = y - rot.bounds.y;
+    for (uint16_t i = rot.rowSpans[r]; i < rot.rowSpans[r + 1]; i++)
+    {
+      const PlaneSpan &s = planeCacheSpans[i];
+      int16_t x0 = s.x > clip.x ? s.x : clip.x;
+      int16_t x1 = s.x + s.len < clip.right() ? s.x + s.len : clip.right();
+      if (x0 < x1) copy565(dst + x0, s.pixels + (x0 - s.x), x1 - x0);
+    }
+  }
+}
+
+void drawPlaneSmooth(Canvas &c, int32_t angle)
+{
+  drawRotatedSmooth(c, planeImage(), planeCoverage, angle, PLANE_PIVOT_X, PLANE_PIVOT_Y);
+}
@@ -0,0 +1,227 @@
+#include "Rotate.h"
+
+// sin() of 0 to 90 degrees, scaled by 65536.
+static const int32_t sinTable[91] = {
+    0, 1144, 2287, 3430, 4572, 5712, 6850, 7987, 9121, 10252,
+    11380, 12505, 13626, 14742, 15855, 16962, 18064, 19161, 20252, 21336,
+    22415, 23486, 24550, 25607, 26656, 27697, 28729, 29753, 30767, 31772,
+    32768, 33754, 34729, 35693, 36647, 37590, 38521, 39441, 40348, 41243,
+    42126, 42995, 43852, 44695, 45525, 46341, 47143, 47930, 48703, 49461,
+    50203, 50931, 51643, 52339, 53020, 53684, 54332, 54963, 55578, 56175,
+    56756, 57319, 57865, 58393, 58903, 59396, 59870, 60326, 60764, 61183,
+    61584, 61966, 62328, 62672, 62997, 63303, 63589, 63856, 64104, 64332,
+    64540, 64729, 64898, 65048, 65177, 65287, 65376, 65446, 65496, 65526,
+    65536,
+};
+
+static int32_t sinDegrees(int16_t deg)
+{
+  deg %= 360;
+  if (deg < 0) deg += 360;
+  if (deg <= 90) return sinTable[deg];
+  if (deg <= 180) return sinTable[180 - deg];
+  if (deg <= 270) return -sinTable[deg - 180];
+  return -sinTable[360 - deg];
+}
+
+int32_t isin(int32_t angle)
+{
+  int16_t deg = angle >> 4; // Rounds down, negative angles included
+  int32_t frac = angle & (ANGLE_STEPS - 1);
+  int32_t s = sinDegrees(deg);
+  if (frac == 0) return s;
+  return s + (((sinDegrees(deg + 1) - s) * frac + ANGLE_STEPS / 2) >> 4);
+}
+
+int32_t icos(int32_t angle)
+{
+  return isin(angle + 90 * ANGLE_STEPS);
+}
+
+void makeCoverage(const Sprite &img, uint8_t *coverage)
+{
+  int16_t stride = MASK_STRIDE(img.w);
+  for (int32_t i = 0; i < COVERAGE_SIZE(img.w, img.h); i++) coverage[i] = 0;
+  for (int16_t y = 0; y < img.h; y++)
+  {
+    for (int16_t x = 0; x < img.w; x++)
+    {
+      if (img.mask[y * stride + (x >> 3)] & (0x80 >> (x & 7)))
+        coverage[(y + 1) * (img.w + 2) + x + 1] = 255;
+    }
+  }
+}
+
+// Division rounding towards minus infinity, for either sign of divisor.
+static int32_t floorDiv(int32_t n, int32_t d)
+{
+  int32_t q = n / d;
+  if ((n % d != 0) && ((n < 0) != (d < 0))) q--;
+  return q;
+}
+
+static int32_t ceilDiv(int32_t n, int32_t d)
+{
+  return -floorDiv(-n, d);
+}
+
+// Narrow [lo, hi] to the k for which 0 <= a + step * k < limit.
+static void narrow(int32_t a, int32_t step, int32_t limit, int32_t &lo, int32_t &hi)
+{
+  if (step == 0)
+  {
+    if (a < 0 || a >= limit) hi = lo - 1;
+    return;
+  }
+
+  int32_t k0, k1;
+  if (step > 0)
+  {
+    k0 = ceilDiv(-a, step);
+    k1 = floorDiv(limit - 1 - a, step);
+  }
+  else
+  {
+    k0 = ceilDiv(limit - 1 - a, step);
+    k1 = floorDiv(-a, step);
+  }
+  if (k0 > lo) lo = k0;
+  if (k1 < hi) hi = k1;
+}
+
+Rect rotatedBounds(const Sprite &img, int32_t angle, int16_t dx, int16_t dy)
+{
+  int32_t s = isin(angle);
+  int32_t c = icos(angle);
+
+  // Corners relative to the pivot, rotated forwards
+  const int32_t sx[4] = {-img.px, img.w - img.px, img.w - img.px, -img.px};
+  const int32_t sy[4] = {-img.py, -img.py, img.h - img.py, img.h - img.py};
+  int32_t minX = INT32_MAX, maxX = INT32_MIN, minY = INT32_MAX, maxY = INT32_MIN;
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    int32_t tx = c * sx[i] - s * sy[i];
+    int32_t ty = s * sx[i] + c * sy[i];
+    if (tx < minX) minX = tx;
+    if (tx > maxX) maxX = tx;
+    if (ty < minY) minY = ty;
+    if (ty > maxY) maxY = ty;
+  }
+
+  // Whole pixels, plus two either side for the half pixel sampling offset
+  // and the extra half pixel that smooth edges spill over.
+  int16_t x0 = dx + floorDiv(minX, 1 << ROT_SCALE) - 2;
+  int16_t y0 = dy + floorDiv(minY, 1 << ROT_SCALE) - 2;
+  int16_t x1 = dx + ceilDiv(maxX, 1 << ROT_SCALE) + 2;
+  int16_t y1 = dy + ceilDiv(maxY, 1 << ROT_SCALE) + 2;
+  return Rect{x0, y0, (int16_t)(x1 - x0 + 1), (int16_t)(y1 - y0 + 1)};
+}
+
+void drawRotated(Canvas &c, const Sprite &img, int32_t angle, int16_t dx, int16_t dy)
+{
+  Rect clip = rectIntersect(rotatedBounds(img, angle, dx, dy), c.area);
+  if (clip.empty()) return;
+
+  const int32_t sn = isin(angle);
+  const int32_t cs = icos(angle);
+  const int32_t xLimit = (int32_t)img.w << ROT_SCALE;
+  const int32_t yLimit = (int32_t)img.h << ROT_SCALE;
+  const int32_t half = 1 << (ROT_SCALE - 1);
+  const int16_t stride = MASK_STRIDE(img.w);
+
+  int32_t tx = clip.x - dx;
+  for (int16_t y = clip.y; y < clip.bottom(); y++)
+  {
+    int32_t ty = y - dy;
+
+    // Source position of the row's first pixel, rounded to the nearest pixel
+    int32_t xs = cs * tx + sn * ty + ((int32_t)img.px << ROT_SCALE) + half;
+    int32_t ys = -sn * tx + cs * ty + ((int32_t)img.py << ROT_SCALE) + half;
+
+    // Which part of the row lands inside the source image
+    int32_t lo = 0, hi = clip.w - 1;
+    narrow(xs, cs, xLimit, lo, hi);
+    narrow(ys, -sn, yLimit, lo, hi);
+    if (lo > hi) continue;
+
+    xs += cs * lo;
+    ys -= sn * lo;
+    uint16_t *dst = c.row(y) + clip.x;
+    for (int32_t k = lo; k <= hi; k++, xs += cs, ys -= sn)
+    {
+      int16_t sx = xs >> ROT_SCALE;
+      int16_t sy = ys >> ROT_SCALE;
+      if (img.mask[sy * stride + (sx >> 3)] & (0x80 >> (sx & 7)))
+        dst[k] = img.pixels[sy * img.w + sx];
+    }
+  }
+}
+
+void drawRotatedSmooth(Canvas &c, const Sprite &img, const uint8_t *coverage,
+                       int32_t angle, int16_t dx, int16_t dy)
+{
+  Rect clip = rectIntersect(rotatedBounds(img, angle, dx, dy), c.area);
+  if (clip.empty()) return;
+
+  const int32_t sn = isin(angle);
+  const int32_t cs = icos(angle);
+  const int32_t one = 1 << ROT_SCALE;
+  const int16_t cstride = img.w + 2;
+
+  int32_t tx = clip.x - dx;
+  for (int16_t y = clip.y; y < clip.bottom(); y++)
+  {
+    int32_t ty = y - dy;
+
+    // Source position with pixel centres on whole numbers, shifted one pixel
+    // so the coverage border sits at 0. A sample can then touch the image for
+    // 0 < position < size + 1.
+    int32_t xs = cs * tx + sn * ty + ((int32_t)img.px << ROT_SCALE) + one;
+    int32_t ys = -sn * tx + cs * ty + ((int32_t)img.py << ROT_SCALE) + one;
+
+    int32_t lo = 0, hi = clip.w - 1;
+    narrow(xs, cs, (img.w + 1) * one, lo, hi);
+    narrow(ys, -sn, (img.h + 1) * one, lo, hi);
+    if (lo > hi) continue;
+
+    xs += cs * lo;
+    ys -= sn * lo;
+    uint16_t *dst = c.row(y) + clip.x;
+    for (int32_t k = lo; k <= hi; k++, xs += cs, ys -= sn)
+    {
+      int16_t cx = xs >> ROT_SCALE; // Coverage cell, top left of the four samples
+      int16_t cy = ys >> ROT_SCALE;
+      uint8_t fx = (xs >> (ROT_SCALE - 4)) & 15;
+      uint8_t fy = (ys >> (ROT_SCALE - 4)) & 15;
+
+      const uint8_t *cov = coverage + cy * cstride + cx;
+      uint8_t c00 = cov[0], c10 = cov[1], c01 = cov[cstride], c11 = cov[cstride + 1];
+
+      // Inside the solid part of the image: nearest pixel, no blending
+      if ((c00 & c10 & c01 & c11) == 255)
+      {
+        int16_t sx = cx - 1 + (fx >> 3);
+        int16_t sy = cy - 1 + (fy >> 3);
+        dst[k] = img.pixels[sy * img.w + sx];
+        continue;
+      }
+      if ((c00 | c10 | c01 | c11) == 0) continue;
+
+      // Bilinear coverage. Weights add up to 256.
+      uint16_t w00 = (16 - fx) * (16 - fy), w10 = fx * (16 - fy), w01 = (16 - fx) * fy, w11 = fx * fy;
+      uint32_t alpha = (w00 * c00 + w10 * c10 + w01 * c01 + w11 * c11) >> 8; // 0 to 255
+      if (alpha == 0) continue;
+
+      // Colour from the most heavily weighted sample that is part of the image
+      uint16_t best = 0;
+      int16_t sx = 0, sy = 0;
+      if (c00 && w00 >= best) { best = w00; sx = cx - 1; sy = cy - 1; }
+      if (c10 && w10 >= best) { best = w10; sx = cx; sy = cy - 1; }
+      if (c01 && w01 >= best) { best = w01; sx = cx - 1; sy = cy; }
+      if (c11 && w11 >= best) { best = w11; sx = cx; sy = cy; }
+      uint16_t fg = swap565(img.pixels[sy * img.w + sx]);
+
+      dst[k] = swap565(blend565(fg, swap565(dst[k]), (alpha + 4) >> 3));
+    }
+  }
+}
@@ -0,0 +1,56 @@
+#include "SaveUnder.h"
+#include "Kernels565.h"
+#include <stdlib.h>
+
+bool SaveUnder::begin(const Rect &area)
+{
+  buf = (uint16_t *)malloc(area.area() * sizeof(uint16_t));
+  if (!buf) return false;
+  sweep = area;
+  return true;
+}
+
+void SaveUnder::beginFrame(const Rect &next, bool changedUnder)
+{
+  // What was saved last frame is good unless something beneath has changed.
+  // Whatever is saved this frame replaces it.
+  restore = changedUnder ? Rect{0, 0, 0, 0} : saved;
+  saved = buf && rectContains(sweep, next) ? next : Rect{0, 0, 0, 0};
+}
+
+uint32_t SaveUnder::copy(Canvas &c, const Rect &r, bool toCanvas)
+{
+  Rect in = rectIntersect(c.area, r);
+  if (in.empty()) return 0;
+  for (int16_t y = in.y; y < in.bottom(); y++)
+  {
+    uint16_t *pixels = c.row(y) + in.x;
+    uint16_t *kept = slot(in.x, y);
+    if (toCanvas) copy565(pixels, kept, in.w);
+    else copy565(kept, pixels, in.w);
+  }
+  return in.area();
+}
+
+uint32_t SaveUnder::fill(Canvas &c, void (*under)(Canvas &c, void *ctx), void *ctx)
+{
+  uint32_t copied = 0;
+  Rect keep = rectIntersect(c.area, restore);
+  if (keep.empty())
+  {
+    under(c, ctx);
+  }
+  else
+  {
+    copied += copy(c, keep, true);
+    Rect rest[4];
+    uint8_t n = rectSubtract(c.area, keep, rest);
+    for (uint8_t i = 0; i < n; i++)
+    {
+      Canvas piece = c.clip(rest[i]);
+      under(piece, ctx);
+    }
+  }
+
+  return copied + copy(c, saved, false);
+}
@@ -0,0 +1,185 @@
+#include "SerialProtocol.h"
+#include <string.h>
+
+#define PROTO_LED_ALL 0x1FF
+#define PROTO_ANNUNCIATOR_ALL 0xFF
+
+// CRC-16/CCITT-FALSE (polynomial 0x1021), a nibble at a time from a 32 byte
+// table: small enough for core 0 to run on every byte.
+static const uint16_t crcNibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+static inline uint16_t crcByte(uint16_t crc, uint8_t b)
+{
+  crc = (crc << 4) ^ crcNibble[(crc >> 12) ^ (b >> 4)];
+  crc = (crc << 4) ^ crcNibble[(crc >> 12) ^ (b & 0x0F)];
+  return crc;
+}
+
+uint16_t protocolCrc(uint16_t crc, const uint8_t *data, size_t n)
+{
+  for (size_t i = 0; i < n; i++) crc = crcByte(crc, data[i]);
+  return crc;
+}
+
+//====================================================================================
+//                                    Parser
+//====================================================================================
+bool ProtocolParser::feed(uint8_t b)
+{
+  int8_t r = step(b);
+  if (r >= 0) return r;
+
+  // The frame was rejected. Its sync may have been noise with a real frame
+  // starting somewhere after it, so rescan its bytes. A frame rejected while
+  // rescanning has its own bytes rescanned first, then the rest. Each rescan
+  // is shorter than the one before, so this ends.
+  bool good = false;
+  size_t n = rawLen;
+  memcpy(replay, raw, n);
+  size_t i = 0;
+  while (i < n)
+  {
+    r = step(replay[i++]);
+    if (r > 0)
+      good = true;
+    else if (r < 0)
+    {
+      memmove(replay + rawLen, replay + i, n - i);
+      memcpy(replay, raw, rawLen);
+      n = rawLen + n - i;
+      i = 0;
+    }
+  }
+  return good;
+}
+
+// One byte through the state machine: 1 when it completes a good frame, -1
+// when it gets the frame rejected, 0 otherwise.
+int8_t ProtocolParser::step(uint8_t b)
+{
+  switch (state)
+  {
+  case SYNC:
+    if (b != PROTO_SYNC)
+    {
+      dropped++;
+      return 0;
+    }
+    state = LENGTH;
+    rawLen = 0;
+    crc = 0xFFFF;
+    return 0;
+
+  case LENGTH:
+    raw[rawLen++] = b;
+    if (b == 0 || b > PROTO_MAX_PAYLOAD) break;
+    len = b;
+    crc = crcByte(crc, b);
+    state = PAYLOAD;
+    return 0;
+
+  case PAYLOAD:
+    raw[rawLen++] = b;
+    crc = crcByte(crc, b);
+    if (rawLen == 1 + len) state = CRC_LO;
+    return 0;
+
+  case CRC_LO:
+    raw[rawLen++] = b;
+    state = CRC_HI;
+    return 0;
+
+  case CRC_HI:
+    raw[rawLen++] = b;
+    if ((raw[rawLen - 2] | b << 8) != crc || !apply()) break;
+    state = SYNC;
+    frames++;
+    return 1;
+  }
+
+  state = SYNC;
+  errors++;
+  return -1;
+}
+
+static inline uint16_t read16(const uint8_t *p) { return (uint16_t)(p[0] | p[1] << 8); }
+
+// Merge the frame's records into what is pending, or nothing if any record
+// is unknown or cut short.
+bool ProtocolParser::apply()
+{
+  InstrumentUpdate u = pending;
+  const uint8_t *p = raw + 1;
+  const uint8_t *end = p + len;
+  while (p < end)
+  {
+    uint8_t channel = *p++;
+    switch (channel)
+    {
+    case PROTO_NEEDLE:
+    case PROTO_BALL:
+    case PROTO_LEDS:
+    case PROTO_ANNUNCIATORS:
+      if (end - p < 2) return false;
+      if (channel == PROTO_NEEDLE) u.needle = (int16_t)read16(p);
+      if (channel == PROTO_BALL) u.ball = (int16_t)read16(p);
+      if (channel == PROTO_LEDS) u.leds = read16(p) & PROTO_LED_ALL;
+      if (channel == PROTO_ANNUNCIATORS) u.annunciators = read16(p) & PROTO_ANNUNCIATOR_ALL;
+      p += 2;
+      break;
+    case PROTO_TIMINGS:
+      break;
+    default:
+      return false;
+    }
+    u.changed |= 1 << channel;
+  }
+  pending = u;
+  return true;
+}
+
+bool ProtocolParser::take(InstrumentUpdate &u)
+{
+  if (!pending.changed) return false;
+  u = pending;
+  pending.changed = 0;
+  return true;
+}
+
+//====================================================================================
+//                                    Encoder
+//====================================================================================
+size_t protocolFrame(const uint8_t *payload, size_t len, uint8_t *out)
+{
+  if (len == 0 || len > PROTO_MAX_PAYLOAD) return 0;
+  out[0] = PROTO_SYNC;
+  out[1] = (uint8_t)len;
+  memcpy(out + 2, payload, len);
+  uint16_t crc = protocolCrc(0xFFFF, out + 1, len + 1);
+  out[len + 2] = crc & 0xFF;
+  out[len + 3] = crc >> 8;
+  return len + 4;
+}
+
+static uint8_t *put16(uint8_t *p, uint8_t channel, uint16_t v)
+{
+  *p++ = channel;
+  *p++ = v & 0xFF;
+  *p++ = v >> 8;
+  return p;
+}
+
+size_t protocolEncode(const InstrumentUpdate &u, uint8_t *out)
+{
+  uint8_t payload[PROTO_MAX_PAYLOAD];
+  uint8_t *p = payload;
+  if (PROTO_HAS(u, PROTO_NEEDLE)) p = put16(p, PROTO_NEEDLE, (uint16_t)u.needle);
+  if (PROTO_HAS(u, PROTO_BALL)) p = put16(p, PROTO_BALL, (uint16_t)u.ball);
+  if (PROTO_HAS(u, PROTO_LEDS)) p = put16(p, PROTO_LEDS, u.leds);
+  if (PROTO_HAS(u, PROTO_ANNUNCIATORS)) p = put16(p, PROTO_ANNUNCIATORS, u.annunciators);
+  if (PROTO_HAS(u, PROTO_TIMINGS)) *p++ = PROTO_TIMINGS;
+  return protocolFrame(payload, p - payload, out);
+}
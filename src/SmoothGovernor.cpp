@@ -0,0 +1,33 @@
+#include "SmoothGovernor.h"
+
+SmoothGovernor::SmoothGovernor(uint16_t retryFrames)
+    : retryFrames(retryFrames), held(retryFrames)
+{
+}
+
+bool SmoothGovernor::beginFrame(uint32_t budgetMicros)
+{
+  if (held < retryFrames) held++;
+
+  bool next = on;
+  if (budgetMicros == 0) next = false;
+  else if (on) next = cost <= budgetMicros;
+  else
+  {
+    cost -= cost / 8;
+    next = held >= retryFrames && cost <= budgetMicros / 4 * 3;
+  }
+
+  if (next != on)
+  {
+    on = next;
+    held = 0;
+    switches++;
+  }
+  return on;
+}
+
+void SmoothGovernor::endFrame(uint32_t costMicros)
+{
+  if (on && costMicros) cost = (cost * 3 + costMicros) / 4;
+}
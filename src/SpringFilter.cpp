@@ -0,0 +1,49 @@
+#include "SpringFilter.h"
+
+SpringFilter::SpringFilter(uint16_t omega)
+    : omega((int32_t)omega << 16)
+{
+}
+
+void SpringFilter::reset(int32_t value)
+{
+  x = target = value;
+  v = 0;
+  still = true;
+}
+
+void SpringFilter::setTarget(int32_t value)
+{
+  if (value == target) return;
+  target = value;
+  still = false;
+}
+
+void SpringFilter::step(uint32_t dtMicros)
+{
+  if (still) return;
+  if (omega == 0)
+  {
+    reset(target);
+    return;
+  }
+
+  // Time is Q8.24 seconds, fine enough that a 4 ms step still moves a slow
+  // value. Products are rounded rather than truncated so nothing creeps.
+  const int64_t w = omega;
+  const int64_t w2 = (w * w + (1 << 15)) >> 16;
+  while (dtMicros)
+  {
+    uint32_t h = dtMicros < SPRING_MAX_STEP_US ? dtMicros : SPRING_MAX_STEP_US;
+    dtMicros -= h;
+    int64_t dt = ((int64_t)h << 24) / 1000000;
+
+    // a = omega^2 (target - x) - 2 omega v
+    int64_t a = ((w2 * (target - x) - 2 * w * v) + (1 << 15)) >> 16;
+    v += (int32_t)((a * dt + (1 << 23)) >> 24);
+    x += (int32_t)(((int64_t)v * dt + (1 << 23)) >> 24);
+  }
+
+  int32_t off = target - x;
+  if (off > -SPRING_SETTLE && off < SPRING_SETTLE && v > -SPRING_SETTLE_SPEED && v < SPRING_SETTLE_SPEED) reset(target);
+}
@@ -0,0 +1,34 @@
+#include "Sprite.h"
+#include "Kernels565.h"
+
+// Transparent sprites are drawn from their opaque runs, a word-wide copy per
+// run, so clear pixels cost nothing and no pixel is tested on its own.
+void drawSprite(Canvas &c, const Sprite &s, int16_t x, int16_t y)
+{
+  if (!s.spans)
+  {
+    drawImage(c, x, y, s.w, s.h, s.pixels);
+    return;
+  }
+
+  Rect clip = rectIntersect(spriteRect(s, x, y), c.area);
+  if (clip.empty()) return;
+
+  // Clip edges in sprite coordinates
+  const int16_t left = clip.x - x;
+  const int16_t right = clip.right() - x;
+
+  for (int16_t yy = clip.y; yy < clip.bottom(); yy++)
+  {
+    const int16_t r = yy - y;
+    const uint16_t *src = s.pixels + r * s.w;
+    uint16_t *dst = c.row(yy) + x;
+    for (uint16_t i = s.rowSpans[r]; i < s.rowSpans[r + 1]; i++)
+    {
+      const SpriteSpan &span = s.spans[i];
+      int16_t x0 = span.x > left ? span.x : left;
+      int16_t x1 = span.x + span.len < right ? span.x + span.len : right;
+      if (x0 < x1) copy565(dst + x0, src + x0, x1 - x0);
+    }
+  }
+}
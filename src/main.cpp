@@ -20,62 +20,310 @@
 
 #include <Arduino.h>
 
-#include "dial_image.h"
-#include "ball_image.h"
-#include "plane_image.h"
-#include "LED_Images.h"
+#include "assets.h" // Generated from assets/ by tools/gen_assets.py
+#include "Annunciators.h"
+#include "DirtyRegion.h"
+#include "FrameScheduler.h"
+#include "FrameTimings.h"
+#include "BandScheduler.h"
+#include "Canvas.h"
+#include "Instrument.h"
+#include "TurnCoordinator.h"
+#include "PlaneCache.h"
+#include "InstrumentState.h"
+#include "Seqlock.h"
+#include "SerialProtocol.h"
+#include "SmoothGovernor.h"
+#include "Sprite.h"
+#include "SpringFilter.h"
+
+#if defined(ARDUINO_ARCH_RP2040)
+#include <hardware/sync.h>
+#endif
 
 #include <TFT_eSPI.h>      // Hardware-specific library
 TFT_eSPI tft = TFT_eSPI(); // Invoke custom library
 
-// Sprites used in display
-TFT_eSprite mainSpr = TFT_eSprite(&tft); // Main sprite. Full screen.
+// There is no full-screen sprite. A 320x300 frame would take 192 KB, most of
+// the RP2040's RAM. Instead each dirty area is composed a band at a time
+// straight into a DMA buffer from the instrument's layers, each clipped to
+// the band. One band is streamed to the panel while the next is composed.
+// The turn coordinator's size and the plane pivot are in TurnCoordinator.h.
 
-// The plane and the ball need to be sprites so they can be rotated and masked.
-TFT_eSprite planeSpr = TFT_eSprite(&tft); // Plane sprite
-TFT_eSprite ballSpr = TFT_eSprite(&tft);  // Turn coordinator ball sprite
+// Two 320x20 band buffers, 25 KB in all.
+#define BAND_PIXELS (TURN_COORD_WIDTH * 20)
+uint16_t bandBuf[2][BAND_PIXELS];
 
-// The LEDs can just be overlayed.
-
-// Create image buffers for double buffering
-#define INSTRUMENT_WIDTH 320
-#define INSTRUMENT_HEIGHT 300
+// Streams bands to the panel with TFT_eSPI's DMA engine.
+class TftDmaSink : public BandSink
+{
+public:
+  explicit TftDmaSink(TFT_eSPI &tft) : tft(tft) {}
+
+  void startTransfer(const Rect &r, const uint16_t *pixels) override
+  {
+    TIME_STAGE(STAGE_PUSH);
+    if (!writing)
+    {
+      tft.startWrite(); // DMA needs the bus held. Nothing else shares it, so keep it.
+      writing = true;
+    }
+    tft.pushImageDMA(r.x, r.y, r.w, r.h, (uint16_t *)pixels);
+  }
+
+  void wait() override
+  {
+    TIME_STAGE(STAGE_PUSH);
+    tft.dmaWait();
+  }
+
+private:
+  TFT_eSPI &tft;
+  bool writing = false;
+};
+
+TftDmaSink dmaSink(tft);
+BandScheduler bands(dmaSink, bandBuf[0], bandBuf[1], BAND_PIXELS);
+
+// The annunciator strip below it has its own, 320x10 each, 12.5 KB in all.
+// Both share the sink and take turns on the bus.
+#define ANNUNCIATOR_BAND_PIXELS (ANNUNCIATOR_WIDTH * 10)
+uint16_t annunciatorBandBuf[2][ANNUNCIATOR_BAND_PIXELS];
+BandScheduler annunciatorBands(dmaSink, annunciatorBandBuf[0], annunciatorBandBuf[1], ANNUNCIATOR_BAND_PIXELS);
 
 // State Variables
-// LEDs
-bool altLedState = false,
-     rdyLedState = false,
-     lowVoltLedState = false,
-     upLedState = false,
-     downLedState = false,
-     stLedState = false,
-     hdLedState = false,
-     trkLoLedState = false,
-     trkHiLedState = false;
-// Turn Coordinator Needle
-double turnCoorNeedle = 50; // 0 to 100, 50 is centered.
-// Ball
-double inclinometerBall = 0;  // -100 to 100 with 0 being centered.
+// Work is split across the two RP2040 cores. Core 0 runs setup()/loop(): it
+// takes input and updates state through the set* functions. Core 1 runs
+// setup1()/loop1(): it owns the TFT and renders from the latest snapshot.
+// Each setter publishes a new snapshot, so input never waits on a frame push.
+InstrumentState state;                 // Core 0 only
+Seqlock<InstrumentState> stateChannel; // Core 0 writes, core 1 reads
+InstrumentState frame;                 // Core 1 only. The state being drawn.
+uint32_t frameSeq = UINT32_MAX;        // Snapshot sequence last drawn
+
+// The annunciator strip's state, handed over the same way on its own channel.
+AnnunciatorState annunciatorState;            // Core 0 only
+Seqlock<AnnunciatorState> annunciatorChannel; // Core 0 writes, core 1 reads
+AnnunciatorState annunciatorFrame;            // Core 1 only. The state being drawn.
+uint32_t annunciatorSeq = UINT32_MAX;         // Snapshot sequence last drawn
+
+// Frame pacing. Core 1 draws at most FRAME_RATE_HZ frames a second, on fixed
+// deadlines, and reports missed ones every FRAME_REPORT_SECONDS. The test
+// pattern on core 0 steps at TEST_STEP_HZ and leaves the rest of the loop
+// free for input.
+#ifndef FRAME_RATE_HZ
+#define FRAME_RATE_HZ 60
+#endif
+#ifndef FRAME_REPORT_SECONDS
+#define FRAME_REPORT_SECONDS 10
+#endif
+#ifndef TEST_STEP_HZ
+#define TEST_STEP_HZ 100
+#endif
+FrameScheduler frameClock(FRAME_RATE_HZ, micros); // Core 1 only
+FrameScheduler testClock(TEST_STEP_HZ, micros);   // Core 0 only
+
+// Core 1 sleeps while there is nothing new to draw, and core 0 wakes it
+// when it publishes. Changes too small to see are never published: the
+// needle has to move the wingtip by half a pixel, the ball by half a pixel.
+// The wingtip is as far from the pivot as the plane is half wide.
+#define NEEDLE_DEGREES_PER_PERCENT 0.6
+#define BALL_PIXELS_PER_UNIT 50
+const double needleMinChange = 0.5 / (planeSprite.w / 2) * (180 / PI) / NEEDLE_DEGREES_PER_PERCENT;
+const double ballMinChange = 0.5 / BALL_PIXELS_PER_UNIT;
+
+// Input smoothing. Core 1 eases the needle and ball towards the latest
+// values, a step per frame, so they glide however seldom new values arrive.
+// Speeds in rad/s: a jump settles to 2% in about 5.8 / omega seconds.
+// 0 shows the inputs as they come.
+#ifndef NEEDLE_OMEGA
+#define NEEDLE_OMEGA 18
+#endif
+#ifndef BALL_OMEGA
+#define BALL_OMEGA 12
+#endif
+SpringFilter needleFilter(NEEDLE_OMEGA); // Core 1 only
+SpringFilter ballFilter(BALL_OMEGA);     // Core 1 only
+uint32_t filterStepped;                  // When the filters were last stepped
+bool filtersStarted = false;             // Whether they have been reset to the inputs
+
+// Render stage timings, with -D FRAME_TIMING only. Core 1 sends a binary
+// summary (FrameTimings::serialize) every FRAME_TIMING_SECONDS, and
+// whenever the host sends PROTO_TIMINGS.
+#if defined(FRAME_TIMING)
+#ifndef FRAME_TIMING_SECONDS
+#define FRAME_TIMING_SECONDS 10
+#endif
+FrameTimings frameTimings(micros);             // Core 1 only
+std::atomic<bool> frameTimingRequested(false); // Set by core 0
+uint32_t frameTimingSent;                      // When core 1 last sent one
+void sendFrameTimings();
+#endif
+
+// Input from the host, in the binary protocol of SerialProtocol.h. Whatever
+// has arrived is applied once per loop and published as one snapshot. The
+// test pattern runs until the first good frame.
+ProtocolParser hostLink; // Core 0 only
+bool hostSeen = false;   // Core 0 only
+int publishHeld = 0;     // Core 0 only. While set, setters only mark the state changed.
+bool publishPending = false;
+bool annunciatorsPending = false;
+// PROTO_LEDS is copied straight into InstrumentState::leds.
+static_assert((uint16_t)PROTO_LED_ST == LED_ST && (uint16_t)PROTO_LED_HD == LED_HD &&
+                  (uint16_t)PROTO_LED_TRK_LO == LED_TRK_LO && (uint16_t)PROTO_LED_TRK_HI == LED_TRK_HI &&
+                  (uint16_t)PROTO_LED_ALT == LED_ALT && (uint16_t)PROTO_LED_UP == LED_UP &&
+                  (uint16_t)PROTO_LED_DOWN == LED_DOWN && (uint16_t)PROTO_LED_RDY == LED_RDY &&
+                  (uint16_t)PROTO_LED_LOW_VOLT == LED_LOW_VOLT,
+              "protocol and state LED bits differ");
+
+// The turn coordinator, bottom layer first: dial, ball, the LEDs and the
+// plane on top. LED positions on the dial are in assets/layout.txt. The
+// layers read frame, the snapshot core 1 is drawing.
+//
+// Each LED also has tiles of itself lit and dark over the dial, baked by the
+// asset pipeline. An LED that changes while the ball and plane are clear of
+// it is sent straight from flash, with nothing composed.
+//
+// Every layer that moves keeps a save-under buffer. The plane's holds the
+// dial, ball and LEDs beneath it, the ball's just the dial. They cover
+// everywhere each can go, about 40 KB and 10 KB. Build with -D SAVE_UNDER=0
+// to compose every dirty area from the dial up instead.
+//
+// Build with -D FULL_REDRAW=1 to compose and send both instruments whole,
+// from the dial up, every frame. It is the reference for everything above:
+// on the native build, the goldens must still pass with -p.
+#ifndef FULL_REDRAW
+#define FULL_REDRAW 0
+#endif
+#ifndef SAVE_UNDER
+#define SAVE_UNDER !FULL_REDRAW
+#endif
+// What setup1() starts the instruments with. The compositor tests set them
+// before it runs, to try every mode in one build.
+bool useSaveUnders = SAVE_UNDER;
+bool useFullRedraw = FULL_REDRAW;
+
+int32_t planeAngle();
+Point ballPosition();
+Rect ballRect(double inclinometer);
+
+// Smooth needle. The plane follows the needle in 1/16 degree steps with
+// anti-aliased edges, as long as that fits in PLANE_SMOOTH_BUDGET_PERCENT of
+// the frame period (2 ms at 60 Hz). When it does not, the plane snaps to
+// whole degrees from the cache, and smooth is tried again no sooner than
+// PLANE_SMOOTH_RETRY_FRAMES later (see SmoothGovernor.h).
+//
+// A smooth frame costs 30 to 50 times what a cached one does on the host
+// (tools/bench_plane.cpp), and about twice a nearest-neighbour rotation.
+// So would any rotation done per frame: the cache is a few row copies. It
+// is only paid on frames where the plane moves, and the budget keeps it
+// inside the frame deadline. Build with -D PLANE_SMOOTH_BUDGET_PERCENT=0 for
+// whole degrees at cache cost always.
+#ifndef PLANE_SMOOTH_BUDGET_PERCENT
+#define PLANE_SMOOTH_BUDGET_PERCENT 12
+#endif
+#ifndef PLANE_SMOOTH_RETRY_FRAMES
+#define PLANE_SMOOTH_RETRY_FRAMES FRAME_RATE_HZ
+#endif
+
+class PlaneLayer : public Layer
+{
+public:
+  PlaneLayer() { stage = STAGE_PLANE; }
+  bool update() override;
+  void draw(Canvas &c) override;
+  Rect sweep() const override { return planeSweep(); }
+
+  // Once the frame is out, fold what the plane cost into the estimate.
+  void frameDone();
+
+private:
+  SmoothGovernor governor{PLANE_SMOOTH_RETRY_FRAMES};
+  uint32_t frameCost = 0; // Time spent on the plane this frame
+  int32_t angle = 0;       // Angle it is drawn at this frame
+  bool smooth = false;     // Whether this frame draws it smooth
+  bool drawnOnce = false;
+};
+
+// The dial is drawn from 8-bit palette indices, 96.5 KB of flash and one
+// table lookup per pixel. Build with -D DIAL_PACKED=1 to draw the same pixels
+// from packed row segments instead, in 84 KB, at the cost of decoding them:
+// tools/bench_dial times both.
+#ifndef DIAL_PACKED
+#define DIAL_PACKED 0
+#endif
+#if DIAL_PACKED
+ImageLayer dialLayer(dialPacked, 0, 0);
+#else
+ImageLayer dialLayer(dialIndexed, 0, 0);
+#endif
+TranslatedLayer ballLayer(ballSprite, ballPosition, rectUnion(ballRect(-1), rectUnion(ballRect(0), ballRect(1))));
+ToggleLayer ledLayers[] = {
+    {stDot, frame.leds, LED_ST, &stDotTiles},
+    {hdDot, frame.leds, LED_HD, &hdDotTiles},
+    {trkLoDot, frame.leds, LED_TRK_LO, &trkLoDotTiles},
+    {trkHiDot, frame.leds, LED_TRK_HI, &trkHiDotTiles},
+    {altDot, frame.leds, LED_ALT, &altDotTiles},
+    {upDot, frame.leds, LED_UP, &upDotTiles},
+    {downDot, frame.leds, LED_DOWN, &downDotTiles},
+    {readyDot, frame.leds, LED_RDY, &readyDotTiles},
+    {lowVoltFlag, frame.leds, LED_LOW_VOLT, &lowVoltFlagTiles},
+};
+PlaneLayer planeLayer;
+
+Layer *const turnCoordLayers[] = {
+    &dialLayer, &ballLayer,
+    &ledLayers[0], &ledLayers[1], &ledLayers[2], &ledLayers[3], &ledLayers[4],
+    &ledLayers[5], &ledLayers[6], &ledLayers[7], &ledLayers[8],
+    &planeLayer,
+};
+Instrument turnCoordinator(Rect{0, 0, TURN_COORD_WIDTH, TURN_COORD_HEIGHT}, turnCoordLayers);
+
+// The annunciator strip, on the panel below the turn coordinator: two rows
+// of four lamps on black.
+FillLayer annunciatorBackground(Rect{0, 0, ANNUNCIATOR_WIDTH, ANNUNCIATOR_HEIGHT}, TFT_BLACK);
+AnnunciatorLayer annunciatorLamps[ANNUNCIATOR_COUNT] = {
+    {Rect{6, 8, 74, 78}, "AP", TFT_GREEN, annunciatorFrame.lit[0]},
+    {Rect{84, 8, 74, 78}, "HDG", TFT_GREEN, annunciatorFrame.lit[1]},
+    {Rect{162, 8, 74, 78}, "NAV", TFT_GREEN, annunciatorFrame.lit[2]},
+    {Rect{240, 8, 74, 78}, "APR", TFT_GREEN, annunciatorFrame.lit[3]},
+    {Rect{6, 94, 74, 78}, "REV", TFT_GREEN, annunciatorFrame.lit[4]},
+    {Rect{84, 94, 74, 78}, "GS", TFT_GREEN, annunciatorFrame.lit[5]},
+    {Rect{162, 94, 74, 78}, "ALT", TFT_GREEN, annunciatorFrame.lit[6]},
+    {Rect{240, 94, 74, 78}, "TRIM", TFT_ORANGE, annunciatorFrame.lit[7]},
+};
+
+Layer *const annunciatorLayers[] = {
+    &annunciatorBackground,
+    &annunciatorLamps[0], &annunciatorLamps[1], &annunciatorLamps[2], &annunciatorLamps[3],
+    &annunciatorLamps[4], &annunciatorLamps[5], &annunciatorLamps[6], &annunciatorLamps[7],
+};
+Instrument annunciators(Rect{0, TURN_COORD_HEIGHT, ANNUNCIATOR_WIDTH, ANNUNCIATOR_HEIGHT}, annunciatorLayers);
 
 void setTurnCoordNeedle(double percent);
 void setInclinometerBall(double percent);
-void setApTrimUpLight(bool state);
-void setApTrimDownLight(bool state);
-void setApTrkLoLight(bool state);
-void setApTrkHiLight(bool state);
-void setApStLight(bool state);
-void setApRdyLight(bool state);
-void setApHdLight(bool state);
-void setApAltLight(bool state);
-void setLowVoltLight(bool state);
-
-
-void displayLeds();
-void displayTurnCoordNeedle();
-void displayBall();
+void setApTrimUpLight(bool on);
+void setApTrimDownLight(bool on);
+void setApTrkLoLight(bool on);
+void setApTrkHiLight(bool on);
+void setApStLight(bool on);
+void setApRdyLight(bool on);
+void setApHdLight(bool on);
+void setApAltLight(bool on);
+void setLowVoltLight(bool on);
+void setLed(uint16_t led, bool on);
+void setLeds(uint16_t leds);
+void setAnnunciator(uint8_t which, bool on);
+
+void reportFrameStats();
+void readHostLink();
+void publishState();
+void publishAnnunciators();
+void waitForState();
+void stepFilters(bool moving);
 
 //====================================================================================
-//                                    Setup
+//                                Setup (core 0)
 //====================================================================================
 void setup()
 {
@@ -90,36 +338,46 @@ void setup()
   // so the build-in LED can be used for very crude debugging. 
   pinMode(LED_BUILTIN, OUTPUT);
   digitalWrite(LED_BUILTIN, HIGH);
+}
 
-
-  // tft.initDMA(); // Init DMA engine to speed up rendering
-
+//====================================================================================
+//                                Setup (core 1)
+//====================================================================================
+void setup1()
+{
   tft.begin();
+  tft.initDMA(); // Init DMA engine so bands can go out while the next one is prepared
   tft.setRotation(0); // 0 & 2 Portrait. 1 & 3 landscape
-  tft.fillScreen(TFT_BLACK); // Clear screen. We are only going to use the top part. If you don't clear, the bottom half will be noise.
-
-  mainSpr.createSprite(INSTRUMENT_WIDTH, INSTRUMENT_HEIGHT);
-  mainSpr.setSwapBytes(true);
-  mainSpr.setPivot(160, 150);                       // Set the pivot point for the rotation of the background
-
-  // Create a sprite to hold the jpeg (or part of it)
-  planeSpr.createSprite(planeOutlineWidth, planeOutlineHeight);
-  planeSpr.setPivot(planeCenterX, planeCenterY); // Determined in paint program. Plane rotates around the center of the fuselage.
-  planeSpr.setSwapBytes(true);
-  planeSpr.pushImage(0, 0, planeOutlineWidth, planeOutlineHeight, planeOutline);
-
-  ballSpr.createSprite(ballWidth, ballHeight);
-  ballSpr.pushImage(0, 0, ballWidth, ballHeight, ball_image);
-
+  tft.fillScreen(TFT_BLACK); // Clear screen. Both instruments send everything on their first frame anyway.
+
+  if (!planeCacheBegin()) Serial.println("Plane cache did not fit, rotating every frame");
+  const PlaneCacheInfo &cache = planeCacheInfo();
+  Serial.printf("Plane cache: %lu bytes in %s, %lu spans, built in %lu us\r\n",
+                (unsigned long)cache.bytes, cache.buildMicros ? "RAM" : "flash",
+                (unsigned long)cache.spans, (unsigned long)cache.buildMicros);
+
+  dialLayer.stage = STAGE_DIAL;
+  ballLayer.stage = STAGE_BALL;
+  for (ToggleLayer &led : ledLayers) led.stage = STAGE_LEDS;
+  if (!turnCoordinator.begin(useSaveUnders))
+    Serial.println("Save-under buffers did not fit, composing from the dial");
+  turnCoordinator.setFullRedraw(useFullRedraw);
+  for (AnnunciatorLayer &lamp : annunciatorLamps) lamp.stage = STAGE_ANNUNCIATORS;
+  annunciators.begin(false); // Nothing moves
+  annunciators.setFullRedraw(useFullRedraw);
 
   Serial.println("\r\nInitialisation done.\r\n");
 }
 
 //====================================================================================
-//                                    Loop
+//                                Loop (core 0)
 //====================================================================================
 void loop()
 {
+    // Host input is read every time round. The test pattern only moves on
+    // at TEST_STEP_HZ, and stops once the host has spoken.
+    readHostLink();
+    if (hostSeen || !testClock.due()) return;
 
     static int i = 0;
 
@@ -139,103 +397,258 @@ void loop()
     setApTrimUpLight(i>90);
     setApTrimDownLight(i<10);
     setLowVoltLight(!(i/10 % 5));
+
+    // Light the annunciators one at a time, then all together.
+    for (uint8_t a = 0; a < ANNUNCIATOR_COUNT; a++) setAnnunciator(a, i/10 == a || i/10 == ANNUNCIATOR_COUNT);
     
 
     if (i>100) i = 0; 
     else i++;
+}
 
-    // This part will be in the mobiflight event loop
-    
-    mainSpr.pushImage(0, 0, dialWidth, dialHeight, dial); // Put a fresh background in the changing area to overwrite old plane.
-    displayBall();
-    displayLeds();
-
-    // Do the plane last. It's on top of all the others.
-    displayTurnCoordNeedle();
-
-    mainSpr.pushSprite(0, 0); // Push the main sprite to the screen
+//====================================================================================
+//                                Loop (core 1)
+//====================================================================================
+void loop1()
+{
+  // Nothing new from core 0 and nothing still gliding: sleep until there is.
+  // Time asleep does not count against the frame deadlines.
+  bool fresh = stateChannel.sequence() != frameSeq;
+  bool annunciatorsFresh = annunciatorChannel.sequence() != annunciatorSeq;
+  bool moving = !needleFilter.settled() || !ballFilter.settled();
+  if (!fresh && !annunciatorsFresh && !moving)
+  {
+    waitForState();
+    frameClock.resync();
+    return;
+  }
+
+  // Draw at the next frame deadline.
+  if (!frameClock.due()) return;
+  reportFrameStats();
+  if (fresh) frameSeq = stateChannel.read(frame);
+  if (annunciatorsFresh) annunciatorSeq = annunciatorChannel.read(annunciatorFrame);
+  stepFilters(moving);
+
+#if defined(FRAME_TIMING)
+  frameTimings.beginFrame();
+#endif
+  {
+    TIME_STAGE(STAGE_FRAME);
+    turnCoordinator.collect();    // Work out what moved or toggled since the last frame
+    turnCoordinator.push(bands); // Compose just those areas, band by band, and send them
+    // The strip below does the same with its own buffers. Its first band is
+    // composed while the last one above is still going out.
+    annunciators.collect();
+    annunciators.push(annunciatorBands);
+  }
+#if defined(FRAME_TIMING)
+  frameTimings.endFrame();
+  sendFrameTimings();
+#endif
+
+  planeLayer.frameDone();
+}
 
-    delay(10);   // Wont need this in mobiflight; it handles delays.
+#if defined(FRAME_TIMING)
+// Send the stage timings when asked, or when FRAME_TIMING_SECONDS is up,
+// and start collecting afresh.
+void sendFrameTimings()
+{
+  uint32_t now = micros();
+  if (!frameTimingRequested && now - frameTimingSent < FRAME_TIMING_SECONDS * 1000000UL) return;
+
+  uint8_t buf[FRAME_TIMINGS_BYTES];
+  Serial.write(buf, frameTimings.serialize(buf));
+  frameTimings.clear();
+  frameTimingRequested = false;
+  frameTimingSent = now;
 }
+#endif
 
-void displayLeds()
+// Ease the needle and ball towards the latest inputs by the time since the
+// last frame. Setting off from rest they take one frame period instead, so
+// time spent asleep does not turn into a jump.
+void stepFilters(bool moving)
 {
-  if (stLedState) mainSpr.pushImage(STDotX, STDotY, APDot_width, APDot_height, APDot);
-  if (hdLedState) mainSpr.pushImage(HDDotX, HDDotY, APDot_width, APDot_height, APDot);
-  if (trkLoLedState) mainSpr.pushImage(TrkLoDotX, TrkLoDotY, APDot_width, APDot_height, APDot);
-  if (trkHiLedState) mainSpr.pushImage(TrkHiDotX, TrkHiDotY, APDot_width, APDot_height, APDot);
+  int32_t needle = lround(frame.turnCoorNeedle * Q16_ONE);
+  int32_t ball = lround(frame.inclinometerBall * Q16_ONE);
+  if (!filtersStarted)
+  {
+    needleFilter.reset(needle);
+    ballFilter.reset(ball);
+    filtersStarted = true;
+  }
+  needleFilter.setTarget(needle);
+  ballFilter.setTarget(ball);
+
+  uint32_t now = micros();
+  uint32_t dt = moving ? now - filterStepped : frameClock.period();
+  filterStepped = now;
+  needleFilter.step(dt);
+  ballFilter.step(dt);
+}
 
-  if (altLedState) mainSpr.pushImage(AltDot_x, AltDot_y, AltDot_width, AltDot_height, AltDot);
+// Feed the parser everything Serial has, then apply the latest value of each
+// channel that arrived. The setters' publishes are held and made as one.
+void readHostLink()
+{
+  while (Serial.available()) hostLink.feed(Serial.read());
+  InstrumentUpdate u;
+  if (!hostLink.take(u)) return;
+  hostSeen = true;
+
+  publishHeld++;
+  if (PROTO_HAS(u, PROTO_NEEDLE)) setTurnCoordNeedle((double)u.needle / PROTO_NEEDLE_ONE);
+  if (PROTO_HAS(u, PROTO_BALL)) setInclinometerBall((double)u.ball / PROTO_BALL_ONE);
+  if (PROTO_HAS(u, PROTO_LEDS)) setLeds(u.leds); // Same bits on the wire as in the state
+  if (PROTO_HAS(u, PROTO_ANNUNCIATORS))
+    for (uint8_t a = 0; a < ANNUNCIATOR_COUNT; a++) setAnnunciator(a, u.annunciators >> a & 1);
+#if defined(FRAME_TIMING)
+  if (PROTO_HAS(u, PROTO_TIMINGS)) frameTimingRequested = true;
+#endif
+  publishHeld--;
+  if (publishPending) publishState();
+  if (annunciatorsPending) publishAnnunciators();
+}
 
-  if (upLedState) mainSpr.pushImage(UpDot_x, UpDot_y, UpDot_width, UpDot_height, UpDot);
-  if (downLedState) mainSpr.pushImage(DownDot_x, DownDot_y, DownDot_width, DownDot_height, DownDot);
+// Publish the current state and wake core 1 if it is asleep.
+void publishState()
+{
+  if (publishHeld)
+  {
+    publishPending = true;
+    return;
+  }
+  publishPending = false;
+  stateChannel.publish(state);
+#if defined(ARDUINO_ARCH_RP2040)
+  __sev();
+#endif
+}
 
-  if (rdyLedState) mainSpr.pushImage(ReadyDot_x, ReadyDot_y, ReadyDot_width, ReadyDot_height, ReadyDot);
+// The same for the annunciator strip, on its own channel.
+void publishAnnunciators()
+{
+  if (publishHeld)
+  {
+    annunciatorsPending = true;
+    return;
+  }
+  annunciatorsPending = false;
+  annunciatorChannel.publish(annunciatorState);
+#if defined(ARDUINO_ARCH_RP2040)
+  __sev();
+#endif
+}
 
-  if (lowVoltLedState) mainSpr.pushImage(LowVoltFlag_x, LowVoltFlag_y, LowVoltFlag_width, LowVoltFlag_height, LowVoltFlag);
+// Sleep core 1 until core 0 publishes. It may wake early, which is harmless.
+void waitForState()
+{
+#if defined(ARDUINO_ARCH_RP2040)
+  __wfe();
+#endif
+}
 
-  return;
+// Every FRAME_REPORT_SECONDS, say how many frames started too late, if any.
+void reportFrameStats()
+{
+  if (frameClock.frameCount() < FRAME_RATE_HZ * FRAME_REPORT_SECONDS) return;
+  if (frameClock.missedCount())
+    Serial.printf("Frames: %lu, %lu missed deadlines, %lu skipped\r\n", (unsigned long)frameClock.frameCount(),
+                  (unsigned long)frameClock.missedCount(), (unsigned long)frameClock.skippedCount());
+  frameClock.resetCounts();
 }
 
 // number from 0 to 100, with 50 being centered.
 void setTurnCoordNeedle(double percent)
 {
-  turnCoorNeedle = percent;
+  if (fabs(percent - state.turnCoorNeedle) < needleMinChange) return;
+  state.turnCoorNeedle = percent;
+  publishState();
 }
 
 // Number from -1 to 1, with 0 being centered.
 void setInclinometerBall(double percent)
 {
-  inclinometerBall = percent;
-}
-
-void displayBall()
-{ 
-  double angle = inclinometerBall * 50;
-  ballSpr.pushToSprite(&mainSpr, mainSpr.width() / 2 + angle - 13, mainSpr.height() - ballSpr.height() - round((abs(angle) / 5)) - 22, TFT_WHITE);
+  if (fabs(percent - state.inclinometerBall) < ballMinChange) return;
+  state.inclinometerBall = percent;
+  publishState();
 }
 
-void displayTurnCoordNeedle()
+// Where the ball sprite's top left corner goes for an inclinometer value.
+Rect ballRect(double inclinometer)
 {
-  double angle = (turnCoorNeedle - 50) * 0.6;
-
-  planeSpr.pushRotated( &mainSpr, (int16_t)angle, TFT_WHITE); // Push the plane sprite on the background
-
+  double angle = inclinometer * BALL_PIXELS_PER_UNIT;
+  int16_t x = TURN_COORD_WIDTH / 2 + lround(angle) - 13;
+  int16_t y = TURN_COORD_HEIGHT - ballSprite.h - round((fabs(angle) / 5)) - 22;
+  return spriteRect(ballSprite, x, y);
 }
 
-void setApTrimUpLight(bool state)
+Point ballPosition()
 {
-  upLedState = state;
+  Rect r = ballRect((double)ballFilter.value() / Q16_ONE);
+  return Point{r.x, r.y};
 }
-void setApTrimDownLight(bool state)
-{
-  downLedState = state;
-}
-void setApTrkLoLight(bool state)
-{
-  trkLoLedState = state;
-}
-void setApTrkHiLight(bool state)
+
+// Bank angle in 1/16ths of a degree
+int32_t planeAngle()
 {
-  trkHiLedState = state;
+  double angle = ((double)needleFilter.value() / Q16_ONE - 50) * NEEDLE_DEGREES_PER_PERCENT;
+  return (int32_t)(angle * ANGLE_STEPS);
 }
-void setApStLight(bool state)
+
+// Decide once per frame how the plane is drawn, so every band agrees.
+bool PlaneLayer::update()
 {
-  stLedState = state;
+  int32_t a = planeAngle();
+  bool s = governor.beginFrame(frameClock.period() * PLANE_SMOOTH_BUDGET_PERCENT / 100);
+  if (!s) a = a / ANGLE_STEPS * ANGLE_STEPS;
+  bool changed = !drawnOnce || a != angle || s != smooth;
+  angle = a;
+  smooth = s;
+  drawnOnce = true;
+  frameCost = 0;
+  bounds = planeBounds(a);
+  return changed;
 }
-void setApRdyLight(bool state)
+
+// The plane rotates around the center of the fuselage (its pivot in assets/layout.txt).
+// Whole degrees come pre-rotated from the plane cache.
+void PlaneLayer::draw(Canvas &c)
 {
-  rdyLedState = state;
+  uint32_t start = micros();
+  if (smooth) drawPlaneSmooth(c, angle);
+  else drawPlane(c, angle);
+  frameCost += micros() - start;
 }
-void setApHdLight(bool state)
+
+void PlaneLayer::frameDone() { governor.endFrame(frameCost); }
+
+// Light or put out some LEDs. Only publishes if that changes anything.
+void setLeds(uint16_t leds)
 {
-  hdLedState = state;
+  if (leds == state.leds) return;
+  state.leds = leds;
+  publishState();
 }
-void setApAltLight(bool state)
+
+void setLed(uint16_t led, bool on) { setLeds(on ? state.leds | led : state.leds & ~led); }
+
+void setApTrimUpLight(bool on) { setLed(LED_UP, on); }
+void setApTrimDownLight(bool on) { setLed(LED_DOWN, on); }
+void setApTrkLoLight(bool on) { setLed(LED_TRK_LO, on); }
+void setApTrkHiLight(bool on) { setLed(LED_TRK_HI, on); }
+void setApStLight(bool on) { setLed(LED_ST, on); }
+void setApRdyLight(bool on) { setLed(LED_RDY, on); }
+void setApHdLight(bool on) { setLed(LED_HD, on); }
+void setApAltLight(bool on) { setLed(LED_ALT, on); }
+void setLowVoltLight(bool on) { setLed(LED_LOW_VOLT, on); }
+
+// Annunciator lamp 0 to ANNUNCIATOR_COUNT - 1, in the order of annunciatorLamps.
+void setAnnunciator(uint8_t which, bool on)
 {
-  altLedState = state;
+  if (which >= ANNUNCIATOR_COUNT || annunciatorState.lit[which] == on) return;
+  annunciatorState.lit[which] = on;
+  publishAnnunciators();
 }
-void setLowVoltLight(bool state)
-{
-  lowVoltLedState = state;
-}
\ No newline at end of file
@@ -0,0 +1,241 @@
+// BandScheduler against a recording sink that stands in for the DMA engine.
+// The sink only reads a transfer's pixels when wait() says it has landed, so
+// a buffer refilled too early shows up on its panel as well as in the checks.
+//
+//   pio test -e native -f test_band_scheduler
+//
+// On the host TFT_eSPI::dmaWait() returns at once, so the firmware itself
+// never has a transfer in flight while it fills; these tests do.
+
+#include <BandScheduler.h>
+#include <string.h>
+#include <random>
+#include <vector>
+#include <unity.h>
+
+#define PANEL_W 320
+#define PANEL_H 480
+
+// Records every transfer and lands it on its own panel at wait().
+class RecordingSink : public BandSink
+{
+public:
+  void startTransfer(const Rect &r, const uint16_t *pixels) override
+  {
+    TEST_ASSERT_NULL_MESSAGE(inFlight, "startTransfer() before wait()");
+    TEST_ASSERT_TRUE(r.x >= 0 && r.y >= 0 && r.right() <= PANEL_W && r.bottom() <= PANEL_H);
+    inFlight = pixels;
+    inFlightRect = r;
+    starts.push_back(pixels);
+  }
+
+  void wait() override
+  {
+    TEST_ASSERT_NOT_NULL_MESSAGE(inFlight, "wait() with nothing in flight");
+    for (int16_t y = 0; y < inFlightRect.h; y++)
+      memcpy(&panel[inFlightRect.y + y][inFlightRect.x], inFlight + y * inFlightRect.w, inFlightRect.w * 2);
+    inFlight = nullptr;
+  }
+
+  uint16_t panel[PANEL_H][PANEL_W];
+  const uint16_t *inFlight = nullptr;
+  Rect inFlightRect;
+  std::vector<const uint16_t *> starts; // Pixels of each transfer, in order
+};
+
+static RecordingSink sink;
+static uint16_t expected[PANEL_H][PANEL_W]; // What the panel should show
+
+#define BUF_PIXELS (PANEL_W * 7)
+static uint16_t buf[4][BUF_PIXELS]; // Two per scheduler
+static uint16_t tile[PANEL_W * 16];
+
+// A fill that knows which scheduler it fills for, and checks it is never
+// handed the buffer on its way to the panel.
+struct Filler
+{
+  uint16_t tag;
+  uint16_t *const *bufs;
+  std::vector<const uint16_t *> filled; // Buffer of each fill, in order
+};
+
+static uint16_t pattern(uint16_t tag, int16_t x, int16_t y) { return tag * 7919 + y * PANEL_W + x; }
+
+static void fill(const Rect &r, uint16_t *dst, void *ctx)
+{
+  Filler &f = *(Filler *)ctx;
+  TEST_ASSERT_TRUE_MESSAGE(dst != sink.inFlight, "buffer refilled while in flight");
+  TEST_ASSERT_TRUE(dst == f.bufs[0] || dst == f.bufs[1]);
+  f.filled.push_back(dst);
+  for (int16_t y = r.y; y < r.bottom(); y++)
+    for (int16_t x = r.x; x < r.right(); x++) *dst++ = pattern(f.tag, x, y);
+}
+
+static void push(BandScheduler &s, Filler &f, const Rect &r)
+{
+  s.push(r, fill, &f);
+  for (int16_t y = r.y; y < r.bottom(); y++)
+    for (int16_t x = r.x; x < r.right(); x++) expected[y][x] = pattern(f.tag, x, y);
+}
+
+static void pushTile(BandScheduler &s, const Rect &r, uint16_t tag)
+{
+  for (int32_t i = 0; i < r.area(); i++) tile[i] = tag * 31 + i;
+  s.pushPixels(r, tile);
+  for (int32_t i = 0; i < r.area(); i++) expected[r.y + i / r.w][r.x + i % r.w] = tile[i];
+}
+
+static void assertPanel()
+{
+  TEST_ASSERT_NULL(sink.inFlight);
+  TEST_ASSERT_EQUAL_UINT16_ARRAY(&expected[0][0], &sink.panel[0][0], PANEL_W * PANEL_H);
+}
+
+static uint16_t *bufsA[2] = {buf[0], buf[1]};
+static uint16_t *bufsB[2] = {buf[2], buf[3]};
+
+void setUp()
+{
+  memset(sink.panel, 0, sizeof(sink.panel));
+  memset(expected, 0, sizeof(expected));
+  sink.inFlight = nullptr;
+  sink.starts.clear();
+  sink.busy = false;
+}
+
+void tearDown() {}
+
+// Every band lands with the pixels it was filled with, in ping-pong order,
+// and each transfer waits for the one before.
+void test_bands_alternate_and_land_intact()
+{
+  BandScheduler s(sink, bufsA[0], bufsA[1], BUF_PIXELS);
+  Filler f{1, bufsA};
+  push(s, f, Rect{0, 0, PANEL_W, 50}); // 8 bands, the last short
+  TEST_ASSERT_EQUAL_UINT32(8, s.bandCount());
+  TEST_ASSERT_EQUAL_UINT32(PANEL_W * 50, s.pixelCount());
+  TEST_ASSERT_EQUAL(8, f.filled.size());
+  for (size_t i = 0; i < f.filled.size(); i++)
+  {
+    TEST_ASSERT_EQUAL_PTR(bufsA[i & 1], f.filled[i]);
+    TEST_ASSERT_EQUAL_PTR(f.filled[i], sink.starts[i]);
+  }
+  // The last band is still in flight until finish().
+  TEST_ASSERT_EQUAL_PTR(bufsA[1], sink.inFlight);
+  TEST_ASSERT_TRUE(sink.busy);
+  s.finish();
+  TEST_ASSERT_FALSE(sink.busy);
+  assertPanel();
+}
+
+// Several pushes in a row carry the ping-pong across them: the first band
+// of a push never refills the buffer the last one is still sending.
+void test_successive_pushes_keep_alternating()
+{
+  BandScheduler s(sink, bufsA[0], bufsA[1], BUF_PIXELS);
+  Filler f{2, bufsA};
+  push(s, f, Rect{10, 10, 30, 5});  // One band each
+  push(s, f, Rect{100, 40, 8, 8});
+  push(s, f, Rect{0, 300, 200, 15}); // Two
+  push(s, f, Rect{5, 5, 1, 1});
+  s.finish();
+  TEST_ASSERT_EQUAL(5, f.filled.size());
+  for (size_t i = 0; i < f.filled.size(); i++) TEST_ASSERT_EQUAL_PTR(bufsA[i & 1], f.filled[i]);
+  assertPanel();
+}
+
+// A tile sent from elsewhere takes its turn on the bus but no buffer: the
+// next band still fills the buffer that is free.
+void test_push_pixels_leaves_next_alone()
+{
+  BandScheduler s(sink, bufsA[0], bufsA[1], BUF_PIXELS);
+  Filler f{3, bufsA};
+  push(s, f, Rect{0, 0, 20, 20});
+  pushTile(s, Rect{40, 0, 16, 16}, 1);
+  TEST_ASSERT_EQUAL_PTR(tile, sink.inFlight);
+  push(s, f, Rect{0, 100, 20, 20});
+  s.finish();
+  TEST_ASSERT_EQUAL_PTR(bufsA[0], f.filled[0]);
+  TEST_ASSERT_EQUAL_PTR(bufsA[1], f.filled[1]);
+  TEST_ASSERT_EQUAL(3, sink.starts.size());
+  TEST_ASSERT_EQUAL_PTR(tile, sink.starts[1]);
+  TEST_ASSERT_EQUAL_UINT32(3, s.bandCount());
+  assertPanel();
+
+  // Nothing at all is sent for an empty one.
+  s.pushPixels(Rect{0, 0, 0, 16}, tile);
+  TEST_ASSERT_EQUAL(3, sink.starts.size());
+}
+
+// The turn coordinator and annunciator schedulers share one sink, as in
+// main.cpp: whichever sends next waits for the other's transfer, and each
+// keeps to its own buffers.
+void test_schedulers_take_turns_on_a_shared_sink()
+{
+  BandScheduler a(sink, bufsA[0], bufsA[1], BUF_PIXELS);
+  BandScheduler b(sink, bufsB[0], bufsB[1], PANEL_W * 3);
+  Filler fa{4, bufsA}, fb{5, bufsB};
+
+  push(a, fa, Rect{0, 0, PANEL_W, 20});
+  push(b, fb, Rect{0, 300, PANEL_W, 10});
+  push(a, fa, Rect{50, 50, 100, 30});
+  pushTile(b, Rect{200, 400, 16, 16}, 2);
+  push(b, fb, Rect{0, 420, 64, 20});
+  a.finish();
+  push(b, fb, Rect{0, 460, PANEL_W, 4});
+  b.finish();
+  assertPanel();
+
+  size_t transfers = fa.filled.size() + fb.filled.size() + 1;
+  TEST_ASSERT_EQUAL(transfers, sink.starts.size());
+  TEST_ASSERT_EQUAL_UINT32(transfers, a.bandCount() + b.bandCount());
+  for (size_t i = 0; i < fa.filled.size(); i++) TEST_ASSERT_EQUAL_PTR(bufsA[i & 1], fa.filled[i]);
+  for (size_t i = 0; i < fb.filled.size(); i++) TEST_ASSERT_EQUAL_PTR(bufsB[i & 1], fb.filled[i]);
+}
+
+// Random rectangles, tiles and finishes from both schedulers.
+void test_random_interleaving()
+{
+  BandScheduler a(sink, bufsA[0], bufsA[1], BUF_PIXELS);
+  BandScheduler b(sink, bufsB[0], bufsB[1], PANEL_W * 3);
+  Filler fa{6, bufsA}, fb{7, bufsB};
+  BandScheduler *s[2] = {&a, &b};
+  Filler *f[2] = {&fa, &fb};
+
+  std::mt19937 rng(42);
+  for (int step = 0; step < 2000; step++)
+  {
+    int which = rng() & 1;
+    int16_t w = 1 + rng() % PANEL_W, h = 1 + rng() % 40;
+    int16_t x = rng() % (PANEL_W - w + 1), y = rng() % (PANEL_H - h + 1);
+    switch (rng() % 4)
+    {
+    case 0:
+      s[which]->finish();
+      break;
+    case 1:
+      // The tile stays untouched until finish(), so only send one after it.
+      s[0]->finish();
+      s[1]->finish();
+      pushTile(*s[which], Rect{x, y, (int16_t)(w < 16 ? w : 16), (int16_t)(h < 16 ? h : 16)}, step);
+      s[which]->finish();
+      break;
+    default:
+      push(*s[which], *f[which], Rect{x, y, w, h});
+    }
+  }
+  a.finish();
+  b.finish();
+  assertPanel();
+}
+
+int main(int, char **)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_bands_alternate_and_land_intact);
+  RUN_TEST(test_successive_pushes_keep_alternating);
+  RUN_TEST(test_push_pixels_leaves_next_alone);
+  RUN_TEST(test_schedulers_take_turns_on_a_shared_sink);
+  RUN_TEST(test_random_interleaving);
+  return UNITY_END();
+}
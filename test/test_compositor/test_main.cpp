@@ -0,0 +1,238 @@
+// The compositor against a full redraw: whatever the dirty areas, bands,
+// save-unders and tiles send, the panel has to end up exactly as if every
+// frame had been composed and sent whole.
+//
+//   pio test -e native -f test_compositor
+//
+// Each run starts the firmware afresh in a child process, in one of the
+// modes setup1() can be given, so runs never share state. The child drives
+// the firmware a step at a time on the simulated clock and sends back a hash
+// of the screen after every step. The runs in each mode must agree step for
+// step. Needs fork(), so a POSIX host.
+//
+// The child can also compose the whole panel into one full-frame canvas after
+// every step, as a reference for what the bands sent.
+//
+// Besides the firmware's own sweep, seeded random scripts call the setters
+// the serial protocol drives, in the same order in every mode, so the dirty
+// areas, LED tiles and save-unders meet in combinations the sweep never
+// reaches.
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <random>
+#include <vector>
+#include <unity.h>
+#include "Annunciators.h"
+#include "Canvas.h"
+#include "Instrument.h"
+
+// From src/main.cpp.
+void setup();
+void setup1();
+void loop();
+void loop1();
+extern TFT_eSPI tft;
+extern Instrument turnCoordinator;
+extern Instrument annunciators;
+extern bool useSaveUnders;
+extern bool useFullRedraw;
+void setTurnCoordNeedle(double percent);
+void setInclinometerBall(double percent);
+void setApTrimUpLight(bool on);
+void setApTrimDownLight(bool on);
+void setApTrkLoLight(bool on);
+void setApTrkHiLight(bool on);
+void setApStLight(bool on);
+void setApRdyLight(bool on);
+void setApHdLight(bool on);
+void setApAltLight(bool on);
+void setLowVoltLight(bool on);
+void setAnnunciator(uint8_t which, bool on);
+
+#define FRAME_MICROS (1000000 / 60 + 1) // One frame at the firmware's 60 Hz
+
+struct Mode
+{
+  const char *name;
+  bool saveUnders, fullRedraw;
+};
+
+static const Mode incremental = {"incremental", true, false};
+static const Mode fullRedraw = {"full redraw", false, true};
+static const Mode noSaveUnders = {"without save-unders", false, false};
+
+// The panel after a step, and the same frame composed in one go if asked for.
+struct Frame
+{
+  uint64_t screen, composed;
+};
+
+// One step of input for the firmware, before the clock moves on.
+typedef void (*Script)(uint32_t step, std::mt19937 &rng);
+
+static uint64_t hashPixels(const uint16_t *p)
+{
+  uint64_t h = 14695981039346656037ull;
+  for (int32_t i = 0; i < tft.width() * tft.height(); i++) h = (h ^ p[i]) * 1099511628211ull;
+  return h;
+}
+
+// Both instruments composed into one canvas the size of the panel.
+static uint64_t composedHash()
+{
+  static std::vector<uint16_t> frame(tft.width() * tft.height());
+  Canvas c(frame.data(), Rect{0, 0, (int16_t)tft.width(), (int16_t)tft.height()});
+  turnCoordinator.compose(c);
+  annunciators.compose(c);
+  return hashPixels(frame.data());
+}
+
+// The screen after each of steps steps, tick microseconds apart, and if
+// reference, the frame composed whole.
+static std::vector<Frame> run(const Mode &mode, Script script, uint32_t seed, uint32_t steps, unsigned long tick,
+                              bool reference = false)
+{
+  int fds[2];
+  TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+  fflush(stdout);
+  pid_t child = fork();
+  TEST_ASSERT_TRUE(child >= 0);
+
+  if (child == 0)
+  {
+    close(fds[0]);
+    Serial.quiet = true;
+    useSaveUnders = mode.saveUnders;
+    useFullRedraw = mode.fullRedraw;
+    setup();
+    setup1();
+    std::mt19937 rng(seed);
+    for (uint32_t step = 0; step < steps; step++)
+    {
+      script(step, rng);
+      nativeAdvanceMicros(tick);
+      loop1();
+      Frame f = {hashPixels(tft.framebuffer()), reference ? composedHash() : 0};
+      if (write(fds[1], &f, sizeof(f)) != sizeof(f)) _exit(1);
+    }
+    _exit(0);
+  }
+
+  close(fds[1]);
+  std::vector<Frame> frames;
+  Frame f;
+  while (read(fds[0], &f, sizeof(f)) == sizeof(f)) frames.push_back(f);
+  close(fds[0]);
+  int status;
+  waitpid(child, &status, 0);
+  TEST_ASSERT_TRUE_MESSAGE(WIFEXITED(status) && WEXITSTATUS(status) == 0, "firmware run did not finish");
+  TEST_ASSERT_EQUAL_UINT32(steps, frames.size());
+  return frames;
+}
+
+static void assertSameFrames(const Mode &mode, const std::vector<Frame> &got, const std::vector<Frame> &want,
+                             uint32_t seed)
+{
+  for (size_t i = 0; i < want.size(); i++)
+  {
+    if (got[i].screen == want[i].screen) continue;
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%s differs from full redraw at step %zu, seed %u", mode.name, i, (unsigned)seed);
+    TEST_FAIL_MESSAGE(msg);
+  }
+}
+
+// The firmware's own test pattern, as the native harness runs it: loop()
+// every millisecond, and loop1() drawing whenever a frame is due.
+static void sweep(uint32_t, std::mt19937 &) { loop(); }
+
+// Two passes of the sweep.
+void test_sweep_matches_full_redraw()
+{
+  const uint32_t steps = 2500;
+  std::vector<Frame> want = run(fullRedraw, sweep, 0, steps, 1000);
+  assertSameFrames(incremental, run(incremental, sweep, 0, steps, 1000), want, 0);
+}
+
+// What the 20-row bands left on the panel against each frame composed in
+// one full-frame canvas. Without save-unders, so composing the reference
+// changes nothing the next frame relies on.
+void test_bands_match_full_frame()
+{
+  const uint32_t steps = 2500;
+  std::vector<Frame> frames = run(noSaveUnders, sweep, 0, steps, 1000, true);
+  for (size_t i = 0; i < frames.size(); i++)
+  {
+    if (frames[i].screen == frames[i].composed) continue;
+    char msg[64];
+    snprintf(msg, sizeof(msg), "bands differ from the full frame at step %zu", i);
+    TEST_FAIL_MESSAGE(msg);
+  }
+}
+
+// A few inputs a frame, drawn from rng: needle nudges and jumps, the ball
+// drifting and jumping, LEDs and annunciator lamps going on and off,
+// sometimes several at once and sometimes nothing at all.
+static void randomInputs(uint32_t step, std::mt19937 &rng)
+{
+  static void (*const lights[])(bool) = {
+      setApTrimUpLight, setApTrimDownLight, setApTrkLoLight, setApTrkHiLight, setApStLight,
+      setApRdyLight, setApHdLight, setApAltLight, setLowVoltLight,
+  };
+  static double needle, ball;
+  if (step == 0) needle = 50, ball = 0;
+
+  uint32_t kind = rng() % 8;
+  if (kind < 3)
+  {
+    needle += (int32_t)(rng() % 21) - 10 + (rng() % 16) / 16.0;
+    if (needle < -5) needle = -5;
+    if (needle > 105) needle = 105;
+    setTurnCoordNeedle(needle);
+  }
+  if (kind == 3 || kind == 4)
+  {
+    ball += ((int32_t)(rng() % 41) - 20) / 100.0;
+    if (ball < -1.1) ball = -1.1;
+    if (ball > 1.1) ball = 1.1;
+    setInclinometerBall(ball);
+  }
+  if (kind >= 4)
+  {
+    for (uint32_t n = rng() % 3; n > 0; n--) lights[rng() % 9](rng() % 2);
+    if (rng() % 4 == 0) setAnnunciator(rng() % ANNUNCIATOR_COUNT, rng() % 2);
+  }
+  if (kind == 7 && rng() % 4 == 0)
+  {
+    setTurnCoordNeedle(needle = rng() % 101);
+    setInclinometerBall(ball = ((int32_t)(rng() % 201) - 100) / 100.0);
+  }
+}
+
+// Eight seeds of random input, a frame per step, with and without
+// save-unders, against a full redraw of the same inputs.
+void test_random_inputs_match_full_redraw()
+{
+  const uint32_t steps = 3000;
+  for (uint32_t seed = 1; seed <= 8; seed++)
+  {
+    std::vector<Frame> want = run(fullRedraw, randomInputs, seed, steps, FRAME_MICROS);
+    assertSameFrames(incremental, run(incremental, randomInputs, seed, steps, FRAME_MICROS), want, seed);
+    assertSameFrames(noSaveUnders, run(noSaveUnders, randomInputs, seed, steps, FRAME_MICROS), want, seed);
+  }
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main(int, char **)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_sweep_matches_full_redraw);
+  RUN_TEST(test_bands_match_full_frame);
+  RUN_TEST(test_random_inputs_match_full_redraw);
+  return UNITY_END();
+}
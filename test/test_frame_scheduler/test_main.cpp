@@ -0,0 +1,192 @@
+// FrameScheduler on a fake clock the test steps by hand: frames land on
+// absolute deadlines, late frames catch up by skipping rather than bunching,
+// and the rate does not drift however long each frame takes.
+//
+//   pio test -e native -f test_frame_scheduler
+
+#include <FrameScheduler.h>
+#include <unity.h>
+
+static unsigned long now;
+static unsigned long fakeClock() { return now; }
+
+// Poll every microsecond up to until, the way loop1() polls, and return how
+// many frames came due. If at is given, records when each one did.
+static uint32_t pollUntil(FrameScheduler &s, unsigned long until, unsigned long *at = nullptr)
+{
+  uint32_t frames = 0;
+  for (; (long)(until - now) > 0; now++)
+  {
+    if (!s.due()) continue;
+    if (at) at[frames] = now;
+    frames++;
+  }
+  return frames;
+}
+
+void setUp() { now = 1000; }
+void tearDown() {}
+
+void test_period()
+{
+  FrameScheduler s(60, fakeClock);
+  TEST_ASSERT_EQUAL_UINT32(16666, s.period());
+  s.setRate(100);
+  TEST_ASSERT_EQUAL_UINT32(10000, s.period());
+  s.setRate(0); // Treated as 1 Hz rather than dividing by zero
+  TEST_ASSERT_EQUAL_UINT32(1000000, s.period());
+}
+
+void test_due_once_per_deadline()
+{
+  FrameScheduler s(100, fakeClock);
+  TEST_ASSERT_TRUE(s.due()); // The first call always is
+  TEST_ASSERT_FALSE(s.due());
+  now += 9999;
+  TEST_ASSERT_FALSE(s.due());
+  now += 1;
+  TEST_ASSERT_TRUE(s.due());
+  TEST_ASSERT_FALSE(s.due());
+  TEST_ASSERT_EQUAL_UINT32(2, s.frameCount());
+  TEST_ASSERT_EQUAL_UINT32(0, s.missedCount());
+}
+
+// Each frame takes a different, sometimes long, time; deadlines stay one
+// period apart from the first.
+void test_deadlines_are_absolute()
+{
+  FrameScheduler s(100, fakeClock);
+  const unsigned long start = now;
+  unsigned long at[101];
+  for (uint32_t f = 0; f <= 100; f++)
+  {
+    while (!s.due()) now++;
+    at[f] = now;
+    now += (f * 7919) % 9000; // Work, always less than a period
+  }
+  for (uint32_t f = 0; f <= 100; f++) TEST_ASSERT_EQUAL_UINT32(start + f * 10000, at[f]);
+  TEST_ASSERT_EQUAL_UINT32(0, s.missedCount());
+  TEST_ASSERT_EQUAL_UINT32(0, s.skippedCount());
+}
+
+void test_no_drift_over_an_hour()
+{
+  FrameScheduler s(60, fakeClock);
+  const unsigned long start = now;
+  uint32_t frames = 0;
+  // Poll in steps of 1 ms plus whatever each frame's work took.
+  for (uint32_t i = 0; frames < 60 * 3600; i++)
+  {
+    if (s.due())
+    {
+      frames++;
+      TEST_ASSERT_TRUE(s.lateness() < 1000 + 3000);
+      now += i % 3000;
+    }
+    now += 1000;
+  }
+  // The last frame is no later than a poll step plus a frame's work past
+  // its deadline.
+  unsigned long last = start + (frames - 1) * s.period();
+  TEST_ASSERT_TRUE(now - last < 1000 + 3000 + 1000);
+  TEST_ASSERT_EQUAL_UINT32(0, s.missedCount());
+}
+
+// A frame that runs 3.5 periods long: the next one starts at once, late,
+// the deadlines it owes are skipped, and the ones after are back on the
+// original grid.
+void test_overrun_skips_and_realigns()
+{
+  FrameScheduler s(100, fakeClock);
+  const unsigned long start = now;
+  TEST_ASSERT_TRUE(s.due());
+  now += 35000;
+  TEST_ASSERT_TRUE(s.due());
+  TEST_ASSERT_EQUAL_UINT32(25000, s.lateness());
+  TEST_ASSERT_EQUAL_UINT32(1, s.missedCount());
+  TEST_ASSERT_EQUAL_UINT32(2, s.skippedCount());
+  TEST_ASSERT_FALSE(s.due()); // No burst of frames to make up
+
+  unsigned long at[3];
+  TEST_ASSERT_EQUAL_UINT32(3, pollUntil(s, start + 70000, at));
+  TEST_ASSERT_EQUAL_UINT32(start + 40000, at[0]);
+  TEST_ASSERT_EQUAL_UINT32(start + 50000, at[1]);
+  TEST_ASSERT_EQUAL_UINT32(start + 60000, at[2]);
+  TEST_ASSERT_EQUAL_UINT32(0, s.lateness());
+}
+
+// Late by less than a period is late, not missed.
+void test_late_within_period_is_not_missed()
+{
+  FrameScheduler s(100, fakeClock);
+  TEST_ASSERT_TRUE(s.due());
+  now += 19999;
+  TEST_ASSERT_TRUE(s.due());
+  TEST_ASSERT_EQUAL_UINT32(9999, s.lateness());
+  TEST_ASSERT_EQUAL_UINT32(0, s.missedCount());
+  now += 1;
+  TEST_ASSERT_TRUE(s.due()); // Its own deadline, not pushed back
+}
+
+void test_resync_after_idle()
+{
+  FrameScheduler s(100, fakeClock);
+  TEST_ASSERT_TRUE(s.due());
+
+  // A deadline still ahead stays put.
+  now += 4000;
+  s.resync();
+  TEST_ASSERT_FALSE(s.due());
+  now += 6000;
+  TEST_ASSERT_TRUE(s.due());
+
+  // Idle for a second: due at once, on time, then a period on from there.
+  now += 1000000;
+  s.resync();
+  const unsigned long woke = now;
+  TEST_ASSERT_TRUE(s.due());
+  TEST_ASSERT_EQUAL_UINT32(0, s.lateness());
+  TEST_ASSERT_EQUAL_UINT32(0, s.missedCount());
+  TEST_ASSERT_EQUAL_UINT32(0, s.skippedCount());
+  unsigned long at[1];
+  TEST_ASSERT_EQUAL_UINT32(1, pollUntil(s, woke + 10001, at));
+  TEST_ASSERT_EQUAL_UINT32(woke + 10000, at[0]);
+}
+
+void test_clock_wrap()
+{
+  now = 0xFFFFFFFFul - 15000;
+  FrameScheduler s(100, fakeClock);
+  const unsigned long start = now;
+  unsigned long at[4];
+  TEST_ASSERT_EQUAL_UINT32(4, pollUntil(s, start + 40000, at));
+  for (uint32_t f = 0; f < 4; f++) TEST_ASSERT_EQUAL_UINT32((uint32_t)(start + f * 10000), (uint32_t)at[f]);
+  TEST_ASSERT_EQUAL_UINT32(0, s.missedCount());
+}
+
+void test_reset_counts()
+{
+  FrameScheduler s(100, fakeClock);
+  TEST_ASSERT_TRUE(s.due());
+  now += 50000;
+  TEST_ASSERT_TRUE(s.due());
+  s.resetCounts();
+  TEST_ASSERT_EQUAL_UINT32(0, s.frameCount());
+  TEST_ASSERT_EQUAL_UINT32(0, s.missedCount());
+  TEST_ASSERT_EQUAL_UINT32(0, s.skippedCount());
+}
+
+int main(int, char **)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_period);
+  RUN_TEST(test_due_once_per_deadline);
+  RUN_TEST(test_deadlines_are_absolute);
+  RUN_TEST(test_no_drift_over_an_hour);
+  RUN_TEST(test_overrun_skips_and_realigns);
+  RUN_TEST(test_late_within_period_is_not_missed);
+  RUN_TEST(test_resync_after_idle);
+  RUN_TEST(test_clock_wrap);
+  RUN_TEST(test_reset_counts);
+  return UNITY_END();
+}
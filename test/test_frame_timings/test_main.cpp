@@ -0,0 +1,182 @@
+// FrameTimings: which bucket each time lands in, percentiles against the
+// sorted samples, per-frame totals across bands, clearing, and the dump.
+//
+//   pio test -e native -f test_frame_timings
+
+#include <FrameTimings.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <unity.h>
+
+static unsigned long now;
+static unsigned long fakeClock() { return now; }
+
+static uint32_t get32(const uint8_t *p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+
+void setUp() { now = 0; }
+void tearDown() {}
+
+// Every time falls in the lowest bucket whose top is at or above it, and
+// that top is no more than 25% over, up to where the last bucket saturates.
+void test_bucket_mapping()
+{
+  for (uint32_t t = 0; t < 16; t++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(t, Histogram::bucket(t));
+    TEST_ASSERT_EQUAL_UINT32(t, Histogram::bucketTop(t));
+  }
+
+  const uint32_t last = Histogram::bucketTop(HISTOGRAM_BUCKETS - 1);
+  TEST_ASSERT_EQUAL_UINT32(16777215, last); // 16.7 s
+  for (uint32_t t = 16; t <= last; t += 1 + t / 1024)
+  {
+    uint8_t b = Histogram::bucket(t);
+    TEST_ASSERT_TRUE(Histogram::bucketTop(b) >= t);
+    TEST_ASSERT_TRUE(Histogram::bucketTop(b - 1) < t);
+    TEST_ASSERT_TRUE(Histogram::bucketTop(b) - t < (t + 3) / 4);
+  }
+  for (uint8_t b = 16; b < HISTOGRAM_BUCKETS; b++)
+  {
+    TEST_ASSERT_EQUAL_UINT32(b, Histogram::bucket(Histogram::bucketTop(b)));
+    TEST_ASSERT_EQUAL_UINT32(b, Histogram::bucket(Histogram::bucketTop(b - 1) + 1));
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(HISTOGRAM_BUCKETS - 1, Histogram::bucket(last + 1));
+  TEST_ASSERT_EQUAL_UINT32(HISTOGRAM_BUCKETS - 1, Histogram::bucket(UINT32_MAX));
+}
+
+// Percentiles of random samples against the same percentile of the sorted
+// samples: the top of its bucket, or the largest sample if that is lower.
+void test_percentiles_match_sorted_samples()
+{
+  std::mt19937 rng(3);
+  for (uint32_t n : {1u, 2u, 7u, 100u, 1000u, 12345u})
+  {
+    Histogram h;
+    std::vector<uint32_t> samples;
+    for (uint32_t i = 0; i < n; i++)
+    {
+      // Mostly frame-sized, with a long tail.
+      uint32_t t = rng() % 4 ? 2000 + rng() % 20000 : rng() % 2000000;
+      samples.push_back(t);
+      h.record(t);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    TEST_ASSERT_EQUAL_UINT32(n, h.count());
+    TEST_ASSERT_EQUAL_UINT32(samples.front(), h.min());
+    TEST_ASSERT_EQUAL_UINT32(samples.back(), h.max());
+    for (uint8_t p : {0, 1, 50, 90, 99, 100})
+    {
+      uint32_t rank = ((uint64_t)n * p + 99) / 100;
+      uint32_t exact = samples[rank ? rank - 1 : 0];
+      uint32_t want = std::min(Histogram::bucketTop(Histogram::bucket(exact)), samples.back());
+      TEST_ASSERT_EQUAL_UINT32(want, h.percentile(p));
+      TEST_ASSERT_TRUE(h.percentile(p) >= exact);
+    }
+  }
+}
+
+void test_percentiles_of_known_samples()
+{
+  Histogram h;
+  for (uint32_t t = 1; t <= 100; t++) h.record(t);
+  TEST_ASSERT_EQUAL_UINT32(1, h.percentile(1));
+  TEST_ASSERT_EQUAL_UINT32(55, h.percentile(50)); // 50 is in 48..55
+  TEST_ASSERT_EQUAL_UINT32(100, h.percentile(99)); // 99 is in 96..111, capped at the largest
+  TEST_ASSERT_EQUAL_UINT32(100, h.percentile(100));
+}
+
+void test_clear()
+{
+  Histogram h;
+  TEST_ASSERT_EQUAL_UINT32(0, h.percentile(50));
+  h.record(5000);
+  h.record(70);
+  h.clear();
+  TEST_ASSERT_EQUAL_UINT32(0, h.count());
+  TEST_ASSERT_EQUAL_UINT32(0, h.min());
+  TEST_ASSERT_EQUAL_UINT32(0, h.max());
+  TEST_ASSERT_EQUAL_UINT32(0, h.percentile(50));
+  h.record(9);
+  TEST_ASSERT_EQUAL_UINT32(1, h.count());
+  TEST_ASSERT_EQUAL_UINT32(9, h.min());
+  TEST_ASSERT_EQUAL_UINT32(9, h.max());
+  TEST_ASSERT_EQUAL_UINT32(9, h.percentile(99));
+}
+
+// A stage that runs in several bands files one sample, the frame's total.
+// A stage that does not run files nothing.
+void test_stage_totals_per_frame()
+{
+  FrameTimings t(fakeClock);
+  for (uint32_t frame = 0; frame < 10; frame++)
+  {
+    t.beginFrame();
+    for (uint32_t band = 0; band < 3; band++)
+    {
+      StageScope plane(t, STAGE_PLANE);
+      now += 100 + frame;
+    }
+    if (frame % 2) t.add(STAGE_LEDS, 7);
+    t.endFrame();
+  }
+
+  const Histogram &plane = t.stage(STAGE_PLANE);
+  TEST_ASSERT_EQUAL_UINT32(10, plane.count());
+  TEST_ASSERT_EQUAL_UINT32(300, plane.min());
+  TEST_ASSERT_EQUAL_UINT32(327, plane.max());
+  TEST_ASSERT_EQUAL_UINT32(5, t.stage(STAGE_LEDS).count());
+  TEST_ASSERT_EQUAL_UINT32(7, t.stage(STAGE_LEDS).max());
+  TEST_ASSERT_EQUAL_UINT32(0, t.stage(STAGE_BALL).count());
+
+  t.clear();
+  for (uint8_t s = 0; s < STAGE_COUNT; s++) TEST_ASSERT_EQUAL_UINT32(0, t.stage((Stage)s).count());
+}
+
+void test_serialize()
+{
+  FrameTimings t(fakeClock);
+  t.beginFrame();
+  t.add(STAGE_FRAME, 4000);
+  t.add(STAGE_DIAL, 12);
+  t.endFrame();
+  t.beginFrame();
+  t.add(STAGE_FRAME, 9000);
+  t.endFrame();
+
+  uint8_t out[FRAME_TIMINGS_BYTES + 1];
+  TEST_ASSERT_EQUAL_UINT32(FRAME_TIMINGS_BYTES, t.serialize(out));
+  TEST_ASSERT_EQUAL('F', out[0]);
+  TEST_ASSERT_EQUAL('T', out[1]);
+  TEST_ASSERT_EQUAL(1, out[2]);
+  TEST_ASSERT_EQUAL(STAGE_COUNT, out[3]);
+  for (uint8_t s = 0; s < STAGE_COUNT; s++)
+  {
+    const uint8_t *p = out + 4 + s * 20;
+    const Histogram &h = t.stage((Stage)s);
+    TEST_ASSERT_EQUAL_UINT32(h.count(), get32(p));
+    TEST_ASSERT_EQUAL_UINT32(h.min(), get32(p + 4));
+    TEST_ASSERT_EQUAL_UINT32(h.max(), get32(p + 8));
+    TEST_ASSERT_EQUAL_UINT32(h.percentile(50), get32(p + 12));
+    TEST_ASSERT_EQUAL_UINT32(h.percentile(99), get32(p + 16));
+  }
+  const uint8_t *frame = out + 4 + STAGE_FRAME * 20;
+  TEST_ASSERT_EQUAL_UINT32(2, get32(frame));
+  TEST_ASSERT_EQUAL_UINT32(4000, get32(frame + 4));
+  TEST_ASSERT_EQUAL_UINT32(9000, get32(frame + 8));
+  TEST_ASSERT_EQUAL_UINT32(4095, get32(frame + 12)); // 4000 is in 3584..4095
+}
+
+int main(int, char **)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_bucket_mapping);
+  RUN_TEST(test_percentiles_match_sorted_samples);
+  RUN_TEST(test_percentiles_of_known_samples);
+  RUN_TEST(test_clear);
+  RUN_TEST(test_stage_totals_per_frame);
+  RUN_TEST(test_serialize);
+  return UNITY_END();
+}
@@ -0,0 +1,143 @@
+// Seqlock under load: one std::thread publishing as fast as it can, the
+// other reading, as core 0 and core 1 do on the device. Every snapshot the
+// reader gets must be one the writer published whole.
+//
+//   pio test -e native -f test_seqlock
+
+#include <Seqlock.h>
+#include <InstrumentState.h>
+#include <atomic>
+#include <thread>
+#include <unity.h>
+
+#define PUBLISHES 1000000
+
+// Wide enough that a torn copy would show: every word holds the same count.
+struct Wide
+{
+  uint32_t words[16];
+};
+
+// Snapshots seen by the reader, and any that were torn or went backwards.
+struct ReadStats
+{
+  uint32_t reads = 0, distinct = 0, torn = 0, backwards = 0;
+};
+
+template <typename T>
+static ReadStats stress(void (*make)(uint32_t n, T &out), bool (*count)(const T &in, uint32_t &n))
+{
+  Seqlock<T> lock;
+  std::atomic<bool> done(false);
+  ReadStats stats;
+
+  std::thread reader([&] {
+    uint32_t lastSeq = 0, lastN = 0;
+    bool first = true;
+    while (!done.load(std::memory_order_acquire))
+    {
+      T snap;
+      uint32_t seq = lock.read(snap);
+      uint32_t n;
+      stats.reads++;
+      if (!count(snap, n))
+      {
+        stats.torn++;
+        continue;
+      }
+      if (!first && (seq < lastSeq || n < lastN)) stats.backwards++;
+      if (first || seq != lastSeq) stats.distinct++;
+      first = false;
+      lastSeq = seq;
+      lastN = n;
+    }
+  });
+
+  // Gaps of varying length between publishes, as core 0 has other work,
+  // so the reader gets through as well as being caught mid-update.
+  for (uint32_t n = 1; n <= PUBLISHES; n++)
+  {
+    T value;
+    make(n, value);
+    lock.publish(value);
+    for (volatile uint32_t spin = 0; spin < (n * 2654435761u >> 26); spin++)
+      ;
+  }
+  done.store(true, std::memory_order_release);
+  reader.join();
+
+  // Once the writer is done, the last value is what comes back.
+  T last;
+  uint32_t n = 0;
+  lock.read(last);
+  TEST_ASSERT_TRUE(count(last, n));
+  TEST_ASSERT_EQUAL_UINT32(PUBLISHES, n);
+  return stats;
+}
+
+static void makeWide(uint32_t n, Wide &out)
+{
+  for (uint32_t &w : out.words) w = n;
+}
+
+static bool countWide(const Wide &in, uint32_t &n)
+{
+  n = in.words[0];
+  for (uint32_t w : in.words)
+    if (w != n) return false;
+  return true;
+}
+
+// The needle, ball and LEDs all follow from n, so a snapshot mixing two
+// publishes does not add up.
+static void makeState(uint32_t n, InstrumentState &out)
+{
+  out.turnCoorNeedle = n;
+  out.inclinometerBall = -(double)n;
+  out.leds = n & 0x1FF;
+}
+
+static bool countState(const InstrumentState &in, uint32_t &n)
+{
+  n = (uint32_t)in.turnCoorNeedle;
+  return in.inclinometerBall == -(double)n && in.leds == (n & 0x1FF);
+}
+
+static void assertClean(const ReadStats &stats)
+{
+  TEST_ASSERT_EQUAL_UINT32(0, stats.torn);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.backwards);
+  // The reader must actually have raced the writer for this to mean much.
+  TEST_ASSERT_GREATER_THAN(1, stats.distinct);
+}
+
+void test_wide_snapshots_are_never_torn() { assertClean(stress<Wide>(makeWide, countWide)); }
+
+void test_instrument_state_snapshots_are_never_torn()
+{
+  assertClean(stress<InstrumentState>(makeState, countState));
+}
+
+void test_sequence_changes_only_on_publish()
+{
+  Seqlock<InstrumentState> lock;
+  InstrumentState s;
+  uint32_t before = lock.sequence();
+  TEST_ASSERT_EQUAL_UINT32(before, lock.read(s));
+  TEST_ASSERT_EQUAL_UINT32(before, lock.sequence());
+  lock.publish(s);
+  TEST_ASSERT_TRUE(lock.sequence() != before);
+  TEST_ASSERT_EQUAL_UINT32(lock.sequence(), lock.read(s));
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main(int, char **)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_wide_snapshots_are_never_torn);
+  RUN_TEST(test_instrument_state_snapshots_are_never_torn);
+  RUN_TEST(test_sequence_changes_only_on_publish);
+  return UNITY_END();
+}
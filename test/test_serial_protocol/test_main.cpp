@@ -0,0 +1,322 @@
+// The serial protocol: what is encoded comes out of the parser unchanged,
+// the latest value of each channel wins, and the parser finds its feet again
+// after torn, oversize and corrupted frames. A fuzzed stream checks every
+// intact frame comes out on time and bounds how many corrupted ones pass
+// their CRC by chance.
+//
+//   pio test -e native -f test_serial_protocol
+
+#include <SerialProtocol.h>
+#include <string.h>
+#include <random>
+#include <vector>
+#include <unity.h>
+
+static void feedAll(ProtocolParser &p, const uint8_t *bytes, size_t n)
+{
+  for (size_t i = 0; i < n; i++) p.feed(bytes[i]);
+}
+
+static size_t frameNeedle(int16_t needle, uint8_t *out)
+{
+  InstrumentUpdate u = {};
+  u.changed = 1 << PROTO_NEEDLE;
+  u.needle = needle;
+  return protocolEncode(u, out);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_crc_check_value()
+{
+  const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+  TEST_ASSERT_EQUAL_HEX16(0x29B1, protocolCrc(0xFFFF, check, sizeof(check)));
+}
+
+// Every combination of channels, with random values, comes out as it went in
+// and only on the frame's last byte.
+void test_round_trip()
+{
+  std::mt19937 rng(1);
+  const uint8_t channels[] = {PROTO_NEEDLE, PROTO_BALL, PROTO_LEDS, PROTO_ANNUNCIATORS, PROTO_TIMINGS};
+  ProtocolParser parser;
+  for (int i = 0; i < 5000; i++)
+  {
+    InstrumentUpdate in = {};
+    in.changed = 1 << channels[rng() % 5];
+    for (uint8_t c : channels)
+      if (rng() & 1) in.changed |= 1 << c;
+    in.needle = PROTO_HAS(in, PROTO_NEEDLE) ? (int16_t)rng() : 0;
+    in.ball = PROTO_HAS(in, PROTO_BALL) ? (int16_t)rng() : 0;
+    in.leds = PROTO_HAS(in, PROTO_LEDS) ? rng() & 0x1FF : 0;
+    in.annunciators = PROTO_HAS(in, PROTO_ANNUNCIATORS) ? rng() & 0xFF : 0;
+
+    uint8_t frame[PROTO_MAX_FRAME];
+    size_t n = protocolEncode(in, frame);
+    TEST_ASSERT_GREATER_THAN(4, n);
+    for (size_t b = 0; b + 1 < n; b++) TEST_ASSERT_FALSE(parser.feed(frame[b]));
+    TEST_ASSERT_TRUE(parser.feed(frame[n - 1]));
+
+    InstrumentUpdate out;
+    TEST_ASSERT_TRUE(parser.take(out));
+    TEST_ASSERT_EQUAL_UINT8(in.changed, out.changed);
+    if (PROTO_HAS(in, PROTO_NEEDLE)) TEST_ASSERT_EQUAL_INT(in.needle, out.needle);
+    if (PROTO_HAS(in, PROTO_BALL)) TEST_ASSERT_EQUAL_INT(in.ball, out.ball);
+    if (PROTO_HAS(in, PROTO_LEDS)) TEST_ASSERT_EQUAL_UINT16(in.leds, out.leds);
+    if (PROTO_HAS(in, PROTO_ANNUNCIATORS)) TEST_ASSERT_EQUAL_UINT16(in.annunciators, out.annunciators);
+    TEST_ASSERT_FALSE(parser.take(out));
+  }
+  TEST_ASSERT_EQUAL_UINT32(5000, parser.frameCount());
+  TEST_ASSERT_EQUAL_UINT32(0, parser.errorCount());
+  TEST_ASSERT_EQUAL_UINT32(0, parser.droppedCount());
+}
+
+// Duplicate channels in a frame, and frames not taken in between, leave the
+// latest value of each. A frame with an unknown channel is dropped whole.
+void test_latest_value_wins()
+{
+  const uint8_t first[] = {PROTO_NEEDLE, 0x10, 0x00, PROTO_LEDS, 0x05, 0x00, PROTO_NEEDLE, 0x20, 0x00};
+  const uint8_t second[] = {PROTO_BALL, 0xFF, 0xFF, PROTO_LEDS, 0x01, 0x01};
+  const uint8_t unknown[] = {PROTO_NEEDLE, 0x30, 0x00, 0x7E};
+  uint8_t frame[PROTO_MAX_FRAME];
+  ProtocolParser parser;
+  feedAll(parser, frame, protocolFrame(first, sizeof(first), frame));
+  feedAll(parser, frame, protocolFrame(second, sizeof(second), frame));
+  feedAll(parser, frame, protocolFrame(unknown, sizeof(unknown), frame));
+
+  InstrumentUpdate u;
+  TEST_ASSERT_TRUE(parser.take(u));
+  TEST_ASSERT_EQUAL_UINT8(1 << PROTO_NEEDLE | 1 << PROTO_BALL | 1 << PROTO_LEDS, u.changed);
+  TEST_ASSERT_EQUAL_INT(0x20, u.needle);
+  TEST_ASSERT_EQUAL_INT(-1, u.ball);
+  TEST_ASSERT_EQUAL_UINT16(0x101, u.leds);
+  TEST_ASSERT_FALSE(parser.take(u));
+  TEST_ASSERT_EQUAL_UINT32(2, parser.frameCount());
+  TEST_ASSERT_EQUAL_UINT32(1, parser.errorCount());
+}
+
+// A frame cut off anywhere, then a good one. The parser takes the good one's
+// bytes as the rest of the torn one until its length runs out, so the good
+// one comes out no later than that, and nothing of the torn one does.
+void test_torn_frame_then_good_frame()
+{
+  InstrumentUpdate all = {};
+  all.changed = 1 << PROTO_NEEDLE | 1 << PROTO_BALL | 1 << PROTO_LEDS | 1 << PROTO_ANNUNCIATORS;
+  all.needle = 0x1111, all.ball = 0x2222, all.leds = 0x133, all.annunciators = 0x44;
+  uint8_t torn[PROTO_MAX_FRAME], good[PROTO_MAX_FRAME];
+  size_t tornLen = protocolEncode(all, torn);
+  size_t goodLen = frameNeedle(1234, good);
+
+  for (size_t cut = 1; cut < tornLen; cut++)
+  {
+    ProtocolParser parser;
+    feedAll(parser, torn, cut);
+    feedAll(parser, good, goodLen);
+    size_t late = 0;
+    while (!parser.frameCount() && late < tornLen) parser.feed(0), late++;
+    TEST_ASSERT_LESS_OR_EQUAL(tornLen - cut, late);
+
+    InstrumentUpdate u;
+    TEST_ASSERT_TRUE_MESSAGE(parser.take(u), "good frame lost after a torn one");
+    TEST_ASSERT_EQUAL_UINT8(1 << PROTO_NEEDLE, u.changed);
+    TEST_ASSERT_EQUAL_INT(1234, u.needle);
+    TEST_ASSERT_EQUAL_UINT32(1, parser.frameCount());
+    TEST_ASSERT_EQUAL_UINT32(1, parser.errorCount());
+  }
+}
+
+// Lengths of 0 and over PROTO_MAX_PAYLOAD are never framed, and are dropped
+// by the parser without swallowing the frame after them. PROTO_MAX_PAYLOAD
+// itself is fine.
+void test_zero_length_and_oversize_frames()
+{
+  uint8_t payload[PROTO_MAX_PAYLOAD + 1] = {}, frame[PROTO_MAX_FRAME + 1];
+  TEST_ASSERT_EQUAL(0, protocolFrame(payload, 0, frame));
+  TEST_ASSERT_EQUAL(0, protocolFrame(payload, PROTO_MAX_PAYLOAD + 1, frame));
+  InstrumentUpdate none = {};
+  TEST_ASSERT_EQUAL(0, protocolEncode(none, frame));
+
+  uint8_t good[PROTO_MAX_FRAME];
+  size_t goodLen = frameNeedle(77, good);
+  const uint8_t lengths[] = {0, PROTO_MAX_PAYLOAD + 1, 0xFF};
+  for (uint8_t len : lengths)
+  {
+    ProtocolParser parser;
+    // As a sender would build it, CRC and all.
+    frame[0] = PROTO_SYNC;
+    frame[1] = len;
+    uint16_t crc = protocolCrc(0xFFFF, frame + 1, 1);
+    frame[2] = crc & 0xFF;
+    frame[3] = crc >> 8;
+    feedAll(parser, frame, 4);
+    feedAll(parser, good, goodLen);
+    InstrumentUpdate u;
+    TEST_ASSERT_TRUE(parser.take(u));
+    TEST_ASSERT_EQUAL_INT(77, u.needle);
+    TEST_ASSERT_EQUAL_UINT32(1, parser.frameCount());
+    TEST_ASSERT_EQUAL_UINT32(1, parser.errorCount());
+  }
+
+  // Ten needles and a timings request fill the payload exactly.
+  uint8_t *p = payload;
+  for (int i = 0; i < 10; i++) *p++ = PROTO_NEEDLE, *p++ = (uint8_t)i, *p++ = 0;
+  *p++ = PROTO_TIMINGS;
+  *p++ = PROTO_TIMINGS;
+  TEST_ASSERT_EQUAL(PROTO_MAX_PAYLOAD, p - payload);
+  ProtocolParser parser;
+  size_t n = protocolFrame(payload, PROTO_MAX_PAYLOAD, frame);
+  TEST_ASSERT_EQUAL(PROTO_MAX_FRAME, n);
+  feedAll(parser, frame, n);
+  InstrumentUpdate u;
+  TEST_ASSERT_TRUE(parser.take(u));
+  TEST_ASSERT_EQUAL_UINT8(1 << PROTO_NEEDLE | 1 << PROTO_TIMINGS, u.changed);
+  TEST_ASSERT_EQUAL_INT(9, u.needle);
+}
+
+// A stray sync byte and length in front of two good frames: the bogus frame
+// swallows some of them and fails its CRC, and both are found again inside it.
+void test_rescan_after_bad_crc()
+{
+  uint8_t first[PROTO_MAX_FRAME], second[PROTO_MAX_FRAME];
+  size_t firstLen = frameNeedle(1000, first);
+  size_t secondLen = frameNeedle(2000, second);
+  for (uint8_t len = 1; len <= PROTO_MAX_PAYLOAD; len++)
+  {
+    std::vector<uint8_t> stream = {PROTO_SYNC, len};
+    stream.insert(stream.end(), first, first + firstLen);
+    stream.insert(stream.end(), second, second + secondLen);
+    stream.insert(stream.end(), PROTO_MAX_FRAME, 0); // Enough to finish the bogus frame
+
+    ProtocolParser parser;
+    std::vector<int16_t> seen;
+    for (uint8_t b : stream)
+    {
+      InstrumentUpdate u;
+      if (parser.feed(b) && parser.take(u)) seen.push_back(u.needle);
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, parser.frameCount());
+    TEST_ASSERT_EQUAL_UINT32(1, parser.errorCount());
+    TEST_ASSERT_GREATER_OR_EQUAL(1, seen.size());
+    TEST_ASSERT_EQUAL_INT(2000, seen.back());
+  }
+}
+
+// What the fuzzed frames carry in the ball channel, to tell a real frame from
+// a corrupted one that passed its CRC.
+static int16_t check(uint16_t id) { return (int16_t)(id * 40503u ^ 0x5A5A); }
+
+// Frames numbered through their needle, with random garbage between them,
+// some with a bit flipped and some torn off. A corrupted frame gets through
+// only by chance: its 16-bit CRC matches, 1 in 65536 rejected frames, or a
+// frame torn just before its last byte meets a byte that happens to match
+// it. Either can swallow the start of a good frame after it. Every other
+// intact frame must come out, in order, within one frame's worth of bytes
+// of its last byte.
+static void fuzz(uint32_t seed)
+{
+  std::mt19937 rng(seed);
+  auto chance = [&](int percent) { return (int)(rng() % 100) < percent; };
+
+  struct Sent
+  {
+    size_t end; // Stream offset just past the frame
+    bool intact;
+  };
+  std::vector<uint8_t> stream;
+  std::vector<Sent> sent;
+  const uint16_t frameCount = 20000;
+  for (uint16_t i = 0; i < frameCount; i++)
+  {
+    // Garbage, heavy on sync bytes and plausible lengths
+    int garbage = chance(30) ? rng() % 40 : 0;
+    for (int g = 0; g < garbage; g++)
+      stream.push_back(chance(20) ? PROTO_SYNC : chance(20) ? (uint8_t)(rng() % PROTO_MAX_PAYLOAD) : (uint8_t)rng());
+
+    uint8_t frame[PROTO_MAX_FRAME];
+    InstrumentUpdate u = {};
+    u.changed = 1 << PROTO_NEEDLE | 1 << PROTO_BALL;
+    u.needle = (int16_t)i;
+    u.ball = check(i);
+    if (chance(50)) u.changed |= 1 << PROTO_LEDS, u.leds = rng() & 0x1FF;
+    size_t n = protocolEncode(u, frame);
+
+    bool intact = true;
+    if (chance(10))
+    {
+      frame[1 + rng() % (n - 1)] ^= 1 << (rng() % 8); // Flip a bit after the sync
+      intact = false;
+    }
+    else if (chance(5))
+    {
+      n = 1 + rng() % (n - 1); // Torn off
+      intact = false;
+    }
+    stream.insert(stream.end(), frame, frame + n);
+    sent.push_back(Sent{stream.size(), intact});
+  }
+  stream.insert(stream.end(), PROTO_MAX_FRAME, 0); // Flush anything still pending
+
+  ProtocolParser parser;
+  size_t next = 0;     // Next frame expected out
+  size_t unplaced = 0; // Frames found alongside a corrupted one, not yet placed
+  size_t latest = 0, corrupted = 0, lost = 0;
+  for (size_t offset = 0; offset < stream.size(); offset++)
+  {
+    // A byte that ends a bad frame can bring out several good ones found
+    // inside it. They are merged, so only the last shows.
+    uint32_t before = parser.frameCount();
+    if (!parser.feed(stream[offset])) continue;
+    uint32_t found = parser.frameCount() - before;
+    InstrumentUpdate u;
+    TEST_ASSERT_TRUE(parser.take(u));
+
+    uint16_t id = (uint16_t)u.needle;
+    if (!PROTO_HAS(u, PROTO_BALL) || u.ball != check(id) || id >= frameCount || id < next)
+    {
+      // The last of them was corrupted. Any others are placed by the next
+      // frame that is one of ours: intact frames before it, or more that got
+      // through by chance.
+      corrupted++;
+      unplaced += found - 1;
+      continue;
+    }
+    size_t expected = !sent[id].intact; // Torn, and met a byte that matched
+    corrupted += expected;
+    for (size_t i = next; i <= id; i++) expected += sent[i].intact;
+    if (found + unplaced >= expected)
+      corrupted += found + unplaced - expected;
+    else
+      lost += expected - found - unplaced;
+    unplaced = 0;
+    for (; next <= id; next++)
+      if (sent[next].intact && offset + 1 - sent[next].end > latest) latest = offset + 1 - sent[next].end;
+  }
+  for (; next < sent.size(); next++) lost += sent[next].intact;
+  corrupted += unplaced;
+
+  TEST_ASSERT_LESS_OR_EQUAL(PROTO_MAX_FRAME, latest);
+  TEST_ASSERT_GREATER_THAN(frameCount / 10, parser.errorCount());
+  TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(3 + 4 * parser.errorCount() / 65536, corrupted,
+                                    "too many corrupted frames got through");
+  // A frame that got through can only have swallowed the few after it.
+  TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(2 * corrupted, lost, "intact frames lost");
+}
+
+void test_fuzzed_stream()
+{
+  for (uint32_t seed = 1; seed <= 5; seed++) fuzz(seed);
+}
+
+int main(int, char **)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_crc_check_value);
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_latest_value_wins);
+  RUN_TEST(test_torn_frame_then_good_frame);
+  RUN_TEST(test_zero_length_and_oversize_frames);
+  RUN_TEST(test_rescan_after_bad_crc);
+  RUN_TEST(test_fuzzed_stream);
+  return UNITY_END();
+}
@@ -0,0 +1,104 @@
+// SmoothGovernor fed made-up frame costs: under the budget it stays smooth,
+// over it it falls back once, and a cost hovering around the budget does
+// not flip it back and forth.
+//
+//   pio test -e native -f test_smooth_governor
+
+#include <SmoothGovernor.h>
+#include <unity.h>
+
+#define BUDGET 2000
+#define RETRY 60
+
+// Run frames frames, each costing cost(frame) when drawn smooth. Returns how
+// many of them were smooth.
+static uint32_t run(SmoothGovernor &g, uint32_t frames, uint32_t (*cost)(uint32_t frame), uint32_t budget = BUDGET)
+{
+  uint32_t smooth = 0;
+  for (uint32_t frame = 0; frame < frames; frame++)
+  {
+    bool s = g.beginFrame(budget);
+    TEST_ASSERT_EQUAL(s, g.smooth());
+    smooth += s;
+    g.endFrame(s ? cost(frame) : 0);
+  }
+  return smooth;
+}
+
+static uint32_t cheap(uint32_t) { return BUDGET / 2; }
+static uint32_t dear(uint32_t) { return BUDGET * 2; }
+// Just either side of the budget, averaging a little over it.
+static uint32_t hovering(uint32_t frame) { return frame & 1 ? BUDGET * 9 / 10 : BUDGET * 23 / 20; }
+// Half a budget, then twice the budget from frame 100 on.
+static uint32_t stepUp(uint32_t frame) { return frame < 100 ? BUDGET / 2 : BUDGET * 2; }
+
+void test_under_budget_stays_smooth()
+{
+  SmoothGovernor g(RETRY);
+  TEST_ASSERT_EQUAL_UINT32(1000, run(g, 1000, cheap));
+  TEST_ASSERT_EQUAL_UINT32(0, g.switchCount());
+}
+
+void test_step_over_budget_switches_once()
+{
+  SmoothGovernor g(RETRY);
+  uint32_t smooth = run(g, 100 + RETRY, stepUp);
+  TEST_ASSERT_EQUAL_UINT32(1, g.switchCount());
+  TEST_ASSERT_FALSE(g.smooth());
+  // The estimate takes a few frames to climb past the budget, no more.
+  TEST_ASSERT_INT_WITHIN(3, 101, smooth);
+}
+
+void test_hovering_at_budget_switches_once()
+{
+  SmoothGovernor g(RETRY);
+  run(g, RETRY, hovering);
+  TEST_ASSERT_EQUAL_UINT32(1, g.switchCount());
+  TEST_ASSERT_FALSE(g.smooth());
+}
+
+void test_retries_after_hold_and_recovers()
+{
+  SmoothGovernor g(RETRY);
+  run(g, 10, dear);
+  TEST_ASSERT_EQUAL_UINT32(1, g.switchCount());
+  TEST_ASSERT_FALSE(g.smooth());
+
+  // Not before RETRY frames, however cheap it would be by now.
+  uint32_t smooth = run(g, RETRY - 10, cheap);
+  TEST_ASSERT_EQUAL_UINT32(0, smooth);
+  smooth = run(g, 200, cheap);
+  TEST_ASSERT_EQUAL_UINT32(2, g.switchCount());
+  TEST_ASSERT_TRUE(g.smooth());
+  TEST_ASSERT_GREATER_THAN(190, smooth);
+}
+
+void test_dear_retries_at_most_once_per_hold()
+{
+  SmoothGovernor g(RETRY);
+  run(g, RETRY * 10, dear);
+  // One fall back, then each retry is one switch on and one back off.
+  TEST_ASSERT_LESS_OR_EQUAL(1 + 2 * 10, g.switchCount());
+  TEST_ASSERT_GREATER_THAN(1, g.switchCount());
+}
+
+void test_zero_budget_is_never_smooth()
+{
+  SmoothGovernor g(RETRY);
+  TEST_ASSERT_EQUAL_UINT32(0, run(g, 100, cheap, 0));
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main(int, char **)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_under_budget_stays_smooth);
+  RUN_TEST(test_step_over_budget_switches_once);
+  RUN_TEST(test_hovering_at_budget_switches_once);
+  RUN_TEST(test_retries_after_hold_and_recovers);
+  RUN_TEST(test_dear_retries_at_most_once_per_hold);
+  RUN_TEST(test_zero_budget_is_never_smooth);
+  return UNITY_END();
+}
@@ -0,0 +1,144 @@
+// SpringFilter stepped at the frame rate, with the omegas main.cpp gives
+// the needle (18) and the ball (12): step responses that never overshoot and
+// settle in about 5.8 / omega seconds, and targets that are reached exactly
+// and then held, without creeping or cycling around them.
+//
+//   pio test -e native -f test_spring_filter
+
+#include <SpringFilter.h>
+#include <initializer_list>
+#include <random>
+#include <unity.h>
+
+#define FRAME_US 16667 // 60 Hz
+
+// Time for a step from 0 to to (Q16) to come within 2% and stay there, in
+// microseconds, with no overshoot or backwards movement on the way. Runs on
+// until the filter settles and checks it lands on to exactly.
+static uint32_t stepResponse(uint16_t omega, int32_t to, uint32_t dt = FRAME_US)
+{
+  SpringFilter f(omega);
+  f.reset(0);
+  f.setTarget(to);
+  const int32_t band = to / 50 < 0 ? -to / 50 : to / 50;
+  int32_t last = 0;
+  uint32_t t = 0, within = 0;
+  while (!f.settled())
+  {
+    f.step(dt);
+    t += dt;
+    int32_t x = f.value();
+    if (to > 0) TEST_ASSERT_TRUE_MESSAGE(x >= last && x <= to, "overshot or went back");
+    else TEST_ASSERT_TRUE_MESSAGE(x <= last && x >= to, "overshot or went back");
+    last = x;
+    if ((to - x < 0 ? x - to : to - x) > band) within = 0;
+    else if (!within) within = t;
+    TEST_ASSERT_TRUE_MESSAGE(t < 5000000, "never settled");
+  }
+  TEST_ASSERT_EQUAL_INT32(to, f.value());
+  TEST_ASSERT_EQUAL_INT32(0, f.velocity());
+  return within;
+}
+
+// Settling time within 15% of 5.8 / omega.
+static void assertSettlingTime(uint16_t omega, uint32_t micros)
+{
+  const uint32_t expected = 5800000 / omega;
+  TEST_ASSERT_INT_WITHIN(expected * 15 / 100, expected, micros);
+}
+
+void test_needle_step()
+{
+  // Full scale and a single degree of needle, both ways.
+  assertSettlingTime(18, stepResponse(18, 100 * Q16_ONE));
+  assertSettlingTime(18, stepResponse(18, -100 * Q16_ONE));
+  assertSettlingTime(18, stepResponse(18, Q16_ONE * 5 / 3));
+}
+
+void test_ball_step()
+{
+  assertSettlingTime(12, stepResponse(12, Q16_ONE));
+  assertSettlingTime(12, stepResponse(12, -Q16_ONE));
+  assertSettlingTime(12, stepResponse(12, Q16_ONE / 10));
+}
+
+// Settling does not depend on how the time is cut up.
+void test_step_size()
+{
+  assertSettlingTime(18, stepResponse(18, 100 * Q16_ONE, 1000));
+  assertSettlingTime(18, stepResponse(18, 100 * Q16_ONE, 33333));
+  stepResponse(18, 100 * Q16_ONE, 250000); // Long frames: no better than a frame's accuracy, but stable
+}
+
+// Steps of a few counts, where rounding would show up as a limit cycle.
+void test_tiny_steps_land_exactly()
+{
+  for (int32_t to = 1; to <= 64; to++)
+  {
+    stepResponse(18, to);
+    stepResponse(12, -to);
+  }
+}
+
+// Random targets arriving every few frames, the same target sent again and
+// again as the sim does, then a last one: reached exactly, and then the value
+// holds still for good.
+void test_repeated_targets_converge()
+{
+  std::mt19937 rng(7);
+  for (uint16_t omega : {18, 12})
+  {
+    SpringFilter f(omega);
+    f.reset(50 * Q16_ONE);
+    for (uint32_t frame = 0; frame < 2000; frame++)
+    {
+      if (frame % (1 + rng() % 10) == 0) f.setTarget((int32_t)(rng() % (110 * Q16_ONE)) - 5 * Q16_ONE);
+      f.step(FRAME_US);
+    }
+
+    const int32_t last = 37 * Q16_ONE + 12345;
+    uint32_t frames = 0;
+    while (!f.settled())
+    {
+      f.setTarget(last);
+      f.step(FRAME_US);
+      TEST_ASSERT_TRUE_MESSAGE(++frames < 300, "never settled");
+    }
+    TEST_ASSERT_EQUAL_INT32(last, f.value());
+
+    for (uint32_t frame = 0; frame < 1000; frame++)
+    {
+      f.setTarget(last);
+      f.step(FRAME_US);
+      TEST_ASSERT_TRUE(f.settled());
+      TEST_ASSERT_EQUAL_INT32(last, f.value());
+      TEST_ASSERT_EQUAL_INT32(0, f.velocity());
+    }
+  }
+}
+
+void test_zero_omega_passes_through()
+{
+  SpringFilter f(0);
+  f.reset(0);
+  f.setTarget(42 * Q16_ONE);
+  TEST_ASSERT_FALSE(f.settled());
+  f.step(1);
+  TEST_ASSERT_TRUE(f.settled());
+  TEST_ASSERT_EQUAL_INT32(42 * Q16_ONE, f.value());
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main(int, char **)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_needle_step);
+  RUN_TEST(test_ball_step);
+  RUN_TEST(test_step_size);
+  RUN_TEST(test_tiny_steps_land_exactly);
+  RUN_TEST(test_repeated_targets_converge);
+  RUN_TEST(test_zero_omega_passes_through);
+  return UNITY_END();
+}
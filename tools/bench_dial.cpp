@@ -0,0 +1,90 @@
+// Host benchmark: expanding the indexed dial and decoding the packed one,
+// against copying the raw array.
+//
+//   g++ -std=gnu++17 -O2 -Itools/include -Iinclude
+//       tools/bench_dial.cpp src/IndexedImage.cpp src/PackedImage.cpp src/Canvas.cpp src/Kernels565.cpp
+//       src/DirtyRegion.cpp -o bench_dial && ./bench_dial
+//
+// Reports MB/s of 565 output for whole bands and for small plane-sized
+// windows. The raw image to copy from is the expanded one, and the packed
+// dial must decode to exactly the same pixels. The 4-bit run
+// reuses the dial's indices with a 16 colour palette: the picture is wrong
+// but the work per pixel is the same as for a real 4-bit image.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include "assets.h"
+
+#define DIAL_W 320
+#define DIAL_H 300
+
+static uint16_t dial[DIAL_W * DIAL_H];
+static uint16_t out[DIAL_W * DIAL_H];
+static uint8_t nibbles[DIAL_W * DIAL_H / 2];
+static const IndexedImage dial4 = {nibbles, dialIndexedPalette, DIAL_W, DIAL_H, 4};
+
+// Copy the raw array the way the band renderer used to, a row at a time.
+static void copyRaw(Canvas &c)
+{
+  drawImage(c, 0, 0, DIAL_W, DIAL_H, dial);
+}
+
+static void expand8(Canvas &c)
+{
+  drawIndexed(c, dialIndexed, 0, 0);
+}
+
+static void expand4(Canvas &c)
+{
+  drawIndexed(c, dial4, 0, 0);
+}
+
+static void decode(Canvas &c)
+{
+  drawPacked(c, dialPacked, 0, 0);
+}
+
+static double run(void (*fn)(Canvas &), const Rect *rects, int count, int repeats)
+{
+  unsigned long start = micros();
+  uint64_t pixels = 0;
+  for (int r = 0; r < repeats; r++)
+  {
+    for (int i = 0; i < count; i++)
+    {
+      Canvas c{out, rects[i]};
+      fn(c);
+      pixels += rects[i].area();
+    }
+  }
+  double seconds = (micros() - start) / 1e6;
+  return pixels * 2 / seconds / 1e6;
+}
+
+int main()
+{
+  Canvas all{dial, Rect{0, 0, DIAL_W, DIAL_H}};
+  expand8(all);
+  for (int i = 0; i < DIAL_W * DIAL_H / 2; i++)
+    nibbles[i] = (dialIndexedIndices[2 * i] & 0xF0) | dialIndexedIndices[2 * i + 1] >> 4;
+
+  Rect bands[15];
+  for (int i = 0; i < 15; i++) bands[i] = Rect{0, (int16_t)(i * 20), DIAL_W, 20};
+  Rect windows[] = {{78, 92, 170, 60}, {150, 230, 30, 35}, {205, 113, 23, 14}, {261, 105, 20, 20}};
+
+  Canvas check{out, all.area};
+  decode(check);
+  if (memcmp(out, dial, sizeof(dial)))
+  {
+    printf("packed and indexed dials differ\n");
+    return 1;
+  }
+
+  printf("%-22s %10s %10s\n", "", "bands", "windows");
+  printf("%-22s %10.1f %10.1f MB/s\n", "copy raw", run(copyRaw, bands, 15, 200), run(copyRaw, windows, 4, 2000));
+  printf("%-22s %10.1f %10.1f MB/s\n", "expand 8-bit", run(expand8, bands, 15, 200), run(expand8, windows, 4, 2000));
+  printf("%-22s %10.1f %10.1f MB/s\n", "expand 4-bit", run(expand4, bands, 15, 200), run(expand4, windows, 4, 2000));
+  printf("%-22s %10.1f %10.1f MB/s\n", "decode packed", run(decode, bands, 15, 200), run(decode, windows, 4, 2000));
+  return 0;
+}
@@ -0,0 +1,67 @@
+// Host benchmark: the three ways PlaneLayer can draw the plane.
+//
+//   g++ -std=gnu++17 -O2 -Itools/include -Iinclude
+//       tools/bench_plane.cpp src/PlaneCache.cpp src/Rotate.cpp src/Canvas.cpp src/Kernels565.cpp
+//       src/DirtyRegion.cpp -o bench_plane && ./bench_plane
+//
+// The needle is swept from PLANE_MIN_ANGLE to PLANE_MAX_ANGLE in 1/16 degree
+// steps and the plane drawn into a canvas the size of the turn coordinator
+// at each one:
+//
+//   cache    drawPlane() at the angle snapped to whole degrees, as with
+//            smoothing off or over budget
+//   nearest  drawPlane() at the fractional angle, which rotates per frame
+//   smooth   drawPlaneSmooth(), what the smooth needle draws
+//
+// Reported per draw and against cache, along with the budget the smooth
+// plane gets at FRAME_RATE_HZ.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "PlaneCache.h"
+#include "TurnCoordinator.h"
+
+#define CANVAS_W TURN_COORD_WIDTH
+#define CANVAS_H TURN_COORD_HEIGHT
+#define FRAME_RATE_HZ 60
+#define PLANE_SMOOTH_BUDGET_PERCENT 12
+
+static uint16_t out[CANVAS_W * CANVAS_H];
+
+static void drawCache(Canvas &c, int32_t angle) { drawPlane(c, angle / ANGLE_STEPS * ANGLE_STEPS); }
+static void drawNearest(Canvas &c, int32_t angle) { drawPlane(c, angle); }
+static void drawSmooth(Canvas &c, int32_t angle) { drawPlaneSmooth(c, angle); }
+
+static double timeDraw(void (*fn)(Canvas &, int32_t), Canvas &c, int repeats)
+{
+  const int32_t first = PLANE_MIN_ANGLE * ANGLE_STEPS, last = PLANE_MAX_ANGLE * ANGLE_STEPS;
+  unsigned long start = micros();
+  for (int i = 0; i < repeats; i++)
+  {
+    for (int32_t angle = first; angle <= last; angle++) fn(c, angle);
+    __asm__ volatile("" ::: "memory"); // Keep the loop from being folded away
+  }
+  return (micros() - start) * 1000.0 / (repeats * (last - first + 1));
+}
+
+int main()
+{
+  if (!planeCacheBegin())
+  {
+    printf("plane cache did not fit\n");
+    return 1;
+  }
+  Canvas c{out, Rect{0, 0, CANVAS_W, CANVAS_H}};
+
+  const int repeats = 200;
+  double cache = timeDraw(drawCache, c, repeats);
+  double nearest = timeDraw(drawNearest, c, repeats);
+  double smooth = timeDraw(drawSmooth, c, repeats);
+
+  printf("%-8s %10s %10s\n", "", "ns/draw", "x cache");
+  printf("%-8s %10.0f %10.1f\n", "cache", cache, 1.0);
+  printf("%-8s %10.0f %10.1f\n", "nearest", nearest, nearest / cache);
+  printf("%-8s %10.0f %10.1f\n", "smooth", smooth, smooth / cache);
+  printf("smooth budget at %d Hz: %d us\n", FRAME_RATE_HZ, 1000000 / FRAME_RATE_HZ * PLANE_SMOOTH_BUDGET_PERCENT / 100);
+  return 0;
+}
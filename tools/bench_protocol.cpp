@@ -0,0 +1,74 @@
+// Host benchmark for the serial protocol parser.
+//
+//   g++ -std=gnu++17 -O2 -Itools/include -Iinclude
+//       tools/bench_protocol.cpp src/SerialProtocol.cpp -o bench_protocol && ./bench_protocol
+//
+// Throughput: a long stream of full frames (needle, ball and LEDs) through
+// feed(), one byte at a time, and how that compares with what 115200 baud
+// can deliver. Round trips, batching and the fuzzed stream are checked by
+// test/test_serial_protocol.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "SerialProtocol.h"
+
+#define BAUD_BYTES_PER_SECOND (115200 / 10) // 8N1
+
+static int failures = 0;
+
+#define CHECK(cond, ...)            \
+  do                                \
+  {                                 \
+    if (!(cond))                    \
+    {                               \
+      printf("FAIL: " __VA_ARGS__); \
+      printf("\n");                 \
+      failures++;                   \
+    }                               \
+  } while (0)
+
+static void throughput()
+{
+  const int frameCount = 200000;
+  std::vector<uint8_t> stream;
+  for (int i = 0; i < frameCount; i++)
+  {
+    uint8_t frame[PROTO_MAX_FRAME];
+    InstrumentUpdate u = {};
+    u.changed = 1 << PROTO_NEEDLE | 1 << PROTO_BALL | 1 << PROTO_LEDS;
+    u.needle = (int16_t)(i * 7);
+    u.ball = (int16_t)(i * 13);
+    u.leds = (uint16_t)(i & 0x1FF);
+    size_t n = protocolEncode(u, frame);
+    stream.insert(stream.end(), frame, frame + n);
+  }
+
+  ProtocolParser parser;
+  InstrumentUpdate u;
+  uint32_t taken = 0;
+  unsigned long start = micros();
+  for (uint8_t b : stream)
+  {
+    if (parser.feed(b) && parser.take(u)) taken++;
+  }
+  unsigned long elapsed = micros() - start;
+
+  CHECK(taken == frameCount && parser.errorCount() == 0, "throughput run lost frames");
+  double nsPerByte = elapsed * 1000.0 / stream.size();
+  double framesPerSecond = frameCount * 1e6 / elapsed;
+  size_t frameBytes = stream.size() / frameCount;
+  printf("throughput: %zu byte frames, %.1f ns/byte, %.0f frames/s (%.0f channel updates/s)\n", frameBytes,
+         nsPerByte, framesPerSecond, framesPerSecond * 11); // Needle, ball and nine LEDs
+  printf("at 115200 baud: %u frames/s, %u channel updates/s, parser busy %.3f%% of the time\n",
+         (unsigned)(BAUD_BYTES_PER_SECOND / frameBytes), (unsigned)(BAUD_BYTES_PER_SECOND / frameBytes * 11),
+         BAUD_BYTES_PER_SECOND * nsPerByte / 1e7);
+}
+
+int main()
+{
+  throughput();
+  printf(failures ? "%d failures\n" : "all passed\n", failures);
+  return failures != 0;
+}
@@ -0,0 +1,197 @@
+// Host benchmark: the integer plane rotation against the float one it
+// replaced, and against the pre-rotated cache.
+//
+//   g++ -std=gnu++17 -O2 -DPLANE_CACHE_RAM -Itools/include -Iinclude
+//       tools/bench_rotate.cpp src/Rotate.cpp src/PlaneCache.cpp src/Canvas.cpp src/Kernels565.cpp
+//       src/DirtyRegion.cpp -o bench_rotate && ./bench_rotate
+//
+// The plane is drawn into a canvas the size of the turn coordinator at every
+// whole degree from PLANE_MIN_ANGLE to PLANE_MAX_ANGLE, bounds included,
+// three ways:
+//
+//   float   the TFT_eSprite::pushRotated() port drawRotated replaced: float
+//           sin/cos and corner bounds per draw, then a per-pixel range test
+//           and colour-key test
+//   lut     rotatedBounds() and drawRotated(), as fractional angles are
+//           drawn every frame
+//   cache   planeBounds() and drawPlane(), as whole degrees are drawn
+//
+// Reported per draw, with how many pixels of the lut draw differ from the
+// float one (rounding at the edges; they never agree exactly). lut and
+// cache must agree.
+
+#include <Arduino.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "PlaneCache.h"
+#include "Rotate.h"
+#include "TurnCoordinator.h"
+#include "assets.h"
+
+#define CANVAS_W 320
+#define CANVAS_H 300
+
+static uint16_t out[3][CANVAS_W * CANVAS_H];
+static std::vector<uint16_t> keyed; // MCU byte order, TFT_WHITE where clear
+
+// The float rotation, as it was before drawRotated ----------------------------------
+
+#define FP_SCALE 10
+
+static void rotationSetup(int16_t angle, int16_t w, int16_t h, int16_t xp, int16_t yp,
+                          int16_t *min_x, int16_t *min_y, int16_t *max_x, int16_t *max_y,
+                          int32_t *sinra, int32_t *cosra)
+{
+  float radAngle = -angle * 0.0174532925;
+  float sina = sinf(radAngle);
+  float cosa = cosf(radAngle);
+
+  w -= xp;
+  h -= yp;
+
+  int16_t x0 = -xp * cosa - yp * sina;
+  int16_t y0 = xp * sina - yp * cosa;
+  int16_t x1 = w * cosa - yp * sina;
+  int16_t y1 = -w * sina - yp * cosa;
+  int16_t x2 = h * sina + w * cosa;
+  int16_t y2 = h * cosa - w * sina;
+  int16_t x3 = h * sina - xp * cosa;
+  int16_t y3 = h * cosa + xp * sina;
+
+  *min_x = x0; if (x1 < *min_x) *min_x = x1; if (x2 < *min_x) *min_x = x2; if (x3 < *min_x) *min_x = x3;
+  *max_x = x0; if (x1 > *max_x) *max_x = x1; if (x2 > *max_x) *max_x = x2; if (x3 > *max_x) *max_x = x3;
+  *min_y = y0; if (y1 < *min_y) *min_y = y1; if (y2 < *min_y) *min_y = y2; if (y3 < *min_y) *min_y = y3;
+  *max_y = y0; if (y1 > *max_y) *max_y = y1; if (y2 > *max_y) *max_y = y2; if (y3 > *max_y) *max_y = y3;
+
+  *sinra = round(sina * (1 << FP_SCALE));
+  *cosra = round(cosa * (1 << FP_SCALE));
+}
+
+static Rect floatBounds(int16_t angle, int16_t w, int16_t h, int16_t px, int16_t py, int16_t dx, int16_t dy)
+{
+  int16_t min_x, min_y, max_x, max_y;
+  int32_t sinra, cosra;
+  rotationSetup(angle, w, h, px, py, &min_x, &min_y, &max_x, &max_y, &sinra, &cosra);
+  min_x += dx; max_x += dx;
+  min_y += dy; max_y += dy;
+  if (min_x > CANVAS_W || min_y > CANVAS_H || max_x < 0 || max_y < 0) return Rect{0, 0, 0, 0};
+  if (min_x < 0) min_x = 0;
+  if (max_x > CANVAS_W) max_x = CANVAS_W;
+  if (min_y < 0) min_y = 0;
+  if (max_y > CANVAS_H) max_y = CANVAS_H;
+  return Rect{min_x, min_y, (int16_t)(max_x - min_x + 1), (int16_t)(max_y - min_y + 1)};
+}
+
+static void drawFloat(Canvas &c, int16_t angle)
+{
+  const Sprite &s = planeSprite;
+  Rect bounds = floatBounds(angle, s.w, s.h, s.px, s.py, PLANE_PIVOT_X, PLANE_PIVOT_Y);
+  Rect walk{bounds.x, bounds.y, (int16_t)(bounds.w - 1), bounds.h};
+  Rect clip = rectIntersect(walk, c.area);
+  if (clip.empty()) return;
+
+  int16_t min_x, min_y, max_x, max_y;
+  int32_t sinra, cosra;
+  rotationSetup(angle, s.w, s.h, s.px, s.py, &min_x, &min_y, &max_x, &max_y, &sinra, &cosra);
+
+  uint32_t xe = s.w << FP_SCALE;
+  uint32_t ye = s.h << FP_SCALE;
+  int32_t xt = clip.x - PLANE_PIVOT_X;
+  for (int16_t y = clip.y; y < clip.bottom(); y++)
+  {
+    int32_t yt = y - PLANE_PIVOT_Y;
+    uint32_t xs = (cosra * xt - (sinra * yt - (s.px << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+    uint32_t ys = (sinra * xt + (cosra * yt + (s.py << FP_SCALE)) + (1 << (FP_SCALE - 1)));
+    uint16_t *dst = c.row(y);
+    for (int16_t x = clip.x; x < clip.right(); x++, xs += cosra, ys += sinra)
+    {
+      if (xs >= xe || ys >= ye) continue;
+      uint16_t p = keyed[(xs >> FP_SCALE) + (ys >> FP_SCALE) * s.w];
+      if (p != 0xFFFF) dst[x] = swap565(p);
+    }
+  }
+}
+
+// The two in the firmware ------------------------------------------------------------
+
+static volatile int32_t boundsSink;
+
+static void drawLut(Canvas &c, int16_t angle)
+{
+  int32_t a = angle * ANGLE_STEPS;
+  boundsSink = rotatedBounds(planeSprite, a, PLANE_PIVOT_X, PLANE_PIVOT_Y).w;
+  drawRotated(c, planeSprite, a, PLANE_PIVOT_X, PLANE_PIVOT_Y);
+}
+
+static void drawCache(Canvas &c, int16_t angle)
+{
+  int32_t a = angle * ANGLE_STEPS;
+  boundsSink = planeBounds(a).w;
+  drawPlane(c, a);
+}
+
+// -----------------------------------------------------------------------------------
+
+static double timeDraw(void (*fn)(Canvas &, int16_t), Canvas &c, int repeats)
+{
+  unsigned long start = micros();
+  for (int i = 0; i < repeats; i++)
+  {
+    for (int16_t angle = PLANE_MIN_ANGLE; angle <= PLANE_MAX_ANGLE; angle++) fn(c, angle);
+    __asm__ volatile("" ::: "memory"); // Keep the loop from being folded away
+  }
+  return (micros() - start) * 1000.0 / (repeats * PLANE_ANGLES);
+}
+
+int main()
+{
+  const Sprite &s = planeSprite;
+  for (int32_t i = 0; i < s.w * s.h; i++)
+  {
+    bool set = s.mask[(i / s.w) * MASK_STRIDE(s.w) + (i % s.w) / 8] & (0x80 >> (i % s.w % 8));
+    keyed.push_back(set ? swap565(s.pixels[i]) : 0xFFFF);
+  }
+  if (!planeCacheBegin())
+  {
+    printf("plane cache did not fit\n");
+    return 1;
+  }
+
+  Canvas c[3];
+  for (int i = 0; i < 3; i++) c[i] = Canvas{out[i], Rect{0, 0, CANVAS_W, CANVAS_H}};
+
+  // Agreement, one angle at a time.
+  uint32_t differ = 0, worst = 0;
+  for (int16_t angle = PLANE_MIN_ANGLE; angle <= PLANE_MAX_ANGLE; angle++)
+  {
+    for (int i = 0; i < 3; i++) memset(out[i], 0, sizeof(out[i]));
+    drawFloat(c[0], angle);
+    drawLut(c[1], angle);
+    drawCache(c[2], angle);
+    if (memcmp(out[1], out[2], sizeof(out[1])))
+    {
+      printf("lut and cache disagree at %d degrees\n", angle);
+      return 1;
+    }
+    uint32_t n = 0;
+    for (int32_t i = 0; i < CANVAS_W * CANVAS_H; i++) n += out[0][i] != out[1][i];
+    differ += n;
+    if (n > worst) worst = n;
+  }
+
+  const int repeats = 2000;
+  double fl = timeDraw(drawFloat, c[0], repeats);
+  double lut = timeDraw(drawLut, c[1], repeats);
+  double cache = timeDraw(drawCache, c[2], repeats);
+
+  printf("plane %dx%d, %d angles\n", s.w, s.h, PLANE_ANGLES);
+  printf("%-6s %10s %8s\n", "", "ns/draw", "speedup");
+  printf("%-6s %10.0f %8s\n", "float", fl, "");
+  printf("%-6s %10.0f %7.1fx\n", "lut", lut, fl / lut);
+  printf("%-6s %10.0f %7.1fx\n", "cache", cache, fl / cache);
+  printf("lut against float: %.1f pixels differ per angle on average, %u at most\n",
+         (double)differ / PLANE_ANGLES, (unsigned)worst);
+  return 0;
+}
@@ -0,0 +1,111 @@
+// Host benchmark: opaque-run sprite blits against the old colour-key blit.
+//
+//   g++ -std=gnu++17 -O2 -Itools/include -Iinclude
+//       tools/bench_sprite.cpp src/Sprite.cpp src/Canvas.cpp src/Kernels565.cpp src/DirtyRegion.cpp
+//       -o bench_sprite && ./bench_sprite
+//
+// Each sprite is drawn whole into a scratch canvas three ways: testing every
+// pixel against TFT_WHITE and swapping it (what pushToSprite did), testing
+// its mask bit, and copying its opaque runs. All three must give the same
+// pixels. Reported per blit, along with how many pixels each one visits.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "assets.h"
+
+static uint16_t out[3][planeSprite.w * planeSprite.h]; // The largest sprite
+
+struct Case
+{
+  const char *name;
+  const Sprite &sprite;
+  std::vector<uint16_t> keyed; // MCU byte order, TFT_WHITE where clear
+};
+
+static void drawKeyed(Canvas &c, const Case &k)
+{
+  const Sprite &s = k.sprite;
+  for (int16_t y = 0; y < s.h; y++)
+  {
+    const uint16_t *src = k.keyed.data() + y * s.w;
+    uint16_t *dst = c.row(y);
+    for (int16_t x = 0; x < s.w; x++)
+    {
+      if (src[x] != 0xFFFF) dst[x] = swap565(src[x]);
+    }
+  }
+}
+
+static void drawMasked(Canvas &c, const Case &k)
+{
+  const Sprite &s = k.sprite;
+  const int16_t stride = MASK_STRIDE(s.w);
+  for (int16_t y = 0; y < s.h; y++)
+  {
+    const uint16_t *src = s.pixels + y * s.w;
+    const uint8_t *mask = s.mask + y * stride;
+    uint16_t *dst = c.row(y);
+    for (int16_t x = 0; x < s.w; x++)
+    {
+      if (mask[x >> 3] & (0x80 >> (x & 7))) dst[x] = src[x];
+    }
+  }
+}
+
+static void drawSpans(Canvas &c, const Case &k)
+{
+  drawSprite(c, k.sprite, 0, 0);
+}
+
+static double timeBlit(void (*fn)(Canvas &, const Case &), Canvas &c, const Case &k, int repeats)
+{
+  unsigned long start = micros();
+  for (int i = 0; i < repeats; i++)
+  {
+    fn(c, k);
+    __asm__ volatile("" ::: "memory"); // Keep the loop from being folded away
+  }
+  return (micros() - start) * 1000.0 / repeats;
+}
+
+int main()
+{
+  Case cases[] = {{"ball", ballSprite, {}}, {"plane", planeSprite, {}}};
+  const int repeats = 200000;
+
+  printf("%-6s %-10s %10s %10s\n", "", "", "ns/blit", "visited");
+  for (Case &k : cases)
+  {
+    const Sprite &s = k.sprite;
+    uint32_t opaque = 0;
+    for (int16_t i = 0; i < s.w * s.h; i++)
+    {
+      bool set = s.mask[(i / s.w) * MASK_STRIDE(s.w) + (i % s.w) / 8] & (0x80 >> (i % s.w % 8));
+      k.keyed.push_back(set ? swap565(s.pixels[i]) : 0xFFFF);
+      opaque += set;
+    }
+
+    Canvas c[3];
+    for (int i = 0; i < 3; i++)
+    {
+      c[i] = Canvas{out[i], Rect{0, 0, s.w, s.h}};
+      memset(out[i], 0, sizeof(out[i]));
+    }
+    double key = timeBlit(drawKeyed, c[0], k, repeats);
+    double mask = timeBlit(drawMasked, c[1], k, repeats);
+    double spans = timeBlit(drawSpans, c[2], k, repeats);
+    if (memcmp(out[0], out[1], sizeof(out[0])) || memcmp(out[0], out[2], sizeof(out[0])))
+    {
+      printf("%s: blits disagree\n", k.name);
+      return 1;
+    }
+
+    printf("%-6s %-10s %10.1f %10d\n", k.name, "key", key, s.w * s.h);
+    printf("%-6s %-10s %10.1f %10d\n", "", "mask", mask, s.w * s.h);
+    printf("%-6s %-10s %10.1f %10u  (%u runs)\n", "", "spans", spans, (unsigned)opaque,
+           (unsigned)s.rowSpans[s.h]);
+  }
+  return 0;
+}
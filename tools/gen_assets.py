@@ -0,0 +1,615 @@
+#!/usr/bin/env python3
+"""Turn the artwork in assets/ into include/assets.h and include/plane_cache.h.
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini) and
+only rewrites the header when a PNG, the layout or this script has changed.
+It can also be run by hand from anywhere: python3 tools/gen_assets.py
+
+include/plane_cache.h, the pre-rotated plane (include/PlaneCache.h), comes
+from tools/gen_plane_cache.cpp, which has to run on the host. The header
+records a hash of everything that goes into it (PLANE_CACHE_SOURCES and the
+plane's entry in the layout). When that no longer matches, this script builds
+the generator with the host's C++ compiler ($CXX, or c++, g++ or clang++ on
+the PATH) and runs it, and fails the build if it cannot.
+
+assets/layout.txt lists each image, the PNG it comes from and where it sits
+on the instrument. For each one the header gets:
+
+  - the pixels as RGB565, already byte swapped for the panel
+  - for images with transparent pixels (PNG alpha below 128), a 1-bit mask
+    and a table of opaque runs per row
+  - a constexpr Sprite (include/Sprite.h) tying it together with its
+    position and pivot
+
+Images with identical pixels share one copy of the data.
+
+Sprites marked "tiles=NAME" are also baked over the opaque image NAME, listed
+earlier, into two opaque tiles the size of the sprite: the background alone
+and the sprite drawn over it. A lamp that never moves can then be switched by
+sending one of them to the panel straight from flash (SpriteTiles in
+include/Sprite.h). Tiles are taken from the background as it will be drawn,
+after any quantizing, so they match what composing it would give. Images marked
+"indexed=8" or "indexed=4" become an IndexedImage (include/IndexedImage.h):
+one palette index per pixel, 8 or 4 bits, and a palette of up to 256 or 16
+colours, already byte swapped. Images with more colours than that are
+quantized (see quantize()), and the error is reported in the header and on
+stdout so a lossy palette never goes unnoticed.
+
+Images marked "packed" become a PackedImage (include/PackedImage.h) instead,
+coded as below. With "indexed=8" or "indexed=4" as well, the pixels are the
+quantized ones an indexed image of the same PNG would draw, so the two can
+stand in for each other. Every row is cut into segments of SEGMENT_WIDTH pixels and each
+segment is coded on its own, so any part of any row can be decoded without
+touching the rest of the image. The code is byte oriented, one token at a
+time:
+
+  1ddddddd  one pixel, previous pixel plus a small change per channel:
+            red -2..1 (bits 6-5), green -4..3 (bits 4-2), blue -2..1 (bits 1-0)
+  01nnnnnn  previous pixel repeated n + 1 times
+  00nnnnnn  n + 1 raw pixels follow, two bytes each, little endian
+
+"Previous" starts out as black at the beginning of each segment. Packed
+pixels are in MCU byte order, since the deltas only work there. The decoder
+swaps as it writes.
+"""
+import hashlib
+import math
+import os
+import re
+import shutil
+import struct
+import subprocess
+import tempfile
+import zlib
+from collections import Counter
+
+SEGMENT_WIDTH = 64
+LAYOUT = 'assets/layout.txt'
+OUTPUT = 'include/assets.h'
+
+PLANE_CACHE = 'include/plane_cache.h'
+PLANE_SPRITE = 'planeSprite'
+# The generator and what it is built from, headers included.
+PLANE_CACHE_SOURCES = ['tools/gen_plane_cache.cpp', 'tools/include/Arduino.h',
+                       'src/PlaneCache.cpp', 'src/Rotate.cpp', 'src/Canvas.cpp', 'src/Kernels565.cpp',
+                       'src/DirtyRegion.cpp', 'include/PlaneCache.h', 'include/Rotate.h', 'include/Canvas.h',
+                       'include/Kernels565.h', 'include/DirtyRegion.h', 'include/Sprite.h',
+                       'include/TurnCoordinator.h']
+
+
+# PNG -----------------------------------------------------------------------
+
+def read_png(path):
+    """Return (width, height, pixels), pixels as (rgb565, opaque) tuples.
+
+    Only what an image editor normally saves: 8-bit RGB or RGBA, not
+    interlaced."""
+    data = open(path, 'rb').read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s: not a PNG' % path)
+
+    pos = 8
+    idat = b''
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b'IHDR':
+            width, height, depth, colour, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif kind == b'IDAT':
+            idat += body
+        pos += length + 12
+
+    if depth != 8 or colour not in (2, 6) or interlace:
+        raise ValueError('%s: must be 8-bit RGB or RGBA, not interlaced' % path)
+
+    bpp = 4 if colour == 6 else 3
+    stride = width * bpp
+    raw = zlib.decompress(idat)
+    prev = bytearray(stride)
+    pixels = []
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 255
+            elif kind == 2:
+                line[i] = (line[i] + b) & 255
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 255
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 255
+        for x in range(width):
+            r, g, b = line[x * bpp:x * bpp + 3]
+            opaque = bpp == 3 or line[x * bpp + 3] >= 128
+            rgb = ((r * 31 + 127) // 255) << 11 | ((g * 63 + 127) // 255) << 5 | (b * 31 + 127) // 255
+            pixels.append((rgb if opaque else 0, opaque))
+        prev = line
+    return width, height, pixels
+
+
+# Packed images ---------------------------------------------------------------
+
+def channels(p):
+    return p >> 11, (p >> 5) & 63, p & 31
+
+
+def pack_segment(pixels):
+    out = bytearray()
+    literals = []
+
+    def flush():
+        while literals:
+            n = min(len(literals), 64)
+            out.append(n - 1)
+            for p in literals[:n]:
+                out.extend(p.to_bytes(2, 'little'))
+            del literals[:n]
+
+    prev = 0
+    x = 0
+    while x < len(pixels):
+        p = pixels[x]
+        if p == prev:
+            n = 1
+            while x + n < len(pixels) and pixels[x + n] == prev and n < 64:
+                n += 1
+            flush()
+            out.append(0x40 | (n - 1))
+            x += n
+            continue
+
+        (r0, g0, b0), (r1, g1, b1) = channels(prev), channels(p)
+        dr, dg, db = r1 - r0, g1 - g0, b1 - b0
+        if -2 <= dr <= 1 and -4 <= dg <= 3 and -2 <= db <= 1:
+            flush()
+            out.append(0x80 | ((dr + 2) << 5) | ((dg + 4) << 2) | (db + 2))
+        else:
+            literals.append(p)
+        prev = p
+        x += 1
+    flush()
+    return out
+
+
+def unpack_segment(data):
+    out = []
+    prev = 0
+    i = 0
+    while i < len(data):
+        t = data[i]
+        i += 1
+        if t & 0x80:
+            r, g, b = channels(prev)
+            prev = (r + ((t >> 5) & 3) - 2) << 11 | (g + ((t >> 2) & 7) - 4) << 5 | (b + (t & 3) - 2)
+            out.append(prev)
+        elif t & 0x40:
+            out.extend([prev] * ((t & 0x3F) + 1))
+        else:
+            for _ in range((t & 0x3F) + 1):
+                prev = data[i] | data[i + 1] << 8
+                out.append(prev)
+                i += 2
+    return out
+
+
+def pack(width, height, pixels):
+    segments = (width + SEGMENT_WIDTH - 1) // SEGMENT_WIDTH
+    data = bytearray()
+    index = []
+    for y in range(height):
+        for s in range(segments):
+            x0 = y * width + s * SEGMENT_WIDTH
+            x1 = min(x0 + SEGMENT_WIDTH, (y + 1) * width)
+            index.append(len(data))
+            segment = pack_segment(pixels[x0:x1])
+            if unpack_segment(segment) != pixels[x0:x1]:
+                raise AssertionError('packed segment does not decode back')
+            data += segment
+    index.append(len(data))
+    return data, index
+
+
+# Indexed images ----------------------------------------------------------------
+
+def rgb888(p):
+    r, g, b = channels(p)
+    return r * 255 // 31, g * 255 // 63, b * 255 // 31
+
+
+def rgb565(r, g, b):
+    return (int(r) * 31 + 127) // 255 << 11 | (int(g) * 63 + 127) // 255 << 5 | (int(b) * 31 + 127) // 255
+
+
+def distance2(a, b):
+    return (a[0] - b[0]) ** 2 + (a[1] - b[1]) ** 2 + (a[2] - b[2]) ** 2
+
+
+def quantize(pixels, size):
+    """Return a palette of at most size RGB565 colours for pixels.
+
+    With few enough colours the palette is exact. Otherwise clusters of
+    colours are merged, cheapest first, where merging two costs how much it
+    adds to the squared error over every pixel (Ward's method). A few rounds
+    of moving each colour to its nearest entry and each entry to the middle
+    of its colours then tidy up. Distances are in 8-bit RGB."""
+    counts = Counter(pixels)
+    if len(counts) <= size:
+        return sorted(counts)
+
+    # [pixel count, sum of r, g, b] per cluster, and each one's cheapest partner
+    clusters = {p: [n] + [v * n for v in rgb888(p)] for p, n in counts.items()}
+
+    def centre(c):
+        return c[1] / c[0], c[2] / c[0], c[3] / c[0]
+
+    def cost(a, b):
+        ca, cb = clusters[a], clusters[b]
+        return ca[0] * cb[0] / (ca[0] + cb[0]) * distance2(centre(ca), centre(cb))
+
+    def nearest(a):
+        return min(((cost(a, b), b) for b in clusters if b != a), default=(float('inf'), None))
+
+    partner = {a: nearest(a) for a in clusters}
+    while len(clusters) > size:
+        a = min(partner, key=lambda k: partner[k][0])
+        b = partner[a][1]
+        clusters[a] = [x + y for x, y in zip(clusters[a], clusters.pop(b))]
+        del partner[b]
+        for k in partner:
+            if partner[k][1] in (a, b):
+                partner[k] = nearest(k)
+            elif k != a:
+                c = cost(k, a)
+                if c < partner[k][0]:
+                    partner[k] = (c, a)
+        partner[a] = nearest(a)
+
+    palette = [centre(c) for c in clusters.values()]
+    colours = [(rgb888(p), n) for p, n in counts.items()]
+    for _ in range(8):
+        sums = [[0, 0, 0, 0] for _ in palette]
+        for rgb, n in colours:
+            s = sums[min(range(len(palette)), key=lambda i: distance2(rgb, palette[i]))]
+            s[0] += n
+            for k in range(3):
+                s[k + 1] += rgb[k] * n
+        palette = [(s[1] / s[0], s[2] / s[0], s[3] / s[0]) for s in sums if s[0]]
+    return sorted(set(rgb565(*c) for c in palette))
+
+
+def index_pixels(pixels, palette):
+    """Each pixel's nearest palette entry, and the quantization error."""
+    rgb = [rgb888(p) for p in palette]
+    best = {}
+    for p in set(pixels):
+        best[p] = min(range(len(palette)), key=lambda i: distance2(rgb888(p), rgb[i]))
+    indices = [best[p] for p in pixels]
+    errors = [distance2(rgb888(p), rgb[best[p]]) for p in pixels]
+    changed = sum(1 for e in errors if e)
+    mse = sum(errors) / (3.0 * len(pixels))
+    error = {
+        'changed': 100.0 * changed / len(pixels),
+        'mean': sum(e ** 0.5 for e in errors) / len(pixels),
+        'max': max(errors) ** 0.5,
+        'psnr': 10 * math.log10(255 ** 2 / mse) if mse else float('inf'),
+    }
+    return indices, error
+
+
+def pack_indices(width, height, indices, bits):
+    if bits == 8:
+        return bytes(indices)
+    out = bytearray()
+    for y in range(height):
+        row = indices[y * width:(y + 1) * width] + [0]
+        for x in range(0, width, 2):
+            out.append(row[x] << 4 | row[x + 1])
+    return out
+
+
+# Sprites -----------------------------------------------------------------------
+
+def swap(p):
+    return (p >> 8) | (p & 0xFF) << 8
+
+
+def mask_bytes(width, height, opaque):
+    stride = (width + 7) // 8
+    out = bytearray(stride * height)
+    for y in range(height):
+        for x in range(width):
+            if opaque[y * width + x]:
+                out[y * stride + (x >> 3)] |= 0x80 >> (x & 7)
+    return out
+
+
+def opaque_runs(width, height, opaque):
+    spans, row_spans = [], []
+    for y in range(height):
+        row_spans.append(len(spans))
+        x = 0
+        while x < width:
+            if not opaque[y * width + x]:
+                x += 1
+                continue
+            start = x
+            while x < width and opaque[y * width + x]:
+                x += 1
+            spans.append((start, x - start))
+    row_spans.append(len(spans))
+    return spans, row_spans
+
+
+def bake_tiles(e, width, height, image, backgrounds):
+    """The pixels under the sprite's rectangle, and the sprite drawn over them."""
+    if e['tiles'] not in backgrounds:
+        raise ValueError('%s: tiles=%s must name an opaque image listed before it' % (e['name'], e['tiles']))
+    bx, by, bw, bh, under = backgrounds[e['tiles']]
+    x, y = e['x'] - bx, e['y'] - by
+    if x < 0 or y < 0 or x + width > bw or y + height > bh:
+        raise ValueError('%s: does not lie inside %s' % (e['name'], e['tiles']))
+    off = [under[(y + j) * bw + x + i] for j in range(height) for i in range(width)]
+    on = [p if o else u for (p, o), u in zip(image, off)]
+    return off, on
+
+
+# Output ------------------------------------------------------------------------
+
+def c_array(out, decl, values, fmt, per_line):
+    out.append('static const %s[%d] PROGMEM = {' % (decl, len(values)))
+    for i in range(0, len(values), per_line):
+        out.append(', '.join(fmt % v for v in values[i:i + per_line]) + ',')
+    out.append('};')
+    out.append('')
+
+
+def read_layout(path):
+    entries = []
+    for number, line in enumerate(open(path), 1):
+        words = line.split('#')[0].split()
+        if not words:
+            continue
+        if len(words) < 4:
+            raise ValueError('%s:%d: expected name file x y [options]' % (path, number))
+        name, png, x, y = words[:4]
+        entry = {'name': name, 'png': png, 'x': 0 if x == '-' else int(x), 'y': 0 if y == '-' else int(y),
+                 'pivot': (0, 0), 'packed': False, 'indexed': 0, 'tiles': None}
+        for option in words[4:]:
+            if option == 'packed':
+                entry['packed'] = True
+            elif option in ('indexed=8', 'indexed=4'):
+                entry['indexed'] = int(option[8:])
+            elif option.startswith('tiles='):
+                entry['tiles'] = option[6:]
+            elif option.startswith('pivot='):
+                entry['pivot'] = tuple(int(v) for v in option[6:].split(','))
+            else:
+                raise ValueError('%s:%d: unknown option %s' % (path, number, option))
+        entries.append(entry)
+    return entries
+
+
+def generate(root):
+    layout = read_layout(os.path.join(root, LAYOUT))
+    out = ['#pragma once', '#include <Arduino.h>', '#include "IndexedImage.h"', '#include "PackedImage.h"',
+           '#include "Sprite.h"', '',
+           '// Generated by tools/gen_assets.py from %s. Do not edit.' % LAYOUT, '']
+    shared = {}  # Pixel data already emitted, to the name it went out under
+    shared_tiles = {}  # Opaque pixel arrays already emitted, to their C++ name
+    backgrounds = {}  # Opaque images, to (x, y, width, height, pixels as drawn)
+    quantized = []  # Error reports for indexed images
+    total = saved = 0
+
+    for e in layout:
+        name = e['name']
+        width, height, image = read_png(os.path.join(root, 'assets', e['png']))
+        colours = [p for p, _ in image]
+        opaque = [o for _, o in image]
+
+        if e['indexed'] and not e['packed']:
+            if not all(opaque):
+                raise ValueError('%s: indexed images must be opaque' % e['png'])
+            bits = e['indexed']
+            palette = quantize(colours, 1 << bits)
+            indices, error = index_pixels(colours, palette)
+            backgrounds[name] = (e['x'], e['y'], width, height, [palette[i] for i in indices])
+            data = pack_indices(width, height, indices, bits)
+            size = len(data) + len(palette) * 2
+            total += size
+            report = ('%d of %d colours, %.2f%% of pixels changed, RGB error mean %.2f max %.1f of 255, '
+                      'PSNR %.1f dB' % (len(palette), len(set(colours)), error['changed'], error['mean'],
+                                        error['max'], error['psnr']))
+            quantized.append('%s: %s' % (e['png'], report))
+            out.append('// %s: %dx%d, %d-bit indexed, %d bytes plus a %d byte palette (%.0f%% of %d)' % (
+                e['png'], width, height, bits, len(data), len(palette) * 2, 100.0 * size / (width * height * 2),
+                width * height * 2))
+            out.append('// Palette: %s' % report)
+            c_array(out, 'uint8_t %sIndices' % name, list(data), '0x%02X', 24)
+            c_array(out, 'uint16_t %sPalette' % name, [swap(p) for p in palette], '0x%04X', 16)
+            out.append('constexpr IndexedImage %s = {%sIndices, %sPalette, %d, %d, %d};' % (
+                name, name, name, width, height, bits))
+            out.append('')
+            continue
+
+        if e['packed']:
+            if not all(opaque):
+                raise ValueError('%s: packed images must be opaque' % e['png'])
+            if e['indexed']:
+                # The same pixels as the indexed image would draw, packed.
+                palette = quantize(colours, 1 << e['indexed'])
+                colours = [palette[i] for i in index_pixels(colours, palette)[0]]
+            data, index = pack(width, height, colours)
+            backgrounds[name] = (e['x'], e['y'], width, height, colours)
+            size = len(data) + len(index) * 4
+            total += size
+            out.append('// %s: %dx%d, %d bytes packed from %d (%.0f%%), plus a %d byte index%s' % (
+                e['png'], width, height, len(data), width * height * 2, 100.0 * len(data) / (width * height * 2),
+                len(index) * 4, ', after an %d-bit palette' % e['indexed'] if e['indexed'] else ''))
+            c_array(out, 'uint8_t %sData' % name, list(data), '0x%02X', 24)
+            c_array(out, 'uint32_t %sIndex' % name, index, '%d', 10)
+            out.append('constexpr PackedImage %s = {%sData, %sIndex, %d, %d, %d};' % (
+                name, name, name, width, height, SEGMENT_WIDTH))
+            out.append('')
+            continue
+
+        key = (width, height, tuple(image))
+        transparent = not all(opaque)
+        spans, row_spans = opaque_runs(width, height, opaque) if transparent else ([], [])
+        if key in shared:
+            data = shared[key]
+            saved += width * height * 2
+            out.append('// %s: %s, %dx%d, same pixels as %s' % (name, e['png'], width, height, data))
+        else:
+            data = shared[key] = name
+            size = width * height * 2
+            if transparent:
+                size += len(mask_bytes(width, height, opaque)) + len(spans) * 4 + len(row_spans) * 2
+            total += size
+            if transparent:
+                out.append('// %s: %s, %dx%d, %d of %d pixels opaque in %d runs, %d bytes' % (
+                    name, e['png'], width, height, sum(opaque), len(opaque), len(spans), size))
+            else:
+                out.append('// %s: %s, %dx%d, opaque, %d bytes' % (name, e['png'], width, height, size))
+            c_array(out, 'uint16_t %sPixels' % name, [swap(p) for p in colours], '0x%04X', 16)
+            if transparent:
+                c_array(out, 'uint8_t %sMask' % name, list(mask_bytes(width, height, opaque)), '0x%02X', 24)
+                c_array(out, 'SpriteSpan %sSpans' % name, spans, '{%d, %d}', 8)
+                c_array(out, 'uint16_t %sRowSpans' % name, row_spans, '%d', 16)
+
+        if transparent:
+            parts = (data, data, data, data)
+            refs = '%sPixels, %sMask, %sSpans, %sRowSpans' % parts
+        else:
+            refs = '%sPixels, nullptr, nullptr, nullptr' % data
+        out.append('constexpr Sprite %s = {%s, %d, %d, %d, %d, %d, %d};' % (
+            name, refs, width, height, e['x'], e['y'], e['pivot'][0], e['pivot'][1]))
+        out.append('')
+        if not transparent:
+            backgrounds[name] = (e['x'], e['y'], width, height, colours)
+            shared_tiles.setdefault((width, height, tuple(colours)), '%sPixels' % data)
+
+        if e['tiles']:
+            tiles, arrays = [], []
+            for suffix, pixels in zip(('Off', 'On'), bake_tiles(e, width, height, image, backgrounds)):
+                key = (width, height, tuple(pixels))
+                if key in shared_tiles:
+                    saved += width * height * 2
+                else:
+                    shared_tiles[key] = '%sTile%s' % (name, suffix)
+                    arrays.append((shared_tiles[key], pixels))
+                    total += width * height * 2
+                tiles.append(shared_tiles[key])
+            out.append('// %sTiles: over %s, off as %s, on as %s, %d new bytes' % (
+                name, e['tiles'], tiles[0], tiles[1], len(arrays) * width * height * 2))
+            for array, pixels in arrays:
+                c_array(out, 'uint16_t %s' % array, [swap(p) for p in pixels], '0x%04X', 16)
+            out.append('constexpr SpriteTiles %sTiles = {%s, %s};' % (name, tiles[0], tiles[1]))
+            out.append('')
+
+    out.insert(7, '// %d bytes of flash if every image is used, %d saved by sharing identical images' % (
+        total, saved))
+    return '\n'.join(out), quantized
+
+
+def stale(root):
+    target = os.path.join(root, OUTPUT)
+    if not os.path.exists(target):
+        return True
+    built = os.path.getmtime(target)
+    sources = [os.path.join(root, LAYOUT), os.path.join(root, 'tools', 'gen_assets.py')]
+    sources += [os.path.join(root, 'assets', e['png']) for e in read_layout(os.path.join(root, LAYOUT))]
+    return any(os.path.getmtime(s) > built for s in sources)
+
+
+def plane_cache_hash(root):
+    """Hash of the plane's PNG, its layout entry and PLANE_CACHE_SOURCES."""
+    h = hashlib.sha256()
+    entry = [e for e in read_layout(os.path.join(root, LAYOUT)) if e['name'] == PLANE_SPRITE]
+    if len(entry) != 1:
+        raise ValueError('%s: no %s' % (LAYOUT, PLANE_SPRITE))
+    h.update(repr(sorted(entry[0].items())).encode())
+    for path in [os.path.join('assets', entry[0]['png'])] + PLANE_CACHE_SOURCES:
+        h.update(path.encode() + b'\0')
+        h.update(open(os.path.join(root, path), 'rb').read().replace(b'\r\n', b'\n'))
+    return h.hexdigest()[:16]
+
+
+def plane_cache_stored_hash(root):
+    target = os.path.join(root, PLANE_CACHE)
+    if not os.path.exists(target):
+        return None
+    with open(target) as f:
+        for line in f:
+            m = re.match(r'// Source hash: ([0-9a-f]+)$', line.strip())
+            if m:
+                return m.group(1)
+            if not line.startswith(('//', '#', '\n')):
+                return None
+    return None
+
+
+def build_plane_cache(root, digest):
+    """Build and run tools/gen_plane_cache.cpp on the host into PLANE_CACHE."""
+    cxx = os.environ.get('CXX') or shutil.which('c++') or shutil.which('g++') or shutil.which('clang++')
+    if not cxx:
+        raise RuntimeError('gen_assets: %s is out of date and there is no host C++ compiler to rebuild it '
+                           '(set CXX)' % PLANE_CACHE)
+    sources = [s for s in PLANE_CACHE_SOURCES if s.endswith('.cpp')]
+    with tempfile.TemporaryDirectory() as tmp:
+        program = os.path.join(tmp, 'gen_plane_cache')
+        try:
+            subprocess.run([cxx, '-std=gnu++17', '-O2', '-DPLANE_CACHE_RAM', '-Itools/include', '-Iinclude'] +
+                           sources + ['-o', program], cwd=root, check=True)
+            result = subprocess.run([program, digest], cwd=root, check=True,
+                                    stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        except (OSError, subprocess.CalledProcessError) as e:
+            detail = (getattr(e, 'stderr', None) or b'').decode().strip()
+            raise RuntimeError('gen_assets: could not rebuild %s: %s%s' % (PLANE_CACHE, e, detail and '\n' + detail))
+    with open(os.path.join(root, PLANE_CACHE), 'wb') as f:
+        f.write(result.stdout)
+    print('gen_assets: wrote %s' % PLANE_CACHE)
+    for line in result.stderr.decode().splitlines():
+        print('gen_assets: %s' % line)
+
+
+def check_plane_cache(root):
+    digest = plane_cache_hash(root)
+    if plane_cache_stored_hash(root) == digest:
+        return
+    build_plane_cache(root, digest)
+    if plane_cache_stored_hash(root) != digest:
+        raise RuntimeError('gen_assets: %s does not match its sources (hash %s)' % (PLANE_CACHE, digest))
+
+
+def run(root, force=False):
+    write_assets(root, force)
+    # After the assets, since the generator is built against assets.h.
+    check_plane_cache(root)
+
+
+def write_assets(root, force):
+    if not force and not stale(root):
+        return
+    text, quantized = generate(root)
+    for report in quantized:
+        print('gen_assets: %s' % report)
+    target = os.path.join(root, OUTPUT)
+    if os.path.exists(target) and open(target).read() == text:
+        os.utime(target)
+        return
+    with open(target, 'w') as f:
+        f.write(text)
+    print('gen_assets: wrote %s' % OUTPUT)
+
+
+if 'Import' in globals():  # Loaded by PlatformIO as a pre: extra script
+    Import('env')  # noqa: F821
+    run(env['PROJECT_DIR'])  # noqa: F821
+elif __name__ == '__main__':
+    run(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), force=True)
@@ -0,0 +1,100 @@
+// Generates include/plane_cache.h, the flash-resident pre-rotated plane.
+//
+// It runs the same walk the device uses for a RAM cache, so the output is
+// identical either way. tools/gen_assets.py builds and runs it before the
+// firmware is built whenever assets/plane.png or the code it is built from
+// has changed, passing the hash of its sources for the header to record.
+// How long the walk took goes to stderr, for gen_assets.py to print:
+//
+//   python3 tools/gen_assets.py
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <vector>
+#include "PlaneCache.h"
+
+// Struct sizes on the RP2040, where pointers are 4 bytes.
+#define DEVICE_SPAN_BYTES 8
+#define DEVICE_ROTATION_BYTES 12
+
+struct Collect : PlaneCacheBuilder
+{
+  struct Angle
+  {
+    Rect bounds;
+    uint32_t firstRow;
+  };
+  struct Span
+  {
+    int16_t x;
+    uint16_t len;
+    uint32_t pixel;
+  };
+
+  std::vector<Angle> angles;
+  std::vector<Span> spans;
+  std::vector<uint16_t> rowSpans;
+  std::vector<uint16_t> pixels;
+
+  void beginAngle(int16_t, const Rect &bounds) override { angles.push_back(Angle{bounds, (uint32_t)rowSpans.size()}); }
+  void beginRow() override { rowSpans.push_back(spans.size()); }
+  void span(int16_t x, uint16_t len, const uint16_t *p) override
+  {
+    spans.push_back(Span{x, len, (uint32_t)pixels.size()});
+    pixels.insert(pixels.end(), p, p + len);
+  }
+};
+
+int main(int argc, char **argv)
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: gen_plane_cache SOURCE_HASH > include/plane_cache.h (see tools/gen_assets.py)\n");
+    return 2;
+  }
+
+  Collect c;
+  unsigned long start = micros();
+  planeCacheWalk(c);
+  unsigned long took = micros() - start;
+  c.rowSpans.push_back(c.spans.size());
+
+  uint32_t bytes = c.pixels.size() * sizeof(uint16_t) + c.spans.size() * DEVICE_SPAN_BYTES +
+                   c.rowSpans.size() * sizeof(uint16_t) + c.angles.size() * DEVICE_ROTATION_BYTES;
+
+  printf("#pragma once\n\n");
+  printf("// Generated by tools/gen_plane_cache.cpp from assets/plane.png. Do not edit.\n");
+  printf("// Source hash: %s\n", argv[1]);
+  printf("// Angles %d to %d, %zu pixels, %zu spans, %zu rows\n", PLANE_MIN_ANGLE, PLANE_MAX_ANGLE,
+         c.pixels.size(), c.spans.size(), c.rowSpans.size() - 1);
+  printf("// Flash used : %u bytes\n\n", (unsigned)bytes);
+
+  // Not in the header, which would then change on every build.
+  fprintf(stderr, "plane cache built in %lu us on the host\n", took);
+
+  printf("static const uint16_t planeCachePixels[%zu] PROGMEM = {\n", c.pixels.size());
+  for (size_t i = 0; i < c.pixels.size(); i++)
+    printf("0x%04X,%s", c.pixels[i], (i % 16 == 15 || i + 1 == c.pixels.size()) ? "\n" : " ");
+  printf("};\n\n");
+
+  printf("static const PlaneSpan planeCacheSpans[%zu] PROGMEM = {\n", c.spans.size());
+  for (size_t i = 0; i < c.spans.size(); i++)
+    printf("{%d, %u, planeCachePixels + %u},%s", c.spans[i].x, c.spans[i].len, (unsigned)c.spans[i].pixel,
+           (i % 4 == 3 || i + 1 == c.spans.size()) ? "\n" : " ");
+  printf("};\n\n");
+
+  printf("static const uint16_t planeCacheRowSpans[%zu] PROGMEM = {\n", c.rowSpans.size());
+  for (size_t i = 0; i < c.rowSpans.size(); i++)
+    printf("%u,%s", c.rowSpans[i], (i % 16 == 15 || i + 1 == c.rowSpans.size()) ? "\n" : " ");
+  printf("};\n\n");
+
+  printf("static const PlaneRotation planeCacheRotations[PLANE_ANGLES] PROGMEM = {\n");
+  for (const Collect::Angle &a : c.angles)
+    printf("{{%d, %d, %d, %d}, planeCacheRowSpans + %u},\n", a.bounds.x, a.bounds.y, a.bounds.w, a.bounds.h,
+           (unsigned)a.firstRow);
+  printf("};\n\n");
+
+  printf("static const PlaneCacheInfo planeCacheStats = {%zu, %zu, %zu, %u, 0};\n",
+         c.pixels.size(), c.spans.size(), c.rowSpans.size() - 1, (unsigned)bytes);
+  return 0;
+}
@@ -0,0 +1,12 @@
+#pragma once
+// Just enough of Arduino.h for the host-side tools to include the image headers.
+#include <stdint.h>
+#include <chrono>
+
+#define PROGMEM
+
+inline unsigned long micros()
+{
+  static auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}